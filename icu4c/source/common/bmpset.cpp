@@ -17,15 +17,167 @@
 */
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/utf8.h"
 #include "unicode/utf16.h"
 #include "cmemory.h"
 #include "bmpset.h"
 #include "uassert.h"
+#include "usimd.h"
+
+/*
+ * Minimum number of inversion list entries at or above U+0800
+ * for which a BMPSet builds a trie.
+ * Below this, the binary searches take at most 5 steps.
+ */
+#ifndef BMPSET_MIN_TRIE_LIST_LENGTH
+#   define BMPSET_MIN_TRIE_LIST_LENGTH 32
+#endif
+
+#if BMPSET_SSSE3
+#   include <tmmintrin.h>
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   endif
+#endif
 
 U_NAMESPACE_BEGIN
 
+#if BMPSET_SSSE3
+
+namespace {
+
+/* Number of code units from the start of a block of 16 up to the first unit not in okMask. */
+inline int32_t prefixLength(uint32_t okMask) {
+    // Branch rather than count for full blocks, so that the CPU can
+    // speculatively load the next block before this one is done.
+    if(okMask==0xffff) {
+        return 16;
+    }
+    uint32_t notOk=~okMask;  // bits 16..31 are set
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanForward(&i, notOk);
+    return (int32_t)i;
+#else
+    return __builtin_ctz(notOk);
+#endif
+}
+
+/* Number of code units from the last unit not in okMask to the end of a block of 16. */
+inline int32_t suffixLength(uint32_t okMask) {
+    uint32_t notOk=~okMask&0xffff;
+    if(notOk==0) {
+        return 16;
+    }
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanReverse(&i, notOk);
+    return 15-(int32_t)i;
+#else
+    return __builtin_clz(notOk)-16;
+#endif
+}
+
+/*
+ * Looks up each byte value 00..FF in the Latin-1 bitmap.
+ * @return 0xff for each byte whose value is in the set, 0 for the others
+ */
+U_SIMD_TARGET_SSSE3 inline __m128i
+latin1Lookup(__m128i v, const uint8_t latin1Rows[32]) {
+    const __m128i rowsLow=_mm_loadu_si128((const __m128i *)latin1Rows);
+    const __m128i rowsHigh=_mm_loadu_si128((const __m128i *)(latin1Rows+16));
+    const __m128i bitValues=_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)0x80,
+                                          1, 2, 4, 8, 16, 32, 64, (char)0x80);
+    // PSHUFB yields 0 for index bytes with bit 7 set,
+    // so each byte gets its row from exactly one of the two tables.
+    __m128i index=_mm_and_si128(v, _mm_set1_epi8((char)0x8f));
+    __m128i row=_mm_or_si128(
+        _mm_shuffle_epi8(rowsLow, index),
+        _mm_shuffle_epi8(rowsHigh, _mm_xor_si128(index, _mm_set1_epi8((char)0x80))));
+    __m128i bit=_mm_shuffle_epi8(bitValues, _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0xf)));
+    return _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit);
+}
+
+/*
+ * Looks up the low 5 bits of each byte in block7FF[].
+ */
+U_SIMD_TARGET_SSSE3 inline __m128i
+block7FFLookup(__m128i v, const uint8_t block7FF[32]) {
+    const __m128i blocksLow=_mm_loadu_si128((const __m128i *)block7FF);
+    const __m128i blocksHigh=_mm_loadu_si128((const __m128i *)(block7FF+16));
+    const __m128i bit4=_mm_set1_epi8(0x10);
+    __m128i index=_mm_and_si128(v, _mm_set1_epi8(0xf));
+    __m128i isHigh=_mm_cmpeq_epi8(_mm_and_si128(v, bit4), bit4);
+    return _mm_or_si128(
+        _mm_shuffle_epi8(blocksLow, _mm_or_si128(index, isHigh)),
+        _mm_shuffle_epi8(blocksHigh, _mm_or_si128(index, _mm_andnot_si128(isHigh, _mm_set1_epi8((char)0x80)))));
+}
+
+/*
+ * Tests 16 UTF-16 code units.
+ * @return bit i set if s[i] is a Latin-1 character or a character from
+ *         a U+0100..U+07FF 64-block, for which contains()==spanCondition
+ */
+U_SIMD_TARGET_SSSE3 uint32_t
+spanMaskUTF16(const UChar *s, const uint8_t latin1Rows[32], const uint8_t block7FF[32],
+              USetSpanCondition spanCondition) {
+    const __m128i zero=_mm_setzero_si128();
+    __m128i v0=_mm_loadu_si128((const __m128i *)s);
+    __m128i v1=_mm_loadu_si128((const __m128i *)(s+8));
+    __m128i highByte=_mm_set1_epi16((short)0xff00);
+    uint32_t isLatin1=(uint32_t)_mm_movemask_epi8(_mm_packs_epi16(
+        _mm_cmpeq_epi16(_mm_and_si128(v0, highByte), zero),
+        _mm_cmpeq_epi16(_mm_and_si128(v1, highByte), zero)));
+    // Units above U+00FF become 00 or FF here; they are excluded via isLatin1.
+    uint32_t contained=(uint32_t)_mm_movemask_epi8(latin1Lookup(_mm_packus_epi16(v0, v1), latin1Rows));
+    uint32_t okMask=isLatin1&(spanCondition ? contained : ~contained);
+    if(isLatin1!=0xffff) {
+        __m128i above7FF=_mm_set1_epi16((short)0xf800);
+        uint32_t is7FF=(uint32_t)_mm_movemask_epi8(_mm_packs_epi16(
+            _mm_cmpeq_epi16(_mm_and_si128(v0, above7FF), zero),
+            _mm_cmpeq_epi16(_mm_and_si128(v1, above7FF), zero)));
+        __m128i leads=_mm_packus_epi16(_mm_srli_epi16(v0, 6), _mm_srli_epi16(v1, 6));
+        uint32_t sameBlock=(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            block7FFLookup(leads, block7FF), _mm_set1_epi8((char)spanCondition)));
+        okMask|=is7FF&~isLatin1&sameBlock;
+    }
+    return okMask;
+}
+
+/*
+ * Tests 16 UTF-8 bytes.
+ * @return bit i set if s[i] is part of an ASCII character or of a complete 2-byte
+ *         sequence for a character from a U+0080..U+07FF 64-block,
+ *         for which contains()==spanCondition
+ */
+U_SIMD_TARGET_SSSE3 uint32_t
+spanMaskUTF8(const uint8_t *s, const uint8_t latin1Rows[32], const uint8_t block7FF[32],
+             USetSpanCondition spanCondition) {
+    __m128i v=_mm_loadu_si128((const __m128i *)s);
+    uint32_t isAscii=~(uint32_t)_mm_movemask_epi8(v)&0xffff;
+    uint32_t contained=(uint32_t)_mm_movemask_epi8(latin1Lookup(v, latin1Rows));
+    uint32_t okMask=isAscii&(spanCondition ? contained : ~contained);
+    if(isAscii!=0xffff) {
+        uint32_t leads=(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(v, _mm_set1_epi8((char)0xe0)), _mm_set1_epi8((char)0xc0)));
+        uint32_t trails=(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            _mm_and_si128(v, _mm_set1_epi8((char)0xc0)), _mm_set1_epi8((char)0x80)));
+        uint32_t sameBlock=(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(
+            block7FFLookup(v, block7FF), _mm_set1_epi8((char)spanCondition)));
+        // A lead byte counts only if it is followed by a trail byte in this block.
+        uint32_t okLeads=leads&sameBlock&(trails>>1);
+        okMask|=okLeads|(okLeads<<1);
+    }
+    return okMask;
+}
+
+}  // namespace
+
+#endif
+
 BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
         list(parentList), listLength(parentListLength) {
     uprv_memset(latin1Contains, 0, sizeof(latin1Contains));
@@ -45,22 +197,38 @@ BMPSet::BMPSet(const int32_t *parentList, int32_t parentListLength) :
         list4kStarts[i]=findCodePoint(i<<12, list4kStarts[i-1], listLength-1);
     }
     list4kStarts[0x11]=listLength-1;
+    initTrie();
     containsFFFD=containsSlow(0xfffd, list4kStarts[0xf], list4kStarts[0x10]);
 
     initBits();
     overrideIllegal();
+    initSimdTables();
 }
 
 BMPSet::BMPSet(const BMPSet &otherBMPSet, const int32_t *newParentList, int32_t newParentListLength) :
-        containsFFFD(otherBMPSet.containsFFFD),
+        containsFFFD(otherBMPSet.containsFFFD), simdMinLength(otherBMPSet.simdMinLength),
         list(newParentList), listLength(newParentListLength) {
     uprv_memcpy(latin1Contains, otherBMPSet.latin1Contains, sizeof(latin1Contains));
     uprv_memcpy(table7FF, otherBMPSet.table7FF, sizeof(table7FF));
     uprv_memcpy(bmpBlockBits, otherBMPSet.bmpBlockBits, sizeof(bmpBlockBits));
+    uprv_memcpy(latin1Rows, otherBMPSet.latin1Rows, sizeof(latin1Rows));
+    uprv_memcpy(block7FF, otherBMPSet.block7FF, sizeof(block7FF));
     uprv_memcpy(list4kStarts, otherBMPSet.list4kStarts, sizeof(list4kStarts));
+    // The new parent list has the same contents; rebuild rather than share the trie.
+    initTrie();
 }
 
 BMPSet::~BMPSet() {
+    ucptrie_close(trie);
+}
+
+int32_t BMPSet::getMemoryUsage() const {
+    int32_t size=(int32_t)sizeof(BMPSet);
+    if(trie!=NULL) {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        size+=(int32_t)sizeof(UCPTrie)+ucptrie_toBinary(trie, NULL, 0, &errorCode);
+    }
+    return size;
 }
 
 /*
@@ -254,6 +422,66 @@ void BMPSet::overrideIllegal() {
     }
 }
 
+/*
+ * Set the tables for the SSSE3 span code from latin1Contains[] and table7FF[].
+ */
+void BMPSet::initSimdTables() {
+    int32_t i;
+
+    uprv_memset(latin1Rows, 0, sizeof(latin1Rows));
+    for(i=0; i<0x100; ++i) {
+        if(latin1Contains[i]) {
+            latin1Rows[((i>>7)<<4)|(i&0xf)]|=(uint8_t)(1<<((i>>4)&7));
+        }
+    }
+
+    block7FF[0]=block7FF[1]=2;
+    for(int32_t lead=2; lead<32; ++lead) {
+        uint32_t bit=(uint32_t)1<<lead;
+        uint32_t all=bit, any=0;
+        for(i=0; i<64; ++i) {
+            all&=table7FF[i];
+            any|=table7FF[i];
+        }
+        block7FF[lead]= (all&bit) ? 1 : (any&bit) ? 2 : 0;
+    }
+
+    simdMinLength=INT32_MAX;
+#if BMPSET_SSSE3
+    if(uprv_getCPUFeatures()&UPRV_CPU_SSSE3) {
+        simdMinLength=BMPSET_SIMD_MIN_LENGTH;
+    }
+#endif
+}
+
+/*
+ * Build the trie if binary searches over the inversion list from U+0800 on
+ * would take more than a few steps.
+ * The trie is optional: Without it (also on failure) containsSlow()
+ * searches the list.
+ */
+void BMPSet::initTrie() {
+    trie=NULL;
+    if((listLength-1-list4kStarts[0])<BMPSET_MIN_TRIE_LIST_LENGTH) {
+        return;
+    }
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UMutableCPTrie *mutableTrie=umutablecptrie_open(0, 0, &errorCode);
+    for(int32_t i=list4kStarts[0]&~1; i<(listLength-1) && U_SUCCESS(errorCode); i+=2) {
+        UChar32 start=list[i];
+        if(start<0x800) {
+            start=0x800;
+        }
+        umutablecptrie_setRange(mutableTrie, start, list[i+1]-1, 1, &errorCode);
+    }
+    trie=umutablecptrie_buildImmutable(mutableTrie, UCPTRIE_TYPE_FAST, UCPTRIE_VALUE_BITS_8, &errorCode);
+    umutablecptrie_close(mutableTrie);
+    if(U_FAILURE(errorCode)) {
+        ucptrie_close(trie);
+        trie=NULL;
+    }
+}
+
 int32_t BMPSet::findCodePoint(UChar32 c, int32_t lo, int32_t hi) const {
     /* Examples:
                                        findCodePoint(c)
@@ -316,11 +544,14 @@ BMPSet::contains(UChar32 c) const {
 }
 
 /*
+ * Spans one code point at a time until one does not match or until
+ * the span reaches or (with a surrogate pair) passes stop<=limit.
  * Check for sufficient length for trail unit for each surrogate pair.
  * Handle single surrogates as surrogate code points as usual in ICU.
  */
 const UChar *
-BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+BMPSet::spanScalar(const UChar *s, const UChar *stop, const UChar *limit,
+                   USetSpanCondition spanCondition) const {
     UChar c, c2;
 
     if(spanCondition) {
@@ -329,11 +560,11 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
             c=*s;
             if(c<=0xff) {
                 if(!latin1Contains[c]) {
-                    break;
+                    return s;
                 }
             } else if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))==0) {
-                    break;
+                    return s;
                 }
             } else if(c<0xd800 || c>=0xe000) {
                 int lead=c>>12;
@@ -342,38 +573,38 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                     // All 64 code points with the same bits 15..6
                     // are either in the set or not.
                     if(twoBits==0) {
-                        break;
+                        return s;
                     }
                 } else {
                     // Look up the code point in its 4k block of code points.
                     if(!containsSlow(c, list4kStarts[lead], list4kStarts[lead+1])) {
-                        break;
+                        return s;
                     }
                 }
             } else if(c>=0xdc00 || (s+1)==limit || (c2=s[1])<0xdc00 || c2>=0xe000) {
                 // surrogate code point
                 if(!containsSlow(c, list4kStarts[0xd], list4kStarts[0xe])) {
-                    break;
+                    return s;
                 }
             } else {
                 // surrogate pair
                 if(!containsSlow(U16_GET_SUPPLEMENTARY(c, c2), list4kStarts[0x10], list4kStarts[0x11])) {
-                    break;
+                    return s;
                 }
                 ++s;
             }
-        } while(++s<limit);
+        } while(++s<stop);
     } else {
         // span not
         do {
             c=*s;
             if(c<=0xff) {
                 if(latin1Contains[c]) {
-                    break;
+                    return s;
                 }
             } else if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))!=0) {
-                    break;
+                    return s;
                 }
             } else if(c<0xd800 || c>=0xe000) {
                 int lead=c>>12;
@@ -382,34 +613,38 @@ BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition
                     // All 64 code points with the same bits 15..6
                     // are either in the set or not.
                     if(twoBits!=0) {
-                        break;
+                        return s;
                     }
                 } else {
                     // Look up the code point in its 4k block of code points.
                     if(containsSlow(c, list4kStarts[lead], list4kStarts[lead+1])) {
-                        break;
+                        return s;
                     }
                 }
             } else if(c>=0xdc00 || (s+1)==limit || (c2=s[1])<0xdc00 || c2>=0xe000) {
                 // surrogate code point
                 if(containsSlow(c, list4kStarts[0xd], list4kStarts[0xe])) {
-                    break;
+                    return s;
                 }
             } else {
                 // surrogate pair
                 if(containsSlow(U16_GET_SUPPLEMENTARY(c, c2), list4kStarts[0x10], list4kStarts[0x11])) {
-                    break;
+                    return s;
                 }
                 ++s;
             }
-        } while(++s<limit);
+        } while(++s<stop);
     }
     return s;
 }
 
-/* Symmetrical with span(). */
+/*
+ * Symmetrical with spanScalar(), but stop must not split a surrogate pair.
+ * Returns stop or an earlier position if the span reaches stop.
+ */
 const UChar *
-BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+BMPSet::spanBackScalar(const UChar *s, const UChar *stop, const UChar *limit,
+                       USetSpanCondition spanCondition) const {
     UChar c, c2;
 
     if(spanCondition) {
@@ -418,11 +653,11 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
             c=*(--limit);
             if(c<=0xff) {
                 if(!latin1Contains[c]) {
-                    break;
+                    return limit+1;
                 }
             } else if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))==0) {
-                    break;
+                    return limit+1;
                 }
             } else if(c<0xd800 || c>=0xe000) {
                 int lead=c>>12;
@@ -431,28 +666,28 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
                     // All 64 code points with the same bits 15..6
                     // are either in the set or not.
                     if(twoBits==0) {
-                        break;
+                        return limit+1;
                     }
                 } else {
                     // Look up the code point in its 4k block of code points.
                     if(!containsSlow(c, list4kStarts[lead], list4kStarts[lead+1])) {
-                        break;
+                        return limit+1;
                     }
                 }
             } else if(c<0xdc00 || s==limit || (c2=*(limit-1))<0xd800 || c2>=0xdc00) {
                 // surrogate code point
                 if(!containsSlow(c, list4kStarts[0xd], list4kStarts[0xe])) {
-                    break;
+                    return limit+1;
                 }
             } else {
                 // surrogate pair
                 if(!containsSlow(U16_GET_SUPPLEMENTARY(c2, c), list4kStarts[0x10], list4kStarts[0x11])) {
-                    break;
+                    return limit+1;
                 }
                 --limit;
             }
-            if(s==limit) {
-                return s;
+            if(limit<=stop) {
+                break;
             }
         }
     } else {
@@ -461,11 +696,11 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
             c=*(--limit);
             if(c<=0xff) {
                 if(latin1Contains[c]) {
-                    break;
+                    return limit+1;
                 }
             } else if(c<=0x7ff) {
                 if((table7FF[c&0x3f]&((uint32_t)1<<(c>>6)))!=0) {
-                    break;
+                    return limit+1;
                 }
             } else if(c<0xd800 || c>=0xe000) {
                 int lead=c>>12;
@@ -474,59 +709,69 @@ BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondi
                     // All 64 code points with the same bits 15..6
                     // are either in the set or not.
                     if(twoBits!=0) {
-                        break;
+                        return limit+1;
                     }
                 } else {
                     // Look up the code point in its 4k block of code points.
                     if(containsSlow(c, list4kStarts[lead], list4kStarts[lead+1])) {
-                        break;
+                        return limit+1;
                     }
                 }
             } else if(c<0xdc00 || s==limit || (c2=*(limit-1))<0xd800 || c2>=0xdc00) {
                 // surrogate code point
                 if(containsSlow(c, list4kStarts[0xd], list4kStarts[0xe])) {
-                    break;
+                    return limit+1;
                 }
             } else {
                 // surrogate pair
                 if(containsSlow(U16_GET_SUPPLEMENTARY(c2, c), list4kStarts[0x10], list4kStarts[0x11])) {
-                    break;
+                    return limit+1;
                 }
                 --limit;
             }
-            if(s==limit) {
-                return s;
+            if(limit<=stop) {
+                break;
             }
         }
     }
-    return limit+1;
+    return limit;
 }
 
 /*
+ * Spans one character at a time until one does not match or until
+ * the span reaches or (with a multi-byte sequence) passes stop<=limit.
  * Precheck for sufficient trail bytes at end of string only once per span.
  * Check validity.
  */
 const uint8_t *
-BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
-    const uint8_t *limit=s+length;
+BMPSet::spanUTF8Scalar(const uint8_t *s, const uint8_t *stop, const uint8_t *limit,
+                       USetSpanCondition spanCondition) const {
+    int32_t length=(int32_t)(limit-s);
     uint8_t b=*s;
     if(U8_IS_SINGLE(b)) {
         // Initial all-ASCII span.
         if(spanCondition) {
             do {
-                if(!latin1Contains[b] || ++s==limit) {
+                if(!latin1Contains[b]) {
                     return s;
+                } else if(++s==stop) {
+                    break;
                 }
                 b=*s;
             } while(U8_IS_SINGLE(b));
         } else {
             do {
-                if(latin1Contains[b] || ++s==limit) {
+                if(latin1Contains[b]) {
                     return s;
+                } else if(++s==stop) {
+                    break;
                 }
                 b=*s;
             } while(U8_IS_SINGLE(b));
         }
+        if(U8_IS_SINGLE(b)) {
+            return s;  // limit or stop
+        }
         length=(int32_t)(limit-s);
     }
 
@@ -572,9 +817,13 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
         }
     }
 
+    if(stop>limit) {
+        stop=limit;  // before a truncated sequence at the end
+    }
+
     uint8_t t1, t2, t3;
 
-    while(s<limit) {
+    while(s<stop) {
         b=*s;
         if(U8_IS_SINGLE(b)) {
             // ASCII
@@ -582,8 +831,8 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
                 do {
                     if(!latin1Contains[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==stop) {
+                        break;
                     }
                     b=*s;
                 } while(U8_IS_SINGLE(b));
@@ -591,12 +840,15 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
                 do {
                     if(latin1Contains[b]) {
                         return s;
-                    } else if(++s==limit) {
-                        return limit0;
+                    } else if(++s==stop) {
+                        break;
                     }
                     b=*s;
                 } while(U8_IS_SINGLE(b));
             }
+            if(U8_IS_SINGLE(b)) {
+                break;  // limit or stop
+            }
         }
         ++s;  // Advance past the lead byte.
         if(b>=0xe0) {
@@ -661,10 +913,12 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
         }
     }
 
-    return limit0;
+    return s<limit ? s : limit0;
 }
 
 /*
+ * Like spanUTF8Scalar() but backward; returns stop or a smaller length
+ * if the span reaches stop.
  * While going backwards through UTF-8 optimize only for ASCII.
  * Unlike UTF-16, UTF-8 is not forward-backward symmetrical, that is, it is not
  * possible to tell from the last byte in a multi-byte sequence how many
@@ -672,7 +926,8 @@ BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanConditi
  * is much harder than going forward.
  */
 int32_t
-BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+BMPSet::spanBackUTF8Scalar(const uint8_t *s, int32_t stop, int32_t length,
+                           USetSpanCondition spanCondition) const {
     if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
         spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
     }
@@ -687,8 +942,8 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 do {
                     if(!latin1Contains[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==stop) {
+                        break;
                     }
                     b=s[--length];
                 } while(U8_IS_SINGLE(b));
@@ -696,12 +951,15 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 do {
                     if(latin1Contains[b]) {
                         return length+1;
-                    } else if(length==0) {
-                        return 0;
+                    } else if(length==stop) {
+                        break;
                     }
                     b=s[--length];
                 } while(U8_IS_SINGLE(b));
             }
+            if(U8_IS_SINGLE(b)) {
+                break;  // stop
+            }
         }
 
         int32_t prev=length;
@@ -734,8 +992,192 @@ BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCon
                 return prev+1;
             }
         }
-    } while(length>0);
-    return 0;
+    } while(length>stop);
+    return length;
+}
+
+#if BMPSET_SSSE3
+
+/*
+ * Continues span() after its first BMPSET_SIMD_SCALAR_PREFIX code units,
+ * testing 16 code units at a time.
+ * The block tests are exact for Latin-1 characters and for characters
+ * from 64-blocks that are entirely in or out of the set.
+ * Where a block stops at another character, spanScalar() checks the following
+ * code units before the next block test, and more of them while the
+ * block tests keep stopping early, so that text with few such characters
+ * is mostly spanned without the block tests.
+ */
+const UChar *
+BMPSet::spanSimd(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+    if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
+        spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
+    }
+    int32_t scalarLength=8;
+    for(;;) {
+        int32_t n;
+        for(;;) {
+            if((limit-s)<16) {
+                return s==limit ? s : spanScalar(s, limit, limit, spanCondition);
+            }
+            n=prefixLength(spanMaskUTF16(s, latin1Rows, block7FF, spanCondition));
+            if(n<16) {
+                break;
+            }
+            s+=16;
+            scalarLength=8;
+        }
+        s+=n;
+        UChar c=*s;
+        if(c<=0xff || (c<=0x7ff && block7FF[c>>6]!=2)) {
+            return s;
+        }
+        if(scalarLength<256) {
+            scalarLength<<=1;
+        }
+        if((limit-s)<=scalarLength) {
+            return spanScalar(s, limit, limit, spanCondition);
+        }
+        const UChar *stop=s+scalarLength;
+        s=spanScalar(s, stop, limit, spanCondition);
+        if(s<stop) {
+            return s;
+        }
+    }
+}
+
+/* Symmetrical with spanSimd(). */
+const UChar *
+BMPSet::spanBackSimd(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+    if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
+        spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
+    }
+    int32_t scalarLength=8;
+    for(;;) {
+        int32_t n;
+        for(;;) {
+            if((limit-s)<16) {
+                return s==limit ? s : spanBackScalar(s, s, limit, spanCondition);
+            }
+            n=suffixLength(spanMaskUTF16(limit-16, latin1Rows, block7FF, spanCondition));
+            if(n<16) {
+                break;
+            }
+            limit-=16;
+            scalarLength=8;
+        }
+        limit-=n;
+        UChar c=limit[-1];
+        if(c<=0xff || (c<=0x7ff && block7FF[c>>6]!=2)) {
+            return limit;
+        }
+        if(scalarLength<256) {
+            scalarLength<<=1;
+        }
+        if((limit-s)<=scalarLength) {
+            return spanBackScalar(s, s, limit, spanCondition);
+        }
+        const UChar *stop=limit-scalarLength;
+        if(U16_IS_TRAIL(*stop) && U16_IS_LEAD(stop[-1])) {
+            --stop;
+        }
+        limit=spanBackScalar(s, stop, limit, spanCondition);
+        if(limit>stop) {
+            return limit;
+        }
+    }
 }
 
+/*
+ * Continues spanUTF8() like spanSimd().
+ * The blocks test ASCII characters and complete 2-byte sequences,
+ * so they end where the scalar code would also start a character.
+ */
+const uint8_t *
+BMPSet::spanUTF8Simd(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const {
+    if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
+        spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
+    }
+    int32_t scalarLength=8;
+    for(;;) {
+        int32_t n;
+        for(;;) {
+            if((limit-s)<16) {
+                return s==limit ? s : spanUTF8Scalar(s, limit, limit, spanCondition);
+            }
+            n=prefixLength(spanMaskUTF8(s, latin1Rows, block7FF, spanCondition));
+            if(n<16) {
+                break;
+            }
+            s+=16;
+            scalarLength=8;
+        }
+        s+=n;
+        uint8_t b=*s;
+        if(U8_IS_SINGLE(b)) {
+            return s;  // ASCII character that is not part of the span
+        }
+        if(n>0 && b>=0xc0 && b<0xe0 && block7FF[b&0x1f]==spanCondition) {
+            continue;  // The block ended between a lead byte and its trail byte.
+        }
+        if(scalarLength<256) {
+            scalarLength<<=1;
+        }
+        if((limit-s)<=scalarLength) {
+            return spanUTF8Scalar(s, limit, limit, spanCondition);
+        }
+        const uint8_t *stop=s+scalarLength;
+        s=spanUTF8Scalar(s, stop, limit, spanCondition);
+        if(s<stop) {
+            return s;
+        }
+    }
+}
+
+/* Symmetrical with spanUTF8Simd(). */
+int32_t
+BMPSet::spanBackUTF8Simd(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+    if(spanCondition!=USET_SPAN_NOT_CONTAINED) {
+        spanCondition=USET_SPAN_CONTAINED;  // Pin to 0/1 values.
+    }
+    int32_t scalarLength=8;
+    for(;;) {
+        int32_t n;
+        for(;;) {
+            if(length<16) {
+                return length==0 ? 0 : spanBackUTF8Scalar(s, 0, length, spanCondition);
+            }
+            n=suffixLength(spanMaskUTF8(s+length-16, latin1Rows, block7FF, spanCondition));
+            if(n<16) {
+                break;
+            }
+            length-=16;
+            scalarLength=8;
+        }
+        length-=n;
+        uint8_t b=s[length-1];
+        if(U8_IS_SINGLE(b)) {
+            return length;  // ASCII character that is not part of the span
+        }
+        if( n>0 && U8_IS_TRAIL(b) && length>=2 &&
+            (b=s[length-2])>=0xc0 && b<0xe0 && block7FF[b&0x1f]==spanCondition
+        ) {
+            continue;  // The block started between a lead byte and its trail byte.
+        }
+        if(scalarLength<256) {
+            scalarLength<<=1;
+        }
+        if(length<=scalarLength) {
+            return spanBackUTF8Scalar(s, 0, length, spanCondition);
+        }
+        int32_t stop=length-scalarLength;
+        length=spanBackUTF8Scalar(s, stop, length, spanCondition);
+        if(length>stop) {
+            return length;
+        }
+    }
+}
+
+#endif
+
 U_NAMESPACE_END
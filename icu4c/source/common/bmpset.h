@@ -20,7 +20,32 @@
 #define __BMPSET_H__
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
+#include "unicode/utf16.h"
+#include "usimd.h"
+
+/*
+ * BMPSET_SSSE3 is 1 where the span code can use SSSE3 intrinsics
+ * in functions compiled for SSSE3, without compiling the whole file for it.
+ * Whether the CPU supports SSSE3 is checked at runtime.
+ */
+#ifndef BMPSET_SSSE3
+#   define BMPSET_SSSE3 U_SIMD_X86_DISPATCH
+#endif
+
+/*
+ * The span functions try the SSSE3 block code only in strings of at least
+ * BMPSET_SIMD_MIN_LENGTH code units, and only after checking the first
+ * BMPSET_SIMD_SCALAR_PREFIX of them one at a time,
+ * so that spans of words and other short tokens do not pay for block tests.
+ */
+#ifndef BMPSET_SIMD_MIN_LENGTH
+#   define BMPSET_SIMD_MIN_LENGTH 40
+#endif
+#ifndef BMPSET_SIMD_SCALAR_PREFIX
+#   define BMPSET_SIMD_SCALAR_PREFIX 24
+#endif
 
 U_NAMESPACE_BEGIN
 
@@ -34,6 +59,16 @@ U_NAMESPACE_BEGIN
  *                    with mixed for illegal ranges.
  * Supplementary characters: Binary search over
  * the supplementary part of the parent set's inversion list.
+ *
+ * Sets with many ranges at or above U+0800 (for example emoji sets)
+ * also get a UCPTrie with 8-bit 0/1 values, which replaces the binary searches
+ * for mixed BMP blocks and for supplementary code points.
+ *
+ * On x86 CPUs with SSSE3 (checked at runtime), span() and spanUTF8() and
+ * their backward versions, after the first few code units of long strings,
+ * test blocks of 16 code units at a time for Latin-1 characters
+ * (with 128-bit bitmap lookups) and for characters U+0100..U+07FF (2-byte UTF-8)
+ * from 64-blocks that are entirely in or out of the set.
  */
 class BMPSet : public UMemory {
 public:
@@ -71,9 +106,16 @@ class BMPSet : public UMemory {
      */
     int32_t spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
 
+    /*
+     * @return The number of bytes of memory used by this object and its trie, if any.
+     */
+    int32_t getMemoryUsage() const;
+
 private:
     void initBits();
     void overrideIllegal();
+    void initSimdTables();
+    void initTrie();
 
     /**
      * Same as UnicodeSet::findCodePoint(UChar32 c) const except that the
@@ -96,6 +138,19 @@ class BMPSet : public UMemory {
 
     inline UBool containsSlow(UChar32 c, int32_t lo, int32_t hi) const;
 
+    const UChar *spanScalar(const UChar *s, const UChar *stop, const UChar *limit,
+                            USetSpanCondition spanCondition) const;
+    const UChar *spanBackScalar(const UChar *s, const UChar *stop, const UChar *limit,
+                                USetSpanCondition spanCondition) const;
+    const uint8_t *spanUTF8Scalar(const uint8_t *s, const uint8_t *stop, const uint8_t *limit,
+                                  USetSpanCondition spanCondition) const;
+    int32_t spanBackUTF8Scalar(const uint8_t *s, int32_t stop, int32_t length,
+                               USetSpanCondition spanCondition) const;
+    const UChar *spanSimd(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const;
+    const UChar *spanBackSimd(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const;
+    const uint8_t *spanUTF8Simd(const uint8_t *s, const uint8_t *limit, USetSpanCondition spanCondition) const;
+    int32_t spanBackUTF8Simd(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const;
+
     /*
      * One byte 0 or 1 per Latin-1 character.
      */
@@ -136,6 +191,26 @@ class BMPSet : public UMemory {
      */
     uint32_t bmpBlockBits[64];
 
+    /*
+     * Latin-1 bitmap for lookups with SSSE3 PSHUFB.
+     * For byte b, latin1Rows[(b>>7)*16+(b&0xf)] bit ((b>>4)&7) equals latin1Contains[b].
+     */
+    uint8_t latin1Rows[32];
+
+    /*
+     * One byte per 64 code points from U+0000..U+07FF, indexed by lead=c{10..6}:
+     * 1 if table7FF has bit lead set for all trail values,
+     * 0 if it has none of them set,
+     * 2 otherwise, and for lead values 0 and 1 (UTF-8 lead bytes C0 and C1).
+     */
+    uint8_t block7FF[32];
+
+    /*
+     * Minimum string length for which the span functions try the SSSE3 block code,
+     * or INT32_MAX if the CPU does not support it.
+     */
+    int32_t simdMinLength;
+
     /*
      * Inversion list indexes for restricted binary searches in
      * findCodePoint(), from
@@ -146,6 +221,12 @@ class BMPSet : public UMemory {
      */
     int32_t list4kStarts[18];
 
+    /*
+     * Fast-type trie with 8-bit values 0/1 for all code points from U+0800,
+     * or NULL if the set has few enough ranges there for quick binary searches.
+     */
+    UCPTrie *trie;
+
     /*
      * The inversion list of the parent set, for the slower contains() implementation
      * for mixed BMP blocks and for supplementary code points.
@@ -156,9 +237,64 @@ class BMPSet : public UMemory {
 };
 
 inline UBool BMPSet::containsSlow(UChar32 c, int32_t lo, int32_t hi) const {
+    if (trie != NULL) {
+        return (UBool)UCPTRIE_FAST_GET(trie, UCPTRIE_8, c);
+    }
     return (UBool)(findCodePoint(c, lo, hi) & 1);
 }
 
+inline const UChar *
+BMPSet::span(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+#if BMPSET_SSSE3
+    if((limit-s)>=simdMinLength) {
+        const UChar *stop=s+BMPSET_SIMD_SCALAR_PREFIX;
+        s=spanScalar(s, stop, limit, spanCondition);
+        return s<stop ? s : spanSimd(s, limit, spanCondition);
+    }
+#endif
+    return spanScalar(s, limit, limit, spanCondition);
+}
+
+inline const UChar *
+BMPSet::spanBack(const UChar *s, const UChar *limit, USetSpanCondition spanCondition) const {
+#if BMPSET_SSSE3
+    if((limit-s)>=simdMinLength) {
+        const UChar *stop=limit-BMPSET_SIMD_SCALAR_PREFIX;
+        if(U16_IS_TRAIL(*stop) && U16_IS_LEAD(stop[-1])) {
+            --stop;
+        }
+        limit=spanBackScalar(s, stop, limit, spanCondition);
+        return limit>stop ? limit : spanBackSimd(s, limit, spanCondition);
+    }
+#endif
+    return spanBackScalar(s, s, limit, spanCondition);
+}
+
+inline const uint8_t *
+BMPSet::spanUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+#if BMPSET_SSSE3
+    if(length>=simdMinLength) {
+        const uint8_t *stop=s+BMPSET_SIMD_SCALAR_PREFIX;
+        const uint8_t *limit=s+length;
+        s=spanUTF8Scalar(s, stop, limit, spanCondition);
+        return s<stop ? s : spanUTF8Simd(s, limit, spanCondition);
+    }
+#endif
+    return spanUTF8Scalar(s, s+length, s+length, spanCondition);
+}
+
+inline int32_t
+BMPSet::spanBackUTF8(const uint8_t *s, int32_t length, USetSpanCondition spanCondition) const {
+#if BMPSET_SSSE3
+    if(length>=simdMinLength) {
+        int32_t stop=length-BMPSET_SIMD_SCALAR_PREFIX;
+        length=spanBackUTF8Scalar(s, stop, length, spanCondition);
+        return length>stop ? length : spanBackUTF8Simd(s, length, spanCondition);
+    }
+#endif
+    return spanBackUTF8Scalar(s, 0, length, spanCondition);
+}
+
 U_NAMESPACE_END
 
 #endif
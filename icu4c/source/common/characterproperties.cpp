@@ -13,7 +13,11 @@
 #include "unicode/uniset.h"
 #include "unicode/uscript.h"
 #include "unicode/uset.h"
+#include "unicode/ustring.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "mutex.h"
 #include "normalizer2impl.h"
 #include "uassert.h"
@@ -345,6 +349,95 @@ UCPMap *makeMap(UProperty property, UErrorCode &errorCode) {
         umutablecptrie_buildImmutable(mutableTrie.getAlias(), type, valueWidth, &errorCode));
 }
 
+// Batch lookups in the property maps.
+// The value width and trie type are dispatched once per call;
+// the loops below only compute trie indexes and read the data array,
+// with the same results as ucpmap_get().
+
+template<typename T>
+inline int32_t getMapValue(const UCPTrie *trie, const T *data, UChar32 fastMax, UChar32 c) {
+    return (int32_t)data[_UCPTRIE_CP_INDEX(trie, fastMax, c)];
+}
+
+template<typename T>
+int32_t getValues(const UCPTrie *trie, const T *data, UChar32 fastMax,
+                  const UChar32 *codePoints, int32_t count,
+                  int32_t *values, int32_t /*capacity==count*/) {
+    for (int32_t i = 0; i < count; ++i) {
+        values[i] = getMapValue(trie, data, fastMax, codePoints[i]);
+    }
+    return count;
+}
+
+template<typename T>
+int32_t getValues(const UCPTrie *trie, const T *data, UChar32 fastMax,
+                  const UChar *s, int32_t length,
+                  int32_t *values, int32_t capacity) {
+    int32_t i = 0;
+    int32_t n = 0;
+    while (i < length && n < capacity) {
+        UChar32 c = s[i++];
+        if (U16_IS_LEAD(c) && i < length && U16_IS_TRAIL(s[i])) {
+            c = U16_GET_SUPPLEMENTARY(c, s[i++]);
+        }
+        values[n++] = getMapValue(trie, data, fastMax, c);
+    }
+    // Preflighting: Count the remaining code points.
+    while (i < length) {
+        U16_FWD_1(s, i, length);
+        ++n;
+    }
+    return n;
+}
+
+template<typename T>
+int32_t getValues(const UCPTrie *trie, const T *data, UChar32 fastMax,
+                  const uint8_t *s, int32_t length,
+                  int32_t *values, int32_t capacity) {
+    int32_t i = 0;
+    int32_t n = 0;
+    while (i < length && n < capacity) {
+        UChar32 c = s[i];
+        if (U8_IS_SINGLE(c)) {
+            ++i;
+        } else {
+            U8_NEXT_OR_FFFD(s, i, length, c);
+        }
+        values[n++] = getMapValue(trie, data, fastMax, c);
+    }
+    // Preflighting: Count the remaining code points.
+    while (i < length) {
+        U8_FWD_1(s, i, length);
+        ++n;
+    }
+    return n;
+}
+
+template<typename Unit>
+int32_t getIntPropertyValues(UProperty property, const Unit *s, int32_t length,
+                             int32_t *values, int32_t capacity, UErrorCode &errorCode) {
+    const UCPTrie *trie =
+        reinterpret_cast<const UCPTrie *>(u_getIntPropertyMap(property, &errorCode));
+    if (U_FAILURE(errorCode)) { return 0; }
+    UChar32 fastMax = trie->type == UCPTRIE_TYPE_FAST ? 0xffff : UCPTRIE_SMALL_MAX;
+    int32_t count;
+    switch (trie->valueWidth) {
+    case UCPTRIE_VALUE_BITS_8:
+        count = getValues(trie, trie->data.ptr8, fastMax, s, length, values, capacity);
+        break;
+    case UCPTRIE_VALUE_BITS_16:
+        count = getValues(trie, trie->data.ptr16, fastMax, s, length, values, capacity);
+        break;
+    default:
+        count = getValues(trie, trie->data.ptr32, fastMax, s, length, values, capacity);
+        break;
+    }
+    if (count > capacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
 }  // namespace
 
 U_NAMESPACE_USE
@@ -379,3 +472,50 @@ u_getIntPropertyMap(UProperty property, UErrorCode *pErrorCode) {
     }
     return map;
 }
+
+U_CAPI void U_EXPORT2
+u_getIntPropertyValues(UProperty property,
+                       const UChar32 *codePoints, int32_t count,
+                       int32_t *values, UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) { return; }
+    if (count < 0 || (count > 0 && (codePoints == nullptr || values == nullptr))) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    getIntPropertyValues(property, codePoints, count, values, count, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+u_strGetIntPropertyValues(UProperty property,
+                          const UChar *s, int32_t length,
+                          int32_t *values, int32_t capacity,
+                          UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    if ((s == nullptr && length != 0) || length < -1 ||
+            capacity < 0 || (values == nullptr && capacity > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length < 0) {
+        length = u_strlen(s);
+    }
+    return getIntPropertyValues(property, s, length, values, capacity, *pErrorCode);
+}
+
+U_CAPI int32_t U_EXPORT2
+u_strGetIntPropertyValuesUTF8(UProperty property,
+                              const char *s, int32_t length,
+                              int32_t *values, int32_t capacity,
+                              UErrorCode *pErrorCode) {
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    if ((s == nullptr && length != 0) || length < -1 ||
+            capacity < 0 || (values == nullptr && capacity > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length < 0) {
+        length = static_cast<int32_t>(uprv_strlen(s));
+    }
+    return getIntPropertyValues(property, reinterpret_cast<const uint8_t *>(s), length,
+                                values, capacity, *pErrorCode);
+}
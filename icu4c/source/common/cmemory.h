@@ -389,6 +389,18 @@ class MaybeStackArray {
      *         caller becomes responsible for deleting the array
      */
     inline T *orphanOrClone(int32_t length, int32_t &resultCapacity);
+    /**
+     * Deletes the array (if owned) and resets itself to the internal stack array.
+     * The array contents are not preserved.
+     */
+    void releaseToStackArray() {
+        releaseArray();
+        resetToStackArray();
+    }
+    /**
+     * @return TRUE if the array is the internal stack array
+     */
+    UBool isStackArray() const { return ptr==stackArray; }
 private:
     T *ptr;
     int32_t capacity;
@@ -14,10 +14,12 @@
 
 #include "unicode/filteredbrk.h"
 #include "unicode/ucharstriebuilder.h"
+#include "unicode/uniset.h"
 #include "unicode/ures.h"
 
 #include "uresimp.h" // ures_getByKeyWithFallback
 #include "ubrkimpl.h" // U_ICUDATA_BRKITR
+#include "unifiedcache.h"
 #include "uvector.h"
 #include "cmemory.h"
 
@@ -133,19 +135,23 @@ static const int32_t kAddToForward = (1<<1);
 static const UChar   kFULLSTOP = 0x002E; // '.'
 
 /**
- * Shared data for SimpleFilteredSentenceBreakIterator
+ * Shared data for SimpleFilteredSentenceBreakIterator.
+ * Immutable once built. Instances built from unmodified locale data
+ * are shared between iterators through the UnifiedCache.
  */
-class SimpleFilteredSentenceBreakData : public UMemory {
+class SimpleFilteredSentenceBreakData : public SharedObject {
 public:
-  SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards ) 
-      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), refcount(1) { }
-  SimpleFilteredSentenceBreakData *incr() { refcount++;  return this; }
-  SimpleFilteredSentenceBreakData *decr() { if((--refcount) <= 0) delete this; return 0; }
+  SimpleFilteredSentenceBreakData(UCharsTrie *forwards, UCharsTrie *backwards, const UnicodeSet &lastChars)
+      : fForwardsPartialTrie(forwards), fBackwardsTrie(backwards), fLastChars(lastChars) {
+    fLastChars.freeze();
+  }
   virtual ~SimpleFilteredSentenceBreakData();
 
+  // The tries are read through local copies, which carry the iteration state;
+  // the tries held here are never advanced, and may be shared between threads.
   LocalPointer<UCharsTrie>    fForwardsPartialTrie; //  Has ".a" for "a.M."
   LocalPointer<UCharsTrie>    fBackwardsTrie; //  i.e. ".srM" for Mrs.
-  int32_t                     refcount;
+  UnicodeSet                  fLastChars; // The final code points of all suppressions, i.e. "." for Mrs.
 };
 
 SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
@@ -155,11 +161,11 @@ SimpleFilteredSentenceBreakData::~SimpleFilteredSentenceBreakData() {}
  */
 class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 public:
-  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status);
+  SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const SimpleFilteredSentenceBreakData *data, UErrorCode &status);
   SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other);
   virtual ~SimpleFilteredSentenceBreakIterator();
 private:
-  SimpleFilteredSentenceBreakData *fData;
+  const SimpleFilteredSentenceBreakData *fData;
   LocalPointer<BreakIterator> fDelegate;
   LocalUTextPointer           fText;
 
@@ -234,21 +240,22 @@ class SimpleFilteredSentenceBreakIterator : public BreakIterator {
 };
 
 SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(const SimpleFilteredSentenceBreakIterator& other)
-  : BreakIterator(other), fData(other.fData->incr()), fDelegate(other.fDelegate->clone())
+  : BreakIterator(other), fData(other.fData), fDelegate(other.fDelegate->clone())
 {
+  fData->addRef();
 }
 
 
-SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, UCharsTrie *forwards, UCharsTrie *backwards, UErrorCode &status) :
+SimpleFilteredSentenceBreakIterator::SimpleFilteredSentenceBreakIterator(BreakIterator *adopt, const SimpleFilteredSentenceBreakData *data, UErrorCode &status) :
   BreakIterator(adopt->getLocale(ULOC_VALID_LOCALE,status),adopt->getLocale(ULOC_ACTUAL_LOCALE,status)),
-  fData(new SimpleFilteredSentenceBreakData(forwards, backwards)),
+  fData(data),
   fDelegate(adopt)
 {
-  // all set..
+  fData->addRef();
 }
 
 SimpleFilteredSentenceBreakIterator::~SimpleFilteredSentenceBreakIterator() {
-    fData = fData->decr();
+    SharedObject::clearPtr(fData);
 }
 
 void SimpleFilteredSentenceBreakIterator::resetState(UErrorCode &status) {
@@ -261,7 +268,6 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
     int32_t bestValue = -1;
     // loops while 'n' points to an exception.
     utext_setNativeIndex(fText.getAlias(), n); // from n..
-    fData->fBackwardsTrie->reset();
     UChar32 uch;
 
     //if(debug2) u_printf(" n@ %d\n", n);
@@ -275,20 +281,29 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
       //if(debug2) u_printf(" -> : |%C| \n", (UChar)uch);
     }
 
+    // Quick check: most candidate boundaries follow a character that can not end
+    // any suppression. Skip the trie walk for those.
+    uch = utext_previous32(fText.getAlias());
+    if(uch==U_SENTINEL || !fData->fLastChars.contains(uch)) {
+      return kNoExceptionHere;
+    }
+    utext_next32(fText.getAlias());
+
+    UCharsTrie backwardsTrie(*fData->fBackwardsTrie);
     UStringTrieResult r = USTRINGTRIE_INTERMEDIATE_VALUE;
 
     while((uch=utext_previous32(fText.getAlias()))!=U_SENTINEL  &&   // more to consume backwards and..
-          USTRINGTRIE_HAS_NEXT(r=fData->fBackwardsTrie->nextForCodePoint(uch))) {// more in the trie
+          USTRINGTRIE_HAS_NEXT(r=backwardsTrie.nextForCodePoint(uch))) {// more in the trie
       if(USTRINGTRIE_HAS_VALUE(r)) { // remember the best match so far
         bestPosn = utext_getNativeIndex(fText.getAlias());
-        bestValue = fData->fBackwardsTrie->getValue();
+        bestValue = backwardsTrie.getValue();
       }
       //if(debug2) u_printf("rev< /%C/ cont?%d @%d\n", (UChar)uch, r, utext_getNativeIndex(fText.getAlias()));
     }
 
     if(USTRINGTRIE_MATCHES(r)) { // exact match?
       //if(debug2) u_printf("rev<?/%C/?end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
-      bestValue = fData->fBackwardsTrie->getValue();
+      bestValue = backwardsTrie.getValue();
       bestPosn = utext_getNativeIndex(fText.getAlias());
       //if(debug2) u_printf("rev<+/%C/+end of seq.. r=%d, bestPosn=%d, bestValue=%d\n", (UChar)uch, r, bestPosn, bestValue);
     }
@@ -308,12 +323,12 @@ SimpleFilteredSentenceBreakIterator::breakExceptionAt(int32_t n) {
         //if(debug2) u_printf(" partial backward match\n");
         // We matched the "Ph." in "Ph.D." - now we need to run everything through the forwards trie
         // to see if it matches something going forward.
-        fData->fForwardsPartialTrie->reset();
+        UCharsTrie forwardsPartialTrie(*fData->fForwardsPartialTrie);
         UStringTrieResult rfwd = USTRINGTRIE_INTERMEDIATE_VALUE;
         utext_setNativeIndex(fText.getAlias(), bestPosn); // hope that's close ..
         //if(debug2) u_printf("Retrying at %d\n", bestPosn);
         while((uch=utext_next32(fText.getAlias()))!=U_SENTINEL &&
-              USTRINGTRIE_HAS_NEXT(rfwd=fData->fForwardsPartialTrie->nextForCodePoint(uch))) {
+              USTRINGTRIE_HAS_NEXT(rfwd=forwardsPartialTrie.nextForCodePoint(uch))) {
           //if(debug2) u_printf("fwd> /%C/ cont?%d @%d\n", (UChar)uch, rfwd, utext_getNativeIndex(fText.getAlias()));
         }
         if(USTRINGTRIE_MATCHES(rfwd)) {
@@ -464,21 +479,43 @@ class U_COMMON_API SimpleFilteredBreakIteratorBuilder : public FilteredBreakIter
   virtual UBool suppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
   virtual UBool unsuppressBreakAfter(const UnicodeString& exception, UErrorCode& status);
   virtual BreakIterator *build(BreakIterator* adoptBreakIterator, UErrorCode& status);
+  /**
+   * Build the tries for the current set of suppressions.
+   * @return the new data, with a reference count of one, or NULL on failure.
+   */
+  SimpleFilteredSentenceBreakData *buildData(UErrorCode& status) const;
 private:
   UStringSet fSet;
+  /** The locale whose data was loaded, if the set has not been modified since. */
+  Locale fLocale;
+  UBool fIsLocaleData;
 };
 
+/**
+ * Cache of the shared suppression data built from each locale's exceptions,
+ * so that building the tries is done once per locale rather than once per iterator.
+ */
+template<> U_COMMON_API
+const SimpleFilteredSentenceBreakData *LocaleCacheKey<SimpleFilteredSentenceBreakData>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+  SimpleFilteredBreakIteratorBuilder builder(fLoc, status);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+  return builder.buildData(status);
+}
+
 SimpleFilteredBreakIteratorBuilder::~SimpleFilteredBreakIteratorBuilder()
 {
 }
 
 SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(UErrorCode &status) 
-  : fSet(status)
+  : fSet(status), fLocale(Locale::getRoot()), fIsLocaleData(FALSE)
 {
 }
 
 SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Locale &fromLocale, UErrorCode &status)
-  : fSet(status)
+  : fSet(status), fLocale(fromLocale), fIsLocaleData(FALSE)
 {
   if(U_SUCCESS(status)) {
     UErrorCode subStatus = U_ZERO_ERROR;
@@ -527,6 +564,7 @@ SimpleFilteredBreakIteratorBuilder::SimpleFilteredBreakIteratorBuilder(const Loc
     if(U_FAILURE(subStatus)&&subStatus!=U_INDEX_OUTOFBOUNDS_ERROR&&U_SUCCESS(status)) {
       status = subStatus;
     }
+    fIsLocaleData = U_SUCCESS(status);
   }
 }
 
@@ -535,6 +573,9 @@ SimpleFilteredBreakIteratorBuilder::suppressBreakAfter(const UnicodeString& exce
 {
   UBool r = fSet.add(exception, status);
   FB_TRACE("suppressBreakAfter",&exception,r,0);
+  if(r) {
+    fIsLocaleData = FALSE;
+  }
   return r;
 }
 
@@ -543,6 +584,9 @@ SimpleFilteredBreakIteratorBuilder::unsuppressBreakAfter(const UnicodeString& ex
 {
   UBool r = fSet.remove(exception, status);
   FB_TRACE("unsuppressBreakAfter",&exception,r,0);
+  if(r) {
+    fIsLocaleData = FALSE;
+  }
   return r;
 }
 
@@ -560,7 +604,37 @@ static inline UnicodeString* newUnicodeStringArray(size_t count) {
 BreakIterator *
 SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UErrorCode& status) {
   LocalPointer<BreakIterator> adopt(adoptBreakIterator);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+
+  const SimpleFilteredSentenceBreakData *data = NULL;
+  if(fIsLocaleData) {
+    // Unmodified locale data: share the tries built for the locale.
+    UnifiedCache::getByLocale(fLocale, data, status);
+  } else {
+    data = buildData(status);
+  }
+  if(U_FAILURE(status)) {
+    SharedObject::clearPtr(data);
+    return NULL;
+  }
+  BreakIterator *result = new SimpleFilteredSentenceBreakIterator(adopt.getAlias(), data, status);
+  SharedObject::clearPtr(data);  // The iterator holds its own reference.
+  if(result == NULL) {
+    status = U_MEMORY_ALLOCATION_ERROR;
+    return NULL;
+  }
+  adopt.orphan();
+  if(U_FAILURE(status)) {
+    delete result;
+    return NULL;
+  }
+  return result;
+}
 
+SimpleFilteredSentenceBreakData *
+SimpleFilteredBreakIteratorBuilder::buildData(UErrorCode& status) const {
   LocalPointer<UCharsTrieBuilder> builder(new UCharsTrieBuilder(status), status);
   LocalPointer<UCharsTrieBuilder> builder2(new UCharsTrieBuilder(status), status);
   if(U_FAILURE(status)) {
@@ -581,6 +655,7 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
 
   LocalPointer<UCharsTrie>    backwardsTrie; //  i.e. ".srM" for Mrs.
   LocalPointer<UCharsTrie>    forwardsPartialTrie; //  Has ".a" for "a.M."
+  UnicodeSet                  lastChars; // first code points of the reversed strings
 
   int n=0;
   for ( int32_t i = 0;
@@ -627,6 +702,7 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
         // first one - add the prefix to the reverse table.
         prefix.reverse();
         builder->add(prefix, kPARTIAL, status);
+        lastChars.add(prefix.char32At(0));
         revCount++;
         FB_TRACE("Added partial",&prefix,FALSE, i);
         FB_TRACE(u_errorName(status),&ustrs[i],FALSE,i);
@@ -641,6 +717,7 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
     if(partials[i]==0) {
       ustrs[i].reverse();
       builder->add(ustrs[i], kMATCH, status);
+      lastChars.add(ustrs[i].char32At(0));
       revCount++;
       FB_TRACE(u_errorName(status), &ustrs[i], FALSE, i);
     } else {
@@ -674,7 +751,15 @@ SimpleFilteredBreakIteratorBuilder::build(BreakIterator* adoptBreakIterator, UEr
     }
   }
 
-  return new SimpleFilteredSentenceBreakIterator(adopt.orphan(), forwardsPartialTrie.orphan(), backwardsTrie.orphan(), status);
+  LocalPointer<SimpleFilteredSentenceBreakData> data(
+      new SimpleFilteredSentenceBreakData(forwardsPartialTrie.getAlias(), backwardsTrie.getAlias(), lastChars), status);
+  if(U_FAILURE(status)) {
+    return NULL;
+  }
+  forwardsPartialTrie.orphan();
+  backwardsTrie.orphan();
+  data->addRef();
+  return data.orphan();
 }
 
 
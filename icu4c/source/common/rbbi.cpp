@@ -264,8 +264,13 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
     //       Current position could be within a dictionary range. Trying to continue
     //       the iteration without the caches present would go to the rules, with
     //       the assumption that the current position is on a rule boundary.
+    if (fBreakCache->getCapacity() != that.fBreakCache->getCapacity()) {
+        fBreakCache->setCapacity(that.fBreakCache->getCapacity(), status);
+    }
     fBreakCache->reset(fPosition, fRuleStatusIndex);
-    fDictionaryCache->reset();
+    if (fDictionaryCache != NULL) {
+        fDictionaryCache->reset();
+    }
 
     return *this;
 }
@@ -300,9 +305,9 @@ void RuleBasedBreakIterator::init(UErrorCode &status) {
     }
 
     utext_openUChars(&fText, NULL, 0, &status);
-    fDictionaryCache = new DictionaryCache(this, status);
+    // The dictionary cache is created on first use, by getDictionaryCache().
     fBreakCache      = new BreakCache(this, status);
-    if (U_SUCCESS(status) && (fDictionaryCache == NULL || fBreakCache == NULL)) {
+    if (U_SUCCESS(status) && fBreakCache == NULL) {
         status = U_MEMORY_ALLOCATION_ERROR;
     }
 
@@ -391,7 +396,9 @@ void RuleBasedBreakIterator::setText(UText *ut, UErrorCode &status) {
         return;
     }
     fBreakCache->reset();
-    fDictionaryCache->reset();
+    if (fDictionaryCache != NULL) {
+        fDictionaryCache->reset();
+    }
     utext_clone(&fText, ut, FALSE, TRUE, &status);
 
     // Set up a dummy CharacterIterator to be returned if anyone
@@ -446,7 +453,9 @@ RuleBasedBreakIterator::adoptText(CharacterIterator* newText) {
     fCharIter = newText;
     UErrorCode status = U_ZERO_ERROR;
     fBreakCache->reset();
-    fDictionaryCache->reset();
+    if (fDictionaryCache != NULL) {
+        fDictionaryCache->reset();
+    }
     if (newText==NULL || newText->startIndex() != 0) {
         // startIndex !=0 wants to be an error, but there's no way to report it.
         // Make the iterator text be an empty string.
@@ -466,7 +475,9 @@ void
 RuleBasedBreakIterator::setText(const UnicodeString& newText) {
     UErrorCode status = U_ZERO_ERROR;
     fBreakCache->reset();
-    fDictionaryCache->reset();
+    if (fDictionaryCache != NULL) {
+        fDictionaryCache->reset();
+    }
     utext_openConstUnicodeString(&fText, &newText, &status);
 
     // Set up a character iterator on the string.
@@ -1083,6 +1094,61 @@ const uint8_t  *RuleBasedBreakIterator::getBinaryRules(uint32_t &length) {
 }
 
 
+//-------------------------------------------------------------------------------
+//
+//   setCacheCapacity, getCacheCapacity, getMemoryUsage
+//
+//-------------------------------------------------------------------------------
+void RuleBasedBreakIterator::setCacheCapacity(int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (capacity < 0) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    int32_t cacheSize = BreakCache::MIN_CACHE_SIZE;
+    while (cacheSize < capacity && cacheSize < BreakCache::MAX_CACHE_SIZE) {
+        cacheSize <<= 1;
+    }
+    fBreakCache->setCapacity(cacheSize, status);
+}
+
+
+int32_t RuleBasedBreakIterator::getCacheCapacity() const {
+    return fBreakCache->getCapacity();
+}
+
+
+int32_t RuleBasedBreakIterator::getMemoryUsage() const {
+    int32_t size = (int32_t)sizeof(*this);
+    size += fBreakCache->getMemoryUsage();
+    if (fDictionaryCache != NULL) {
+        size += (int32_t)sizeof(DictionaryCache) + fDictionaryCache->fBreaks.size() * (int32_t)sizeof(int32_t);
+    }
+    if (fLanguageBreakEngines != NULL) {
+        size += (int32_t)sizeof(UStack) + fLanguageBreakEngines->size() * (int32_t)sizeof(void *);
+    }
+    if (fUnhandledBreakEngine != NULL) {
+        size += (int32_t)sizeof(UnhandledEngine);
+    }
+    return size;
+}
+
+
+RuleBasedBreakIterator::DictionaryCache *RuleBasedBreakIterator::getDictionaryCache() {
+    if (fDictionaryCache == NULL) {
+        UErrorCode status = U_ZERO_ERROR;
+        fDictionaryCache = new DictionaryCache(this, status);
+        if (fDictionaryCache != NULL && U_FAILURE(status)) {
+            delete fDictionaryCache;
+            fDictionaryCache = NULL;
+        }
+    }
+    return fDictionaryCache;
+}
+
+
 BreakIterator *  RuleBasedBreakIterator::createBufferClone(void * /*stackBuffer*/,
                                    int32_t &bufferSize,
                                    UErrorCode &status)
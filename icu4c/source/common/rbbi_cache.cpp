@@ -203,7 +203,9 @@ void RuleBasedBreakIterator::DictionaryCache::populateDictionary(int32_t startPo
  */
 
 RuleBasedBreakIterator::BreakCache::BreakCache(RuleBasedBreakIterator *bi, UErrorCode &status) :
-        fBI(bi), fSideBuffer(status) {
+        fBI(bi), fBoundaries(DEFAULT_CACHE_SIZE), fStatuses(DEFAULT_CACHE_SIZE), fSideBuffer(status) {
+    // If either allocation failed, fall back to the smaller size. Both sizes are powers of two.
+    fCapacity = uprv_min(fBoundaries.getCapacity(), fStatuses.getCapacity());
     reset();
 }
 
@@ -212,6 +214,40 @@ RuleBasedBreakIterator::BreakCache::~BreakCache() {
 }
 
 
+void RuleBasedBreakIterator::BreakCache::setCapacity(int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    U_ASSERT(capacity >= MIN_CACHE_SIZE && (capacity & (capacity-1)) == 0);
+    int32_t ruleStatus = fStatuses[fBufIdx];
+    if (capacity <= MIN_CACHE_SIZE) {
+        // Free any heap arrays and use the internal buffers.
+        fBoundaries.releaseToStackArray();
+        fStatuses.releaseToStackArray();
+    } else if (capacity != fBoundaries.getCapacity() || capacity != fStatuses.getCapacity()) {
+        if (fBoundaries.resize(capacity) == NULL || fStatuses.resize(capacity) == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+    fCapacity = uprv_min(fBoundaries.getCapacity(), fStatuses.getCapacity());
+    reset(fTextIdx, ruleStatus);
+}
+
+
+int32_t RuleBasedBreakIterator::BreakCache::getMemoryUsage() const {
+    int32_t size = (int32_t)sizeof(*this);
+    // Arrays other than the internal buffers are heap allocated.
+    if (!fBoundaries.isStackArray()) {
+        size += fBoundaries.getCapacity() * (int32_t)sizeof(int32_t);
+    }
+    if (!fStatuses.isStackArray()) {
+        size += fStatuses.getCapacity() * (int32_t)sizeof(uint16_t);
+    }
+    size += fSideBuffer.size() * (int32_t)sizeof(int32_t);
+    return size;
+}
+
+
 void RuleBasedBreakIterator::BreakCache::reset(int32_t pos, int32_t ruleStatus) {
     fStartBufIdx = 0;
     fEndBufIdx = 0;
@@ -317,7 +353,7 @@ UBool RuleBasedBreakIterator::BreakCache::seek(int32_t pos) {
     int32_t min = fStartBufIdx;
     int32_t max = fEndBufIdx;
     while (min != max) {
-        int32_t probe = (min + max + (min>max ? CACHE_SIZE : 0)) / 2;
+        int32_t probe = (min + max + (min>max ? fCapacity : 0)) / 2;
         probe = modChunkSize(probe);
         if (fBoundaries[probe] > pos) {
             max = probe;
@@ -426,7 +462,8 @@ UBool RuleBasedBreakIterator::BreakCache::populateFollowing() {
     int32_t pos = 0;
     int32_t ruleStatusIdx = 0;
 
-    if (fBI->fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
+    if (fBI->fDictionaryCache != NULL &&
+            fBI->fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
         addFollowing(pos, ruleStatusIdx, UpdateCachePosition);
         return TRUE;
     }
@@ -438,11 +475,12 @@ UBool RuleBasedBreakIterator::BreakCache::populateFollowing() {
     }
 
     ruleStatusIdx = fBI->fRuleStatusIndex;
-    if (fBI->fDictionaryCharCount > 0) {
+    DictionaryCache *dictionaryCache;
+    if (fBI->fDictionaryCharCount > 0 && (dictionaryCache = fBI->getDictionaryCache()) != NULL) {
         // The text segment obtained from the rules includes dictionary characters.
         // Subdivide it, with subdivided results going into the dictionary cache.
-        fBI->fDictionaryCache->populateDictionary(fromPosition, pos, fromRuleStatusIdx, ruleStatusIdx);
-        if (fBI->fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
+        dictionaryCache->populateDictionary(fromPosition, pos, fromRuleStatusIdx, ruleStatusIdx);
+        if (dictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
             addFollowing(pos, ruleStatusIdx, UpdateCachePosition);
             return TRUE;
             // TODO: may want to move a sizable chunk of dictionary cache to break cache at this point.
@@ -459,7 +497,7 @@ UBool RuleBasedBreakIterator::BreakCache::populateFollowing() {
     // Add several non-dictionary boundaries at this point, to optimize straight forward iteration.
     //    (subsequent calls to BreakIterator::next() will take the fast path, getting cached results.
     //
-    for (int count=0; count<6; ++count) {
+    for (int count=0; count<lookAheadCount(); ++count) {
         pos = fBI->handleNext();
         if (pos == UBRK_DONE || fBI->fDictionaryCharCount > 0) {
             break;
@@ -484,7 +522,8 @@ UBool RuleBasedBreakIterator::BreakCache::populatePreceding(UErrorCode &status)
     int32_t position = 0;
     int32_t positionStatusIdx = 0;
 
-    if (fBI->fDictionaryCache->preceding(fromPosition, &position, &positionStatusIdx)) {
+    if (fBI->fDictionaryCache != NULL &&
+            fBI->fDictionaryCache->preceding(fromPosition, &position, &positionStatusIdx)) {
         addPreceding(position, positionStatusIdx, UpdateCachePosition);
         return TRUE;
     }
@@ -541,12 +580,13 @@ UBool RuleBasedBreakIterator::BreakCache::populatePreceding(UErrorCode &status)
         }
 
         UBool segmentHandledByDictionary = FALSE;
-        if (fBI->fDictionaryCharCount != 0) {
+        DictionaryCache *dictionaryCache;
+        if (fBI->fDictionaryCharCount != 0 && (dictionaryCache = fBI->getDictionaryCache()) != NULL) {
             // Segment from the rules includes dictionary characters.
             // Subdivide it, with subdivided results going into the dictionary cache.
             int32_t dictSegEndPosition = position;
-            fBI->fDictionaryCache->populateDictionary(prevPosition, dictSegEndPosition, prevStatusIdx, positionStatusIdx);
-            while (fBI->fDictionaryCache->following(prevPosition, &position, &positionStatusIdx)) {
+            dictionaryCache->populateDictionary(prevPosition, dictSegEndPosition, prevStatusIdx, positionStatusIdx);
+            while (dictionaryCache->following(prevPosition, &position, &positionStatusIdx)) {
                 segmentHandledByDictionary = true;
                 U_ASSERT(position > prevPosition);
                 if (position >= fromPosition) {
@@ -595,7 +635,7 @@ void RuleBasedBreakIterator::BreakCache::addFollowing(int32_t position, int32_t
     U_ASSERT(ruleStatusIdx <= UINT16_MAX);
     int32_t nextIdx = modChunkSize(fEndBufIdx + 1);
     if (nextIdx == fStartBufIdx) {
-        fStartBufIdx = modChunkSize(fStartBufIdx + 6);    // TODO: experiment. Probably revert to 1.
+        fStartBufIdx = modChunkSize(fStartBufIdx + dropCount());    // TODO: experiment. Probably revert to 1.
     }
     fBoundaries[nextIdx] = position;
     fStatuses[nextIdx] = static_cast<uint16_t>(ruleStatusIdx);
@@ -13,6 +13,7 @@
 #include "unicode/rbbi.h"
 #include "unicode/uobject.h"
 
+#include "cmemory.h"
 #include "uvectr32.h"
 
 U_NAMESPACE_BEGIN
@@ -79,10 +80,6 @@ class RuleBasedBreakIterator::DictionaryCache: public UMemory {
  * The cache is implemented as a single circular buffer.
  */
 
-/*
- * size of the circular cache buffer.
- */
-
 class RuleBasedBreakIterator::BreakCache: public UMemory {
   public:
                 BreakCache(RuleBasedBreakIterator *bi, UErrorCode &status);
@@ -177,11 +174,48 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
 
     void dumpCache();
 
+    /*
+     * Change the number of boundaries that the cache can hold.
+     * The cache contents are discarded, other than the current position.
+     * The capacity must be a power of two, and at least MIN_CACHE_SIZE.
+     * If the memory can not be allocated, the capacity is left unchanged.
+     */
+    void setCapacity(int32_t capacity, UErrorCode &status);
+
+    int32_t getCapacity() const { return fCapacity; };
+
+    /*
+     * The number of bytes of memory used by this cache.
+     */
+    int32_t getMemoryUsage() const;
+
+    /*
+     * Default size of the circular cache buffer.
+     */
+    static constexpr int32_t DEFAULT_CACHE_SIZE = 128;
+
+    /*
+     * Smallest size of the circular cache buffer. A cache of this size is held
+     * within the BreakCache object itself, without a separate heap allocation.
+     */
+    static constexpr int32_t MIN_CACHE_SIZE = 8;
+
+    static constexpr int32_t MAX_CACHE_SIZE = 4096;
+
+    static_assert((DEFAULT_CACHE_SIZE & (DEFAULT_CACHE_SIZE-1)) == 0, "DEFAULT_CACHE_SIZE must be power of two.");
+    static_assert((MIN_CACHE_SIZE & (MIN_CACHE_SIZE-1)) == 0, "MIN_CACHE_SIZE must be power of two.");
+
   private:
-    static inline int32_t   modChunkSize(int index) { return index & (CACHE_SIZE - 1); };
+    inline int32_t   modChunkSize(int index) const { return index & (fCapacity - 1); };
 
-    static constexpr int32_t CACHE_SIZE = 128;
-    static_assert((CACHE_SIZE & (CACHE_SIZE-1)) == 0, "CACHE_SIZE must be power of two.");
+    /*
+     * The number of boundaries to drop from the start of a full cache when adding
+     * a following boundary, and the number of extra boundaries to look ahead for
+     * in populateFollowing(). Both are scaled down for small caches, so that the
+     * current position is never dropped.
+     */
+    int32_t dropCount() const { return fCapacity >= 32 ? 6 : fCapacity / 4; };
+    int32_t lookAheadCount() const { return fCapacity >= 16 ? 6 : fCapacity / 2 - 1; };
 
     RuleBasedBreakIterator *fBI;
     int32_t                 fStartBufIdx;
@@ -190,8 +224,9 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
     int32_t                 fTextIdx;
     int32_t                 fBufIdx;
 
-    int32_t                 fBoundaries[CACHE_SIZE];
-    uint16_t                fStatuses[CACHE_SIZE];
+    int32_t                 fCapacity;     // power of two; not more than the capacity of either array
+    MaybeStackArray<int32_t, MIN_CACHE_SIZE>    fBoundaries;
+    MaybeStackArray<uint16_t, MIN_CACHE_SIZE>   fStatuses;
 
     UVector32               fSideBuffer;
 };
@@ -0,0 +1,224 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// file: rbbi_stream.cpp
+//
+//    Implementation of class StreamingBreakIterator, boundary analysis over text
+//    that is appended incrementally.
+//
+//    A boundary found by the forward rules is final if the state machine, while
+//    locating it, stopped before reaching the end of the text appended so far.
+//    The state machine is deterministic and does not look backwards, so appending
+//    more text can not change the path it took, and thus can not change the result.
+//    A boundary that was located only by running into the end of the available text
+//    is held back; it is recomputed from the preceding final boundary when more text
+//    arrives.
+//
+//    Forward iteration from a boundary does not depend on the text preceding the
+//    boundary, which lets us discard everything before the last final boundary.
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/rbbi.h"
+#include "unicode/ubrk.h"
+#include "unicode/utext.h"
+
+#include "rbbi_cache.h"
+#include "rbbidata.h"
+#include "uvectr32.h"
+
+U_NAMESPACE_BEGIN
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(StreamingBreakIterator)
+
+StreamingBreakIterator::StreamingBreakIterator(const RuleBasedBreakIterator &rules, UErrorCode &status) :
+        fBI(NULL), fText(), fTextBase(0), fScanStart(0), fScanStatusIndex(0),
+        fPending(NULL), fPendingIdx(0), fCurrent(0), fCurrentStatusIndex(0), fFinished(FALSE) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (rules.fData == NULL) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    fBI = new RuleBasedBreakIterator(rules);
+    fPending = new UVector32(status);
+    if (U_SUCCESS(status) && (fBI == NULL || fPending == NULL)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    textChanged();
+}
+
+StreamingBreakIterator::~StreamingBreakIterator() {
+    delete fBI;
+    delete fPending;
+}
+
+void StreamingBreakIterator::append(const UnicodeString &text, UErrorCode &status) {
+    append(text.getBuffer(), text.length(), status);
+}
+
+void StreamingBreakIterator::append(const UChar *text, int32_t length, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (fBI == NULL) {
+        status = U_INVALID_STATE_ERROR;
+        return;
+    }
+    if ((text == NULL && length != 0) || length < -1) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (fFinished) {
+        status = U_INVALID_STATE_ERROR;
+        return;
+    }
+    if (length == -1) {
+        length = u_strlen(text);
+    }
+    if (length == 0) {
+        return;
+    }
+
+    // Drop the text that final boundaries have already passed over. Forward iteration
+    // resumes from fScanStart, and never looks at the text before it.
+    if (fScanStart > 0) {
+        fText.remove(0, fScanStart);
+        fTextBase += fScanStart;
+        fScanStart = 0;
+    }
+    fText.append(text, length);
+    if (fText.isBogus()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    textChanged();
+}
+
+void StreamingBreakIterator::finish() {
+    fFinished = TRUE;
+}
+
+void StreamingBreakIterator::reset() {
+    fText.remove();
+    fTextBase = 0;
+    fScanStart = 0;
+    fScanStatusIndex = 0;
+    fCurrent = 0;
+    fCurrentStatusIndex = 0;
+    fFinished = FALSE;
+    if (fPending != NULL) {
+        fPending->removeAllElements();
+    }
+    fPendingIdx = 0;
+    if (fBI != NULL) {
+        textChanged();
+    }
+}
+
+// Point the break iterator at the current contents of fText.
+// The string buffer may have moved; the break iterator's caches
+// are in terms of the old offsets and must be dropped.
+void StreamingBreakIterator::textChanged() {
+    UErrorCode status = U_ZERO_ERROR;
+    fBI->fBreakCache->reset();
+    if (fBI->fDictionaryCache != NULL) {
+        fBI->fDictionaryCache->reset();
+    }
+    utext_openConstUnicodeString(&fBI->fText, &fText, &status);
+    fBI->fPosition = 0;
+    fBI->fRuleStatusIndex = 0;
+    fBI->fDone = FALSE;
+}
+
+int32_t StreamingBreakIterator::next() {
+    if (fBI == NULL) {
+        return UBRK_DONE;
+    }
+    if (fPendingIdx < fPending->size()) {
+        fCurrent = fPending->elementAti(fPendingIdx++);
+        fCurrentStatusIndex = fPending->elementAti(fPendingIdx++);
+        return fCurrent;
+    }
+    fPending->removeAllElements();
+    fPendingIdx = 0;
+
+    int32_t textLength = fText.length();
+    fBI->fPosition = fScanStart;
+    int32_t pos = fBI->handleNext();
+    if (pos == UBRK_DONE) {
+        return UBRK_DONE;
+    }
+    if (!fFinished && (int32_t)UTEXT_GETNATIVEINDEX(&fBI->fText) >= textLength) {
+        // The state machine ran into the end of the available text.
+        // The boundary could move once more text arrives.
+        return UBRK_DONE;
+    }
+    int32_t ruleStatusIdx = fBI->fRuleStatusIndex;
+
+    UErrorCode status = U_ZERO_ERROR;
+    RuleBasedBreakIterator::DictionaryCache *dictionaryCache;
+    if (fBI->fDictionaryCharCount > 0 && (dictionaryCache = fBI->getDictionaryCache()) != NULL) {
+        // The rule based segment includes dictionary characters. Subdivide it, as
+        // BreakCache::populateFollowing() does, and queue up the sub-boundaries.
+        dictionaryCache->populateDictionary(fScanStart, pos, fScanStatusIndex, ruleStatusIdx);
+        int32_t dictPos = fScanStart;
+        int32_t dictStatusIdx = 0;
+        while (dictionaryCache->following(dictPos, &dictPos, &dictStatusIdx)) {
+            fPending->addElement(fTextBase + dictPos, status);
+            fPending->addElement(dictStatusIdx, status);
+        }
+        if (dictPos > pos) {
+            // Dictionary matching extended beyond the rule based segment.
+            if (!fFinished && dictPos >= textLength) {
+                fPending->removeAllElements();
+                return UBRK_DONE;
+            }
+            pos = dictPos;
+            ruleStatusIdx = dictStatusIdx;
+        }
+        dictionaryCache->reset();
+    }
+    if (fPending->isEmpty()) {
+        fPending->addElement(fTextBase + pos, status);
+        fPending->addElement(ruleStatusIdx, status);
+    }
+    if (U_FAILURE(status)) {
+        fPending->removeAllElements();
+        return UBRK_DONE;
+    }
+    fScanStart = pos;
+    fScanStatusIndex = ruleStatusIdx;
+
+    fCurrent = fPending->elementAti(fPendingIdx++);
+    fCurrentStatusIndex = fPending->elementAti(fPendingIdx++);
+    return fCurrent;
+}
+
+int32_t StreamingBreakIterator::getRuleStatus() const {
+    if (fBI == NULL) {
+        return 0;
+    }
+    const int32_t *statusTable = fBI->fData->fRuleStatusTable;
+    return statusTable[fCurrentStatusIndex + statusTable[fCurrentStatusIndex]];
+}
+
+int32_t StreamingBreakIterator::getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (fBI == NULL) {
+        status = U_INVALID_STATE_ERROR;
+        return 0;
+    }
+    fBI->fRuleStatusIndex = fCurrentStatusIndex;
+    return fBI->getRuleStatusVec(fillInVec, capacity, status);
+}
+
+U_NAMESPACE_END
+
+#endif // #if !UCONFIG_NO_BREAK_ITERATION
@@ -0,0 +1,36 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  uasciirun.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   AVX2 continuation of uprv_asciiToUChars() in uasciirun.h,
+*   for long runs on CPUs that support AVX2.
+*/
+
+#include "unicode/utypes.h"
+#include "uasciirun.h"
+
+#if UASCIIRUN_AVX2
+
+#include <immintrin.h>
+
+U_CAPI U_SIMD_TARGET_AVX2 int32_t U_EXPORT2
+uprv_asciiToUCharsAVX2(const uint8_t *src, int32_t length, UChar *dest) {
+    int32_t i=0;
+    while((length-i)>=32) {
+        __m256i b=_mm256_loadu_si256((const __m256i *)(src+i));
+        if(_mm256_movemask_epi8(b)!=0) {
+            break;
+        }
+        _mm256_storeu_si256((__m256i *)(dest+i), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(b)));
+        _mm256_storeu_si256((__m256i *)(dest+i+16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(b, 1)));
+        i+=32;
+    }
+    return i;
+}
+
+#endif
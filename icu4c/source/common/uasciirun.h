@@ -0,0 +1,430 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  uasciirun.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Inline functions that copy runs of ASCII (or Latin-1) text between
+*   8-bit and 16-bit code units. Used by the UTF-8, Latin-1, US-ASCII and SBCS
+*   converters, by the UTF-8 string transformation functions,
+*   by the charset detector for skipping over ASCII input,
+*   and by the UTF-8 case mapping and case-insensitive comparison functions.
+*
+*   Each function handles blocks of UASCIIRUN_BLOCK_LENGTH code units,
+*   with SSE2 instructions where they are available (always on x86-64),
+*   otherwise with 64-bit loads for testing and an unrolled copy loop.
+*   The remainder, and the block with the first out-of-range unit, are handled
+*   one unit at a time, so that each function stops exactly in front of
+*   that unit.
+*
+*   On CPUs with AVX2 (checked at runtime), uprv_asciiToUChars() continues
+*   runs that are longer than UASCIIRUN_AVX2_START bytes with out-of-line
+*   AVX2 code (uasciirun.cpp), 32 bytes at a time.
+*   Shorter runs, which are typical between non-ASCII characters,
+*   stay in the inline code because the call would cost more than it saves.
+*   uprv_uCharsToLatin1() has no such continuation: with the call in its loop,
+*   the converters that inline it got slower for runs of 60..200 UChars
+*   than AVX2 made them faster for longer runs.
+*/
+
+#ifndef __UASCIIRUN_H__
+#define __UASCIIRUN_H__
+
+#include "unicode/utypes.h"
+#include "cmemory.h"
+#include "usimd.h"
+
+#if U_SIMD_SSE2
+#   include <emmintrin.h>
+#endif
+
+#ifndef UASCIIRUN_AVX2
+#   define UASCIIRUN_AVX2 (U_SIMD_SSE2 && U_SIMD_X86_DISPATCH)
+#endif
+
+/** Number of code units per block. @internal */
+#define UASCIIRUN_BLOCK_LENGTH 16
+
+/**
+ * Number of bytes that uprv_asciiToUChars() copies inline
+ * before it tries the AVX2 code. Multiple of UASCIIRUN_BLOCK_LENGTH.
+ * @internal
+ */
+#define UASCIIRUN_AVX2_START 64
+
+#if UASCIIRUN_AVX2
+
+/**
+ * Like uprv_asciiToUChars() but only for whole blocks of 32 bytes, with AVX2.
+ * Call only if uprv_getCPUFeatures() has UPRV_CPU_AVX2.
+ * @return the number of bytes copied, a multiple of 32;
+ *         the following bytes are not all ASCII, or there are fewer than 32
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_asciiToUCharsAVX2(const uint8_t *src, int32_t length, UChar *dest);
+
+#endif
+
+/**
+ * Copies the leading run of ASCII bytes (00..7F) from src to dest, widening them to UChars.
+ * @param src source bytes
+ * @param length number of bytes that may be read from src and written to dest
+ * @param dest destination UChars
+ * @return the number of bytes copied;
+ *         if less than length, then src[return value] is not ASCII
+ * @internal
+ */
+static inline int32_t
+uprv_asciiToUChars(const uint8_t *src, int32_t length, UChar *dest) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i zero=_mm_setzero_si128();
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        __m128i b=_mm_loadu_si128((const __m128i *)(src+i));
+        if(_mm_movemask_epi8(b)!=0) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest+i), _mm_unpacklo_epi8(b, zero));
+        _mm_storeu_si128((__m128i *)(dest+i+8), _mm_unpackhi_epi8(b, zero));
+        i+=UASCIIRUN_BLOCK_LENGTH;
+#if UASCIIRUN_AVX2
+        if(i==UASCIIRUN_AVX2_START && (uprv_getCPUFeatures()&UPRV_CPU_AVX2)!=0) {
+            i+=uprv_asciiToUCharsAVX2(src+i, length-i, dest+i);
+        }
+#endif
+    }
+#else
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        uint64_t w0, w1;
+        uprv_memcpy(&w0, src+i, 8);
+        uprv_memcpy(&w1, src+i+8, 8);
+        if(((w0|w1)&0x8080808080808080ULL)!=0) {
+            break;
+        }
+        const uint8_t *s=src+i;
+        UChar *d=dest+i;
+        d[0]=s[0]; d[1]=s[1]; d[2]=s[2]; d[3]=s[3];
+        d[4]=s[4]; d[5]=s[5]; d[6]=s[6]; d[7]=s[7];
+        d[8]=s[8]; d[9]=s[9]; d[10]=s[10]; d[11]=s[11];
+        d[12]=s[12]; d[13]=s[13]; d[14]=s[14]; d[15]=s[15];
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#endif
+    while(i<length && src[i]<=0x7f) {
+        dest[i]=src[i];
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Copies the leading run of UChars up to max from src to dest, narrowing them to bytes.
+ * @param src source UChars
+ * @param length number of UChars that may be read from src, and bytes written to dest
+ * @param dest destination bytes
+ * @param max 0x7f for ASCII or 0xff for Latin-1
+ * @return the number of UChars copied;
+ *         if less than length, then src[return value]>max
+ * @internal
+ */
+static inline int32_t
+uprv_uCharsToLatin1(const UChar *src, int32_t length, uint8_t *dest, UChar max) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i mask=_mm_set1_epi16((short)(uint16_t)~max);
+    const __m128i zero=_mm_setzero_si128();
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        __m128i u0=_mm_loadu_si128((const __m128i *)(src+i));
+        __m128i u1=_mm_loadu_si128((const __m128i *)(src+i+8));
+        __m128i outOfRange=_mm_and_si128(_mm_or_si128(u0, u1), mask);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(outOfRange, zero))!=0xffff) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest+i), _mm_packus_epi16(u0, u1));
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#else
+    uint64_t mask=(uint16_t)~max;
+    mask|=mask<<16;
+    mask|=mask<<32;
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        uint64_t w0, w1, w2, w3;
+        uprv_memcpy(&w0, src+i, 8);
+        uprv_memcpy(&w1, src+i+4, 8);
+        uprv_memcpy(&w2, src+i+8, 8);
+        uprv_memcpy(&w3, src+i+12, 8);
+        if(((w0|w1|w2|w3)&mask)!=0) {
+            break;
+        }
+        const UChar *s=src+i;
+        uint8_t *d=dest+i;
+        d[0]=(uint8_t)s[0]; d[1]=(uint8_t)s[1]; d[2]=(uint8_t)s[2]; d[3]=(uint8_t)s[3];
+        d[4]=(uint8_t)s[4]; d[5]=(uint8_t)s[5]; d[6]=(uint8_t)s[6]; d[7]=(uint8_t)s[7];
+        d[8]=(uint8_t)s[8]; d[9]=(uint8_t)s[9]; d[10]=(uint8_t)s[10]; d[11]=(uint8_t)s[11];
+        d[12]=(uint8_t)s[12]; d[13]=(uint8_t)s[13]; d[14]=(uint8_t)s[14]; d[15]=(uint8_t)s[15];
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#endif
+    while(i<length && src[i]<=max) {
+        dest[i]=(uint8_t)src[i];
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Copies the leading run of ASCII bytes (00..7F) from src to dest.
+ * @param src source bytes
+ * @param length number of bytes that may be read from src and written to dest
+ * @param dest destination bytes
+ * @return the number of bytes copied;
+ *         if less than length, then src[return value] is not ASCII
+ * @internal
+ */
+static inline int32_t
+uprv_copyASCII(const uint8_t *src, int32_t length, uint8_t *dest) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        __m128i b=_mm_loadu_si128((const __m128i *)(src+i));
+        if(_mm_movemask_epi8(b)!=0) {
+            break;
+        }
+        _mm_storeu_si128((__m128i *)(dest+i), b);
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#else
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        uint64_t w0, w1;
+        uprv_memcpy(&w0, src+i, 8);
+        uprv_memcpy(&w1, src+i+8, 8);
+        if(((w0|w1)&0x8080808080808080ULL)!=0) {
+            break;
+        }
+        uprv_memcpy(dest+i, &w0, 8);
+        uprv_memcpy(dest+i+8, &w1, 8);
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#endif
+    while(i<length && src[i]<=0x7f) {
+        dest[i]=src[i];
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the length of the leading run of ASCII bytes (00..7F).
+ * @param src source bytes
+ * @param length number of bytes that may be read from src
+ * @return the length of the ASCII run;
+ *         if less than length, then src[return value] is not ASCII
+ * @internal
+ */
+static inline int32_t
+uprv_asciiSpan(const uint8_t *src, int32_t length) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        __m128i b=_mm_loadu_si128((const __m128i *)(src+i));
+        if(_mm_movemask_epi8(b)!=0) {
+            break;
+        }
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#else
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        uint64_t w0, w1;
+        uprv_memcpy(&w0, src+i, 8);
+        uprv_memcpy(&w1, src+i+8, 8);
+        if(((w0|w1)&0x8080808080808080ULL)!=0) {
+            break;
+        }
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#endif
+    while(i<length && src[i]<=0x7f) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns a 64-bit word with 0x80 set in each byte of the ASCII word w
+ * that is in the range first..last, and 0 in the other bytes.
+ * Each byte of w must be 00..7F, and it must be 0<first<=last<=0x7f.
+ * @internal
+ */
+static inline uint64_t
+uprv_asciiWordInRange(uint64_t w, uint8_t first, uint8_t last) {
+    // No byte overflows into the next one because each is at most 0x7f+0x80.
+    const uint64_t ones=0x0101010101010101ULL;
+    return (w+ones*(uint8_t)(0x80-first))&~(w+ones*(uint8_t)(0x7f-last))&(ones*0x80);
+}
+
+/**
+ * Returns the length of the leading run of ASCII bytes (00..7F)
+ * that are not in the range first..last.
+ * For example, with 'A'..'Z' this is the run of bytes that lowercasing leaves unchanged.
+ * @param src source bytes
+ * @param length number of bytes that may be read from src
+ * @param first first byte value that stops the run, must be 0<first<=last
+ * @param last last byte value that stops the run, must be <=0x7f
+ * @return the length of the run;
+ *         if less than length, then src[return value] is not ASCII or in first..last
+ * @internal
+ */
+static inline int32_t
+uprv_asciiSpanOutside(const uint8_t *src, int32_t length, uint8_t first, uint8_t last) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i below=_mm_set1_epi8((char)(first-1));
+    const __m128i above=_mm_set1_epi8((char)(last+1));
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        __m128i b=_mm_loadu_si128((const __m128i *)(src+i));
+        // Non-ASCII bytes are negative and therefore not in range.
+        __m128i inRange=_mm_and_si128(_mm_cmpgt_epi8(b, below), _mm_cmplt_epi8(b, above));
+        if(_mm_movemask_epi8(_mm_or_si128(b, inRange))!=0) {
+            break;
+        }
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#else
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        uint64_t w0, w1;
+        uprv_memcpy(&w0, src+i, 8);
+        uprv_memcpy(&w1, src+i+8, 8);
+        if(((w0|w1)&0x8080808080808080ULL)!=0 ||
+                (uprv_asciiWordInRange(w0, first, last)|uprv_asciiWordInRange(w1, first, last))!=0) {
+            break;
+        }
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#endif
+    uint8_t b;
+    while(i<length && (b=src[i])<=0x7f && !(first<=b && b<=last)) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Copies the leading run of ASCII bytes (00..7F) from src to dest,
+ * toggling the case bit 0x20 of each byte in the range first..last.
+ * With 'A'..'Z' this lowercases the run, with 'a'..'z' it uppercases it.
+ * @param src source bytes
+ * @param length number of bytes that may be read from src and written to dest
+ * @param dest destination bytes
+ * @param first first byte value to be changed, must be 0<first<=last
+ * @param last last byte value to be changed, must be <=0x7f
+ * @return the number of bytes copied;
+ *         if less than length, then src[return value] is not ASCII
+ * @internal
+ */
+static inline int32_t
+uprv_asciiCaseMap(const uint8_t *src, int32_t length, uint8_t *dest, uint8_t first, uint8_t last) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i below=_mm_set1_epi8((char)(first-1));
+    const __m128i above=_mm_set1_epi8((char)(last+1));
+    const __m128i caseBit=_mm_set1_epi8(0x20);
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        __m128i b=_mm_loadu_si128((const __m128i *)(src+i));
+        if(_mm_movemask_epi8(b)!=0) {
+            break;
+        }
+        __m128i inRange=_mm_and_si128(_mm_cmpgt_epi8(b, below), _mm_cmplt_epi8(b, above));
+        _mm_storeu_si128((__m128i *)(dest+i), _mm_xor_si128(b, _mm_and_si128(inRange, caseBit)));
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#else
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        uint64_t w0, w1;
+        uprv_memcpy(&w0, src+i, 8);
+        uprv_memcpy(&w1, src+i+8, 8);
+        if(((w0|w1)&0x8080808080808080ULL)!=0) {
+            break;
+        }
+        w0^=uprv_asciiWordInRange(w0, first, last)>>2;
+        w1^=uprv_asciiWordInRange(w1, first, last)>>2;
+        uprv_memcpy(dest+i, &w0, 8);
+        uprv_memcpy(dest+i+8, &w1, 8);
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#endif
+    uint8_t b;
+    while(i<length && (b=src[i])<=0x7f) {
+        dest[i]=(first<=b && b<=last) ? (uint8_t)(b^0x20) : b;
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * Returns the length of the leading run where s1 and s2 have the same ASCII bytes (00..7F)
+ * after lowercasing A..Z.
+ * @param s1 first source
+ * @param s2 second source
+ * @param length number of bytes that may be read from each source
+ * @return the length of the run;
+ *         if less than length, then s1[return value] or s2[return value] is not ASCII,
+ *         or they are ASCII bytes that differ other than in case
+ * @internal
+ */
+static inline int32_t
+uprv_asciiCaseEqualSpan(const uint8_t *s1, const uint8_t *s2, int32_t length) {
+    int32_t i=0;
+#if U_SIMD_SSE2
+    const __m128i below=_mm_set1_epi8('A'-1);
+    const __m128i above=_mm_set1_epi8('Z'+1);
+    const __m128i caseBit=_mm_set1_epi8(0x20);
+    while((length-i)>=UASCIIRUN_BLOCK_LENGTH) {
+        __m128i a=_mm_loadu_si128((const __m128i *)(s1+i));
+        __m128i b=_mm_loadu_si128((const __m128i *)(s2+i));
+        if(_mm_movemask_epi8(_mm_or_si128(a, b))!=0) {
+            break;
+        }
+        a=_mm_or_si128(a, _mm_and_si128(
+            _mm_and_si128(_mm_cmpgt_epi8(a, below), _mm_cmplt_epi8(a, above)), caseBit));
+        b=_mm_or_si128(b, _mm_and_si128(
+            _mm_and_si128(_mm_cmpgt_epi8(b, below), _mm_cmplt_epi8(b, above)), caseBit));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))!=0xffff) {
+            break;
+        }
+        i+=UASCIIRUN_BLOCK_LENGTH;
+    }
+#else
+    while((length-i)>=8) {
+        uint64_t a, b;
+        uprv_memcpy(&a, s1+i, 8);
+        uprv_memcpy(&b, s2+i, 8);
+        if(((a|b)&0x8080808080808080ULL)!=0) {
+            break;
+        }
+        a|=uprv_asciiWordInRange(a, 'A', 'Z')>>2;
+        b|=uprv_asciiWordInRange(b, 'A', 'Z')>>2;
+        if(a!=b) {
+            break;
+        }
+        i+=8;
+    }
+#endif
+    uint8_t a, b;
+    while(i<length && ((a=s1[i])|(b=s2[i]))<=0x7f) {
+        if(a!=b) {
+            if('A'<=a && a<='Z') { a|=0x20; }
+            if('A'<=b && b<='Z') { b|=0x20; }
+            if(a!=b) {
+                break;
+            }
+        }
+        ++i;
+    }
+    return i;
+}
+
+#endif
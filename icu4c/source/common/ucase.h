@@ -22,11 +22,11 @@
 #define __UCASE_H__
 
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uset.h"
 #include "putilimp.h"
 #include "uset_imp.h"
 #include "udataswp.h"
-#include "utrie2.h"
 
 #ifdef __cplusplus
 U_NAMESPACE_BEGIN
@@ -336,7 +336,7 @@ enum {
 
 /* definitions for 16-bit case properties word ------------------------------ */
 
-U_CFUNC const UTrie2 * U_EXPORT2
+U_CFUNC const UCPTrie * U_EXPORT2
 ucase_getTrie();
 
 /* 2-bit constants for types of cased characters */
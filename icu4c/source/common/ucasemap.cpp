@@ -38,6 +38,7 @@
 #include "bytesinkutil.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "uasciirun.h"
 #include "uassert.h"
 #include "ucase.h"
 #include "ucasemap_imp.h"
@@ -165,6 +166,59 @@ appendResult(int32_t cpLength, int32_t result, const UChar *s,
 inline uint8_t getTwoByteLead(UChar32 c) { return (uint8_t)((c >> 6) | 0xc0); }
 inline uint8_t getTwoByteTrail(UChar32 c) { return (uint8_t)((c & 0x3f) | 0x80); }
 
+/**
+ * Case-maps the run of ASCII characters from src[srcIndex] up to the first one that is
+ * not ASCII or an exception in the latinCase table, and appends all of it including
+ * the unchanged characters. Not used with U_OMIT_UNCHANGED_TEXT.
+ * With the normal tables, the only ASCII mappings toggle bit 0x20 of first..last,
+ * and whole blocks are mapped at a time. Each change gets its own 1:1 Edits record
+ * as in the character loops.
+ * @return the source index after the run
+ */
+int32_t appendASCIIRun(const int8_t *latinCase, UBool isNormal, uint8_t first, uint8_t last,
+                       const uint8_t *src, int32_t srcIndex, int32_t srcLimit,
+                       ByteSink &sink, icu::Edits *edits) {
+    char scratch[200];
+    for (;;) {
+        int32_t length = srcLimit - srcIndex;
+        int32_t capacity;
+        uint8_t *dest = (uint8_t *)sink.GetAppendBuffer(
+            1, length, scratch, UPRV_LENGTHOF(scratch), &capacity);
+        if (length > capacity) {
+            length = capacity;
+        }
+        const uint8_t *s = src + srcIndex;
+        int32_t i;
+        if (isNormal) {
+            i = uprv_asciiCaseMap(s, length, dest, first, last);
+        } else {
+            for (i = 0; i < length; ++i) {
+                uint8_t b = s[i];
+                int8_t d;
+                if (b > 0x7f || (d = latinCase[b]) == LatinCase::EXC) { break; }
+                dest[i] = (uint8_t)(b + d);
+            }
+        }
+        if (i == 0) { break; }
+        sink.Append((const char *)dest, i);
+        if (edits != nullptr) {
+            for (int32_t j = 0; j < i;) {
+                int32_t start = j;
+                while (j < i && s[j] == dest[j]) { ++j; }
+                if (j > start) {
+                    edits->addUnchanged(j - start);
+                }
+                for (; j < i && s[j] != dest[j]; ++j) {
+                    edits->addReplace(1, 1);
+                }
+            }
+        }
+        srcIndex += i;
+        if (i < length) { break; }
+    }
+    return srcIndex;
+}
+
 UChar32 U_CALLCONV
 utf8_caseContextIterator(void *context, int8_t dir) {
     UCaseContext *csc=(UCaseContext *)context;
@@ -213,7 +267,8 @@ void toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    UBool isNormal = latinToLower == LatinCase::TO_LOWER_NORMAL;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
     for (;;) {
@@ -233,13 +288,23 @@ void toLower(int32_t caseLocale, uint32_t options,
                     c = lead;
                     break;
                 }
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    // Skip the rest of the unchanged ASCII run.
+                    srcIndex += uprv_asciiSpanOutside(src + srcIndex, srcLimit - srcIndex,
+                                                      'A', 'Z');
+                    continue;
+                }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
-                char ascii = (char)(lead + d);
-                sink.Append(&ascii, 1);
-                if (edits != nullptr) {
-                    edits->addReplace(1, 1);
+                if ((options & U_OMIT_UNCHANGED_TEXT) == 0) {
+                    srcIndex = appendASCIIRun(latinToLower, isNormal, 'A', 'Z',
+                                              src, srcIndex - 1, srcLimit, sink, edits);
+                } else {
+                    char ascii = (char)(lead + d);
+                    sink.Append(&ascii, 1);
+                    if (edits != nullptr) {
+                        edits->addReplace(1, 1);
+                    }
                 }
                 prev = srcIndex;
                 continue;
@@ -278,7 +343,7 @@ void toLower(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -321,7 +386,8 @@ void toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    UBool isNormal = latinToUpper == LatinCase::TO_UPPER_NORMAL;
+    const UCPTrie *trie = ucase_getTrie();
     int32_t prev = 0;
     int32_t srcIndex = 0;
     for (;;) {
@@ -341,13 +407,23 @@ void toUpper(int32_t caseLocale, uint32_t options,
                     c = lead;
                     break;
                 }
-                if (d == 0) { continue; }
+                if (d == 0) {
+                    // Skip the rest of the unchanged ASCII run.
+                    srcIndex += uprv_asciiSpanOutside(src + srcIndex, srcLength - srcIndex,
+                                                      'a', 'z');
+                    continue;
+                }
                 ByteSinkUtil::appendUnchanged(src + prev, srcIndex - 1 - prev,
                                               sink, options, edits, errorCode);
-                char ascii = (char)(lead + d);
-                sink.Append(&ascii, 1);
-                if (edits != nullptr) {
-                    edits->addReplace(1, 1);
+                if ((options & U_OMIT_UNCHANGED_TEXT) == 0) {
+                    srcIndex = appendASCIIRun(latinToUpper, isNormal, 'a', 'z',
+                                              src, srcIndex - 1, srcLength, sink, edits);
+                } else {
+                    char ascii = (char)(lead + d);
+                    sink.Append(&ascii, 1);
+                    if (edits != nullptr) {
+                        edits->addReplace(1, 1);
+                    }
                 }
                 prev = srcIndex;
                 continue;
@@ -386,7 +462,7 @@ void toUpper(int32_t caseLocale, uint32_t options,
                 // ill-formed UTF-8
                 continue;
             }
-            uint16_t props = UTRIE2_GET16(trie, c);
+            uint16_t props = UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
             if (UCASE_HAS_EXCEPTION(props)) { break; }
             int32_t delta;
             if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -882,6 +958,144 @@ ucasemap_utf8FoldCase(const UCaseMap *csm,
         ucasemap_internalUTF8Fold, NULL, *pErrorCode);
 }
 
+/* UTF-8 case-insensitive comparison ---------------------------------------- */
+
+namespace {
+
+/**
+ * Iterates over the full case folding of a UTF-8 string, one code point at a time.
+ * Multi-character foldings are returned from the case mapping data.
+ */
+class UTF8FoldIterator {
+public:
+    UTF8FoldIterator(const uint8_t *src, int32_t srcLength, uint32_t opts) :
+            s(src), index(0), length(srcLength), options(opts),
+            folding(nullptr), foldingIndex(0), foldingLength(0) {}
+
+    /** @return TRUE if the rest of a multi-character folding is pending */
+    UBool inFolding() const { return foldingIndex < foldingLength; }
+
+    /** @return the next folded code point, or U_SENTINEL at the end */
+    UChar32 next() {
+        UChar32 c;
+        if (foldingIndex < foldingLength) {
+            U16_NEXT(folding, foldingIndex, foldingLength, c);
+            return c;
+        }
+        if (index >= length) {
+            return U_SENTINEL;
+        }
+        U8_NEXT_OR_FFFD(s, index, length, c);
+        c = ucase_toFullFolding(c, &folding, options);
+        if (c < 0) {
+            return ~c;  // unchanged
+        } else if (c <= UCASE_MAX_STRING_LENGTH) {
+            foldingIndex = 0;
+            foldingLength = c;
+            U16_NEXT(folding, foldingIndex, foldingLength, c);
+        }
+        return c;
+    }
+
+    const uint8_t *s;
+    int32_t index;
+    int32_t length;
+
+private:
+    uint32_t options;
+    const UChar *folding;
+    int32_t foldingIndex;
+    int32_t foldingLength;
+};
+
+/**
+ * Moves U+E000..U+FFFF above the supplementary code points,
+ * which yields UTF-16 code unit order for code points other than surrogates.
+ */
+inline UChar32 codeUnitOrderKey(UChar32 c) {
+    if (c >= 0xe000) {
+        c = c <= 0xffff ? c + 0x100000 : c - 0x2000;
+    }
+    return c;
+}
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+u_strCaseCompareUTF8(const char *s1, int32_t length1,
+                     const char *s2, int32_t length2,
+                     uint32_t options,
+                     UErrorCode *pErrorCode) {
+    if (pErrorCode == nullptr || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if (s1 == nullptr || length1 < -1 || s2 == nullptr || length2 < -1) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    if (length1 < 0) {
+        length1 = (int32_t)uprv_strlen(s1);
+    }
+    if (length2 < 0) {
+        length2 = (int32_t)uprv_strlen(s2);
+    }
+    // With the default folding, ASCII folds to ASCII without exceptions.
+    // Otherwise I and J are exceptions in the Latin table and take the slow path.
+    UBool isDefault = (options & _FOLD_CASE_OPTIONS_MASK) == U_FOLD_CASE_DEFAULT;
+    const int8_t *latinFold = isDefault ? LatinCase::TO_LOWER_NORMAL : LatinCase::TO_LOWER_TR_LT;
+    UTF8FoldIterator iter1((const uint8_t *)s1, length1, options);
+    UTF8FoldIterator iter2((const uint8_t *)s2, length2, options);
+    for (;;) {
+        if (!iter1.inFolding() && !iter2.inFolding()) {
+            // fast path: skip ASCII characters that fold to the same ones
+            const uint8_t *p1 = iter1.s + iter1.index;
+            const uint8_t *p2 = iter2.s + iter2.index;
+            int32_t length = length1 - iter1.index;
+            if (length > (length2 - iter2.index)) {
+                length = length2 - iter2.index;
+            }
+            int32_t i;
+            if (isDefault) {
+                i = uprv_asciiCaseEqualSpan(p1, p2, length);
+            } else {
+                for (i = 0; i < length; ++i) {
+                    uint8_t b1 = p1[i], b2 = p2[i];
+                    if (b1 != b2) {
+                        int8_t d1, d2;
+                        if ((b1 | b2) > 0x7f ||
+                                (d1 = latinFold[b1]) == LatinCase::EXC ||
+                                (d2 = latinFold[b2]) == LatinCase::EXC ||
+                                (b1 + d1) != (b2 + d2)) {
+                            break;
+                        }
+                    } else if (b1 > 0x7f) {
+                        break;
+                    }
+                }
+            }
+            iter1.index += i;
+            iter2.index += i;
+        }
+        UChar32 c1 = iter1.next();
+        UChar32 c2 = iter2.next();
+        if (c1 != c2) {
+            if (c1 < 0) {
+                return -1;
+            } else if (c2 < 0) {
+                return 1;
+            }
+            if ((options & U_COMPARE_CODE_POINT_ORDER) == 0) {
+                c1 = codeUnitOrderKey(c1);
+                c2 = codeUnitOrderKey(c2);
+            }
+            return c1 < c2 ? -1 : 1;
+        }
+        if (c1 < 0) {
+            return 0;
+        }
+    }
+}
+
 U_NAMESPACE_BEGIN
 
 void CaseMap::utf8ToLower(
@@ -23,12 +23,12 @@
 
 #include "unicode/utypes.h"
 #include "unicode/uchar.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uscript.h"
 #include "unicode/udata.h"
 #include "uassert.h"
 #include "cmemory.h"
 #include "ucln_cmn.h"
-#include "utrie2.h"
 #include "udataswp.h"
 #include "uprops.h"
 #include "ustr_imp.h"
@@ -40,7 +40,7 @@
 /* constants and macros for access to the data ------------------------------ */
 
 /* getting a uint32_t properties word from the data */
-#define GET_PROPS(c, result) ((result)=UTRIE2_GET16(&propsTrie, c));
+#define GET_PROPS(c, result) ((result)=UCPTRIE_FAST_GET(&propsTrie, UCPTRIE_16, c));
 
 /* API functions ------------------------------------------------------------ */
 
@@ -53,36 +53,28 @@ u_charType(UChar32 c) {
 }
 
 /* Enumerate all code points with their general categories. */
-struct _EnumTypeCallback {
-    UCharEnumTypeRange *enumRange;
-    const void *context;
-};
-
 static uint32_t U_CALLCONV
 _enumTypeValue(const void *context, uint32_t value) {
     (void)context;
     return GET_CATEGORY(value);
 }
 
-static UBool U_CALLCONV
-_enumTypeRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
-    /* just cast the value to UCharCategory */
-    return ((struct _EnumTypeCallback *)context)->
-        enumRange(((struct _EnumTypeCallback *)context)->context,
-                  start, end+1, (UCharCategory)value);
-}
-
 U_CAPI void U_EXPORT2
 u_enumCharTypes(UCharEnumTypeRange *enumRange, const void *context) {
-    struct _EnumTypeCallback callback;
-
     if(enumRange==NULL) {
         return;
     }
 
-    callback.enumRange=enumRange;
-    callback.context=context;
-    utrie2_enum(&propsTrie, _enumTypeValue, _enumTypeRange, &callback);
+    UChar32 start=0, end;
+    uint32_t value;
+    while((end=ucptrie_getRange(&propsTrie, start, UCPMAP_RANGE_NORMAL, 0,
+                                _enumTypeValue, NULL, &value))>=0) {
+        /* just cast the value to UCharCategory */
+        if(!enumRange(context, start, end+1, (UCharCategory)value)) {
+            break;
+        }
+        start=end+1;
+    }
 }
 
 /* Checks if ch is a lower case letter.*/
@@ -527,7 +519,7 @@ u_getUnicodeProperties(UChar32 c, int32_t column) {
     if(column>=propsVectorsColumns) {
         return 0;
     } else {
-        uint16_t vecIndex=UTRIE2_GET16(&propsVectorsTrie, c);
+        uint16_t vecIndex=UCPTRIE_FAST_GET(&propsVectorsTrie, UCPTRIE_16, c);
         return propsVectors[vecIndex+column];
     }
 }
@@ -648,14 +640,15 @@ ublock_getCode(UChar32 c) {
 
 /* property starts for UnicodeSet ------------------------------------------- */
 
-static UBool U_CALLCONV
-_enumPropertyStartsRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
-    /* add the start code point to the USet */
-    const USetAdder *sa=(const USetAdder *)context;
-    sa->add(sa->set, start);
-    (void)end;
-    (void)value;
-    return TRUE;
+static void
+_addTrieRangeStarts(const UCPTrie *trie, const USetAdder *sa) {
+    /* add the start code point of each same-value range of the trie */
+    UChar32 start=0, end;
+    while((end=ucptrie_getRange(trie, start, UCPMAP_RANGE_NORMAL, 0,
+                                NULL, NULL, NULL))>=0) {
+        sa->add(sa->set, start);
+        start=end+1;
+    }
 }
 
 #define USET_ADD_CP_AND_NEXT(sa, cp) sa->add(sa->set, cp); sa->add(sa->set, cp+1)
@@ -667,7 +660,7 @@ uchar_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     }
 
     /* add the start code point of each same-value range of the main trie */
-    utrie2_enum(&propsTrie, NULL, _enumPropertyStartsRange, sa);
+    _addTrieRangeStarts(&propsTrie, sa);
 
     /* add code points with hardcoded properties, plus the ones following them */
 
@@ -727,5 +720,5 @@ upropsvec_addPropertyStarts(const USetAdder *sa, UErrorCode *pErrorCode) {
     }
 
     /* add the start code point of each same-value range of the properties vectors trie */
-    utrie2_enum(&propsVectorsTrie, NULL, _enumPropertyStartsRange, sa);
+    _addTrieRangeStarts(&propsVectorsTrie, sa);
 }
@@ -13,1948 +13,1687 @@
 
 static const UVersionInfo dataVersion={0xc,0,0,0};
 
-static const uint16_t propsTrie_index[21968]={
-0x45d,0x465,0x46d,0x475,0x48d,0x495,0x49d,0x4a5,0x4ad,0x4b5,0x4bb,0x4c3,0x4cb,0x4d3,0x4db,0x4e3,
-0x4e9,0x4f1,0x4f9,0x501,0x504,0x50c,0x514,0x51c,0x524,0x52c,0x528,0x530,0x538,0x540,0x545,0x54d,
-0x555,0x55d,0x561,0x569,0x571,0x579,0x581,0x589,0x585,0x58d,0x592,0x59a,0x5a0,0x5a8,0x5b0,0x5b8,
-0x5c0,0x5c8,0x5d0,0x5d8,0x5dd,0x5e5,0x5e8,0x5f0,0x5f8,0x600,0x606,0x60e,0x60d,0x615,0x61d,0x625,
-0x635,0x62d,0x63d,0x645,0x47d,0x655,0x65d,0x64d,0x66d,0x66f,0x677,0x665,0x687,0x68d,0x695,0x67f,
-0x6a5,0x6ab,0x6b3,0x69d,0x6c3,0x6c9,0x6d1,0x6bb,0x6e1,0x6e7,0x6ef,0x6d9,0x6ff,0x707,0x70f,0x6f7,
-0x71f,0x725,0x72d,0x717,0x73d,0x743,0x74b,0x735,0x75b,0x760,0x768,0x753,0x778,0x77f,0x787,0x770,
-0x609,0x78f,0x797,0x47d,0x79f,0x7a6,0x7ae,0x47d,0x7b6,0x7be,0x7c6,0x7cb,0x7d3,0x7da,0x7e2,0x47d,
-0x5c8,0x7ea,0x7f2,0x7fa,0x802,0x555,0x812,0x80a,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x81a,0x5c8,0x822,0x826,0x82e,0x5c8,0x834,0x5c8,0x83a,0x842,0x84a,0x555,0x555,0x852,
-0x85a,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x85f,0x867,0x5c8,0x5c8,0x86f,0x877,0x87f,0x887,0x88f,0x5c8,0x897,0x89f,0x8a7,
-0x8b7,0x5c8,0x8bf,0x8c1,0x8c9,0x8af,0x5c8,0x8cc,0x8e0,0x8d4,0x8dc,0x8e8,0x5c8,0x8f0,0x8f6,0x8fe,
-0x906,0x5c8,0x916,0x91e,0x926,0x90e,0x47d,0x47d,0x936,0x939,0x941,0x92e,0x951,0x949,0x5c8,0x958,
-0x5c8,0x967,0x960,0x96f,0x977,0x97b,0x983,0x98b,0x4fd,0x993,0x996,0x99c,0x9a3,0x996,0x524,0x9ab,
-0x4ad,0x4ad,0x4ad,0x4ad,0x9b3,0x4ad,0x4ad,0x4ad,0x9c3,0x9cb,0x9d3,0x9db,0x9e3,0x9e7,0x9ef,0x9bb,
-0xa07,0xa0f,0x9f7,0x9ff,0xa17,0xa1f,0xa27,0xa2f,0xa47,0xa37,0xa3f,0xa4f,0xa57,0xa66,0xa6b,0xa5e,
-0xa73,0xa73,0xa73,0xa73,0xa73,0xa73,0xa73,0xa73,0xa7b,0xa83,0x8fe,0xa86,0xa8e,0xa95,0xa9a,0xaa2,
-0x8fe,0xaa9,0xaa8,0xab9,0xabc,0x8fe,0x8fe,0xab1,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0xacb,0xad3,0xac3,
-0x8fe,0x8fe,0x8fe,0xad8,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0xade,0xae6,0x8fe,0xaee,0xaf5,
-0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0xa73,0xa73,0xa73,0xa73,0xafd,0xa73,0xb04,0xb0b,
-0xa73,0xa73,0xa73,0xa73,0xa73,0xa73,0xa73,0xa73,0x8fe,0xb13,0xb1a,0xb1e,0xb24,0x8fe,0x8fe,0x8fe,
-0x555,0xb34,0xb2c,0xb3c,0x4ad,0x4ad,0x4ad,0xb44,0x4fd,0xb4c,0x5c8,0xb52,0xb62,0xb5a,0xb5a,0x524,
-0xb6a,0xb72,0xb7a,0x47d,0xb82,0x8fe,0x8fe,0xb89,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0xb91,0xb97,
-0xba7,0xb9f,0x609,0x5c8,0xbaf,0x85a,0x5c8,0xbb7,0xbbf,0xbc3,0x5c8,0x5c8,0xbc8,0xbd0,0x8fe,0xbd8,
-0xaa3,0xbe0,0xbe6,0x8fe,0xbe0,0xbee,0x8fe,0xaa3,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,
-0xbf6,0x5c8,0x5c8,0x5c8,0xbfe,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0xc04,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc09,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x8cc,0x8fe,0x8fe,
-0xc11,0x5c8,0xc14,0x5c8,0xc1c,0xc22,0xc2a,0xc32,0xc37,0x5c8,0x5c8,0xc3b,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc42,0x5c8,0xc49,0xc4f,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc57,0x5c8,0x5c8,0x5c8,0xc5f,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc61,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc68,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0xc6f,0x5c8,0x5c8,0x5c8,0xc76,0xc7e,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc83,0x5c8,0x5c8,0xc8b,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc8f,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc92,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xc95,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0xc9b,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0xca3,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0xca8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xcad,0x5c8,0x5c8,0x5c8,0xcb2,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0xcba,0xcc1,0xcc5,0x5c8,0x5c8,0x5c8,0xccc,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xcd2,
-0xce2,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0xcda,0x8fe,0xcea,0x96f,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0xcef,0xcf7,0x4ad,0xd07,0xcff,0x5c8,0x5c8,0xd0f,0xd17,0xd27,0x4ad,0xd2c,0xd34,0xd3a,0xd42,0xd1f,
-0xd4a,0xd52,0x5c8,0xd5a,0xd6a,0xd6d,0xd62,0xd75,0x61d,0xd7d,0xd84,0x8c0,0x66d,0xd94,0xd8c,0xd9c,
-0x5c8,0xda4,0xdac,0xdb4,0x5c8,0xdbc,0xdc4,0xdcc,0xdd4,0xddc,0xde0,0xde8,0x4fd,0x4fd,0x5c8,0xdf0,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xdf8,0xe04,0xdfc,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,
-0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0x5c8,0x5c8,0x5c8,0xe1c,0x5c8,0xccd,0xe23,0xe28,
-0x5c8,0x5c8,0x5c8,0xe30,0x5c8,0x5c8,0x8cb,0x47d,0xe46,0xe36,0xe3e,0x5c8,0x5c8,0xe4e,0xe56,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xe5b,0xe63,0x5c8,0xe67,0x5c8,0xe6d,0xe71,
-0xe79,0xe81,0xe88,0xe90,0x5c8,0x5c8,0x5c8,0xe96,0xeae,0x46d,0xeb6,0xebe,0xec3,0x8e0,0xe9e,0xea6,
-0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,
-0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,0xe0c,
-0x11f4,0x11f4,0x1234,0x1274,0x12b4,0x12ec,0x132c,0x136c,0x13a4,0x13e4,0x1410,0x1450,0x1490,0x14a0,0x14e0,0x1514,
-0x1554,0x1584,0x15c4,0x1604,0x1614,0x1648,0x1680,0x16c0,0x1700,0x1740,0x1774,0x17a0,0x17e0,0x1818,0x1834,0x1874,
-0xa80,0xac0,0xb00,0xb40,0xb80,0xa40,0xbc0,0xa40,0xbe2,0xa40,0xa40,0xa40,0xa40,0xc22,0x1db,0x1db,
-0xc62,0xca2,0xa40,0xa40,0xa40,0xa40,0xce2,0xd02,0xa40,0xa40,0xd42,0xd82,0xdc2,0xe02,0xe42,0xe82,
-0xec2,0xef9,0x1db,0x1db,0xf1d,0xf51,0x1db,0xf79,0x1db,0x1db,0x1db,0x1db,0xfa6,0x1db,0x1db,0x1db,
-0x1db,0x1db,0x1db,0x1db,0xfba,0x1db,0xff2,0x1032,0x1db,0x103d,0x1db,0x1db,0x1db,0x1073,0xa40,0x10b3,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0x10f3,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x1133,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,
-0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x700,0x1133,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0xecb,0xed2,0xeda,0x47d,0x5c8,0x5c8,0x5c8,0xbd0,0xeea,0xee2,0xf01,0xef2,0xef9,0xf09,0xb7e,0xf11,
-0x47d,0x47d,0x47d,0x47d,0x8c0,0x5c8,0xf19,0xf21,0x5c8,0xf29,0xf31,0xf35,0xf3d,0x5c8,0xf45,0x47d,
-0x555,0x55f,0xf4d,0x5c8,0xf51,0xf59,0xf69,0xf61,0x5c8,0xf71,0x5c8,0xf78,0x47d,0x47d,0x47d,0x47d,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xb62,0x8cc,0xe6d,0x47d,0x47d,0x47d,0x47d,
-0xf88,0xf80,0xf8b,0xf93,0x8e0,0xf9b,0x47d,0xfa3,0xfab,0xfb3,0x47d,0x47d,0x5c8,0xfc3,0xfcb,0xfbb,
-0xfdb,0xfe2,0xfd3,0xfea,0xff2,0x47d,0x1002,0xffa,0x5c8,0x1005,0x100d,0x1015,0x101d,0x1025,0x47d,0x47d,
-0x5c8,0x5c8,0x102d,0x47d,0x555,0x1035,0x4fd,0x103d,0x5c8,0x1045,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x104d,0x47d,0x47d,0x47d,0x47d,0x1055,0x105d,0x1064,0x47d,0x47d,0x47d,0x47d,0xb62,
-0x1074,0x5fe,0x107c,0x106c,0x951,0x1084,0x108c,0x1092,0x10aa,0x109a,0x10a2,0x10ae,0x951,0x10be,0x10b6,0x10c6,
-0x10d6,0x10ce,0x47d,0x47d,0x10dd,0x10e5,0x620,0x10ed,0x10fd,0x1103,0x110b,0x10f5,0x47d,0x47d,0x47d,0x47d,
-0x5c8,0x1113,0x111b,0x47d,0x5c8,0x1123,0x112b,0x47d,0x47d,0x47d,0x47d,0x47d,0x5c8,0x1133,0x113b,0x47d,
-0x5c8,0x1143,0x114b,0x1153,0x5c8,0x1163,0x115b,0x47d,0x83a,0x116b,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x5c8,0x1173,0x47d,0x47d,0x47d,0x555,0x4fd,0x117b,0x47d,0x47d,0x47d,0x47d,0x47d,0x118b,0x118f,0x1183,
-0x11a7,0x1197,0x119f,0x5c8,0x11b7,0x11af,0x5c8,0x8c1,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x11cd,0x11d2,0x11bf,0x11c7,0x11e2,0x11da,0x47d,0x47d,0x11f1,0x11f5,0x11e9,0x1205,0x11fd,0x115b,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x1209,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x1219,0x1211,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x8cb,0x47d,0x47d,0x47d,
-0x1229,0x1231,0x1239,0x1221,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x1241,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x1249,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x1251,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x8c1,0x8e0,0x1259,0x47d,0x47d,0xe63,0x1261,0x5c8,0x1269,0x1271,0x1279,0xcd2,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x555,0x4fd,0x1281,0x47d,0x47d,0x47d,0x5c8,0x5c8,0x1289,0x128e,0x1294,0x47d,
-0x47d,0x129c,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x12a4,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x12ac,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x8e0,0x47d,0x12b1,0x12b8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xdfc,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x5c8,0x5c8,0x5c8,0x12be,0x12c3,0x12cb,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0xb91,0x8fe,0x12d3,0x8fe,0x12da,0x12e2,0x12e8,
-0x8fe,0x12ee,0x8fe,0x8fe,0x12f6,0x47d,0x47d,0x47d,0x47d,0x12fe,0x8fe,0x8fe,0xaa5,0x1306,0x47d,0x47d,
-0x47d,0x47d,0x1316,0x131d,0x1322,0x1328,0x1330,0x1338,0x1340,0x131a,0x1348,0x1350,0x1358,0x135d,0x132f,0x1316,
-0x131d,0x1319,0x1328,0x1365,0x1317,0x1368,0x131a,0x1370,0x1378,0x1380,0x1387,0x1373,0x137b,0x1383,0x138a,0x1376,
-0x1392,0x130e,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,
-0x8fe,0x8fe,0x524,0x13a2,0x524,0x13a9,0x13b0,0x139a,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x13b7,0x13bf,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x5c8,0x13cf,0x13c7,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x5c8,0x13d7,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x13df,0x47d,0x555,0x13ef,0x13e7,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x13f7,0x1407,0x13ff,0x47d,0x47d,0x1417,0x140f,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x1427,0x142f,0x1437,0x143f,0x1447,0x144f,0x47d,0x141f,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x8fe,0x1457,0x8fe,0x8fe,0xb89,0x145c,0x1460,0xb91,0x1468,0x8fe,0x8fe,0x146d,0x8fe,0x12ed,
-0x47d,0x1475,0x147d,0x1481,0x1489,0x1491,0x47d,0x47d,0x47d,0x47d,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,
-0x8fe,0x1499,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,
-0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0x8fe,0xb91,0x14a1,0x8fe,0x8fe,0x8fe,0xb89,0x8fe,0x8fe,
-0x14a9,0x14b1,0x1457,0x8fe,0x14b9,0x8fe,0x14c1,0xb93,0x47d,0x47d,0x14c6,0x8fe,0x8fe,0x14ca,0x8fe,0x14d2,
-0x14d8,0x8fe,0x8fe,0x8fe,0xb89,0x14dd,0x14e3,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x14eb,0x5c8,0x5c8,0x14f2,0x5c8,0x5c8,0x5c8,0x14fa,0x5c8,0x1502,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0xc73,0x5c8,0x5c8,0x150a,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x1512,0x151a,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0xcb2,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x1521,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x1528,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x152f,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0xb62,0x47d,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x1533,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0xf51,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x153b,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x1543,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x5c8,0x5c8,0x5c8,0x5c8,0x154b,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,0x5c8,
-0x5c8,0x5c8,0x5c8,0xf51,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x155b,0x1553,0x1553,0x1553,0x47d,0x47d,0x47d,0x47d,0x524,0x524,0x524,0x524,0x524,
-0x524,0x524,0x1563,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,0x47d,
-0x47d,0x47d,0x47d,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,0xe14,
-0xe14,0xe14,0x156b,0x45c,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+static const uint16_t propsTrie_index[3165]={
+0,0x40,0x7f,0xbf,0xff,0x12e,0x16d,0x1ad,0x1e5,0x224,0x250,0x28e,0x2ce,0x2de,0x31e,0x34f,
+0x38c,0x3bc,0x3fa,0x43a,0x44a,0x47b,0x4b2,0x4f2,0x532,0x572,0x5a3,0x5cf,0x60f,0x644,0x65e,0x69e,
+0x6de,0x71e,0x749,0x787,0x7c4,0x803,0x842,0x881,0x8c0,0x8ff,0x93e,0x97d,0x9bd,0x9fb,0xa39,0xa79,
+0xab9,0xaf8,0xb38,0xb78,0xbb8,0xbf7,0xc37,0xc77,0xcb6,0xcf6,0xd35,0xd75,0xdb5,0xdf5,0xe35,0xe73,
+0xeb3,0xef3,0xf31,0xf6b,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0xfab,0xfe2,0x1020,0x104f,0x1074,0x10b4,0x10d4,
+0x1114,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x1127,0x1167,0x1187,0x11c7,0x1207,0x1247,0x1285,
+0x12c5,0x1302,0x1342,0x1372,0x13b2,0x13f2,0x1432,0x1468,0x14a8,0x14d3,0x1513,0x1552,0x1592,0x15d0,0x1610,0x164a,
+0x168a,0x16ca,0x170a,0x174a,0x178a,0x17b6,0x179b,0x17f6,0x1836,0x1836,0x1860,0x1836,0x189f,0x18df,0x191f,0x195e,
+0x199e,0x19dd,0x1a1d,0x1a5d,0x1a9d,0x1add,0x1b1c,0x1b4e,0x1b82,0x1b82,0x1b82,0x1b82,0x1bc2,0x1bed,0x1c2a,0x1c5e,
+0x1c80,0x1cc0,0x1cec,0x1d08,0x1d48,0x1d48,0x1bf2,0x1d87,0x1d48,0x1bfa,0x1d48,0x1d48,0x1d48,0x1dc7,0x1dfd,0x1e3d,
+0x1d48,0x1d48,0x1d48,0x1d48,0x1b82,0x1b82,0x1e7a,0x1ea2,0x1b82,0x1b82,0x1b82,0x1b82,0x1ee2,0x1f1d,0x1f3b,0x1d48,
+0x1f7b,0x1fab,0x1836,0x1fea,0x202a,0x205a,0x209a,0x20ba,0x20fa,0x213a,0x217a,0x2195,0x1d48,0x1d48,0x1d48,0x21b3,
+0x21f3,0x2233,0x225c,0x227d,0x22bd,0x5a3,0x22ee,0x232e,0x236e,0x23a6,0x23e6,0x2426,0x1d48,0x1d48,0x1d48,0x1d48,
+0x2466,0x5a3,0x24a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x24b9,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x24ec,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x1372,0x1d48,0x252c,0x254f,0x2583,0x25c3,0x25f6,0x2606,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x2642,0x267c,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x26bb,0x5a3,0x26fa,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x271f,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x273b,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2775,0x5a3,0x27b0,0x27f0,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2801,0x5a3,0x2840,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x24e7,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x287a,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x28a4,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x28bb,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x28fa,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x290e,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x293b,0x5a3,0x2476,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x296f,0x29a9,0x5a3,0x29e2,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2a19,
+0x12f0,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x2a59,0x2a92,0x5a3,0x5a3,0x5a3,0x5a3,0x2ad2,0x2b12,0x2b52,0x2b72,0x2bb2,0x2be4,0x2c22,0x2c62,
+0x2ca0,0x2ce0,0x2d20,0x2d5c,0x2d9c,0x2dd5,0x2e15,0x2e54,0x2e94,0x2ed4,0x2f12,0x2f52,0x2f91,0x2fc1,0x2ff1,0x3031,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x3071,0x30aa,
+0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,
+0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,0x30ea,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x5a3,0x316a,0x29e6,0x31a3,0x5a3,0x31e1,0x5a3,0x3211,0x3251,0x3291,0x329f,0x32dd,
+0x5a3,0x5a3,0x5a3,0x5a3,0x32f0,0x32e0,0x3330,0x3368,0x33a8,0x33e4,0x5a3,0x341a,0x345a,0x349a,0x34cb,0x350a,
+0xb17,0xb35,0xb52,0xb71,0xb91,0xbaf,0xbc1,0xbde,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,
+0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,
+0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,0xbfc,
+0xbfc,0xbfc,0xbfc,0xbfc,0xc1c,0xbfc,0xbfc,0xbfc,0xc3c,0xc3c,0xc3c,0xc3d,0xc3c,0xc3c,0xc3c,0xc3d,
+0x772,0x5a3,0x777,0x354a,0x50f,0x50f,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x73e,
+0x355a,0x356a,0x357a,0x358a,0x359a,0x35aa,0x35ba,0x35c9,0x35d2,0x1c9b,0x1ca6,0x1552,0x1552,0x1d48,0x1d48,0x35e2,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x510,0x5a3,0x5a3,0x5a3,0x748,0x35f2,0x3602,
+0x5a3,0x5a3,0x3612,0x5a3,0x3621,0x5a3,0x5a3,0x3631,0x5a3,0x3641,0x5a3,0x5a3,0x145a,0x3650,0x1552,0x1552,
+0x41,0x41,0x342,0x2ff1,0x2ff1,0x5a3,0x5a3,0x5a3,0x5a3,0x50f,0xb1e,0x41,0x41,0x3660,0x2ff1,0x3668,
+0x5a3,0x5a3,0x741,0x5a3,0x5a3,0x5a3,0x3678,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x742,0x5a3,0x743,0x741,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x3688,0x5a3,0x5a3,0x3692,0x5a3,0x36a1,0x5a3,0x36b1,0x5a3,0x50e,0x36c1,0x1552,0x1552,0x1552,0x5a3,0x36d1,
+0x5a3,0x36e1,0x5a3,0x36f1,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x3701,0x3561,0x3711,0x3721,0x3731,
+0x3741,0x948,0x5a3,0x3751,0x3761,0x2141,0x5a3,0x3771,0x5a3,0x3781,0x1552,0x1552,0x3791,0x5a3,0x379c,0x2143,
+0x5a3,0x5a3,0x5a3,0x37ac,0x5a3,0x37bc,0x5a3,0x37cc,0x5a3,0x37dc,0x37e9,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x5a3,0x5a3,0x5a3,0x5a3,0x740,0x1552,0x1552,0x1552,0x41,0x41,0x41,0x2c66,0x2ff1,0x2ff1,0x2ff1,0x37f9,
+0x5a3,0x5a3,0x3809,0xb1e,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x109d,0x3819,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x3829,0x3839,0x5a3,0x577,0x3849,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x742,0x2f0f,0x5a3,0x5a3,0x575,0x3859,0x3867,
+0x3877,0x78b,0x7c5,0x5a3,0x5a3,0x3887,0x3895,0x5a3,0x740,0xb1e,0x38a5,0x5a3,0x38ae,0x38bb,0x38cb,0x5a3,
+0x5a3,0x38db,0x7c5,0x5a3,0x5a3,0x38eb,0x38fa,0x390a,0x3560,0x391a,0x5a3,0x94e,0x392a,0x3939,0x1552,0x1552,
+0x1552,0x1552,0x3949,0x770,0x3958,0x5a3,0x5a3,0x630,0x3968,0xb1e,0x3978,0x852,0x775,0x3987,0x3997,0x39a7,
+0x39b5,0x1a89,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x39c5,0x39d5,0x39e5,
+0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x39f5,0x3a04,0xb1e,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x5a3,0x5a3,0xecf,0x3a14,0x3a23,0x3a2b,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x3a3b,0x3a4a,0xb1e,
+0x213d,0x1552,0x5a3,0x5a3,0x3a5a,0x3a6a,0xb1e,0x1552,0x1552,0x1552,0x5a3,0x1084,0x3a7a,0x3a8a,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x392a,0x3a9a,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x41,0x41,0x2ff1,0x2ff1,0x3aaa,0x3aba,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x3207,0x5a3,0x5a3,0x3ac9,0x3ad9,0x1552,0x3ae9,0x5a3,0x5a3,0x3af6,0x3b05,0x3b15,
+0x5a3,0x5a3,0x573,0x3b25,0x2147,0x1552,0x5a3,0x5a3,0x5a3,0x740,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x775,0x5a3,0xecf,0x3b35,0x3b45,0x3b55,
+0x3b65,0x550,0x5a3,0x798,0x3b75,0x3b84,0x1552,0x1552,0x1552,0x1552,0x968,0x5a3,0x5a3,0x3b94,0x3ba3,0xb1e,
+0x3bb3,0x5a3,0x3bbd,0x3bcd,0xb1e,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x5a3,0x3bdd,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x3bed,0x3bfd,0x3c0c,0x3c1a,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x73f,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x3c2a,0x3c3a,0x3c4a,0x3c5a,0x3c6a,0x3c7a,0x3c8a,0x2145,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x745,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x50e,0x3c9a,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x742,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x740,0x5a3,0x50e,
+0x2e64,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x50f,0x3caa,0x5a3,0x5a3,0x5a3,0x3cba,0x3cca,0x3cda,
+0x3cea,0x3cf2,0x5a3,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x41,0x41,0x2ff1,0x2ff1,0x3d02,0x3d12,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0xe17,0x3d22,0x3d23,0x3d23,0x3d2b,0x3d3a,
+0x1552,0x1552,0x1552,0x1552,0x3d48,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x741,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x746,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x50e,0x1552,0x1552,0x1552,0x746,0x3674,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x511,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x73e,0x510,0x740,0x3d58,0x3d68,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1ca1,0x1d48,0x1d48,0x1f4a,
+0x1d48,0x1d48,0x1d48,0x3d78,0x3d85,0x3d92,0x1d48,0x3d9e,0x1d48,0x1d48,0x1d48,0x1c9e,0x1552,0x1d48,0x1d48,0x1d48,
+0x1d48,0x3dac,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x3d02,0x3dbc,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1ca0,0x3561,0x3dcc,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x41,0x3b2,0x2ff1,
+0x3ddc,0x3ae,0x3dec,0x189f,0x41,0xdc,0x3df2,0x3e02,0x3e10,0x3ded,0x41,0x3b2,0x2ff1,0x3e1d,0x3e2a,0x2ff1,
+0x3e38,0x3e48,0x1fa9,0x3e58,0x41,0xd8,0x2ff1,0x41,0x3b2,0x2ff1,0x3ddc,0x3ae,0x2ff1,0x189f,0x41,0xdc,
+0x3e58,0x41,0xd8,0x2ff1,0x41,0x3b2,0x2ff1,0x3e68,0x41,0x3e77,0xeb,0x38a,0x3e87,0x2ff1,0x3e93,0x41,
+0x3e73,0xe7,0x3e81,0xc7,0x2ff1,0xed,0x41,0x3e9f,0x2ff1,0x3eac,0x3ebc,0x3ec2,0x3ebe,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x2ce,0x2ce,0x2ce,
+0x3ed2,0x2ce,0x2ce,0x3edd,0x3eea,0x3ef6,0x78f,0x4c2,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0xe46,0x3f06,0x3f14,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,0x510,
+0x3f24,0x3f34,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x5a3,0x5a3,
+0x633,0x3f44,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x3f54,0x1a87,
+0x1552,0x1552,0x41,0x41,0xdc,0x2ff1,0x3f64,0x2e64,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x3560,0x3570,0x3720,0x3f74,0x3f84,0x1552,0x1552,0x1552,0x1552,0x3560,0x3570,0x3f94,0x3fa4,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0xade,0x5a3,0x3fb3,0x3fc0,0x3fce,
+0x3fde,0x3fec,0x3ff4,0x774,0x511,0x4003,0x511,0x1552,0x1552,0x1552,0x4013,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1d48,0x1d48,0x1c9b,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1d48,0x1d48,0x1ca3,0x1c98,0x1485,0x1485,0x1485,0x1d48,0x1ca1,0x4023,0x1d48,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1c9a,0x1d48,0x1d48,0x1d48,0x1c9a,0x1552,0x1552,0x1552,0x1cba,0x1d48,0x1ca4,0x1d48,0x1d48,0x1c9b,0x1c9e,
+0x1ca5,0x1ca1,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x4033,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1ca1,0x1c9a,0x1c9c,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x1ca3,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1c9e,0x1c9b,0x1552,0x1c9b,0x1d48,0x1d48,0x1d48,0x1c9f,
+0x10c4,0x1d48,0x1d48,0x1c9f,0x1d48,0x1c99,0x1552,0x1552,0x1552,0x1552,0x1552,0x2188,0x1d48,0x1d48,0x1d48,0x1d48,
+0x1d48,0x1d48,0x4043,0x1d48,0x1d48,0x4050,0x1d48,0x1f46,0x1d48,0x1d48,0x1d48,0x1d48,0x1d48,0x1ca3,0x1c99,0x405e,
+0x1ca4,0x1ca1,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x24f8,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2736,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2738,0x5a3,0x5a3,0x5a3,0x246a,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x2762,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x406e,0x407b,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x29a5,0x3188,0x5a3,0x318c,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x24a6,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x25e3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x318a,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x272d,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x742,0x1552,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x744,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x50f,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x747,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x748,0x1552,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x256c,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,
+0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x5a3,0x50f,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x408b,0x1552,0x409b,0x409b,0x409b,0x409b,0x409b,0x409b,0x1552,
+0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x1552,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,
+0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x2ce,0x1552,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,
+0x312a,0x312a,0x312a,0x312a,0x312a,0x312a,0x40ab,0x440,0x460,0x480,0x4a0,0x4c0,0x4e0,0x500,0x51a,0x53a,
+0x55a,0x57a,0x59a,0x5ba,0x5da,0x5fa,0x615,0xee,0x635,0x655,0x66a,0x66a,0x66a,0x66a,0x66a,0xee,
+0xee,0x68a,0x66a,0x66a,0x66a,0x66a,0x66a,0xee,0x6aa,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0xee,0x6ca,0x66a,0x6e6,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0x706,0xee,0x726,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x746,0x75d,0x66a,0x66a,0x66a,0x66a,
+0x77d,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x79d,0x7bd,0x7dd,0x7fd,0x81d,0x83d,0x66a,
+0x66a,0x85d,0x872,0x66a,0x66a,0x892,0x66a,0x8ab,0x8cb,0x8eb,0x90b,0x81d,0x92b,0x94b,0x968,0x66a,
+0x66a,0x988,0xee,0xee,0xee,0x99b,0x9b5,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0x9c7,0xee,0xee,0x9e1,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0x9fb,0xee,
+0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xa15,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xee,0xa28,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xa38,0xa57,0xee,0xee,
+0xee,0xee,0xee,0xee,0xee,0xa6d,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,0xee,
+0xee,0xee,0xee,0xa78,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0xa98,0xab7,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0xad7,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,
+0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x66a,0x380,0x380,0x380,0x380,
+0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,
+0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0x380,0xaf7
+};
+
+static const uint16_t propsTrie_data[16571]={
 0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
-0xf,0xf,0xf,0xf,0xc,0x17,0x17,0x17,0x19,0x17,0x17,0x17,0x14,0x15,0x17,0x18,
-0x17,0x13,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,
-0x18,0x18,0x18,0x17,0x17,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0x14,
-0x17,0x15,0x1a,0x16,0x1a,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0x14,
-0x18,0x15,0x18,0xf,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
 0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
-0xf,0xf,0xf,0xf,0xc,0x17,0x19,0x19,0x19,0x19,0x1b,0x17,0x1a,0x1b,5,0x1c,
-0x18,0x10,0x1b,0x1a,0x1b,0x18,0x34b,0x38b,0x1a,2,0x17,0x17,0x1a,0x30b,5,0x1d,
-0x34cb,0x344b,0x3ccb,0x17,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,0x18,1,1,1,1,
-1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,0x18,2,2,2,2,
-2,2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,2,1,2,1,
-2,1,2,1,2,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,1,2,1,2,1,2,2,2,1,1,2,
-1,2,1,1,2,1,1,1,2,2,1,1,1,1,2,1,
-1,2,1,1,1,2,2,2,1,1,2,1,1,2,1,2,
-1,2,1,1,2,1,2,2,1,2,1,1,2,1,1,1,
-2,1,2,1,1,2,2,5,1,2,2,2,5,5,5,5,
-1,3,2,1,3,2,1,3,2,1,2,1,2,1,2,1,
-2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,2,1,3,2,
-1,2,1,1,1,2,1,2,1,2,1,2,1,2,1,2,
+0xc,0x17,0x17,0x17,0x19,0x17,0x17,0x17,0x14,0x15,0x17,0x18,0x17,0x13,0x17,0x17,
+0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x18,0x18,0x18,0x17,
+0x17,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,0x14,0x17,0x15,0x1a,0x16,
+0x1a,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,0x14,0x18,0x15,0x18,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,
+0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xc,
+0x17,0x19,0x19,0x19,0x19,0x1b,0x17,0x1a,0x1b,5,0x1c,0x18,0x10,0x1b,0x1a,0x1b,
+0x18,0x34b,0x38b,0x1a,2,0x17,0x17,0x1a,0x30b,5,0x1d,0x34cb,0x344b,0x3ccb,0x17,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0x18,1,1,1,1,1,1,1,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0x18,2,2,2,2,2,2,2,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,2,2,2,2,2,2,1,1,
-2,1,1,2,2,1,2,1,1,1,1,2,1,2,1,2,
+1,2,1,2,1,2,1,1,2,1,2,1,2,2,1,1,
+2,1,2,1,1,2,1,1,1,2,2,1,1,1,1,2,
+1,1,2,1,1,1,2,2,2,1,1,2,1,1,2,1,
+2,1,2,1,1,2,1,2,2,1,2,1,1,2,1,1,
+1,2,1,2,1,1,2,2,5,1,2,2,2,5,5,5,
+5,1,3,2,1,3,2,1,3,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,2,1,3,
+2,1,2,1,1,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,2,2,2,2,2,2,1,
+1,2,1,1,2,1,2,1,1,1,1,2,1,2,1,2,
 1,2,1,2,2,2,2,2,2,2,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
 2,2,2,2,5,2,2,2,2,2,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
 4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
-4,4,0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,4,4,4,4,4,
-4,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-4,4,4,4,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,0x1a,4,0x1a,
-0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,4,4,4,4,4,4,4,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,4,
+4,4,4,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,0x1a,4,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-1,2,1,2,4,0x1a,1,2,0,0,4,2,2,2,0x17,1,
-0,0,0,0,0x1a,0x1a,1,0x17,1,1,1,0,1,0,1,1,
-2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,0,1,1,1,1,1,1,1,1,1,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,1,2,2,1,1,1,2,2,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,2,2,2,2,1,2,0x18,1,2,1,1,2,
-2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,1,2,
+1,2,4,0x1a,1,2,0,0,4,2,2,2,0x17,1,0,0,
+0,0,0x1a,0x1a,1,0x17,1,1,1,0,1,0,1,1,2,1,
 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+0,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,2,
+2,1,1,1,2,2,2,1,2,1,2,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,
+2,2,2,1,2,0x18,1,2,1,1,2,2,1,1,1,1,
 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,0x1b,6,6,6,6,6,7,7,1,2,
+2,2,2,2,2,2,2,2,2,2,2,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,0x1b,6,6,6,
+6,6,7,7,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,1,2,1,2,1,2,1,2,1,2,1,
-2,1,2,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,1,2,1,2,1,
+2,1,2,1,2,1,2,1,2,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,0,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
-0,4,0x17,0x17,0x17,0x17,0x17,0x17,2,2,2,2,2,2,2,2,
+1,2,1,2,1,2,1,2,1,2,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,0,0,4,0x17,0x17,0x17,0x17,0x17,0x17,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,0x17,0x13,0,0,0x1b,0x1b,0x19,
-0,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+2,2,2,2,2,2,2,2,2,2,2,0x17,0x13,0,0,0x1b,
+0x1b,0x19,0,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,0x13,6,
-0x17,6,6,0x17,6,6,0x17,6,0,0,0,0,0,0,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,5,
-5,5,5,0x17,0x17,0,0,0,0,0,0,0,0,0,0,0,
-0x10,0x10,0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x17,0x17,0x19,0x17,0x17,0x1b,0x1b,
-6,6,6,6,6,6,6,6,6,6,6,0x17,0x10,0,0x17,0x17,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+0x13,6,0x17,6,6,0x17,6,6,0x17,6,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
+0,5,5,5,5,0x17,0x17,0,0,0,0,0,0,0,0,0,
+0,0,0x10,0x10,0x10,0x10,0x10,0x10,0x18,0x18,0x18,0x17,0x17,0x19,0x17,0x17,
+0x1b,0x1b,6,6,6,6,6,6,6,6,6,6,6,0x17,0x10,0,
+0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-4,5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,
+5,5,4,5,5,5,5,5,5,5,5,5,5,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,5,5,
-6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+6,6,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,
+5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0x17,5,6,6,6,6,6,6,6,0x10,0x1b,6,6,
+6,6,6,6,4,4,6,6,0x1b,6,6,6,6,5,5,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,0x1b,0x1b,5,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0x10,5,
+6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x17,5,6,6,6,6,6,6,6,0x10,0x1b,6,
-6,6,6,6,6,4,4,6,6,0x1b,6,6,6,6,5,5,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,0x1b,0x1b,5,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0x10,
-5,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,0,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,6,6,6,6,6,6,6,6,6,6,6,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x49,0x89,
+0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,6,
+6,6,4,4,0x1b,0x17,0x17,0x17,4,0,0,6,0x19,0x19,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,
-6,6,6,6,6,5,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,
+5,5,5,5,6,6,6,6,4,6,6,6,6,6,6,6,
+6,6,4,6,6,6,4,6,6,6,6,6,0,0,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
-6,6,6,6,6,6,6,6,4,4,0x1b,0x17,0x17,0x17,4,0,
-0,6,0x19,0x19,6,6,6,6,4,6,6,6,4,6,6,6,
-6,6,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,6,6,6,6,4,6,
-6,6,6,6,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,
-0,0,0x17,0,5,5,5,5,5,5,5,5,5,5,5,0,
+5,5,5,5,5,5,5,6,6,6,0,0,0x17,0,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,6,6,0x10,6,6,6,6,6,6,6,6,6,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,
+5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,0x10,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,5,5,5,5,5,5,5,5,5,5,5,5,
+6,6,6,6,6,6,6,8,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,8,
+6,5,8,8,6,6,6,6,6,6,6,6,8,8,8,8,
+6,8,8,5,6,6,6,6,6,6,6,5,5,5,5,5,
+5,5,5,5,5,6,6,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,
+0x209,0x249,0x289,0x17,4,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,6,8,8,0,5,5,5,5,5,5,5,5,0,
+0,5,5,0,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
+5,5,5,0,5,0,0,0,5,5,5,5,0,0,6,5,
+8,8,6,6,6,6,0,0,8,8,0,0,8,8,6,5,
+0,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,
+5,5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,
+0x289,5,5,0x19,0x19,0x37cb,0x35cb,0x3fcb,0x34cb,0x3ccb,0x94b,0x1b,0x19,5,0x17,6,
+0,6,6,8,0,5,5,5,5,5,5,0,0,0,0,5,
+5,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
-5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,6,6,6,6,6,6,6,6,6,
-6,6,6,6,5,5,6,6,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,0x17,4,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,6,6,6,8,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,6,8,6,5,8,8,8,6,6,6,
-6,6,6,6,6,8,8,8,8,6,8,8,5,6,6,6,
-6,6,6,6,5,5,5,5,5,5,5,5,5,5,6,6,
-0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,0x19,0x19,
-0x37cb,0x35cb,0x3fcb,0x34cb,0x3ccb,0x94b,0x1b,0x19,5,0x17,6,0,5,6,8,8,
-0,5,5,5,5,5,5,5,5,0,0,5,5,0,0,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,
-5,5,5,5,5,0,5,0,0,0,5,5,5,5,0,0,
-6,5,8,8,8,6,6,6,6,0,0,8,8,0,0,8,
-8,6,5,0,0,0,0,0,0,0,0,8,0,0,0,0,
-5,5,0,5,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,6,6,5,5,5,6,0x17,0,0,0,0,0,
-0,0,0,0,0,6,6,8,0,5,5,5,5,5,5,0,
-0,0,0,5,5,0,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,5,5,5,5,5,5,5,0,5,5,
-0,5,5,0,5,5,0,0,6,0,8,8,8,6,6,0,
-0,0,0,6,6,0,0,6,6,6,0,0,0,6,0,0,
-0,0,0,0,0,5,5,5,5,0,5,0,5,5,6,6,
-0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x19,0,0,
-0,0,0,0,0,5,6,6,6,6,6,6,0,6,6,8,
-0,5,5,5,5,5,5,5,5,5,0,5,5,5,0,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,
-5,5,5,5,5,0,5,5,0,5,5,5,5,5,0,0,
-6,5,8,8,8,6,6,6,6,6,0,6,6,8,0,8,
-8,6,0,0,5,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,0x1b,5,0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,0,0,0,0,
-0,0,0,0,0,6,8,8,0,5,5,5,5,5,5,5,
-5,0,0,5,5,0,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,5,5,5,5,5,5,5,0,5,5,
-0,5,5,5,5,5,0,0,6,5,8,6,8,6,6,6,
-6,0,0,8,8,0,0,8,8,6,0,0,0,0,0,0,
-0,0,6,8,0,0,0,0,5,5,0,5,0,0,0,0,
-0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0x1e4b,0x784b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x19,0x1b,0,0,0,0,0,0,0,6,5,
-0,5,5,5,5,5,5,0,0,0,5,5,5,0,5,5,
-5,5,0,0,0,5,5,0,5,0,5,5,0,0,0,5,
-5,0,0,0,5,5,5,0,0,0,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,0,8,8,6,8,8,0,
-0,0,8,8,8,0,8,8,8,6,0,0,5,0,0,0,
-0,0,0,8,0,0,0,0,0,0,0,0,5,5,6,6,
-0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,
-0,0,0,0x17,0x54b,0x58b,0x5cb,0x60b,0x58b,0x5cb,0x60b,0x1b,6,8,8,8,
-6,5,5,5,5,5,5,5,5,0,5,5,5,0,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,
+5,0,5,5,0,5,5,0,5,5,0,0,6,0,8,8,
+6,6,0,0,0,0,6,6,0,0,6,6,6,0,0,0,
+6,0,0,0,0,0,0,0,5,5,5,5,0,5,0,0,
+0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,6,
+6,5,5,5,6,0x17,0,0,0,0,0,0,0,0,0,6,
+6,8,0,5,5,5,5,5,5,5,5,5,0,5,5,5,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,
+5,5,0,5,5,5,5,5,0,0,6,5,8,8,6,6,
+6,6,6,0,6,6,8,0,8,8,6,0,0,5,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,6,
+6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x19,0,
+0,0,0,0,0,0,5,6,6,6,6,6,6,0,6,8,
+8,0,5,5,5,5,5,5,5,5,0,0,5,5,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,5,
+5,0,5,5,5,5,5,0,0,6,5,8,6,6,6,6,
+0,0,8,8,0,0,8,8,6,0,0,0,0,0,0,0,
+0,6,8,0,0,0,0,5,5,0,5,5,5,6,6,0,
+0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x1b,5,0x34cb,0x344b,0x3ccb,
+0x37cb,0x35cb,0x3fcb,0,0,0,0,0,0,0,0,6,5,0,5,5,
+5,5,5,5,0,0,0,5,5,5,0,5,5,5,5,0,
+0,0,5,5,0,5,0,5,5,0,0,0,5,5,0,0,
+0,5,5,5,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,0,0,0,0,8,8,6,8,8,0,0,0,8,
+8,8,0,8,8,8,6,0,0,5,0,0,0,0,0,0,
+8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x49,
+0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0x1e4b,0x784b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x19,0x1b,0,0,0,0,0,6,8,8,8,6,5,5,
+5,5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0,0,0,5,6,6,8,8,8,8,0,6,6,
+6,0,6,6,6,6,0,0,0,0,0,0,0,6,6,0,
+5,5,5,0,0,0,0,0,5,5,6,6,0,0,0x49,0x89,
+0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0,0x17,
+0x54b,0x58b,0x5cb,0x60b,0x58b,0x5cb,0x60b,0x1b,5,6,8,8,0x17,5,5,5,
+5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,5,5,5,5,5,5,5,5,5,5,0,5,5,5,
+5,5,0,0,6,5,8,6,8,8,8,8,8,0,6,8,
+8,0,8,8,6,6,0,0,0,0,0,0,0,8,8,0,
+0,0,0,0,0,0,5,0,5,5,6,6,0,0,0x49,0x89,
+0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,5,5,0,0,0,0,0,
+0,0,0,0,0,0,0,0,6,6,8,8,0,5,5,5,
+5,5,5,5,5,0,5,5,5,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,6,6,5,8,8,6,6,6,6,0,8,8,8,
+0,8,8,8,6,5,0x1b,0,0,0,0,5,5,5,8,0xcc0b,
+0xca0b,0xcb4b,0xc90b,0x364b,0xc94b,0x350b,5,5,5,6,6,0,0,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0x1e4b,0x784b,0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,
+0x1b,5,5,5,5,5,5,0,0,8,8,0,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
-0,5,6,6,6,8,8,8,8,0,6,6,6,0,6,6,
-6,6,0,0,0,0,0,0,0,6,6,0,5,5,5,0,
-0,0,0,0,5,5,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,0,5,5,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,6,8,8,0x17,5,5,5,5,5,5,5,
-5,0,5,5,5,0,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,5,5,5,5,5,5,5,5,5,5,
-0,5,5,5,5,5,0,0,6,5,8,6,8,8,8,8,
-8,0,6,8,8,0,8,8,6,6,0,0,0,0,0,0,
-0,8,8,0,0,0,0,0,0,0,5,0,5,5,6,6,
-0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0x1e4b,0x784b,0x34cb,
-0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,0x1b,5,5,5,5,5,5,6,6,8,8,
-0,5,5,5,5,5,5,5,5,0,5,5,5,0,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,6,6,5,8,8,
-8,6,6,6,6,0,8,8,8,0,8,8,8,6,5,0x1b,
-0,0,0,0,5,5,5,8,0xcc0b,0xca0b,0xcb4b,0xc90b,0x364b,0xc94b,0x350b,5,
-0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0,0,8,8,0x17,0,0,0,0,0,0,0,0,0,0,0,
-0,0,8,8,0,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0,0,0,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,
-5,5,5,5,5,5,5,5,0,5,0,0,5,5,5,5,
-5,5,5,0,0,0,6,0,0,0,0,8,8,8,6,6,
-6,0,6,0,8,8,8,8,8,8,8,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,6,5,5,
-6,6,6,6,6,6,6,0,0,0,0,0x19,5,5,5,5,
-5,5,4,6,6,6,6,6,6,6,6,0x17,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0,0,0,0,0,5,5,0,
-5,0,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,5,0,5,
-5,5,5,5,5,5,5,5,5,6,5,5,6,6,6,6,
-6,6,6,6,6,5,0,0,5,5,5,5,5,0,4,0,
-6,6,6,6,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,5,5,5,5,5,0x1b,0x1b,0x1b,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1b,0x17,0x1b,0x1b,0x1b,
-6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x344b,0x3c4b,0x444b,0x4c4b,0x544b,0x5c4b,0x644b,0x6c4b,0x744b,0x2c4b,0x1b,6,0x1b,6,
-0x1b,6,0x14,0x15,0x14,0x15,8,8,5,5,5,5,5,5,5,5,
 0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,0,0,0,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,8,6,6,6,6,
-6,0x17,6,6,5,5,5,5,5,6,6,6,6,6,6,6,
-6,6,6,6,0,6,6,6,6,6,6,6,6,6,6,6,
+5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
+5,5,5,0,5,0,0,5,5,5,5,5,5,5,0,0,
+0,6,0,0,0,0,8,8,8,6,6,6,0,6,0,8,
+8,8,8,8,8,8,8,0,0,0,0,0,0,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,8,8,0x17,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,6,5,5,6,6,6,6,6,6,
+6,0,0,0,0,0x19,5,5,5,5,5,5,4,6,6,6,
+6,6,6,6,6,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
+0x17,0x17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,5,5,0,5,0,5,5,5,5,5,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,5,0,5,5,5,5,
+5,5,5,5,5,5,6,5,5,6,6,6,6,6,6,6,
+6,6,5,0,0,5,5,5,5,5,0,4,0,6,6,6,
+6,6,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,
+0,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,5,0x1b,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1b,0x17,0x1b,0x1b,0x1b,6,6,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x344b,
+0x3c4b,0x444b,0x4c4b,0x544b,0x5c4b,0x644b,0x6c4b,0x744b,0x2c4b,0x1b,6,0x1b,6,0x1b,6,0x14,
+0x15,0x14,0x15,8,8,5,5,5,5,5,5,5,5,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,0,0,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,8,6,6,6,6,6,0x17,6,6,5,5,5,
+5,5,6,6,6,6,6,6,6,6,6,6,6,0,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,
-0x1b,0x17,0x17,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,8,8,6,6,6,6,8,6,6,6,6,6,6,
-8,6,6,8,8,6,6,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x17,0x17,0x17,0x17,0x17,0x17,5,5,5,5,5,5,8,8,
-6,6,5,5,5,5,6,6,6,5,8,8,8,5,5,8,
-8,8,8,8,8,8,5,5,5,6,6,6,6,5,5,5,
-5,5,5,5,5,5,5,5,5,5,6,8,8,6,6,8,
-8,8,8,8,8,6,5,8,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,8,8,8,6,0x1b,0x1b,2,2,2,2,2,2,2,2,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,0x1b,0x17,0x17,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
+6,6,6,6,8,6,6,6,6,6,6,8,6,6,8,8,
+6,6,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,
+0x17,0x17,0x17,5,5,5,5,5,5,8,8,6,6,5,5,5,
+5,6,6,6,5,8,8,8,5,5,8,8,8,8,8,8,
+8,5,5,5,6,6,6,6,5,5,5,5,5,5,5,5,
+5,5,5,6,8,8,6,6,8,8,8,8,8,8,6,5,
+8,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,8,8,8,6,0x1b,
+0x1b,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,0,1,0,0,0,0,0,1,0,0,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,0x17,4,2,2,2,1,1,1,1,1,1,0,1,
-0,0,0,0,0,1,0,0,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,5,5,5,5,5,5,5,5,
-5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,0,
-5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,0x17,4,2,2,2,5,5,5,5,5,
+5,5,5,5,0,5,5,5,5,0,0,5,5,5,5,5,
+5,5,0,5,0,5,5,5,5,0,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0,5,5,5,5,0,0,5,5,5,5,5,5,
 5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,0,0,
-5,5,5,5,5,5,5,0,5,0,5,5,5,5,0,0,
+5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+0,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x30b,0x34b,0x38b,
+0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,
+0x788b,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,
+0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,0,2,2,2,2,
+2,2,0,0,0x13,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,0,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,
-0x16cb,0x194b,0x1bcb,0x1e4b,0x788b,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,
-2,2,2,2,2,2,0,0,0x13,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x1b,0x17,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0xc,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0x14,0x15,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,0x17,0x17,0x17,0x98a,0x9ca,0xa0a,5,5,5,
-5,5,5,5,5,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,5,6,6,
-6,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,
-6,0x17,0x17,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,5,5,5,0,6,6,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-6,6,8,6,6,6,6,6,6,6,8,8,8,8,8,8,
-8,8,6,8,8,6,6,6,6,6,6,6,6,6,6,6,
-0x17,0x17,0x17,4,0x17,0x17,0x17,0x19,5,6,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0x54b,0x58b,0x5cb,0x60b,
-0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,6,5,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x17,0x17,0x17,0x17,
-0x17,0x17,0x13,0x17,0x17,0x17,0x17,6,6,6,0x10,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,5,5,5,4,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
-0,0,0,0,5,5,5,5,5,6,6,5,5,5,5,5,
+5,5,5,5,0x1b,0x17,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0xc,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,
-6,6,6,8,8,8,8,6,6,8,8,8,0,0,0,0,
-8,8,6,8,8,8,8,8,8,6,6,6,0,0,0,0,
-0x1b,0,0,0,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
+5,5,0x14,0x15,0,0,0,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
-5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x17,0x17,0x17,0x98a,0x9ca,0xa0a,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0,5,5,5,5,6,6,6,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,6,6,0x17,0x17,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,6,6,0,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0,5,5,5,0,6,6,0,0,0,0,0,
+0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,6,6,8,6,6,
+6,6,6,6,6,8,8,8,8,8,8,6,8,8,6,6,
+6,6,6,6,6,6,6,6,6,0x17,0x17,0x17,4,0x17,0x17,0x17,
+0x19,5,6,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,
+0,0,0,0,0,0x54b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0,
+0,0,0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x13,0x17,0x17,0x17,0x17,
+6,6,6,0x10,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,
+0,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,4,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+0,0,5,5,5,5,5,6,6,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,6,5,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,6,6,6,8,8,8,8,6,6,8,8,8,0,0,
+0,0,8,8,6,8,8,8,8,8,8,6,6,6,0,0,
+0,0,0x1b,0,0,0,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
+0x249,0x289,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
 0x249,0x289,0x30b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
-6,8,8,6,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,4,
-0x17,0x17,0x17,0x17,0x17,0x17,0,0,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,7,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,6,8,
-6,6,6,6,6,6,6,0,6,8,6,8,8,6,6,6,
-6,6,6,6,6,8,8,8,8,8,8,6,6,6,6,6,
-6,6,6,6,6,0,0,6,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,0x17,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,6,6,6,6,6,6,6,6,6,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,6,6,6,6,8,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,6,8,6,6,6,6,6,8,
-6,8,8,8,8,8,6,8,8,5,5,5,5,5,5,5,
-0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,
-0x17,0x17,0x17,0x17,5,8,6,6,6,6,8,8,6,6,8,6,
-6,6,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,
-5,5,5,5,6,6,8,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,6,8,6,6,8,8,8,6,8,6,
-6,6,8,8,0,0,0,0,0,0,0,0,0x17,0x17,0x17,0x17,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,5,5,5,
+6,8,8,6,0,0,0x17,0x17,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,8,6,8,6,6,6,6,6,
+6,6,0,6,8,6,8,8,6,6,6,6,6,6,6,6,
+8,8,8,8,8,8,6,6,6,6,6,6,6,6,6,6,
+0,0,6,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,
+0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,
+0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,4,0x17,0x17,0x17,0x17,0x17,
+0x17,0,0,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,6,6,6,6,8,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,6,8,6,6,6,6,6,8,6,8,
+8,8,6,8,8,5,5,5,5,5,5,5,0,0,0,0,
+0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,6,6,6,
+6,6,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
+6,6,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,8,6,6,6,6,8,8,6,6,8,6,6,6,5,5,
 0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,5,
-8,8,8,8,8,8,8,8,6,6,6,6,6,6,6,6,
-8,8,6,6,0,0,0,0x17,0x17,0x17,0x17,0x17,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,4,4,4,4,4,4,0x17,0x17,2,2,2,2,
-2,2,2,2,2,0,0,0,0,0,0,0,1,1,1,1,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+6,8,6,6,8,8,8,6,8,6,6,6,8,8,0,0,
+0,0,0,0,0,0,0x17,0x17,0x17,0x17,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,8,8,
+8,8,8,8,8,8,6,6,6,6,6,6,6,6,8,8,
+6,6,0,0,0,0x17,0x17,0x17,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0,0,0,5,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,4,4,4,4,4,4,0x17,0x17,2,2,2,2,2,2,
+2,2,2,0,0,0,0,0,0,0,1,1,1,1,1,1,
 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,0,0,1,1,1,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,6,6,6,0x17,
-6,6,6,6,6,6,6,6,6,6,6,6,6,8,6,6,
-6,6,6,6,6,5,5,5,5,6,5,5,5,5,5,5,
-6,5,5,8,6,6,5,0,0,0,0,0,2,2,2,2,
-2,2,2,2,2,2,2,2,4,4,4,4,4,4,4,4,
-4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
-4,4,4,4,4,4,4,4,4,4,4,2,2,2,2,2,
-2,2,2,2,2,2,2,2,4,2,2,2,2,2,2,2,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,1,1,1,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0,0,0,0,0,0,0,0,6,6,6,0x17,6,6,
+6,6,6,6,6,6,6,6,6,6,6,8,6,6,6,6,
+6,6,6,5,5,5,5,6,5,5,5,5,5,5,6,5,
+5,8,6,6,5,0,0,0,0,0,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,4,4,4,4,4,6,6,6,6,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,2,2,2,2,2,2,2,2,2,2,2,2,2,4,2,
+2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
 6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,0,6,6,6,6,6,1,2,1,2,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+0,6,6,6,6,6,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,2,2,2,2,2,2,2,2,1,2,
 1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,2,2,2,2,2,2,2,2,1,2,2,2,2,2,
-2,2,2,2,1,1,1,1,1,0x1a,0x1a,0x1a,0,0,2,2,
-2,0,2,2,1,1,1,1,3,0x1a,0x1a,0,2,2,2,2,
-2,2,2,2,1,1,1,1,1,1,1,1,2,2,2,2,
-2,2,0,0,1,1,1,1,1,1,0,0,2,2,2,2,
-2,2,2,2,1,1,1,1,1,1,1,1,2,2,2,2,
-2,2,2,2,1,1,1,1,1,1,1,1,2,2,2,2,
-2,2,0,0,1,1,1,1,1,1,0,0,2,2,2,2,
-2,2,2,2,0,1,0,1,0,1,0,1,2,2,2,2,
-2,2,2,2,1,1,1,1,1,1,1,1,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,0,0,2,2,2,2,
-2,2,2,2,3,3,3,3,3,3,3,3,2,2,2,2,
-2,2,2,2,3,3,3,3,3,3,3,3,2,2,2,2,
-2,0,2,2,1,1,1,1,3,0x1a,2,0x1a,0x1a,0x1a,2,2,
-2,0,2,2,1,1,1,1,3,0x1a,0x1a,0x1a,2,2,2,2,
-0,0,2,2,1,1,1,1,0,0x1a,0x1a,0x1a,0x16,0x17,0x17,0x17,
-0x18,0x14,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x18,0x17,
-0x16,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0xc,0x10,0x10,0x10,0x10,
-0x10,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x2cb,4,0,0,
-0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,0x15,4,0xc,0xc,0xc,0xc,
-0xc,0xc,0xc,0xc,0xc,0xc,0xc,0x10,0x10,0x10,0x10,0x10,0x13,0x13,0x13,0x13,
-0x13,0x13,0x17,0x17,0x1c,0x1d,0x14,0x1c,0x1c,0x1d,0x14,0x1c,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0xd,0xe,0x10,0x10,0x10,0x10,0x10,0xc,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x1c,0x1d,0x17,0x17,0x17,0x17,0x16,0x2cb,0x30b,0x34b,0x38b,
-0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,0x15,0,4,4,4,4,
-4,4,4,4,4,4,4,4,4,0,0,0,0x19,0x19,0x19,0x19,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,0,0,1,1,1,1,1,1,0,0,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,0,0,1,1,1,1,1,1,0,0,2,
+2,2,2,2,2,2,2,0,1,0,1,0,1,0,1,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,
+2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,2,
+2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,2,
+2,2,2,2,2,2,2,3,3,3,3,3,3,3,3,2,
+2,2,2,2,0,2,2,1,1,1,1,3,0x1a,2,0x1a,0x1a,
+2,2,2,0,2,2,1,1,1,1,3,0x1a,0x1a,0x1a,2,2,
+2,2,0,0,2,2,1,1,1,1,0,0x1a,0x1a,0x1a,2,2,
+2,2,2,2,2,2,1,1,1,1,1,0x1a,0x1a,0x1a,0,0,
+2,2,2,0,2,2,1,1,1,1,3,0x1a,0x1a,0,0xc,0xc,
+0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0xc,0x10,0x10,0x10,0x10,0x10,0x13,0x13,
+0x13,0x13,0x13,0x13,0x17,0x17,0x1c,0x1d,0x14,0x1c,0x1c,0x1d,0x14,0x1c,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0xd,0xe,0x10,0x10,0x10,0x10,0x10,0xc,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x1c,0x1d,0x17,0x17,0x17,0x17,0x16,0x17,0x17,
+0x17,0x18,0x14,0x15,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x18,
+0x17,0x16,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0xc,0x10,0x10,0x10,
+0x10,0x10,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x2cb,4,0,
+0,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,0x15,4,0x2cb,0x30b,0x34b,
+0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x18,0x18,0x18,0x14,0x15,0,4,4,4,
+4,4,4,4,4,4,4,4,4,4,0,0,0,0x19,0x19,0x19,
 0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,
-0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,6,6,6,6,
-6,6,6,6,6,6,6,6,6,7,7,7,7,6,7,7,
-7,6,6,6,6,6,6,6,6,6,6,6,6,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,
-1,0x1b,1,0x1b,1,0x1b,1,1,1,1,0x1b,2,1,1,1,1,
-2,5,5,5,5,2,0x1b,0x1b,2,2,1,1,0x18,0x18,0x18,0x18,
-0x18,1,2,2,2,2,0x1b,0x18,0x1b,0x1b,2,0x1b,0x358b,0x360b,0x364b,0x348b,
-0x388b,0x350b,0x390b,0x3d0b,0x410b,0x354b,0x454b,0x35cb,0x3dcb,0x45cb,0x4dcb,0x58b,0x1b,0x1b,1,0x1b,
-0x1b,0x1b,0x1b,1,0x1b,0x1b,2,1,1,1,2,2,1,1,1,2,
-0x1b,1,0x1b,0x1b,0x18,1,1,1,1,1,0x1b,0x1b,0x58a,0x5ca,0x60a,0x64a,
-0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,0x784a,0x58a,0x5ca,0x60a,0x64a,
-0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,0x784a,0x784a,0x984a,0x788a,1,
+0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0x19,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,6,6,6,
+6,6,6,6,6,6,6,6,6,6,7,7,7,7,6,7,
+7,7,6,6,6,6,6,6,6,6,6,6,6,6,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,1,
+0x1b,0x1b,0x1b,0x1b,1,0x1b,0x1b,2,1,1,1,2,2,1,1,1,
+2,0x1b,1,0x1b,0x1b,0x18,1,1,1,1,1,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,1,0x1b,1,0x1b,1,0x1b,1,1,1,1,0x1b,2,1,1,1,
+1,2,5,5,5,5,2,0x1b,0x1b,2,2,1,1,0x18,0x18,0x18,
+0x18,0x18,1,2,2,2,2,0x1b,0x18,0x1b,0x1b,2,0x1b,0x358b,0x360b,0x364b,
+0x348b,0x388b,0x350b,0x390b,0x3d0b,0x410b,0x354b,0x454b,0x35cb,0x3dcb,0x45cb,0x4dcb,0x58b,0x58a,0x5ca,0x60a,
+0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,0x784a,0x58a,0x5ca,0x60a,
+0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x7ca,0x80a,0x84a,0x11ca,0x1e4a,0x980a,0x784a,0x984a,0x788a,1,
 2,0x6ca,0x11ca,0x988a,0x78ca,0x54b,0x1b,0x1b,0,0,0,0,0x18,0x18,0x18,0x18,
-0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x18,0x1b,0x1b,0x18,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x18,0x1b,
-0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x14,0x15,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x18,
+0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x18,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x14,0x15,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,0x15,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x2cb,0x80b,
-0x84b,0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,
-0x4cb,0x50b,0x7cb,0x2cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x80b,0x84b,
-0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,
-0x50b,0x7cb,0x80b,0x84b,0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x1b,0x1b,0x1b,0x1b,
+0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x80b,0x84b,0x88b,0x8cb,0x90b,0x94b,
+0x98b,0x9cb,0xa0b,0xa4b,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x80b,0x84b,
+0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x2cb,0x80b,0x84b,0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0xa4b,0x30b,0x34b,0x38b,
+0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x2cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x30b,0x34b,
-0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,
-0x50b,0x7cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x18,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x14,
+0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x30b,0x34b,0x38b,
+0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,
+0x7cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,
+0x18,0x18,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x14,0x15,
-0x14,0x15,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
-0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x18,0x18,0x18,
+0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,
+0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
+0x15,0x14,0x15,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x18,0x18,0x18,0x18,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x14,0x15,0x18,0x18,
 0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,0x18,0x18,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x18,
-0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0x1b,0x1b,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x14,0x15,
+0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+0x18,0x18,0x1b,0x1b,0x18,0x18,0x18,0x18,0x18,0x18,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,0,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,0,1,2,1,1,1,
+2,2,1,2,1,2,1,2,1,1,1,1,2,1,2,2,
+1,2,2,2,2,2,2,4,4,1,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,2,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,1,2,1,2,6,6,6,1,2,0,0,
+0,0,0,0x17,0x17,0x17,0x17,0x344b,0x17,0x17,2,2,2,2,2,2,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-1,2,1,1,1,2,2,1,2,1,2,1,2,1,1,1,
-1,2,1,2,2,1,2,2,2,2,2,2,4,4,1,1,
-1,2,1,2,2,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,1,2,1,2,6,
-6,6,1,2,0,0,0,0,0,0x17,0x17,0x17,0x17,0x344b,0x17,0x17,
-2,2,2,2,2,2,0,2,0,0,0,0,0,2,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0,0,0,0,0,0,0,4,0x17,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,6,5,5,5,5,5,5,5,0,
-5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,
-5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-0,0,0,0,0,0,0,0,0x17,0x17,0x1c,0x1d,0x1c,0x1d,0x17,0x17,
-0x17,0x1c,0x1d,0x17,0x1c,0x1d,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x13,
-0x17,0x17,0x13,0x17,0x1c,0x1d,0x17,0x17,0x1c,0x1d,0x14,0x15,0x14,0x15,0x14,0x15,
-0x14,0x15,0x17,0x17,0x17,0x17,0x17,4,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x13,0x13,0x17,0x17,0x17,0x17,0x13,0x17,0x14,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0,2,0,0,0,0,0,2,0,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,0,0,0,0,0,4,0x17,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,6,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,0,5,5,5,5,5,5,5,0,5,5,5,5,5,5,
+5,0,5,5,5,5,5,5,5,0,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,0x17,0x17,0x1c,0x1d,0x1c,0x1d,
+0x17,0x17,0x17,0x1c,0x1d,0x17,0x1c,0x1d,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x13,0x17,0x17,0x13,0x17,0x1c,0x1d,0x17,0x17,0x1c,0x1d,0x14,0x15,0x14,0x15,
+0x14,0x15,0x14,0x15,0x17,0x17,0x17,0x17,0x17,4,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x13,0x13,0x17,0x17,0x17,0x17,0x13,0x17,0x14,0x17,0x17,0x17,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0x1b,0x58a,0x5ca,0x60a,
-0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,6,6,6,6,8,8,0x13,4,4,4,
-4,4,0x1b,0x1b,0x7ca,0xa4a,0xcca,4,5,0x17,0x1b,0x1b,0xc,0x17,0x17,0x17,
-0x1b,4,5,0x54a,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x1b,0x1b,
-0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x13,0x14,0x15,0x15,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,0,6,6,0x1a,0x1a,4,4,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0x17,4,4,4,5,0,0,0,0,
-0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-0x1b,0x1b,0x58b,0x5cb,0x60b,0x64b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,
+0,0,0,0xc,0x17,0x17,0x17,0x1b,4,5,0x54a,0x14,0x15,0x14,0x15,0x14,
+0x15,0x14,0x15,0x14,0x15,0x1b,0x1b,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x13,
+0x14,0x15,0x15,0x1b,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,6,6,6,
+6,8,8,0x13,4,4,4,4,4,0x1b,0x1b,0x7ca,0xa4a,0xcca,4,5,
+0x17,0x1b,0x1b,0,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
-0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0,0,6,6,0x1a,0x1a,4,4,5,0x13,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0x17,4,4,4,5,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,0,0x1b,0x1b,
+0x58b,0x5cb,0x60b,0x64b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0,0,0,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,0,0,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x58b,0x5cb,
+0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x7cb,0xa4b,
+0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1b,0xa8b,0xacb,0xb0b,0xb4b,0xb8b,0xbcb,0xc0b,0xc4b,0xc8b,
+0xccb,0xd0b,0xd4b,0xd8b,0xdcb,0xe0b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xe4b,0xe8b,0xecb,0xf0b,0xf4b,0xf8b,0xfcb,0x100b,0x104b,
+0x108b,0x10cb,0x110b,0x114b,0x118b,0x11cb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1b,0xa8b,0xacb,0xb0b,0xb4b,0xb8b,0xbcb,0xc0b,
-0xc4b,0xc8b,0xccb,0xd0b,0xd4b,0xd8b,0xdcb,0xe0b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0xe4b,0xe8b,0xecb,0xf0b,0xf4b,0xf8b,0xfcb,
-0x100b,0x104b,0x108b,0x10cb,0x110b,0x114b,0x118b,0x11cb,5,5,5,5,5,0x685,5,5,
+0x1b,0x1b,0x1b,0x1b,0x1b,0,5,5,5,5,5,0x685,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0x5c5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x685,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x705,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0x585,5,5,0x705,5,5,5,0x7885,5,0x605,5,5,
+5,5,5,5,5,5,0x5c5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0x785,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x5c5,5,5,5,
-5,5,5,5,0x685,5,0x645,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0x7985,0x7c5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0x7845,5,5,5,5,5,5,5,5,
-0x605,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x685,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x1e45,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x7985,5,5,5,
+5,5,5,0x685,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0x705,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x7a85,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0x585,5,5,0x705,
+5,5,5,0x7885,5,0x605,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0x785,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x5c5,
+5,5,5,5,5,5,5,0x685,5,0x645,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x7985,0x7c5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x7845,5,5,5,5,5,5,5,5,0x605,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,0x685,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0x1e45,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0x7985,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x7a85,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,0x5c5,5,0x745,5,0x6c5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0x7c5,5,0x7845,
-0xa45,0xcc5,5,5,5,5,5,5,0xf45,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0x605,0x605,0x605,
-0x605,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x645,
+5,5,5,5,5,5,5,5,5,5,5,5,0x7c5,5,0x7845,0xa45,
+0xcc5,5,5,5,5,5,5,0xf45,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x585,5,5,5,5,5,5,5,0x585,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0x585,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0x605,0x605,0x605,0x605,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0x785,0xa45,5,5,5,5,5,5,5,5,
-5,5,5,5,0x585,0x5c5,0x605,5,0x5c5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x7c5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x745,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x705,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x785,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0x645,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x1e45,5,5,5,5,5,
-5,5,0x645,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x7885,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x5c5,5,5,5,5,0x5c5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0x5c5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x7845,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,0x585,5,5,5,
+5,5,5,5,0x585,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x6c5,5,5,5,5,5,
-0x1e45,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x6c5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0x545,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,4,5,5,
-5,5,5,5,5,5,5,5,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,4,0x17,0x17,0x17,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,2,1,2,1,2,4,4,6,6,1,2,1,2,
-1,2,1,2,1,2,1,2,1,2,5,6,7,7,7,0x17,
-6,6,6,6,6,6,6,6,6,6,0x17,4,5,5,5,5,
-5,5,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x54a,6,6,0x17,0x17,
-0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,0x1a,0x1a,0x1a,0x1a,
-0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-0x1a,0x1a,0x1a,4,4,4,4,4,4,4,4,4,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,5,4,4,2,5,5,5,5,5,0x1a,0x1a,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,2,2,1,2,
-1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
-4,2,2,2,2,2,2,2,2,1,2,1,2,1,1,2,
-1,2,1,2,1,2,1,2,4,0x1a,0x1a,1,2,1,2,5,
-1,2,1,2,2,2,1,2,1,2,1,2,1,2,1,2,
-1,2,1,1,1,1,1,2,1,1,1,1,1,2,1,2,
-1,2,1,2,1,2,1,2,0,0,1,2,1,1,1,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,5,5,6,5,5,5,6,5,
-5,5,5,6,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,6,6,8,
-0x1b,0x1b,0x1b,0x1b,0,0,0,0,0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,0x1b,0x1b,
-0x19,0x1b,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x17,0x17,0x17,0x17,
-0,0,0,0,0,0,0,0,8,8,8,8,6,6,0,0,
-0,0,0,0,0,0,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,8,8,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,8,8,8,8,8,8,
-8,8,8,8,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,5,5,5,5,5,5,0x17,0x17,0x17,5,
-0x17,5,5,6,5,5,5,5,5,5,6,6,6,6,6,6,
-6,6,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,
-6,6,8,8,0,0,0,0,0,0,0,0,0,0,0,0x17,
-8,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,4,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0x17,0x17,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,6,8,8,6,6,6,6,8,8,6,8,8,8,
-5,5,5,5,5,6,4,5,5,5,5,5,5,5,5,5,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,0,
-5,5,5,5,5,5,5,5,5,6,6,6,6,6,6,8,
-8,6,6,8,8,6,6,0,0,0,0,0,0,0,0,0,
-5,5,5,6,5,5,5,5,5,5,5,5,6,8,0,0,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0x17,0x17,0x17,0x17,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-4,5,5,5,5,5,5,0x1b,0x1b,0x1b,5,8,6,8,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-6,5,6,6,6,5,5,6,6,5,5,5,5,5,6,6,
-5,6,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,5,5,4,0x17,0x17,
-5,5,5,5,5,5,5,5,5,5,5,8,6,6,8,8,
-0x17,0x17,5,4,4,8,6,0,0,0,0,0,0,0,0,0,
-0,5,5,5,5,5,5,0,0,5,5,5,5,5,5,0,
-0,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
-5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,0,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,0x1a,4,4,4,4,
-2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-5,5,5,8,8,6,8,8,6,8,8,0x17,8,6,0,0,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,
-5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x585,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
-5,5,5,5,5,5,5,0,0,0,0,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
-0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
-0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
-0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
-5,5,5,5,5,5,5,5,5,5,5,0x605,5,5,5,5,
-5,5,5,0x7c5,5,5,5,5,0x5c5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0x6c5,5,0x6c5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0x7c5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x785,0xa45,
+5,5,5,5,5,5,5,5,5,5,5,5,0x585,0x5c5,0x605,5,
+0x5c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x18,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-5,5,5,5,5,0,5,0,5,5,0,5,5,0,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,2,2,2,2,2,2,2,0,
-0,0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,
-0,0,0,0,0,5,6,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
-0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x7c5,
+5,5,5,5,5,5,5,5,5,5,5,5,0x745,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x15,0x14,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,0,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-0x19,0x1b,0,0,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x14,0x15,0x17,0,0,
-0,0,0,0,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,0x17,0x13,0x13,0x16,0x16,0x14,0x15,0x14,0x15,0x14,0x15,0x14,
-0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x14,0x15,0x17,0x17,0x17,0x17,0x16,0x16,0x16,
-0x17,0x17,0x17,0,0x17,0x17,0x17,0x17,0x13,0x14,0x15,0x14,0x15,0x14,0x15,0x17,
-0x17,0x17,0x18,0x13,0x18,0x18,0x18,0,0x17,0x19,0x17,0x17,0,0,0,0,
-5,5,5,5,5,0,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,0,0x10,0,0,5,5,5,5,5,5,
-0,0,5,5,5,5,5,5,0,0,5,5,5,5,5,5,
-0,0,5,5,5,0,0,0,0x19,0x19,0x18,0x1a,0x1b,0x19,0x19,0,
-0x1b,0x18,0x18,0x18,0x18,0x1b,0x1b,0,0,0,0,0,0,0,0,0,
-0,0x10,0x10,0x10,0x1b,0x1b,0,0,0,0x17,0x17,0x17,0x19,0x17,0x17,0x17,
-0x14,0x15,0x17,0x18,0x17,0x13,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0x17,0x17,0x18,0x18,0x18,0x17,0x1a,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,0x14,0x18,0x15,0x18,0x14,0x15,0x17,0x14,0x15,0x17,0x17,5,5,
-5,5,5,5,5,5,5,5,4,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,4,4,5,5,5,5,
-5,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,5,5,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,0x984b,0xa04b,
-0xa84b,0xb04b,0xb84b,0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0,0,0,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x17,0x17,0x17,0,0,0,0,0x58b,
-0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,
-0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0x7ca,0x7ca,0x7ca,0x7ca,0x7ca,0xcca,0x11ca,0x11ca,
-0x11ca,0x11ca,0x1e4a,0x880a,0x980a,0x980a,0x980a,0x980a,0x980a,0x784a,0x984a,0x68a,0x11ca,0x344b,0x344b,0x388b,
-0x3ccb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x54b,0x34cb,
-0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0,0,0,0,0x34ca,0x344a,0x58a,0x68a,0x11ca,0x980a,0x984a,0x988a,0x68a,0x7ca,0x11ca,0x1e4a,
-0x980a,0x784a,0x984a,0x68a,0x7ca,0x11ca,0x1e4a,0x980a,0x784a,0x788a,0x988a,0x7ca,0x58a,0x58a,0x58a,0x5ca,
-0x5ca,0x5ca,0x5ca,0x68a,0x1b,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,6,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,6,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,
-0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,
-0,0,0,0,0x58b,0x68b,0x7cb,0x11cb,0,0,0,0,0,0,0,0,
-0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x1bca,5,5,5,5,5,5,5,5,0xb80a,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,6,6,6,6,6,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
+0x705,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0x17,5,5,5,5,0,0,0,0,5,5,5,5,
-5,5,5,5,0x17,0x58a,0x5ca,0x7ca,0xa4a,0x1e4a,0,0,0,0,0,0,
-0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
-0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,0,0,0,0,2,2,2,2,
-2,2,2,2,5,5,5,5,5,5,5,5,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,0x17,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,5,0x785,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,5,5,0,0,0,5,0,0,5,
-5,5,5,5,5,5,0,0,5,0,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0x17,0x58b,0x5cb,0x60b,0x7cb,0xa4b,0x1e4b,0x784b,0x788b,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0x1b,0x1b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x7cb,0xa4b,0,0,0,0,
-0,0,0,0x58b,0x5cb,0x60b,0x64b,0x64b,0x68b,0x7cb,0xa4b,0x1e4b,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
-5,5,0,0,0,0,0,0x58b,0x68b,0x7cb,0xa4b,0x1e4b,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0x1e45,5,5,5,5,5,5,
+0x645,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x58b,0x7cb,0xa4b,0x1e4b,0x5cb,0x60b,0,0,0,0x17,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,0,0,0x17,0xa04b,0xa84b,0xb04b,0xb84b,
-0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0x78cb,0x80cb,0x88cb,0x90cb,0x98cb,0xa0cb,0xa8cb,
-0xb0cb,0xb8cb,0x36cb,0x354b,0x34cb,0x348b,0x46cb,0x344b,0x4ecb,0x388b,0x3ccb,0x454b,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0x7885,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0,0,0,0,0x5ecb,0x344b,5,5,0x58b,0x5cb,0x60b,0x64b,
-0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0,0,0x1e4b,0x800b,
-0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,0x984b,0x30b,0x34b,0x38b,0x3cb,
-0x7cb,0xa4b,0x1e4b,0x784b,0x344b,0,0,0,0,0,0,0,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,5,6,6,6,
-0,6,6,0,0,0,0,0,6,6,6,6,5,5,5,5,
-0,5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,
-6,6,6,0,0,0,0,6,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x58b,0x11cb,0x17,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0x5c5,5,5,5,5,0x5c5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x58b,0x7cb,0xa4b,5,5,5,5,5,6,6,0,
-0,0,0,0x58b,0x68b,0x7cb,0xa4b,0x1e4b,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-0x1b,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0,0,0,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0,0,0x58b,0x5cb,0x60b,0x64b,
-0x7cb,0xa4b,0x1e4b,0x784b,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,0,0,0,0,0,0x58b,0x5cb,0x60b,0x64b,
-0x7cb,0xa4b,0x1e4b,0x784b,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,0,0,0,0,0,0,0,0x17,0x17,0x17,
-0x17,0,0,0,0,0,0,0,0,0,0,0,0,0x58b,0x5cb,0x60b,
-0x64b,0x7cb,0xa4b,0x1e4b,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,0,0,0,0,0,0,0,0x58b,0x68b,
-0x7cb,0x11cb,0x1e4b,0x784b,5,5,5,5,6,6,6,6,0,0,0,0,
-0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
-0,0,0,0,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0xa4b,0xccb,
-0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x344b,
-0x34cb,0x348b,0x388b,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x58b,0x5cb,0x60b,0x64b,0x68b,0x7cb,0xa4b,0xccb,0x1e4b,0x344b,5,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,
-6,0x58b,0x7cb,0xa4b,0x1e4b,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,
-0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x784b,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,
-8,6,8,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-6,6,6,6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,
-0,0,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-8,8,8,6,6,6,6,8,8,6,6,0x17,0x17,0x10,0x17,0x17,
-0x17,0x17,0,0,0,0,0,0,0,0,0,0,0,0x10,0,0,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,0,0,0,0,0,0,5,5,5,5,5,5,5,6,
-6,6,6,6,8,6,6,6,6,6,6,6,6,0,0x49,0x89,
-0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,5,8,8,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,6,6,6,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,6,0x17,0x17,5,0,
-0,0,0,0,0,0,0,0,8,5,5,5,5,0x17,0x17,0x17,
-0x17,6,6,6,6,0x17,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,
-0x249,0x289,5,0x17,5,0x17,0x17,0x17,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,8,6,6,
-6,6,6,6,6,6,6,8,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,
-0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x784b,0,0,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,8,6,6,6,8,8,6,8,6,6,
-0x17,0x17,0x17,0x17,0x17,0x17,6,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0,5,0,5,5,
-5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,5,5,5,5,5,5,5,5,5,5,0x17,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,8,8,8,6,6,6,6,6,6,6,6,0,
-0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
-0,0,0,0,5,5,8,8,0,0,6,6,6,6,6,6,
-6,0,0,0,6,6,6,6,6,0,0,0,0,0,0,0,
-0,0,0,0,6,6,8,8,0,5,5,5,5,5,5,5,
-5,0,0,5,5,0,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,5,5,5,5,5,5,5,0,5,5,
-0,5,5,5,5,5,0,6,6,5,8,8,6,8,8,8,
-8,0,0,8,8,0,0,8,8,8,0,0,5,0,0,0,
-0,0,0,8,0,0,0,0,0,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,8,8,8,6,6,6,6,6,6,6,6,8,8,6,6,
-6,8,6,5,5,5,5,0x17,0x17,0x17,0x17,0x17,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0x17,0,0x17,6,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,6,
-6,6,6,6,6,8,6,8,8,8,8,6,6,8,6,6,
-5,5,0x17,5,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,8,8,8,6,6,
-6,6,0,0,8,8,8,8,6,6,8,6,6,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,5,5,5,5,6,6,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,8,8,8,6,
-6,6,6,6,6,6,6,8,8,6,8,6,6,0x17,0x17,0x17,
-5,0,0,0,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,6,8,6,8,8,6,6,6,6,
-6,6,8,6,5,0,0,0,0,0,0,0,8,8,6,6,
-6,6,8,6,6,6,6,6,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0xa4b,0x17,0x17,0x17,0x1b,5,5,5,5,
-5,5,5,5,5,5,5,5,8,8,8,6,6,6,6,6,
-6,6,6,6,8,6,6,0x17,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0,
-0,0,0,0,0,0,0,0,0,0,0,5,6,5,0x17,5,
-8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,0,0,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,8,6,8,
-6,6,6,6,0,0,6,6,8,8,8,8,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
-6,6,6,6,6,8,5,6,6,6,6,0x17,0x17,0x17,0x17,0x17,
-0x17,0x17,0x17,6,0,0,0,0,0,0,0,0,5,6,6,6,
-6,6,6,8,8,6,6,6,5,5,5,5,5,6,6,6,
-6,6,6,6,6,6,6,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x17,0x17,0x17,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,6,6,6,6,6,6,6,6,6,6,
-6,6,6,8,6,6,0x17,0x17,0x17,5,0x17,0x17,5,0x17,0x17,0x17,
-0x17,0x17,0,0,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,
-0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0,0,0,0x17,0x17,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,8,6,6,6,6,6,6,6,0,
-6,6,6,6,6,6,8,6,6,6,6,6,6,6,6,6,
-0,8,6,6,6,6,6,6,6,8,6,6,8,6,6,0,
-0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,5,6,0,0,0,0,
-0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
-0,0,0,0,5,5,5,5,5,5,5,0,5,5,0,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,6,6,6,6,6,6,0,0,0,6,0,
-6,6,0,6,5,5,5,5,5,5,5,5,5,5,8,8,
-8,8,8,0,6,6,0,8,8,6,8,6,5,0,0,0,
-0,0,0,0,5,5,5,5,5,5,0,5,5,0,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,6,6,8,8,0x17,0x17,0,0,0,
-0,0,0,0,0x19,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0x17,0xcd0b,0xcc0b,0xcb0b,0xd00b,0xca0b,0xcf0b,0xcb4b,0xd04b,0xc90b,0x37cb,0x37cb,0x364b,
-0x35cb,0xc94b,0x3fcb,0x350b,0x34cb,0x344b,0x344b,0x3ccb,0xcd0b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x19,0x19,0x19,0x34ca,0x354a,0x34ca,0x34ca,0x344a,0x348a,0x388a,0xf4a,0x11ca,0x64a,0x68a,0x6ca,
-0x70a,0x74a,0x78a,0,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,
-0,0,0,0,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x60a,0x64a,0x68a,0x6ca,
-0x70a,0x74a,0x78a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,
-0x74a,0x78a,0x58a,0x5ca,0x60a,0x64a,0x68a,0x5ca,0x60a,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,
-0x58a,0x5ca,0x60a,0x60a,0x64a,0x68a,0xc08a,0xc18a,0x58a,0x5ca,0x60a,0x60a,0x64a,0x68a,0x60a,0x60a,
-0x64a,0x64a,0x64a,0x64a,0x6ca,0x70a,0x70a,0x70a,0x74a,0x74a,0x78a,0x78a,0x78a,0x78a,0x5ca,0x60a,
-0x64a,0x68a,0x6ca,0x58a,0x5ca,0x60a,0x64a,0x64a,0x68a,0x68a,0x5ca,0x60a,0x58a,0x5ca,0x348a,0x388a,
-0x454a,0x348a,0x388a,0x35ca,5,5,5,5,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
-0,0,0x17,0x17,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0,0,6,6,6,6,6,0x17,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,6,6,6,6,6,6,6,0x17,0x17,0x17,0x17,0x17,
-0x1b,0x1b,0x1b,0x1b,4,4,4,4,0x17,0x1b,0,0,0,0,0,0,
-0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0x7cb,
-0x1e4b,0x788b,0x790b,0x798b,0x7a0b,0x7a8b,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,
-0,5,5,5,0x54b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0x80b,
-0x84b,0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0x58b,0x5cb,0x60b,0x17,0x17,0x17,0x17,0,
-0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,0,
-0,0,0,6,5,8,8,8,8,8,8,8,8,8,8,8,
-8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
-8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,6,
-6,6,6,4,4,4,4,4,4,4,4,4,4,4,4,4,
-4,4,0x17,4,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0x7845,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x6c5,
+5,5,5,5,5,0x1e45,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,0,0,0,0,0,0,0,0,0,
-0,0,0,0,5,5,5,5,0,0,0,0,0,0,0,0,
+5,0x6c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,0,0,0,0,0,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,0,0,0x1b,6,6,0x17,0x10,0x10,0x10,0x10,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,8,8,6,
-6,6,0x1b,0x1b,0x1b,8,8,8,8,8,8,0x10,0x10,0x10,0x10,0x10,
-0x10,0x10,0x10,6,6,6,6,6,6,6,6,0x1b,0x1b,6,6,6,
-6,6,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,6,6,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1b,0x1b,6,6,6,0x1b,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x54b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,
-0x74b,0x78b,0x7cb,0x80b,0x84b,0x88b,0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0,0,0,0,
-0,0,0,0,0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,
-0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x58b,0x5cb,0x60b,0x64b,0x68b,0x58b,
-0x68b,0,0,0,0,0,0,0,0x249,0x289,0x49,0x89,0xc9,0x109,0x149,0x189,
-0x1c9,0x209,0x249,0x289,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x49,0x89,
-0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,2,2,2,2,2,2,2,0,2,2,
-2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,1,0,1,1,
-0,0,1,0,0,1,1,0,0,1,1,1,1,0,1,1,
-1,1,1,1,1,1,2,2,2,2,0,2,0,2,2,2,
-2,2,2,2,0,2,2,2,2,2,2,2,2,2,2,2,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-2,2,2,2,1,1,0,1,1,1,1,0,0,1,1,1,
-1,1,1,1,1,0,1,1,1,1,1,1,1,0,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,1,1,0,1,1,1,1,0,
-1,1,1,1,1,0,1,0,0,0,1,1,1,1,1,1,
-1,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-2,2,2,2,2,2,0,0,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,0x18,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,0x18,2,2,2,2,
-2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,1,1,1,0x18,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,0x18,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
-1,1,1,1,1,1,1,1,2,2,2,0x18,2,2,2,2,
-2,2,1,2,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,
-0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,0x1b,
-0x1b,0x1b,0x1b,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x17,0x17,0x17,0x17,0x17,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,
-6,6,6,0,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,0,0,6,6,6,6,6,6,6,0,6,
-6,0,6,6,6,6,6,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,5,5,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0,0,0,6,6,6,6,
-6,6,6,4,4,4,4,4,4,4,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,6,6,6,6,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0x19,5,5,5,5,
-5,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,6,6,6,6,
-6,6,6,0,0,0,0,0,0,0,0,0,2,2,2,2,
-6,6,6,6,6,6,6,4,0,0,0,0,0x49,0x89,0xc9,0x109,
-0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0x17,0x17,1,1,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
-2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0x58b,0x5cb,0x60b,
-0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x78cb,0x794b,0x814b,0x58b,
-0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x1b,0x34cb,0x344b,0x3ccb,0x19,0x58b,0x5cb,0x788b,
-0x78cb,0,0,0,0,0,0,0,0,0,0,0,0x16cb,0x194b,0x1bcb,0x1e4b,
-0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,0x984b,0xa04b,0xa84b,0xb04b,
-0xb84b,0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0x78cb,0x80cb,0x984b,0xa04b,0xa84b,0xb04b,
-0xb84b,0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0x1b,0x5cb,0x60b,0x64b,0x68b,0x6cb,
-0x70b,0x74b,0x78b,0x7cb,0x900b,0xa00b,0x804b,0x788b,0x344b,0x354b,0,0,0,0x58b,0x5cb,0x60b,
-0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,
-0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x18,0x18,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0,5,5,0,
-5,0,0,5,0,5,5,5,5,5,5,5,5,5,5,0,
-5,5,5,5,0,5,0,5,0,0,0,0,0,0,5,0,
-0,0,0,5,0,5,0,5,0,5,5,5,0,5,5,0,
-5,0,0,5,0,5,0,5,0,5,0,5,0,5,5,0,
-5,0,0,5,5,5,5,0,5,5,5,5,5,5,5,0,
-5,5,5,5,0,5,5,5,5,0,5,0,5,5,5,5,
-5,5,5,5,5,5,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,0,0,0,5,5,5,
-0,5,5,5,5,5,0,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,0,0,0,0,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,
-0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x2cb,0x2cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x54b,0x54b,0,0,0,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0x545,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
-0,0,0,0,0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,4,4,4,4,4,4,
+0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,4,0x17,
+0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+5,6,7,7,7,0x17,6,6,6,6,6,6,6,6,6,6,
+0x17,4,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,4,4,
+6,6,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0x58a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,
+0x78a,0x54a,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,0,
+0,0,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,4,4,4,4,4,4,4,
+4,4,0x1a,0x1a,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,2,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,2,1,2,
+1,2,1,2,4,2,2,2,2,2,2,2,2,1,2,1,
+2,1,1,2,1,2,1,2,1,2,4,0x1a,0x1a,1,2,1,
+2,5,1,2,1,2,2,2,1,2,1,2,1,2,1,2,
+1,2,1,2,1,2,1,2,1,2,1,2,1,1,1,1,
+1,2,1,1,1,1,1,2,1,2,1,2,1,2,1,2,
+1,2,0,0,1,2,1,1,1,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1a,
-0x1a,0x1a,0x1a,0x1a,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
-0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0,
-0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,
-0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0,0,0,0,0x1b,0x1b,0x1b,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,
-0x1b,0x1b,0,0,0,0,0,0,0,0,0,0,5,0x705,5,5,
+0,0,0,0,0,0,0,0,0,5,4,4,2,5,5,5,
+5,5,6,5,5,5,6,5,5,5,5,6,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x645,5,5,5,
+5,5,5,8,8,6,6,8,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
+0x34cb,0x344b,0x3ccb,0x37cb,0x35cb,0x3fcb,0x1b,0x1b,0x19,0x1b,0,0,0,0,0,0,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,0x645,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x685,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0xcc5,5,5,5,5,
-5,5,5,5,0xf45,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,0xf45,5,5,5,5,5,5,5,5,5,5,5,
-5,5,0x6c5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,0x605,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,0,
+8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0x605,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x605,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,0x605,5,5,5,5,
-5,5,5,5,5,5,5,5,5,0x645,5,5,5,5,5,5,
+5,5,5,5,8,8,8,8,8,8,8,8,8,8,8,8,
+6,6,0,0,0,0,0,0,0,0,0x17,0x17,0x49,0x89,0xc9,0x109,
+0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,0,6,6,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,5,5,
+5,5,5,5,0x17,0x17,0x17,5,0x17,5,5,6,0x49,0x89,0xc9,0x109,
+0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,5,5,5,5,5,5,5,5,
 5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
-5,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,5,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,5,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x785,5,5,5,
-5,5,5,5,5,5,5,5,5,5,5,5,0x10,0x10,0x10,0x10,
-0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
-0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0,0x10,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0x11,0x11,0x11,0x11,
+5,5,6,6,6,6,6,6,6,6,0x17,0x17,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,6,
+6,6,6,6,6,6,6,8,8,0,0,0,0,0,0,0,
+0,0,0,0,0x17,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,0,0,0,6,6,6,8,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,6,8,8,6,6,6,6,8,
+8,6,8,8,8,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0,4,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
+0,0,0x17,0x17,5,5,5,5,5,6,4,5,5,5,5,5,
+5,5,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,5,5,
+5,5,5,0,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,6,6,6,
+6,6,6,8,8,6,6,8,8,6,6,0,0,0,0,0,
+0,0,0,0,5,5,5,6,5,5,5,5,5,5,5,5,
+6,8,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
+0x17,0x17,0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,4,5,5,5,5,5,5,0x1b,0x1b,0x1b,5,8,
+6,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,6,5,6,6,6,5,5,6,6,5,5,5,5,5,
+6,6,5,6,5,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,4,
+0x17,0x17,5,5,5,5,5,5,5,5,5,5,5,8,6,6,
+8,8,0x17,0x17,5,4,4,8,6,0,0,0,0,0,0,0,
+0,0,5,5,5,5,5,5,0,0,5,5,5,5,5,5,
+0,0,5,5,5,5,5,5,0,0,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,0,5,5,5,5,5,5,5,
+0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,0x1a,4,4,4,
+4,2,2,2,2,2,2,2,2,0,0,0,0,0,0,0,
+0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,8,8,6,8,8,6,8,8,0x17,8,6,0,
+0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0,0,0,0,0,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0,0,0,0,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0,0,0,0,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
 0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
-0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0,0,0,0,0,0
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,0x605,5,5,5,5,5,5,5,0x7c5,5,5,
+5,5,0x5c5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,0x6c5,5,0x6c5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0x7c5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,2,2,2,2,2,2,0,0,0,0,0,0,0,0,
+0,0,0,0,2,2,2,2,2,0,0,0,0,0,5,6,
+5,5,5,5,5,5,5,5,5,5,0x18,5,5,5,5,5,
+5,5,5,5,5,5,5,5,0,5,5,5,5,5,0,5,
+0,5,5,0,5,5,0,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0x1a,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,0x15,0x14,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+5,5,5,5,0x19,0x1b,0,0,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x14,
+0x15,0x17,0,0,0,0,0,0,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,6,6,0x17,0x13,0x13,0x16,0x16,0x14,0x15,0x14,
+0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x14,0x15,0x17,0x17,0x14,0x15,0x17,0x17,0x17,
+0x17,0x16,0x16,0x16,0x17,0x17,0x17,0,0x17,0x17,0x17,0x17,0x13,0x14,0x15,0x14,
+0x15,0x14,0x15,0x17,0x17,0x17,0x18,0x13,0x18,0x18,0x18,0,0x17,0x19,0x17,0x17,
+0,0,0,0,5,5,5,5,5,0,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,0,0,0x10,0,0x17,0x17,0x17,0x19,0x17,
+0x17,0x17,0x14,0x15,0x17,0x18,0x17,0x13,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0x17,0x17,0x18,0x18,0x18,0x17,0x17,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,0x14,0x17,0x15,0x1a,0x16,0x1a,2,2,2,2,2,
+2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+2,2,2,2,2,0x14,0x18,0x15,0x18,0x14,0x15,0x17,0x14,0x15,0x17,0x17,
+5,5,5,5,5,5,5,5,5,5,4,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,4,4,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0,0,5,5,5,5,
+5,5,0,0,5,5,5,5,5,5,0,0,5,5,5,5,
+5,5,0,0,5,5,5,0,0,0,0x19,0x19,0x18,0x1a,0x1b,0x19,
+0x19,0,0x1b,0x18,0x18,0x18,0x18,0x1b,0x1b,0,0,0,0,0,0,0,
+0,0,0,0x10,0x10,0x10,0x1b,0x1b,0,0,5,5,5,5,5,5,
+5,5,5,5,5,0,5,5,0,5,0x17,0x17,0x17,0,0,0,
+0,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,
+0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,
+0x984b,0xa04b,0xa84b,0xb04b,0xb84b,0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0,0,
+0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x34ca,0x344a,0x58a,0x68a,0x11ca,0x980a,
+0x984a,0x988a,0x68a,0x7ca,0x11ca,0x1e4a,0x980a,0x784a,0x984a,0x68a,0x7ca,0x11ca,0x1e4a,0x980a,0x784a,0x788a,
+0x988a,0x7ca,0x58a,0x58a,0x58a,0x5ca,0x5ca,0x5ca,0x5ca,0x68a,0x7ca,0x7ca,0x7ca,0x7ca,0x7ca,0xcca,
+0x11ca,0x11ca,0x11ca,0x11ca,0x1e4a,0x880a,0x980a,0x980a,0x980a,0x980a,0x784a,0x984a,0x68a,0x11ca,0x344b,0x344b,
+0x388b,0x3ccb,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x54b,0x34cb,0x1b,0x1b,
+0x1b,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,
+0,0,6,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,
+0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0,0,
+0,0,0x58b,0x68b,0x7cb,0x11cb,0,0,0,0,0,0,0,0,0,5,
+5,5,0x1bca,5,5,5,5,5,5,5,5,0xb80a,0,0,0,0,
+0,5,5,5,5,5,5,6,6,6,6,6,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,5,0,
+0x17,0x58a,0x5ca,0x7ca,0xa4a,0x1e4a,0,0,0,0,0,0,0,0,0,0,
+1,1,1,1,0,0,0,0,2,2,2,2,2,2,2,2,
+2,2,2,2,0,0,0,0,5,5,5,5,0,0,0,0,
+0,0,0,0,0,0,0,0x17,5,5,5,5,5,5,0,0,
+5,0,5,5,5,5,5,5,0,5,5,0,0,0,5,0,
+0,5,5,5,5,5,5,0,0x17,0x58b,0x5cb,0x60b,0x7cb,0xa4b,0x1e4b,0x784b,
+0x788b,5,5,5,5,5,5,5,0x1b,0x1b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x7cb,
+0xa4b,0,0,0,0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x64b,0x68b,0x7cb,0xa4b,
+0x1e4b,5,5,5,0,5,5,0,0,0,0,0,0x58b,0x68b,0x7cb,0xa4b,
+0x1e4b,5,5,5,5,5,5,0x58b,0x7cb,0xa4b,0x1e4b,0x5cb,0x60b,0,0,0,
+0x17,5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,
+0x17,5,5,5,5,5,5,5,5,0,0,0,0,0x5ecb,0x344b,5,
+5,0,0,0x1e4b,0x800b,0x880b,0x900b,0x980b,0xa00b,0xa80b,0xb00b,0xb80b,0x784b,0x804b,0x884b,0x904b,
+0x984b,0xa04b,0xa84b,0xb04b,0xb84b,0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,0xb08b,0xb88b,0x78cb,0x80cb,
+0x88cb,0x90cb,0x98cb,0xa0cb,0xa8cb,0xb0cb,0xb8cb,0x36cb,0x354b,0x34cb,0x348b,0x46cb,0x344b,0x4ecb,0x388b,0x3ccb,
+0x454b,5,6,6,6,0,6,6,0,0,0,0,0,6,6,6,
+6,5,5,5,5,5,5,0,0,6,6,6,0,0,0,0,
+6,0x30b,0x34b,0x38b,0x3cb,0x7cb,0xa4b,0x1e4b,0x784b,0x344b,0,0,0,0,0,0,
+0,5,5,5,5,5,5,5,5,5,5,5,5,5,0x58b,0x11cb,
+0x17,5,5,5,5,5,5,5,5,5,5,5,5,5,0x58b,0x7cb,
+0xa4b,5,5,5,5,5,5,5,5,0x1b,5,5,5,5,5,5,
+5,6,6,0,0,0,0,0x58b,0x68b,0x7cb,0xa4b,0x1e4b,5,5,5,5,
+5,5,0,0,0,0x17,0x17,0x17,0x17,0x17,0x17,0x17,5,5,5,5,
+5,5,0,0,0x58b,0x5cb,0x60b,0x64b,0x7cb,0xa4b,0x1e4b,0x784b,5,5,5,0,
+0,0,0,0,0x58b,0x5cb,0x60b,0x64b,0x7cb,0xa4b,0x1e4b,0x784b,5,5,0,0,
+0,0,0,0,0,0x17,0x17,0x17,0x17,0,0,0,0,0,0,0,
+0,0,0x58b,0x5cb,0x60b,0x64b,0x7cb,0xa4b,0x1e4b,2,2,2,0,0,0,0,
+0,0,0,0x58b,0x68b,0x7cb,0x11cb,0x1e4b,0x784b,5,5,5,5,6,6,6,
+6,0,0,0,0,0,0,0,0,0x194b,0x1bcb,0x1e4b,0x800b,0x880b,0x900b,0x980b,
+0xa00b,0xa80b,0xb00b,0xb80b,0x344b,0x34cb,0x348b,0x388b,0,5,5,5,5,5,5,5,
+5,5,5,5,5,5,0x58b,0x5cb,0x60b,0x64b,0x68b,0x7cb,0xa4b,0xccb,0x1e4b,0x344b,
+5,0,0,0,0,0,0,0,0,6,0x58b,0x7cb,0xa4b,0x1e4b,0x17,0x17,
+0x17,0x17,0x17,0,0,0,0,0,0,6,6,6,6,6,6,6,
+0x17,0x17,0x17,0x17,0x17,0x17,0x17,0,0,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,
+0x4cb,0x50b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0x1e4b,0x784b,0x49,0x89,0xc9,
+0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,8,8,8,6,6,6,6,8,8,
+6,6,0x17,0x17,0x10,0x17,0x17,0,0,0,0,0,0,0,0,0,
+0,0,0x10,0,0,6,6,6,5,5,5,5,5,5,5,5,
+5,5,5,5,5,6,6,6,6,6,8,6,6,6,6,6,
+0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x17,0x17,0x17,0x17,5,
+8,8,0,0,0,0,0,0,0,0,0,5,5,5,6,0x17,
+0x17,5,0,0,0,0,0,0,0,0,0,5,5,5,8,8,
+8,6,6,6,6,6,6,6,6,6,8,5,5,5,5,0x17,
+0x17,0x17,0x17,6,6,6,6,0x17,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,5,0x17,5,0x17,0x17,0x17,0x16cb,0x194b,0x1bcb,0x1e4b,0x784b,0,
+0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,5,5,5,5,5,8,8,8,6,6,8,8,6,8,6,
+6,0x17,0x17,0x17,0x17,0x17,0x17,6,0,5,5,5,5,5,5,5,
+0,5,0,5,5,5,5,0,5,5,5,5,5,5,5,5,
+5,0x17,0,0,0,0,0,0,8,8,8,6,6,6,6,6,
+6,6,6,0,0,0,0,0,6,6,8,8,0,5,5,5,
+5,5,5,5,5,0,0,5,0,5,5,0,5,5,5,5,
+5,0,6,6,5,8,8,6,8,8,8,8,0,0,8,8,
+0,0,8,8,8,0,0,5,0,0,0,0,0,0,8,0,
+0,0,0,0,5,5,5,8,8,0,0,6,6,6,6,6,
+6,6,0,0,0,5,5,5,5,5,8,8,8,6,6,6,
+6,6,6,6,6,8,8,6,6,6,8,6,5,5,5,5,
+0x17,0x17,0x17,0x17,0x17,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,
+0x17,0,0x17,6,5,8,8,8,6,6,6,6,6,6,8,6,
+8,8,8,8,6,8,6,6,5,5,0x17,5,0,0,0,0,
+0,0,0,0,8,8,6,6,6,6,0,0,8,8,8,8,
+6,6,8,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,0x17,
+0x17,0x17,0x17,5,5,5,5,6,6,0,0,8,8,8,6,6,
+6,6,6,6,6,6,8,8,6,8,6,0x17,0x17,0x17,5,0,
+0,0,0,0,0,0,0,0,0,0,5,5,5,5,5,5,
+5,5,5,5,5,6,8,6,8,8,6,6,6,6,6,6,
+8,6,5,0,0,0,0,0,0,0,8,8,6,6,6,6,
+8,6,6,6,6,6,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0x7cb,0xa4b,0x17,0x17,0x17,0x1b,6,6,6,6,6,6,
+6,6,8,6,6,0x17,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,0x1bcb,0,0,0,
+0,0,0,0,0,0,0,0,0,5,8,6,8,6,6,6,
+6,0,0,6,6,8,8,8,8,6,5,0x17,5,8,0,0,
+0,0,0,0,0,0,0,0,0,5,6,6,6,6,6,6,
+6,6,6,6,5,5,5,5,5,6,6,6,6,6,6,8,
+5,6,6,6,6,0x17,0x17,0x17,0x17,0x17,0x17,0x17,6,0,0,0,
+0,0,0,0,0,5,6,6,6,6,6,6,8,8,6,6,
+6,5,5,5,5,6,6,6,6,6,6,6,8,6,6,0x17,
+0x17,0x17,5,0x17,0x17,6,6,6,6,6,6,6,0,6,6,6,
+6,6,6,8,6,5,0x17,0x17,0x17,0x17,0x17,0,0,0,0,0,
+0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x58b,
+0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0xa4b,0xccb,0xf4b,0x11cb,0x144b,0x16cb,0x194b,
+0x1bcb,0x1e4b,0,0,0,6,6,6,6,6,6,6,6,0,8,6,
+6,6,6,6,6,8,6,6,8,6,6,0,0,0,0,0,
+0,0,0,0,5,6,6,6,6,6,6,0,0,0,6,0,
+6,6,0,6,6,6,6,6,6,5,6,0,0,0,0,0,
+0,0,0,5,5,5,5,5,5,0,5,5,0,5,5,5,
+5,5,5,5,5,5,5,8,8,8,8,8,0,6,6,0,
+8,8,6,8,6,5,0,0,0,0,0,0,0,5,5,5,
+6,6,8,8,0x17,0x17,0,0,0,0,0,0,0,0xcd0b,0xcc0b,0xcb0b,
+0xd00b,0xca0b,0xcf0b,0xcb4b,0xd04b,0xc90b,0x37cb,0x37cb,0x364b,0x35cb,0xc94b,0x3fcb,0x350b,0x34cb,0x344b,0x344b,
+0x3ccb,0xcd0b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x19,0x19,0x19,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0x17,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,
+0x74a,0x78a,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,
+0x5ca,0x60a,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,0x64a,0x68a,0x5ca,0x60a,0x60a,
+0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0x58a,0x5ca,0x60a,0x60a,0x64a,0x68a,0xc08a,0xc18a,0x58a,0x5ca,
+0x60a,0x60a,0x64a,0x68a,0x60a,0x60a,0x64a,0x64a,0x64a,0x64a,0x6ca,0x70a,0x70a,0x70a,0x74a,0x74a,
+0x78a,0x78a,0x78a,0x78a,0x5ca,0x60a,0x64a,0x68a,0x6ca,0x58a,0x5ca,0x60a,0x64a,0x64a,0x68a,0x68a,
+0x5ca,0x60a,0x58a,0x5ca,0x348a,0x388a,0x454a,0x348a,0x388a,0x35ca,0x34ca,0x354a,0x34ca,0x34ca,0x344a,0x348a,
+0x388a,0xf4a,0x11ca,0x64a,0x68a,0x6ca,0x70a,0x74a,0x78a,0,0x10,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0,0,0,0,0,0,0,6,6,6,6,6,0x17,
+0,0,0,0,0,0,0,0,0,0,6,6,6,6,6,6,
+6,0x17,0x17,0x17,0x17,0x17,0x1b,0x1b,0x1b,0x1b,4,4,4,4,0x17,0x1b,
+0,0,0,0,0,0,0,0,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0,0x7cb,0x1e4b,0x788b,0x790b,0x798b,0x7a0b,0x7a8b,0,5,5,5,
+5,5,5,5,5,5,5,5,5,5,0,0,0,0,0,5,
+5,5,0x54b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0x80b,0x84b,0x88b,
+0x8cb,0x90b,0x94b,0x98b,0x9cb,0xa0b,0x58b,0x5cb,0x60b,0x17,0x17,0x17,0x17,0,0,0,
+0,0,5,8,8,8,8,8,8,8,8,8,8,8,8,8,
+8,8,8,0,0,0,0,0,0,0,6,6,6,4,4,4,
+4,4,4,4,4,4,4,4,4,4,0x17,4,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,5,5,5,5,5,5,
+5,5,0,0,0x1b,6,6,0x17,0x10,0x10,0x10,0x10,0,0,0,0,
+0,0,0,0,0,0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,8,8,6,
+6,6,0x1b,0x1b,0x1b,8,8,8,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,
+6,6,6,6,6,0x1b,0x1b,6,6,6,6,6,6,6,0x1b,0x1b,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,6,6,6,0x1b,0x1b,6,6,
+6,0x1b,0,0,0,0,0,0,0,0,0,0,0x94b,0x98b,0x9cb,0xa0b,
+0,0,0,0,0,0,0,0,0,0,0,0,0x194b,0x1bcb,0x58b,0x5cb,
+0x60b,0x64b,0x68b,0x58b,0x68b,0,0,0,0,0,0,0,2,2,2,2,
+1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,
+2,0,2,2,2,2,2,2,2,2,2,2,2,2,1,0,
+1,1,0,0,1,0,0,1,1,0,0,1,1,1,1,0,
+1,1,1,1,1,1,2,2,2,2,0,2,0,2,2,2,
+2,1,1,0,1,1,1,1,0,0,1,1,1,1,1,0,
+1,1,1,1,1,1,1,0,2,2,2,2,2,2,2,2,
+1,1,0,1,1,1,1,0,1,1,1,1,1,0,1,0,
+0,0,1,1,1,1,1,1,2,2,2,2,2,2,2,2,
+2,2,2,2,1,1,1,1,2,2,2,2,2,2,0,0,
+1,1,1,1,1,1,1,1,0x18,2,2,2,2,2,2,2,
+2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,
+1,1,0x18,2,2,2,2,2,0x18,2,2,2,2,2,2,1,
+1,1,1,1,1,1,1,1,0x18,2,2,2,2,2,2,0x18,
+2,2,2,2,2,2,1,2,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,
+0x1c9,0x209,0x249,0x289,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0x49,0x89,
+0xc9,0x109,6,6,6,6,6,6,6,0x1b,0x1b,0x1b,0x1b,6,6,6,
+6,6,6,6,6,6,6,6,6,6,0x1b,0x1b,0x1b,0x1b,0x1b,6,
+0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,6,0x1b,0x1b,0x17,0x17,0x17,
+0x17,0x17,0,0,0,0,6,6,6,6,6,6,6,6,6,0,
+0,6,6,6,6,6,0,6,6,0,6,6,6,6,6,0,
+0,0,0,0,6,6,6,6,6,6,6,4,4,4,4,4,
+4,4,0,0,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
+0,0,5,5,0x49,0x89,0xc9,0x109,0x149,0x189,0x1c9,0x209,0x249,0x289,0,0,
+0,0,0,0x19,5,5,5,5,5,0,0,0x58b,0x5cb,0x60b,0x64b,0x68b,
+0x6cb,0x70b,0x74b,0x78b,2,2,2,2,6,6,6,6,6,6,6,4,
+0,0,0,0,0x78cb,0x794b,0x814b,0x58b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,
+0x1b,0x34cb,0x344b,0x3ccb,0x19,0x58b,0x5cb,0x788b,0x78cb,0,0,0,0,0,0,0,
+0,0,0,0,0x984b,0xa04b,0xa84b,0xb04b,0xb84b,0x788b,0x808b,0x888b,0x908b,0x988b,0xa08b,0xa88b,
+0xb08b,0xb88b,0x1b,0x5cb,0x60b,0x64b,0x68b,0x6cb,0x70b,0x74b,0x78b,0x7cb,0x900b,0xa00b,0x804b,0x788b,
+0x344b,0x354b,0,0,5,5,0,5,0,0,5,0,5,5,5,5,
+5,5,5,0,5,5,5,5,0,5,0,5,0,0,0,0,
+5,0,0,0,0,5,0,5,0,5,0,5,5,5,0,5,
+5,0,5,0,0,5,0,5,0,5,0,5,0,5,5,0,
+5,0,0,5,5,5,5,0,5,5,5,5,0,5,5,5,
+5,0,5,0,5,5,5,0,5,5,5,5,5,0,5,5,
+5,5,5,0x18,0x18,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0x2cb,0x2cb,0x30b,0x34b,0x38b,0x3cb,0x40b,0x44b,0x48b,0x4cb,0x50b,0x54b,0x54b,
+0,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1a,0x1a,
+0x1a,0x1a,0x1a,0x1b,0x1b,0,0x1b,0x1b,0x1b,0x1b,0,0,0,0x1b,0x1b,0x1b,
+0x1b,0x1b,0x1b,0,0,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0,0,0,0x1b,0x1b,
+0x1b,0x1b,0,0,0,0,0x1b,0x1b,0x1b,0,0,0,0,0,5,5,
+5,0xcc5,5,5,5,5,5,5,5,5,0xf45,5,5,5,5,5,
+5,5,5,5,5,5,5,0xf45,5,5,5,0,0x10,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0x10,0x10,0x10,0x10,0x10,
+0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x11,0x11,0x11,0x11,0x11,
+0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0,0
 };
 
-static const UTrie2 propsTrie={
+static const UCPTrie propsTrie={
     propsTrie_index,
-    propsTrie_index+4468,
-    NULL,
-    4468,
-    17500,
-    0xa40,
-    0x11f4,
+    { propsTrie_data },
+    3165, 16571,
+    0x110000, 0x110,
+    0, 0,
+    0, 0,
+    0x66a, 0x1552,
     0x0,
-    0x0,
-    0x110000,
-    0x55cc,
-    NULL, 0, FALSE, FALSE, 0, NULL
 };
 
-static const uint16_t propsVectorsTrie_index[30604]={
-0x4d6,0x4de,0x4e6,0x4ee,0x506,0x50e,0x516,0x51e,0x526,0x52e,0x536,0x53e,0x546,0x54e,0x556,0x55e,
-0x565,0x56d,0x575,0x57d,0x580,0x588,0x590,0x598,0x5a0,0x5a8,0x5b0,0x5b8,0x5c0,0x5c8,0x5d0,0x5d8,
-0x5e0,0x5e8,0x5ef,0x5f7,0x5ff,0x607,0x60f,0x617,0x61f,0x627,0x62c,0x634,0x63b,0x643,0x64b,0x653,
-0x65b,0x663,0x66b,0x673,0x67a,0x682,0x68a,0x692,0x69a,0x6a2,0x6aa,0x6b2,0x6ba,0x6c2,0x6ca,0x6d2,
-0x19e8,0xd4b,0xe32,0x6da,0x4f6,0xe99,0xea1,0x1b92,0x12b7,0x12cf,0x12bf,0x12c7,0x7a3,0x7a9,0x7b1,0x7b9,
-0x7c1,0x7c7,0x7cf,0x7d7,0x7df,0x7e5,0x7ed,0x7f5,0x7fd,0x803,0x80b,0x813,0x81b,0x823,0x82b,0x832,
-0x83a,0x840,0x848,0x850,0x858,0x85e,0x866,0x86e,0x876,0x12d7,0x87e,0x886,0x88e,0x895,0x89d,0x8a5,
-0x8ad,0x8b1,0x8b9,0x8c0,0x8c8,0x8d0,0x8d8,0x8e0,0x15e7,0x15ef,0x8e8,0x8f0,0x8f8,0x900,0x908,0x90f,
-0x164d,0x163d,0x1645,0x1923,0x192b,0x12e7,0x917,0x12df,0x1531,0x1531,0x1533,0x12fb,0x12fc,0x12ef,0x12f1,0x12f3,
-0x1655,0x1657,0x91f,0x1657,0x927,0x92c,0x934,0x165c,0x93a,0x1657,0x940,0x948,0xc27,0x1664,0x1664,0x950,
-0x1674,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,0x1675,
-0x1675,0x1675,0x1675,0x166c,0x958,0x167d,0x167d,0x960,0xb47,0xb4f,0xb57,0xb5f,0x168d,0x1685,0x968,0x970,
-0x978,0x1697,0x169f,0x980,0x1695,0x988,0x19f0,0xd53,0xb67,0xb6f,0xb77,0xb7c,0x1891,0xc5a,0xc61,0x17f9,
-0xbf7,0x19f8,0xd5b,0xd63,0xd6b,0xd73,0xf4c,0xf4c,0x18e9,0x18ee,0xc95,0xc9d,0x195f,0x1967,0x1ab1,0xe3a,
-0x196f,0xcdf,0xce7,0x1977,0x1109,0x11b1,0xf2c,0xd7b,0x1819,0x1801,0x1811,0x1809,0x18a9,0x18a1,0x1869,0xc07,
-0x1304,0x1304,0x1304,0x1304,0x1307,0x1304,0x1304,0x130f,0x990,0x1317,0x994,0x99c,0x1317,0x9a4,0x9ac,0x9b4,
-0x1327,0x131f,0x132f,0x9bc,0x9c4,0x1337,0x9cc,0x9d4,0x133f,0x1347,0x134f,0x1357,0x9dc,0x135f,0x1366,0x136e,
-0x1376,0x137e,0x1386,0x138e,0x1396,0x139d,0x13a5,0x13ad,0x13b5,0x13bd,0x13c0,0x13c2,0x16a7,0x178c,0x1792,0x18d9,
-0x13ca,0x9e4,0x9ec,0x14e4,0x14e9,0x14ec,0x14f4,0x13d2,0x14fc,0x14fc,0x13e2,0x13da,0x13ea,0x13f2,0x13fa,0x1402,
-0x140a,0x1412,0x141a,0x1422,0x179a,0x17f1,0x1933,0x1a89,0x1432,0x1439,0x1441,0x1449,0x142a,0x1451,0x17a2,0x17a9,
-0x16af,0x16af,0x16af,0x16af,0x16af,0x16af,0x16af,0x16af,0x17b1,0x17b4,0x17b1,0x17b1,0x17bc,0x17c3,0x17c5,0x17cc,
-0x17d4,0x17d8,0x17d8,0x17db,0x17d8,0x17d8,0x17e1,0x17d8,0x1821,0x18e1,0x193b,0xb84,0xb8a,0x1bce,0x1bd6,0x1cad,
-0x1881,0xc37,0xc3b,0x18f6,0x1871,0x1871,0x1871,0xc0f,0x1879,0xc2f,0x18c1,0xc85,0xc17,0xc1f,0xc1f,0x197f,
-0x18b1,0x1943,0xc71,0xc75,0x9f4,0x16b7,0x16b7,0x9fc,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0xa04,0x6de,
-0x1519,0x153b,0xa0c,0x1543,0xa14,0x154b,0x1553,0x155b,0xa1c,0xa21,0x1563,0x156a,0xa26,0xa2e,0x18d1,0xbff,
-0xa36,0x15c1,0x15c8,0x1572,0x15d0,0x15d7,0x157a,0xa3e,0x1593,0x1593,0x1595,0x1582,0x158a,0x158a,0x158b,0x15df,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,
-0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x16c7,0x126c,0x1829,0x1829,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,
-0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x159d,0x15a4,0x19e0,0x1274,
-0x16cf,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,
-0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,0x16d5,
-0x16d5,0x16d5,0x16d5,0x16d5,0xa46,0x16dd,0xa4e,0x1a00,0x198b,0x198b,0x198b,0x198b,0x198b,0x198b,0x198b,0x198b,
-0x1987,0xcef,0x199b,0x1993,0x199d,0x1a08,0x1a08,0xd83,0x1889,0x18fe,0x1953,0x1957,0x194b,0x1aa9,0xca5,0xca8,
-0x18b9,0xc7d,0x1906,0xcb0,0x19a5,0x19a8,0xcf7,0x1a10,0x19b8,0x19b0,0xcff,0xd8b,0x1a18,0x1a1c,0xd93,0xff4,
-0x19c0,0xd07,0xd0f,0x1a24,0x1a34,0x1a2c,0xd9b,0xef4,0xe42,0xe4a,0x1c1d,0xfac,0x1cca,0x1cca,0x1a3c,0xda3,
-0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,
-0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,
-0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,
-0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,
-0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,
-0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,
-0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,
-0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,
-0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,
-0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,
-0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,
-0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,
-0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,
-0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,
-0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,
-0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,
-0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,
-0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,
-0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,
-0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,
-0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,
-0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0x1635,0x162f,0x1630,0x1631,0x1632,0x1633,0x1634,0xa56,0xdab,0xdae,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,
-0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,0x1607,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,
-0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x1504,0x15ac,0x15ac,0x15ac,0x15ac,0x15ac,0x15ac,0x15ac,0x15ac,
-0x15b1,0x15b9,0x17e9,0x127c,0x18c9,0x18c9,0x1280,0x1287,0xa5e,0xa66,0xa6e,0x1471,0x1478,0x1480,0xa76,0x1488,
-0x14b9,0x14b9,0x1461,0x1469,0x1490,0x14b0,0x14b1,0x14c1,0x1498,0x1459,0xa7e,0x14a0,0xa86,0x14a8,0xa8e,0xa92,
-0xc8d,0x14c9,0xa9a,0xaa2,0x14d1,0x14d7,0x14dc,0xaaa,0xaba,0x1521,0x1529,0x150c,0x1511,0xac2,0xaca,0xab2,
-0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,
-0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15f7,0x15ff,0x15ff,0x15ff,0x15ff,
-0x13d8,0x13d8,0x1418,0x1458,0x1498,0x14d8,0x1518,0x1558,0x1594,0x15d4,0x1600,0x1640,0x1680,0x16c0,0x1700,0x1740,
-0x1780,0x17bc,0x17fc,0x183c,0x187c,0x18b0,0x18ec,0x192c,0x196c,0x19ac,0x19e8,0x1a28,0x1a68,0x1aa8,0x1ae8,0x1b28,
-0xa80,0xac0,0xb00,0xb40,0xb80,0xa40,0xe48,0xa40,0xe6a,0xa40,0xa40,0xa40,0xa40,0xbc0,0x12d5,0x12d5,
-0xeaa,0xeea,0xa40,0xa40,0xa40,0xa40,0xf2a,0xc00,0xa40,0xa40,0xc40,0xc80,0xcc0,0xd00,0xe08,0xd78,
-0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,0x1215,
-0x1215,0x1215,0x1215,0x1215,0xf6a,0x1255,0x108a,0x10ca,0x1295,0x10d5,0x1315,0x1315,0x1315,0xfaa,0xfca,0x100a,
-0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,
-0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0xfca,0x104a,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0xdb8,0xdc8,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,
-0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xa40,0xd38,
-0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,
-0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1195,0x1115,
-0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,
-0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x11d5,0x1155,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0xb92,0xb99,0xba1,0xba9,0x1831,0x1831,0x1831,0xbb1,0xbb9,0xbbc,0x1861,0x1859,0xbef,0xd17,0xd1b,0xd1f,
-0x4f6,0x4f6,0x4f6,0x4f6,0xd27,0x19c8,0xd2f,0xf44,0x16e5,0xad2,0xad8,0x1004,0xbc4,0x1899,0xc69,0x4f6,
-0x16fa,0x16ed,0x16f2,0x1839,0xbcc,0xbd4,0x1147,0x114d,0x1c05,0xf61,0x1bf5,0x6e6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1c25,0x1c25,0x1c25,0x1c25,0x1c25,0x1c25,0x1c25,0x1c25,0x1c25,0xfb4,0xfbc,0xfc4,0x4f6,0x4f6,0x4f6,0x4f6,
-0xbdc,0xbdf,0xdb6,0x1c6d,0xffc,0x6ee,0x4f6,0x1095,0xcb8,0xd37,0x4f6,0x4f6,0x1ba2,0xefc,0xf04,0x1cb5,
-0xc43,0xc4a,0xc52,0x1a44,0x1c4d,0x4f6,0x1c2d,0xfd4,0x1a4c,0xdbe,0xdc6,0xdce,0x1024,0x6f6,0x4f6,0x4f6,
-0x1a54,0x1a54,0x6fe,0x4f6,0x1ce2,0x10ad,0x1cda,0x10b5,0x1d9a,0x11c7,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0xdd6,0x4f6,0x4f6,0x4f6,0x4f6,0x1dba,0x11ef,0x11f6,0x706,0x4f6,0x4f6,0x4f6,0x11fe,
-0x1ab9,0x1abb,0xe52,0xe59,0x1a5c,0x1a64,0xdde,0xf24,0x1b9a,0xee4,0xeec,0xfcc,0x1bba,0x1bbe,0xf1c,0x1044,
-0xf97,0xf9c,0x70e,0x4f6,0x109d,0x10a5,0x1c15,0xfa4,0xf79,0xf7f,0xf87,0xf8f,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1d2a,0x1d22,0x1137,0x113f,0x1c95,0x1c8d,0x106b,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1c7d,0x102c,0x1034,0x103c,
-0x1c45,0x1c3d,0xfe4,0x112f,0x1bc6,0xf34,0x716,0x4f6,0x107b,0x1083,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1d92,0x11a9,0x71e,0x4f6,0x4f6,0x1ca5,0x1c9d,0x1073,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1206,0x120a,0x1212,
-0x1d6a,0x1d62,0x1191,0x1d5a,0x1d52,0x726,0x1c75,0x101c,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x10ed,0x10f2,0x10fa,0x1101,0x1121,0x1127,0x4f6,0x4f6,0x1175,0x1179,0x1181,0x11b9,0x11bf,0x72e,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x11d7,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1dd2,0x1248,
-0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,
-0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x1913,0xcc0,0xcc7,0xcc7,0xcc7,
-0x191b,0x191b,0x191b,0xccf,0x1cd2,0x1cd2,0x1cd2,0x1cd2,0x1cd2,0x1cd2,0x736,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,0x1ac3,
-0x1ac3,0xe61,0xfec,0x73e,0x4f6,0x4f6,0x742,0xf3c,0x1c65,0x1c5d,0x100c,0x1014,0x74a,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x1db2,0x1daa,0x11e7,0x4f6,0x4f6,0x4f6,0x1bb2,0x1bb2,0xf0c,0x1baa,0xf14,0x4f6,0x4f6,0x1119,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1bfd,0x1bfd,0x1bfd,0xf54,0xf59,0x752,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1702,0x1702,0x1702,0x1702,0x1702,0x1702,0x1702,0xae0,0x1712,0xae8,0x1713,0x170a,0x171b,0x1721,0x1729,0xaf0,
-0x1851,0x1851,0x75a,0x4f6,0x4f6,0x4f6,0x4f6,0x11df,0x1841,0x1841,0xbe7,0xcd7,0x4f6,0x4f6,0x4f6,0x4f6,
-0x175a,0x1761,0xaf8,0x1764,0xb00,0xb08,0xb10,0x175e,0xb18,0xb20,0xb28,0x1763,0x176b,0x175a,0x1761,0x175d,
-0x1764,0x176c,0x175b,0x1762,0x175e,0xb2f,0x1731,0x1739,0x1740,0x1747,0x1734,0x173c,0x1743,0x174a,0xb37,0x1752,
-0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,0x1cfa,
-0x1cea,0x1ced,0x1cea,0x1cf4,0x10dd,0x762,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1111,0x76a,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1dca,0x121a,0x772,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1dda,0x1250,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x1c35,0x1c35,0x1c35,0x1c35,0x1c35,0x1c35,0xfdc,0x4f6,0x1d1a,0x1d12,0x10e5,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x776,0x1da2,0x11cf,0x4f6,0x4f6,0x1222,0x1223,0x77e,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0xea9,0xeb1,0xeb9,0xec1,0xec9,0xed1,0xed8,0xedc,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x782,0x104c,0x1c85,0x1052,0x1c85,0x105a,0x105f,0x1063,0x1063,
-0x10bd,0x1d32,0x1d3a,0x10c5,0x1d0a,0x10cd,0x10d5,0x1d7a,0x1dc2,0x1dc2,0x1199,0x11a1,0x123a,0x1240,0x1240,0x1240,
-0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,
-0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,
-0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78a,0x78b,0xb3f,0x1774,0x1774,0x1774,0x793,0x793,0x793,0x793,
-0x1849,0x1849,0x1849,0x1849,0x1849,0x1849,0x1849,0x79b,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,
-0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,
-0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,
-0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,
-0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x793,0x19d0,0xd3f,0x19d8,0x19d8,0xd43,0xe69,0xe71,0xe79,
-0xdee,0x1a81,0x1a99,0xdf6,0x1a91,0xdfe,0xe02,0xe09,0xe11,0xe18,0xe20,0xe28,0xe2a,0xe2a,0xe2a,0xe2a,
-0x1afa,0x1b02,0x1afa,0x1b08,0x1b10,0x1adb,0x1b18,0x1b20,0x1afa,0x1b28,0x1b30,0x1b37,0x1b3f,0x1ae3,0x1afa,0x1b44,
-0x1aeb,0x1af2,0x1b4c,0x1b52,0x1be6,0x1bed,0x1bde,0x1b5a,0x1b62,0x1b6a,0x1b72,0x1c55,0x1b7a,0x1b82,0xe81,0xe89,
-0x1acb,0x1acb,0x1acb,0xe91,0x1c0d,0x1c0d,0xf69,0xf71,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,
-0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6e,0x1a6c,0x1a76,0x1a6c,0x1a6c,0x1a6c,
-0x1a6c,0x1a6c,0x1a6c,0x1a79,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0x1a6c,0xde6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1cbd,0x1cbd,0x1cbd,0x1cbd,0x1cbd,0x1cbd,
-0x1cbd,0x1cbd,0x1cbd,0x1cbd,0x1cbd,0x1cbd,0x1cbd,0x1cbd,0x1cc2,0x1cbd,0x1cbd,0x1cbd,0x108b,0x108d,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1155,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,
-0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,0x1d4a,
-0x1d4a,0x115d,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x1ad3,0x1d72,0x1d72,0x1d72,0x1d72,0x1d72,
-0x1d72,0x1d72,0x1165,0x116d,0x122b,0x1232,0x1d8a,0x1d8a,0x1d8a,0x1d8a,0x1d8a,0x1d8a,0x1d8a,0x1d8a,0x1d8a,0x1d8a,
-0x1d8a,0x1189,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,
-0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x4f6,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x128f,0x1258,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,
-0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,
-0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1260,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1784,0x1784,0x1784,0x1784,0x1784,0x1784,
-0x1784,0x1784,0x1784,0x1784,0x1784,0x1784,0x1784,0x1784,0x1784,0x1784,0x1297,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1264,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,
-0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1258,0x1264,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x129f,0x1b8a,0x1b8a,0x1b8a,0x1b8a,0x1b8a,0x1b8a,0x12a7,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x12af,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,
-0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x160f,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1617,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,0x161f,
-0x161f,0x161f,0x161f,0x161f,0x161f,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,0x1627,
-0x1627,0x1627,0x1627,0x1627,0x1627,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,0x177c,
-0x177c,0x177c,0x177c,0x177c,0x177c,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,
-0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1aa1,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,
-0x1d02,0x1d02,0x1d02,0x1d02,0x1d02,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,
-0x1d42,0x1d42,0x1d42,0x1d42,0x1d42,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,
-0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,
-0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,
-0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,
-0x1d82,0x1d82,0x1d82,0x1d82,0x1d82,0x4d5,0x4d5,0x4d5,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,
-0x2bb,0x2be,0x2c7,0x2c1,0x2c1,0x2c4,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,
-0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x7ec,0x7e6,0x7cb,0x7c2,0x7b9,0x7b6,0x7ad,0x7c8,
-0x7b3,0x7bf,0x7c2,0x7dd,0x7d4,0x7c5,0x7e9,0x7bc,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,
-0x7aa,0x7aa,0x7d1,0x7ce,0x7d7,0x7d7,0x7d7,0x7e6,0x7ad,0x7f8,0x7f8,0x7f8,0x7f8,0x7f8,0x7f8,0x7f2,
-0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,
-0x7f2,0x7f2,0x7f2,0x7b3,0x7b9,0x7bf,0x7e3,0x7a7,0x7e0,0x7f5,0x7f5,0x7f5,0x7f5,0x7f5,0x7f5,0x7ef,
-0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,
-0x7ef,0x7ef,0x7ef,0x7b3,0x7da,0x7b0,0x7d7,0x2bb,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2d9,0x2ca,0x2ca,
+static const uint16_t propsVectorsTrie_index[3401]={
+0,0x40,0x80,0xc0,0x100,0x140,0x180,0x1c0,0x1fa,0x239,0x265,0x2a5,0x2e5,0x325,0x365,0x3a3,
+0x3e3,0x41d,0x45b,0x49b,0x4db,0x50c,0x545,0x585,0x5c5,0x605,0x63e,0x67e,0x6be,0x6fe,0x73e,0x77e,
+0x7be,0x7fe,0x82e,0x86c,0x8ac,0x8eb,0x92b,0x96a,0x9aa,0x9e9,0xa29,0xa68,0xaa8,0xae8,0xb28,0xb66,
+0xba6,0xbe5,0xc25,0xc65,0xca5,0xce4,0xd24,0xd64,0xda4,0xde4,0xe24,0xe64,0xea4,0xee4,0xf24,0xf64,
+0xfa4,0xfe4,0x1022,0x105c,0x109c,0x10c2,0x10e3,0x110b,0x114b,0x1184,0x11bd,0x11fb,0x122c,0x1265,0x12a5,0x12c5,
+0x1305,0x1306,0x1306,0x1306,0x1306,0x1306,0x1306,0x1306,0x1306,0x1319,0x1359,0x1379,0x13b9,0x13f9,0x1439,0x1477,
+0x14b7,0x14f4,0x1534,0x1564,0x15a4,0x15e4,0x1624,0x165f,0x169f,0x16ca,0x170a,0x1749,0x1789,0x17c9,0x1809,0x1849,
+0x1889,0x18c9,0x1909,0x1949,0x1989,0x19c5,0x1a05,0x1a45,0x1a85,0x1a85,0x1aaf,0x1acf,0x1b0f,0x1b4f,0x1b8f,0x1bce,
+0x1c0e,0x1c4e,0x1c8e,0x1cce,0x1d0e,0x1d4e,0x1d8e,0x1dca,0x1e0a,0x1e49,0x1e89,0x1ec9,0x1f09,0x1f34,0x1f71,0x1fa9,
+0x1fe9,0x2029,0x205d,0x209b,0x20db,0x210f,0x214f,0x218f,0x21cf,0x220f,0x224f,0x228f,0x22cf,0x230d,0x234d,0x238d,
+0x23cd,0x23cd,0x23cd,0x23cd,0x240d,0x2443,0x2483,0x24ab,0x24eb,0x24f8,0x252f,0x2553,0x2593,0x25ce,0x25ec,0x2629,
+0x2669,0x2699,0x26d9,0x26f5,0x2735,0x2765,0x27a5,0x27c5,0x2805,0x2845,0x2885,0x28a5,0x28e5,0x28e5,0x28e5,0x290f,
+0x294f,0x298f,0x29cd,0x2a0b,0x2a4b,0x2a7c,0x2aad,0x2aed,0x2b2d,0x2b69,0x2ba9,0x2be9,0x2c29,0x2c51,0x2c91,0x2cb3,
+0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,
+0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,
+0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,
+0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,
+0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,
+0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,
+0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cf3,0x2cfd,0x2d3d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,
+0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d7d,0x2d97,0x2dd3,
+0x2e13,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,0x2e29,
+0x2e29,0x2e29,0x2e5c,0x2e9b,0x2edb,0x2edb,0x2edb,0x2edb,0x2f0f,0x2f4f,0x2f8f,0x2faf,0x2fef,0x3021,0x305f,0x309f,
+0x30df,0x311f,0x315f,0x319b,0x31db,0x3214,0x3254,0x3294,0x32d4,0x3314,0x3354,0x3394,0x33d4,0x3404,0x3434,0x3474,
+0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,
+0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,
+0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,
+0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,
+0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,
+0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,
+0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,
+0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,
+0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,
+0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,
+0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x34c8,0x34b4,0x34bc,0x34c4,0x34cc,0x34b8,0x34c0,0x3500,0x3539,
+0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x3579,0x35b9,0x35b9,
+0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,0x35f9,
+0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,
+0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,
+0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,
+0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,
+0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,
+0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,0x3639,
+0x3639,0x3639,0x3639,0x3639,0x3679,0x3679,0x3679,0x3679,0x36ab,0x36db,0x370b,0x3731,0x3771,0x37b1,0x37ed,0x382b,
+0x386b,0x388d,0x38b6,0x38d7,0x390c,0x394c,0x3986,0x39c3,0x3a03,0x3a43,0x3a83,0x3ab7,0x3af7,0x3b37,0x3b68,0x3ba7,
+0xbe1,0xbff,0xc1c,0xc3b,0xc5b,0xc5b,0xc68,0xc85,0xca5,0xca5,0xca5,0xca6,0xcc6,0xcc6,0xcc6,0xcc7,
+0xcc6,0xcc6,0xcc6,0xcc7,0xcc6,0xcc6,0xcc6,0xcc7,0xcc6,0xcc6,0xcc6,0xcc7,0xcc6,0xcc6,0xcc6,0xcc7,
+0xcc6,0xcc6,0xcc6,0xcc7,0xcc6,0xcc6,0xcc6,0xcc7,0xcc6,0xcc6,0xcc6,0xcc7,0xcc6,0xcc6,0xcc6,0xcc7,
+0xcc6,0xcc6,0xcc6,0xcc7,0xce7,0xcc6,0xcc6,0xcc7,0xd07,0xd07,0xd07,0xd08,0xd28,0xd28,0xd28,0xd29,
+0x3be7,0x3bf4,0x3bec,0x3bf9,0x3c08,0x3c08,0x3c16,0x3c16,0x3c26,0x3c26,0x3c26,0x3c26,0x3c26,0x3c26,0x3c26,0x3c2b,
+0x3c3b,0x3c42,0x3c42,0x3c4e,0x3c5e,0x3c5e,0x3c5e,0x3c69,0x3c6e,0x3c7e,0x3c8e,0x3c8f,0x3c8f,0x3c9f,0x3c9f,0x3ca2,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x3cb2,0x3cb5,0x3cc5,0x3cc5,0x3cc5,0x3cd4,0x3ce4,0x3ce8,
+0x3cf8,0x3cf9,0x3d09,0x3d19,0x3d1e,0x3d2e,0x3d2e,0x3d38,0x3d48,0x3d4a,0x3d5a,0x3d5a,0x3d66,0x3d76,0x82f,0x82f,
+0x3d86,0x3d86,0x3d90,0x3d98,0x3d9a,0x3daa,0x3daa,0x3daa,0x3dba,0x3dbc,0x3dcc,0x3ddc,0x3ddc,0x3de8,0x3df0,0x3df4,
+0x3e04,0x3e04,0x3e0c,0x3e1c,0x3e1c,0x3e1c,0x3e28,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,0x3e38,
+0x3e38,0x3e38,0x3e38,0x3e41,0x3e38,0x3e42,0x3e40,0x3e48,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x3e58,0x3e62,0x3e62,0x3e6c,0x3e7c,0x3e86,0x3e96,0x3e9f,0x3eaf,0x3eb0,0x3ebf,0x82f,0x82f,0x82f,0x3ecf,0x3edc,
+0x3eec,0x3ef6,0x3f06,0x3f0c,0x82f,0x82f,0x82f,0x82f,0x3f1c,0x3f1c,0x3f2c,0x3f34,0x3f44,0x3f54,0x3f44,0x3f44,
+0x3f64,0x3f74,0x3f7d,0x3f89,0x3f99,0x3fa9,0x3fb9,0x3fbc,0x3fcc,0x3fcf,0x82f,0x82f,0x3fdf,0x3fe8,0x3ff3,0x4003,
+0x4013,0x4013,0x4013,0x401d,0x402d,0x4037,0x4047,0x4054,0x4064,0x4072,0x407f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x408f,0x408f,0x408f,0x408f,0x4096,0x82f,0x82f,0x82f,0x40a6,0x40a6,0x40a6,0x40b3,0x40c3,0x40c3,0x40c3,0x40d0,
+0x40e0,0x40e0,0x40ee,0x40fe,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x410e,0x410f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x411f,0x4122,0x412f,0x413f,0x4149,0x4158,
+0x4162,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4172,0x417b,0x418b,0x418e,0x418e,0x4196,0x41a0,0x41ae,
+0x41b8,0x41c8,0x41d8,0x41de,0x41eb,0x41fb,0x4209,0x4219,0x4220,0x4230,0x4240,0x4243,0x424c,0x425c,0x426c,0x427c,
+0x427c,0x4289,0x4299,0x429c,0x429c,0x42a9,0x42b9,0x42c9,0x42d9,0x42e4,0x42f4,0x4302,0x4306,0x4315,0x4324,0x82f,
+0x82f,0x82f,0x4334,0x4343,0x4352,0x4362,0x4362,0x4363,0x4373,0x4383,0x4393,0x439f,0x43a6,0x43b5,0x43c3,0x43d3,
+0x43e1,0x43e9,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x43f9,0x43f9,0x43f9,0x4404,0x4414,0x4424,
+0x4434,0x4434,0x4444,0x4444,0x4444,0x4454,0x4463,0x4473,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x4483,0x4483,0x4484,0x4494,0x44a4,0x44ae,0x44bc,0x44bc,0x44cc,0x44cc,0x44cc,0x44dc,0x44ec,0x44fc,
+0x450c,0x4519,0x4529,0x4529,0x452e,0x453e,0x454e,0x82f,0x82f,0x82f,0x455e,0x4564,0x4574,0x4584,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4594,0x4594,0x4598,0x45a7,0x45b3,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x45c3,0x45c3,0x45d3,0x45d3,0x45e3,0x45f0,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x4600,0x460a,0x460a,0x4619,0x4629,0x462e,0x463e,0x4649,0x4649,0x4656,0x4666,0x4676,
+0x4682,0x4682,0x468e,0x4698,0x46a7,0x82f,0x46b7,0x46b7,0x46b7,0x46be,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x46ce,0x46d8,0x46d9,0x46e9,0x46f9,0x4709,
+0x4713,0x4723,0x4725,0x4735,0x473d,0x474c,0x82f,0x82f,0x82f,0x82f,0x475c,0x4767,0x4767,0x4776,0x4785,0x4795,
+0x47a5,0x47af,0x47b5,0x47c5,0x47d5,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x47e5,0x47f2,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x4802,0x4812,0x4821,0x482f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,
+0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,0x483f,
+0x483f,0x483f,0x483f,0x483f,0x483f,0x4840,0x484f,0x484f,0x4856,0x4860,0x4860,0x4860,0x4860,0x4860,0x4860,0x4870,
+0x4870,0x4870,0x4870,0x4870,0x4870,0x487d,0x488d,0x489d,0x489d,0x489d,0x489d,0x489d,0x489d,0x489d,0x489d,0x489d,
+0x489d,0x489d,0x489d,0x48a9,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,
+0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,
+0x48b9,0x48b9,0x48b9,0x48b9,0x48c1,0x48b9,0x48b9,0x48cf,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,
+0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48d9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48b9,0x48e5,
+0x48f5,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4905,0x4905,0x4905,
+0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,
+0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4905,0x4907,0x4905,0x4905,0x4905,0x4905,0x4917,0x491e,
+0x491e,0x491e,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,
+0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,
+0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x492e,0x4935,0x4945,0x4946,0x4956,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x4966,0x4968,0x4978,0x4988,0x4988,0x4988,0x4998,0x49a8,0x49b8,0x49c6,0x49ce,0x4988,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x49de,0x49de,0x49ee,0x49ee,0x49fe,0x4a07,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x4a17,0x4a17,0x4a17,0x4a17,0x4a22,0x4a32,0x4a33,0x4a34,0x4a43,0x4a52,0x82f,0x82f,0x82f,
+0x82f,0x4a62,0x4a66,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,
+0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,0x4a76,
+0x4a76,0x4a76,0x4a76,0x4a79,0x4a87,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,
+0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,
+0x4a97,0x4a97,0x4a97,0x4a97,0x4a97,0x4aa4,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4ab4,0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ab6,
+0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ab6,0x4ac6,0x4ac7,0x4ad6,0x4ae6,0x4ae6,0x4af6,0x4b02,0x4b12,0x4b12,0x4b12,
+0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b12,0x4b16,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4b26,0x4b26,0x4b26,
+0x4b26,0x4b26,0x4b26,0x4b2b,0x4b29,0x4b2d,0x4b3d,0x4b4d,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4b5d,0x4b5d,0x4b5d,
+0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b5d,0x4b67,0x4b77,0x4b77,0x4b80,
+0x4b77,0x4b77,0x4b8a,0x4b98,0x4ba6,0x4bb3,0x4b77,0x4bbf,0x4b8d,0x4bcf,0x4bd1,0x4bdf,0x4be8,0x4bf8,0x4bf8,0x4bf8,
+0x4bf8,0x4c06,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4c16,0x4c22,0x4c32,0x4c32,0x4c32,
+0x4c32,0x4c32,0x4c3b,0x4c4b,0x4c59,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4c69,0x4c6f,0x4c79,
+0x4c85,0x4c6b,0x4c95,0x4c81,0x4c69,0x4c77,0x4c9b,0x4cab,0x4cb9,0x4cc8,0x4c69,0x4c6f,0x4c79,0x4cd4,0x4ce1,0x4c79,
+0x4cd0,0x4cf1,0x4d00,0x4c7d,0x4c69,0x4c73,0x4c79,0x4c69,0x4c6f,0x4c79,0x4c85,0x4c6b,0x4c79,0x4c81,0x4c69,0x4c77,
+0x4c7d,0x4c69,0x4c73,0x4c79,0x4c69,0x4c6f,0x4c79,0x4d0c,0x4c69,0x4d1b,0x4d20,0x4d2e,0x4d33,0x4c79,0x4d3f,0x4c69,
+0x4d17,0x4d4f,0x4c83,0x4d5f,0x4c79,0x4d6f,0x4c69,0x4d65,0x4c79,0x4d75,0x4d83,0x4d83,0x4d83,0x4d93,0x4d93,0x4d93,
+0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,
+0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4d93,0x4da3,0x4da3,0x4da3,
+0x4dac,0x4da3,0x4da3,0x4da6,0x4dbc,0x4dc8,0x4dd4,0x4dde,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4dee,0x4df6,0x4e04,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4e14,0x4e14,0x4e17,
+0x4e27,0x4e37,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4e47,0x4e47,
+0x4e4b,0x4e5b,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e6b,0x4e76,0x4e86,
+0x82f,0x82f,0x4e96,0x4e96,0x4ea4,0x4ea6,0x4eb2,0x4ec2,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x4ed2,0x4ed3,0x4ed3,0x4ed7,0x4ee3,0x82f,0x82f,0x82f,0x82f,0x4ef3,0x4ef4,0x4ef4,0x4ef6,0x4f04,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4f14,0x4f19,0x4f29,0x4f36,0x4f44,
+0x4f54,0x4f62,0x4f6a,0x4f7a,0x4f85,0x4f94,0x4f85,0x4fa4,0x4fa4,0x4fa4,0x4fb4,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x4fc4,0x4fc9,0x4fcd,0x4fdd,0x4fdd,
+0x4fdd,0x4fdd,0x4fdd,0x4fdd,0x4fe9,0x4ff9,0x5008,0x5018,0x5028,0x5038,0x5042,0x5052,0x5062,0x5067,0x5077,0x5087,
+0x5097,0x50a7,0x50b7,0x50c7,0x50d7,0x50e2,0x50ef,0x50ef,0x50ef,0x50f9,0x50ff,0x510f,0x511f,0x512a,0x513a,0x514a,
+0x515a,0x516a,0x5170,0x5170,0x5170,0x5170,0x5170,0x5170,0x5170,0x5170,0x5170,0x5180,0x5180,0x518f,0x519f,0x5180,
+0x5180,0x5180,0x51a6,0x51b6,0x51c2,0x5180,0x51d2,0x51e0,0x51ef,0x5180,0x51ff,0x5180,0x5180,0x5180,0x5181,0x520f,
+0x521e,0x5228,0x522f,0x523e,0x524c,0x525c,0x526a,0x5180,0x5180,0x5180,0x5272,0x5282,0x528b,0x5296,0x52a4,0x52b4,
+0x5180,0x52c4,0x52d3,0x52de,0x52ee,0x52fa,0x5309,0x5317,0x5326,0x5335,0x5341,0x5351,0x5360,0x5370,0x5380,0x538f,
+0x539f,0x539f,0x53a9,0x53b9,0x53b9,0x53c6,0x53d2,0x53e2,0x53f2,0x5402,0x5412,0x5422,0x5422,0x5422,0x5422,0x5422,
+0x5422,0x5422,0x542e,0x543e,0x543e,0x543e,0x543e,0x543e,0x5449,0x5459,0x5465,0x5475,0x5485,0x5485,0x5485,0x548d,
+0x548b,0x5485,0x5485,0x548d,0x5485,0x5487,0x5495,0x5495,0x5495,0x5495,0x5495,0x54a5,0x54b5,0x54c5,0x54d5,0x54e5,
+0x54f5,0x5504,0x5513,0x5523,0x5531,0x553e,0x554e,0x555e,0x556e,0x557c,0x5583,0x5593,0x5593,0x5593,0x5593,0x5593,
+0x559f,0x55af,0x55bf,0x55c7,0x55d7,0x55dd,0x55dd,0x55dd,0x55dd,0x55dd,0x55dd,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,
+0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,
+0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ed,0x55ef,0x55ff,0x55ff,0x55ff,0x55ff,
+0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,
+0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x55ff,0x5608,0x5618,0x5618,0x5628,
+0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,
+0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5628,0x5633,
+0x5643,0x5643,0x5643,0x5643,0x5643,0x5643,0x5643,0x5643,0x5643,0x5643,0x5643,0x5643,0x5645,0x5655,0x5655,0x5655,
+0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,
+0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5655,0x5663,0x5673,0x5673,
+0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,
+0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5673,0x5682,0x5618,
+0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,
+0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5692,
+0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,
+0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5692,0x5694,
+0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,
+0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x5618,0x56a4,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,
+0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x82f,0x56b4,
+0x56c4,0x56c6,0x56d6,0x56d6,0x56d6,0x56d6,0x56d6,0x56d6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,
+0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56f6,0x56e6,
+0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,
+0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x56e6,0x5706,
+0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,
+0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5706,0x5708,
+0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,
+0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,0x5718,
+0x571a,0x440,0x460,0x480,0x4a0,0x4c0,0x4e0,0x500,0x51a,0x53a,0x55a,0x57a,0x59a,0x5ba,0x5da,0x5fa,
+0x615,0x635,0x63f,0x65f,0x674,0x674,0x674,0x674,0x674,0x694,0x6af,0x6cd,0x674,0x674,0x674,0x674,
+0x674,0x6ed,0x70a,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,
+0x674,0x674,0x674,0x72a,0x747,0x674,0x763,0x783,0x783,0x783,0x783,0x783,0x783,0x783,0x783,0x785,
+0x7a5,0x7b6,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,
+0x674,0x674,0x674,0x674,0x7d6,0x7ed,0x674,0x674,0x674,0x674,0x80d,0x674,0x674,0x674,0x674,0x674,
+0x674,0x674,0x674,0x82d,0x84d,0x86d,0x88d,0x8ad,0x8cd,0x674,0x674,0x8ed,0x902,0x674,0x674,0x922,
+0x674,0x93b,0x95b,0x97b,0x99b,0x9bb,0x9db,0x9fb,0xa1b,0xa2b,0xa2c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,
+0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,
+0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa4c,0xa5f,0xa6f,0xa6f,0xa6f,0xa6f,
+0xa6f,0xa6f,0xa6f,0xa7c,0xa9b,0xa9d,0xa9d,0xa9d,0xa9d,0xa9d,0xa9d,0xa9d,0xab3,0xabe,0xabe,0xabe,
+0xabe,0xabe,0xabe,0xabe,0xabe,0xabe,0xabe,0xabe,0xabe,0xabe,0xac0,0xadf,0xadf,0xadf,0xadf,0xadf,
+0xadf,0xaff,0xb1e,0xadf,0xb20,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,
+0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,0xadf,
+0xadf,0xadf,0xadf,0xadf,0xadf,0xb20,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,
+0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,
+0x674,0x674,0x674,0x674,0x674,0x674,0xb40,0xb60,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0x674,
+0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,0x674,
+0x674,0x674,0x674,0x674,0x674,0x674,0x674,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,
+0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,
+0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xb9f,0xba0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,
+0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,
+0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc0,0xbc1
+};
+
+static const uint16_t propsVectorsTrie_data[22317]={
+0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2be,0x2c7,0x2c1,0x2c1,0x2c4,0x2bb,0x2bb,
+0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,0x2bb,
+0x7ec,0x7e6,0x7cb,0x7c2,0x7b9,0x7b6,0x7ad,0x7c8,0x7b3,0x7bf,0x7c2,0x7dd,0x7d4,0x7c5,0x7e9,0x7bc,
+0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7aa,0x7d1,0x7ce,0x7d7,0x7d7,0x7d7,0x7e6,
+0x7ad,0x7f8,0x7f8,0x7f8,0x7f8,0x7f8,0x7f8,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,
+0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7f2,0x7b3,0x7b9,0x7bf,0x7e3,0x7a7,
+0x7e0,0x7f5,0x7f5,0x7f5,0x7f5,0x7f5,0x7f5,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,
+0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7ef,0x7b3,0x7da,0x7b0,0x7d7,0x2bb,
+0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2d9,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,
 0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,
-0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2ca,0x2cd,0x642,0x801,0x804,0x648,0x804,0x7fe,0x63f,
-0x636,0x2d3,0x654,0x2d6,0x807,0x62d,0x64b,0x7fb,0x645,0x651,0x633,0x633,0x639,0x2d0,0x63f,0x63c,
-0x636,0x633,0x654,0x2d6,0x630,0x630,0x630,0x642,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x65d,0x2df,
-0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x65d,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x64e,
-0x65d,0x2df,0x2df,0x2df,0x2df,0x2df,0x65d,0x657,0x65a,0x65a,0x2dc,0x2dc,0x2dc,0x2dc,0x657,0x2dc,
-0x65a,0x65a,0x65a,0x2dc,0x65a,0x65a,0x2dc,0x2dc,0x657,0x2dc,0x65a,0x65a,0x2dc,0x2dc,0x2dc,0x64e,
-0x657,0x65a,0x65a,0x2dc,0x65a,0x2dc,0x657,0x2dc,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,
-0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2e8,0x660,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,
-0x2eb,0x2e2,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x669,0x660,
-0x2eb,0x2e2,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x660,0x66c,0x666,0x2eb,0x2e2,0x2eb,0x2e2,
-0x660,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x66c,0x666,0x669,0x660,0x2eb,0x663,0x2eb,0x2e2,0x2eb,
-0x663,0x66f,0x669,0x660,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,0x669,0x660,0x2eb,0x2e2,0x2eb,0x2e2,
-0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x669,0x660,
-0x2eb,0x2e2,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,
-0x2eb,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2e5,0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,0x2ee,0x2fa,0x2fa,
-0x2ee,0x2fa,0x2fa,0x2fa,0x2ee,0x2ee,0x2fa,0x2fa,0x2fa,0x2fa,0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,0x2fa,
-0x2fa,0x2ee,0x2ee,0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,0x2fd,0x2f1,0x2fa,0x2ee,0x2fa,0x2ee,0x2fa,0x2fa,
-0x2ee,0x2fa,0x2ee,0x2ee,0x2fa,0x2ee,0x2fa,0x2fd,0x2f1,0x2fa,0x2fa,0x2fa,0x2ee,0x2fa,0x2ee,0x2fa,
-0x2fa,0x2ee,0x2ee,0x2f7,0x2fa,0x2ee,0x2ee,0x2ee,0x2f7,0x2f7,0x2f7,0x2f7,0x300,0x300,0x2f4,0x300,
-0x300,0x2f4,0x300,0x300,0x2f4,0x2fd,0x672,0x2fd,0x672,0x2fd,0x672,0x2fd,0x672,0x2fd,0x672,0x2fd,
-0x672,0x2fd,0x672,0x2fd,0x672,0x2ee,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fa,0x2ee,0x2fd,0x2f1,
-0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2f1,0x300,0x300,0x2f4,0x2fd,0x2f1,0x9de,0x9de,
-0x9e1,0x9db,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,
-0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x9e1,0x9db,0x9e1,0x9db,
-0x9de,0x9d8,0x9e1,0x9db,0xba3,0xcab,0x9de,0x9d8,0x9de,0x9d8,0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,
-0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,0xcab,0xcab,0xcab,0xdaa,0xdaa,0xdaa,0xdad,0xdad,
-0xdaa,0xdad,0xdad,0xdaa,0xdaa,0xdad,0xeeb,0xeee,0xeee,0xeee,0xeee,0xeeb,0xeee,0xeeb,0xeee,0xeeb,
-0xeee,0xeeb,0xeee,0xeeb,0x303,0x675,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,
-0x303,0x303,0x303,0x303,0x303,0x675,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,
+0x2cd,0x642,0x801,0x804,0x648,0x804,0x7fe,0x63f,0x636,0x2d3,0x654,0x2d6,0x807,0x62d,0x64b,0x7fb,
+0x645,0x651,0x633,0x633,0x639,0x2d0,0x63f,0x63c,0x636,0x633,0x654,0x2d6,0x630,0x630,0x630,0x642,
+0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x65d,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,
+0x65d,0x2df,0x2df,0x2df,0x2df,0x2df,0x2df,0x64e,0x65d,0x2df,0x2df,0x2df,0x2df,0x2df,0x65d,0x657,
+0x65a,0x65a,0x2dc,0x2dc,0x2dc,0x2dc,0x657,0x2dc,0x65a,0x65a,0x65a,0x2dc,0x65a,0x65a,0x2dc,0x2dc,
+0x657,0x2dc,0x65a,0x65a,0x2dc,0x2dc,0x2dc,0x64e,0x657,0x65a,0x65a,0x2dc,0x65a,0x2dc,0x657,0x2dc,
+0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,
+0x2e8,0x660,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,
+0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x669,0x660,0x2eb,0x2e2,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,
+0x2eb,0x660,0x66c,0x666,0x2eb,0x2e2,0x2eb,0x2e2,0x660,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x66c,
+0x666,0x669,0x660,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x663,0x66f,0x669,0x660,0x2eb,0x663,0x2eb,0x2e2,
+0x2eb,0x2e2,0x669,0x660,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,
+0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x669,0x660,0x2eb,0x2e2,0x2eb,0x663,0x2eb,0x2e2,0x2eb,0x2e2,
+0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2eb,0x2e2,0x2eb,0x2e2,0x2eb,0x2e2,0x2e5,
+0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,0x2fa,0x2fa,0x2ee,0x2ee,0x2fa,0x2fa,
+0x2fa,0x2fa,0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,0x2fa,0x2fa,0x2ee,0x2ee,0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,
+0x2fd,0x2f1,0x2fa,0x2ee,0x2fa,0x2ee,0x2fa,0x2fa,0x2ee,0x2fa,0x2ee,0x2ee,0x2fa,0x2ee,0x2fa,0x2fd,
+0x2f1,0x2fa,0x2fa,0x2fa,0x2ee,0x2fa,0x2ee,0x2fa,0x2fa,0x2ee,0x2ee,0x2f7,0x2fa,0x2ee,0x2ee,0x2ee,
+0x2f7,0x2f7,0x2f7,0x2f7,0x300,0x300,0x2f4,0x300,0x300,0x2f4,0x300,0x300,0x2f4,0x2fd,0x672,0x2fd,
+0x672,0x2fd,0x672,0x2fd,0x672,0x2fd,0x672,0x2fd,0x672,0x2fd,0x672,0x2fd,0x672,0x2ee,0x2fd,0x2f1,
+0x2fd,0x2f1,0x2fd,0x2f1,0x2fa,0x2ee,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,
+0x2f1,0x300,0x300,0x2f4,0x2fd,0x2f1,0x9de,0x9de,0x9e1,0x9db,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,
+0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,0x2fd,0x2f1,
+0x2fd,0x2f1,0x9e1,0x9db,0x9e1,0x9db,0x9de,0x9d8,0x9e1,0x9db,0xba3,0xcab,0x9de,0x9d8,0x9de,0x9d8,
+0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,0x9e1,0x9db,0xcab,0xcab,
+0xcab,0xdaa,0xdaa,0xdaa,0xdad,0xdad,0xdaa,0xdad,0xdad,0xdaa,0xdad,0xeeb,0xeee,0xeee,0xeee,0xeee,
+0xeeb,0xeee,0xeeb,0xeee,0xeeb,0xeee,0xeeb,0xeee,0xeeb,0x303,0x675,0x303,0x303,0x303,0x303,0x303,
+0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x675,0x303,0x303,0x303,0x303,0x303,
 0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,
-0x303,0x303,0x303,0x303,0x306,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,
-0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x9e4,0x9e4,0x9e4,0x9e4,0x9e4,0xcae,0xcae,
-0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x315,0x315,0x315,0x315,0x315,0x315,0x315,
-0x312,0x312,0x30f,0x30f,0x67b,0x30f,0x315,0x67e,0x318,0x67e,0x67e,0x67e,0x318,0x67e,0x315,0x315,
-0x681,0x31b,0x30f,0x30f,0x30f,0x30f,0x30f,0x30f,0x678,0x678,0x678,0x678,0x30c,0x678,0x30f,0xb19,
-0x31e,0x31e,0x31e,0x31e,0x31e,0x309,0x309,0x309,0x309,0x309,0x9ed,0x9ed,0x9ea,0x9e7,0x9ea,0xcb1,
-0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,
+0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x306,0x303,0x303,0x303,0x303,0x303,0x303,
+0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x303,0x9e4,0x9e4,
+0x9e4,0x9e4,0x9e4,0xcae,0xcae,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x31e,0x315,0x315,
+0x315,0x315,0x315,0x315,0x315,0x312,0x312,0x30f,0x30f,0x67b,0x30f,0x315,0x67e,0x318,0x67e,0x67e,
+0x67e,0x318,0x67e,0x315,0x315,0x681,0x31b,0x30f,0x30f,0x30f,0x30f,0x30f,0x30f,0x678,0x678,0x678,
+0x678,0x30c,0x678,0x30f,0xb19,0x31e,0x31e,0x31e,0x31e,0x31e,0x309,0x309,0x309,0x309,0x309,0x9ed,
+0x9ed,0x9ea,0x9e7,0x9ea,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,
+0xcb1,0xcb1,0xcb1,0xcb1,0xcb1,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,
 0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,
 0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,
 0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,
-0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,0x684,
-0x687,0x687,0x93f,0x687,0x687,0x942,0xb1c,0xb1c,0xb1c,0xb1c,0xb1c,0xb1c,0xb1c,0xb1c,0xb1c,0xc60,
-0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xeb2,0xeb2,0xeb2,0xeb2,0xeb5,0xd7a,0xd7a,0xd7a,
-0x68a,0x68a,0xb1f,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,
-0xf99,0xf96,0xf99,0xf96,0x32a,0x333,0xf99,0xf96,9,9,0x339,0xef1,0xef1,0xef1,0x321,0x14ee,
-9,9,9,9,0x336,0x324,0x348,0x327,0x348,0x348,0x348,9,0x348,9,0x348,0x348,
-0x33f,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,
-0x690,0x690,9,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x348,0x348,0x33f,0x33f,0x33f,0x33f,
-0x33f,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,
-0x68d,0x68d,0x33c,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x33f,0x33f,0x33f,0x33f,0x33f,0xf99,
-0x34b,0x34b,0x34e,0x348,0x348,0x34b,0x342,0x9f0,0xbac,0xba9,0x345,0x9f0,0x345,0x9f0,0x345,0x9f0,
-0x345,0x9f0,0x330,0x32d,0x330,0x32d,0x330,0x32d,0x330,0x32d,0x330,0x32d,0x330,0x32d,0x330,0x32d,
-0x34b,0x34b,0x342,0x33c,0xb5b,0xb58,0xba6,0xcb7,0xcb4,0xcba,0xcb7,0xcb4,0xdb0,0xdb3,0xdb3,0xdb3,
-0x9ff,0x69c,0x35a,0x35d,0x35a,0x35a,0x35a,0x35d,0x35a,0x35a,0x35a,0x35a,0x35d,0x9ff,0x35d,0x35a,
-0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x69c,0x699,0x699,0x699,0x699,0x699,0x699,
+0x684,0x684,0x684,0x684,0x684,0x687,0x687,0x93f,0x687,0x687,0x942,0xb1c,0xb1c,0xb1c,0xb1c,0xb1c,
+0xb1c,0xb1c,0xb1c,0xb1c,0xc60,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xd77,0xeb2,0xeb2,0xeb2,
+0xeb2,0xeb5,0xd7a,0xd7a,0xd7a,0x68a,0x68a,0xb1f,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,0xca8,
+0xca8,0xca8,0xca8,0xca8,0xca8,0xf99,0xf96,0xf99,0xf96,0x32a,0x333,0xf99,0xf96,9,9,0x339,
+0xef1,0xef1,0xef1,0x321,0x14ee,9,9,9,9,0x336,0x324,0x348,0x327,0x348,0x348,0x348,
+9,0x348,9,0x348,0x348,0x33f,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x690,
+0x690,0x690,0x690,0x690,0x690,0x690,0x690,9,0x690,0x690,0x690,0x690,0x690,0x690,0x690,0x348,
+0x348,0x33f,0x33f,0x33f,0x33f,0x33f,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,
+0x68d,0x68d,0x68d,0x68d,0x68d,0x33c,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x68d,0x33f,0x33f,0x33f,
+0x33f,0x33f,0xf99,0x34b,0x34b,0x34e,0x348,0x348,0x34b,0x342,0x9f0,0xbac,0xba9,0x345,0x9f0,0x345,
+0x9f0,0x345,0x9f0,0x345,0x9f0,0x330,0x32d,0x330,0x32d,0x330,0x32d,0x330,0x32d,0x330,0x32d,0x330,
+0x32d,0x330,0x32d,0x34b,0x34b,0x342,0x33c,0xb5b,0xb58,0xba6,0xcb7,0xcb4,0xcba,0xcb7,0xcb4,0xdb0,
+0xdb3,0xdb3,0xdb3,0x9ff,0x69c,0x35a,0x35d,0x35a,0x35a,0x35a,0x35d,0x35a,0x35a,0x35a,0x35a,0x35d,
+0x9ff,0x35d,0x35a,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x69c,0x699,0x699,0x699,
 0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,0x699,
-0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x696,0x693,0x693,0x693,0x693,0x693,0x693,
-0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x9f9,0x696,0x354,0x357,
-0x354,0x354,0x354,0x357,0x354,0x354,0x354,0x354,0x357,0x9f9,0x357,0x354,0x35a,0x354,0x35a,0x354,
-0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,
-0x35a,0x354,0x35d,0x357,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x351,0x94b,
-0x94e,0x930,0x930,0x1140,0x9f3,0x9f3,0xbb2,0xbaf,0x9fc,0x9f6,0x9fc,0x9f6,0x35a,0x354,0x35a,0x354,
-0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,
-0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,
-0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x35d,0x357,0x35a,
-0x354,0xbb2,0xbaf,0x35a,0x354,0xbb2,0xbaf,0x35a,0x354,0xbb2,0xbaf,0xef4,0x35d,0x357,0x35d,0x357,
-0x35a,0x354,0x35d,0x357,0x35a,0x354,0x35d,0x357,0x35d,0x357,0x35d,0x357,0x35a,0x354,0x35d,0x357,
-0x35d,0x357,0x35d,0x357,0x35a,0x354,0x35d,0x357,0x9ff,0x9f9,0x35d,0x357,0x35d,0x357,0x35d,0x357,
-0x35d,0x357,0xdb9,0xdb6,0x35d,0x357,0xef7,0xef4,0xef7,0xef4,0xef7,0xef4,0xc21,0xc1e,0xc21,0xc1e,
-0xc21,0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xf24,0xf21,0xf24,0xf21,
-0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,
-0x1179,0x1176,0x1362,0x135f,0x1527,0x1524,0x1527,0x1524,0x1527,0x1524,0x1527,0x1524,0xc,0x36f,0x36f,0x36f,
+0x699,0x699,0x699,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x696,0x693,0x693,0x693,
+0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x693,0x9f9,0x696,0x354,
+0x357,0x354,0x354,0x354,0x357,0x354,0x354,0x354,0x354,0x357,0x9f9,0x357,0x354,0x35a,0x354,0x35a,
+0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,
+0x354,0x35a,0x354,0x35d,0x357,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x351,0x94b,0x94e,
+0x930,0x930,0x1140,0x9f3,0x9f3,0xbb2,0xbaf,0x9fc,0x9f6,0x9fc,0x9f6,0x35a,0x354,0x35a,0x354,0x35a,
+0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,
+0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,
+0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x354,0x35a,0x35d,0x357,0x35a,0x354,
+0xbb2,0xbaf,0x35a,0x354,0xbb2,0xbaf,0x35a,0x354,0xbb2,0xbaf,0xef4,0x35d,0x357,0x35d,0x357,0x35a,
+0x354,0x35d,0x357,0x35a,0x354,0x35d,0x357,0x35d,0x357,0x35d,0x357,0x35a,0x354,0x35d,0x357,0x35d,
+0x357,0x35d,0x357,0x35a,0x354,0x35d,0x357,0x9ff,0x9f9,0x35d,0x357,0x35d,0x357,0x35d,0x357,0x35d,
+0x357,0xdb9,0xdb6,0x35d,0x357,0xef7,0xef4,0xef7,0xef4,0xef7,0xef4,0xc21,0xc1e,0xc21,0xc1e,0xc21,
+0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xc21,0xc1e,0xf24,0xf21,0xf24,0xf21,0x1014,
+0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1014,0x1011,0x1179,
+0x1176,0x1362,0x135f,0x1527,0x1524,0x1527,0x1524,0x1527,0x1524,0x1527,0x1524,0xc,0x36f,0x36f,0x36f,0x36f,
 0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,
-0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0x36f,0xc,0xc,0x372,0x360,0x363,0x363,0x366,0x363,0x360,
-0x192f,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,
+0x36f,0x36f,0x36f,0xc,0xc,0x372,0x360,0x363,0x363,0x366,0x363,0x360,0x192f,0x369,0x369,0x369,
 0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,
-0x369,0x369,0x369,0x36c,0x192f,0x8b5,0xa02,0xc,0xc,0x14f1,0x14f1,0x140d,0xf,0x972,0x972,0x972,
-0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0xdbc,0x972,
-0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x375,0x375,0x375,0x375,
-0x375,0x375,0x375,0x375,0x375,0x375,0xefa,0x375,0x375,0x375,0x381,0x375,0x378,0x375,0x375,0x384,
-0x975,0xdbf,0xdc2,0xdbf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0x387,0x387,0x387,0x387,
+0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x369,0x36c,0x192f,0x8b5,0xa02,
+0xc,0xc,0x14f1,0x14f1,0x140d,0xf,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,
+0x972,0x972,0x972,0x972,0x972,0x972,0x972,0xdbc,0x972,0x972,0x972,0x972,0x972,0x972,0x972,0x972,
+0x972,0x972,0x972,0x972,0x972,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0x375,0xefa,
+0x375,0x375,0x375,0x381,0x375,0x378,0x375,0x375,0x384,0x975,0xdbf,0xdc2,0xdbf,0xf,0xf,0xf,
+0xf,0xf,0xf,0xf,0xf,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,
 0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,0x387,
-0x387,0x387,0x387,0x387,0x387,0x387,0x387,0xf,0xf,0xf,0xf,0x1932,0x387,0x387,0x387,0x37e,
-0x37b,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xf,0xccf,0xccf,0xccf,0xccf,
-0x1410,0x14f4,0xfa2,0xfa2,0xfa2,0xf9f,0xf9f,0xdc8,0x8bb,0xcc9,0xcc6,0xcc6,0xcbd,0xcbd,0xcbd,0xcbd,
-0xcbd,0xcbd,0xf9c,0xf9c,0xf9c,0xf9c,0xf9c,0x8b8,0x14eb,0x12,0xdcb,0x8be,0x1329,0x3a2,0x3a5,0x3a5,
-0x3a5,0x3a5,0x3a5,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
-0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0x8c1,0x3a2,0x3a2,0x3a2,
-0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x936,0x936,0x936,0x936,0x936,0x936,0x936,0x936,0xb52,
-0xb52,0xb52,0xcbd,0xcc3,0xcc0,0xdc5,0xdc5,0xdc5,0xdc5,0xdc5,0xdc5,0x1326,0x951,0x951,0x951,0x951,
-0x951,0x951,0x951,0x951,0x951,0x951,0x39c,0x399,0x396,0x393,0xbb5,0xbb5,0x933,0x3a2,0x3a2,0x3ae,
-0x3a2,0x3a8,0x3a8,0x3a8,0x3a8,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
+0xf,0xf,0xf,0xf,0x1932,0x387,0x387,0x387,0x37e,0x37b,0xf,0xf,0xf,0xf,0xf,0xf,
+0xf,0xf,0xf,0xf,0xf,0xccf,0xccf,0xccf,0xccf,0x1410,0x14f4,0xfa2,0xfa2,0xfa2,0xf9f,0xf9f,
+0xdc8,0x8bb,0xcc9,0xcc6,0xcc6,0xcbd,0xcbd,0xcbd,0xcbd,0xcbd,0xcbd,0xf9c,0xf9c,0xf9c,0xf9c,0xf9c,
+0x8b8,0x14eb,0x12,0xdcb,0x8be,0x1329,0x3a2,0x3a5,0x3a5,0x3a5,0x3a5,0x3a5,0x3a2,0x3a2,0x3a2,0x3a2,
+0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
+0xfa5,0xfa5,0xfa5,0xfa5,0xfa5,0x8c1,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
+0x936,0x936,0x936,0x936,0x936,0x936,0x936,0x936,0xb52,0xb52,0xb52,0xcbd,0xcc3,0xcc0,0xdc5,0xdc5,
+0xdc5,0xdc5,0xdc5,0xdc5,0x1326,0x951,0x951,0x951,0x951,0x951,0x951,0x951,0x951,0x951,0x951,0x39c,
+0x399,0x396,0x393,0xbb5,0xbb5,0x933,0x3a2,0x3a2,0x3ae,0x3a2,0x3a8,0x3a8,0x3a8,0x3a8,0x3a2,0x3a2,
 0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
 0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
 0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
-0xa08,0xa08,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0xa08,0x3a5,0x3a2,0x3a5,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,
-0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0xa08,0x3a2,0x3a2,0x3a2,0x3a5,0x954,0x3a2,0x38d,0x38d,
-0x38d,0x38d,0x38d,0x38d,0x38d,0x38a,0x393,0x390,0x390,0x38d,0x38d,0x38d,0x38d,0x3ab,0x3ab,0x38d,
-0x38d,0x393,0x390,0x390,0x390,0x38d,0xccc,0xccc,0x39f,0x39f,0x39f,0x39f,0x39f,0x39f,0x39f,0x39f,
-0x39f,0x39f,0xa08,0xa08,0xa08,0xa05,0xa05,0xccc,0xa1d,0xa1d,0xa1d,0xa17,0xa17,0xa17,0xa17,0xa17,
-0xa17,0xa17,0xa17,0xa14,0xa17,0xa14,0x15,0xa20,0xa1a,0xa0b,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,
+0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0xa08,0xa08,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0xa08,0x3a5,0x3a2,
+0x3a5,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0x3a2,0xa08,0x3a2,0x3a2,
+0x3a2,0x3a5,0x954,0x3a2,0x38d,0x38d,0x38d,0x38d,0x38d,0x38d,0x38d,0x38a,0x393,0x390,0x390,0x38d,
+0x38d,0x38d,0x38d,0x3ab,0x3ab,0x38d,0x38d,0x393,0x390,0x390,0x390,0x38d,0xccc,0xccc,0x39f,0x39f,
+0x39f,0x39f,0x39f,0x39f,0x39f,0x39f,0x39f,0x39f,0xa08,0xa08,0xa08,0xa05,0xa05,0xccc,0xa1d,0xa1d,
+0xa1d,0xa17,0xa17,0xa17,0xa17,0xa17,0xa17,0xa17,0xa17,0xa14,0xa17,0xa14,0x15,0xa20,0xa1a,0xa0b,
 0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,
-0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xcd2,0xcd2,0xcd2,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,
-0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,
-0xa0e,0xa0e,0xa0e,0x15,0x15,0xcd2,0xcd2,0xcd2,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,
+0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xa1a,0xcd2,0xcd2,0xcd2,0xa11,0xa11,
+0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa11,0xa0e,0xa0e,
+0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0xa0e,0x15,0x15,0xcd2,0xcd2,0xcd2,0xe2b,0xe2b,
 0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,
-0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,
-0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
+0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0xe2b,0x1026,0x1026,0x1026,0x1026,
+0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0x1026,0xa26,0xa26,
+0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
 0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,
-0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa26,0xa23,0xa23,
-0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xbb8,0x18,0x18,0x18,0x18,0x18,0x18,
-0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,
-0xf3c,0xf3c,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,
+0xa26,0xa26,0xa26,0xa26,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xa23,0xbb8,
+0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xf3c,0xf3c,
+0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,0xf3c,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,
 0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,
-0xf3f,0xf3f,0xf3f,0xf33,0xf33,0xf33,0xf33,0xf33,0xf33,0xf33,0xf33,0xf33,0xf42,0xf42,0xf36,0xf36,
-0xf39,0xf48,0xf45,0x10e,0x10e,0x1956,0x1959,0x1959,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,
-0x18ea,0x18ea,0x18ea,0x25b,0x25b,0x25b,0x25b,0x25b,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0xb2b,0xb2b,0xb2e,0xb2e,0xb2b,0xb2b,0xb2b,0xb2b,
-0xb2b,0xb2b,0xb2b,0xb2b,0x72,0x72,0x72,0x72,0x15ab,0x15ab,0x15ab,0x15ab,0x1c2,0x1c2,0x1c2,0x1c2,
-0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x15a8,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1665,
-0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x201,0x201,0x201,0x201,0x201,0x201,0x201,0x201,
-0x201,0x169e,0x169e,0x169e,0x169e,0x169e,0x169e,0x169e,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,
-0x126c,0x177,0x177,0x177,0x177,0x177,0x177,0x177,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,
-0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,
-0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,
-0x14c7,0x14c7,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,
-0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x18d8,0x18db,0x18db,0x258,0x258,0x258,0x258,0x258,
-0x258,0x258,0x258,0x258,0x258,0x258,0x258,0x258,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,
-0x19a4,0x19a4,0x26a,0x26a,0x26a,0x26a,0x26a,0x26a,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x179a,0x179a,0x179a,0x179a,0x21c,0x21c,0x21c,0x21c,
-0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,
-0x1650,0x1650,0x1ef,0x1ef,0x1ef,0x1ef,0x1656,0x1656,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,
-0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,
-0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1704,0x1704,0x1704,0x1704,0x204,0x204,0x204,0x204,
-0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0xe22,0xe22,0xe1f,0xe1f,0xe1f,0xe22,0xdb,0xdb,
-0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x22b,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,
-0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1833,0x1833,0x237,0x1833,0x1833,0x237,0x1833,0x1833,
-0x1833,0x1833,0x1833,0x237,0x237,0x237,0x237,0x237,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,
-0x1a58,0x1a58,0x28b,0x28b,0x28b,0x28b,0x1a5b,0x1a5b,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0x270,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,
-0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,
-0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0,0,0,0,0,0,0,0,
+0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf3f,0xf33,0xf33,0xf33,0xf33,0xf33,0xf33,0xf33,
+0xf33,0xf33,0xf42,0xf42,0xf36,0xf36,0xf39,0xf48,0xf45,0x10e,0x10e,0x1956,0x1959,0x1959,0x11a3,0x11a3,
+0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,
+0x11a3,0x11a3,0x11a3,0x11a3,0x119a,0x119a,0x119d,0x119d,0x11a3,0x119a,0x119a,0x119a,0x119a,0x119a,0x119a,0x119a,
+0x119a,0x119a,0x11a3,0x119a,0x119a,0x119a,0x11a3,0x119a,0x119a,0x119a,0x119a,0x1197,0x14a,0x14a,0x11a0,0x11a0,
+0x11a0,0x11a0,0x11a0,0x11a0,0x11a0,0x11a6,0x11a0,0x11a6,0x11a0,0x11a0,0x11a0,0x11a6,0x11a6,0x14a,0x1386,0x1386,
+0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,
+0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1380,0x1380,0x1380,0x189,0x189,0x1383,0x189,0x18ea,0x18ea,
+0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x18ea,0x25b,0x25b,0x25b,0x25b,0x25b,0,0,
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0x96f,0x96f,3,3,3,3,3,3,3,3,
-3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
-3,3,3,3,3,3,3,3,3,3,0x96f,0x96f,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,0xd80,0xd80,0xd80,0xd80,
-0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,6,6,6,6,
-6,6,6,6,6,6,6,6,6,6,6,6,0x14fa,0x3c6,0x3d5,0x3d5,
-0x1b,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x1b,0x1b,0x3db,0x3db,0x1b,0x1b,0x3db,
-0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x1b,0x3db,0x3db,
-0x3db,0x3db,0x3db,0x3db,0x3db,0x1b,0x3db,0x1b,0x1b,0x1b,0x3db,0x3db,0x3db,0x3db,0x1b,0x1b,
-0x3c9,0xcd8,0x3c6,0x3d5,0x3d5,0x3c6,0x3c6,0x3c6,0x3c6,0x1b,0x1b,0x3d5,0x3d5,0x1b,0x1b,0x3d8,
-0x3d8,0x3cc,0xdd1,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x3c6,0x1b,0x1b,0x1b,0x1b,
-0x3de,0x3de,0x1b,0x3de,0x3db,0x3db,0x3c6,0x3c6,0x1b,0x1b,0x95a,0x95a,0x95a,0x95a,0x95a,0x95a,
-0x95a,0x95a,0x95a,0x95a,0x3db,0x3db,0x3d2,0x3d2,0x3cf,0x3cf,0x3cf,0x3cf,0x3cf,0x3d2,0x3cf,0x114f,
-0x1893,0x1890,0x1935,0x1b,0x1e,0xcdb,0x3e1,0xcde,0x1e,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x1e,
-0x1e,0x1e,0x1e,0x3ed,0x3ed,0x1e,0x1e,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,
-0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x1e,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x1e,0x3ed,0x3f0,
-0x1e,0x3ed,0x3f0,0x1e,0x3ed,0x3ed,0x1e,0x1e,0x3e4,0x1e,0x3ea,0x3ea,0x3ea,0x3e1,0x3e1,0x1e,
-0x1e,0x1e,0x1e,0x3e1,0x3e1,0x1e,0x1e,0x3e1,0x3e1,0x3e7,0x1e,0x1e,0x1e,0xfae,0x1e,0x1e,
-0x1e,0x1e,0x1e,0x1e,0x1e,0x3f0,0x3f0,0x3f0,0x3ed,0x1e,0x3f0,0x1e,0x1e,0x1e,0x1e,0x1e,
-0x1e,0x1e,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x3e1,0x3e1,0x3ed,0x3ed,
-0x3ed,0xfae,0x1938,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x21,0x3f3,0x3f3,0x3fc,
-0x21,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0xce7,0x3ff,0x21,0x3ff,0x3ff,0x3ff,0x21,0x3ff,
-0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x21,0x3ff,0x3ff,
-0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x21,0x3ff,0x3ff,0x21,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x21,0x21,
-0x3f6,0x3ff,0x3fc,0x3fc,0x3fc,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x21,0x3f3,0x3f3,0x3fc,0x21,0x3fc,
-0x3fc,0x3f9,0x21,0x21,0x3ff,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
-0x21,0x21,0x21,0x21,0x3ff,0xce7,0xce1,0xce1,0x21,0x21,0x960,0x960,0x960,0x960,0x960,0x960,
-0x960,0x960,0x960,0x960,0x1413,0xce4,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x1716,0x1896,0x1896,
-0x1896,0x1899,0x1899,0x1899,0x24,0x402,0x411,0x411,0x24,0x417,0x417,0x417,0x417,0x417,0x417,0x417,
-0x417,0x24,0x24,0x417,0x417,0x24,0x24,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,
-0x417,0x417,0x417,0x417,0x417,0x24,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x24,0x417,0x417,
-0x24,0xcea,0x417,0x417,0x417,0x417,0x24,0x24,0x405,0x417,0x402,0x402,0x411,0x402,0x402,0x402,
-0xfb1,0x24,0x24,0x411,0x414,0x24,0x24,0x414,0x414,0x408,0x24,0x24,0x24,0x24,0x24,0x24,
-0x24,0x24,0x402,0x402,0x24,0x24,0x24,0x24,0x41a,0x41a,0x24,0x417,0x417,0x417,0xfb1,0xfb1,
-0x24,0x24,0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40b,0xcea,0x1335,0x1335,
-0x1335,0x1335,0x1335,0x1335,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x27,0x27,0x41d,0x429,
-0x27,0x429,0x429,0x429,0x429,0x429,0x429,0x27,0x27,0x27,0x429,0x429,0x429,0x27,0x429,0x429,
-0x42c,0x429,0x27,0x27,0x27,0x429,0x429,0x27,0x429,0x27,0x429,0x429,0x27,0x27,0x27,0x429,
-0x429,0x27,0x27,0x27,0x429,0x429,0x429,0x27,0x27,0x27,0x429,0x429,0x429,0x429,0x429,0x429,
-0x429,0x429,0xdd4,0x429,0x429,0x429,0x27,0x27,0x27,0x27,0x41d,0x423,0x41d,0x423,0x423,0x27,
-0x27,0x27,0x423,0x423,0x423,0x27,0x426,0x426,0x426,0x420,0x27,0x27,0xfb4,0x27,0x27,0x27,
-0x27,0x27,0x27,0x41d,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0xee8,0x966,
-0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x966,0x963,0x963,0x963,0xda4,0xced,0xced,0xced,0xced,
-0xced,0xcf0,0xced,0x27,0x27,0x27,0x27,0x27,0x14fd,0x43b,0x43b,0x43b,0x193b,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x2a,0x43e,0x43e,0x43e,0x2a,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x2a,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
-0x43e,0x43e,0x43e,0x43e,0x1500,0x43e,0x43e,0x43e,0x43e,0x43e,0x2a,0x2a,0x2a,0xfbd,0x42f,0x42f,
-0x42f,0x43b,0x43b,0x43b,0x43b,0x2a,0x42f,0x42f,0x432,0x2a,0x42f,0x42f,0x42f,0x435,0x2a,0x2a,
-0x2a,0x2a,0x2a,0x2a,0x2a,0x42f,0x42f,0x2a,0xfbd,0xfbd,0x1719,0x2a,0x2a,0x2a,0x2a,0x2a,
-0x43e,0x43e,0xfb7,0xfb7,0x2a,0x2a,0x438,0x438,0x438,0x438,0x438,0x438,0x438,0x438,0x438,0x438,
-0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x1a07,0xfba,0xfba,0xfba,0xfba,0xfba,0xfba,0xfba,0xfba,
-0x17d6,0x1503,0x447,0x447,0x193e,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x2d,0x44d,0x44d,
-0x44d,0x2d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,
-0x44d,0x2d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x2d,0x44d,0x44d,0x44d,
-0x44d,0x44d,0x2d,0x2d,0xcf3,0xcf6,0x447,0x441,0x44a,0x447,0x441,0x447,0x447,0x2d,0x441,0x44a,
-0x44a,0x2d,0x44a,0x44a,0x441,0x444,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x441,0x441,0x2d,
-0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x44d,0x2d,0x44d,0x44d,0xf00,0xf00,0x2d,0x2d,0x969,0x969,
-0x969,0x969,0x969,0x969,0x969,0x969,0x969,0x969,0x2d,0xf03,0xf03,0x2d,0x2d,0x2d,0x2d,0x2d,
-0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x189c,0x1506,0x459,0x459,0x30,0x45f,0x45f,0x45f,
-0x45f,0x45f,0x45f,0x45f,0x45f,0x30,0x45f,0x45f,0x45f,0x30,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,
-0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x459,0x450,0x450,0x450,0xfc0,0x30,0x459,0x459,
-0x459,0x30,0x45c,0x45c,0x45c,0x453,0x133b,0x17d9,0x30,0x30,0x30,0x30,0x17dc,0x17dc,0x17dc,0x450,
-0x17d9,0x17d9,0x17d9,0x17d9,0x17d9,0x17d9,0x17d9,0x171c,0x45f,0x45f,0xfc0,0xfc0,0x30,0x30,0x456,0x456,
-0x456,0x456,0x456,0x456,0x456,0x456,0x456,0x456,0xfc3,0xfc3,0xfc3,0xfc3,0xfc3,0xfc3,0x17d9,0x17d9,
-0x17d9,0xfc6,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0xfc9,0x33,0x33,0xa32,0xa32,0x33,0xa38,0xa38,0xa38,
-0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0x33,
-0x33,0x33,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0x1458,0x1596,
+0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1596,0x1596,0x1596,0x1596,0x1596,
+0x1596,0x174f,0x174f,0x1a1,0x17fa,0x17fa,0x17fa,0x17fa,0x17fa,0x17fa,0x17fa,0x17fa,0x1a1,0x1a1,0x1a1,0x1a1,
+0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1971,
+0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f4,0x17f4,0x17f1,0x174c,
+0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1455,0x1455,0x1455,0x1455,
+0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1593,0x1146,0x3b1,0x3b1,0x3bd,
+0xcd5,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,
+0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,
+0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c3,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c3,0x3c0,0x3c0,
+0x3c3,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x132c,0x132f,0x3b4,0x3c0,0x3bd,0x3bd,0x3b1,0x3b1,0x3b1,0x3b1,
+0x3b1,0x3b1,0x3b1,0x3b1,0x3bd,0x3bd,0x3bd,0x3bd,0x3b7,0x1149,0x132f,0x3c0,0x939,0x93c,0x3b4,0x3b4,
+0x1146,0x132c,0x132c,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c0,0x3c0,0x3b1,0x3b1,0x8c4,
+0x8c7,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x3ba,0xfab,0xfa8,0x1332,0x1332,
+0x1332,0x1332,0x1332,0x14f7,0x114c,0x114c,0xefd,0xefd,0xdce,0xefd,0xefd,0x14fa,0x3c6,0x3d5,0x3d5,0x1b,
+0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x1b,0x1b,0x3db,0x3db,0x1b,0x1b,0x3db,0x3db,
+0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,
+0x3db,0x3db,0x3db,0x3db,0x1b,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x3db,0x1b,0x3db,0x1b,0x1b,
+0x1b,0x3db,0x3db,0x3db,0x3db,0x1b,0x1b,0x3c9,0xcd8,0x3c6,0x3d5,0x3c6,0x3c6,0x3c6,0x3c6,0x1b,
+0x1b,0x3d5,0x3d5,0x1b,0x1b,0x3d8,0x3d8,0x3cc,0xdd1,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,0x1b,
+0x1b,0x3c6,0x1b,0x1b,0x1b,0x1b,0x3de,0x3de,0x1b,0x3de,0x3db,0x3db,0x3c6,0x3c6,0x1b,0x1b,
+0x95a,0x95a,0x95a,0x95a,0x95a,0x95a,0x95a,0x95a,0x95a,0x95a,0x3db,0x3db,0x3d2,0x3d2,0x3cf,0x3cf,
+0x3cf,0x3cf,0x3cf,0x3d2,0x3cf,0x114f,0x1893,0x1890,0x1935,0x1b,0x1e,0xcdb,0x3e1,0xcde,0x1e,0x3ed,
+0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x1e,0x1e,0x1e,0x1e,0x3ed,0x3ed,0x1e,0x1e,0x3ed,0x3ed,0x3ed,
+0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,
+0x3ed,0x3ed,0x3ed,0x1e,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x3ed,0x1e,0x3ed,0x3f0,0x1e,0x3ed,
+0x3f0,0x1e,0x3ed,0x3ed,0x1e,0x1e,0x3e4,0x1e,0x3ea,0x3ea,0x3e1,0x3e1,0x1e,0x1e,0x1e,0x1e,
+0x3e1,0x3e1,0x1e,0x1e,0x3e1,0x3e1,0x3e7,0x1e,0x1e,0x1e,0xfae,0x1e,0x1e,0x1e,0x1e,0x1e,
+0x1e,0x1e,0x3f0,0x3f0,0x3f0,0x3ed,0x1e,0x3f0,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x95d,
+0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x95d,0x3e1,0x3e1,0x3ed,0x3ed,0x3ed,0xfae,0x1938,
+0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x1e,0x21,0x3f3,0x3f3,0x3fc,0x21,0x3ff,0x3ff,
+0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0xce7,0x3ff,0x21,0x3ff,0x3ff,0x3ff,0x21,0x3ff,0x3ff,0x3ff,0x3ff,
+0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,
+0x3ff,0x3ff,0x21,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x3ff,0x21,0x3ff,0x3ff,0x21,0x3ff,0x3ff,
+0x3ff,0x3ff,0x3ff,0x21,0x21,0x3f6,0x3ff,0x3fc,0x3fc,0x3f3,0x3f3,0x3f3,0x3f3,0x3f3,0x21,0x3f3,
+0x3f3,0x3fc,0x21,0x3fc,0x3fc,0x3f9,0x21,0x21,0x3ff,0x21,0x21,0x21,0x21,0x21,0x21,0x21,
+0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x3ff,0xce7,0xce1,0xce1,0x21,0x21,0x960,0x960,
+0x960,0x960,0x960,0x960,0x960,0x960,0x960,0x960,0x1413,0xce4,0x21,0x21,0x21,0x21,0x21,0x21,
+0x21,0x1716,0x1896,0x1896,0x1896,0x1899,0x1899,0x1899,0x24,0x402,0x411,0x411,0x24,0x417,0x417,0x417,
+0x417,0x417,0x417,0x417,0x417,0x24,0x24,0x417,0x417,0x24,0x24,0x417,0x417,0x417,0x417,0x417,
+0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x417,
+0x417,0x24,0x417,0x417,0x417,0x417,0x417,0x417,0x417,0x24,0x417,0x417,0x24,0xcea,0x417,0x417,
+0x417,0x417,0x24,0x24,0x405,0x417,0x402,0x402,0x411,0x402,0x402,0x402,0xfb1,0x24,0x24,0x411,
+0x414,0x24,0x24,0x414,0x414,0x408,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x402,0x402,
+0x24,0x24,0x24,0x24,0x41a,0x41a,0x24,0x417,0x417,0x417,0xfb1,0xfb1,0x24,0x24,0x40e,0x40e,
+0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40e,0x40b,0xcea,0x1335,0x1335,0x1335,0x1335,0x1335,0x1335,
+0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x27,0x27,0x41d,0x429,0x27,0x429,0x429,0x429,
+0x429,0x429,0x429,0x27,0x27,0x27,0x429,0x429,0x429,0x27,0x429,0x429,0x42c,0x429,0x27,0x27,
+0x27,0x429,0x429,0x27,0x429,0x27,0x429,0x429,0x27,0x27,0x27,0x429,0x429,0x27,0x27,0x27,
+0x429,0x429,0x429,0x27,0x27,0x27,0x429,0x429,0x429,0x429,0x429,0x429,0x429,0x429,0xdd4,0x429,
+0x429,0x429,0x27,0x27,0x27,0x27,0x41d,0x423,0x423,0x27,0x27,0x27,0x423,0x423,0x423,0x27,
+0x426,0x426,0x426,0x420,0x27,0x27,0xfb4,0x27,0x27,0x27,0x27,0x27,0x27,0x41d,0x27,0x27,
+0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,0xee8,0x966,0x966,0x966,
+0x966,0x966,0x966,0x966,0x966,0x966,0x963,0x963,0x963,0xda4,0xced,0xced,0xced,0xced,0xced,0xcf0,
+0xced,0x27,0x27,0x27,0x27,0x27,0x14fd,0x43b,0x43b,0x43b,0x193b,0x43e,0x43e,0x43e,0x43e,0x43e,
+0x43e,0x43e,0x43e,0x2a,0x43e,0x43e,0x43e,0x2a,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,
+0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x2a,
+0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x43e,0x1500,0x43e,0x43e,0x43e,0x43e,0x43e,
+0x2a,0x2a,0x2a,0xfbd,0x42f,0x42f,0x43b,0x43b,0x43b,0x43b,0x2a,0x42f,0x42f,0x432,0x2a,0x42f,
+0x42f,0x42f,0x435,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x42f,0x42f,0x2a,0xfbd,0xfbd,0x1719,
+0x2a,0x2a,0x2a,0x2a,0x2a,0x43e,0x43e,0xfb7,0xfb7,0x2a,0x2a,0x438,0x438,0x438,0x438,0x438,
+0x438,0x438,0x438,0x438,0x438,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x2a,0x1a07,0xfba,0xfba,0xfba,
+0xfba,0xfba,0xfba,0xfba,0xfba,0x17d6,0x1503,0x447,0x447,0x193e,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,
+0x44d,0x44d,0x2d,0x44d,0x44d,0x44d,0x2d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,
+0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x2d,0x44d,
+0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x44d,0x2d,0x44d,0x44d,0x44d,0x44d,0x44d,0x2d,
+0x2d,0xcf3,0xcf6,0x447,0x441,0x44a,0x447,0x441,0x447,0x447,0x2d,0x441,0x44a,0x44a,0x2d,0x44a,
+0x44a,0x441,0x444,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x441,0x441,0x2d,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x2d,0x44d,0x2d,0x44d,0x44d,0xf00,0xf00,0x2d,0x2d,0x969,0x969,0x969,0x969,0x969,
+0x969,0x969,0x969,0x969,0x969,0x2d,0xf03,0xf03,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,
+0x2d,0x2d,0x2d,0x2d,0x2d,0x189c,0x1506,0x459,0x459,0x30,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,
+0x45f,0x45f,0x30,0x45f,0x45f,0x45f,0x30,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x1338,0x45f,
+0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x1338,
+0x189f,0x189f,0xfc9,0x450,0x459,0x450,0x450,0x450,0xfc0,0x30,0x459,0x459,0x459,0x30,0x45c,0x45c,
+0x45c,0x453,0x133b,0x17d9,0x30,0x30,0x30,0x30,0x17dc,0x17dc,0x17dc,0x450,0x17d9,0x17d9,0x17d9,0x17d9,
+0x17d9,0x17d9,0x17d9,0x171c,0x45f,0x45f,0xfc0,0xfc0,0x30,0x30,0x456,0x456,0x456,0x456,0x456,0x456,
+0x456,0x456,0x456,0x456,0xfc3,0xfc3,0xfc3,0xfc3,0xfc3,0xfc3,0x17d9,0x17d9,0x17d9,0xfc6,0xfc9,0xfc9,
+0xfc9,0xfc9,0xfc9,0xfc9,0x33,0x33,0xa32,0xa32,0x33,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,
+0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0x33,0x33,0x33,0xa38,0xa38,
+0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,
 0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0x33,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,
 0x33,0xa38,0x33,0x33,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0xa38,0x33,0x33,0x33,0xa2c,0x33,
 0x33,0x33,0x33,0xa29,0xa32,0xa32,0xa29,0xa29,0xa29,0x33,0xa29,0x33,0xa32,0xa32,0xa35,0xa32,
@@ -1962,1377 +1701,1192 @@ static const uint16_t propsVectorsTrie_index[30604]={
 0x1509,0x1509,0x1509,0x1509,0x33,0x33,0xa32,0xa32,0xa2f,0x33,0x33,0x33,0x33,0x33,0x33,0x33,
 0x33,0x33,0x33,0x33,0x36,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,
 0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,
+0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,0x47a,
 0x47a,0x47a,0x47a,0x47a,0x47a,0x465,0x47a,0x477,0x465,0x465,0x465,0x465,0x465,0x465,0x46b,0x36,
 0x36,0x36,0x36,0x462,0x480,0x480,0x480,0x480,0x480,0x47a,0x47d,0x468,0x468,0x468,0x468,0x468,
 0x468,0x465,0x468,0x46e,0x474,0x474,0x474,0x474,0x474,0x474,0x474,0x474,0x474,0x474,0x471,0x471,
 0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,
 0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x36,
-0x39,0x48f,0x48f,0x39,0x48f,0x39,0x1a0d,0x48f,0x48f,0x1a0d,0x48f,0x39,0x1a0d,0x48f,0x1a0d,0x1a0d,
-0x1a0d,0x1a0d,0x1a0d,0x1a0d,0x48f,0x48f,0x48f,0x48f,0x1a0d,0x48f,0x48f,0x48f,0x48f,0x48f,0x48f,0x48f,
-0x1a0d,0x48f,0x48f,0x48f,0x39,0x48f,0x39,0x48f,0x1a0d,0x1a0d,0x48f,0x48f,0x1a0d,0x48f,0x48f,0x48f,
-0x48f,0x483,0x48f,0x48c,0x483,0x483,0x483,0x483,0x483,0x483,0x1a0a,0x483,0x483,0x48f,0x39,0x39,
-0x498,0x498,0x498,0x498,0x498,0x39,0x495,0x39,0x486,0x486,0x486,0x486,0x486,0x483,0x39,0x39,
-0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x39,0x39,0x492,0x492,0x1416,0x1416,
+0x36,0x36,0x36,0x36,0x39,0x48f,0x48f,0x39,0x48f,0x39,0x1a0d,0x48f,0x48f,0x1a0d,0x48f,0x39,
+0x1a0d,0x48f,0x1a0d,0x1a0d,0x1a0d,0x1a0d,0x1a0d,0x1a0d,0x48f,0x48f,0x48f,0x48f,0x1a0d,0x48f,0x48f,0x48f,
+0x48f,0x48f,0x48f,0x48f,0x1a0d,0x48f,0x48f,0x48f,0x39,0x48f,0x39,0x48f,0x1a0d,0x1a0d,0x48f,0x48f,
+0x1a0d,0x48f,0x48f,0x48f,0x48f,0x483,0x48f,0x48c,0x483,0x483,0x483,0x483,0x483,0x483,0x1a0a,0x483,
+0x483,0x48f,0x39,0x39,0x498,0x498,0x498,0x498,0x498,0x39,0x495,0x39,0x486,0x486,0x486,0x486,
+0x486,0x483,0x39,0x39,0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x489,0x39,0x39,
+0x492,0x492,0x1416,0x1416,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
 0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
-0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
-0x9ab,0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,0x3c,0x9ab,0x9ab,0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,
-0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,
-0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ae,0xa47,0xfd5,0xfd5,0x3c,0x3c,0x3c,
-0x3c,0x978,0x978,0x97b,0x978,0x97b,0x97b,0x984,0x97b,0x984,0x978,0x978,0x978,0x978,0x978,0x9a5,
-0x978,0x97b,0x97e,0x97e,0x981,0x98a,0x97e,0x97e,0x9ab,0x9ab,0x9ab,0x9ab,0x1344,0x133e,0x133e,0x133e,
-0x978,0x978,0x978,0x97b,0x978,0x978,0xa3b,0x978,0x3c,0x978,0x978,0x978,0x978,0x97b,0x978,0x978,
-0x978,0x978,0x97b,0x978,0x978,0x978,0x978,0x97b,0x978,0x978,0x978,0x978,0x97b,0x978,0xa3b,0xa3b,
-0xa3b,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0xa3b,0x97b,0xa3b,0xa3b,0xa3b,0x3c,0xa44,0xa44,
-0xa41,0xa41,0xa41,0xa41,0xa41,0xa41,0xa3e,0xa41,0xa41,0xa41,0xa41,0xa41,0xa41,0x3c,0xfcc,0xa41,
-0xdd7,0xdd7,0xfcf,0xfd2,0xfcc,0x1152,0x1152,0x1152,0x1152,0x1341,0x1341,0x3c,0x3c,0x3c,0x3c,0x3c,
+0x39,0x39,0x39,0x39,0x9ab,0x98d,0x98d,0x98d,0x98d,0x987,0x98d,0x98d,0x99f,0x98d,0x98d,0x98a,
+0x996,0x99c,0x99c,0x99c,0x99c,0x99c,0x99f,0x987,0x993,0x987,0x987,0x987,0x97e,0x97e,0x987,0x987,
+0x987,0x987,0x987,0x987,0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x987,0x987,
+0x987,0x987,0x987,0x987,0x987,0x987,0x987,0x987,0x98a,0x97e,0x987,0x97e,0x987,0x97e,0x999,0x990,
+0x999,0x990,0x9a8,0x9a8,0x9ab,0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,0x3c,0x9ab,0x9ab,0x9ab,
+0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,
+0x9ae,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ab,0x9ae,0xa47,0xfd5,
+0xfd5,0x3c,0x3c,0x3c,0x3c,0x978,0x978,0x97b,0x978,0x97b,0x97b,0x984,0x97b,0x984,0x978,0x978,
+0x978,0x978,0x978,0x9a5,0x978,0x97b,0x97e,0x97e,0x981,0x98a,0x97e,0x97e,0x9ab,0x9ab,0x9ab,0x9ab,
+0x1344,0x133e,0x133e,0x133e,0x978,0x978,0x978,0x97b,0x978,0x978,0xa3b,0x978,0x3c,0x978,0x978,0x978,
+0x978,0x97b,0x978,0x978,0x978,0x978,0x97b,0x978,0x978,0x978,0x978,0x97b,0x978,0x978,0x978,0x978,
+0x97b,0x978,0xa3b,0xa3b,0xa3b,0x978,0x978,0x978,0x978,0x978,0x978,0x978,0xa3b,0x97b,0xa3b,0xa3b,
+0xa3b,0x3c,0xa44,0xa44,0xa41,0xa41,0xa41,0xa41,0xa41,0xa41,0xa3e,0xa41,0xa41,0xa41,0xa41,0xa41,
+0xa41,0x3c,0xfcc,0xa41,0xdd7,0xdd7,0xfcf,0xfd2,0xfcc,0x1152,0x1152,0x1152,0x1152,0x1341,0x1341,0x3c,
+0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,
 0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,
-0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x3c,0x49e,0x49e,0x49e,0x49e,
+0x3c,0x3c,0x3c,0x3c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,
+0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,
+0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xff0,0xa5c,0xa5c,0xa5c,0xa5f,0xa5c,0xff0,0xa5c,0xa5c,0xfe7,
+0xa56,0xa4a,0xa4a,0xa4a,0xa4a,0xa59,0xa4a,0xfd8,0xfd8,0xfd8,0xa4a,0xa4d,0xa56,0xa50,0xfde,0xfea,
+0xfea,0xfd8,0xfd8,0xff0,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xa62,0xa62,
+0xa53,0xa53,0xa53,0xa53,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa59,0xa59,0xa4a,0xa4a,0xff0,0xff0,
+0xff0,0xff0,0xfd8,0xfd8,0xfd8,0xff0,0xfe7,0xfed,0xfed,0xff0,0xff0,0xfe7,0xfe7,0xfed,0xfed,0xfed,
+0xfed,0xfed,0xff0,0xff0,0xff0,0xfd8,0xfd8,0xfd8,0xfd8,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,
+0xff0,0xff0,0xff0,0xff0,0xfd8,0xfe7,0xfea,0xfd8,0xfd8,0xfed,0xfed,0xfed,0xfed,0xfed,0xfed,0xfdb,
+0xff0,0xfed,0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0x115b,0x115b,0x1158,0x1155,
+0xfe1,0xfe1,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,
+0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,
 0x49e,0x49e,0x3f,0x141c,0x3f,0x3f,0x3f,0x3f,0x3f,0x141c,0x3f,0x3f,0x49b,0x49b,0x49b,0x49b,
-0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xde6,0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0x42,0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xde6,0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,
-0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0x42,
-0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0x42,0x42,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0x42,0x42,0x1347,0x1347,0xde0,
-0xde3,0xa6b,0xa74,0xa68,0xa68,0xa68,0xa68,0xa74,0xa74,0xa6e,0xa6e,0xa6e,0xa6e,0xa6e,0xa6e,0xa6e,
-0xa6e,0xa6e,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0x42,0x42,0x42,
+0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,
+0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,
+0x49b,0x49b,0x49b,0xbbb,0xbbb,0xdda,0xdda,0x8ca,0xddd,0x1419,0x1419,0x1419,0x80a,0x80a,0x80a,0x80a,
+0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,
+0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,
+0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,
+0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x12c9,0x12c9,0x12c9,0x12c9,
+0x12c9,0x80d,0x4a7,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,
+0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,
+0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x1161,0x1161,0x1161,0x1161,0x1161,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,
+0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,
+0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,
+0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,
+0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xde6,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0x42,0xa71,0xa71,
+0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0x42,0xa71,0x42,0xa71,0xa71,
+0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0x42,0xa71,
+0xa71,0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0x42,0xa71,0xa71,0xa71,
+0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0x42,0xa71,0xa71,
+0xa71,0xa71,0x42,0x42,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0xa71,0xa71,
+0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
+0x42,0x42,0x1347,0x1347,0xde0,0xde3,0xa6b,0xa74,0xa68,0xa68,0xa68,0xa68,0xa74,0xa74,0xa6e,0xa6e,
+0xa6e,0xa6e,0xa6e,0xa6e,0xa6e,0xa6e,0xa6e,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,0xa65,
+0xa65,0xa65,0x42,0x42,0x42,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,
+0xe52,0xe52,0xe52,0xe52,0xe52,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xf0,
+0xf0,0xf0,0xf0,0xf0,0xf0,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,
+0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,
 0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,
-0xa77,0xa77,0xa77,0xa77,0xa77,0x1722,0x45,0x45,0x171f,0x171f,0x171f,0x171f,0x171f,0x171f,0x45,0x45,
-0xa89,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,
-0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa86,0xa83,0x48,0x48,0x48,
-0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa8f,0xa8f,0xa8f,0xa92,0xa92,
-0xa92,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,
-0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xa95,0xab3,0xab3,0xa98,0xa98,0xa98,0xa98,0xa98,0xa98,0xa98,
-0xa98,0xa98,0xa9b,0xa98,0xaaa,0xaaa,0xaad,0xab6,0xaa4,0xaa1,0xaaa,0xaa7,0xab6,0xcf9,0x4e,0x4e,
-0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,
-0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,
-0xac5,0xac5,0xb46,0xb49,0xacb,0xb43,0xac8,0xac5,0xace,0xadd,0xad1,0xae0,0xae0,0xae0,0xabc,0x51,
-0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0x51,0x51,0x51,0x51,0x51,0x51,
+0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0x1722,0x45,0x45,0x171f,0x171f,0x171f,
+0x171f,0x171f,0x171f,0x45,0x45,0x1164,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
+0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
+0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
+0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
+0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7a,0xa80,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
+0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0xa89,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,
+0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,0xa8c,
+0xa8c,0xa8c,0xa8c,0xa8c,0xa86,0xa83,0x48,0x48,0x48,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,
+0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,
+0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,
+0xa92,0xa92,0xa92,0xa92,0xa8f,0xa8f,0xa8f,0xa92,0xa92,0xa92,0x150c,0x150c,0x150c,0x150c,0x150c,0x150c,
+0x150c,0x150c,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0x4b,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,
+0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xb1,0xc2a,0xc2a,0xc2a,0xc2a,0xc24,0xc24,0xc27,0xb1,0xb1,
+0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,
+0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc2d,0xc2d,0xc30,0xc99,0xc99,
+0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,
+0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc36,0xc36,0xb7,0xb7,0xb7,
+0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,
+0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xba,0xc3f,0xc3f,0xc3f,0xba,0xc3c,0xc3c,0xba,0xba,0xba,
+0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
+0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
+0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab9,0xab9,0xab6,0xab6,
+0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xa9e,0xa9e,0xab3,
+0xa95,0xa95,0xa95,0xa95,0xa95,0xa95,0xa95,0xab3,0xab3,0xab3,0xab3,0xab3,0xab3,0xa95,0xab3,0xab3,
+0xa98,0xa98,0xa98,0xa98,0xa98,0xa98,0xa98,0xa98,0xa98,0xa9b,0xa98,0xaaa,0xaaa,0xaad,0xab6,0xaa4,
+0xaa1,0xaaa,0xaa7,0xab6,0xcf9,0x4e,0x4e,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,0xab0,
+0xab0,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,0xcfc,
+0xcfc,0x4e,0x4e,0x4e,0x4e,0x4e,0x4e,0xac5,0xac5,0xb46,0xb49,0xacb,0xb43,0xac8,0xac5,0xace,
+0xadd,0xad1,0xae0,0xae0,0xae0,0xabc,0x51,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,0xad4,
+0xad4,0x51,0x51,0x51,0x51,0x51,0x51,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
 0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0x1941,0x51,0x51,0x51,0x51,0x51,0x51,0x51,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xabf,0xff3,0x51,0x51,0x51,0x51,0x51,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0x1941,0x51,0x51,0x51,
+0x51,0x51,0x51,0x51,0xad7,0xad7,0xad7,0xad7,0xad7,0xac2,0xac2,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
+0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xabf,0xff3,0x51,
+0x51,0x51,0x51,0x51,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
 0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x54,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x54,0x54,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x4bf,0x54,0x4bf,0x54,0x4bf,0x54,0x4bf,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x54,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b6,0x4bc,0x4b6,
-0x4b6,0x4b3,0x4bc,0x4bc,0x4bc,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b3,0x4b3,0x4b3,
-0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x54,0x4b3,0x4b3,0x4b3,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b3,0x4b3,0x4b3,
-0x54,0x54,0x4bc,0x4bc,0x4bc,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b9,0x4b6,0x54,
-0xbbe,0xbc1,0xbc1,0xbc1,0xffc,0x57,0x14e8,0x14e8,0x14e8,0x14e8,0x4c8,0x4c8,0x4c8,0x4c8,0x4c8,0x4c8,
-0x513,0xbd3,0x5a,0x5a,0x6d2,0x513,0x513,0x513,0x513,0x513,0x519,0x52b,0x519,0x525,0x51f,0x6d5,
-0x510,0x6cf,0x6cf,0x6cf,0x6cf,0x510,0x510,0x510,0x510,0x510,0x516,0x528,0x516,0x522,0x51c,0x5a,
-0xdef,0xdef,0xdef,0xdef,0xdef,0x134a,0x134a,0x134a,0x134a,0x134a,0x134a,0x134a,0x134a,0x5a,0x5a,0x5a,
-0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,
-0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x537,0x537,0x537,
-0x537,0x53a,0xaef,0xaf2,0xbd9,0xbdf,0xbdf,0xbdc,0xbdc,0xbdc,0xbdc,0xdf5,0xf06,0xf06,0xf06,0xf06,
-0x113d,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,
-0x56a,0x56a,0x56a,0xafb,0xf0f,0x1002,0x1002,0x1002,0x1002,0x129c,0x1728,0x1728,0x63,0x63,0x63,0x63,
-0x6fc,0x6fc,0x6fc,0x6fc,0x6ff,0x6ff,0x6ff,0x6ff,0x6ff,0x6ff,0x576,0x576,0x573,0x573,0x573,0x573,
-0x59d,0x59d,0x59d,0x59d,0x59d,0xb07,0xb07,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
-0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
-0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x69,0x69,0x69,0x69,0x69,
-0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,
-0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,
-0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0x6c,0xb22,0xb22,0xb22,0xb22,0xb25,
-0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,
-0xb22,0xb22,0xb22,0xb25,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,
-0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,
-0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,
-0x75,0x834,0x82e,0x834,0x82e,0x834,0x82e,0x834,0x82e,0x834,0x82e,0x82e,0x831,0x82e,0x831,0x82e,
-0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,
-0x82e,0x82e,0x82e,0x834,0x82e,0x834,0x82e,0x834,0x82e,0x82e,0x82e,0x82e,0x82e,0x82e,0x834,0x82e,
-0x82e,0x82e,0x82e,0x82e,0x831,0xc87,0xc87,0x75,0x75,0x948,0x948,0x912,0x912,0x837,0x83a,0xc84,
-0x78,0x78,0x78,0x78,0x78,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,
-0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,
-0x84c,0x112b,0x190b,0x19ef,0x7b,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,
-0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x7b,0x91b,0x91b,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,
-0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,
-0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,
-0x13dd,0x13dd,0x13dd,0x7e,0x7e,0x7e,0x7e,0x7e,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,
-0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,
-0x858,0x858,0x858,0x858,0x858,0xd8c,0xd8c,0x81,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,
-0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,
-0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x81,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
-0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0x84,0x84,0x84,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,
-0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xc90,0xb40,0xb40,0xb40,0xc90,0xb40,0x87,
-0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,
-0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x9cf,0x9cf,0x9cf,0x9cf,0x8a,0x8a,0x8a,0x8a,
-0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,
-0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x5fd,0x5fd,0x5fd,0x5fd,0x5fd,0x5fd,0x5fd,0x8d,
-0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x5eb,0x5eb,0x5eb,0x5eb,0x5eb,
-0x8d,0x8d,0x8d,0x8d,0x8d,0xb13,0x5ee,0x5f4,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,
-0x5fa,0x5f1,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x8d,
-0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x8d,0x5f4,0x8d,0x5f4,0x5f4,0x8d,0x5f4,0x5f4,0x8d,0x5f4,0x5f4,
-0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f7,0x60f,0x609,0x60f,0x609,0x60c,0x612,0x60f,0x609,
-0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x135c,0x135c,0x90,0x90,0x90,0x90,0x90,0x90,
-0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x60f,0x609,0x60c,0x612,0x60f,
-0x609,0x60f,0x609,0x60f,0x609,0x60f,0x60f,0x609,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
-0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x60c,0x609,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
-0x609,0x60c,0x609,0x609,0x60c,0x60c,0x609,0x609,0x609,0x609,0x609,0x60c,0x609,0x609,0x60c,0x609,
-0x60c,0x60c,0x60c,0x609,0x60c,0x60c,0x60c,0x60c,0x90,0x90,0x60c,0x60c,0x60c,0x60c,0x609,0x609,
-0x60c,0x609,0x609,0x609,0x609,0x60c,0x609,0x609,0x609,0x609,0x609,0x60c,0x60c,0x60c,0x609,0x609,
-0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,
-0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0x60f,0x60f,0x96c,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x60f,0x606,0x606,0xc18,0xda7,0x90,0x90,0x870,0x882,0x87f,0x882,0x87f,0xca5,0xca5,0xd98,
-0xd95,0x873,0x873,0x873,0x873,0x885,0x885,0x885,0x89d,0x8a0,0x8af,0x93,0x8a3,0x8a6,0x8b2,0x8b2,
-0x89a,0x891,0x88b,0x891,0x88b,0x891,0x88b,0x88e,0x88e,0x8a9,0x8a9,0x8ac,0x8a9,0x8a9,0x8a9,0x93,
-0x8a9,0x897,0x894,0x88e,0x93,0x93,0x93,0x93,0x61b,0x627,0x61b,0xc1b,0x61b,0x96,0x61b,0x627,
-0x61b,0x627,0x61b,0x627,0x61b,0x627,0x61b,0x627,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,
-0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,
-0x61e,0x624,0x61e,0x624,0x61e,0x96,0x96,0x618,0x76e,0x771,0x786,0x789,0x768,0x771,0x771,0x9c,
-0x750,0x753,0x753,0x753,0x753,0x750,0x750,0x9c,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,
-0x99,0xb16,0xb16,0xb16,0x9d2,0x74a,0x62a,0x62a,0x9c,0x798,0x777,0x768,0x771,0x76e,0x768,0x77a,
-0x76b,0x765,0x768,0x786,0x77d,0x774,0x795,0x768,0x792,0x792,0x792,0x792,0x792,0x792,0x792,0x792,
-0x792,0x792,0x783,0x780,0x786,0x786,0x786,0x798,0x759,0x756,0x756,0x756,0x756,0x756,0x756,0x756,
-0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,
-0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x9c,0x9c,0x9c,0x756,0x756,0x756,0x756,0x756,0x756,
-0x9c,0x9c,0x756,0x756,0x756,0x756,0x756,0x756,0x9c,0x9c,0x756,0x756,0x756,0x756,0x756,0x756,
-0x9c,0x9c,0x756,0x756,0x756,0x9c,0x9c,0x9c,0xb61,0xb61,0xb61,0xb61,0x9f,0x9f,0x9f,0x9f,
-0x9f,0x9f,0x9f,0x9f,0x9f,0x18a8,0x18a8,0x18a8,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,
-0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xa2,0xa2,0xa2,0xa2,0xa2,
-0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,
-0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,
-0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,
-0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xa8,0xa8,0x100e,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0x172e,0x172e,0x172e,0x172e,0x172e,0x172e,0x172e,0x172e,0x172e,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
-0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xab,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb94,0xb94,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xab,0xb94,0xb94,
-0xab,0xab,0xb94,0xab,0xab,0xb94,0xb94,0xab,0xab,0xb94,0xb94,0xb94,0xb94,0xab,0xb94,0xb94,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb91,0xb91,0xb91,0xb91,0xab,0xb91,0xab,0xb91,0xb91,0xb91,
-0xb91,0xd1d,0xb91,0xb91,0xab,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xab,0xb94,0xb94,0xb94,0xb94,0xab,0xab,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xab,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xab,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xab,0xb94,0xb94,0xb94,0xb94,0xab,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xab,0xb94,0xab,0xab,0xab,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xab,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xe0a,0xe0a,0xab,0xab,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb91,0xb91,0xb91,0xb8b,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xf1e,0xf1b,0xab,0xab,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,
-0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xae,0xb9a,0xae,0xae,
-0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,
-0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xc2a,0xc2a,0xc2a,0xc2a,
-0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xc2a,0xb1,0xc2a,0xc2a,0xc2a,0xc2a,0xc24,0xc24,
-0xc27,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xb1,0xc33,0xc33,0xc33,0xc33,
-0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc33,0xc2d,0xc2d,
-0xc30,0xc99,0xc99,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xb4,0xc39,0xc39,0xc39,0xc39,
-0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc39,0xc36,0xc36,
-0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xb7,0xc3f,0xc3f,0xc3f,0xc3f,
-0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xc3f,0xba,0xc3f,0xc3f,0xc3f,0xba,0xc3c,0xc3c,
-0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xba,0xd2f,0xd2f,0xd2f,0xd2f,
+0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
+0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,
+0x14d,0x14d,0x14d,0x14d,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,
 0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,
-0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0xd2f,0x152a,0x152a,0xbd,0xd20,0xd20,0xd20,0xd2c,
-0xd2c,0xd2c,0xd2c,0xd20,0xd20,0xd2c,0xd2c,0xd2c,0xbd,0xbd,0xbd,0xbd,0xd2c,0xd2c,0xd20,0xd2c,
-0xd2c,0xd2c,0xd2c,0xd2c,0xd2c,0xd23,0xd23,0xd23,0xbd,0xbd,0xbd,0xbd,0xd26,0xbd,0xbd,0xbd,
-0xd32,0xd32,0xd29,0xd29,0xd29,0xd29,0xd29,0xd29,0xd29,0xd29,0xd29,0xd29,0xd35,0xd35,0xd35,0xd35,
-0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xc0,0xc0,
-0xd35,0xd35,0xd35,0xd35,0xd35,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
-0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
-0x152d,0x152d,0x152d,0x152d,0xc3,0xc3,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
-0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0xc3,0xc3,
-0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,
-0xd5c,0xd5c,0xd5c,0xd5c,0xc6,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,
-0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xc6,0xd5c,0xd5c,0xd5c,0xd5c,
-0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xc6,
-0xd5c,0xd5c,0xc6,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,
-0xd5c,0xd5c,0xc6,0xc6,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,
-0xd5c,0xd5c,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,
-0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,
-0xc6,0xc6,0xc6,0xc6,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,
-0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xc9,
-0xc9,0xc9,0xc9,0xc9,0xda1,0xda1,0xda1,0xcc,0xcc,0xcc,0xcc,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
-0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
-0xd9b,0xd9b,0xd9b,0xd9b,0xcc,0xcc,0xcc,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,
-0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,
-0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xcf,0xd62,
-0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,
-0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd2,0xd2,
-0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,
-0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,
-0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd5,0xd5,0xd71,0xd5,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,
-0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,
-0xd71,0xd71,0xd5,0xd71,0xd71,0xd5,0xd5,0xd5,0xd71,0xd5,0xd5,0xd71,0xd74,0xd74,0xd74,0xd74,
-0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
-0xd74,0xd74,0xd74,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xe25,0xe25,0xe25,0xe25,
-0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,0x1530,0x1530,0x17e2,0x17e2,0xde,0x110a,0x110a,0x110a,0x110a,
-0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x135,0x135,0x135,0x135,0xe37,0xe37,0xe37,0xe37,
+0xd2f,0x152a,0x152a,0xbd,0xd20,0xd20,0xd20,0xd2c,0xd2c,0xd2c,0xd2c,0xd20,0xd20,0xd2c,0xd2c,0xd2c,
+0xbd,0xbd,0xbd,0xbd,0xd2c,0xd2c,0xd20,0xd2c,0xd2c,0xd2c,0xd2c,0xd2c,0xd2c,0xd23,0xd23,0xd23,
+0xbd,0xbd,0xbd,0xbd,0xd26,0xbd,0xbd,0xbd,0xd32,0xd32,0xd29,0xd29,0xd29,0xd29,0xd29,0xd29,
+0xd29,0xd29,0xd29,0xd29,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,
+0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,0xd35,
+0xd35,0xd35,0xc0,0xc0,0xd35,0xd35,0xd35,0xd35,0xd35,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
+0xc0,0xc0,0xc0,0xc0,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,
+0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,
+0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0x118b,0x118b,
+0xfc,0xfc,0xfc,0xfc,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7f,0xe7f,0xe7f,0xe7c,0xe7c,0xe7f,0xe7c,
+0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xe79,
+0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0x1188,0xfc,0xfc,0xfc,0xe76,0xe76,0xd38,
+0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,
+0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xe37,
 0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,
-0xe37,0xe37,0xe37,0xe2e,0xe2e,0xe34,0xe34,0xe2e,0xe1,0xe1,0xe31,0xe31,0x113a,0x113a,0x113a,0x113a,
-0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xc96,0xc96,0xc96,0xc96,
-0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0x1029,0x1029,0x1029,0x1029,
-0x1029,0x1029,0x1029,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,
-0x1533,0x1536,0x18ae,0x18ae,0x18ae,0x18ae,0xe7,0x17e5,0x1368,0x117c,0xf2d,0xf2d,0xe49,0xe46,0xe49,0xe46,
-0xe46,0xe3d,0xe3d,0xe3d,0xe3d,0xe3d,0xe3d,0x1185,0x1182,0x1185,0x1182,0x117f,0x117f,0x117f,0x1425,0x1422,
-0xea,0xea,0xea,0xea,0xea,0xe43,0xe40,0xe40,0xe40,0xe3d,0xe43,0xe40,0xe4c,0xe4c,0xe4c,0xe4c,
-0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,
-0xe4c,0xe4c,0xe4c,0xed,0xed,0xed,0xed,0xed,0xed,0xed,0xed,0xed,0xe4c,0xe4c,0xe4c,0xe4c,
-0xe4c,0xe4c,0xe4c,0xed,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xed,0xe4c,0xe4c,0xe4c,0xe4c,
-0xe4c,0xe4c,0xe4c,0xed,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xed,0xe52,0xe52,0xe52,0xe52,
-0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe52,0xe4f,0xe4f,0xe4f,0xe4f,
-0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xe4f,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xe55,0xe55,0xe55,0xe55,
-0xe55,0xe55,0xf3,0x1428,0xf3,0xf3,0xf3,0xf3,0xf3,0x1428,0xf3,0xf3,0xeac,0xeac,0xeac,0xeac,
-0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xe5b,0xe5b,0xe5b,0xe5b,
-0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xf6,0xe58,0xe58,0xe58,0xe58,
-0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,
-0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xf6,0xe6d,0xe61,0xe61,0xe61,
-0xf9,0xe61,0xe61,0xf9,0xf9,0xf9,0xf9,0xf9,0xe61,0xe61,0xe61,0xe61,0xe6d,0xe6d,0xe6d,0xe6d,
-0xf9,0xe6d,0xe6d,0xe6d,0xf9,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,
-0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0x194a,0x194a,0xf9,0xf9,
-0xe5e,0xe5e,0xe5e,0xf9,0xf9,0xf9,0xf9,0xe64,0xe67,0xe67,0xe67,0xe67,0xe67,0xe67,0xe67,0xe67,
-0x1947,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xe6a,0xe6a,0xe6a,0xe6a,0xe6a,0xe6a,0xe70,0xe70,
-0xe67,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,
-0xe7c,0xe7c,0x118b,0x118b,0xfc,0xfc,0xfc,0xfc,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7f,0xe7f,0xe7f,
-0xe7c,0xe7c,0xe7f,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xfc,0xfc,
-0xfc,0xfc,0xfc,0xfc,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0xe79,0x1188,0xfc,
-0xfc,0xfc,0xe76,0xe76,0xe85,0xe85,0xe85,0xe85,0xff,0xff,0xff,0xff,0xe85,0xe85,0xe85,0xe85,
-0xe85,0xe85,0xe85,0xe85,0xe82,0xe85,0xe85,0xe85,0xe85,0xe85,0xff,0xff,0xff,0xff,0xff,0xff,
-0xff,0xff,0xff,0xff,0x153f,0x1545,0x1542,0x188d,0x17e8,0x18b1,0x18b1,0x18b1,0x18b1,0x18b1,0x1950,0x194d,
-0x1953,0x194d,0x1953,0x1a13,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
-0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
-0x102,0x102,0x102,0x102,0xea9,0xea9,0xea9,0xea6,0xea6,0xe9d,0xe9d,0xea6,0xea3,0xea3,0xea3,0xea3,
-0x105,0x105,0x105,0x105,0x1305,0x1305,0x1305,0x1308,0x1308,0x1308,0x12ff,0x12ff,0x1302,0x12ff,0x159,0x159,
-0x159,0x159,0x159,0x159,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0x1434,0x1434,0x108,0x108,0x108,0x108,
-0x108,0x108,0x108,0xeaf,0x136e,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,
-0x108,0x108,0x108,0x136b,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,
-0xc66,0xc66,0xc66,0xc69,0xedc,0xecd,0xec7,0xed9,0xed6,0xed0,0xed0,0xedf,0xeca,0xed3,0x10b,0x10b,
-0x10b,0x10b,0x10b,0x10b,0xf60,0xf60,0xf4b,0xf60,0xf63,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,
-0x111,0x111,0x111,0x111,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf6c,0xf6c,
-0xf51,0xf57,0xf6c,0xf6c,0xf54,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0xf4e,
-0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,
-0xf51,0x111,0x111,0x111,0x114,0x114,0x1a19,0x1a16,0x1a19,0x1a19,0x1a19,0x114,0x114,0x114,0x114,0x114,
-0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
-0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x154e,0x143d,0x143d,0x1371,0x1065,0x1065,0x1065,0x1065,0x1065,
-0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,
-0xf7b,0xf7b,0xf7b,0xf7b,0xf78,0xf78,0xf7e,0xf7e,0x117,0x117,0x117,0x117,0x117,0x117,0x117,0x117,
-0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,
-0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf81,0xf81,0xf81,0xf81,0x1194,0x1194,0x11a,0x11a,0x11a,0xf84,
-0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,
-0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x173d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,
-0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,
-0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0xf90,0xf90,0xf90,0x155a,
-0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x120,0xf8d,0xf8d,0xf8d,0xf8d,
-0x1557,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0xf93,0xf93,0xf93,0xf93,
-0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0x1962,0x1962,
-0x1962,0x1962,0x1962,0x1962,0x1962,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0x108c,0x108c,0x108c,0x108c,
-0x1089,0x1089,0x1089,0x1089,0x1089,0x1089,0x1089,0x1089,0x107a,0x107a,0x107a,0x107a,0x107a,0x107a,0x107a,0x107a,
-0x1089,0x1089,0x1080,0x107d,0x126,0x126,0x126,0x108f,0x108f,0x1083,0x1083,0x1083,0x1086,0x1086,0x1086,0x1086,
-0x1086,0x1086,0x1086,0x1086,0x1086,0x1086,0x126,0x126,0x126,0x108c,0x108c,0x108c,0x1092,0x1092,0x1092,0x1092,
-0x1092,0x1092,0x1092,0x1092,0x1092,0x1092,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x10a7,0x10a7,0x10a7,0x10a7,
-0x10a7,0x10a7,0x10a7,0x10a7,0x10a7,0x10a7,0x10aa,0x10aa,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,
-0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x10d1,0x10d1,0x10d1,0x10d1,
-0x10cb,0x17ee,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x10d7,0x10d7,0x10ce,0x10ce,0x10ce,0x10ce,
-0x10ce,0x10ce,0x10ce,0x10ce,0x10ce,0x10ce,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x10f5,0x10f5,0x10f5,0x10f5,
-0x10f5,0x10f5,0x10f5,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10ef,0x10f2,
-0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x10ec,0x1104,0x1104,0x1104,0x1104,
-0x1104,0x1104,0x1104,0x1104,0x1104,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x10f8,0x1101,0x1101,0x10f8,0x10f8,0x1101,
-0x1101,0x10f8,0x10f8,0x132,0x132,0x132,0x132,0x132,0x132,0x132,0x132,0x132,0x1104,0x1104,0x1104,0x10f8,
-0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x10f8,0x1101,0x132,0x132,0x10fe,0x10fe,0x10fe,0x10fe,
-0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x132,0x132,0x10fb,0x1107,0x1107,0x1107,0x1566,0x135,0x135,0x135,
-0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,
-0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x110d,0x110d,0x110d,0x110d,
-0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,
-0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x1110,0x138,0x138,0x1113,0x1113,0x1113,0x1113,
-0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,
-0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x13b,0x13b,0x13b,0x1116,0x1116,0x1116,0x1116,
-0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x13e,0x13e,0x13e,
-0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x111c,0x111c,0x111c,0x111c,
-0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,
-0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x141,0x141,0x141,0x141,0x141,0x1119,0x111f,0x111f,0x111f,0x111f,
-0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x144,0x144,0x144,0x144,0x1122,0x1122,0x1122,0x1122,
-0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,
-0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x119a,0x119a,0x119a,0x119a,
-0x11a3,0x119a,0x119a,0x119a,0x11a3,0x119a,0x119a,0x119a,0x119a,0x1197,0x14a,0x14a,0x11a0,0x11a0,0x11a0,0x11a0,
-0x11a0,0x11a0,0x11a0,0x11a6,0x11a0,0x11a6,0x11a0,0x11a0,0x11a0,0x11a6,0x11a6,0x14a,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11a9,0x11a9,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x14d,0x11c4,0x11c4,0x11c4,0x11c4,
+0xe37,0xe37,0xe37,0xe37,0xe37,0xe37,0xe2e,0xe2e,0xe34,0xe34,0xe2e,0xe1,0xe1,0xe31,0xe31,0x11c4,
 0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,
-0x11c4,0x11c1,0x11ac,0x11c1,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x150,0x11b5,0x11be,0x11ac,0x11be,
-0x11be,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11ac,
-0x11ac,0x11b2,0x11b2,0x11b2,0x11b2,0x11b2,0x11b2,0x11b2,0x11b2,0x150,0x150,0x11af,0x11bb,0x11bb,0x11bb,0x11bb,
-0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x150,0x150,0x150,0x150,0x150,0x150,0x11bb,0x11bb,0x11bb,0x11bb,
-0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x150,0x150,0x150,0x150,0x150,0x150,0x11b8,0x11b8,0x11b8,0x11b8,
-0x11b8,0x11b8,0x11b8,0x11c7,0x11ca,0x11ca,0x11ca,0x11ca,0x11b8,0x11b8,0x150,0x150,0x15b1,0x15b1,0x15b1,0x15b1,
-0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15ae,0x1c8,0x131a,0x12f3,0x1311,0x1311,
-0x1311,0x1311,0x1311,0x1311,0x1311,0x12f9,0x12f6,0x12ed,0x12ed,0x1317,0x12ed,0x12ed,0x12ed,0x12ed,0x12fc,0x14dc,
-0x14e2,0x14df,0x14df,0x192c,0x1707,0x1707,0x1a97,0x153,0x153,0x153,0x153,0x153,0x11df,0x11df,0x11df,0x11df,
-0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11d6,0x11d6,0x11d9,0x11e2,
-0x11dc,0x11dc,0x11dc,0x11e2,0x156,0x156,0x156,0x156,0x156,0x156,0x156,0x156,0x12db,0x12db,0x12db,0x12db,
-0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,
-0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x15c,0x15c,0x15c,0x1200,0x11f4,0x11f4,0x11f4,
-0x11f4,0x11f4,0x11f4,0x11f7,0x1206,0x1206,0x11f4,0x11f4,0x11f4,0x11f4,0x15f,0x130b,0x11fa,0x11fa,0x11fa,0x11fa,
-0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x15f,0x15f,0x15f,0x15f,0x11f4,0x11f4,0x1224,0x1218,0x1224,0x162,
-0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,
-0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x1221,0x1221,0x1227,0x121b,0x121e,0x123c,0x123c,0x123c,0x1236,
-0x1236,0x122d,0x1236,0x1236,0x122d,0x1236,0x1236,0x123f,0x1239,0x1230,0x165,0x165,0x1233,0x1233,0x1233,0x1233,
-0x1233,0x1233,0x1233,0x1233,0x1233,0x1233,0x165,0x165,0x165,0x165,0x165,0x165,0x1245,0x1245,0x1245,0x1245,
-0x1245,0x1245,0x1245,0x168,0x168,0x168,0x168,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,
-0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,
-0x1242,0x1242,0x1242,0x1242,0x168,0x168,0x168,0x168,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,
-0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x16b,0x124b,
-0x1248,0x1248,0x1248,0x1248,0x1248,0x1248,0x1248,0x1248,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,
-0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x16e,0x16e,
-0x16e,0x1257,0x125a,0x125a,0x125a,0x125a,0x125a,0x125a,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,
-0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x171,0x171,
-0x1260,0x1260,0x1260,0x1260,0x1260,0x1260,0x1260,0x1260,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,
-0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x174,0x174,0x174,0x174,0x174,
-0x1266,0x1266,0x1266,0x1266,0x1266,0x1266,0x1266,0x1266,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,
-0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,
-0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x17a,0x128a,0x128a,0x17d,0x17d,0x17d,0x17d,0x17d,0x17d,
-0x17d,0x17d,0x17d,0x17d,0x17d,0x196b,0x17d,0x17d,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,
-0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,
-0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x180,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a40,
-0x1a3a,0x282,0x282,0x282,0x282,0x282,0x282,0x282,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
-0x12b7,0x12b7,0x12b7,0x1572,0x1572,0x183,0x183,0x183,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
-0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,
-0x13c5,0x13c5,0x144c,0x144c,0x1a1c,0x183,0x183,0x183,0x13cb,0x13cb,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,
-0x13c5,0x12c0,0x13c5,0x12c0,0x12c0,0x13c5,0x13cb,0x12c6,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,
-0x186c,0x186c,0x186c,0x186c,0x186c,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,
-0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,
-0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,
-0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,
-0x137d,0x137d,0x137d,0x137d,0x12e7,0x13e6,0x13e3,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
-0x186,0x186,0x186,0x186,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e4,0x12e1,
-0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e4,
-0x12e1,0x12e1,0x13e6,0x13e6,0x13e6,0x13e6,0x13e6,0x13e3,0x13e6,0x13e6,0x13e6,0x186f,0x186,0x186,0x186,0x186,
-0x12de,0x12de,0x12de,0x12de,0x12de,0x12de,0x12de,0x12de,0x12de,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
-0x140a,0x140a,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
-0x1911,0x1911,0x1911,0x1911,0x1911,0x1911,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
-0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
-0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,
-0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,0x1386,
-0x1386,0x1380,0x1380,0x1380,0x189,0x189,0x1383,0x189,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1389,0x1392,
-0x138c,0x138c,0x1392,0x1392,0x1392,0x138c,0x1392,0x138c,0x138c,0x138c,0x1395,0x1395,0x18c,0x18c,0x18c,0x18c,
-0x18c,0x18c,0x18c,0x18c,0x138f,0x138f,0x138f,0x138f,0x18f,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,
-0x18f,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,0x18f,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,
-0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x18f,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,
-0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,
-0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x139e,0x139e,0x139e,0x139e,0x139e,0x139e,0x13a1,0x13b3,
-0x13b3,0x13a7,0x13a7,0x13a7,0x13a7,0x13a7,0x192,0x192,0x192,0x192,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,
-0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13aa,0x13aa,0x13aa,0x13aa,0x13aa,0x13aa,
-0x13aa,0x13aa,0x13aa,0x13aa,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,
-0x192,0x192,0x192,0x1575,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,
-0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x195,0x195,0x195,
-0x195,0x195,0x195,0x195,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
-0x13b9,0x13b9,0x13b9,0x198,0x198,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
-0x13b9,0x13b9,0x13b9,0x1578,0x198,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
-0x13b9,0x13b9,0x13b9,0x13ef,0x198,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
-0x13b9,0x13b9,0x13b9,0x13b9,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,
-0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x198,0x198,0x198,0x198,0x198,0x198,
-0x198,0x198,0x198,0x198,0x1404,0x1401,0x1401,0x1401,0x1401,0x1401,0x158d,0x158d,0x158d,0x158d,0x158d,0x1590,
-0x16fe,0x1590,0x1590,0x1590,0x17ca,0x1878,0x1878,0x18b4,0x18b4,0x1a79,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,
-0x19b,0x19b,0x19b,0x19b,0x1590,0x1590,0x1590,0x1590,0x1590,0x1590,0x158d,0x158d,0x158d,0x1590,0x158d,0x16fb,
-0x16fb,0x19b,0x19b,0x19b,0x1590,0x158d,0x158d,0x1590,0x1878,0x1878,0x1878,0x1917,0x1917,0x19f5,0x1a79,0x19b,
-0x19b,0x19b,0x19b,0x19b,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,
-0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,
-0x19e,0x19e,0x19e,0x19e,0x1458,0x1596,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,0x1458,
-0x1458,0x1596,0x1596,0x1596,0x1596,0x1596,0x1596,0x174f,0x174f,0x1a1,0x17fa,0x17fa,0x17fa,0x17fa,0x17fa,0x17fa,
-0x17fa,0x17fa,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,
-0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1a1,0x1971,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,0x17f7,
-0x17f7,0x17f7,0x17f7,0x17f7,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,
-0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,
-0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x1a4,0x145e,0x1a4,0x145e,0x145e,0x145e,
-0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x145e,
-0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x145e,0x1a4,0x1a4,0x1a4,0x1a4,0x145e,0x1a4,0x145e,0x1a4,0x145e,
-0x1a4,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x1a4,0x145e,0x1a4,0x145e,0x1a4,0x145e,
-0x1a4,0x145e,0x1a4,0x145e,0x1a4,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x1a4,0x145e,0x145e,0x145e,0x145e,0x1a4,
-0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,
-0x145e,0x1a4,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,
-0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,
-0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,
-0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,
-0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,
-0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,
-0x145b,0x145b,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,
-0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1461,0x1461,0x1461,0x1461,0x1461,0x1470,0x1461,0x1464,0x1464,
-0x1461,0x1461,0x1461,0x1467,0x1467,0x1a7,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,
-0x146a,0x1476,0x1476,0x1476,0x1977,0x1974,0x1974,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,
-0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,
-0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x147f,0x1479,0x1479,0x147f,0x147f,
-0x1488,0x1488,0x1482,0x1485,0x1485,0x147f,0x147c,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,
-0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,
-0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x1ad,0x1ad,0x1ad,0x1ad,0x1752,0x1752,0x148b,0x148b,
-0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,
-0x1ad,0x1ad,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,
-0x1497,0x1497,0x1497,0x1497,0x1497,0x1a25,0x1a25,0x1a25,0x1a25,0x1a25,0x1a25,0x1b0,0x1b0,0x1b0,0x1b0,0x1a1f,
-0x1497,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,
-0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,0x1491,
-0x1491,0x1491,0x1491,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,
-0x14ac,0x14af,0x14b2,0x14b2,0x14af,0x14b5,0x14b5,0x14a0,0x14a3,0x1755,0x1758,0x1758,0x1758,0x159c,0x1b3,0x1b3,
-0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x1599,0x175e,0x1761,0x175b,0x1764,0x1764,
-0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,
-0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,
-0x14be,0x14be,0x14be,0x14be,0x14be,0x14be,0x14be,0x14be,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,
-0x1314,0x1311,0x1314,0x12f0,0x1311,0x1317,0x1317,0x131a,0x1317,0x131a,0x131d,0x1311,0x131a,0x131a,0x1311,0x1311,
-0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14c1,0x14ca,0x14c1,0x14ca,0x14ca,
-0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14c1,0x14cd,0x14c4,0x1a28,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,
-0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x1bf,0x1bf,
-0x159f,0x159f,0x159f,0x159f,0x159f,0x15a5,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,
-0x170a,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,
-0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1c5,0x1c5,0x1c5,0x1c5,
+0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c1,
+0x11ac,0x11c1,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x150,0x11b5,0x11be,0x11ac,0x11be,0x11be,0x11ac,
+0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11ac,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11c1,0x11ac,0x11ac,0x11b2,
+0x11b2,0x11b2,0x11b2,0x11b2,0x11b2,0x11b2,0x11b2,0x150,0x150,0x11af,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,
+0x11bb,0x11bb,0x11bb,0x11bb,0x150,0x150,0x150,0x150,0x150,0x150,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,0x11bb,
+0x11bb,0x11bb,0x11bb,0x11bb,0x150,0x150,0x150,0x150,0x150,0x150,0x11b8,0x11b8,0x11b8,0x11b8,0x11b8,0x11b8,
+0x11b8,0x11c7,0x11ca,0x11ca,0x11ca,0x11ca,0x11b8,0x11b8,0x150,0x150,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,
+0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15b1,0x15ae,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,
 0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,
 0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,
-0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,
-0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x1cb,0x1cb,0x1cb,
-0x1cb,0x1cb,0x1cb,0x1cb,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x1cb,0x1cb,
-0x15ba,0x15b4,0x15b7,0x15c0,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x1ce,0x1ce,0x1ce,0x1ce,
-0x1ce,0x1ce,0x1ce,0x1ce,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,
-0x15ab,0x15ab,0x15ab,0x15ab,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,
-0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x197a,0x197a,0x197a,0x197a,0x1d1,0x1d1,0x1d1,
-0x1d1,0x1d1,0x1d1,0x1d1,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,
-0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
-0x1d1,0x1d1,0x1d1,0x1d1,0x1767,0x170d,0x15cf,0x1713,0x1d4,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,
-0x15d8,0x1d4,0x1d4,0x15d8,0x15d8,0x1d4,0x1d4,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,
-0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x1d4,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x1d4,0x15d8,0x15d8,
-0x1d4,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x1d4,0x1a04,0x1710,0x15d8,0x15c9,0x15cf,0x15c9,0x15cf,0x15cf,0x15cf,
-0x15cf,0x1d4,0x1d4,0x15cf,0x15cf,0x1d4,0x1d4,0x15d2,0x15d2,0x15d5,0x1d4,0x1d4,0x176a,0x1d4,0x1d4,0x1d4,
-0x1d4,0x1d4,0x1d4,0x15c9,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x15db,0x15d8,0x15d8,0x15d8,0x15d8,0x15cf,0x15cf,
-0x1d4,0x1d4,0x15cc,0x15cc,0x15cc,0x15cc,0x15cc,0x15cc,0x15cc,0x1d4,0x1d4,0x1d4,0x15cc,0x15cc,0x15cc,0x15cc,
-0x15cc,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x15f0,0x15f0,0x15f0,0x15f0,
-0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x1d7,0x15f0,
-0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15ea,0x15ea,0x15ea,0x15de,
-0x15de,0x15de,0x15ea,0x15ea,0x15de,0x15ed,0x15e1,0x15de,0x15f3,0x15f3,0x15e7,0x15f3,0x15f3,0x15e4,0x17fd,0x1d7,
-0x1602,0x1602,0x1602,0x15f6,0x15f6,0x15f6,0x15f6,0x15f6,0x15f6,0x15f9,0x15fc,0x1da,0x1da,0x1da,0x1da,0x1da,
-0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x1da,0x1da,0x1da,0x1da,0x1da,0x1da,
-0x176d,0x176d,0x176d,0x176d,0x160e,0x160b,0x1a2b,0x1a2b,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,0x1dd,
-0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,
-0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,
-0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,
-0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,
-0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,
-0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,
-0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,
-0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,
-0x1620,0x1620,0x1620,0x1617,0x161a,0x161d,0x1620,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,
-0x162f,0x162f,0x162f,0x162f,0x162f,0x1623,0x1623,0x1e6,0x1e6,0x1e6,0x1e6,0x1626,0x1626,0x1626,0x1626,0x1626,
-0x162c,0x162c,0x162c,0x162c,0x162c,0x162c,0x1629,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,
-0x1638,0x1638,0x1638,0x1638,0x1638,0x1e9,0x1e9,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,
-0x1632,0x1632,0x1632,0x1632,0x1632,0x1632,0x1632,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,
-0x163b,0x164d,0x164d,0x1641,0x164a,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,
-0x1644,0x1644,0x1644,0x1644,0x1644,0x1644,0x1644,0x1644,0x1644,0x1644,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,
-0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,
-0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1ef,
-0x165f,0x165f,0x165f,0x165f,0x165f,0x1659,0x1662,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,0x165f,
-0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165f,0x165f,0x165f,0x165f,0x165f,0x1f2,
-0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,
-0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1f5,
-0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,
-0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1671,0x1671,0x1671,0x1671,0x1671,0x1f8,0x1f8,0x1f8,0x1f8,0x1f8,
-0x168c,0x168c,0x168f,0x168f,0x1692,0x1683,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,
-0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,0x1fb,0x1683,0x1683,0x1683,0x1683,0x1683,
-0x1683,0x1683,0x1fb,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,
-0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x168c,0x168c,0x168c,
-0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,
-0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,
-0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,
-0x16a4,0x16a4,0x201,0x201,0x201,0x201,0x201,0x201,0x201,0x16a1,0x16a1,0x16a1,0x16a1,0x201,0x201,0x201,
-0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16a7,
-0x16b9,0x16b9,0x16a7,0x16a7,0x16a7,0x16a7,0x207,0x207,0x16b9,0x16b9,0x16bc,0x16bc,0x16a7,0x16a7,0x16b9,0x16ad,
-0x16aa,0x16b0,0x16c2,0x16c2,0x16b3,0x16b3,0x16b6,0x16b6,0x16b6,0x16c2,0x1776,0x1776,0x1776,0x1776,0x1776,0x1776,
-0x1776,0x1776,0x1776,0x1776,0x1776,0x1776,0x1776,0x1776,0x1773,0x1773,0x1773,0x1773,0x1770,0x1770,0x207,0x207,
-0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,
-0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,
-0x20a,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,
-0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,
-0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x20d,0x20d,0x20d,0x20d,
-0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
-0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
-0x16c8,0x16c8,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
-0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
-0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,
-0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,
-0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x16cb,0x16da,0x16d1,0x16ce,
-0x16e0,0x16e0,0x16d4,0x16e0,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x210,0x16d7,0x16d7,0x16d7,0x16d7,
-0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x210,0x210,0x210,0x210,0x210,0x210,0x16e6,0x16e6,0x16e6,0x16e6,
-0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e3,0x16e3,0x16e3,0x16e3,0x16e3,0x16e3,0x16e3,0x16e3,0x16e3,0x213,
-0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x16ec,0x1788,0x1788,0x1788,0x1788,
-0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,
-0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x197d,0x216,0x216,0x1779,0x1779,0x1779,0x1785,0x1785,0x1779,0x1779,
-0x1779,0x1779,0x1785,0x1779,0x1779,0x1779,0x1779,0x177c,0x216,0x216,0x216,0x216,0x1782,0x1782,0x1782,0x1782,
-0x1782,0x1782,0x1782,0x1782,0x1782,0x1782,0x177f,0x177f,0x178b,0x178b,0x178b,0x177f,0x178e,0x178e,0x178e,0x178e,
-0x178e,0x178e,0x178e,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,
-0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,
-0x219,0x219,0x219,0x219,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,
-0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x21f,0x17a0,0x17a0,0x21f,0x21f,0x21f,0x21f,0x21f,0x179d,
-0x179d,0x179d,0x179d,0x179d,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x222,0x17a3,0x222,0x17a3,0x17a3,
-0x17a3,0x17a3,0x222,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,
-0x17a3,0x17a3,0x222,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a6,0x222,0x222,
-0x222,0x222,0x222,0x222,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
-0x1605,0x1605,0x1605,0x1605,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,
-0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,
-0x225,0x225,0x225,0x225,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,
-0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x17a9,0x17a9,
-0x17a9,0x17a9,0x17a9,0x17a9,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,
-0x228,0x1a7f,0x1a7f,0x1a82,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d3,0x1881,0x1881,0x1881,
-0x1881,0x1881,0x1881,0x191d,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,
-0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x1a7f,0x228,0x19f8,0x19f8,0x19f8,0x19f8,0x228,0x228,0x228,0x19f8,0x1a7f,
-0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x228,0x228,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x228,
-0x228,0x228,0x1a7f,0x1a7f,0x19fb,0x19fb,0x19fb,0x19fb,0x19f8,0x19fe,0x19fe,0x19f8,0x19fe,0x19fe,0x1a7f,0x1a82,
-0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x17d0,0x19f8,0x19f8,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x228,
-0x228,0x1a82,0x1a82,0x1a82,0x191a,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,
-0x191d,0x191d,0x191a,0x191a,0x17b5,0x17b5,0x17b5,0x17b5,0x17b2,0x17b5,0x17b5,0x17b8,0x17bb,0x17b8,0x17b8,0x17b5,
-0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x17b2,
-0x17b2,0x17b2,0x17b2,0x17b2,0x180f,0x180f,0x180f,0x180f,0x1806,0x1806,0x1806,0x1800,0x1803,0x1803,0x1803,0x1a2e,
-0x22e,0x22e,0x22e,0x22e,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x22e,0x22e,
-0x22e,0x22e,0x1809,0x1809,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x231,0x182a,0x182a,
-0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,
-0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x1827,0x1815,0x1815,0x1815,0x1815,0x1815,0x1815,0x1815,0x231,
-0x1815,0x1815,0x1815,0x1815,0x1815,0x1815,0x1827,0x1818,0x182a,0x182d,0x182d,0x1821,0x181e,0x181e,0x231,0x231,
-0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x1824,0x1824,0x1824,0x1824,0x1824,0x1824,0x1824,0x1824,
-0x1824,0x1824,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,
-0x181b,0x231,0x231,0x231,0x1839,0x183c,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,
-0x1842,0x1842,0x1842,0x1842,0x1830,0x1830,0x1830,0x1830,0x1830,0x1830,0x1830,0x1830,0x1830,0x234,0x234,0x234,
-0x234,0x234,0x234,0x234,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,
-0x199b,0x199b,0x199b,0x199b,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x237,0x1833,0x1833,0x1833,0x1833,
-0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x237,0x237,0x1833,
-0x1833,0x1833,0x1833,0x1833,0x1884,0x1920,0x1a85,0x1a88,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,
-0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,
-0x23a,0x23a,0x23a,0x23a,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,
-0x1842,0x1842,0x1842,0x1842,0x23d,0x23d,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,
-0x1836,0x1836,0x1836,0x1836,0x23d,0x183f,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x183f,0x1836,0x1836,
-0x183f,0x1836,0x1836,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x1845,0x1845,0x1845,0x1845,
-0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x240,0x240,0x240,0x240,0x240,0x240,0x240,
-0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x185d,0x185d,0x184e,0x1848,
-0x1848,0x185d,0x184b,0x1860,0x1860,0x1860,0x1860,0x1863,0x1863,0x1857,0x1854,0x1851,0x185a,0x185a,0x185a,0x185a,
-0x185a,0x185a,0x185a,0x185a,0x185a,0x185a,0x243,0x1857,0x243,0x1851,0x1980,0x1a31,0x243,0x243,0x243,0x243,
-0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,
-0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x1869,0x1869,0x1869,0x1869,
-0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,
-0x246,0x246,0x246,0x246,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,
-0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,
-0x246,0x246,0x246,0x246,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,
-0x1887,0x1a01,0x1a01,0x1a01,0x1a01,0x1a01,0x1a8b,0x1a8b,0x1a8b,0x1a8b,0x1a8b,0x1a8b,0x249,0x249,0x249,0x249,
-0x249,0x249,0x249,0x249,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,
-0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,
-0x24c,0x24c,0x24c,0x24c,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,
-0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,
-0x1926,0x1926,0x1926,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,
-0x24f,0x24f,0x24f,0x24f,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,
-0x291,0x291,0x291,0x291,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x252,0x18c6,0x18c6,0x252,0x18c6,
-0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,
-0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18ba,0x18ba,0x18ba,0x18ba,0x18ba,0x18ba,0x252,0x252,0x252,0x18ba,0x252,
-0x18ba,0x18ba,0x252,0x18ba,0x18ba,0x18ba,0x18bd,0x18ba,0x18c0,0x18c0,0x18c9,0x18ba,0x252,0x252,0x252,0x252,
-0x252,0x252,0x252,0x252,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x252,0x252,
-0x252,0x252,0x252,0x252,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,
-0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,
-0x255,0x255,0x255,0x255,0x18f6,0x18f9,0x1908,0x1908,0x18f9,0x18fc,0x18f6,0x18f3,0x25e,0x25e,0x25e,0x25e,
-0x25e,0x25e,0x25e,0x25e,0x18e1,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18de,0x18de,0x18cc,0x18cc,0x18cc,
-0x18e1,0x18e1,0x18e1,0x18e1,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,
-0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,
-0x261,0x261,0x261,0x261,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,
-0x1986,0x1986,0x261,0x261,0x1a94,0x1a94,0x1a94,0x1a94,0x294,0x294,0x294,0x294,0x1a94,0x1a94,0x1a94,0x294,
-0x294,0x294,0x294,0x294,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,
-0x1995,0x1995,0x1995,0x1989,0x1989,0x1989,0x1989,0x1989,0x1989,0x1989,0x1989,0x1989,0x1995,0x198f,0x198c,0x1992,
-0x264,0x264,0x264,0x264,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,
-0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x267,
-0x267,0x199b,0x199b,0x199b,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x26a,0x19aa,0x19aa,0x26a,0x19aa,0x19aa,
-0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,
-0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19a7,0x19a7,0x19a7,0x19a7,0x19a7,0x26a,0x199e,0x199e,0x26a,0x19a7,
-0x19a7,0x199e,0x19a7,0x19a1,0x19aa,0x26a,0x26a,0x26a,0x26a,0x26a,0x26a,0x26a,0x19b3,0x19b3,0x19b6,0x19b6,
-0x19ad,0x19ad,0x19ad,0x19ad,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x19b0,0x19b0,0x19b0,0x19b0,
-0x19b0,0x19b0,0x19b0,0x19b0,0x19b0,0x19b0,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x19b9,0x19b9,0x19b9,0x19b9,
-0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19bc,0x19b9,0x19b9,0x19b9,0x19bc,0x19b9,0x19b9,0x19b9,
-0x19b9,0x270,0x270,0x270,0x270,0x270,0x270,0x270,0x270,0x270,0x270,0x270,0x19c5,0x19c5,0x19c5,0x19c5,
-0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19bf,
-0x19bf,0x19c2,0x19c2,0x19c8,0x19c8,0x273,0x273,0x273,0x273,0x273,0x273,0x273,0x19cb,0x19cb,0x19cb,0x19cb,
-0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,
-0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x19ce,0x19ce,0x19ce,0x19ce,
-0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,
-0x19ce,0x19ce,0x19ce,0x19d1,0x19da,0x19ce,0x19ce,0x279,0x279,0x279,0x279,0x279,0x19dd,0x19dd,0x19dd,0x19dd,
-0x19dd,0x19dd,0x19dd,0x19e0,0x27c,0x27c,0x27c,0x27c,0x27c,0x27c,0x27c,0x27c,0x19e9,0x19e9,0x19e9,0x19e9,
-0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e3,0x19e3,
-0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e6,0x19e6,0x19e6,0x19e6,0x19ec,0x19ec,0x19ec,
-0x19ec,0x19ec,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,
-0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x285,
-0x285,0x285,0x285,0x285,0x285,0x285,0x285,0x285,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,
-0x288,0x288,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,
-0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a4f,0x1a46,0x1a4f,0x1a46,0x1a46,0x1a46,0x1a46,
-0x288,0x288,0x1a46,0x1a46,0x1a4f,0x1a4f,0x1a4f,0x1a4f,0x1a49,0x1a52,0x1a4c,0x1a52,0x1a4f,0x288,0x288,0x288,
-0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,
-0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,
-0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x28b,0x28b,0x28b,0x1a55,0x1a55,0x1a55,0x1a55,0x1a55,0x1a55,0x1a55,0x1a5b,
-0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5e,0x1a5e,0x28b,0x28b,0x28e,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,
-0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,
-0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x28e,0x28e,0x291,0x291,0x291,0x291,
-0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x1a8e,0x1a8e,0x1a8e,0x291,
-0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x1a91,0x1a91,0x1a91,0x1a91,
-0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,
-0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1a94,0x1a94,0x1a94,0x294,0x294,0x294,0x294,0x294,
-0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x1a94,0x1a94,0x1a94,0x1a94,0x1a94,0x1a94,0x294,0x294,
-0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,
-0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,
-0x1a6a,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,
-0x1a64,0x1a64,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x1a67,
-0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a6d,0x1a6d,0x1a6d,0x1a6d,
-0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,0x29a,0x29a,0x29a,0x29a,0x29a,0x1a70,
-0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,
-0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,
-0x1923,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,
-0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,
-0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x96f,0x96f,
-0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,
-0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,
-0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x19f2,0x19f2,0x19f2,0x19f2,0x19f2,
-0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,
-0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0x12d5,0x12d5,0x12d5,0x2a6,0x2a6,
-0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,
-0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,
-0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,
-0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0xb9d,0xb9d,0xb9d,0xb9d,
-0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,
-0xb9d,0xb9d,0xb9d,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0xba0,0xba0,0xba0,0xba0,
-0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,
-0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0x2ac,0x2ac,0x12ea,0x12ea,0x12ea,0x12ea,
-0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,
-0x12ea,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x1407,0x1407,0x1407,0x1407,
-0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,
-0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x2b2,0x2b2,0x17cd,0x17cd,0x2b5,0x2b5,
-0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x1923,0x1923,0x1923,0x1923,
-0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1146,0x3b1,0x3b1,0x3bd,
-0xcd5,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,
-0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3bd,0x3b1,0x3b1,0x3b1,
-0x3b1,0x3b1,0x3b1,0x3b1,0x3b1,0x3bd,0x3bd,0x3bd,0x3bd,0x3b7,0x1149,0x132f,0x3c0,0x939,0x93c,0x3b4,
-0x3b4,0x1146,0x132c,0x132c,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c3,0x3c0,0x3c0,0x3b1,0x3b1,
-0x8c4,0x8c7,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x957,0x3ba,0xfab,0xfa8,0x1332,
-0x1332,0x1332,0x1332,0x1332,0x14f7,0x114c,0x114c,0xefd,0xefd,0xdce,0xefd,0xefd,0x3c0,0x3c0,0x3c0,0x3c0,
-0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c3,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x3c3,0x3c0,0x3c0,
-0x3c3,0x3c0,0x3c0,0x3c0,0x3c0,0x3c0,0x132c,0x132f,0x3b4,0x3c0,0x3bd,0x3bd,0x45f,0x45f,0x45f,0x45f,
-0x45f,0x45f,0x45f,0x45f,0x45f,0x1338,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,
-0x45f,0x45f,0x45f,0x45f,0x45f,0x45f,0x1338,0x189f,0x189f,0xfc9,0x450,0x459,0x49b,0x49b,0x49b,0x49b,
-0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,0x49b,
-0x49b,0x49b,0x49b,0xbbb,0xbbb,0xdda,0xdda,0x8ca,0xddd,0x1419,0x1419,0x1419,0x49e,0x49e,0x49e,0x49e,
-0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,
-0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x49e,0x4a4,0x4a4,0x4a4,0x1161,
-0x1161,0x1161,0x1161,0x1161,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,
-0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,
-0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x4a1,0x115e,0x115e,0x115e,0x115e,0x115e,0x115e,0x4a7,0x4a4,0x4a4,0x4a4,
-0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,
-0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,0x4a4,
-0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,
-0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,
-0x4b0,0x4aa,0x4aa,0x4aa,0x4aa,0x4aa,0x4ad,0x9b1,0xff6,0xff6,0xff9,0xff6,0x4b0,0x4aa,0x4b0,0x4aa,
-0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,
-0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0xff9,0xff6,0xff9,0xff6,0xff9,0xff6,0x4bc,0x4bc,0x4bc,0x4bc,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,0x4bc,0x4bc,0x4bc,
-0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x69f,0x69f,0x6a2,0x4da,
-0x6ae,0x6ab,0x6ab,0x6a8,0x504,0x504,0x4c2,0x4c2,0x4c2,0x4c2,0x4c2,0xb4c,0x6b1,0x4e6,0x6c9,0x6cc,
-0x4fb,0x6b1,0x4e9,0x4e9,0x4da,0x4f5,0x4f5,0x69f,0x501,0x4fe,0x6a5,0x4d4,0x4cb,0x4cb,0x4ce,0x4ce,
-0x4ce,0x4ce,0x4ce,0x4d1,0x4ce,0x4ce,0x4ce,0x4c5,0x50d,0x50a,0x507,0x507,0x6bd,0x4ef,0x4ec,0x6ba,
-0x6b7,0x6b4,0x6c6,0x4dd,0x6c3,0x6c3,0x4f2,0x4f5,0x6c0,0x6c0,0x4f2,0x4f5,0x4d7,0x4da,0x4da,0x4da,
-0x4f8,0x4e3,0x4e0,0xbd0,0xae6,0xae9,0xae3,0xae3,0xae3,0xae3,0xbc7,0xbc7,0xbc7,0xbc7,0xbcd,0xd02,
-0xcff,0xde9,0xdec,0xbca,0xdec,0xdec,0xdec,0xdec,0xde9,0xdec,0xdec,0xbc4,0x531,0x531,0x531,0x531,
-0x531,0x531,0x531,0x52e,0x534,0x74d,0x531,0x9b4,0x9d5,0xaec,0xaec,0xaec,0xbd6,0xbd6,0xdf2,0xdf2,
-0xdf2,0xdf2,0x116a,0x116d,0x116d,0x134d,0x14e5,0x150f,0x1512,0x1512,0x1725,0x18a2,0x540,0x540,0x558,0x6db,
-0x53d,0x6d8,0x540,0x555,0x53d,0x6db,0x54f,0x558,0x558,0x558,0x54f,0x54f,0x558,0x558,0x558,0x6e4,
-0x53d,0x558,0x6de,0x53d,0x54c,0x558,0x558,0x558,0x558,0x558,0x53d,0x53d,0x543,0x6d8,0x6e1,0x53d,
-0x558,0x53d,0x6e7,0x53d,0x558,0x546,0x55e,0x6ea,0x558,0x558,0x549,0x54f,0x558,0x558,0x55b,0x558,
-0x54f,0x552,0x552,0x552,0x552,0xaf8,0xaf5,0xd05,0xdfb,0xbeb,0xbee,0xbee,0xbe8,0xbe5,0xbe5,0xbe5,
-0xbe5,0xbee,0xbeb,0xbeb,0xbeb,0xbeb,0xbe2,0xbe5,0xdf8,0xf09,0xf0c,0xfff,0x1170,0x1170,0x1170,0x6f0,
-0x6ed,0x561,0x564,0x564,0x564,0x564,0x564,0x6ed,0x6f0,0x6f0,0x6ed,0x564,0x6f6,0x6f6,0x6f6,0x6f6,
-0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x56d,0x56d,0x56d,0x56d,0x6f3,0x6f3,0x6f3,0x6f3,
-0x6f3,0x6f3,0x6f3,0x6f3,0x6f3,0x6f3,0x567,0x567,0x567,0x567,0x567,0x567,0x573,0x573,0x573,0x573,
-0x573,0x573,0x573,0x573,0x570,0x579,0x579,0x573,0x573,0x573,0x576,0x570,0x573,0x573,0x570,0x570,
-0x570,0x570,0x573,0x573,0x6f9,0x6f9,0x570,0x570,0x573,0x573,0x573,0x573,0x573,0x573,0x573,0x573,
-0x573,0x573,0x573,0x573,0x573,0x576,0x576,0x576,0x573,0x573,0x6fc,0x573,0x6fc,0x573,0x573,0x573,
-0x573,0x573,0x573,0x573,0x570,0x573,0x570,0x570,0x570,0x570,0x570,0x570,0x573,0x573,0x570,0x6f9,
-0x570,0x570,0x570,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xbf1,0xbf1,0xbf1,0xbf1,
-0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0x702,0x57c,0x702,0x702,0x57f,0x57c,0x57c,0x702,
-0x702,0x57f,0x57c,0x702,0x57f,0x57c,0x57c,0x702,0x57c,0x702,0x58b,0x588,0x57c,0x702,0x57c,0x57c,
-0x57c,0x57c,0x702,0x57c,0x57c,0x702,0x702,0x702,0x702,0x57c,0x57c,0x702,0x57f,0x702,0x57f,0x702,
-0x702,0x702,0x702,0x702,0x708,0x582,0x702,0x582,0x582,0x57c,0x57c,0x57c,0x702,0x702,0x702,0x702,
-0x57c,0x57c,0x57c,0x57c,0x702,0x702,0x57c,0x57c,0x57c,0x57f,0x57c,0x57c,0x57f,0x57c,0x57c,0x57f,
-0x702,0x57f,0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,
-0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x705,0x702,0x57f,0x57c,0x702,0x702,0x702,0x702,
-0x57c,0x57c,0x702,0x702,0x57c,0x57f,0x705,0x705,0x57f,0x57f,0x57c,0x57c,0x57f,0x57f,0x57c,0x57c,
-0x57f,0x57f,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57f,0x57f,0x702,0x702,0x57f,0x57f,0x702,0x702,
-0x57f,0x57f,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x702,0x57c,0x57c,
-0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,
-0x57f,0x57f,0x57f,0x57f,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,
-0x57c,0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,
+0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,
+0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0x1c8,0xf4b,0xf4b,0xf4b,0xf4b,0xf5d,0xf66,0xf69,
+0xf66,0xf69,0xf66,0xf69,0xf66,0xf69,0xf66,0xf69,0xf66,0xf66,0xf66,0xf69,0xf66,0xf66,0xf66,0xf66,
+0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,
+0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf4e,0xf4b,0xf4b,
+0xf4b,0xf4b,0xf4b,0xf4b,0xf60,0xf4b,0xf60,0xf5d,0xf5d,0xf60,0xf60,0xf4b,0xf60,0xf63,0xf66,0xf66,
+0xf66,0xf66,0xf66,0xf66,0xf66,0x111,0x111,0x111,0x111,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,0xf5a,
+0xf5a,0xf5a,0xf5a,0xf6c,0xf6c,0xf51,0xf57,0xf6c,0xf6c,0xf54,0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,
+0xf51,0xf51,0xf51,0xf51,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf4e,0xf51,0xf51,0xf51,
+0xf51,0xf51,0xf51,0xf51,0xf51,0xf51,0x111,0x111,0x111,0x106b,0x106b,0x1071,0x1077,0x1077,0x1077,0x1077,
+0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,
+0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1071,0x106b,0x106b,0x106b,0x106b,0x1071,
+0x1071,0x106b,0x106b,0x1074,0x1443,0x1440,0x1440,0x1077,0x1077,0x106e,0x106e,0x106e,0x106e,0x106e,0x106e,0x106e,
+0x106e,0x106e,0x106e,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,
+0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,
+0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1389,
+0x1392,0x138c,0x138c,0x1392,0x1392,0x1392,0x138c,0x1392,0x138c,0x138c,0x138c,0x1395,0x1395,0x18c,0x18c,0x18c,
+0x18c,0x18c,0x18c,0x18c,0x18c,0x138f,0x138f,0x138f,0x138f,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,
+0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,
+0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x1089,0x1089,0x1089,
+0x1089,0x1089,0x1089,0x1089,0x1089,0x107a,0x107a,0x107a,0x107a,0x107a,0x107a,0x107a,0x107a,0x1089,0x1089,0x1080,
+0x107d,0x126,0x126,0x126,0x108f,0x108f,0x1083,0x1083,0x1083,0x1086,0x1086,0x1086,0x1086,0x1086,0x1086,0x1086,
+0x1086,0x1086,0x1086,0x126,0x126,0x126,0x108c,0x108c,0x108c,0x1092,0x1092,0x1092,0x1092,0x1092,0x1092,0x1092,
+0x1092,0x1092,0x1092,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,
+0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,
+0x1095,0x1098,0x1098,0x1098,0x109b,0x1098,0x1098,0x109e,0x109e,0x1830,0x1830,0x1830,0x1830,0x1830,0x1830,0x1830,
+0x1830,0x1830,0x234,0x234,0x234,0x234,0x234,0x234,0x234,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,
+0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,
+0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,0x199b,
+0x199b,0x199b,0x199b,0x199b,0x267,0x267,0x199b,0x199b,0x199b,0x14be,0x14be,0x14be,0x14be,0x14be,0x14be,0x14be,
+0x14be,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1b9,0x1314,0x1311,0x1314,0x12f0,0x1311,0x1317,0x1317,
+0x131a,0x1317,0x131a,0x131d,0x1311,0x131a,0x131a,0x1311,0x1311,0x131a,0x12f3,0x1311,0x1311,0x1311,0x1311,0x1311,
+0x1311,0x1311,0x12f9,0x12f6,0x12ed,0x12ed,0x1317,0x12ed,0x12ed,0x12ed,0x12ed,0x12fc,0x14dc,0x14e2,0x14df,0x14df,
+0x192c,0x1707,0x1707,0x1a97,0x153,0x153,0x153,0x153,0x153,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,
+0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,
+0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd3e,
+0xd3e,0xd3e,0xd3e,0xd3e,0xd3b,0xd50,0xd50,0xd50,0xd4a,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,
+0xd50,0xd50,0xd50,0xd50,0xd4a,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,
+0xd50,0xd50,0xd50,0xd4a,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,
+0xd50,0xd50,0xd44,0xd44,0xd44,0xd44,0xd44,0xd4d,0xd4d,0xd4d,0xd4d,0xd41,0xd41,0xd41,0xd41,0xd41,
+0xd47,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe16,0xe19,0xe19,
+0xe19,0xe19,0xe19,0xe19,0xe19,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,
+0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,
+0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,
+0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,
+0xe8e,0xe8e,0xe8e,0xe8e,0xe88,0xee5,0xee5,0xe3a,0xe3a,0xf2d,0xf2d,0xf2d,0xf2d,0xf2d,0xf2d,0xf2d,
+0x102c,0x102c,0x102c,0x102c,0x102c,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,
+0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1533,0x1533,0x1533,0x1533,
+0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1533,0x1536,0x18ae,0x18ae,0x18ae,0x18ae,0xe7,
+0x17e5,0x1368,0x117c,0xf2d,0xf2d,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4aa,0x4aa,0x4aa,0x4aa,0x4ad,0x9b1,0xff6,0xff6,0xff9,0xff6,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,
+0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0x4b0,0x4aa,0xff9,0xff6,0xff9,0xff6,0xff9,0xff6,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x54,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x54,0x54,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x54,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x54,0x54,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x4bf,0x54,0x4bf,0x54,0x4bf,0x54,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x54,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b6,0x4bc,0x4b6,0x4b3,
+0x4bc,0x4bc,0x4bc,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b3,0x4b3,0x4b3,0x4bc,0x4bc,
+0x4bc,0x4bc,0x54,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x54,0x4b3,0x4b3,0x4b3,0x4bc,0x4bc,
+0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b3,0x4b3,0x4b3,0x54,0x54,
+0x4bc,0x4bc,0x4bc,0x54,0x4bc,0x4bc,0x4bf,0x4bf,0x4bf,0x4bf,0x4bf,0x4b9,0x4b6,0x54,0x4cb,0x4cb,
+0x4ce,0x4ce,0x4ce,0x4ce,0x4ce,0x4d1,0x4ce,0x4ce,0x4ce,0x4c5,0x50d,0x50a,0x507,0x507,0x6bd,0x4ef,
+0x4ec,0x6ba,0x6b7,0x6b4,0x6c6,0x4dd,0x6c3,0x6c3,0x4f2,0x4f5,0x6c0,0x6c0,0x4f2,0x4f5,0x69f,0x69f,
+0x6a2,0x4da,0x6ae,0x6ab,0x6ab,0x6a8,0x504,0x504,0x4c2,0x4c2,0x4c2,0x4c2,0x4c2,0xb4c,0x6b1,0x4e6,
+0x6c9,0x6cc,0x4fb,0x6b1,0x4e9,0x4e9,0x4da,0x4f5,0x4f5,0x69f,0x501,0x4fe,0x6a5,0x4d4,0x4d7,0x4da,
+0x4da,0x4da,0x4f8,0x4e3,0x4e0,0xbd0,0xae6,0xae9,0xae3,0xae3,0xae3,0xae3,0xbc7,0xbc7,0xbc7,0xbc7,
+0xbcd,0xd02,0xcff,0xde9,0xdec,0xbca,0xdec,0xdec,0xdec,0xdec,0xde9,0xdec,0xdec,0xbc4,0xbbe,0xbc1,
+0xbc1,0xbc1,0xffc,0x57,0x14e8,0x14e8,0x14e8,0x14e8,0x4c8,0x4c8,0x4c8,0x4c8,0x4c8,0x4c8,0x513,0xbd3,
+0x5a,0x5a,0x6d2,0x513,0x513,0x513,0x513,0x513,0x519,0x52b,0x519,0x525,0x51f,0x6d5,0x510,0x6cf,
+0x6cf,0x6cf,0x6cf,0x510,0x510,0x510,0x510,0x510,0x516,0x528,0x516,0x522,0x51c,0x5a,0xdef,0xdef,
+0xdef,0xdef,0xdef,0x134a,0x134a,0x134a,0x134a,0x134a,0x134a,0x134a,0x134a,0x5a,0x5a,0x5a,0x531,0x531,
+0x531,0x531,0x531,0x531,0x531,0x52e,0x534,0x74d,0x531,0x9b4,0x9d5,0xaec,0xaec,0xaec,0xbd6,0xbd6,
+0xdf2,0xdf2,0xdf2,0xdf2,0x116a,0x116d,0x116d,0x134d,0x14e5,0x150f,0x1512,0x1512,0x1725,0x18a2,0x5d,0x5d,
+0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x53a,0x53a,
+0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x53a,0x537,0x537,0x537,0x537,0x53a,
+0xaef,0xaf2,0xbd9,0xbdf,0xbdf,0xbdc,0xbdc,0xbdc,0xbdc,0xdf5,0xf06,0xf06,0xf06,0xf06,0x113d,0x60,
+0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x540,0x540,
+0x558,0x6db,0x53d,0x6d8,0x540,0x555,0x53d,0x6db,0x54f,0x558,0x558,0x558,0x54f,0x54f,0x558,0x558,
+0x558,0x6e4,0x53d,0x558,0x6de,0x53d,0x54c,0x558,0x558,0x558,0x558,0x558,0x53d,0x53d,0x543,0x6d8,
+0x6e1,0x53d,0x558,0x53d,0x6e7,0x53d,0x558,0x546,0x55e,0x6ea,0x558,0x558,0x549,0x54f,0x558,0x558,
+0x55b,0x558,0x54f,0x552,0x552,0x552,0x552,0xaf8,0xaf5,0xd05,0xdfb,0xbeb,0xbee,0xbee,0xbe8,0xbe5,
+0xbe5,0xbe5,0xbe5,0xbee,0xbeb,0xbeb,0xbeb,0xbeb,0xbe2,0xbe5,0xdf8,0xf09,0xf0c,0xfff,0x1170,0x1170,
+0x1170,0x6f0,0x6ed,0x561,0x564,0x564,0x564,0x564,0x564,0x6ed,0x6f0,0x6f0,0x6ed,0x564,0x6f6,0x6f6,
+0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x6f6,0x56d,0x56d,0x56d,0x56d,0x6f3,0x6f3,
+0x6f3,0x6f3,0x6f3,0x6f3,0x6f3,0x6f3,0x6f3,0x6f3,0x567,0x567,0x567,0x567,0x567,0x567,0x56a,0x56a,
+0x56a,0xafb,0xf0f,0x1002,0x1002,0x1002,0x1002,0x129c,0x1728,0x1728,0x63,0x63,0x63,0x63,0x6fc,0x6fc,
+0x6fc,0x6fc,0x6ff,0x6ff,0x6ff,0x6ff,0x6ff,0x6ff,0x576,0x576,0x573,0x573,0x573,0x573,0x573,0x573,
+0x573,0x573,0x573,0x573,0x573,0x573,0x570,0x579,0x579,0x573,0x573,0x573,0x576,0x570,0x573,0x573,
+0x570,0x570,0x570,0x570,0x573,0x573,0x6f9,0x6f9,0x570,0x570,0x573,0x573,0x573,0x573,0x573,0x573,
+0x573,0x573,0x573,0x573,0x573,0x573,0x573,0x576,0x576,0x576,0x573,0x573,0x6fc,0x573,0x6fc,0x573,
+0x573,0x573,0x573,0x573,0x573,0x573,0x570,0x573,0x570,0x570,0x570,0x570,0x570,0x570,0x573,0x573,
+0x570,0x6f9,0x570,0x570,0x570,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xafe,0xbf1,0xbf1,
+0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0xbf1,0x702,0x57c,0x702,0x702,0x57f,0x57c,
+0x57c,0x702,0x702,0x57f,0x57c,0x702,0x57f,0x57c,0x57c,0x702,0x57c,0x702,0x58b,0x588,0x57c,0x702,
+0x57c,0x57c,0x57c,0x57c,0x702,0x57c,0x57c,0x702,0x702,0x702,0x702,0x57c,0x57c,0x702,0x57f,0x702,
+0x57f,0x702,0x702,0x702,0x702,0x702,0x708,0x582,0x702,0x582,0x582,0x57c,0x57c,0x57c,0x702,0x702,
+0x702,0x702,0x57c,0x57c,0x57c,0x57c,0x702,0x702,0x57c,0x57c,0x57f,0x57c,0x57c,0x57f,0x57c,0x57c,
+0x57f,0x702,0x57f,0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,
+0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x705,0x702,0x57f,0x57c,0x702,0x702,0x702,
+0x702,0x57c,0x57c,0x702,0x702,0x57c,0x57f,0x705,0x705,0x57f,0x57f,0x57c,0x57c,0x57f,0x57f,0x57c,
+0x57c,0x57f,0x57f,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57f,0x57f,0x702,0x702,0x57f,0x57f,0x702,
+0x702,0x57f,0x57f,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x702,0x57c,
+0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x702,0x57c,
+0x57c,0x57c,0x57c,0x57c,0x57c,0x57f,0x57f,0x57f,0x57f,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,
+0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x702,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,
 0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,
-0x57c,0x57c,0x57c,0x57c,0x57f,0x57f,0x57f,0x57f,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57f,0x57f,
-0x57f,0x57f,0x57c,0x585,0x57c,0x57c,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,
-0xbf4,0xbf4,0xbf4,0xbf4,0x58e,0xb01,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x59a,0x597,0x59a,0x597,
-0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x70b,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x810,0x810,
-0x58e,0x58e,0x58e,0x58e,0x594,0x594,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x591,0x816,0x813,0x58e,
+0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57c,0x57f,0x57f,0x57f,0x57f,0x57c,0x57c,0x57c,
+0x57c,0x57c,0x57c,0x57f,0x57f,0x57f,0x57f,0x57c,0x585,0x57c,0x57c,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,
+0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0xbf4,0x58e,0xb01,0x58e,0x58e,0x58e,0x58e,0x58e,
+0x58e,0x59a,0x597,0x59a,0x597,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x70b,0x58e,0x58e,0x58e,0x58e,
+0x58e,0x58e,0x58e,0x810,0x810,0x58e,0x58e,0x58e,0x58e,0x594,0x594,0x58e,0x58e,0x58e,0x58e,0x58e,
+0x58e,0x591,0x816,0x813,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,
 0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,
 0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,
-0x58e,0x58e,0x58e,0xb01,0xbfa,0xb01,0xb01,0xb01,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,
+0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0x58e,0xb01,
+0xbfa,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb04,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,
+0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xbfa,0xbfa,0xbfa,0xbfa,
+0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,
+0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbf7,0xbfa,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,
+0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xd08,0xd0b,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,
+0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xf15,0xf15,0xf15,0xf15,0xf15,0xf15,0xf15,0xf12,0xf12,0xf12,0xf12,
+0xf12,0x1173,0x13ce,0x13ce,0x13ce,0x13ce,0x1350,0x1350,0x1350,0x13d1,0x1353,0x1353,0x13d1,0x1515,0x1515,0x1515,
+0x1515,0x1518,0x1518,0x1518,0x17df,0x17df,0x17df,0x17df,0x18a5,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,
 0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,
-0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,
-0x714,0x714,0x5a3,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,
-0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xd7d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
-0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x5a6,0x5a9,0x5a9,0x5a9,
-0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
-0x71d,0x71d,0x71d,0x71d,0x5a9,0x5a9,0x5a9,0x5a9,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
-0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,
-0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x5ac,0x5ac,0x720,0x720,0x720,0x720,0xbfd,0xbfd,
-0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0x726,0x726,0x5af,0x723,0x723,0x723,0x723,0x723,
-0x723,0x723,0x5b2,0x5b2,0x5af,0x5af,0x5b5,0x5b5,0x5b5,0x5b5,0x726,0x726,0x5b5,0x5b5,0x729,0x726,
-0x5af,0x5af,0x5af,0x5af,0x726,0x726,0x5b5,0x5b5,0x729,0x726,0x5af,0x5af,0x5af,0x5af,0x726,0x726,
-0x723,0x5af,0x5b5,0x726,0x5af,0x5af,0x723,0x726,0x726,0x726,0x5b5,0x5b5,0x5af,0x5af,0x5af,0x5af,
-0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x726,0x723,0x726,0x723,0x5af,0x5b5,
-0x5b5,0x5b5,0x5b5,0x5b5,0x5b5,0x5af,0x5af,0x723,0xb0a,0xb0a,0xb0a,0xb0a,0xb0a,0xb0a,0xb0a,0xb0a,
-0xc00,0xc00,0xc00,0xc03,0xc03,0xc7e,0xc7e,0xc00,0x5c4,0x5c4,0x5c4,0x5c4,0x5c1,0x73b,0x738,0x5bb,
-0x5bb,0x72c,0x5bb,0x5bb,0x5bb,0x5bb,0x732,0x72c,0x5bb,0x5c1,0x5bb,0x5b8,0xd86,0xd86,0xc09,0xc09,
-0xe07,0xb0d,0x5be,0x5be,0x72f,0x5c7,0x72f,0x5be,0x5c1,0x5bb,0x5c1,0x5c1,0x5bb,0x5bb,0x5c1,0x5bb,
-0x5bb,0x5bb,0x5c1,0x5bb,0x5bb,0x5bb,0x5c1,0x5c1,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,
-0x5c1,0x5c4,0x5c4,0x5be,0x5bb,0x5bb,0x5bb,0x5bb,0x73e,0x5bb,0x73e,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,
-0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x5bb,0x5bb,0x5bb,0x5bb,
-0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5c1,0x73e,0x73b,0x5ca,0x73e,0x72c,0x732,0x5c1,0x72c,
-0x735,0x72c,0x72c,0x5bb,0x72c,0x73b,0x5ca,0x73b,0xb0d,0xb0d,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,
-0xc0c,0xc0c,0xc0c,0xc0f,0xc0c,0xc0c,0xe04,0xebb,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,
-0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5d0,0x13d7,0x13d7,0x13d7,
-0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x151b,0x5dc,0x5e5,0x5dc,0x5dc,0x13d7,0x5d0,0x5d0,
-0x5e5,0x5e5,0x13da,0x13da,0x5e8,0x5e8,0x5d9,0x5df,0x5d9,0x5d9,0x5df,0x5d0,0x5df,0x5d0,0x5df,0x5d0,
-0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5df,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x13d7,0x5d0,0x5d0,0x5d0,
-0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5df,0x5df,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,
-0x5d0,0x744,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5df,0x5d0,0x5d0,0x5df,0x5d0,0x5d0,0x5d0,0x5d0,
-0x13d7,0x5d0,0x13d7,0x5d0,0x5d0,0x5d0,0x5d0,0x13d7,0x13d7,0x13d7,0x5d0,0x12cf,0x5d0,0x5d0,0x5d0,0x5d6,
-0x5d6,0x5d6,0x5d6,0x1359,0x1359,0x5d0,0x5d3,0x5e2,0x5e5,0x5d9,0x5d9,0x5d9,0xc15,0xc12,0xc15,0xc12,
-0xc15,0xc12,0xc15,0xc12,0xc15,0xc12,0xc15,0xc12,0xc15,0xc12,0x741,0x741,0x741,0x741,0x741,0x741,
-0x741,0x741,0x741,0x741,0x5d0,0x5df,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,
-0x5d0,0x5d0,0x5d0,0x5d0,0x13d7,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,
-0x5d0,0x5d0,0x5d0,0x13d7,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
-0x609,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,
-0x609,0x60f,0x600,0x603,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x60f,0x606,0x606,0x606,0x606,0x606,0x606,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
-0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
-0x609,0x609,0x609,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,
-0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,
-0x60c,0x612,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,
-0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,
-0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,
-0x60f,0x609,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,
-0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60c,0x612,0x60c,0x612,0x60f,0x609,0x60f,0x609,0x60f,0x609,
-0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60c,0x60f,0x609,0x60c,0x60f,0x609,0x60c,0x612,
-0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
-0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
-0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
-0x60c,0x60c,0x609,0x60c,0x609,0x60c,0x609,0x609,0x60c,0x609,0x609,0x60c,0x609,0x60c,0x609,0x609,
-0x60c,0x609,0x60c,0x60c,0x609,0x609,0x609,0x60c,0x609,0x609,0x609,0x609,0x609,0x60c,0x609,0x609,
-0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
-0x609,0x609,0x609,0x609,0x60c,0x60c,0x609,0x609,0x60c,0x609,0x60c,0x609,0x609,0x609,0x609,0x609,
-0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
-0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
-0x60c,0x60c,0x60c,0x612,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x60f,0x60f,0x60f,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,
-0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
-0x60f,0x60f,0x60f,0x60f,0x615,0x615,0x615,0x615,0x100b,0x100b,0x100b,0x151e,0x151e,0x151e,0x151e,0x151e,
-0x151e,0x151e,0x172b,0x172b,0x876,0x87c,0x87c,0x888,0x888,0x879,0x870,0x879,0x870,0x879,0x870,0x879,
-0x870,0x879,0x870,0x879,0x624,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x621,
-0x627,0x624,0x61e,0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,
-0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x621,
-0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,
-0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,
-0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,
-0x711,0x711,0x711,0x711,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,
+0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0x59d,0xb07,0xb07,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,
+0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,0x5a0,
+0x5a0,0x5a0,0x5a0,0x5a0,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,
+0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x711,0x711,0x711,0x711,0x711,0x711,0x711,
+0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x711,0x70e,0x70e,0x70e,
+0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,
+0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,
 0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,
-0x70e,0x70e,0x70e,0x70e,0x70e,0x70e,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,
-0x717,0x717,0x71a,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,
+0x70e,0x70e,0x70e,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x71a,0x717,0x717,
+0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x717,0x714,0x714,0x714,0x714,0x714,
 0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,0x714,
+0x714,0x714,0x714,0x714,0x714,0x5a3,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,
+0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xc63,0xd7d,0x71d,0x71d,0x71d,0x71d,0x71d,
 0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
 0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
-0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,
-0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,
-0xc6c,0x8dc,0x8d6,0x8d3,0x8d9,0x8d0,0x75c,0x75f,0x75f,0x75f,0x75f,0x75f,0x75f,0x75f,0x75f,0x75f,
-0x8e2,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,
-0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,
-0x75c,0x75c,0x8df,0x8df,0x762,0x8f1,0x8f4,0x8fa,0x81c,0x828,0x90f,0x825,0x8e8,0x8e5,0x8e8,0x8e5,
-0x8ee,0x8eb,0x8ee,0x8eb,0x8e8,0x8e5,0x822,0x8fa,0x8e8,0x8e5,0x8e8,0x8e5,0x8e8,0x8e5,0x8e8,0x8e5,
-0x8fd,0x906,0x903,0x903,0x768,0x7a4,0x7a4,0x7a4,0x7a4,0x7a4,0x7a4,0x79e,0x79e,0x79e,0x79e,0x79e,
-0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x76b,
-0x786,0x765,0x78c,0x78f,0x789,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x79b,0x79b,0x79b,0x79b,0x79b,
-0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x76b,
-0x786,0x765,0x786,0xc6f,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,
-0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,
-0x80a,0x80a,0x80a,0x80a,0x80a,0x80a,0x12c9,0x12c9,0x12c9,0x12c9,0x12c9,0x80d,0x822,0x825,0x825,0x825,
-0x825,0x825,0x825,0x825,0x825,0x825,0x945,0x945,0x945,0x945,0x82b,0x82b,0x900,0x90c,0x90c,0x90c,
-0x90c,0x909,0x81f,0x8f7,0xb31,0xb31,0xb31,0xc81,0xc9f,0xc9c,0xb4f,0x8cd,0x831,0x82e,0x831,0x834,
-0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x82e,0x82e,0x82e,0x82e,0x82e,0x831,0x831,0x82e,0x831,
-0x831,0x82e,0x831,0x831,0x82e,0x831,0x831,0x82e,0x831,0x831,0x82e,0x82e,0xca2,0x843,0x83d,0x843,
-0x83d,0x843,0x83d,0x843,0x83d,0x843,0x83d,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,
-0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x843,
-0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x83d,0x83d,0x83d,0x83d,0x83d,0x840,0x840,0x83d,0x840,
-0x840,0x83d,0x840,0x840,0x83d,0x840,0x840,0x83d,0x840,0x840,0x83d,0x83d,0x83d,0x83d,0x83d,0x843,
-0x83d,0x843,0x83d,0x843,0x83d,0x83d,0x83d,0x83d,0x83d,0x83d,0x843,0x83d,0x83d,0x83d,0x83d,0x83d,
-0x840,0x843,0x843,0x840,0x840,0x840,0x840,0x915,0x918,0x846,0x849,0xc8a,0x84f,0x84f,0x84f,0x84f,
-0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,
-0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x852,0x84f,0x84f,0x84f,
-0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,
-0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,
-0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,
-0x85b,0x85b,0x85b,0x85b,0xd8f,0xd8f,0xebe,0x855,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
-0x921,0x921,0x921,0x921,0xd89,0xd89,0xd89,0xd89,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,
-0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,
-0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x861,0x861,0x861,0x861,0x861,0x861,0xd92,
-0xd92,0xd92,0xd92,0x92d,0x92d,0x92d,0x92d,0x92d,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,
-0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,
-0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0xd92,0xd92,0x864,0x864,0x864,0x864,
-0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,
-0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x92a,0x92a,0x92a,0x92a,
-0x92a,0x92a,0x92a,0x92a,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,
-0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,
-0x867,0x867,0x867,0x867,0x867,0x867,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,
-0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0x112e,0x112e,0x112e,0x112e,
-0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,
-0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,
-0x86a,0x86a,0x86d,0x86d,0x86a,0x86d,0x86a,0x86d,0x86d,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,
-0x86a,0x86a,0x86a,0x86d,0x86a,0x86d,0x86a,0x86d,0x86d,0x86a,0x86a,0x86d,0x86d,0x86d,0x86a,0x86a,
-0x86a,0x86a,0x14d6,0x14d6,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
-0xc93,0xc93,0xc93,0xc93,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
-0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
-0x921,0x921,0x921,0x921,0x130e,0x130e,0x130e,0x130e,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,
-0xd89,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,
-0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,
-0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x927,0x924,0x927,0x924,0x924,0x924,0x924,0x924,0x924,
-0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0xc8d,0xc8d,0xc8d,
-0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0x92a,0x92a,0x92a,0x92a,
-0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,
-0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0xd92,0x9ab,0x98d,0x98d,0x98d,
-0x98d,0x987,0x98d,0x98d,0x99f,0x98d,0x98d,0x98a,0x996,0x99c,0x99c,0x99c,0x99c,0x99c,0x99f,0x987,
-0x993,0x987,0x987,0x987,0x97e,0x97e,0x987,0x987,0x987,0x987,0x987,0x987,0x9a2,0x9a2,0x9a2,0x9a2,
-0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x9a2,0x987,0x987,0x987,0x987,0x987,0x987,0x987,0x987,0x987,0x987,
-0x98a,0x97e,0x987,0x97e,0x987,0x97e,0x999,0x990,0x999,0x990,0x9a8,0x9a8,0x9b7,0x9b7,0x9b7,0x9b7,
-0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,
-0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9ba,0x9ba,0x9ba,0x9ba,
-0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,
-0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9bd,0x9bd,0x9bd,0x9bd,
-0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,
-0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9c6,0x9c6,0x9c6,0x9c6,
-0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,
-0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c0,0x9c0,0x9c9,0x9c9,0x9c9,0x9c9,
-0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,
-0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c3,0x9c3,0x9c6,0x9c6,0x9c6,0x9c6,
-0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,
-0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c9,0x9c9,0x9c9,0x9c9,
-0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,
-0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9cc,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cc,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
-0x9cf,0x9cf,0x9cf,0x9cf,0xa5c,0xa5c,0xff0,0xa5c,0xa5c,0xa5c,0xa5f,0xa5c,0xff0,0xa5c,0xa5c,0xfe7,
-0xa56,0xa4a,0xa4a,0xa4a,0xa4a,0xa59,0xa4a,0xfd8,0xfd8,0xfd8,0xa4a,0xa4d,0xa56,0xa50,0xfde,0xfea,
-0xfea,0xfd8,0xfd8,0xff0,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xb55,0xa62,0xa62,
-0xa53,0xa53,0xa53,0xa53,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa59,0xa59,0xa4a,0xa4a,0xff0,0xff0,
-0xff0,0xff0,0xfd8,0xfd8,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,
-0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,0xa5c,
-0xa5c,0xa5c,0xa5c,0xa5c,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xde6,
-0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,0xa71,
-0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,
-0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,0xa77,
-0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7a,0xa80,0xa7d,
-0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,0x1167,
-0x1164,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
-0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,0xa7d,
-0xa7d,0xa7d,0xa7d,0xa7d,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,
-0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,0xa92,
-0xa92,0xa92,0xa92,0xa92,0xab6,0xab6,0xab6,0xab9,0xab9,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
-0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xa9e,0xa9e,0xab3,0xa95,0xa95,0xa95,0xa95,0xa95,
-0xa95,0xa95,0xab3,0xab3,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
-0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,0xab6,
-0xab6,0xab6,0xab6,0xab6,0xad7,0xad7,0xad7,0xad7,0xad7,0xac2,0xac2,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xada,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,
-0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xad7,0xb01,0xb01,0xb01,0xb01,
-0xb01,0xb01,0xb01,0xb01,0xb04,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,
-0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xb01,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xb10,0xb10,0xb10,0xb10,
+0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
+0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x5a9,0x5a9,0x5a9,0x5a9,0x71d,
+0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
+0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,0x71d,
+0x71d,0x71d,0x71d,0x5a6,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x5a9,0x720,
+0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x720,0x5ac,
+0x5ac,0x720,0x720,0x720,0x720,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0xbfd,0x726,
+0x726,0x5af,0x723,0x723,0x723,0x723,0x723,0x723,0x723,0x5b2,0x5b2,0x5af,0x5af,0x5b5,0x5b5,0x5b5,
+0x5b5,0x726,0x726,0x5b5,0x5b5,0x729,0x726,0x5af,0x5af,0x5af,0x5af,0x726,0x726,0x5b5,0x5b5,0x729,
+0x726,0x5af,0x5af,0x5af,0x5af,0x726,0x726,0x723,0x5af,0x5b5,0x726,0x5af,0x5af,0x723,0x726,0x726,
+0x726,0x5b5,0x5b5,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,0x5af,
+0x5af,0x726,0x723,0x726,0x723,0x5af,0x5b5,0x5b5,0x5b5,0x5b5,0x5b5,0x5b5,0x5af,0x5af,0x723,0xb0a,
+0xb0a,0xb0a,0xb0a,0xb0a,0xb0a,0xb0a,0xb0a,0xc00,0xc00,0xc00,0xc03,0xc03,0xc7e,0xc7e,0xc00,0x5c4,
+0x5c4,0x5c4,0x5c4,0x5c1,0x73b,0x738,0x5bb,0x5bb,0x72c,0x5bb,0x5bb,0x5bb,0x5bb,0x732,0x72c,0x5bb,
+0x5c1,0x5bb,0x5b8,0xd86,0xd86,0xc09,0xc09,0xe07,0xb0d,0x5be,0x5be,0x72f,0x5c7,0x72f,0x5be,0x5c1,
+0x5bb,0x5c1,0x5c1,0x5bb,0x5bb,0x5c1,0x5bb,0x5bb,0x5bb,0x5c1,0x5bb,0x5bb,0x5bb,0x5c1,0x5c1,0x5bb,
+0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5c1,0x5c4,0x5c4,0x5be,0x5bb,0x5bb,0x5bb,0x5bb,0x73e,
+0x5bb,0x73e,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x819,0x819,
+0x819,0x819,0x819,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5bb,0x5c1,0x73e,
+0x73b,0x5ca,0x73e,0x72c,0x732,0x5c1,0x72c,0x735,0x72c,0x72c,0x5bb,0x72c,0x73b,0x5ca,0x73b,0xb0d,
+0xb0d,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc0f,0xc0c,0xc0c,0xe04,0xebb,0xc0c,
+0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc06,0xc06,0xc06,0xc06,0xd0e,0xd0e,0xd0e,0xd0e,0xd0e,0xd0e,0xd11,
+0xd11,0xe04,0xeb8,0xe04,0xe04,0xe04,0xe04,0xe01,0xe04,0xe01,0xe04,0xe04,0x1005,0x129f,0x129f,0xd14,
+0xd83,0xe01,0xe01,0xe01,0xe01,0xe01,0xe01,0xe01,0xe01,0xeb8,0xeb8,0xe01,0xe01,0xe01,0xe01,0xe04,
+0xe04,0xf18,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x12cc,0x12cc,0x12a2,0x1008,
+0x1008,0x1008,0x1008,0x12cc,0x12cc,0x12a2,0x12a2,0x12a8,0x129f,0x129f,0x129f,0x129f,0x12a2,0x13d4,0x12a8,0x12a2,
+0x12a8,0x129f,0x12a8,0x12cc,0x129f,0x129f,0x129f,0x12a2,0x12a2,0x129f,0x129f,0x12a2,0x129f,0x129f,0x12a2,0x12a2,
+0x12a2,0x1356,0x129f,0x1356,0x1356,0x1356,0x1356,0x129f,0x12a5,0x12cc,0x129f,0x129f,0x129f,0x129f,0x129f,0x12a5,
+0x12a8,0x12cc,0x12cc,0x12a8,0x12cc,0x129f,0x12a8,0x12a8,0x12ab,0x12cc,0x129f,0x129f,0x12cc,0x12a2,0x12a2,0x151b,
+0x5dc,0x5e5,0x5dc,0x5dc,0x13d7,0x5d0,0x5d0,0x5e5,0x5e5,0x13da,0x13da,0x5e8,0x5e8,0x5d9,0x5df,0x5d9,
+0x5d9,0x5df,0x5d0,0x5df,0x5d0,0x5df,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5df,0x5d0,0x5d0,0x5d0,
+0x5df,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x13d7,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,
+0x5d0,0x5d0,0x5df,0x5df,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x744,0x5d0,0x5d0,0x5d0,
+0x5d0,0x5df,0x5d0,0x5d0,0x5df,0x5d0,0x5d0,0x5d0,0x5d0,0x13d7,0x5d0,0x13d7,0x5d0,0x5d0,0x5d0,0x5d0,
+0x13d7,0x13d7,0x13d7,0x5d0,0x12cf,0x5d0,0x5d0,0x5d0,0x5d6,0x5d6,0x5d6,0x5d6,0x1359,0x1359,0x5d0,0x5d3,
+0x5e2,0x5e5,0x5d9,0x5d9,0x5d9,0xc15,0xc12,0xc15,0xc12,0xc15,0xc12,0xc15,0xc12,0xc15,0xc12,0xc15,
+0xc12,0xc15,0xc12,0x741,0x741,0x741,0x741,0x741,0x741,0x741,0x741,0x741,0x741,0x5cd,0x5cd,0x5cd,
+0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,0x5cd,
+0x5cd,0x5d0,0x13d7,0x13d7,0x13d7,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5df,0x5d0,
+0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x13d7,0x5d0,0x5d0,
+0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x5d0,0x13d7,0xe0d,0xe0d,0xe0d,
+0xe0d,0xe0d,0xe13,0xe10,0xf27,0xf27,0xf27,0xf27,0x141f,0x1017,0x141f,0x1365,0x1365,0xc42,0xc42,0xc42,
+0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,
+0xc42,0xc42,0xc42,0xc75,0xc72,0xc75,0xc72,0xc75,0xc72,0x1128,0x1125,0x101d,0x101a,0xc45,0xc45,0xc45,
+0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xb10,0xb10,0xb10,
 0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,
-0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb22,0xb22,0xb22,0xb22,
-0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,
-0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb28,0xb28,0xb28,0xb28,
-0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,
-0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb37,0xb37,0xb37,0xb37,
-0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,
-0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb3a,0xb3a,0xb3a,0xb3a,
-0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
-0xb3a,0xb3d,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
-0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
-0xb3a,0xb3a,0xb3a,0xb3a,0xb40,0xb40,0xc90,0xc90,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,
-0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xc90,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,
-0xb40,0xb40,0xb40,0xb40,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,
-0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,
-0xb64,0xb64,0xb64,0x1521,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xd1a,0xd1a,0xb6a,0xb6a,0xb6a,0xb6a,
-0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,
-0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xd17,0xd17,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,
-0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,
-0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,
-0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,
-0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,
-0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb76,0xb82,0xb88,
-0xb88,0xb88,0xb7c,0xb7c,0xb7c,0xb85,0xb79,0xb79,0xb79,0xb79,0xb79,0xb73,0xb73,0xb73,0xb73,0xb73,
-0xb73,0xb73,0xb73,0xb88,0xb88,0xb88,0xb88,0xb88,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7f,0xb7f,0xb88,0xb88,0xb88,0xb7c,
-0xb7c,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb88,0xb88,
-0xb88,0xb88,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7f,
-0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
-0xb7c,0xb7c,0x172e,0x172e,0xb94,0xb8b,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb8b,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb8b,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb8b,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb8b,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,
-0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,
-0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
-0xb94,0xb94,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
-0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xb94,0xb94,
-0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,
-0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,
-0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,
-0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,
-0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,
-0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,
-0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,
-0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbfa,0xbf7,0xbfa,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,
-0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xbf7,0xd08,0xd0b,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,0xdfe,
-0xdfe,0xdfe,0xdfe,0xdfe,0xf15,0xf15,0xf15,0xf15,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc0c,0xc06,0xc06,
-0xc06,0xc06,0xd0e,0xd0e,0xd0e,0xd0e,0xd0e,0xd0e,0xd11,0xd11,0xe04,0xeb8,0xe04,0xe04,0xe04,0xe04,
-0xe01,0xe04,0xe01,0xe04,0xe04,0x1005,0x129f,0x129f,0xe0d,0xe0d,0xe0d,0xe0d,0xe0d,0xe13,0xe10,0xf27,
-0xf27,0xf27,0xf27,0x141f,0x1017,0x141f,0x1365,0x1365,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,
-0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc42,0xc75,0xc72,0xc75,0xc72,0xc75,0xc72,
-0x1128,0x1125,0x101d,0x101a,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,0xc45,
-0xc45,0xc45,0xc45,0xc45,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
+0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,
+0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,
+0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xb10,0xc48,0xc48,0xc48,
+0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
+0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
+0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
+0xc48,0xc4b,0xc4b,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
+0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
+0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
 0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
-0xc48,0xc48,0xc48,0xc48,0xc4b,0xc4b,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,0xc48,
-0xc4e,0xc4e,0xc4e,0xc54,0xc51,0xc7b,0xc78,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc54,
-0xc51,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,
+0xc48,0xc48,0xc48,0xc4e,0xc4e,0xc4e,0xc54,0xc51,0xc7b,0xc78,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,
+0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc54,0xc51,0xc4e,0xc4e,0xc4e,0xc4e,
 0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,
-0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc54,0xc51,0xc54,0xc51,
 0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,
-0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc54,0xc51,0xc4e,0xc4e,
-0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc5d,0xc57,0xc57,0xc57,
+0xc4e,0xc4e,0xc4e,0xc54,0xc51,0xc54,0xc51,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,
+0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,
+0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc4e,0xc54,0xc51,0xc4e,0xc4e,0xc57,0xc57,0xc57,0xc57,0xc57,
+0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc5d,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
 0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
 0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
-0xc5d,0xc5d,0xc5d,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
+0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc5d,0xc5d,0xc5d,0xc57,
 0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
-0xc5a,0xc57,0xc57,0xc57,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
-0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
-0xc93,0xc93,0xc93,0xc93,0xd14,0xd83,0xe01,0xe01,0xe01,0xe01,0xe01,0xe01,0xe01,0xe01,0xeb8,0xeb8,
-0xe01,0xe01,0xe01,0xe01,0xe04,0xe04,0xf18,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,0x1005,
-0x1005,0x12cc,0x12cc,0x12a2,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,
-0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,0xd38,
-0xd38,0xd38,0xd38,0xd38,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd3e,0xd3e,0xd3e,0xd3e,0xd3e,0xd3b,
-0xd50,0xd50,0xd50,0xd4a,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd4a,
-0xd50,0xd50,0xd50,0xd50,0xd44,0xd44,0xd4d,0xd4d,0xd4d,0xd4d,0xd41,0xd41,0xd41,0xd41,0xd41,0xd47,
-0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe19,0xe16,0xe19,0xe19,0xe19,
-0xe19,0xe19,0xe19,0xe19,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,
-0xd50,0xd50,0xd4a,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,0xd50,
-0xd50,0xd44,0xd44,0xd44,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,
-0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,0xd47,
-0xd47,0xd47,0xd47,0xd47,0xd53,0xd53,0xd53,0xd53,0xd53,0xd56,0xd56,0xd56,0xd53,0xd53,0xd53,0xd53,
-0xd53,0xd53,0xe1c,0xe1c,0xe1c,0xe1c,0xe1c,0xe1c,0xf2a,0xf2a,0xf2a,0xf2a,0xf2a,0xf2a,0xf2a,0x1131,
-0x1131,0x1020,0x1020,0x1020,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,
-0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,
-0xd59,0xd59,0xd59,0xd59,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,
-0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,
-0xd5f,0xd5f,0xd5f,0xd5f,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,
-0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,
-0xd68,0xd68,0xd68,0xd68,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
-0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
-0xd74,0xd74,0xd74,0xd74,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,
-0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,
-0xd80,0xd80,0xd80,0xd80,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,
-0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,
-0xe22,0xe22,0xe22,0xe22,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,
-0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,
-0xe25,0xe25,0xe25,0xe25,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,
-0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,
-0xe28,0xe28,0xe28,0xe28,0xee5,0xee5,0xe3a,0xe3a,0xf2d,0xf2d,0xf2d,0xf2d,0xf2d,0xf2d,0xf2d,0x102c,
-0x102c,0x102c,0x102c,0x102c,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,0x1029,
-0x1029,0x1029,0x1029,0x1029,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,
-0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,
-0xe49,0xe46,0xe49,0xe46,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,
-0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,
-0xe55,0xe55,0xe55,0xe55,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,
+0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
+0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
+0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc5a,
+0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
+0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,0xc57,
+0xc57,0xc57,0xc57,0xd53,0xd53,0xd53,0xd53,0xd53,0xd56,0xd56,0xd56,0xd53,0xd53,0xd53,0xd53,0xd53,
+0xd53,0xe1c,0xe1c,0xe1c,0xe1c,0xe1c,0xe1c,0xf2a,0xf2a,0xf2a,0xf2a,0xf2a,0xf2a,0xf2a,0x1131,0x1131,
+0x1020,0x1020,0x1020,0xf2a,0xf2a,0xf2a,0xf2a,0x1020,0x1020,0x1020,0x1020,0x1020,0x1020,0x1020,0x1020,0x1020,
+0x1020,0x1020,0x1020,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,
+0x1023,0x1023,0x1023,0x1020,0x1020,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x152d,0x152d,0x152d,0x1131,0x1020,
+0x1020,0x1020,0x1020,0x12d8,0x12b1,0x12b1,0x12b1,0x12b1,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
+0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
+0x152d,0x152d,0xc3,0xc3,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
+0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
+0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x1944,0x1944,0x1944,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
+0x152d,0x152d,0x1a10,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x18ab,0x1944,0x1944,0x1944,0x1944,
+0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,
+0x1944,0x1944,0x1944,0x1944,0x1944,0x1731,0x1731,0x1731,0x1731,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,
+0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1a10,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,
 0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,
-0xe5b,0xe5b,0xe5b,0xe5b,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,
-0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xf30,0xf30,0xf30,0xf30,0x102f,
-0x102f,0x102f,0x102f,0x102f,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,
-0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,0xe7c,
-0xe7c,0xe7c,0xe7c,0xe7c,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,
-0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,
-0xe85,0xe85,0xe85,0xe85,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,
-0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,0xe8e,
-0xe8e,0xe8e,0xe8e,0xe88,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,
-0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8b,0xe8e,
-0xe8e,0xe8e,0xe8e,0xe8e,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
-0xe97,0xe97,0xe94,0xe94,0xe94,0xe94,0xe94,0xe94,0xe94,0xe94,0xe91,0xe9a,0x103b,0x1035,0x1044,0x1032,
-0xe97,0xe97,0x1032,0x1032,0xea9,0xea9,0xe9d,0xea9,0xea9,0xea9,0xea0,0xea9,0xea9,0xea9,0xea9,0xe9d,
-0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,
-0xea9,0xea9,0xea9,0xea9,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,
+0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,
+0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xe5b,0xf6,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,
+0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,
+0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xe58,0xf6,0xf72,0xf6f,0xf72,0xf72,0xf72,0xf6f,0xf6f,
+0xf72,0xf6f,0xf72,0xf6f,0xf72,0xf6f,0x1056,0x1056,0x1056,0x1191,0x104d,0x1056,0x104d,0xf6f,0xf72,0xf6f,
+0xf6f,0x104d,0x104d,0x104d,0x104d,0x1050,0x1053,0x1191,0x1191,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,
+0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,
+0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,
+0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,
+0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe49,0xe46,0xe46,0xe3d,0xe3d,0xe3d,0xe3d,0xe3d,0xe3d,
+0x1185,0x1182,0x1185,0x1182,0x117f,0x117f,0x117f,0x1425,0x1422,0xea,0xea,0xea,0xea,0xea,0xe43,0xe40,
+0xe40,0xe40,0xe3d,0xe43,0xe40,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,
+0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,
+0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xe55,0xf3,0x1428,0xf3,0xf3,0xf3,
+0xf3,0xf3,0x1428,0xf3,0xf3,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,
 0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,
-0xeac,0xeac,0xeac,0xeac,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,
-0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,
-0xec4,0xec4,0xec4,0xec4,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,
-0xee2,0xee2,0xee2,0xee2,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,
-0x113a,0x113a,0x113a,0x113a,0xf15,0xf15,0xf15,0xf12,0xf12,0xf12,0xf12,0xf12,0x1173,0x13ce,0x13ce,0x13ce,
-0x13ce,0x1350,0x1350,0x1350,0x13d1,0x1353,0x1353,0x13d1,0x1515,0x1515,0x1515,0x1515,0x1518,0x1518,0x1518,0x17df,
-0x17df,0x17df,0x17df,0x18a5,0xf2a,0xf2a,0xf2a,0xf2a,0x1020,0x1020,0x1020,0x1020,0x1020,0x1020,0x1020,0x1020,
-0x1020,0x1020,0x1020,0x1020,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,
-0x1023,0x1023,0x1023,0x1023,0xf4b,0xf4b,0xf4b,0xf4b,0xf5d,0xf66,0xf69,0xf66,0xf69,0xf66,0xf69,0xf66,
-0xf69,0xf66,0xf69,0xf66,0xf66,0xf66,0xf69,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,
-0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf66,0xf4e,0xf4b,0xf4b,0xf4b,
-0xf4b,0xf4b,0xf4b,0xf60,0xf4b,0xf60,0xf5d,0xf5d,0xf72,0xf6f,0xf72,0xf72,0xf72,0xf6f,0xf6f,0xf72,
-0xf6f,0xf72,0xf6f,0xf72,0xf6f,0x1056,0x1056,0x1056,0x1191,0x104d,0x1056,0x104d,0xf6f,0xf72,0xf6f,0xf6f,
-0x104d,0x104d,0x104d,0x104d,0x1050,0x1053,0x1191,0x1191,0xf75,0xf75,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,
-0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x105f,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,
-0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,
-0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,
-0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,
-0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,
-0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0x1554,0x1554,0x1554,0x1554,0x1554,
-0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0xf90,0xf90,0xf90,0xf90,
-0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,
-0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xfd8,0xff0,0xfe7,0xfed,
-0xfed,0xff0,0xff0,0xfe7,0xfe7,0xfed,0xfed,0xfed,0xfed,0xfed,0xff0,0xff0,0xff0,0xfd8,0xfd8,0xfd8,
-0xfd8,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xff0,0xfd8,0xfe7,
-0xfea,0xfd8,0xfd8,0xfed,0xfed,0xfed,0xfed,0xfed,0xfed,0xfdb,0xff0,0xfed,0xfe4,0xfe4,0xfe4,0xfe4,
-0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0xfe4,0x115b,0x115b,0x1158,0x1155,0xfe1,0xfe1,0x1008,0x1008,0x1008,0x1008,
-0x12cc,0x12cc,0x12a2,0x12a2,0x12a8,0x129f,0x129f,0x129f,0x129f,0x12a2,0x13d4,0x12a8,0x12a2,0x12a8,0x129f,0x12a8,
-0x12cc,0x129f,0x129f,0x129f,0x12a2,0x12a2,0x129f,0x129f,0x12a2,0x129f,0x129f,0x12a2,0x1023,0x1023,0x1023,0x1023,
-0x1023,0x1020,0x1020,0x1023,0x1023,0x1023,0x1023,0x1023,0x1023,0x152d,0x152d,0x152d,0x1131,0x1020,0x1020,0x1020,
-0x1020,0x12d8,0x12b1,0x12b1,0x12b1,0x12b1,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x1041,0x1041,0x103e,0x1038,
-0x103e,0x1038,0x103e,0x1038,0x103e,0x1038,0x1035,0x1035,0x1035,0x1035,0x104a,0x1047,0x1035,0x118e,0x142b,0x142e,
-0x142e,0x142b,0x142b,0x142b,0x142b,0x142b,0x1431,0x1431,0x1548,0x153c,0x153c,0x1539,0x1068,0x105f,0x1068,0x105f,
-0x1068,0x105f,0x1068,0x105f,0x105c,0x1059,0x1059,0x1068,0x105f,0x1374,0x1371,0x1737,0x1374,0x1371,0x143a,0x1437,
-0x154b,0x154b,0x1551,0x154b,0x1551,0x154b,0x1551,0x154b,0x1551,0x154b,0x1551,0x154b,0x1068,0x105f,0x1068,0x105f,
-0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,
-0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1062,0x105f,0x105f,0x105f,
-0x105f,0x105f,0x105f,0x105f,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x1068,0x105f,0x106b,0x106b,0x1071,0x1077,
-0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,
-0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1077,0x1071,0x106b,0x106b,
-0x106b,0x106b,0x1071,0x1071,0x106b,0x106b,0x1074,0x1443,0x1440,0x1440,0x1077,0x1077,0x106e,0x106e,0x106e,0x106e,
-0x106e,0x106e,0x106e,0x106e,0x106e,0x106e,0x1446,0x1446,0x1446,0x1446,0x1446,0x1446,0x108c,0x108c,0x108c,0x108c,
-0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,
-0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x108c,0x1095,0x1095,0x1095,0x1095,
-0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,0x1095,
-0x1095,0x1095,0x1095,0x1095,0x1098,0x1098,0x1098,0x109b,0x1098,0x1098,0x109e,0x109e,0x10a1,0x10a1,0x10a1,0x10a1,
+0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0xeac,0x1434,0x1434,0x108,0x108,0x108,
+0x108,0x108,0x108,0x108,0xeaf,0x136e,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,0x108,
+0x108,0x108,0x108,0x108,0x136b,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,
+0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xed,0xed,0xed,0xed,
+0xed,0xed,0xed,0xed,0xed,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xed,0xe4c,0xe4c,0xe4c,
+0xe4c,0xe4c,0xe4c,0xe4c,0xed,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xe4c,0xed,0xe4c,0xe4c,0xe4c,
+0xe4c,0xe4c,0xe4c,0xe4c,0xed,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,
 0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,
-0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0x10aa,0x10aa,0x10aa,0x10aa,
-0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10ad,0x10a4,0x10b3,0x10b0,0x10aa,0x10aa,0x10aa,0x10aa,
-0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,
-0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x137a,0x1377,0x10c5,0x10bf,
-0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c2,0x1143,0x10b6,0x10b6,0x10b6,0x10bc,
-0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x10b9,0x10b9,0x10bc,0x10c8,0x10c5,0x10bf,0x10c5,0x10bf,
-0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,
-0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x1560,0x155d,0x1560,0x155d,
-0x1563,0x1563,0x1740,0x1449,0x10d1,0x10d1,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,
-0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,
-0x10d4,0x10d4,0x10d4,0x10d4,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,
-0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10da,0x10da,0x10da,0x10da,0x10da,0x10dd,0x10dd,0x10dd,0x1137,0x10e6,
-0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,
-0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,
-0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,
-0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,
-0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,
-0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,
-0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,
-0x111f,0x111f,0x111f,0x111f,0x1134,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,
-0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,
-0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,
-0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,
-0x112e,0x112e,0x112e,0x112e,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x14d3,0x17be,0x17be,0x17be,
-0x17be,0x17be,0x17be,0x17be,0x17be,0x17be,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,
-0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,
-0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x11a3,0x119a,0x119a,0x119d,0x119d,0x11a3,0x119a,0x119a,0x119a,0x119a,0x119a,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,0x11a9,
-0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,
-0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,0x11c4,
+0x10a1,0x10a1,0x10a1,0x10a1,0x10a1,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,0xe97,
+0xe97,0xe97,0xe97,0xe94,0xe94,0xe94,0xe94,0xe94,0xe94,0xe94,0xe94,0xe91,0xe9a,0x103b,0x1035,0x1044,
+0x1032,0xe97,0xe97,0x1032,0x1032,0x1041,0x1041,0x103e,0x1038,0x103e,0x1038,0x103e,0x1038,0x103e,0x1038,0x1035,
+0x1035,0x1035,0x1035,0x104a,0x1047,0x1035,0x118e,0x142b,0x142e,0x142e,0x142b,0x142b,0x142b,0x142b,0x142b,0x1431,
+0x1431,0x1548,0x153c,0x153c,0x1539,0x153f,0x1545,0x1542,0x188d,0x17e8,0x18b1,0x18b1,0x18b1,0x18b1,0x18b1,0x1950,
+0x194d,0x1953,0x194d,0x1953,0x1a13,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
+0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
+0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,0x102,
+0x102,0x102,0x102,0x102,0x102,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,
+0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0x6c,
+0xb22,0xb22,0xb22,0xb22,0xb25,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,
+0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,
+0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,
+0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb22,0xb25,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,0x6c,
+0x6c,0x6c,0x6c,0x6c,0x6c,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,
+0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,
+0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,
+0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,0xb28,
+0xb28,0xb28,0xb28,0xb28,0xb28,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0x6f,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0xb2b,
+0xb2b,0xb2e,0xb2e,0xb2b,0xb2b,0xb2b,0xb2b,0xb2b,0xb2b,0xb2b,0xb2b,0x72,0x72,0x72,0x72,0x762,
+0x8f1,0x8f4,0x8fa,0x81c,0x828,0x90f,0x825,0x8e8,0x8e5,0x8e8,0x8e5,0x8ee,0x8eb,0x8ee,0x8eb,0x8e8,
+0x8e5,0x822,0x8fa,0x8e8,0x8e5,0x8e8,0x8e5,0x8e8,0x8e5,0x8e8,0x8e5,0x8fd,0x906,0x903,0x903,0x822,
+0x825,0x825,0x825,0x825,0x825,0x825,0x825,0x825,0x825,0x945,0x945,0x945,0x945,0x82b,0x82b,0x900,
+0x90c,0x90c,0x90c,0x90c,0x909,0x81f,0x8f7,0xb31,0xb31,0xb31,0xc81,0xc9f,0xc9c,0xb4f,0x8cd,0x75,
+0x834,0x82e,0x834,0x82e,0x834,0x82e,0x834,0x82e,0x834,0x82e,0x82e,0x831,0x82e,0x831,0x82e,0x831,
+0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x831,
+0x82e,0x831,0x834,0x82e,0x831,0x82e,0x831,0x82e,0x831,0x82e,0x82e,0x82e,0x82e,0x82e,0x82e,0x831,
+0x831,0x82e,0x831,0x831,0x82e,0x831,0x831,0x82e,0x831,0x831,0x82e,0x831,0x831,0x82e,0x82e,0x82e,
+0x834,0x82e,0x834,0x82e,0x834,0x82e,0x82e,0x82e,0x82e,0x82e,0x82e,0x834,0x82e,0x82e,0x82e,0x82e,
+0x82e,0x831,0xc87,0xc87,0x75,0x75,0x948,0x948,0x912,0x912,0x837,0x83a,0xc84,0xca2,0x843,0x83d,
+0x843,0x83d,0x843,0x83d,0x843,0x83d,0x843,0x83d,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,
+0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x83d,0x840,0x843,0x83d,
+0x840,0x83d,0x840,0x83d,0x840,0x83d,0x83d,0x83d,0x83d,0x83d,0x83d,0x840,0x840,0x83d,0x840,0x840,
+0x83d,0x840,0x840,0x83d,0x840,0x840,0x83d,0x840,0x840,0x83d,0x83d,0x83d,0x83d,0x83d,0x843,0x83d,
+0x843,0x83d,0x843,0x83d,0x83d,0x83d,0x83d,0x83d,0x83d,0x843,0x83d,0x83d,0x83d,0x83d,0x83d,0x840,
+0x843,0x843,0x840,0x840,0x840,0x840,0x915,0x918,0x846,0x849,0xc8a,0x78,0x78,0x78,0x78,0x78,
+0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,
+0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,
+0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x84c,0x112b,0x190b,0x19ef,0x7b,0x84f,0x84f,0x84f,0x84f,
+0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,
+0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,
+0x852,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,
+0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x84f,0x7b,0x91b,0x91b,0x91e,
+0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0x91e,0xb34,0xb34,0xb34,
+0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,0xb34,
+0xb34,0xb34,0xb34,0xb34,0xb34,0x13dd,0x13dd,0x13dd,0x7e,0x7e,0x7e,0x7e,0x7e,0xee2,0xee2,0xee2,
+0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0xee2,0x113a,0x113a,0x113a,
+0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,0x113a,
+0x113a,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xe4,0xc96,0xc96,0xc96,
+0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0xc96,0x858,0x858,0x858,
+0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,
+0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0x858,0xd8c,0xd8c,0x81,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x921,0x130e,0x130e,0x130e,
+0x130e,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0x12ae,0xd89,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,
+0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,
+0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,0x85b,
+0x85b,0x85b,0x85b,0x85b,0x85b,0xd8f,0xd8f,0xebe,0x855,0x924,0x924,0x924,0x924,0x924,0x924,0x924,
+0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,
+0x927,0x924,0x927,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,
+0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0x924,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,
+0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0xc8d,0x921,0x921,0x921,0x921,0x921,0x921,0x921,
+0x921,0x921,0x921,0x921,0x921,0xd89,0xd89,0xd89,0xd89,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,
+0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,
+0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,
+0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x85e,0x81,0x864,0x864,0x864,0x864,0x864,0x864,0x864,
+0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,
+0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,
+0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,
+0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x864,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,
+0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,
+0x92a,0x92a,0x861,0x861,0x861,0x861,0x861,0x861,0xd92,0xd92,0xd92,0xd92,0x92d,0x92d,0x92d,0x92d,
+0x92d,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,
+0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,
+0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,
+0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,0x861,
+0x861,0xd92,0xd92,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,
+0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,0x92a,
+0x92a,0x92a,0xd92,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,
+0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,
+0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,
+0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,0xb37,
+0xb37,0xb37,0xb37,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0x2a0,0xd59,0xd59,0xd59,
+0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,
+0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,
+0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,
+0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0xd59,0x867,0x867,0x867,
+0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,
+0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,
+0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,
+0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0x867,0xec1,0xec1,0xec1,
+0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,0xec1,
+0xec1,0xec1,0xec1,0x112e,0x112e,0x112e,0x112e,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x12d2,0x14d3,
+0x17be,0x17be,0x17be,0x17be,0x17be,0x17be,0x17be,0x17be,0x17be,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,
+0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x190e,0x19f2,0x19f2,
+0x19f2,0x19f2,0x19f2,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,0x2a3,
+0x2a3,0x2a3,0x2a3,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
+0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3d,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
+0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
+0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
+0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,
+0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0xb3a,0x84,0x84,0x84,0xb40,0xb40,0xb40,0xb40,
+0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xc90,0xc90,
+0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,
+0xc90,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xb40,0xc90,0xb40,0xb40,0xb40,
+0xc90,0xb40,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x87,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,
 0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,
-0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11cd,0x11d3,
+0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,
+0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11d0,0x11cd,0x11d3,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,
+0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,
+0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,
+0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,
+0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10ad,0x10a4,0x10b3,0x10b0,0x10aa,
+0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10aa,0x10a7,
+0x10a7,0x10a7,0x10a7,0x10a7,0x10a7,0x10a7,0x10a7,0x10a7,0x10a7,0x10aa,0x10aa,0x129,0x129,0x129,0x129,0x129,
+0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x129,0x10c5,
+0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,
+0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x137a,
+0x1377,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c2,0x1143,0x10b6,
+0x10b6,0x10b6,0x10bc,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x1449,0x10b9,0x10b9,0x10bc,0x10c8,0x10c5,
+0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,
+0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x10c5,0x10bf,0x1560,0x155d,0x1560,0x155d,0x1563,0x1563,0x1740,0x1449,0x11df,
 0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,
 0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,
-0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,
-0x11e5,0x1320,0x11eb,0x1323,0x11eb,0x11eb,0x11eb,0x11eb,0x11e8,0x11e8,0x11e8,0x11eb,0x1743,0x1746,0x1968,0x1965,
-0x11ee,0x11ee,0x11ee,0x11fd,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,
+0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11df,0x11d6,
+0x11d6,0x11d9,0x11e2,0x11dc,0x11dc,0x11dc,0x11e2,0x156,0x156,0x156,0x156,0x156,0x156,0x156,0x156,0xe73,
+0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,
+0xe73,0xe73,0xe73,0xe73,0xe73,0xe73,0xf30,0xf30,0xf30,0xf30,0x102f,0x102f,0x102f,0x102f,0x102f,0xf75,
+0xf75,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x105f,
+0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,
+0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,
+0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,
+0x105f,0x1062,0x105f,0x105f,0x105f,0x105f,0x105f,0x105f,0x105f,0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x1068,
+0x105f,0x1068,0x105f,0x1068,0x105f,0x1068,0x105f,0x105c,0x1059,0x1059,0x1068,0x105f,0x1374,0x1371,0x1737,0x1374,
+0x1371,0x143a,0x1437,0x154b,0x154b,0x1551,0x154b,0x1551,0x154b,0x1551,0x154b,0x1551,0x154b,0x1551,0x154b,0x1374,
+0x1371,0x1374,0x1371,0x1374,0x1371,0x1374,0x1371,0x1374,0x1371,0x143a,0x1551,0x1551,0x1551,0x17eb,0x195c,0x1551,
+0x1551,0x173a,0x173a,0x173a,0x1734,0x173a,0x1734,0x195f,0x195c,0x1a19,0x1a16,0x1a19,0x1a16,0x1a19,0x1a16,0x114,
+0x114,0x1a19,0x1a16,0x1a19,0x1a19,0x1a19,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
+0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
+0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,0x114,
+0x114,0x114,0x114,0x114,0x114,0x114,0x154e,0x143d,0x143d,0x1371,0x1065,0x1065,0x1065,0x1065,0x1065,0xea9,
+0xea9,0xe9d,0xea9,0xea9,0xea9,0xea0,0xea9,0xea9,0xea9,0xea9,0xe9d,0xea9,0xea9,0xea9,0xea9,0xea9,
+0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,0xea9,
+0xea9,0xea9,0xea6,0xea6,0xe9d,0xe9d,0xea6,0xea3,0xea3,0xea3,0xea3,0x105,0x105,0x105,0x105,0x1305,
+0x1305,0x1305,0x1308,0x1308,0x1308,0x12ff,0x12ff,0x1302,0x12ff,0x159,0x159,0x159,0x159,0x159,0x159,0xf7b,
+0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,
+0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,
+0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,0xf7b,
+0xf7b,0xf7b,0xf7b,0xf78,0xf78,0xf7e,0xf7e,0x117,0x117,0x117,0x117,0x117,0x117,0x117,0x117,0x10d1,
+0x10d1,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,
+0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,
+0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,0x10d4,
+0x10d4,0x10d4,0x10d4,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10d1,0x10cb,
+0x17ee,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x10d7,0x10d7,0x10ce,0x10ce,0x10ce,0x10ce,0x10ce,
+0x10ce,0x10ce,0x10ce,0x10ce,0x10ce,0x12c,0x12c,0x12c,0x12c,0x12c,0x12c,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,
+0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x11e5,0x1320,0x11eb,0x1323,0x11eb,
+0x11eb,0x11eb,0x11eb,0x11e8,0x11e8,0x11e8,0x11eb,0x1743,0x1746,0x1968,0x1965,0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,
+0x10e0,0x10e0,0x10e0,0x10e0,0x10e0,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,
+0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,0x10e3,
+0x10e3,0x10da,0x10da,0x10da,0x10da,0x10da,0x10dd,0x10dd,0x10dd,0x1137,0x10e6,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,
+0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10f5,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,
+0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10e9,0x10ef,0x10f2,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,0x12f,
+0x12f,0x12f,0x12f,0x10ec,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,
+0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,0x12db,
+0x12db,0x15c,0x15c,0x15c,0x11ee,0x11ee,0x11ee,0x11fd,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,
 0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,
-0x1203,0x1203,0x1203,0x11f1,0x11fd,0x11fd,0x11ee,0x11ee,0x11ee,0x11ee,0x11fd,0x11fd,0x11ee,0x11fd,0x11fd,0x11fd,
-0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,
-0x1212,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x1209,0x1209,0x1209,0x120f,0x120c,0x1569,0x156c,0x156f,0x156f,
-0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,
-0x1215,0x1221,0x1215,0x1215,0x1215,0x122a,0x122a,0x1215,0x1215,0x122a,0x1221,0x122a,0x122a,0x1221,0x1215,0x1218,
+0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,
+0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x1203,0x11f1,0x11fd,0x11fd,0x11ee,0x11ee,0x11ee,0x11ee,0x11fd,0x11fd,
+0x11ee,0x11fd,0x11fd,0x11fd,0x1200,0x11f4,0x11f4,0x11f4,0x11f4,0x11f4,0x11f4,0x11f7,0x1206,0x1206,0x11f4,0x11f4,
+0x11f4,0x11f4,0x15f,0x130b,0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x11fa,0x15f,0x15f,
+0x15f,0x15f,0x11f4,0x11f4,0x165f,0x165f,0x165f,0x165f,0x165f,0x1659,0x1662,0x165f,0x165f,0x165f,0x165f,0x165f,
+0x165f,0x165f,0x165f,0x165f,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165c,0x165f,0x165f,
+0x165f,0x165f,0x165f,0x1f2,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,
+0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,
+0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x10f8,0x10f8,0x10f8,
+0x10f8,0x10f8,0x10f8,0x1101,0x1101,0x10f8,0x10f8,0x1101,0x1101,0x10f8,0x10f8,0x132,0x132,0x132,0x132,0x132,
+0x132,0x132,0x132,0x132,0x1104,0x1104,0x1104,0x10f8,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,0x1104,
+0x10f8,0x1101,0x132,0x132,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x10fe,0x132,0x132,
+0x10fb,0x1107,0x1107,0x1107,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,
+0x120f,0x120f,0x120f,0x120f,0x1212,0x120f,0x120f,0x120f,0x120f,0x120f,0x120f,0x1209,0x1209,0x1209,0x120f,0x120c,
+0x1569,0x156c,0x156f,0x156f,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,
 0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,
 0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,0x1221,
-0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,
-0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,
-0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,
-0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1251,0x1251,0x1251,
-0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,
-0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,
-0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,
-0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,
-0x1272,0x1272,0x1281,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,
-0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1287,0x1284,0x1287,0x1284,0x1284,0x1284,
-0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1287,0x1284,0x1284,0x1284,0x1284,
-0x1281,0x1281,0x1281,0x1275,0x1275,0x1275,0x1275,0x1281,0x1281,0x127b,0x1278,0x127e,0x127e,0x128d,0x128a,0x128a,
-0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,
-0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,
-0x1296,0x1296,0x1296,0x1293,0x1293,0x1293,0x1290,0x1290,0x1290,0x1290,0x1293,0x1290,0x1290,0x1290,0x1296,0x1293,
-0x1296,0x1293,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,
-0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1296,0x1293,0x1293,
-0x1290,0x1290,0x1290,0x1290,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12ba,
-0x12ba,0x12ba,0x1299,0x196e,0x13c8,0x12c3,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,
-0x13c8,0x12c3,0x13c8,0x12c3,0x12a2,0x12a2,0x1356,0x129f,0x1356,0x1356,0x1356,0x1356,0x129f,0x12a5,0x12cc,0x129f,
-0x129f,0x129f,0x129f,0x129f,0x12a5,0x12a8,0x12cc,0x12cc,0x12a8,0x12cc,0x129f,0x12a8,0x12a8,0x12ab,0x12cc,0x129f,
-0x129f,0x12cc,0x12a2,0x12a2,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x12b4,0x12b4,
-0x12b4,0x12b4,0x13e0,0x13bf,0x12bd,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x186c,
-0x186c,0x186c,0x186c,0x186c,0x13c8,0x13c8,0x12c3,0x13c8,0x13c8,0x13c8,0x12c3,0x13c8,0x13c8,0x13c8,0x12bd,0x12bd,
-0x12bd,0x12bd,0x12bd,0x13c2,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x12c0,0x13c5,0x13c5,0x13c5,0x13c5,
-0x13c5,0x13c5,0x13c5,0x12c0,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,
-0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,
-0x12ea,0x12ea,0x12ea,0x12ea,0x1374,0x1371,0x1374,0x1371,0x1374,0x1371,0x1374,0x1371,0x1374,0x1371,0x143a,0x1551,
-0x1551,0x1551,0x17eb,0x195c,0x1551,0x1551,0x173a,0x173a,0x173a,0x1734,0x173a,0x1734,0x195f,0x195c,0x1a19,0x1a16,
-0x1a19,0x1a16,0x1a19,0x1a16,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,
-0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,0x1398,
-0x1398,0x1398,0x1398,0x1398,0x13ad,0x139e,0x13ad,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,
-0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,
-0x13b0,0x13b0,0x13b0,0x13b0,0x139e,0x139e,0x139e,0x139e,0x139e,0x139e,0x139e,0x139e,0x13b6,0x13b6,0x13b6,0x13b6,
-0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,
-0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13bc,0x13bc,0x13bc,0x13bc,
-0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,
-0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13ec,0x13e9,0x1914,0x1914,
-0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,
-0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f2,0x13f2,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f5,0x13f5,0x13f5,0x13f2,0x13f5,0x13f2,0x13f5,
-0x13f2,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f5,0x13f2,0x13f2,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f2,0x13f2,0x13f2,
-0x13f2,0x13f2,0x13f2,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,
-0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x157b,0x157b,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x1587,0x1581,0x1581,0x1587,0x1587,0x1587,0x1587,
-0x1587,0x1587,0x1587,0x1587,0x1587,0x17c1,0x17c1,0x17c1,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x1587,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x1587,0x17c1,0x17c1,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x1581,0x1581,0x1587,0x1587,0x1581,0x1587,0x1587,0x1587,0x157e,0x157e,0x1587,0x1587,
-0x13f5,0x13f5,0x13f8,0x13f8,0x13f8,0x16f2,0x13f5,0x13f8,0x13f5,0x13f5,0x13f8,0x158a,0x158a,0x1587,0x1587,0x17c1,
-0x17c1,0x17c1,0x17c1,0x17c1,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x1581,0x1581,0x1587,0x16f2,0x1587,0x1581,0x1587,0x17c1,0x17c1,0x17c1,0x17c4,0x17c4,0x17c4,0x17c4,0x17c4,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x1587,
-0x13f5,0x1587,0x13f8,0x13f8,0x13f5,0x13f5,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,
-0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,
-0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f8,0x13f8,
-0x13f5,0x13f8,0x13f8,0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f8,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x16f2,0x13f5,0x13f5,0x13f5,0x13f5,0x1587,0x1581,0x17c1,
-0x144f,0x144f,0x144f,0x144f,0x157b,0x157b,0x157e,0x157e,0x157e,0x1584,0x1587,0x17c1,0x17c1,0x17c1,0x17c1,0x1749,
-0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
-0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1587,0x1581,0x1581,0x1587,0x158a,0x158a,0x1587,0x1587,
-0x1587,0x1587,0x1875,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1581,0x1587,0x1581,0x1581,0x1581,0x1581,
-0x1587,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1581,0x1581,0x1581,0x1587,0x157e,0x157e,0x157e,0x157e,
-0x157e,0x157e,0x1587,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x14d9,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
-0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x14d9,
-0x13fb,0x14d9,0x13fb,0x14d9,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x14d9,0x14d9,
-0x13fb,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x14d9,0x14d9,0x13fb,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x13fb,0x13fb,
-0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x16f8,0x16f8,0x17c7,0x17c7,0x13fe,0x13fe,0x13fe,
-0x13fb,0x13fb,0x13fb,0x13fe,0x13fe,0x13fe,0x13fe,0x13fe,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,
-0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,
-0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,
-0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1404,0x1401,0x1401,0x1401,0x1401,
-0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1404,0x1404,0x1404,0x1401,
-0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,
-0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,
-0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x17f4,0x17f4,0x17f1,0x174c,0x1455,0x1455,0x1455,0x1455,
-0x1455,0x1455,0x1452,0x1452,0x1452,0x1452,0x1452,0x1452,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,
-0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1455,0x1593,0x1461,0x1461,0x1461,0x1473,0x1473,0x1473,0x1473,0x1473,
-0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,
-0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,
-0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,
-0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,
-0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,
-0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1a22,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,
-0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,
-0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x149d,0x149d,0x14a9,0x14af,0x14af,0x14af,0x14af,0x14af,
-0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,
-0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14a9,0x14a9,0x14a9,0x149d,0x149d,
-0x149d,0x149d,0x149d,0x149d,0x149d,0x149d,0x149d,0x14a9,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,
-0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,
-0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
-0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
-0x152d,0x152d,0x1944,0x1944,0x1944,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,
-0x152d,0x1a10,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x152d,0x18ab,0x1944,0x1944,0x1944,0x1944,0x1944,
-0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1581,0x1581,0x1587,0x1587,0x1587,0x1581,0x1581,0x1581,
-0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1587,0x1587,0x157e,0x157e,0x157e,0x157e,
-0x157e,0x157e,0x157e,0x157e,0x1587,0x1587,0x1587,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,
-0x1581,0x1581,0x1587,0x1587,0x1587,0x1587,0x1581,0x1581,0x158a,0x1581,0x1581,0x1581,0x1581,0x16f5,0x16f5,0x1581,
-0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1872,0x1587,0x1581,0x1581,0x1587,0x1581,0x1581,0x1581,
-0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1587,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,
-0x1587,0x1581,0x1581,0x1581,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,
-0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,
-0x15ab,0x15ab,0x15ab,0x15ab,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,
-0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,
-0x15bd,0x15bd,0x15bd,0x15bd,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,
-0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,
-0x15c3,0x15c3,0x15c3,0x15c3,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,
-0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,
-0x15c6,0x15c6,0x15c6,0x15c6,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
-0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
-0x1605,0x1605,0x1605,0x15f6,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,
+0x1221,0x1221,0x1221,0x1221,0x1215,0x1221,0x1215,0x1215,0x1215,0x122a,0x122a,0x1215,0x1215,0x122a,0x1221,0x122a,
+0x122a,0x1221,0x1215,0x1218,0x1224,0x1218,0x1224,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,
+0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x162,0x1221,
+0x1221,0x1227,0x121b,0x121e,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x1482,0x147f,
+0x1479,0x1479,0x147f,0x147f,0x1488,0x1488,0x1482,0x1485,0x1485,0x147f,0x147c,0x1aa,0x1aa,0x1aa,0x1aa,0x1aa,
+0x1aa,0x1aa,0x1aa,0x1aa,0x18f,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,0x18f,0x139b,0x139b,0x139b,
+0x139b,0x139b,0x139b,0x18f,0x18f,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,0x18f,0x18f,0x18f,0x18f,
+0x18f,0x18f,0x18f,0x18f,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x139b,0x18f,0x139b,0x139b,0x139b,0x139b,
+0x139b,0x139b,0x139b,0x18f,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,
 0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x160e,0x1608,
-0x1611,0x1611,0x1611,0x1611,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,
-0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,
-0x1614,0x1614,0x1614,0x1614,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x1626,0x162f,0x162f,0x162f,
-0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,
-0x162f,0x162f,0x162f,0x162f,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,
-0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,
-0x1638,0x1638,0x1638,0x1638,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
-0x164a,0x164a,0x164a,0x164a,0x1647,0x1647,0x1647,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x1647,
-0x1647,0x163b,0x1647,0x163e,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
-0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,
-0x164a,0x164a,0x164a,0x164a,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,
-0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,
-0x166e,0x166b,0x166b,0x166b,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,
-0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x167d,0x167d,0x167d,0x167a,0x167a,0x167a,
-0x1677,0x1677,0x1677,0x1677,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,
-0x168c,0x168c,0x168c,0x168c,0x1680,0x1680,0x1680,0x1680,0x1680,0x1680,0x1680,0x1692,0x1692,0x1686,0x1683,0x1683,
-0x1683,0x1683,0x1683,0x1683,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,
-0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,
-0x168c,0x168c,0x168c,0x168c,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,
-0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1695,0x1695,0x1695,0x1695,0x1695,
-0x1695,0x1695,0x1695,0x1695,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,
-0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,
-0x169b,0x169b,0x169b,0x169b,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,
-0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,
-0x16bf,0x16bf,0x16bf,0x16bf,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
-0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
-0x16c8,0x16c8,0x16c8,0x16c8,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,
-0x16e0,0x16e0,0x16e0,0x16e0,0x16cb,0x16da,0x16da,0x16cb,0x16cb,0x16cb,0x16cb,0x16cb,0x16cb,0x16da,0x16cb,0x16dd,
-0x16dd,0x16cb,0x16dd,0x16cb,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,
-0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,
-0x16e0,0x16e0,0x16e0,0x16e0,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,
-0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,
-0x16e9,0x16e9,0x16e9,0x16e9,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,
-0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,
-0x16ef,0x16ef,0x16ef,0x16ef,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,
-0x1731,0x1731,0x1731,0x1731,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,0x1944,
-0x1944,0x1944,0x1944,0x1a10,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,
-0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,
-0x1752,0x1752,0x1752,0x1752,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,
-0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,
-0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x1794,0x1791,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,
-0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,
+0x1611,0x1611,0x1611,0x1611,0x176d,0x176d,0x176d,0x176d,0x160e,0x160b,0x1a2b,0x1a2b,0x1dd,0x1dd,0x1dd,0x1dd,
+0x1dd,0x1dd,0x1dd,0x1dd,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,
 0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,
-0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,
-0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,
-0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,
-0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,
-0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,
-0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,
-0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,
-0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,
-0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b5,0x17b5,0x17b5,0x17b5,0x17b2,
-0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b5,0x17b5,0x17b5,
-0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b2,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,
-0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,
-0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,
-0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,
-0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x187e,0x187e,0x187e,
-0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,
-0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x1812,0x1812,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,
-0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,
-0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,
-0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,
-0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,
-0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x185d,0x185d,0x185d,
-0x1848,0x1848,0x1848,0x1848,0x1848,0x1848,0x1848,0x1848,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,
-0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,
-0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x1881,0x187e,
-0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x1881,0x191d,0x191d,0x1881,0x1881,0x1881,0x1881,0x1881,
-0x1881,0x1881,0x187e,0x187b,0x1881,0x1881,0x1881,0x1a7f,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187b,0x187e,
-0x187e,0x187e,0x187e,0x187e,0x191a,0x19f8,0x19f8,0x19f8,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,
-0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x191a,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,
-0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,
-0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,
-0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,
-0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x18e1,0x18e1,0x18e1,0x18e1,0x1a34,0x1a34,0x18e4,0x18e4,
-0x18e4,0x18e4,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18de,
-0x18cf,0x18d2,0x18d5,0x18e7,0x18e7,0x1983,0x18d8,0x18d8,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,
-0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,
-0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,
-0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x18ed,0x18f3,0x18f0,0x18f0,0x18f0,
-0x18f0,0x18ff,0x1905,0x18f0,0x18f0,0x18f0,0x18f0,0x18fc,0x1902,0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,
-0x18f0,0x18f0,0x18f0,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,
-0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,
-0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,
-0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x19f8,
-0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,
-0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,
-0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,
-0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,
-0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,
-0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,
-0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,
-0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,
+0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,
+0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,0x1797,
+0x1797,0x1797,0x1797,0x1797,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,
+0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,
+0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x123c,0x1236,0x1236,0x122d,0x1236,0x1236,0x122d,0x1236,0x1236,0x123f,
+0x1239,0x1230,0x165,0x165,0x1233,0x1233,0x1233,0x1233,0x1233,0x1233,0x1233,0x1233,0x1233,0x1233,0x165,0x165,
+0x165,0x165,0x165,0x165,0x9cc,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cc,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cc,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cc,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,0x9cf,
+0x9cf,0x9cf,0x9cf,0x9cf,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,0x8a,
+0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,0x1245,
+0x168,0x168,0x168,0x168,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,
+0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,
+0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,0x1242,
+0x1242,0x1242,0x1242,0x1242,0x1242,0x168,0x168,0x168,0x168,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,
+0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,
+0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,
+0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,
+0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9b7,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,
+0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,
+0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,
+0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,
+0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9ba,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,
+0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,
+0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,
+0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,
+0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x9bd,0x747,0x747,0x747,0x747,0x747,0x747,0x747,
+0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,
+0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,
+0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,
+0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x747,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,
+0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,
+0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,
+0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,
+0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86d,0x86d,0x86a,0x86d,0x86a,0x86d,0x86d,
+0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86a,0x86d,0x86a,0x86d,0x86a,0x86d,0x86d,
+0x86a,0x86a,0x86d,0x86d,0x86d,0x86a,0x86a,0x86a,0x86a,0x14d6,0x14d6,0xc93,0xc93,0xc93,0xc93,0xc93,
+0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
+0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,
+0xc93,0xc93,0xc93,0xc93,0xc93,0xc93,0x12d5,0x12d5,0x12d5,0x2a6,0x2a6,0xec4,0xec4,0xec4,0xec4,0xec4,
+0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,
+0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,
+0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,
+0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0xec4,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,
+0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,
+0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,0x2a6,
+0x2a6,0x5fd,0x5fd,0x5fd,0x5fd,0x5fd,0x5fd,0x5fd,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,
+0x8d,0x8d,0x8d,0x8d,0x5eb,0x5eb,0x5eb,0x5eb,0x5eb,0x8d,0x8d,0x8d,0x8d,0x8d,0xb13,0x5ee,
+0x5f4,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5fa,0x5f1,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,
+0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x8d,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x8d,0x5f4,
+0x8d,0x5f4,0x5f4,0x8d,0x5f4,0x5f4,0x8d,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,0x5f4,
+0x5f7,0x60f,0x609,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,
+0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,
+0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,
+0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60c,0x612,0x60f,
+0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60f,0x609,0x60c,
+0x612,0x60f,0x609,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60c,0x612,0x60f,0x609,0x60f,0x609,0x135c,
+0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x135c,0x90,0x90,0x90,
+0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x60f,0x609,
+0x60c,0x612,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,
+0x609,0x60c,0x612,0x60c,0x612,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,0x609,0x60f,
+0x609,0x60f,0x609,0x60c,0x60f,0x609,0x60c,0x60f,0x609,0x60c,0x612,0x60f,0x60f,0x60f,0x60f,0x60f,
+0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
+0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
+0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,
+0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x606,0x606,0x606,0x606,0x606,
+0x606,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
+0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x60c,0x60c,0x60c,
+0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
+0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
+0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,
+0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x60f,0x60f,0x60f,0x60f,
+0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x609,0x609,0x609,
+0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
+0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,0x60c,
+0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x612,0x609,0x60f,0x600,0x603,0x90,0x90,0x90,0x90,
+0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x60c,0x609,0x60c,0x60c,
+0x60c,0x60c,0x60c,0x60c,0x609,0x60c,0x609,0x609,0x60c,0x60c,0x609,0x609,0x60c,0x60c,0x609,0x60c,
+0x609,0x60c,0x609,0x609,0x60c,0x609,0x609,0x60c,0x609,0x60c,0x609,0x609,0x60c,0x609,0x60c,0x60c,
+0x609,0x609,0x609,0x60c,0x609,0x609,0x609,0x609,0x609,0x60c,0x609,0x609,0x60c,0x609,0x60c,0x60c,
+0x60c,0x609,0x60c,0x60c,0x60c,0x60c,0x90,0x90,0x60c,0x60c,0x60c,0x60c,0x609,0x609,0x60c,0x609,
+0x609,0x609,0x609,0x60c,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,
+0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x609,0x60c,0x60c,0x609,0x609,0x60c,0x609,
+0x60c,0x609,0x609,0x609,0x609,0x609,0x60c,0x60c,0x60c,0x609,0x609,0x90,0x90,0x90,0x90,0x90,
+0x90,0x90,0x90,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,
+0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,0xb5e,
+0xb5e,0xb5e,0xb5e,0x60f,0x60f,0x96c,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x60f,0x606,0x606,0xc18,
+0xda7,0x90,0x90,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,0xc66,
+0xc66,0xc66,0xc69,0xedc,0xecd,0xec7,0xed9,0xed6,0xed0,0xed0,0xedf,0xeca,0xed3,0x10b,0x10b,0x10b,
+0x10b,0x10b,0x10b,0x615,0x615,0x615,0x615,0x100b,0x100b,0x100b,0x151e,0x151e,0x151e,0x151e,0x151e,0x151e,
+0x151e,0x172b,0x172b,0x876,0x87c,0x87c,0x888,0x888,0x879,0x870,0x879,0x870,0x879,0x870,0x879,0x870,
+0x879,0x870,0x879,0x870,0x882,0x87f,0x882,0x87f,0xca5,0xca5,0xd98,0xd95,0x873,0x873,0x873,0x873,
+0x885,0x885,0x885,0x89d,0x8a0,0x8af,0x93,0x8a3,0x8a6,0x8b2,0x8b2,0x89a,0x891,0x88b,0x891,0x88b,
+0x891,0x88b,0x88e,0x88e,0x8a9,0x8a9,0x8ac,0x8a9,0x8a9,0x8a9,0x93,0x8a9,0x897,0x894,0x88e,0x93,
+0x93,0x93,0x93,0x61b,0x627,0x61b,0xc1b,0x61b,0x96,0x61b,0x627,0x61b,0x627,0x61b,0x627,0x61b,
+0x627,0x61b,0x627,0x624,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x621,0x627,
+0x624,0x61e,0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,
+0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,0x61e,
+0x624,0x61e,0x624,0x61e,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,
+0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,
+0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,0x624,0x61e,0x621,0x627,
+0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,0x61e,0x624,0x61e,0x621,0x627,0x624,0x61e,0x624,0x61e,
+0x624,0x61e,0x624,0x61e,0x96,0x96,0x618,0x9c,0x798,0x777,0x768,0x771,0x76e,0x768,0x77a,0x76b,
+0x765,0x768,0x786,0x77d,0x774,0x795,0x768,0x792,0x792,0x792,0x792,0x792,0x792,0x792,0x792,0x792,
+0x792,0x783,0x780,0x786,0x786,0x786,0x798,0x768,0x7a4,0x7a4,0x7a4,0x7a4,0x7a4,0x7a4,0x79e,0x79e,
+0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,0x79e,
+0x79e,0x79e,0x76b,0x786,0x765,0x78c,0x78f,0x789,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x7a1,0x79b,0x79b,
+0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,0x79b,
+0x79b,0x79b,0x76b,0x786,0x765,0x786,0xc6f,0xc6c,0x8dc,0x8d6,0x8d3,0x8d9,0x8d0,0x75c,0x75f,0x75f,
+0x75f,0x75f,0x75f,0x75f,0x75f,0x75f,0x75f,0x8e2,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,
+0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,
+0x75c,0x75c,0x75c,0x75c,0x75c,0x75c,0x8df,0x8df,0x759,0x756,0x756,0x756,0x756,0x756,0x756,0x756,
+0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x756,
+0x756,0x756,0x756,0x756,0x756,0x756,0x756,0x9c,0x9c,0x756,0x756,0x756,0x756,0x756,0x756,0x9c,
+0x9c,0x756,0x756,0x756,0x756,0x756,0x756,0x9c,0x9c,0x756,0x756,0x756,0x756,0x756,0x756,0x9c,
+0x9c,0x756,0x756,0x756,0x9c,0x9c,0x9c,0x76e,0x771,0x786,0x789,0x768,0x771,0x771,0x9c,0x750,
+0x753,0x753,0x753,0x753,0x750,0x750,0x9c,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,0x99,
+0xb16,0xb16,0xb16,0x9d2,0x74a,0x62a,0x62a,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,
+0xd5c,0xd5c,0xd5c,0xc6,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,
+0xd5c,0xd5c,0xd5c,0xd5c,0xc6,0xd5c,0xd5c,0xc6,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,
+0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xd5c,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,
+0xc6,0xc6,0xc6,0xc6,0xc6,0xc6,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,
+0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xd5f,0xc9,0xc9,0xc9,0xc9,0xc9,0xda1,0xda1,0xda1,0xcc,0xcc,
+0xcc,0xcc,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,0xd9b,
+0xd9b,0xd9b,0xcc,0xcc,0xcc,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xd9e,0xe28,0xe28,
+0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe28,0xe25,0xe25,
+0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,0xe25,0x1530,0x1530,0x17e2,0x17e2,0xde,0x110a,0x110a,
+0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x110a,0x135,0x135,0x135,0x135,0x1566,0x135,
+0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x135,0x110d,
+0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x110d,0x1110,
+0x138,0x138,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,0x1113,
+0x1113,0x1113,0x13b,0x13b,0x13b,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,0x1116,
+0x1116,0x1116,0x1116,0x1116,0x1116,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,0x13e,
+0x13e,0x13e,0x13e,0x13e,0x170a,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,0x1701,
+0x1701,0x1701,0x1701,0x1701,0x1c5,0x1c5,0x1c5,0x1c5,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,
+0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0xb64,0x1521,0xb61,0xb61,0xb61,0xb61,0x9f,0x9f,0x9f,
+0x9f,0x9f,0x9f,0x9f,0x9f,0x9f,0x18a8,0x18a8,0x18a8,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,
+0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xb67,0xa2,0xa2,0xa2,0xa2,0xa2,0x1674,0x1674,
+0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1674,0x1671,0x1671,
+0x1671,0x1671,0x1671,0x1f8,0x1f8,0x1f8,0x1f8,0x1f8,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,
+0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xd65,0xcf,0xd62,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,
+0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xff,0xff,0xff,0xff,0xe85,0xe85,
+0xe85,0xe85,0xe85,0xe85,0xe85,0xe85,0xe82,0xe85,0xe85,0xe85,0xe85,0xe85,0xff,0xff,0xff,0xff,
+0xff,0xff,0xff,0xff,0xff,0xff,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,
+0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xb6d,0xd1a,0xd1a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,
+0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xb6a,0xd17,0xd17,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,
+0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd68,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,
+0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd6e,0xd2,0xd2,0xd6b,0xd6b,0xd6b,0xd6b,
+0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd6b,0xd2,0xd2,0xd2,0xd2,0xd2,0xd2,0x1869,0x1869,0x1869,0x1869,
+0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x1869,0x246,0x246,0x246,0x246,
+0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,0x1866,
+0x246,0x246,0x246,0x246,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,0x15c3,
+0x15c3,0x15c3,0x15c3,0x15c3,0x1ce,0x1ce,0x1ce,0x1ce,0x1ce,0x1ce,0x1ce,0x1ce,0x15ab,0x15ab,0x15ab,0x15ab,
+0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x15ab,0x1c2,0x1c2,0x1c2,0x1c2,
+0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x1c2,0x15a8,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,
+0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1614,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,
+0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0x1e0,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd5,0xd5,
+0xd71,0xd5,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,0xd71,
+0xd71,0xd71,0xd5,0xd71,0xd71,0xd5,0xd5,0xd5,0xd71,0xd5,0xd5,0xd71,0x124e,0x124e,0x124e,0x124e,
+0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x124e,0x16b,0x124b,0x1248,0x1248,
+0x1248,0x1248,0x1248,0x1248,0x1248,0x1248,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,
+0x1698,0x1698,0x1698,0x1698,0x1698,0x1698,0x1695,0x1695,0x1695,0x1695,0x1695,0x1695,0x1695,0x1695,0x1695,0x1668,
+0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1668,0x1f5,
+0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1f5,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x1665,0x17a0,
+0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x17a0,0x21f,
+0x17a0,0x17a0,0x21f,0x21f,0x21f,0x21f,0x21f,0x179d,0x179d,0x179d,0x179d,0x179d,0xf87,0xf87,0xf87,0xf87,
+0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf87,0xf81,0xf81,0xf81,0xf81,
+0x1194,0x1194,0x11a,0x11a,0x11a,0xf84,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,
+0x111c,0x111c,0x111c,0x111c,0x111c,0x111c,0x141,0x141,0x141,0x141,0x141,0x1119,0x148e,0x148e,0x148e,0x148e,
+0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148e,0x148b,0x148b,0x148b,0x148b,
+0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x148b,0x1ad,0x1ad,0x1ad,0x1ad,
+0x1752,0x1752,0x148b,0x148b,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,
+0x1752,0x1752,0x1752,0x1752,0x1ad,0x1ad,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,0x1752,
+0x1752,0x1752,0x1752,0x1752,0xe6d,0xe61,0xe61,0xe61,0xf9,0xe61,0xe61,0xf9,0xf9,0xf9,0xf9,0xf9,
+0xe61,0xe61,0xe61,0xe61,0xe6d,0xe6d,0xe6d,0xe6d,0xf9,0xe6d,0xe6d,0xe6d,0xf9,0xe6d,0xe6d,0xe6d,
+0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0xe6d,0x194a,0x194a,0xf9,
+0xf9,0xe5e,0xe5e,0xe5e,0xf9,0xf9,0xf9,0xf9,0xe64,0xe67,0xe67,0xe67,0xe67,0xe67,0xe67,0xe67,
+0xe67,0x1947,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xe6a,0xe6a,0xe6a,0xe6a,0xe6a,0xe6a,0xe70,
+0xe70,0xe67,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0xf9,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,
+0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1254,0x1251,0x1251,0x1251,0x166e,0x166e,0x166e,0x166e,
+0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166e,0x166b,0x166b,0x166b,0x162f,
+0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x1626,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,
+0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x162f,0x1623,0x1623,0x1e6,0x1e6,0x1e6,0x1e6,0x1626,0x1626,
+0x1626,0x1626,0x1626,0x162c,0x162c,0x162c,0x162c,0x162c,0x162c,0x1629,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,
+0x1e6,0x1e6,0x1e6,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,0x125d,
+0x125d,0x125d,0x125d,0x16e,0x16e,0x16e,0x1257,0x125a,0x125a,0x125a,0x125a,0x125a,0x125a,0x1263,0x1263,0x1263,
+0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x1263,0x171,0x171,0x1260,
+0x1260,0x1260,0x1260,0x1260,0x1260,0x1260,0x1260,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,
+0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x1269,0x174,0x174,0x174,0x174,0x174,0x1266,0x1266,0x1266,0x1266,
+0x1266,0x1266,0x1266,0x1266,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,0x16a4,
+0x16a4,0x16a4,0x16a4,0x16a4,0x201,0x201,0x201,0x201,0x201,0x201,0x201,0x16a1,0x16a1,0x16a1,0x16a1,0x201,
+0x201,0x201,0x201,0x201,0x201,0x201,0x201,0x201,0x169e,0x169e,0x169e,0x169e,0x169e,0x169e,0x169e,0x126c,
+0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x126c,0x177,
+0x177,0x177,0x177,0x177,0x177,0x177,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,
+0x17af,0x17af,0x17af,0x17af,0x17af,0x17af,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x225,
+0x225,0x225,0x225,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,0x17ac,
+0x17ac,0x17ac,0x17ac,0x225,0x225,0x225,0x225,0x225,0x225,0x225,0x17a9,0x17a9,0x17a9,0x17a9,0x17a9,0x17a9,
 0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,
-0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b3,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,
-0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,
-0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,
-0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,
-0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,
-0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,
-0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,
-0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,
-0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19dd,0x19dd,0x19dd,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,
-0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,
-0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,
-0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,
-0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,
-0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a9a,0x1a9a,0x1a64,0x1a9a,0x1a64,0x1a64,0x1a64,0x1a64,
-0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a6a,0x1a6a,0x1a6a,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,
-0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,
-0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0,0,0,0
+0x19b6,0x19b6,0x19ad,0x19ad,0x19ad,0x19ad,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x19b0,0x19b0,
+0x19b0,0x19b0,0x19b0,0x19b0,0x19b0,0x19b0,0x19b0,0x19b0,0x26d,0x26d,0x26d,0x26d,0x26d,0x26d,0x126f,0x126f,
+0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x126f,0x17a,0x19e0,
+0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19e0,0x19dd,
+0x19dd,0x19dd,0x19dd,0x19dd,0x19dd,0x19dd,0x19e0,0x27c,0x27c,0x27c,0x27c,0x27c,0x27c,0x27c,0x27c,0x19e9,
+0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e9,0x19e3,
+0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e3,0x19e6,0x19e6,0x19e6,0x19e6,0x19ec,0x19ec,0x19ec,
+0x19ec,0x19ec,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,0x27f,
+0x27f,0x27f,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,0x1a43,
+0x1a43,0x1a43,0x285,0x285,0x285,0x285,0x285,0x285,0x285,0x285,0x285,0x13ad,0x139e,0x13ad,0x13b0,0x13b0,
+0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x13b0,0x139e,0x139e,
+0x139e,0x139e,0x139e,0x139e,0x139e,0x139e,0x13a1,0x13b3,0x13b3,0x13a7,0x13a7,0x13a7,0x13a7,0x13a7,0x192,0x192,
+0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13a4,0x13aa,0x13aa,
+0x13aa,0x13aa,0x13aa,0x13aa,0x13aa,0x13aa,0x13aa,0x13aa,0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x192,
+0x192,0x192,0x192,0x192,0x192,0x192,0x192,0x1575,0x1272,0x1272,0x1281,0x1284,0x1284,0x1284,0x1284,0x1284,
+0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1287,0x1284,0x1287,0x1284,0x1284,0x1284,0x1284,0x1284,
+0x1284,0x1284,0x1284,0x1284,0x1284,0x1284,0x1287,0x1284,0x1284,0x1284,0x1284,0x1281,0x1281,0x1281,0x1275,0x1275,
+0x1275,0x1275,0x1281,0x1281,0x127b,0x1278,0x127e,0x127e,0x128d,0x128a,0x128a,0x17d,0x17d,0x17d,0x17d,0x17d,
+0x17d,0x17d,0x17d,0x17d,0x17d,0x17d,0x196b,0x17d,0x17d,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,
+0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x14bb,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,
+0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x14b8,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,0x1b6,
+0x1461,0x1461,0x1461,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,0x1473,
+0x1473,0x1473,0x1473,0x1461,0x1461,0x1461,0x1461,0x1461,0x1470,0x1461,0x1464,0x1464,0x1461,0x1461,0x1461,0x1467,
+0x1467,0x1a7,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146d,0x146a,0x1476,0x1476,0x1476,
+0x1977,0x1974,0x1974,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1a7,0x1620,0x1620,0x1620,0x1620,
+0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1620,0x1617,0x161a,0x161d,0x1620,
+0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x1e3,0x149d,0x149d,0x14a9,0x14af,0x14af,0x14af,0x14af,
+0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14af,0x14a9,0x14a9,0x14a9,0x149d,
+0x149d,0x149d,0x149d,0x149d,0x149d,0x149d,0x149d,0x149d,0x14a9,0x14ac,0x14af,0x14b2,0x14b2,0x14af,0x14b5,0x14b5,
+0x14a0,0x14a3,0x1755,0x1758,0x1758,0x1758,0x159c,0x1b3,0x1b3,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,0x14a6,
+0x14a6,0x14a6,0x14a6,0x1599,0x175e,0x1761,0x175b,0x1764,0x1764,0x20a,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,
+0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x16c5,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,0x20a,
+0x20a,0x20a,0x20a,0x20a,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,
+0x15f0,0x15f0,0x15f0,0x15f0,0x1d7,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,0x15f0,
+0x15f0,0x15f0,0x15ea,0x15ea,0x15ea,0x15de,0x15de,0x15ea,0x15ea,0x15de,0x15ed,0x15e1,0x15de,0x15f3,0x15f3,0x15e7,
+0x15f3,0x15f3,0x15e4,0x17fd,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,0x1d7,
+0x1d7,0x1d7,0x1d7,0x1d7,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x222,0x17a3,0x222,0x17a3,0x17a3,
+0x17a3,0x17a3,0x222,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,
+0x17a3,0x222,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a3,0x17a6,0x222,0x222,0x222,0x222,
+0x222,0x222,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,0x1605,
+0x1605,0x1605,0x15f6,0x1602,0x1602,0x1602,0x15f6,0x15f6,0x15f6,0x15f6,0x15f6,0x15f6,0x15f9,0x15fc,0x1da,0x1da,
+0x1da,0x1da,0x1da,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x15ff,0x1da,0x1da,0x1da,
+0x1da,0x1da,0x1da,0x1767,0x170d,0x15cf,0x1713,0x1d4,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,
+0x1d4,0x1d4,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x1d4,
+0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x1d4,0x15d8,0x15d8,0x1d4,0x15d8,0x15d8,0x15d8,0x15d8,0x15d8,0x1d4,
+0x1a04,0x1710,0x15d8,0x15c9,0x15cf,0x15cf,0x15cf,0x15cf,0x1d4,0x1d4,0x15cf,0x15cf,0x1d4,0x1d4,0x15d2,0x15d2,
+0x15d5,0x1d4,0x1d4,0x176a,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x15c9,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,
+0x15db,0x15d8,0x15d8,0x15cf,0x15cf,0x1d4,0x1d4,0x15cc,0x15cc,0x15cc,0x15cc,0x15cc,0x15cc,0x15cc,0x1d4,0x1d4,
+0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1d4,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,
+0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x1860,0x185d,0x185d,0x185d,0x1848,0x1848,0x1848,0x1848,
+0x1848,0x1848,0x1848,0x1848,0x185d,0x185d,0x184e,0x1848,0x1848,0x185d,0x184b,0x1860,0x1860,0x1860,0x1860,0x1863,
+0x1863,0x1857,0x1854,0x1851,0x185a,0x185a,0x185a,0x185a,0x185a,0x185a,0x185a,0x185a,0x185a,0x185a,0x243,0x1857,
+0x243,0x1851,0x1980,0x1a31,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,0x243,
+0x243,0x243,0x243,0x243,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,0x16e0,
+0x16e0,0x16e0,0x16e0,0x16e0,0x16cb,0x16da,0x16da,0x16cb,0x16cb,0x16cb,0x16cb,0x16cb,0x16cb,0x16da,0x16cb,0x16dd,
+0x16dd,0x16cb,0x16dd,0x16cb,0x16da,0x16d1,0x16ce,0x16e0,0x16e0,0x16d4,0x16e0,0x210,0x210,0x210,0x210,0x210,
+0x210,0x210,0x210,0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x16d7,0x210,0x210,0x210,
+0x210,0x210,0x210,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,0x16bf,
+0x16bf,0x16bf,0x16bf,0x16a7,0x16b9,0x16b9,0x16a7,0x16a7,0x16a7,0x16a7,0x207,0x207,0x16b9,0x16b9,0x16bc,0x16bc,
+0x16a7,0x16a7,0x16b9,0x16ad,0x16aa,0x16b0,0x16c2,0x16c2,0x16b3,0x16b3,0x16b6,0x16b6,0x16b6,0x16c2,0x1776,0x1776,
+0x1776,0x1776,0x1776,0x1776,0x1776,0x1776,0x1773,0x1773,0x1773,0x1773,0x1770,0x1770,0x207,0x207,0x207,0x207,
+0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x207,0x164a,0x164a,0x164a,0x164a,
+0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x164a,0x1647,0x1647,0x1647,0x163b,
+0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x163b,0x1647,0x1647,0x163b,0x1647,0x163e,0x163b,0x164d,0x164d,0x1641,
+0x164a,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1644,0x1644,0x1644,0x1644,
+0x1644,0x1644,0x1644,0x1644,0x1644,0x1644,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1ec,0x1845,0x1845,0x1845,0x1845,
+0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x1845,0x240,0x240,0x240,0x240,0x240,0x240,0x240,
+0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x240,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,
+0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14d0,0x14c1,0x14ca,0x14c1,0x14ca,0x14ca,0x14c1,0x14c1,
+0x14c1,0x14c1,0x14c1,0x14c1,0x14cd,0x14c4,0x1a28,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x14c7,0x14c7,
+0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x14c7,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x1bc,0x1788,0x1788,
+0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x1788,0x197d,0x216,
+0x216,0x1779,0x1779,0x1779,0x1785,0x1785,0x1779,0x1779,0x1779,0x1779,0x1785,0x1779,0x1779,0x1779,0x1779,0x177c,
+0x216,0x216,0x216,0x216,0x1782,0x1782,0x1782,0x1782,0x1782,0x1782,0x1782,0x1782,0x1782,0x1782,0x177f,0x177f,
+0x178b,0x178b,0x178b,0x177f,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,0x1998,
+0x1998,0x1998,0x1998,0x1998,0x1995,0x1995,0x1995,0x1989,0x1989,0x1989,0x1989,0x1989,0x1989,0x1989,0x1989,0x1995,
+0x198f,0x198c,0x1992,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,0x264,
+0x264,0x264,0x264,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,0x16ef,
+0x16ef,0x16ef,0x16ef,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,0x16e9,
+0x16e9,0x16e9,0x16e9,0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e6,0x16e3,0x16e3,0x16e3,
+0x16e3,0x16e3,0x16e3,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x213,0x16ec,
+0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x288,0x288,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,
+0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a52,0x1a4f,0x1a46,0x1a4f,0x1a46,0x1a46,0x1a46,
+0x1a46,0x288,0x288,0x1a46,0x1a46,0x1a4f,0x1a4f,0x1a4f,0x1a4f,0x1a49,0x1a52,0x1a4c,0x1a52,0x1a4f,0x288,0x288,
+0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x288,0x1902,0x18f0,
+0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,0x18f0,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,
+0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x1902,0x18ed,0x18f3,0x18f0,0x18f0,0x18f0,0x18f0,0x18ff,
+0x1905,0x18f0,0x18f0,0x18f0,0x18f0,0x18fc,0x18f6,0x18f9,0x1908,0x1908,0x18f9,0x18fc,0x18f6,0x18f3,0x25e,0x25e,
+0x25e,0x25e,0x25e,0x25e,0x25e,0x25e,0x18e1,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18de,0x18de,0x18cc,
+0x18cc,0x18cc,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,0x18e1,
+0x18e1,0x18e1,0x1a34,0x1a34,0x18e4,0x18e4,0x18e4,0x18e4,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18cc,0x18de,
+0x18cf,0x18d2,0x18d5,0x18e7,0x18e7,0x1983,0x18d8,0x18d8,0x18db,0x18db,0x258,0x258,0x258,0x258,0x258,0x258,
+0x258,0x258,0x258,0x258,0x258,0x258,0x258,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,
+0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x169b,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x1fe,0x182a,0x182a,
+0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x231,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,
+0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x182a,0x1827,0x1815,0x1815,0x1815,0x1815,0x1815,0x1815,0x1815,
+0x231,0x1815,0x1815,0x1815,0x1815,0x1815,0x1815,0x1827,0x1818,0x182a,0x182d,0x182d,0x1821,0x181e,0x181e,0x231,
+0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x231,0x1824,0x1824,0x1824,0x1824,0x1824,0x1824,0x1824,
+0x1824,0x1824,0x1824,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,0x181b,
+0x231,0x231,0x231,0x1839,0x183c,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,0x1842,
+0x1842,0x1842,0x1842,0x1842,0x1842,0x23d,0x23d,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,
+0x1836,0x1836,0x1836,0x1836,0x1836,0x23d,0x183f,0x1836,0x1836,0x1836,0x1836,0x1836,0x1836,0x183f,0x1836,0x1836,
+0x183f,0x1836,0x1836,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x23d,0x18c6,0x18c6,0x18c6,0x18c6,
+0x18c6,0x18c6,0x18c6,0x252,0x18c6,0x18c6,0x252,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,
+0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18c6,0x18ba,0x18ba,0x18ba,0x18ba,0x18ba,0x18ba,0x252,0x252,0x252,
+0x18ba,0x252,0x18ba,0x18ba,0x252,0x18ba,0x18ba,0x18bd,0x18ba,0x18c0,0x18c0,0x18c9,0x18ba,0x252,0x252,0x252,
+0x252,0x252,0x252,0x252,0x252,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x18c3,0x252,
+0x252,0x252,0x252,0x252,0x252,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x26a,0x19aa,0x19aa,0x26a,0x19aa,
+0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19aa,0x19a7,
+0x19a7,0x19a7,0x19a7,0x19a7,0x26a,0x199e,0x199e,0x26a,0x19a7,0x19a7,0x199e,0x19a7,0x19a1,0x19aa,0x26a,0x26a,
+0x26a,0x26a,0x26a,0x26a,0x26a,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x19a4,0x26a,
+0x26a,0x26a,0x26a,0x26a,0x26a,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,
+0x19c5,0x19c5,0x19c5,0x19c5,0x19c5,0x19bf,0x19bf,0x19c2,0x19c2,0x19c8,0x19c8,0x273,0x273,0x273,0x273,0x273,
+0x273,0x273,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,
+0x1a64,0x1a64,0x1a9a,0x1a9a,0x1a64,0x1a9a,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a6a,
+0x1a6a,0x1a6a,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,0x1a64,
+0x1a64,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x297,0x1a67,0xf8a,
+0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0xf8a,0x1554,
+0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x1554,0x173d,
+0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,0x11d,
+0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,0xf90,
+0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x155a,0x120,0xf8d,0xf8d,0xf8d,
+0xf8d,0x1557,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x120,0x179a,0x179a,0x179a,
+0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x179a,0x21c,0x21c,0x21c,
+0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x21c,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,
+0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1296,0x1296,0x1296,0x1293,0x1293,0x1293,0x1290,
+0x1290,0x1293,0x1290,0x1290,0x1290,0x1296,0x1293,0x1296,0x1293,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,
+0x1290,0x1290,0x1296,0x1293,0x1293,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,0x1290,
+0x1290,0x1290,0x1290,0x1290,0x180,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a3d,0x1a40,0x1a3a,0x282,0x282,
+0x282,0x282,0x282,0x282,0x282,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,
+0x178e,0x178e,0x178e,0x178e,0x178e,0x1794,0x1791,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x178e,0x219,0x219,
+0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x219,0x13b6,0x13b6,
+0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x13b6,0x195,0x195,
+0x195,0x195,0x195,0x195,0x195,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,0x1653,
+0x1653,0x1653,0x1653,0x1653,0x1653,0x1ef,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,0x1650,
+0x1ef,0x1ef,0x1ef,0x1ef,0x1656,0x1656,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,
+0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x15a2,0x1bf,0x1bf,0x159f,0x159f,0x159f,0x159f,0x159f,0x15a5,0x1bf,0x1bf,
+0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x1bf,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,
+0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x1680,0x1680,0x1680,0x1680,0x1680,0x1680,0x1680,0x1692,
+0x1692,0x1686,0x1683,0x1683,0x1683,0x1683,0x1683,0x1683,0x168c,0x168c,0x168f,0x168f,0x1692,0x1683,0x1fb,0x1fb,
+0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,0x1689,
+0x1689,0x1689,0x1fb,0x1683,0x1683,0x1683,0x1683,0x1683,0x1fb,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,
+0x168c,0x168c,0x168c,0x168c,0x168c,0x168c,0x1fb,0x1fb,0x1fb,0x1fb,0x1fb,0x168c,0x168c,0x168c,0x19d7,0x19d7,
+0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d7,0x19d4,0x19d4,
+0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19d4,0x19ce,0x19ce,
+0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19ce,0x19d1,0x19da,
+0x19ce,0x19ce,0x279,0x279,0x279,0x279,0x279,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,
+0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1497,0x1a25,0x1a25,0x1a25,0x1a25,0x1a25,0x1a25,0x1b0,0x1b0,0x1b0,
+0x1b0,0x1a1f,0x1497,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,0x1494,
+0x1494,0x1494,0x1494,0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1a22,0x1b0,0x1b0,0x1b0,0x1b0,0x1b0,
+0x1b0,0x1b0,0x1491,0x1491,0x1491,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,0x149a,
+0x149a,0x149a,0x1884,0x1920,0x1a85,0x1a88,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,
+0x23a,0x23a,0x23a,0x23a,0x23a,0x23a,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,
+0x1887,0x1887,0x1887,0x1887,0x1887,0x1887,0x1a01,0x1a01,0x1a01,0x1a8b,0x1a8b,0x1a8b,0x1a8b,0x1a8b,0x1a8b,0x249,
+0x249,0x249,0x249,0x249,0x249,0x249,0x249,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,
+0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x188a,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,0x24c,
+0x24c,0x24c,0x24c,0x24c,0x13ec,0x13e9,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,
+0x1914,0x1914,0x1914,0x1914,0x1914,0x1914,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,
+0x1926,0x1926,0x1926,0x1926,0x1926,0x1926,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,
+0x24f,0x24f,0x24f,0x24f,0x24f,0x24f,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,0x291,
+0x291,0x291,0x291,0x291,0x291,0x291,0x1a8e,0x1a8e,0x1a8e,0x291,0x291,0x291,0x291,0x291,0x291,0x291,
+0x291,0x291,0x291,0x291,0x291,0x291,0x1a91,0x1a91,0x1a91,0x1a91,0x291,0x291,0x291,0x291,0x291,0x291,
+0x291,0x291,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,0x1929,
+0x1929,0x1929,0x255,0x255,0x255,0x255,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,
+0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x1cb,0x15bd,0x15bd,0x15bd,
+0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x15bd,0x1cb,0x1cb,0x15ba,0x15b4,0x15b7,0x15c0,0x1704,0x1704,0x1704,
+0x1704,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0x204,0xb70,0xb70,0xb70,
+0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xb70,0xa5,0xa5,0xa5,
+0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xa5,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
+0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xa8,0xa8,0x100e,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,
+0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7f,0xb7f,0xb7f,0xb7f,0xb7f,0xb76,0xb82,0xb88,
+0xb88,0xb88,0xb7c,0xb7c,0xb7c,0xb85,0xb79,0xb79,0xb79,0xb73,0xb73,0xb73,0xb73,0xb73,0xb73,0xb73,
+0xb73,0xb88,0xb88,0xb88,0xb88,0xb88,0xb7c,0xb7c,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb88,0xb7c,
+0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb88,0xb88,0xb88,0xb88,0xb7c,0xb7c,0xb7f,
+0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0xb7c,0x172e,
+0x172e,0x172e,0x172e,0x172e,0x172e,0x172e,0x172e,0x172e,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,
+0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xa8,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,
+0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe22,0xe1f,0xe1f,0xe1f,0xe22,0xdb,0xdb,0xdb,0xdb,
+0xdb,0xdb,0xdb,0xdb,0xdb,0xdb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,
+0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x19cb,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,0x276,
+0x276,0x276,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,0xd74,
+0xd74,0xd74,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xd8,0xf93,0xf93,0xf93,0xf93,0xf93,
+0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0xf93,0x1962,0x1962,0x1962,0x1962,0x1962,
+0x1962,0x1962,0x123,0x123,0x123,0x123,0x123,0x123,0x123,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
+0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,
+0xb94,0xb94,0xb94,0xb94,0xb94,0xb91,0xb91,0xb91,0xb91,0xb91,0xab,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xab,0xb94,0xb94,0xab,0xab,0xb94,0xab,0xab,
+0xb94,0xb94,0xab,0xab,0xb94,0xb94,0xb94,0xb94,0xab,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb91,
+0xb91,0xb91,0xb91,0xab,0xb91,0xab,0xb91,0xb91,0xb91,0xd1d,0xb91,0xb91,0xab,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xab,0xb94,0xb94,0xb94,0xb94,0xab,
+0xab,0xb94,0xb94,0xb94,0xb94,0xb94,0xab,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xab,0xb91,
+0xb91,0xb94,0xb94,0xb94,0xb94,0xb94,0xab,0xb94,0xab,0xab,0xab,0xb94,0xb94,0xb94,0xb94,0xb94,
+0xb94,0xab,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,
+0xe0a,0xe0a,0xab,0xab,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb8b,0xb91,0xb91,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb8b,0xb91,0xb91,0xb91,0xb91,
+0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb8b,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb8b,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb94,0xb94,0xb94,0xb94,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb8b,0xb94,
+0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb94,0xb8b,0xb91,
+0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xb8b,0xb91,0xb91,0xb91,0xb91,0xb91,0xb91,0xf1e,
+0xf1b,0xab,0xab,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,0xb8e,
+0xb8e,0xb8e,0xb8e,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,
+0x17b5,0x17b5,0x17b5,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,
+0x17b2,0x17b2,0x17b2,0x17b5,0x17b5,0x17b5,0x17b5,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b5,0x17b5,0x17b5,0x17b5,
+0x17b5,0x17b2,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b5,0x17b2,0x17b5,0x17b5,0x17b8,
+0x17bb,0x17b8,0x17b8,0x17b5,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x22b,0x17b2,
+0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x17b2,0x1833,0x1833,
+0x1833,0x1833,0x1833,0x1833,0x1833,0x237,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x1833,0x237,
+0x237,0x1833,0x1833,0x1833,0x1833,0x1833,0x237,0x1833,0x1833,0x237,0x1833,0x1833,0x1833,0x1833,0x1833,0x237,
+0x237,0x237,0x237,0x237,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x1a5b,
+0x1a5b,0x1a5b,0x1a5b,0x1a5b,0x28b,0x28b,0x28b,0x1a55,0x1a55,0x1a55,0x1a55,0x1a55,0x1a55,0x1a55,0x1a5b,0x1a5b,
+0x1a5b,0x1a5b,0x1a5b,0x1a5e,0x1a5e,0x28b,0x28b,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,0x1a58,
+0x1a58,0x28b,0x28b,0x28b,0x28b,0x1a5b,0x1a5b,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,
+0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a76,0x1a6d,0x1a6d,0x1a6d,0x1a6d,0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,
+0x1a73,0x1a73,0x1a73,0x1a73,0x1a73,0x29a,0x29a,0x29a,0x29a,0x29a,0x1a70,0x1638,0x1638,0x1638,0x1638,0x1638,
+0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1638,0x1e9,0x1e9,0x1635,0x1635,0x1635,
+0x1635,0x1635,0x1635,0x1635,0x1635,0x1635,0x1632,0x1632,0x1632,0x1632,0x1632,0x1632,0x1632,0x1e9,0x1e9,0x1e9,
+0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1e9,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,
+0x1812,0x1812,0x1812,0x1812,0x1812,0x1812,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,
+0x180f,0x180f,0x180f,0x180f,0x180f,0x180f,0x1806,0x1806,0x1806,0x1800,0x1803,0x1803,0x1803,0x1a2e,0x22e,0x22e,
+0x22e,0x22e,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x180c,0x22e,0x22e,0x22e,0x22e,
+0x1809,0x1809,0x270,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,0x19b9,
+0x19b9,0x19b9,0x19b9,0x19bc,0x19b9,0x19b9,0x19b9,0x19b9,0x270,0x270,0x270,0x270,0x270,0x270,0x270,0x270,
+0x270,0x270,0x270,0x28e,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,0x1a61,
+0x1a61,0x1a61,0x1a61,0x1a61,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,0x28e,
+0x28e,0x28e,0x28e,0x28e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,
+0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x1a4,
+0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,
+0x1a4,0x145e,0x1a4,0x1a4,0x1a4,0x1a4,0x145e,0x1a4,0x1a4,0x1a4,0x1a4,0x145e,0x1a4,0x145e,0x1a4,0x145e,
+0x1a4,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x1a4,0x145e,0x1a4,0x145e,0x1a4,0x145e,
+0x1a4,0x145e,0x1a4,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x1a4,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,
+0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,
+0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,0x145e,
+0x145e,0x1a4,0x1a4,0x1a4,0x1a4,0x145e,0x145e,0x145e,0x1a4,0x145e,0x145e,0x145e,0x145e,0x145e,0x1a4,0x145e,
+0x145e,0x145e,0x145e,0x145e,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,
+0x1a4,0x1a4,0x1a4,0x1a4,0x145b,0x145b,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,0x1a4,
+0x1a4,0x1a4,0x1a4,0x1a4,0x111f,0x111f,0x111f,0x111f,0x1134,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,
+0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x111f,0x144,0x144,0x144,0x144,0x1122,0x1122,0x1122,
+0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x1122,0x147,0x147,0x147,
+0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x147,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
+0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x198,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
+0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x1578,0x198,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
+0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13ef,0x198,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,
+0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x13b9,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,
+0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x1578,0x198,0x198,0x198,0x198,0x198,0x198,0x198,0x198,
+0x198,0x198,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x1572,0x1572,0x183,
+0x183,0x183,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,0x12b7,
+0x12b7,0x12b7,0x12ba,0x12ba,0x12ba,0x1299,0x196e,0x13c8,0x12c3,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,0x13c8,
+0x13c8,0x13c8,0x13c8,0x13c8,0x12c3,0x13c8,0x12c3,0x13c8,0x13c8,0x12c3,0x13c8,0x13c8,0x13c8,0x12c3,0x13c8,0x13c8,
+0x13c8,0x12bd,0x12bd,0x12bd,0x12bd,0x12bd,0x13c2,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x12c0,0x13c5,
+0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x12c0,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,
+0x13c5,0x144c,0x144c,0x1a1c,0x183,0x183,0x183,0x13cb,0x13cb,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,
+0x12c0,0x13c5,0x12c0,0x12c0,0x13c5,0x13cb,0x12c6,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,0x13c5,
+0x13c5,0x12b4,0x12b4,0x12b4,0x12b4,0x13e0,0x13bf,0x12bd,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,0x13e0,
+0x13e0,0x13e0,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x186c,0x183,
+0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x137d,
+0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x137d,0x12e7,
+0x13e6,0x13e3,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x12e1,
+0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e4,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,
+0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e1,0x12e4,0x12e1,0x12e1,0x13e6,0x13e6,0x13e6,0x13e6,
+0x13e6,0x13e3,0x13e6,0x13e6,0x13e6,0x186f,0x186,0x186,0x186,0x186,0x12de,0x12de,0x12de,0x12de,0x12de,0x12de,
+0x12de,0x12de,0x12de,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x140a,0x140a,0x186,0x186,0x186,0x186,
+0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x1911,0x1911,0x1911,0x1911,0x1911,0x1911,
+0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,0x186,
+0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
+0x1587,0x1581,0x1581,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x17c1,0x17c1,0x17c1,0x13f5,
+0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x1587,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
+0x13f5,0x13f5,0x13f5,0x1587,0x17c1,0x17c1,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,
+0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x1581,0x1581,0x1587,0x1587,0x1581,0x1587,0x1587,0x1587,0x157e,0x157e,
+0x1587,0x1587,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f2,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f5,
+0x13f5,0x13f5,0x13f8,0x13f8,0x13f8,0x16f2,0x13f5,0x13f8,0x13f5,0x13f5,0x13f8,0x158a,0x158a,0x1587,0x1587,0x17c1,
+0x17c1,0x17c1,0x17c1,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x1587,0x13f5,
+0x1581,0x1581,0x1587,0x16f2,0x1587,0x1581,0x1587,0x17c1,0x17c1,0x17c1,0x17c4,0x17c4,0x17c4,0x17c4,0x17c4,0x13f5,
+0x1587,0x13f8,0x13f8,0x13f5,0x13f5,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f5,
+0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f8,
+0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f8,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f5,0x13f5,0x13f8,
+0x13f8,0x13f8,0x13f5,0x13f8,0x13f8,0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f5,
+0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f5,0x13f2,0x13f5,
+0x13f2,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f8,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f2,0x13f5,0x13f5,0x13f5,
+0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x16f2,0x13f5,0x13f5,0x13f5,0x13f5,0x1587,
+0x1581,0x17c1,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
+0x13f5,0x13f5,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,
+0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,0x13f2,
+0x13f2,0x13f2,0x157b,0x157b,0x144f,0x144f,0x144f,0x144f,0x157b,0x157b,0x157e,0x157e,0x157e,0x1584,0x1587,0x17c1,
+0x17c1,0x17c1,0x17c1,0x1749,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x13f5,0x1581,0x1581,0x1581,0x1581,
+0x1581,0x1581,0x1581,0x1587,0x1581,0x1581,0x1587,0x158a,0x158a,0x1587,0x1587,0x1587,0x1587,0x1875,0x1581,0x1581,
+0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1581,0x1581,0x1587,0x1587,0x1587,0x1587,0x1581,0x1581,0x158a,0x1581,
+0x1581,0x1581,0x1581,0x16f5,0x16f5,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1872,0x1587,
+0x1581,0x1581,0x1587,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1587,0x1581,0x1581,0x1581,0x1581,
+0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1581,0x1581,0x1581,0x1587,0x1587,0x1587,0x1581,0x1581,0x1581,0x1581,
+0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1581,0x1587,0x1587,0x1587,0x157e,0x157e,0x157e,0x157e,0x157e,0x157e,
+0x157e,0x157e,0x1587,0x1587,0x1587,0x1581,0x1587,0x1581,0x1587,0x1581,0x1581,0x1581,0x1581,0x1587,0x1581,0x1581,
+0x1581,0x1581,0x1581,0x1581,0x1587,0x157e,0x157e,0x157e,0x157e,0x157e,0x157e,0x1587,0x13f5,0x13f5,0x13f5,0x13f5,
+0x13f5,0x14d9,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
+0x13fb,0x14d9,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x14d9,0x13fb,0x14d9,0x13fb,0x14d9,0x13fb,0x13fb,0x13fb,0x14d9,
+0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x14d9,0x14d9,0x13fb,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x14d9,0x14d9,
+0x13fb,0x13fb,0x13fb,0x13fb,0x14d9,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,0x13fb,
+0x16f8,0x16f8,0x17c7,0x17c7,0x13fe,0x13fe,0x13fe,0x13fb,0x13fb,0x13fb,0x13fe,0x13fe,0x13fe,0x13fe,0x13fe,0x1677,
+0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x1677,0x167d,
+0x167d,0x167d,0x167a,0x167a,0x167a,0x1677,0x1677,0x1677,0x1677,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,
+0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1404,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,
+0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1404,0x1404,0x1404,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,0x1401,
+0x1401,0x1401,0x1404,0x1401,0x1401,0x1401,0x1401,0x1401,0x158d,0x158d,0x158d,0x158d,0x158d,0x1590,0x16fe,0x1590,
+0x1590,0x1590,0x17ca,0x1878,0x1878,0x18b4,0x18b4,0x1a79,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,0x19b,
+0x19b,0x19b,0x1590,0x1590,0x1590,0x1590,0x1590,0x1590,0x158d,0x158d,0x158d,0x1590,0x158d,0x16fb,0x16fb,0x19b,
+0x19b,0x19b,0x1590,0x158d,0x158d,0x1590,0x1878,0x1878,0x1878,0x1917,0x1917,0x19f5,0x1a79,0x19b,0x19b,0x19b,
+0x19b,0x19b,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,0x13bc,
+0x13bc,0x13bc,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x19e,0x15c6,0x15c6,
+0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x15c6,0x197a,0x197a,
+0x197a,0x197a,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,
+0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1a7c,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,
+0x1d1,0x1d1,0x1d1,0x1d1,0x1d1,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
+0x16c8,0x20d,0x20d,0x20d,0x20d,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,
+0x16c8,0x16c8,0x16c8,0x16c8,0x16c8,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,0x20d,
+0x20d,0x20d,0x20d,0x20d,0x20d,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,0x18b7,
+0x18b7,0x228,0x1a7f,0x1a7f,0x1a82,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x17d3,0x1881,0x1881,
+0x1881,0x1881,0x1881,0x1881,0x191d,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x1881,0x187e,0x191a,0x191a,0x191a,
+0x191a,0x191a,0x191a,0x191a,0x191a,0x1881,0x191d,0x191d,0x1881,0x1881,0x1881,0x1881,0x1881,0x1881,0x1881,0x187e,
+0x187b,0x1881,0x1881,0x1881,0x1a7f,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187b,0x187e,0x187e,0x187e,0x187e,
+0x187e,0x191a,0x19f8,0x19f8,0x19f8,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,
+0x187e,0x187e,0x187e,0x187e,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,
+0x19f8,0x19f8,0x19f8,0x19f8,0x1a7f,0x228,0x19f8,0x19f8,0x19f8,0x19f8,0x228,0x228,0x228,0x19f8,0x1a7f,0x19f8,
+0x19f8,0x19f8,0x19f8,0x17d0,0x17d0,0x17d0,0x17d0,0x17d0,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,0x187e,
+0x187e,0x187e,0x187e,0x191a,0x191a,0x191a,0x191a,0x191a,0x191a,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,
+0x19f8,0x228,0x228,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x228,0x228,0x228,0x1a7f,0x1a7f,0x19fb,0x19fb,
+0x19fb,0x19fb,0x19f8,0x19fe,0x19fe,0x19f8,0x19fe,0x19fe,0x1a7f,0x1a82,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x17d0,0x19f8,
+0x19f8,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x1a7f,0x228,0x228,0x1a82,0x1a82,0x1a82,0x191a,0x191d,
+0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191d,0x191a,0x191a,0x191a,0x191a,
+0x191a,0x191a,0x191a,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,0x19f8,
+0x19f8,0x19f8,0x19f8,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,0x1a37,
+0x1a37,0x1a37,0x1a37,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x261,0x1986,
+0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x1986,0x261,0x261,0x1a94,
+0x1a94,0x1a94,0x1a94,0x294,0x294,0x294,0x294,0x1a94,0x1a94,0x1a94,0x294,0x294,0x294,0x294,0x294,0x294,
+0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x1a94,0x1a94,0x1a94,0x1a94,0x1a94,0x1a94,0x294,0x294,0x294,
+0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,0x294,3,3,3,
+3,3,3,3,3,3,3,3,3,3,3,3,3,0x96f,0x96f,0xb9d,
+0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0xb9d,0x2a9,
+0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x2a9,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,
+0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,
+0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x12ea,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,0x2af,
+0x2af,0x2af,0x2af,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,0x1407,
+0x1407,0x1407,0x1407,0x2b2,0x2b2,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,
+0x17cd,0x17cd,0x17cd,0x17cd,0x17cd,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,0x2b5,
+0x2b5,0x2b5,0x2b5,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,0x1923,
+0x1923,0x1923,0x1923,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,0x2b8,
+0x2b8,0x2b8,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,0xba0,
+0xba0,0xba0,0x2ac,0x2ac,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,0x29d,
+0x29d,0x29d,0x96f,0x96f,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0x96f,0x96f,0xae,0xb9a,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,0xae,
+0xae,0xae,0xae,0xae,0xae,0xae,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,
+0xb97,0xb97,0xb97,0xb97,0xb97,0xb97,6,6,6,6,6,6,6,6,6,6,
+6,6,6,6,6,6,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,
+0xd80,0xd80,0xd80,0xd80,0xd80,0xd80,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,
+0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c6,0x9c0,0x9c0,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,
+0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c9,0x9c3,0x9c3,0,0,0
 };
 
-static const UTrie2 propsVectorsTrie={
+static const UCPTrie propsVectorsTrie={
     propsVectorsTrie_index,
-    propsVectorsTrie_index+4952,
-    NULL,
-    4952,
-    25652,
-    0xa40,
-    0x13d8,
-    0x0,
+    { propsVectorsTrie_data },
+    3401, 22317,
+    0x110000, 0x110,
+    0, 0,
+    0, 0,
+    0x674, 0x82f,
     0x0,
-    0x110000,
-    0x7788,
-    NULL, 0, FALSE, FALSE, 0, NULL
 };
 
 static const uint32_t propsVectors[6813]={
@@ -47,6 +47,7 @@ typedef enum ECleanupCommonType {
     UCLN_COMMON_NORMALIZER2,
     UCLN_COMMON_CHARACTERPROPERTIES,
     UCLN_COMMON_USET,
+    UCLN_COMMON_UNISET_CACHE,   /* before UCLN_COMMON_UNIFIED_CACHE which owns the sets */
     UCLN_COMMON_UNAMES,
     UCLN_COMMON_UPROPS,
     UCLN_COMMON_UCNV,
@@ -25,6 +25,7 @@
 
 #if !UCONFIG_NO_CONVERSION
 
+
 #include "unicode/ustring.h"
 #include "unicode/ucnv.h"
 #include "unicode/ucnv_err.h"
@@ -40,6 +41,7 @@
 #include "ucnv_imp.h"
 #include "ucnv_cnv.h"
 #include "ucnv_bld.h"
+#include "charstr.h"
 
 /* size of intermediate and preflighting buffers in ucnv_convert() */
 #define CHUNK_SIZE 1024
@@ -2514,6 +2516,350 @@ ucnv_convert(const char *toConverterName, const char *fromConverterName,
     return targetLength;
 }
 
+/* parallel conversion ------------------------------------------------------ */
+
+/*
+ * Minimum number of source bytes per segment in ucnv_convertParallel().
+ * Shorter input does not pay for running tasks and cloning converters.
+ */
+#define PARALLEL_MIN_SEGMENT_LENGTH 0x10000
+
+/* maximum number of segments in ucnv_convertParallel() */
+#define PARALLEL_MAX_SEGMENTS 64
+
+/*
+ * The built-in callbacks do not modify any shared state
+ * and can be called on several threads at once.
+ */
+static UBool
+hasBuiltInCallbacks(const UConverter *cnv) {
+    UConverterToUCallback toU=cnv->fromCharErrorBehaviour;
+    UConverterFromUCallback fromU=cnv->fromUCharErrorBehaviour;
+    return
+        (toU==UCNV_TO_U_CALLBACK_SUBSTITUTE || toU==UCNV_TO_U_CALLBACK_SKIP ||
+         toU==UCNV_TO_U_CALLBACK_STOP || toU==UCNV_TO_U_CALLBACK_ESCAPE) &&
+        (fromU==UCNV_FROM_U_CALLBACK_SUBSTITUTE || fromU==UCNV_FROM_U_CALLBACK_SKIP ||
+         fromU==UCNV_FROM_U_CALLBACK_STOP || fromU==UCNV_FROM_U_CALLBACK_ESCAPE);
+}
+
+/* Can the toUnicode conversion be split at character boundaries? */
+static UBool
+canSplitToUnicode(const UConverterSharedData *sharedData) {
+    switch(sharedData->staticData->conversionType) {
+    case UCNV_UTF8:
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+        return TRUE;
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    case UCNV_MBCS:
+        return ucnv_MBCSCanSplitToUnicode(sharedData);
+#endif
+    default:
+        return FALSE;
+    }
+}
+
+/*
+ * Can the fromUnicode conversion be split between any two code points?
+ * Not with SI/SO state, nor with mappings from multiple UChars
+ * (which also include those for supplementary code points, to be safe).
+ */
+static UBool
+canSplitFromUnicode(const UConverterSharedData *sharedData) {
+    switch(sharedData->staticData->conversionType) {
+    case UCNV_UTF8:
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian:
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+        return TRUE;
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    case UCNV_MBCS: {
+        const int32_t *cx=sharedData->mbcs.extIndexes;
+        return (sharedData->mbcs.outputType&0xff)!=MBCS_OUTPUT_2_SISO &&
+               (cx==NULL || ((cx[UCNV_EXT_COUNT_UCHARS]>>16)&0xff)<=1);
+    }
+#endif
+    default:
+        return FALSE;
+    }
+}
+
+/*
+ * Finds the first index i in [start, limit[ where the toUnicode conversion of s[]
+ * can be split, so that converting s[0..i[ and s[i..] separately yields
+ * the same result as converting all of s[] at once:
+ * s[i] must begin a character, and the character before it must be complete.
+ * Requires canSplitToUnicode() and 0<start.
+ * @return the split index, or -1 if there is none
+ */
+static int32_t
+findToUnicodeSplit(const UConverterSharedData *sharedData,
+                   const uint8_t *s, int32_t start, int32_t limit) {
+    int32_t i;
+
+    switch(sharedData->staticData->conversionType) {
+    case UCNV_UTF8:
+        for(i=start; i<limit; ++i) {
+            if(!U8_IS_TRAIL(s[i])) {
+                /* the previous character must be well-formed and end at i */
+                int32_t j=i-1;
+                UChar32 c;
+                while(j>0 && (i-j)<4 && U8_IS_TRAIL(s[j])) {
+                    --j;
+                }
+                U8_NEXT(s, j, i, c);
+                if(c>=0 && j==i) {
+                    return i;
+                }
+            }
+        }
+        break;
+    case UCNV_UTF16_BigEndian:
+    case UCNV_UTF16_LittleEndian: {
+        UBool isBE=(UBool)(sharedData->staticData->conversionType==UCNV_UTF16_BigEndian);
+        for(i=start+(start&1); i<limit; i+=2) {
+            /* do not split after a lead surrogate */
+            UChar prev= isBE ? (UChar)((s[i-2]<<8)|s[i-1]) : (UChar)((s[i-1]<<8)|s[i-2]);
+            if(!U16_IS_LEAD(prev)) {
+                return i;
+            }
+        }
+        break;
+    }
+    case UCNV_UTF32_BigEndian:
+    case UCNV_UTF32_LittleEndian:
+        i=(start+3)&~3;
+        if(i<limit) {
+            return i;
+        }
+        break;
+    case UCNV_LATIN_1:
+    case UCNV_US_ASCII:
+        return start;
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    case UCNV_MBCS: {
+        /*
+         * An extension mapping from several characters may begin before s[i-1].
+         * Do not split inside any byte sequence that could be the start of one.
+         */
+        const int32_t *cx=sharedData->mbcs.extIndexes;
+        int32_t maxInBytes= cx!=NULL ? (cx[UCNV_EXT_COUNT_BYTES]>>16)&0xff : 0;
+        /* cache of ucnv_MBCSIsSplitAfterByte() results, 0=unknown, 1=no, 2=yes */
+        uint8_t isSplitAfter[256];
+        uprv_memset(isSplitAfter, 0, sizeof(isSplitAfter));
+        for(i=start; i<limit; ++i) {
+            uint8_t b=s[i-1];
+            if(isSplitAfter[b]==0) {
+                isSplitAfter[b]=ucnv_MBCSIsSplitAfterByte(sharedData, b) ? 2 : 1;
+            }
+            if(isSplitAfter[b]==2) {
+                int32_t length;
+                for(length=2; length<maxInBytes && length<=i; ++length) {
+                    if(ucnv_extIsPartialMatchToU(cx, (const char *)s+i-length, length)) {
+                        break;
+                    }
+                }
+                if(length>=maxInBytes || length>i) {
+                    return i;
+                }
+            }
+        }
+        break;
+    }
+#endif
+    default:
+        break;
+    }
+    return -1;
+}
+
+/* One piece of the input and its output in ucnv_convertParallel(). */
+struct ParallelSegment : public icu::UMemory {
+    const char *source, *sourceLimit;
+    UConverter *targetCnv, *sourceCnv;
+    icu::LocalUConverterPointer targetClone, sourceClone;
+    icu::CharString output;
+    UErrorCode errorCode;
+};
+
+static void U_CALLCONV
+convertSegment(void *task) {
+    ParallelSegment *segment=static_cast<ParallelSegment *>(task);
+    UChar pivotBuffer[CHUNK_SIZE];
+    UChar *pivot=pivotBuffer, *pivot2=pivotBuffer;
+    const char *source=segment->source;
+    int32_t desiredCapacity=(int32_t)(segment->sourceLimit-source)+CHUNK_SIZE;
+
+    for(;;) {
+        UErrorCode appendErrorCode=U_ZERO_ERROR;
+        int32_t capacity;
+        char *buffer=segment->output.getAppendBuffer(CHUNK_SIZE, desiredCapacity,
+                                                     capacity, segment->errorCode);
+        if(U_FAILURE(segment->errorCode)) {
+            return;
+        }
+        char *target=buffer;
+        ucnv_convertEx(segment->targetCnv, segment->sourceCnv,
+                       &target, buffer+capacity,
+                       &source, segment->sourceLimit,
+                       pivotBuffer, &pivot, &pivot2, pivotBuffer+CHUNK_SIZE,
+                       FALSE,
+                       TRUE,
+                       &segment->errorCode);
+        segment->output.append(buffer, (int32_t)(target-buffer), appendErrorCode);
+        if(U_FAILURE(appendErrorCode)) {
+            segment->errorCode=appendErrorCode;
+            return;
+        }
+        if(segment->errorCode!=U_BUFFER_OVERFLOW_ERROR) {
+            break;
+        }
+        segment->errorCode=U_ZERO_ERROR;
+        desiredCapacity=segment->output.length();
+    }
+    if(segment->errorCode==U_STRING_NOT_TERMINATED_WARNING) {
+        segment->errorCode=U_ZERO_ERROR;
+    }
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_convertParallel(UConverter *targetCnv, UConverter *sourceCnv,
+                     char *target, int32_t targetCapacity,
+                     const char *source, int32_t sourceLength,
+                     int32_t numThreads,
+                     UConverterRunTasksFn *runTasks, const void *runContext,
+                     UErrorCode *pErrorCode) {
+    int32_t splits[PARALLEL_MAX_SEGMENTS+1];
+    int32_t segmentCount, count, i;
+
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+
+    if( targetCnv==NULL || sourceCnv==NULL ||
+        source==NULL || sourceLength<-1 ||
+        targetCapacity<0 || (targetCapacity>0 && target==NULL) ||
+        numThreads<0
+    ) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    if(sourceLength<0) {
+        sourceLength=(int32_t)uprv_strlen(source);
+    }
+
+    /* if there is no input data, we're done */
+    if(sourceLength==0) {
+        return u_terminateChars(target, targetCapacity, 0, pErrorCode);
+    }
+
+    ucnv_resetToUnicode(sourceCnv);
+    ucnv_resetFromUnicode(targetCnv);
+
+    if(runTasks==NULL) {
+        numThreads=1;
+    }
+    segmentCount=sourceLength/PARALLEL_MIN_SEGMENT_LENGTH;
+    if(segmentCount>numThreads) {
+        segmentCount=numThreads;
+    }
+    if(segmentCount>PARALLEL_MAX_SEGMENTS) {
+        segmentCount=PARALLEL_MAX_SEGMENTS;
+    }
+
+    /* find split points near equal fractions of the input */
+    count=1;
+    splits[0]=0;
+    if( segmentCount>1 &&
+        hasBuiltInCallbacks(targetCnv) && hasBuiltInCallbacks(sourceCnv) &&
+        canSplitFromUnicode(targetCnv->sharedData) &&
+        canSplitToUnicode(sourceCnv->sharedData)
+    ) {
+        for(i=1; i<segmentCount; ++i) {
+            int32_t start=(int32_t)(((int64_t)sourceLength*i)/segmentCount);
+            int32_t limit=(int32_t)(((int64_t)sourceLength*(i+1))/segmentCount);
+            int32_t split=findToUnicodeSplit(sourceCnv->sharedData, (const uint8_t *)source,
+                                             start, limit);
+            if(split>0) {
+                splits[count++]=split;
+            }
+        }
+    }
+    splits[count]=sourceLength;
+
+    if(count==1) {
+        return ucnv_internalConvert(targetCnv, sourceCnv,
+                                    target, targetCapacity,
+                                    source, sourceLength,
+                                    pErrorCode);
+    }
+
+    /* the first segment uses the caller's converters, the others use clones */
+    icu::LocalArray<ParallelSegment> segments(new ParallelSegment[count]);
+    if(segments.isNull()) {
+        *pErrorCode=U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    for(i=0; i<count; ++i) {
+        ParallelSegment &segment=segments[i];
+        segment.source=source+splits[i];
+        segment.sourceLimit=source+splits[i+1];
+        segment.errorCode=U_ZERO_ERROR;
+        if(i==0) {
+            segment.targetCnv=targetCnv;
+            segment.sourceCnv=sourceCnv;
+        } else {
+            UErrorCode cloneErrorCode=U_ZERO_ERROR;
+            segment.targetClone.adoptInstead(ucnv_safeClone(targetCnv, NULL, NULL, &cloneErrorCode));
+            segment.sourceClone.adoptInstead(ucnv_safeClone(sourceCnv, NULL, NULL, &cloneErrorCode));
+            if(U_FAILURE(cloneErrorCode)) {
+                *pErrorCode=cloneErrorCode;
+                return 0;
+            }
+            segment.targetCnv=segment.targetClone.getAlias();
+            segment.sourceCnv=segment.sourceClone.getAlias();
+        }
+    }
+
+    void *tasks[PARALLEL_MAX_SEGMENTS];
+    for(i=0; i<count; ++i) {
+        tasks[i]=&segments[i];
+    }
+    runTasks(runContext, convertSegment, tasks, count);
+
+    /* concatenate the segment outputs, up to and including the first failing one */
+    int32_t length=0;
+    for(i=0; i<count; ++i) {
+        const ParallelSegment &segment=segments[i];
+        int32_t segmentLength=segment.output.length();
+        if(segmentLength>(INT32_MAX-length)) {
+            *pErrorCode=U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        if(length<targetCapacity) {
+            int32_t copyLength=targetCapacity-length;
+            if(copyLength>segmentLength) {
+                copyLength=segmentLength;
+            }
+            uprv_memcpy(target+length, segment.output.data(), copyLength);
+        }
+        length+=segmentLength;
+        if(U_FAILURE(segment.errorCode)) {
+            *pErrorCode=segment.errorCode;
+            return length;
+        }
+    }
+    return u_terminateChars(target, targetCapacity, length, pErrorCode);
+}
+
 /* @internal */
 static int32_t
 ucnv_convertAlgorithmic(UBool convertToAlgorithmic,
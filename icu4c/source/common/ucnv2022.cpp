@@ -37,6 +37,7 @@
 #include "unicode/ucnv_err.h"
 #include "unicode/ucnv_cb.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "ucnv_imp.h"
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
@@ -116,6 +117,15 @@ enum {
  */
 #define IS_2022_CONTROL(c) (((c)<0x20) && (((uint32_t)1<<(c))&0x0800c000)!=0)
 
+/*
+ * Bytes that end a run of characters in the toUnicode fast paths
+ * and are left to the byte-by-byte conversion loops:
+ * SO, SI and ESC like in IS_2022_CONTROL(), CR and LF which reset the state
+ * in ISO-2022-JP and -CN, and all bytes 80..FF.
+ * The bit mask 0x0800e400 adds bits 0xa and 0xd to the one above.
+ */
+#define IS_2022_RUN_BREAK(c) ((c)>=0x80 || (((c)<0x20) && (((uint32_t)1<<(c))&0x0800e400)!=0))
+
 /* for ISO-2022-JP and -CN implementations */
 typedef enum  {
         /* shared values */
@@ -565,6 +575,11 @@ _ISO2022Open(UConverter *cnv, UConverterLoadArgs *pArgs, UErrorCode *errorCode){
                     _ISO2022Close(cnv);
                     return;
                 }
+                /*
+                 * Unmappable code points must be returned to this converter's callback,
+                 * not substituted inside the MBCS code for the default callback.
+                 */
+                myConverterData->currentConverter->fromUCharErrorBehaviour = UCNV_FROM_U_CALLBACK_STOP;
 
                 if(version==1) {
                     (void)uprv_strcpy(myConverterData->name,"ISO_2022,locale=ko,version=1");
@@ -2077,6 +2092,81 @@ UConverter_fromUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
 
 /*************** to unicode *******************/
 
+/*
+ * Fast path for ISO-2022-JP toUnicode in G0:
+ * Converts a run of characters in the current G0 character set
+ * up to the next byte for IS_2022_RUN_BREAK(), the next double-byte character
+ * that does not map directly to a BMP code point, the end of the source
+ * or the target limit.
+ * Returns TRUE if it converted at least one character.
+ */
+static UBool
+toUnicodeRun_2022_JP(UConverterToUnicodeArgs *args, UConverterDataISO2022 *myData,
+                     const char **pSource, UChar **pTarget) {
+    const uint8_t *source=(const uint8_t *)*pSource;
+    const uint8_t *sourceLimit=(const uint8_t *)args->sourceLimit;
+    UChar *target=*pTarget;
+    const UChar *targetLimit=args->targetLimit;
+    int32_t *offsets=args->offsets;
+    StateEnum cs=(StateEnum)myData->toU2022State.cs[0];
+    uint8_t b;
+
+    switch(cs) {
+    case ASCII:
+    case JISX201:
+        while(source<sourceLimit && target<targetLimit && !IS_2022_RUN_BREAK(b=*source)) {
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=(UChar)(cs==ASCII ? b : jisx201ToU(b));
+            ++source;
+        }
+        break;
+    case JISX208:
+    case JISX212:
+    case GB2312:
+    case KSC5601:
+    {
+        const UConverterSharedData *sharedData=myData->myConverterArray[cs];
+        uint8_t bytes[2];
+        UChar c;
+        while((sourceLimit-source)>=2 && target<targetLimit &&
+                (uint8_t)(source[0] - 0x21) <= (0x7e - 0x21) &&
+                (uint8_t)(source[1] - 0x21) <= (0x7e - 0x21)) {
+            if(cs==JISX208) {
+                _2022ToSJIS(source[0], source[1], (char *)bytes);
+            } else if(cs==KSC5601) {
+                bytes[0]=(uint8_t)(source[0]+0x80);  /* _2022ToGR94DBCS() */
+                bytes[1]=(uint8_t)(source[1]+0x80);
+            } else {
+                bytes[0]=source[0];
+                bytes[1]=source[1];
+            }
+            if((c=_MBCSSimpleGetNextBMP(&sharedData->mbcs, bytes, 2))==0xfffe) {
+                break;
+            }
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=c;
+            source+=2;
+        }
+        break;
+    }
+    default:
+        /* ISO-8859-x and 7-bit half-width Katakana only in single shifts and G1 */
+        break;
+    }
+
+    if(target==*pTarget) {
+        return FALSE;
+    }
+    myData->isEmptySegment=FALSE;
+    *pSource=(const char *)source;
+    *pTarget=target;
+    return TRUE;
+}
+
 static void U_CALLCONV
 UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
                                                UErrorCode* err){
@@ -2110,6 +2200,10 @@ UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         targetUniChar =missingCharMarker;
 
+        if(pToU2022State->g == 0 && toUnicodeRun_2022_JP(args, myData, &mySource, &myTarget)) {
+            continue;
+        }
+
         if(myTarget < args->targetLimit){
 
             mySourceChar= (unsigned char) *mySource++;
@@ -2319,6 +2413,242 @@ UConverter_toUnicode_ISO_2022_JP_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
     args->source = mySource;
 }
 
+/*
+ * Direct conversion from ISO-2022-JP to UTF-8, without a UTF-16 pivot.
+ *
+ * Handles G0 (ASCII, JIS X 0201 Roman, 7-bit half-width Katakana and the
+ * double-byte character sets), CR/LF and escape sequences that are complete
+ * in the current buffer.
+ * For single shifts, SI/SO, 8-bit bytes, unassigned and illegal sequences,
+ * and for sequences that are truncated at the end of the input, this function
+ * returns U_USING_DEFAULT_WARNING to revert to ISO-2022-JP->UTF-16->UTF-8
+ * conversion, with the source pointing to the start of the sequence
+ * and the converter state unchanged. Pivoting handles errors and callbacks.
+ */
+static void U_CALLCONV
+UConverter_toUTF8_ISO_2022_JP(UConverterFromUnicodeArgs *pFromUArgs,
+                              UConverterToUnicodeArgs *pToUArgs,
+                              UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    UConverterDataISO2022 *myData;
+    ISO2022State *pToU2022State;
+    StateEnum cs;
+    UChar32 c;
+    uint8_t b;
+
+    /* set up the local pointers */
+    cnv=pToUArgs->converter;
+    utf8=pFromUArgs->converter;
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    myData=(UConverterDataISO2022*)(cnv->extraInfo);
+    pToU2022State=&myData->toU2022State;
+
+    if(myData->key!=0 || cnv->toULength>0 || utf8->fromUChar32!=0) {
+        /* continue a partial escape sequence or character in pivoting conversion */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity<=0) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        if(pToU2022State->g!=0) {
+            /* G1 (JIS7 half-width Katakana) or a single shift */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+
+        /* convert a run of ASCII or of BMP double-byte characters in G0, as in toUnicodeRun_2022_JP() */
+        cs=(StateEnum)pToU2022State->cs[0];
+        if(cs==ASCII) {
+            const uint8_t *runStart=source;
+            while(source<sourceLimit && targetCapacity>0 && !IS_2022_RUN_BREAK(b=*source)) {
+                *target++=b;
+                ++source;
+                --targetCapacity;
+            }
+            if(source!=runStart) {
+                myData->isEmptySegment=FALSE;
+                continue;
+            }
+        } else if(IS_JP_DBCS(cs)) {
+            const UConverterSharedData *sharedData=myData->myConverterArray[cs];
+            const uint8_t *runStart=source;
+            uint8_t bytes[2];
+            UChar u;
+            while((sourceLimit-source)>=2 && targetCapacity>=3 &&
+                    (uint8_t)(source[0]-0x21)<=(0x7e - 0x21) &&
+                    (uint8_t)(source[1]-0x21)<=(0x7e - 0x21)) {
+                if(cs==JISX208) {
+                    _2022ToSJIS(source[0], source[1], (char *)bytes);
+                } else if(cs==KSC5601) {
+                    bytes[0]=(uint8_t)(source[0]+0x80);  /* _2022ToGR94DBCS() */
+                    bytes[1]=(uint8_t)(source[1]+0x80);
+                } else {
+                    bytes[0]=source[0];
+                    bytes[1]=source[1];
+                }
+                if((u=_MBCSSimpleGetNextBMP(&sharedData->mbcs, bytes, 2))==0xfffe) {
+                    break;
+                }
+                if(u<=0x7f) {
+                    *target++=(uint8_t)u;
+                    --targetCapacity;
+                } else if(u<=0x7ff) {
+                    *target++=(uint8_t)((u>>6)|0xc0);
+                    *target++=(uint8_t)((u&0x3f)|0x80);
+                    targetCapacity-=2;
+                } else {
+                    *target++=(uint8_t)((u>>12)|0xe0);
+                    *target++=(uint8_t)(((u>>6)&0x3f)|0x80);
+                    *target++=(uint8_t)((u&0x3f)|0x80);
+                    targetCapacity-=3;
+                }
+                source+=2;
+            }
+            if(source!=runStart) {
+                myData->isEmptySegment=FALSE;
+                continue;
+            }
+        }
+
+        /* convert one character or escape sequence */
+        b=*source;
+        if(b==ESC_2022) {
+            /*
+             * Change the state here only if the escape sequence is complete and valid.
+             * In ISO-2022-JP proper, an empty segment before an escape sequence is an error.
+             */
+            ISO2022State savedState;
+            UErrorCode escErrorCode=U_ZERO_ERROR;
+            UConverterCallbackReason savedReason=cnv->toUCallbackReason;
+            const char *escSource=(const char *)source;
+
+            if(myData->version==0 && myData->isEmptySegment) {
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            savedState=*pToU2022State;
+            changeState_2022(cnv, &escSource, (const char *)sourceLimit, ISO_2022_JP, &escErrorCode);
+            if(U_FAILURE(escErrorCode) || myData->key!=0) {
+                /* revert, and let the pivoting code report the error or continue the sequence */
+                *pToU2022State=savedState;
+                myData->key=0;
+                cnv->toULength=0;
+                cnv->toUCallbackReason=savedReason;
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            source=(const uint8_t *)escSource;
+            myData->isEmptySegment=TRUE;
+            continue;
+        }
+        if(b==CR || b==LF) {
+            /* automatically reset to single-byte mode */
+            if((StateEnum)pToU2022State->cs[0]!=ASCII && (StateEnum)pToU2022State->cs[0]!=JISX201) {
+                pToU2022State->cs[0]=(int8_t)ASCII;
+            }
+            pToU2022State->cs[2]=0;
+        } else if(b>=0x80 || b==UCNV_SI || b==UCNV_SO) {
+            /* JIS8 half-width Katakana, JIS7 shifts, or illegal */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+
+        cs=(StateEnum)pToU2022State->cs[0];
+        switch(cs) {
+        case ASCII:
+            c=b;
+            ++source;
+            break;
+        case JISX201:
+            c=(UChar32)jisx201ToU(b);
+            ++source;
+            break;
+        case HWKANA_7BIT:
+            if((uint8_t)(b-0x21)<=(0x5f-0x21)) {
+                c=b+(HWKANA_START-0x21);
+                ++source;
+            } else {
+                c=-1;
+            }
+            break;
+        default:
+            /* G0 DBCS */
+            c=-1;
+            if((sourceLimit-source)>=2 &&
+                    (uint8_t)(source[0]-0x21)<=(0x7e - 0x21) &&
+                    (uint8_t)(source[1]-0x21)<=(0x7e - 0x21)) {
+                char bytes[2];
+                if(cs==JISX208) {
+                    _2022ToSJIS(source[0], source[1], bytes);
+                } else if(cs==KSC5601) {
+                    bytes[0]=(char)(source[0]+0x80);  /* _2022ToGR94DBCS() */
+                    bytes[1]=(char)(source[1]+0x80);
+                } else {
+                    bytes[0]=(char)source[0];
+                    bytes[1]=(char)source[1];
+                }
+                c=ucnv_MBCSSimpleGetNextUChar(myData->myConverterArray[cs], bytes, 2, FALSE);
+                if(c>=0xfffe && c<=0xffff) {
+                    /* unassigned or illegal */
+                    c=-1;
+                } else {
+                    source+=2;
+                }
+            }
+            break;
+        }
+
+        if(c<0) {
+            /* handle this sequence with pivoting, for truncation, errors and callbacks */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+        myData->isEmptySegment=FALSE;
+
+        /* output the code point as UTF-8 */
+        if(targetCapacity>=U8_MAX_LENGTH) {
+            int32_t i=0;
+            U8_APPEND_UNSAFE(target, i, c);
+            target+=i;
+            targetCapacity-=i;
+        } else {
+            uint8_t u8[U8_MAX_LENGTH];
+            int32_t i, length=0;
+            U8_APPEND_UNSAFE(u8, length, c);
+            for(i=0; i<length && targetCapacity>0; ++i) {
+                *target++=u8[i];
+                --targetCapacity;
+            }
+            if(i<length) {
+                /* output the rest into the UTF-8 converter's overflow buffer */
+                uprv_memcpy(utf8->charErrorBuffer, u8+i, length-i);
+                utf8->charErrorBufferLength=(int8_t)(length-i);
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+                break;
+            }
+        }
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 
 #if !UCONFIG_ONLY_HTML_CONVERSION
 /***************************************************************
@@ -2670,6 +3000,63 @@ UConverter_toUnicode_ISO_2022_KR_OFFSETS_LOGIC_IBM(UConverterToUnicodeArgs *args
     }
 }
 
+/*
+ * Fast path for ISO-2022-KR toUnicode:
+ * Converts a run of single-byte characters (G0) or of double-byte characters
+ * (G1, after SO) up to the next byte for IS_2022_RUN_BREAK()
+ * or pair of bytes outside 21..7E, the next character that does not
+ * map directly to a BMP code point, the end of the source or the target limit.
+ * Returns TRUE if it converted at least one character.
+ */
+static UBool
+toUnicodeRun_2022_KR(UConverterToUnicodeArgs *args, UConverterDataISO2022 *myData,
+                     const UConverterSharedData *sharedData,
+                     const char **pSource, UChar **pTarget) {
+    const uint8_t *source=(const uint8_t *)*pSource;
+    const uint8_t *sourceLimit=(const uint8_t *)args->sourceLimit;
+    UChar *target=*pTarget;
+    const UChar *targetLimit=args->targetLimit;
+    int32_t *offsets=args->offsets;
+    uint8_t bytes[2];
+    UChar c;
+
+    if(myData->toU2022State.g == 1) {
+        while((sourceLimit-source)>=2 && target<targetLimit &&
+                (uint8_t)(source[0] - 0x21) <= (0x7e - 0x21) &&
+                (uint8_t)(source[1] - 0x21) <= (0x7e - 0x21)) {
+            bytes[0]=(uint8_t)(source[0]+0x80);
+            bytes[1]=(uint8_t)(source[1]+0x80);
+            if((c=_MBCSSimpleGetNextBMP(&sharedData->mbcs, bytes, 2))==0xfffe) {
+                break;
+            }
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=c;
+            source+=2;
+        }
+    } else {
+        while(source<sourceLimit && target<targetLimit && !IS_2022_RUN_BREAK(*source)) {
+            if((c=_MBCSSimpleGetNextBMP(&sharedData->mbcs, source, 1))==0xfffe) {
+                break;
+            }
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=c;
+            ++source;
+        }
+    }
+
+    if(target==*pTarget) {
+        return FALSE;
+    }
+    myData->isEmptySegment=FALSE;
+    *pSource=(const char *)source;
+    *pTarget=target;
+    return TRUE;
+}
+
 static void U_CALLCONV
 UConverter_toUnicode_ISO_2022_KR_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
                                                             UErrorCode* err){
@@ -2705,6 +3092,10 @@ UConverter_toUnicode_ISO_2022_KR_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
     while(mySource< mySourceLimit){
 
+        if(toUnicodeRun_2022_KR(args, myData, sharedData, &mySource, &myTarget)) {
+            continue;
+        }
+
         if(myTarget < args->targetLimit){
 
             mySourceChar= (unsigned char) *mySource++;
@@ -3263,6 +3654,70 @@ UConverter_fromUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterFromUnicodeArgs* args
 }
 
 
+/*
+ * Fast path for ISO-2022-CN toUnicode in G0 (ASCII) and G1 (after SO):
+ * Converts a run of characters up to the next byte for IS_2022_RUN_BREAK()
+ * or pair of bytes outside 21..7E, the next double-byte character that does not
+ * map directly to a BMP code point, the end of the source or the target limit.
+ * Returns TRUE if it converted at least one character.
+ */
+static UBool
+toUnicodeRun_2022_CN(UConverterToUnicodeArgs *args, UConverterDataISO2022 *myData,
+                     const char **pSource, UChar **pTarget) {
+    const uint8_t *source=(const uint8_t *)*pSource;
+    const uint8_t *sourceLimit=(const uint8_t *)args->sourceLimit;
+    UChar *target=*pTarget;
+    const UChar *targetLimit=args->targetLimit;
+    int32_t *offsets=args->offsets;
+
+    if(myData->toU2022State.g == 0) {
+        uint8_t b;
+        while(source<sourceLimit && target<targetLimit && !IS_2022_RUN_BREAK(b=*source)) {
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=b;
+            ++source;
+        }
+    } else if(myData->toU2022State.g == 1) {
+        StateEnum tempState=(StateEnum)myData->toU2022State.cs[1];
+        const UConverterSharedData *sharedData;
+        uint8_t bytes[3];
+        int32_t length;
+        UChar c;
+        if(tempState >= CNS_11643_0) {
+            sharedData=myData->myConverterArray[CNS_11643];
+            bytes[0]=(uint8_t)(0x80+(tempState-CNS_11643_0));
+            length=3;
+        } else {
+            sharedData=myData->myConverterArray[tempState];
+            length=2;
+        }
+        while((sourceLimit-source)>=2 && target<targetLimit &&
+                (uint8_t)(source[0] - 0x21) <= (0x7e - 0x21) &&
+                (uint8_t)(source[1] - 0x21) <= (0x7e - 0x21)) {
+            bytes[length-2]=source[0];
+            bytes[length-1]=source[1];
+            if((c=_MBCSSimpleGetNextBMP(&sharedData->mbcs, bytes, length))==0xfffe) {
+                break;
+            }
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=c;
+            source+=2;
+        }
+    }
+
+    if(target==*pTarget) {
+        return FALSE;
+    }
+    myData->isEmptySegment=FALSE;
+    *pSource=(const char *)source;
+    *pTarget=target;
+    return TRUE;
+}
+
 static void U_CALLCONV
 UConverter_toUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
                                                UErrorCode* err){
@@ -3293,6 +3748,10 @@ UConverter_toUnicode_ISO_2022_CN_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
 
         targetUniChar =missingCharMarker;
 
+        if(toUnicodeRun_2022_CN(args, myData, &mySource, &myTarget)) {
+            continue;
+        }
+
         if(myTarget < args->targetLimit){
 
             mySourceChar= (unsigned char) *mySource++;
@@ -3845,7 +4304,7 @@ static const UConverterImpl _ISO2022JPImpl={
     _ISO_2022_SafeClone,
     _ISO_2022_GetUnicodeSet,
 
-    NULL,
+    UConverter_toUTF8_ISO_2022_JP,
     NULL
 };
 static const UConverterStaticData _ISO2022JPStaticData={
@@ -237,11 +237,14 @@ ucnv_flushAvailableConverterCache() {
     gAvailableConvertersInitOnce.reset();
 }
 
+static void ucnv_flushAllPools();
+
 /* ucnv_cleanup - delete all storage held by the converter cache, except any  */
 /*                in use by open converters.                                  */
 /*                Not thread safe.                                            */
 /*                Not supported API.                                          */
 static UBool U_CALLCONV ucnv_cleanup(void) {
+    ucnv_flushAllPools();
     ucnv_flushCache();
     if (SHARED_DATA_HASHTABLE != NULL && uhash_count(SHARED_DATA_HASHTABLE) == 0) {
         uhash_close(SHARED_DATA_HASHTABLE);
@@ -444,6 +447,8 @@ ucnv_shareConverterData(UConverterSharedData * data)
         SHARED_DATA_HASHTABLE = uhash_openSize(uhash_hashChars, uhash_compareChars, NULL,
                             ucnv_io_countKnownConverters(&err)*UCNV_CACHE_LOAD_FACTOR,
                             &err);
+        /* ucnv_open() looks up every converter name here. */
+        uhash_setGroupProbing(SHARED_DATA_HASHTABLE, &err);
         ucnv_enableCleanup();
 
         if (U_FAILURE(err))
@@ -1025,6 +1030,215 @@ ucnv_createConverterFromSharedData(UConverter *myUConverter,
     return myUConverter;
 }
 
+/* per-thread converter pool ------------------------------------------------ */
+
+/*
+ * Maximum number of converters that ucnv_release() keeps per thread.
+ * Define as 0 to disable the pool, for example on platforms without thread_local.
+ */
+#ifndef UCNV_POOL_CAPACITY
+#   define UCNV_POOL_CAPACITY 8
+#endif
+
+#if UCNV_POOL_CAPACITY > 0
+
+namespace {
+
+/*
+ * Incremented by ucnv_flushCache().
+ * A thread's pool closes its converters when it sees a new generation,
+ * so that their shared data can be unloaded by a later ucnv_flushCache().
+ */
+icu::u_atomic_int32_t gPoolGeneration = ATOMIC_INT32_T_INITIALIZER(0);
+
+class ConverterPool;
+
+/*
+ * List of the pools of all threads, so that ucnv_cleanup() can close their converters.
+ * A pool adds itself when its thread first uses it, and removes itself when the thread exits.
+ */
+icu::UMutex gPoolListMutex = U_MUTEX_INITIALIZER;
+ConverterPool *gPoolList = NULL;
+
+/*
+ * Converters released on one thread, in release order.
+ * Only the owning thread accesses its pool, so no locking is needed,
+ * except by ucnv_cleanup() which runs while no other thread uses ICU.
+ */
+class ConverterPool {
+public:
+    ConverterPool() : count(0), generation(icu::umtx_loadAcquire(gPoolGeneration)), prev(NULL) {
+        icu::Mutex lock(&gPoolListMutex);
+        next = gPoolList;
+        if (next != NULL) {
+            next->prev = this;
+        }
+        gPoolList = this;
+    }
+    ~ConverterPool() {
+        flush();
+        icu::Mutex lock(&gPoolListMutex);
+        if (prev != NULL) {
+            prev->next = next;
+        } else {
+            gPoolList = next;
+        }
+        if (next != NULL) {
+            next->prev = prev;
+        }
+    }
+
+    UConverter *take(const char *name, UErrorCode *err);
+    UBool put(UConverter *cnv);
+    void flush();
+    /* Flushes the pools of all threads. */
+    static void flushAll();
+
+private:
+    void checkGeneration() {
+        int32_t g = icu::umtx_loadAcquire(gPoolGeneration);
+        if (g != generation) {
+            flush();
+            generation = g;
+        }
+    }
+    /* Returns the index of the most recently released converter with this name, or -1. */
+    int32_t indexOf(const char *canonicalName) const;
+
+    int32_t count;
+    int32_t generation;
+    UConverter *converters[UCNV_POOL_CAPACITY];
+    ConverterPool *prev, *next;
+};
+
+thread_local ConverterPool gPool;
+
+int32_t ConverterPool::indexOf(const char *canonicalName) const {
+    for (int32_t i = count - 1; i >= 0; --i) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        if (uprv_strcmp(ucnv_getName(converters[i], &errorCode), canonicalName) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+UConverter *ConverterPool::take(const char *name, UErrorCode *err) {
+    checkGeneration();
+    if (count == 0) {
+        return NULL;
+    }
+    /* Callers typically pass canonical names; try without an alias lookup first. */
+    int32_t i = indexOf(name);
+    if (i < 0 && uprv_strchr(name, UCNV_OPTION_SEP_CHAR) == NULL) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UBool containsOption;
+        const char *canonicalName = ucnv_io_getConverterName(name, &containsOption, &errorCode);
+        if (U_FAILURE(errorCode) || canonicalName == NULL) {
+            return NULL;
+        }
+        i = indexOf(canonicalName);
+        if (i >= 0 && errorCode == U_AMBIGUOUS_ALIAS_WARNING) {
+            *err = U_AMBIGUOUS_ALIAS_WARNING;
+        }
+    }
+    if (i < 0) {
+        return NULL;
+    }
+    UConverter *cnv = converters[i];
+    --count;
+    uprv_memmove(converters + i, converters + i + 1, (count - i) * sizeof(UConverter *));
+    return cnv;
+}
+
+/*
+ * Returns FALSE if the converter is not pooled because the pool is full,
+ * or because the converter is not the same as a newly opened one after ucnv_reset().
+ *
+ * The pool matches converters only by name. A converter from ucnv_openPackage()
+ * can have the name of an ICU converter with other data, so it is not pooled.
+ * Its shared data is reference-counted but not in the shared data cache;
+ * cached and algorithmic converters are what ucnv_open() would return.
+ */
+UBool ConverterPool::put(UConverter *cnv) {
+    checkGeneration();
+    const UConverterSharedData *sharedData = cnv->sharedData;
+    if (sharedData->isReferenceCounted && !sharedData->sharedDataCached) {
+        return FALSE;
+    }
+    if (count == UCNV_POOL_CAPACITY || cnv->isCopyLocal || cnv->useFallback ||
+            cnv->fromUCharErrorBehaviour != UCNV_FROM_U_DEFAULT_CALLBACK || cnv->fromUContext != NULL ||
+            cnv->fromCharErrorBehaviour != UCNV_TO_U_DEFAULT_CALLBACK || cnv->toUContext != NULL) {
+        return FALSE;
+    }
+    const UConverterStaticData *staticData = sharedData->staticData;
+    if (cnv->subChars != (uint8_t *)cnv->subUChars || cnv->subCharLen != staticData->subCharLen ||
+            uprv_memcmp(cnv->subChars, staticData->subChar, cnv->subCharLen) != 0 ||
+            cnv->subChar1 != staticData->subChar1) {
+        return FALSE;
+    }
+    ucnv_reset(cnv);
+    converters[count++] = cnv;
+    return TRUE;
+}
+
+void ConverterPool::flush() {
+    while (count > 0) {
+        ucnv_close(converters[--count]);
+    }
+}
+
+void ConverterPool::flushAll() {
+    icu::Mutex lock(&gPoolListMutex);
+    for (ConverterPool *pool = gPoolList; pool != NULL; pool = pool->next) {
+        pool->flush();
+    }
+}
+
+}  // namespace
+
+#endif  /* UCNV_POOL_CAPACITY > 0 */
+
+/*
+ * Closes the pooled converters of all threads, for ucnv_cleanup().
+ * ucnv_flushCache() cannot do this because other threads may be using their pools.
+ */
+static void ucnv_flushAllPools() {
+#if UCNV_POOL_CAPACITY > 0
+    ConverterPool::flushAll();
+#endif
+}
+
+U_CAPI UConverter * U_EXPORT2
+ucnv_acquire(const char *converterName, UErrorCode *err) {
+    if (err == NULL || U_FAILURE(*err)) {
+        return NULL;
+    }
+#if UCNV_POOL_CAPACITY > 0
+    const char *name = converterName != NULL ? converterName : ucnv_getDefaultName();
+    if (name != NULL && *name != 0) {
+        UConverter *cnv = gPool.take(name, err);
+        if (cnv != NULL) {
+            return cnv;
+        }
+    }
+#endif
+    return ucnv_open(converterName, err);
+}
+
+U_CAPI void U_EXPORT2
+ucnv_release(UConverter *converter) {
+    if (converter == NULL) {
+        return;
+    }
+#if UCNV_POOL_CAPACITY > 0
+    if (gPool.put(converter)) {
+        return;
+    }
+#endif
+    ucnv_close(converter);
+}
+
 /*Frees all shared immutable objects that aren't referred to (reference count = 0)
  */
 U_CAPI int32_t U_EXPORT2
@@ -1042,6 +1256,15 @@ ucnv_flushCache ()
     /* Close the default converter without creating a new one so that everything will be flushed. */
     u_flushDefaultConverter();
 
+#if UCNV_POOL_CAPACITY > 0
+    /*
+     * Close the pooled converters of this thread now,
+     * and of other threads when they next use their pools.
+     */
+    icu::umtx_atomic_inc(&gPoolGeneration);
+    gPool.flush();
+#endif
+
     /*if shared data hasn't even been lazy evaluated yet
     * return 0
     */
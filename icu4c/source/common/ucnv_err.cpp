@@ -52,40 +52,6 @@
 #define UCNV_PRV_ESCAPE_CSS2        'S'
 #define UCNV_PRV_STOP_ON_ILLEGAL    'i'
 
-/*
- * IS_DEFAULT_IGNORABLE_CODE_POINT
- * This is to check if a code point has the default ignorable unicode property.
- * As such, this list needs to be updated if the ignorable code point list ever
- * changes.
- * To avoid dependency on other code, this list is hard coded here.
- * When an ignorable code point is found and is unmappable, the default callbacks
- * will ignore them.
- * For a list of the default ignorable code points, use this link:
- * https://unicode.org/cldr/utility/list-unicodeset.jsp?a=%5B%3ADI%3A%5D&abb=on&g=&i=
- *
- * This list should be sync with the one in CharsetCallback.java
- */
-#define IS_DEFAULT_IGNORABLE_CODE_POINT(c) ( \
-    (c == 0x00AD) || \
-    (c == 0x034F) || \
-    (c == 0x061C) || \
-    (c == 0x115F) || \
-    (c == 0x1160) || \
-    (0x17B4 <= c && c <= 0x17B5) || \
-    (0x180B <= c && c <= 0x180E) || \
-    (0x200B <= c && c <= 0x200F) || \
-    (0x202A <= c && c <= 0x202E) || \
-    (0x2060 <= c && c <= 0x206F) || \
-    (c == 0x3164) || \
-    (0xFE00 <= c && c <= 0xFE0F) || \
-    (c == 0xFEFF) || \
-    (c == 0xFFA0) || \
-    (0xFFF0 <= c && c <= 0xFFF8) || \
-    (0x1BCA0 <= c && c <= 0x1BCA3) || \
-    (0x1D173 <= c && c <= 0x1D17A) || \
-    (0xE0000 <= c && c <= 0xE0FFF))
-
-
 /*Function Pointer STOPS at the ILLEGAL_SEQUENCE */
 U_CAPI void    U_EXPORT2
 UCNV_FROM_U_CALLBACK_STOP (
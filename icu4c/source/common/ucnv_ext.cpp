@@ -363,6 +363,22 @@ ucnv_extSimpleMatchToU(const int32_t *cx,
     return 0xfffe;
 }
 
+/*
+ * @return TRUE if the input is a proper prefix of a longer toUnicode mapping,
+ *         for example the first character of a multi-character mapping
+ */
+U_CFUNC UBool
+ucnv_extIsPartialMatchToU(const int32_t *cx,
+                          const char *source, int32_t length) {
+    uint32_t value;
+
+    return ucnv_extMatchToU(cx, -1,
+                            source, length,
+                            NULL, 0,
+                            &value,
+                            FALSE, FALSE)<0;
+}
+
 /*
  * continue partial match with new input
  * never called for simple, single-character conversion
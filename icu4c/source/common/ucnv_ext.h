@@ -363,6 +363,10 @@ ucnv_extSimpleMatchToU(const int32_t *cx,
                        const char *source, int32_t length,
                        UBool useFallback);
 
+U_CFUNC UBool
+ucnv_extIsPartialMatchToU(const int32_t *cx,
+                          const char *source, int32_t length);
+
 U_CFUNC void
 ucnv_extContinueMatchToU(UConverter *cnv,
                          UConverterToUnicodeArgs *pArgs, int32_t srcIndex,
@@ -45,6 +45,7 @@
 #include "ucnv_io.h"
 #include "uenumimp.h"
 #include "ucln_cmn.h"
+#include "ustr_imp.h"
 
 /* Format of cnvalias.icu -----------------------------------------------------
  *
@@ -201,6 +202,37 @@ static UConverterAlias gMainTable;
 #define GET_STRING(idx) (const char *)(gMainTable.stringTable + (idx))
 #define GET_NORMALIZED_STRING(idx) (const char *)(gMainTable.normalizedStringTable + (idx))
 
+/*
+ * Hash index over the normalized alias names, built when the alias data is loaded.
+ * Each slot holds an index into gMainTable.aliasList and gMainTable.untaggedConvArray,
+ * or ALIAS_HASH_EMPTY.
+ * The number of slots is a power of two and at least twice the number of aliases,
+ * so that linear probing quickly finds either the alias or an empty slot.
+ * NULL if the alias names are not normalized, or if the memory allocation failed;
+ * findConverter() then uses a binary search.
+ */
+static uint16_t *gAliasHash = NULL;
+static uint32_t gAliasHashMask = 0;
+
+#define ALIAS_HASH_EMPTY 0xffff
+
+/*
+ * For each ambiguous alias, the converters whose tagged alias lists contain it,
+ * in the order in which a search through gMainTable.taggedAliasArray finds them.
+ * The converters for alias index i start at gAmbiguousAliasConverters[gAmbiguousAliasStarts[i]]
+ * and are terminated by UINT16_MAX.
+ * Built on first use, so that ucnv_getStandardName() and ucnv_getCanonicalName()
+ * need not search all of the tagged alias lists for an ambiguous alias.
+ */
+static uint32_t *gAmbiguousAliasStarts = NULL;
+static uint16_t *gAmbiguousAliasConverters = NULL;
+static icu::UInitOnce gAmbiguousAliasesInitOnce = U_INITONCE_INITIALIZER;
+
+static inline uint32_t
+hashAlias(const char *normalizedName, int32_t length) {
+    return (uint32_t)ustr_hashCharsN(normalizedName, length);
+}
+
 static UBool U_CALLCONV
 isAcceptable(void * /*context*/,
              const char * /*type*/, const char * /*name*/,
@@ -224,11 +256,50 @@ static UBool U_CALLCONV ucnv_io_cleanup(void)
     }
     gAliasDataInitOnce.reset();
 
+    uprv_free(gAmbiguousAliasStarts);
+    uprv_free(gAmbiguousAliasConverters);
+    gAmbiguousAliasStarts = NULL;
+    gAmbiguousAliasConverters = NULL;
+    gAmbiguousAliasesInitOnce.reset();
+
+    uprv_free(gAliasHash);
+    gAliasHash = NULL;
+    gAliasHashMask = 0;
+
     uprv_memset(&gMainTable, 0, sizeof(gMainTable));
 
     return TRUE;                   /* Everything was cleaned up */
 }
 
+/* Build gAliasHash. The alias index is optional; failure to build it is not an error. */
+static void initAliasHash() {
+    uint32_t aliasCount = gMainTable.untaggedConvArraySize;
+    if (gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED ||
+            aliasCount == 0 || aliasCount >= ALIAS_HASH_EMPTY) {
+        return;
+    }
+    uint32_t capacity = 64;
+    while (capacity < 2 * aliasCount) {
+        capacity <<= 1;
+    }
+    uint16_t *hash = (uint16_t *)uprv_malloc(capacity * sizeof(uint16_t));
+    if (hash == NULL) {
+        return;
+    }
+    uprv_memset(hash, 0xff, capacity * sizeof(uint16_t));  /* ALIAS_HASH_EMPTY */
+    uint32_t mask = capacity - 1;
+    for (uint32_t i = 0; i < aliasCount; ++i) {
+        const char *name = GET_NORMALIZED_STRING(gMainTable.aliasList[i]);
+        uint32_t slot = hashAlias(name, (int32_t)uprv_strlen(name)) & mask;
+        while (hash[slot] != ALIAS_HASH_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+        hash[slot] = (uint16_t)i;
+    }
+    gAliasHash = hash;
+    gAliasHashMask = mask;
+}
+
 static void U_CALLCONV initAliasData(UErrorCode &errCode) {
     UDataMemory *data;
     const uint16_t *table;
@@ -306,6 +377,8 @@ static void U_CALLCONV initAliasData(UErrorCode &errCode) {
     currOffset += gMainTable.stringTableSize;
     gMainTable.normalizedStringTable = ((gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED)
         ? gMainTable.stringTable : (table + currOffset));
+
+    initAliasHash();
 }
 
 
@@ -544,12 +617,33 @@ ucnv_compareNames(const char *name1, const char *name2) {
     }
 }
 
+/*
+ * Look up a normalized alias in the hash index.
+ * return the index for gMainTable.aliasList and gMainTable.untaggedConvArray,
+ * or UINT32_MAX if it is not found
+ */
+static inline uint32_t
+findNormalizedAlias(const char *normalizedAlias) {
+    uint32_t slot = hashAlias(normalizedAlias, (int32_t)uprv_strlen(normalizedAlias)) & gAliasHashMask;
+    for (;;) {
+        uint32_t i = gAliasHash[slot];
+        if (i == ALIAS_HASH_EMPTY) {
+            return UINT32_MAX;
+        }
+        if (uprv_strcmp(normalizedAlias, GET_NORMALIZED_STRING(gMainTable.aliasList[i])) == 0) {
+            return i;
+        }
+        slot = (slot + 1) & gAliasHashMask;
+    }
+}
+
 /*
  * search for an alias
- * return the converter number index for gConverterList
+ * return the index for gMainTable.aliasList and gMainTable.untaggedConvArray,
+ * or UINT32_MAX if it is not found
  */
 static inline uint32_t
-findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode) {
+findAlias(const char *alias, UErrorCode *pErrorCode) {
     uint32_t mid, start, limit;
     uint32_t lastMid;
     int result;
@@ -567,6 +661,10 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         alias = strippedName;
     }
 
+    if (gAliasHash != NULL) {
+        return findNormalizedAlias(alias);
+    }
+
     /* do a binary search for the alias */
     start = 0;
     limit = gMainTable.untaggedConvArraySize;
@@ -591,34 +689,154 @@ findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode)
         } else if (result > 0) {
             start = mid;
         } else {
-            /* Since the gencnval tool folds duplicates into one entry,
-             * this alias in gAliasList is unique, but different standards
-             * may map an alias to different converters.
-             */
-            if (gMainTable.untaggedConvArray[mid] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
-                *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
+            return mid;
+        }
+    }
+
+    return UINT32_MAX;
+}
+
+/*
+ * return the converter number index for gConverterList
+ * for an alias index from findAlias()
+ */
+static inline uint32_t
+getAliasConverter(uint32_t aliasIndex, UBool *containsOption, UErrorCode *pErrorCode) {
+    /* Since the gencnval tool folds duplicates into one entry,
+     * this alias in gAliasList is unique, but different standards
+     * may map an alias to different converters.
+     */
+    if (gMainTable.untaggedConvArray[aliasIndex] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) {
+        *pErrorCode = U_AMBIGUOUS_ALIAS_WARNING;
+    }
+    /* State whether the canonical converter name contains an option.
+    This information is contained in this list in order to maintain backward & forward compatibility. */
+    if (containsOption) {
+        UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
+        *containsOption = (UBool)((containsCnvOptionInfo
+            && ((gMainTable.untaggedConvArray[aliasIndex] & UCNV_CONTAINS_OPTION_BIT) != 0))
+            || !containsCnvOptionInfo);
+    }
+    return gMainTable.untaggedConvArray[aliasIndex] & UCNV_CONVERTER_INDEX_MASK;
+}
+
+/*
+ * search for an alias
+ * return the converter number index for gConverterList
+ */
+static inline uint32_t
+findConverter(const char *alias, UBool *containsOption, UErrorCode *pErrorCode) {
+    uint32_t aliasIndex = findAlias(alias, pErrorCode);
+    if (aliasIndex == UINT32_MAX) {
+        return UINT32_MAX;
+    }
+    return getAliasConverter(aliasIndex, containsOption, pErrorCode);
+}
+
+/*
+ * Visit each tagged alias list, in the order of gMainTable.taggedAliasArray,
+ * and record each converter whose list contains an ambiguous alias.
+ * With converters==NULL, count the occurrences of each ambiguous alias in starts[alias+1].
+ * Otherwise, append each converter that is not yet recorded to the alias' slice of converters.
+ */
+static void
+visitAmbiguousAliases(uint32_t *starts, uint16_t *converters) {
+    for (uint32_t idx = 0; idx < gMainTable.taggedAliasArraySize; idx++) {
+        uint32_t listOffset = gMainTable.taggedAliasArray[idx];
+        if (listOffset == 0) {
+            continue;
+        }
+        uint16_t convNum = (uint16_t)(idx % gMainTable.converterListSize);
+        uint32_t listCount = gMainTable.taggedAliasLists[listOffset];
+        const uint16_t *currList = gMainTable.taggedAliasLists + listOffset + 1;
+        for (uint32_t currAlias = 0; currAlias < listCount; currAlias++) {
+            if (currList[currAlias] == 0) {
+                continue;
+            }
+            uint32_t aliasIndex = findNormalizedAlias(GET_NORMALIZED_STRING(currList[currAlias]));
+            if (aliasIndex == UINT32_MAX ||
+                    (gMainTable.untaggedConvArray[aliasIndex] & UCNV_AMBIGUOUS_ALIAS_MAP_BIT) == 0) {
+                continue;
             }
-            /* State whether the canonical converter name contains an option.
-            This information is contained in this list in order to maintain backward & forward compatibility. */
-            if (containsOption) {
-                UBool containsCnvOptionInfo = (UBool)gMainTable.optionTable->containsCnvOptionInfo;
-                *containsOption = (UBool)((containsCnvOptionInfo
-                    && ((gMainTable.untaggedConvArray[mid] & UCNV_CONTAINS_OPTION_BIT) != 0))
-                    || !containsCnvOptionInfo);
+            if (converters == NULL) {
+                ++starts[aliasIndex + 1];
+            } else {
+                for (uint32_t i = starts[aliasIndex]; i < starts[aliasIndex + 1]; ++i) {
+                    if (converters[i] == convNum) {
+                        break;
+                    } else if (converters[i] == UINT16_MAX) {
+                        converters[i] = convNum;
+                        break;
+                    }
+                }
             }
-            return gMainTable.untaggedConvArray[mid] & UCNV_CONVERTER_INDEX_MASK;
         }
     }
+}
 
-    return UINT32_MAX;
+static void U_CALLCONV initAmbiguousAliases() {
+    if (gAliasHash == NULL) {
+        return;
+    }
+    uint32_t aliasCount = gMainTable.untaggedConvArraySize;
+    uint32_t *starts = (uint32_t *)uprv_malloc((aliasCount + 1) * sizeof(uint32_t));
+    if (starts == NULL) {
+        return;
+    }
+    uprv_memset(starts, 0, (aliasCount + 1) * sizeof(uint32_t));
+    visitAmbiguousAliases(starts, NULL);
+    /* one more slot per alias for the UINT16_MAX terminator */
+    for (uint32_t i = 0; i < aliasCount; ++i) {
+        starts[i + 1] += starts[i] + 1;
+    }
+    uint16_t *converters = (uint16_t *)uprv_malloc(starts[aliasCount] * sizeof(uint16_t));
+    if (converters == NULL) {
+        uprv_free(starts);
+        return;
+    }
+    uprv_memset(converters, 0xff, starts[aliasCount] * sizeof(uint16_t));  /* UINT16_MAX */
+    visitAmbiguousAliases(starts, converters);
+    gAmbiguousAliasStarts = starts;
+    gAmbiguousAliasConverters = converters;
+}
+
+/*
+ * Get the converters whose tagged alias lists contain this ambiguous alias,
+ * in the order of gMainTable.taggedAliasArray, terminated by UINT16_MAX.
+ * return NULL if the index could not be built; then the caller needs to search
+ * gMainTable.taggedAliasArray.
+ */
+static const uint16_t *
+getAmbiguousAliasConverters(uint32_t aliasIndex) {
+    umtx_initOnce(gAmbiguousAliasesInitOnce, &initAmbiguousAliases);
+    if (gAmbiguousAliasConverters == NULL) {
+        return NULL;
+    }
+    return gAmbiguousAliasConverters + gAmbiguousAliasStarts[aliasIndex];
+}
+
+/*
+ * Returns the alias as normalized by ucnv_io_stripForCompare() in buffer,
+ * or NULL if the alias table is not normalized or the alias is too long.
+ */
+static inline const char *
+normalizeAlias(const char *alias, char buffer[UCNV_MAX_CONVERTER_NAME_LENGTH]) {
+    if (gMainTable.optionTable->stringNormalizationType == UCNV_IO_UNNORMALIZED ||
+            uprv_strlen(alias) >= UCNV_MAX_CONVERTER_NAME_LENGTH) {
+        return NULL;
+    }
+    return ucnv_io_stripForCompare(buffer, alias);
 }
 
 /*
  * Is this alias in this list?
  * alias and listOffset should be non-NULL.
+ * normalizedAlias is the result of normalizeAlias(alias);
+ * if not NULL, it is compared with the normalized strings,
+ * which is much faster than ucnv_compareNames().
  */
 static inline UBool
-isAliasInList(const char *alias, uint32_t listOffset) {
+isAliasInList(const char *alias, const char *normalizedAlias, uint32_t listOffset) {
     if (listOffset) {
         uint32_t currAlias;
         uint32_t listCount = gMainTable.taggedAliasLists[listOffset];
@@ -626,7 +844,9 @@ isAliasInList(const char *alias, uint32_t listOffset) {
         const uint16_t *currList = gMainTable.taggedAliasLists + listOffset + 1;
         for (currAlias = 0; currAlias < listCount; currAlias++) {
             if (currList[currAlias]
-                && ucnv_compareNames(alias, GET_STRING(currList[currAlias]))==0)
+                && (normalizedAlias != NULL ?
+                    uprv_strcmp(normalizedAlias, GET_NORMALIZED_STRING(currList[currAlias]))==0 :
+                    ucnv_compareNames(alias, GET_STRING(currList[currAlias]))==0))
             {
                 return TRUE;
             }
@@ -645,12 +865,15 @@ static uint32_t
 findTaggedAliasListsOffset(const char *alias, const char *standard, UErrorCode *pErrorCode) {
     uint32_t idx;
     uint32_t listOffset;
-    uint32_t convNum;
+    uint32_t aliasIndex, convNum;
     UErrorCode myErr = U_ZERO_ERROR;
     uint32_t tagNum = getTagNumber(standard);
+    char strippedName[UCNV_MAX_CONVERTER_NAME_LENGTH];
+    const char *normalizedAlias = normalizeAlias(alias, strippedName);
 
     /* Make a quick guess. Hopefully they used a TR22 canonical alias. */
-    convNum = findConverter(alias, NULL, &myErr);
+    aliasIndex = findAlias(alias, &myErr);
+    convNum = aliasIndex == UINT32_MAX ? UINT32_MAX : getAliasConverter(aliasIndex, NULL, &myErr);
     if (myErr != U_ZERO_ERROR) {
         *pErrorCode = myErr;
     }
@@ -663,12 +886,22 @@ findTaggedAliasListsOffset(const char *alias, const char *standard, UErrorCode *
         if (myErr == U_AMBIGUOUS_ALIAS_WARNING) {
             /* Uh Oh! They used an ambiguous alias.
                We have to search the whole swiss cheese starting
-               at the highest standard affinity.
-               This may take a while.
+               at the highest standard affinity,
+               unless we know which converters list this alias.
             */
+            const uint16_t *converters = getAmbiguousAliasConverters(aliasIndex);
+            if (converters != NULL) {
+                for (; *converters != UINT16_MAX; ++converters) {
+                    uint32_t tempListOffset = gMainTable.taggedAliasArray[tagNum*gMainTable.converterListSize + *converters];
+                    if (tempListOffset && gMainTable.taggedAliasLists[tempListOffset + 1]) {
+                        return tempListOffset;
+                    }
+                }
+                return 0;
+            }
             for (idx = 0; idx < gMainTable.taggedAliasArraySize; idx++) {
                 listOffset = gMainTable.taggedAliasArray[idx];
-                if (listOffset && isAliasInList(alias, listOffset)) {
+                if (listOffset && isAliasInList(alias, normalizedAlias, listOffset)) {
                     uint32_t currTagNum = idx/gMainTable.converterListSize;
                     uint32_t currConvNum = (idx - currTagNum*gMainTable.converterListSize);
                     uint32_t tempListOffset = gMainTable.taggedAliasArray[tagNum*gMainTable.converterListSize + currConvNum];
@@ -696,32 +929,47 @@ static uint32_t
 findTaggedConverterNum(const char *alias, const char *standard, UErrorCode *pErrorCode) {
     uint32_t idx;
     uint32_t listOffset;
-    uint32_t convNum;
+    uint32_t aliasIndex, convNum;
     UErrorCode myErr = U_ZERO_ERROR;
     uint32_t tagNum = getTagNumber(standard);
+    char strippedName[UCNV_MAX_CONVERTER_NAME_LENGTH];
+    const char *normalizedAlias = normalizeAlias(alias, strippedName);
 
     /* Make a quick guess. Hopefully they used a TR22 canonical alias. */
-    convNum = findConverter(alias, NULL, &myErr);
+    aliasIndex = findAlias(alias, &myErr);
+    convNum = aliasIndex == UINT32_MAX ? UINT32_MAX : getAliasConverter(aliasIndex, NULL, &myErr);
     if (myErr != U_ZERO_ERROR) {
         *pErrorCode = myErr;
     }
 
     if (tagNum < (gMainTable.tagListSize - UCNV_NUM_HIDDEN_TAGS) && convNum < gMainTable.converterListSize) {
         listOffset = gMainTable.taggedAliasArray[tagNum*gMainTable.converterListSize + convNum];
-        if (listOffset && isAliasInList(alias, listOffset)) {
+        if (listOffset && isAliasInList(alias, normalizedAlias, listOffset)) {
             return convNum;
         }
         if (myErr == U_AMBIGUOUS_ALIAS_WARNING) {
             /* Uh Oh! They used an ambiguous alias.
                We have to search one slice of the swiss cheese.
-               We search only in the requested tag, not the whole thing.
+               We search only in the requested tag, not the whole thing,
+               and only the converters that list this alias if we know them.
                This may take a while.
             */
+            const uint16_t *converters = getAmbiguousAliasConverters(aliasIndex);
+            if (converters != NULL) {
+                uint32_t minConvNum = UINT32_MAX;
+                for (; *converters != UINT16_MAX; ++converters) {
+                    listOffset = gMainTable.taggedAliasArray[tagNum*gMainTable.converterListSize + *converters];
+                    if (*converters < minConvNum && listOffset && isAliasInList(alias, normalizedAlias, listOffset)) {
+                        minConvNum = *converters;
+                    }
+                }
+                return minConvNum;
+            }
             uint32_t convStart = (tagNum)*gMainTable.converterListSize;
             uint32_t convLimit = (tagNum+1)*gMainTable.converterListSize;
             for (idx = convStart; idx < convLimit; idx++) {
                 listOffset = gMainTable.taggedAliasArray[idx];
-                if (listOffset && isAliasInList(alias, listOffset)) {
+                if (listOffset && isAliasInList(alias, normalizedAlias, listOffset)) {
                     return idx-convStart;
                 }
             }
@@ -32,6 +32,7 @@
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "cmemory.h"
+#include "uasciirun.h"
 #include "ustr_imp.h"
 
 /* Prototypes --------------------------------------------------------------- */
@@ -94,6 +95,15 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8 (UConverterToUnicodeArgs * args,
         if (U8_IS_SINGLE(ch))        /* Simple case */
         {
             *(myTarget++) = (UChar) ch;
+
+            /* copy the run of ASCII bytes that follows */
+            int32_t length = (int32_t)(sourceLimit - mySource);
+            if (length > (int32_t)(targetLimit - myTarget)) {
+                length = (int32_t)(targetLimit - myTarget);
+            }
+            length = uprv_asciiToUChars(mySource, length, myTarget);
+            mySource += length;
+            myTarget += length;
         }
         else
         {
@@ -212,6 +222,19 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8_OFFSETS_LOGIC (UConverterToUnicodeAr
         {
             *(myTarget++) = (UChar) ch;
             *(myOffsets++) = offsetNum++;
+
+            /* copy the run of ASCII bytes that follows */
+            int32_t length = (int32_t)(sourceLimit - mySource);
+            if (length > (int32_t)(targetLimit - myTarget)) {
+                length = (int32_t)(targetLimit - myTarget);
+            }
+            length = uprv_asciiToUChars(mySource, length, myTarget);
+            mySource += length;
+            myTarget += length;
+            while (length > 0) {
+                *(myOffsets++) = offsetNum++;
+                --length;
+            }
         }
         else
         {
@@ -325,6 +348,15 @@ U_CFUNC void  U_CALLCONV ucnv_fromUnicode_UTF8 (UConverterFromUnicodeArgs * args
         if (ch < 0x80)        /* Single byte */
         {
             *(myTarget++) = (uint8_t) ch;
+
+            /* copy the run of ASCII characters that follows */
+            int32_t length = (int32_t)(sourceLimit - mySource);
+            if (length > (int32_t)(targetLimit - myTarget)) {
+                length = (int32_t)(targetLimit - myTarget);
+            }
+            length = uprv_uCharsToLatin1(mySource, length, myTarget, 0x7f);
+            mySource += length;
+            myTarget += length;
         }
         else if (ch < 0x800)  /* Double byte */
         {
@@ -446,6 +478,19 @@ U_CFUNC void  U_CALLCONV ucnv_fromUnicode_UTF8_OFFSETS_LOGIC (UConverterFromUnic
         {
             *(myOffsets++) = offsetNum++;
             *(myTarget++) = (char) ch;
+
+            /* copy the run of ASCII characters that follows */
+            int32_t length = (int32_t)(sourceLimit - mySource);
+            if (length > (int32_t)(targetLimit - myTarget)) {
+                length = (int32_t)(targetLimit - myTarget);
+            }
+            length = uprv_uCharsToLatin1(mySource, length, myTarget, 0x7f);
+            mySource += length;
+            myTarget += length;
+            while (length > 0) {
+                *(myOffsets++) = offsetNum++;
+                --length;
+            }
         }
         else if (ch < 0x800)  /* Double byte */
         {
@@ -723,9 +768,13 @@ ucnv_UTF8FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     while(count>0) {
         b=*source++;
         if(U8_IS_SINGLE(b)) {
-            /* convert ASCII */
+            /* convert ASCII, and the run of ASCII bytes that follows it */
             *target++=b;
             --count;
+            int32_t length=uprv_copyASCII(source, count, target);
+            source+=length;
+            target+=length;
+            count-=length;
             continue;
         } else {
             if(b>=0xe0) {
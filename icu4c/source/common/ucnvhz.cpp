@@ -152,6 +152,64 @@ _HZReset(UConverter *cnv, UConverterResetChoice choice){
 */
 
 
+/*
+ * Fast path for HZ toUnicode outside of a '~' escape and between GB characters:
+ * Converts a run of ASCII characters up to the next '~' or byte 80..FF,
+ * or a run of GB characters up to the next pair of bytes that is not
+ * 21..7D 21..7E or does not map directly to a BMP code point,
+ * or up to the end of the source or the target limit.
+ * Returns TRUE if it converted at least one character.
+ */
+static UBool
+toUnicodeRun_HZ(UConverterToUnicodeArgs *args, UConverterDataHZ *myData,
+                const char **pSource, UChar **pTarget) {
+    const uint8_t *source=(const uint8_t *)*pSource;
+    const uint8_t *sourceLimit=(const uint8_t *)args->sourceLimit;
+    UChar *target=*pTarget;
+    const UChar *targetLimit=args->targetLimit;
+    int32_t *offsets=args->offsets;
+
+    if(args->converter->mode == UCNV_TILDE || args->converter->toUnicodeStatus != 0) {
+        return FALSE;
+    }
+    if(myData->isStateDBCS) {
+        const UConverterSharedData *sharedData=myData->gbConverter->sharedData;
+        uint8_t bytes[2];
+        UChar c;
+        while((sourceLimit-source)>=2 && target<targetLimit &&
+                (uint8_t)(source[0] - 0x21) <= (0x7d - 0x21) &&
+                (uint8_t)(source[1] - 0x21) <= (0x7e - 0x21)) {
+            bytes[0]=(uint8_t)(source[0]+0x80);
+            bytes[1]=(uint8_t)(source[1]+0x80);
+            if((c=_MBCSSimpleGetNextBMP(&sharedData->mbcs, bytes, 2))==0xfffe) {
+                break;
+            }
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=c;
+            source+=2;
+        }
+    } else {
+        uint8_t b;
+        while(source<sourceLimit && target<targetLimit && (b=*source)<=0x7f && b!=UCNV_TILDE) {
+            if(offsets!=NULL) {
+                offsets[target-args->target]=(int32_t)((const char *)source-args->source);
+            }
+            *target++=b;
+            ++source;
+        }
+    }
+
+    if(target==*pTarget) {
+        return FALSE;
+    }
+    myData->isEmptySegment=FALSE;
+    *pSource=(const char *)source;
+    *pTarget=target;
+    return TRUE;
+}
+
 static void  U_CALLCONV
 UConverter_toUnicode_HZ_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
                                                             UErrorCode* err){
@@ -172,7 +230,11 @@ UConverter_toUnicode_HZ_OFFSETS_LOGIC(UConverterToUnicodeArgs *args,
     }*/
     
     while(mySource< mySourceLimit){
-        
+
+        if(toUnicodeRun_HZ(args, myData, &mySource, &myTarget)) {
+            continue;
+        }
+
         if(myTarget < args->targetLimit){
             
             mySourceChar= (unsigned char) *mySource++;
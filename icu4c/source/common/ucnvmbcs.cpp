@@ -58,6 +58,7 @@
 #include "ucnv_cnv.h"
 #include "cmemory.h"
 #include "cstring.h"
+#include "uasciirun.h"
 #include "umutex.h"
 #include "ustr_imp.h"
 
@@ -406,6 +407,70 @@ static const char* U_CALLCONV
 ucnv_MBCSGetName(const UConverter *cnv);
 U_CDECL_END
 
+/*
+ * This is an internal function for ucnv_convertParallel()
+ * to check whether toUnicode conversion can be split at all.
+ * Every character and every illegal sequence must end in the initial state 0,
+ * so that the text after a split is converted in the state
+ * that serial conversion would be in.
+ * This is never the case for SI/SO-stateful and DBCS-only converters.
+ */
+U_CFUNC UBool
+ucnv_MBCSCanSplitToUnicode(const UConverterSharedData *sharedData) {
+    const UConverterMBCSTable *mbcsTable=&sharedData->mbcs;
+    int32_t entry;
+    uint8_t state;
+    int32_t b;
+
+    if((mbcsTable->outputType&0xff)==MBCS_OUTPUT_2_SISO || mbcsTable->dbcsOnlyState!=0) {
+        return FALSE;
+    }
+
+    for(state=0; state<mbcsTable->countStates; ++state) {
+        for(b=0; b<=0xff; ++b) {
+            entry=mbcsTable->stateTable[state][b];
+            if(MBCS_ENTRY_IS_FINAL(entry) && MBCS_ENTRY_FINAL_STATE(entry)!=0) {
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+/*
+ * This is an internal function for ucnv_convertParallel()
+ * to check whether toUnicode conversion can be split after a byte.
+ * This is the case if the byte is a valid single-byte character in the initial state
+ * and never a trail byte, and it does not start a multi-byte extension mapping.
+ * Requires ucnv_MBCSCanSplitToUnicode().
+ * The caller must also check that the byte does not continue
+ * a multi-byte extension mapping that started before it.
+ */
+U_CFUNC UBool
+ucnv_MBCSIsSplitAfterByte(const UConverterSharedData *sharedData, uint8_t b) {
+    const UConverterMBCSTable *mbcsTable=&sharedData->mbcs;
+    int32_t entry;
+    uint8_t action, state;
+
+    entry=mbcsTable->stateTable[0][b];
+    if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+        return FALSE;
+    }
+    action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+    if(action==MBCS_STATE_ILLEGAL || action==MBCS_STATE_CHANGE_ONLY) {
+        return FALSE;
+    }
+
+    for(state=1; state<mbcsTable->countStates; ++state) {
+        entry=mbcsTable->stateTable[state][b];
+        if(MBCS_ENTRY_IS_TRANSITION(entry) || MBCS_ENTRY_FINAL_ACTION(entry)!=MBCS_STATE_ILLEGAL) {
+            return FALSE;   /* b can be a trail byte */
+        }
+    }
+
+    return !ucnv_extIsPartialMatchToU(mbcsTable->extIndexes, (const char *)&b, 1);
+}
+
 static void U_CALLCONV
 ucnv_MBCSWriteSub(UConverterFromUnicodeArgs *pArgs,
               int32_t offsetIndex,
@@ -431,6 +496,16 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode);
+
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,7 +528,7 @@ static const UConverterImpl _SBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_SBCSFromUTF8
 };
 
@@ -479,7 +554,7 @@ static const UConverterImpl _DBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_DBCSFromUTF8
 };
 
@@ -504,8 +579,9 @@ static const UConverterImpl _MBCSImpl={
     ucnv_MBCSWriteSub,
     NULL,
     ucnv_MBCSGetUnicodeSet,
-    NULL,
-    NULL
+
+    ucnv_MBCSToUTF8,
+    ucnv_MBCSFromUTF8
 };
 
 /* Static data is in tools/makeconv/ucnvstat.c for data-based
@@ -533,28 +609,122 @@ const UConverterSharedData _MBCSData={
  * GB four-byte sequences are contiguous and are handled algorithmically by
  * the special callback functions below.
  * The values are start & end of Unicode & GB codes.
+ * The ranges are sorted by code points, which is also the order of their GB codes.
  *
  * Note that single surrogates are not mapped by GB 18030
  * as of the re-released mapping tables from 2000-nov-30.
  */
 static const uint32_t
 gb18030Ranges[14][4]={
-    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)},
-    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
     {0x0452, 0x1E3E, LINEAR(0x8130D330), LINEAR(0x8135F436)},
     {0x1E40, 0x200F, LINEAR(0x8135F438), LINEAR(0x8136A531)},
-    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
     {0x2643, 0x2E80, LINEAR(0x8137A839), LINEAR(0x8138FD38)},
-    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
-    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x361B, 0x3917, LINEAR(0x8230A633), LINEAR(0x8230F237)},
-    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x3CE1, 0x4055, LINEAR(0x8231D438), LINEAR(0x8232AF32)},
     {0x4160, 0x4336, LINEAR(0x8232C937), LINEAR(0x8232F837)},
-    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
     {0x44D7, 0x464B, LINEAR(0x8233A339), LINEAR(0x8233C931)},
-    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)}
+    {0x478E, 0x4946, LINEAR(0x8233E838), LINEAR(0x82349638)},
+    {0x49B8, 0x4C76, LINEAR(0x8234A131), LINEAR(0x8234E733)},
+    {0x9FA6, 0xD7FF, LINEAR(0x82358F33), LINEAR(0x8336C738)},
+    {0xE865, 0xF92B, LINEAR(0x8336D030), LINEAR(0x84308534)},
+    {0xFA2A, 0xFE2F, LINEAR(0x84309C38), LINEAR(0x84318537)},
+    {0xFFE6, 0xFFFF, LINEAR(0x8431A234), LINEAR(0x8431A439)},
+    {0x10000, 0x10FFFF, LINEAR(0x90308130), LINEAR(0xE3329A35)}
+};
+
+/* index of the supplementary range in gb18030Ranges[] */
+#define GB18030_SUPPLEMENTARY_RANGE 13
+
+/*
+ * Direct index for gb18030Ranges[] from BMP code points:
+ * For each block of 256 code points, the index of the first range
+ * that ends at or after the start of the block.
+ * A block overlaps at most two ranges.
+ */
+static const uint8_t
+gb18030FromUIndex[0x100]={
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+     1,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  3,
+     3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  4,  4,  4,  4,  4,  4,
+     4,  5,  5,  5,  6,  6,  6,  7,  7,  7,  8,  8,  8,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 12
+};
+
+/*
+ * Direct index for gb18030Ranges[] from the linear values of BMP four-byte sequences,
+ * relative to LINEAR_18030_BASE: The same as gb18030FromUIndex[] for blocks of 256 values.
+ */
+static const uint8_t
+gb18030ToUIndex[154]={
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  3,  3,  3,
+     3,  3,  3,  3,  3,  3,  4,  4,  4,  4,  4,  4,  4,  5,  5,  5,
+     6,  6,  6,  7,  7,  7,  8,  8,  8,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+     9,  9,  9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 11, 11, 11, 11, 12
 };
 
+/*
+ * @return the gb18030Ranges[] entry that contains the code point c, or NULL
+ */
+static inline const uint32_t *
+gb18030RangeFromU(UChar32 c) {
+    const uint32_t *range;
+    int32_t i;
+
+    i= c<=0xffff ? gb18030FromUIndex[c>>8] : GB18030_SUPPLEMENTARY_RANGE;
+    for(; i<UPRV_LENGTHOF(gb18030Ranges); ++i) {
+        range=gb18030Ranges[i];
+        if((uint32_t)c<range[0]) {
+            break;
+        } else if((uint32_t)c<=range[1]) {
+            return range;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * @return the gb18030Ranges[] entry that contains the linear value of a four-byte sequence, or NULL
+ */
+static inline const uint32_t *
+gb18030RangeToU(uint32_t linear) {
+    const uint32_t *range;
+    uint32_t block;
+    int32_t i;
+
+    block=(linear-LINEAR_18030_BASE)>>8;
+    if(block<UPRV_LENGTHOF(gb18030ToUIndex)) {
+        i=gb18030ToUIndex[block];
+    } else {
+        i=GB18030_SUPPLEMENTARY_RANGE;
+    }
+    for(; i<UPRV_LENGTHOF(gb18030Ranges); ++i) {
+        range=gb18030Ranges[i];
+        if(linear<range[2]) {
+            break;
+        } else if(linear<=range[3]) {
+            return range;
+        }
+    }
+    return NULL;
+}
+
 /* bit flag for UConverter.options indicating GB 18030 special handling */
 #define _MBCS_OPTION_GB18030 0x8000
 
@@ -1095,9 +1265,67 @@ ucnv_MBCSGetUnicodeSet(const UConverter *cnv,
  *
  * If an input character cannot be mapped, then these functions set an error
  * code. The framework will then call the callback function.
+ * Exception: With the standard substitute or skip callback,
+ * _extFromU() handles an unmappable code point itself; see _fromUSubOrSkip().
  */
 
+static void
+_writeSub(UConverter *cnv,
+          char **target, const char *targetLimit,
+          int32_t **offsets, int32_t sourceIndex,
+          UErrorCode *pErrorCode);
+
+/*
+ * Handles an unmappable code point inside the conversion loop
+ * if the converter uses the default UCNV_FROM_U_CALLBACK_SUBSTITUTE or
+ * UCNV_FROM_U_CALLBACK_SKIP, with a context that stops only on illegal input.
+ * Returning to the framework for each unmappable code point is expensive
+ * when the input has many of them.
+ * The result is the same as from the framework calling the callback:
+ * The substitution bytes are written with ucnv_MBCSWriteSub()'s code, or
+ * default-ignorable code points are skipped as in ucnv_err.cpp,
+ * and the code point is stored for ucnv_getInvalidUChars().
+ * A Unicode substitution string (subCharLen<0) is still left to the callback.
+ *
+ * @return TRUE if the code point was handled
+ */
+static UBool
+_fromUSubOrSkip(UConverter *cnv, UChar32 cp,
+                uint8_t **target, const uint8_t *targetLimit,
+                int32_t **offsets, int32_t sourceIndex,
+                UErrorCode *pErrorCode) {
+    const char *context=(const char *)cnv->fromUContext;
+    UBool skip;
+    int32_t length;
+
+    if(context!=NULL && *context!=*UCNV_SUB_STOP_ON_ILLEGAL) {
+        return FALSE;
+    }
+    if(cnv->fromUCharErrorBehaviour==UCNV_FROM_U_CALLBACK_SUBSTITUTE) {
+        if(cnv->subCharLen<0) {
+            return FALSE;
+        }
+        skip=(UBool)(cnv->subCharLen==0 || IS_DEFAULT_IGNORABLE_CODE_POINT(cp));
+    } else if(cnv->fromUCharErrorBehaviour==UCNV_FROM_U_CALLBACK_SKIP) {
+        skip=TRUE;
+    } else {
+        return FALSE;
+    }
+
+    length=0;
+    U16_APPEND_UNSAFE(cnv->invalidUCharBuffer, length, cp);
+    cnv->invalidUCharLength=(int8_t)length;
+
+    /* the callbacks reset the error code, which also removes warnings */
+    *pErrorCode=U_ZERO_ERROR;
+    if(!skip) {
+        _writeSub(cnv, (char **)target, (const char *)targetLimit, offsets, sourceIndex, pErrorCode);
+    }
+    return TRUE;
+}
+
 /*
+ * @param pSubOrSkip if not NULL, set to TRUE if _fromUSubOrSkip() handled cp
  * @return if(U_FAILURE) return the code point for cnv->fromUChar32
  *         else return 0 after output has been written to the target
  */
@@ -1108,7 +1336,8 @@ _extFromU(UConverter *cnv, const UConverterSharedData *sharedData,
           uint8_t **target, const uint8_t *targetLimit,
           int32_t **offsets, int32_t sourceIndex,
           UBool flush,
-          UErrorCode *pErrorCode) {
+          UErrorCode *pErrorCode,
+          UBool *pSubOrSkip=NULL) {
     const int32_t *cx;
 
     cnv->useSubChar1=FALSE;
@@ -1127,38 +1356,39 @@ _extFromU(UConverter *cnv, const UConverterSharedData *sharedData,
 
     /* GB 18030 */
     if((cnv->options&_MBCS_OPTION_GB18030)!=0) {
-        const uint32_t *range;
-        int32_t i;
-
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[0]<=(uint32_t)cp && (uint32_t)cp<=range[1]) {
-                /* found the Unicode code point, output the four-byte sequence for it */
-                uint32_t linear;
-                char bytes[4];
-
-                /* get the linear value of the first GB 18030 code in this range */
-                linear=range[2]-LINEAR_18030_BASE;
-
-                /* add the offset from the beginning of the range */
-                linear+=((uint32_t)cp-range[0]);
-
-                /* turn this into a four-byte sequence */
-                bytes[3]=(char)(0x30+linear%10); linear/=10;
-                bytes[2]=(char)(0x81+linear%126); linear/=126;
-                bytes[1]=(char)(0x30+linear%10); linear/=10;
-                bytes[0]=(char)(0x81+linear);
-
-                /* output this sequence */
-                ucnv_fromUWriteBytes(cnv,
-                                     bytes, 4, (char **)target, (char *)targetLimit,
-                                     offsets, sourceIndex, pErrorCode);
-                return 0;
-            }
+        const uint32_t *range=gb18030RangeFromU(cp);
+        if(range!=NULL) {
+            /* found the Unicode code point, output the four-byte sequence for it */
+            uint32_t linear;
+            char bytes[4];
+
+            /* get the linear value of the first GB 18030 code in this range */
+            linear=range[2]-LINEAR_18030_BASE;
+
+            /* add the offset from the beginning of the range */
+            linear+=((uint32_t)cp-range[0]);
+
+            /* turn this into a four-byte sequence */
+            bytes[3]=(char)(0x30+linear%10); linear/=10;
+            bytes[2]=(char)(0x81+linear%126); linear/=126;
+            bytes[1]=(char)(0x30+linear%10); linear/=10;
+            bytes[0]=(char)(0x81+linear);
+
+            /* output this sequence */
+            ucnv_fromUWriteBytes(cnv,
+                                 bytes, 4, (char **)target, (char *)targetLimit,
+                                 offsets, sourceIndex, pErrorCode);
+            return 0;
         }
     }
 
     /* no mapping */
+    if(_fromUSubOrSkip(cnv, cp, target, targetLimit, offsets, sourceIndex, pErrorCode)) {
+        if(pSubOrSkip!=NULL) {
+            *pSubOrSkip=TRUE;
+        }
+        return 0; /* substituted or skipped, or U_BUFFER_OVERFLOW_ERROR */
+    }
     *pErrorCode=U_INVALID_CHAR_FOUND;
     return cp;
 }
@@ -1194,23 +1424,20 @@ _extToU(UConverter *cnv, const UConverterSharedData *sharedData,
     if(length==4 && (cnv->options&_MBCS_OPTION_GB18030)!=0) {
         const uint32_t *range;
         uint32_t linear;
-        int32_t i;
 
         linear=LINEAR_18030(cnv->toUBytes[0], cnv->toUBytes[1], cnv->toUBytes[2], cnv->toUBytes[3]);
-        range=gb18030Ranges[0];
-        for(i=0; i<UPRV_LENGTHOF(gb18030Ranges); range+=4, ++i) {
-            if(range[2]<=linear && linear<=range[3]) {
-                /* found the sequence, output the Unicode code point for it */
-                *pErrorCode=U_ZERO_ERROR;
+        range=gb18030RangeToU(linear);
+        if(range!=NULL) {
+            /* found the sequence, output the Unicode code point for it */
+            *pErrorCode=U_ZERO_ERROR;
 
-                /* add the linear difference between the input and start sequences to the start code point */
-                linear=range[0]+(linear-range[2]);
+            /* add the linear difference between the input and start sequences to the start code point */
+            linear=range[0]+(linear-range[2]);
 
-                /* output this code point */
-                ucnv_toUWriteCodePoint(cnv, linear, target, targetLimit, offsets, sourceIndex, pErrorCode);
+            /* output this code point */
+            ucnv_toUWriteCodePoint(cnv, linear, target, targetLimit, offsets, sourceIndex, pErrorCode);
 
-                return 0;
-            }
+            return 0;
         }
     }
 
@@ -2196,6 +2423,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t entry;
     uint8_t action;
+    UBool asciiRuns;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -2215,6 +2443,10 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     sourceIndex=0;
     lastSource=source;
 
+    /* ASCII bytes map to themselves: copy runs of them in blocks */
+    asciiRuns=(UBool)(cnv->sharedData->mbcs.asciiRoundtrips==0xffffffff &&
+                      stateTable==cnv->sharedData->mbcs.stateTable);
+
     /*
      * since the conversion here is 1:1 UChar:uint8_t, we need only one counter
      * for the minimum of the sourceLength and targetCapacity
@@ -2228,6 +2460,13 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     /* unrolling makes it faster on Pentium III/Windows 2000 */
     /* unroll the loop with the most common case */
 unrolled:
+    if(asciiRuns) {
+        /* offsets for these are set together with the following ones */
+        length=uprv_asciiToUChars(source, targetCapacity, target);
+        source+=length;
+        target+=length;
+        targetCapacity-=length;
+    }
     if(targetCapacity>=16) {
         int32_t count, loops, oredEntries;
 
@@ -3940,6 +4179,13 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             *target++=(uint8_t)c;
             --targetCapacity;
             c=0;
+            if(asciiRoundtrips==0xffffffff) {
+                /* copy the run of ASCII characters that follows */
+                length=uprv_uCharsToLatin1(source, targetCapacity, target, 0x7f);
+                source+=length;
+                target+=length;
+                targetCapacity-=length;
+            }
             continue;
         }
         value=MBCS_SINGLE_RESULT_FROM_U(table, results, c);
@@ -4044,9 +4290,10 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
     /* set offsets since the start or the last callback */
     if(offsets!=NULL) {
         size_t count=source-lastSource;
-        if (count > 0 && *pErrorCode == U_TRUNCATED_CHAR_FOUND) {
+        if (count > 0 &&
+                (*pErrorCode == U_TRUNCATED_CHAR_FOUND || *pErrorCode == U_ILLEGAL_CHAR_FOUND)) {
             /*
-            Caller gave us a partial supplementary character,
+            Caller gave us a partial supplementary character or an unpaired surrogate,
             which this function couldn't convert in any case.
             The callback will handle the offset.
             */
@@ -4608,13 +4855,14 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
 unassigned:
                     /* try an extension mapping */
+                    UBool subOrSkip=FALSE;
                     pArgs->source=source;
                     c=_extFromU(cnv, cnv->sharedData,
                                 c, &source, sourceLimit,
                                 &target, target+targetCapacity,
                                 &offsets, sourceIndex,
                                 pArgs->flush,
-                                pErrorCode);
+                                pErrorCode, &subOrSkip);
                     nextSourceIndex+=(int32_t)(source-pArgs->source);
                     prevLength=cnv->fromUnicodeStatus; /* restore SISO state */
 
@@ -4629,7 +4877,11 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
                         /* normal end of conversion: prepare for a new character */
                         if(offsets!=NULL) {
-                            prevSourceIndex=sourceIndex;
+                            /*
+                             * After callback output, the framework calls this function again,
+                             * which starts with prevSourceIndex=-1 for a final SI.
+                             */
+                            prevSourceIndex= subOrSkip ? -1 : sourceIndex;
                             sourceIndex=nextSourceIndex;
                         }
                         continue;
@@ -5622,6 +5874,565 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/*
+ * Get the codepage bytes for one stage 3 result of a multi-byte fromUnicode table,
+ * with the stage 3 index i calculated either from the mbcsIndex or from stage 2.
+ * Same as in ucnv_MBCSFromUnicodeWithOffsets(), except that
+ * MBCS_OUTPUT_2_SISO results are returned without Shift-In/Shift-Out bytes.
+ *
+ * @return the number of bytes in *pValue, or 0 if the result is not used
+ *         (SBCS result for a DBCS-only table)
+ */
+static inline int32_t
+getMBCSFromUResult(uint8_t outputType, const uint8_t *bytes, uint32_t i, uint32_t *pValue) {
+    const uint8_t *p;
+    uint32_t value;
+    int32_t length;
+
+    switch(outputType) {
+    case MBCS_OUTPUT_2:
+    case MBCS_OUTPUT_2_SISO:
+        value=((const uint16_t *)bytes)[i];
+        length= value<=0xff ? 1 : 2;
+        break;
+    case MBCS_OUTPUT_DBCS_ONLY:
+        /* table with single-byte results, but only DBCS mappings used */
+        value=((const uint16_t *)bytes)[i];
+        length= value<=0xff ? 0 : 2;
+        break;
+    case MBCS_OUTPUT_3:
+        p=bytes+i*3;
+        value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else {
+            length=3;
+        }
+        break;
+    case MBCS_OUTPUT_4:
+        value=((const uint32_t *)bytes)[i];
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else if(value<=0xffffff) {
+            length=3;
+        } else {
+            length=4;
+        }
+        break;
+    case MBCS_OUTPUT_3_EUC:
+        value=((const uint16_t *)bytes)[i];
+        /* EUC 16-bit fixed-length representation */
+        if(value<=0xff) {
+            length=1;
+        } else if((value&0x8000)==0) {
+            value|=0x8e8000;
+            length=3;
+        } else if((value&0x80)==0) {
+            value|=0x8f0080;
+            length=3;
+        } else {
+            length=2;
+        }
+        break;
+    case MBCS_OUTPUT_4_EUC:
+        p=bytes+i*3;
+        value=((uint32_t)*p<<16)|((uint32_t)p[1]<<8)|p[2];
+        /* EUC 16-bit fixed-length representation applied to the first two bytes */
+        if(value<=0xff) {
+            length=1;
+        } else if(value<=0xffff) {
+            length=2;
+        } else if((value&0x800000)==0) {
+            value|=0x8e800000;
+            length=4;
+        } else if((value&0x8000)==0) {
+            value|=0x8f008000;
+            length=4;
+        } else {
+            length=3;
+        }
+        break;
+    default:
+        /* must not occur */
+        value=0;
+        length=0;
+        break;
+    }
+    *pValue=value;
+    return length;
+}
+
+/*
+ * Direct conversion from UTF-8 for all MBCS tables that do not have one of the
+ * optimized ucnv_SBCSFromUTF8() and ucnv_DBCSFromUTF8() functions:
+ * Tables that are not utf8Friendly, and stateful, DBCS-only, EUC and
+ * 3- and 4-byte tables including GB 18030.
+ *
+ * Only complete, well-formed UTF-8 sequences are converted here.
+ * For truncated and ill-formed sequences, and for partial matches of
+ * extension mappings, this function returns U_USING_DEFAULT_WARNING
+ * to revert to UTF-8->UTF-16->charset conversion for the rest of the buffer.
+ */
+static void U_CALLCONV
+ucnv_MBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit, *cpStart;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    const uint16_t *table, *mbcsIndex;
+    const uint8_t *bytes;
+    uint8_t outputType;
+
+    uint32_t asciiRoundtrips;
+    uint32_t stage2Entry;
+    uint32_t value;
+    int32_t length, prevLength;
+    UBool hasSupplementary, isAssigned;
+
+    /* Shift-In and Shift-Out byte sequences differ by encoding scheme. */
+    uint8_t siBytes[2]={ 0, 0 };
+    uint8_t soBytes[2]={ 0, 0 };
+    int32_t siLength, soLength;
+
+    UChar32 c;
+    uint8_t b;
+
+    /* set up the local pointers */
+    utf8=pToUArgs->converter;
+    cnv=pFromUArgs->converter;
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    if(utf8->toULength>0 || cnv->fromUChar32!=0) {
+        /* continue a partial character in pivoting conversion */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    outputType=cnv->sharedData->mbcs.outputType;
+    table=cnv->sharedData->mbcs.fromUnicodeTable;
+    if(cnv->sharedData->mbcs.utf8Friendly && outputType!=MBCS_OUTPUT_1) {
+        mbcsIndex=cnv->sharedData->mbcs.mbcsIndex;
+    } else {
+        mbcsIndex=NULL;
+    }
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        bytes=cnv->sharedData->mbcs.swapLFNLFromUnicodeBytes;
+    } else {
+        bytes=cnv->sharedData->mbcs.fromUnicodeBytes;
+    }
+    asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    hasSupplementary=(UBool)(cnv->sharedData->mbcs.unicodeMask&UCNV_HAS_SUPPLEMENTARY);
+
+    if(outputType==MBCS_OUTPUT_2_SISO) {
+        prevLength=cnv->fromUnicodeStatus;
+        if(prevLength==0) {
+            /* set the real value */
+            prevLength=1;
+        }
+        siLength=getSISOBytes(SI, cnv->options, siBytes);
+        soLength=getSISOBytes(SO, cnv->options, soBytes);
+    } else {
+        /* prevent fromUnicodeStatus from being set to something non-0 */
+        prevLength=0;
+        siLength=soLength=0;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity<=0) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        cpStart=source;
+        b=*source++;
+        if(U8_IS_SINGLE(b)) {
+            /* asciiRoundtrips==0 for MBCS_OUTPUT_2_SISO, which needs to check prevLength */
+            if(IS_ASCII_ROUNDTRIP(b, asciiRoundtrips)) {
+                *target++=b;
+                --targetCapacity;
+                continue;
+            }
+            c=b;
+        } else {
+            int32_t i=0;
+            U8_NEXT(cpStart, i, (int32_t)(sourceLimit-cpStart), c);
+            if(c<0) {
+                /* truncated or ill-formed sequence: handle it with pivoting */
+                source=cpStart;
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            }
+            source=cpStart+i;
+        }
+
+        /* convert the code point in c into codepage bytes */
+        if(c>0xffff && !hasSupplementary) {
+            /* BMP-only codepages are stored without stage 1 entries for supplementary code points */
+            length=0;
+            value=0;
+            isAssigned=FALSE;
+        } else if(outputType==MBCS_OUTPUT_1) {
+            value=MBCS_SINGLE_RESULT_FROM_U(table, (const uint16_t *)bytes, c);
+            isAssigned=(UBool)(cnv->useFallback ? value>=0x800 : value>=0xc00);
+            value&=0xff;
+            length=1;
+        } else if(c<=0xd7ff && mbcsIndex!=NULL) {
+            /* utf8Friendly data: there are only roundtrips (!=0) and no-mapping (==0) entries */
+            length=getMBCSFromUResult(outputType, bytes, (uint32_t)mbcsIndex[c>>6]+(c&0x3f), &value);
+            isAssigned=(UBool)(value!=0 && length>0);
+        } else {
+            stage2Entry=MBCS_STAGE_2_FROM_U(table, c);
+            length=getMBCSFromUResult(outputType, bytes, 16*(uint32_t)(uint16_t)stage2Entry+(c&0xf), &value);
+            isAssigned=(UBool)(length>0 &&
+                (MBCS_FROM_U_IS_ROUNDTRIP(stage2Entry, c) ||
+                 (UCNV_FROM_U_USE_FALLBACK(cnv, c) && value!=0)));
+        }
+
+        if(!isAssigned) {
+            /*
+             * Try an extension mapping, or a GB 18030 four-byte range.
+             * Pass in no source because we don't have UTF-16 input.
+             * If we have a partial match on c, we will return and revert
+             * to UTF-8->UTF-16->charset conversion.
+             */
+            static const UChar nul=0;
+            const UChar *noSource=&nul;
+            cnv->fromUnicodeStatus=prevLength; /* for SI/SO-stateful extension output */
+            c=_extFromU(cnv, cnv->sharedData,
+                        c, &noSource, noSource,
+                        &target, target+targetCapacity,
+                        NULL, -1,
+                        pFromUArgs->flush,
+                        pErrorCode);
+            prevLength=cnv->fromUnicodeStatus;
+
+            if(U_FAILURE(*pErrorCode)) {
+                /* not mappable or buffer overflow */
+                cnv->fromUChar32=c;
+                break;
+            } else if(cnv->preFromUFirstCP>=0) {
+                /*
+                 * Partial match, return and revert to pivoting.
+                 * In normal from-UTF-16 conversion, we would just continue
+                 * but then exit the loop because the extension match would
+                 * have consumed the source.
+                 */
+                *pErrorCode=U_USING_DEFAULT_WARNING;
+                break;
+            } else {
+                /* a mapping was written to the target, continue */
+
+                /* recalculate the targetCapacity after an extension mapping */
+                targetCapacity=(int32_t)(pFromUArgs->targetLimit-(char *)target);
+                continue;
+            }
+        }
+
+        if(outputType==MBCS_OUTPUT_2_SISO) {
+            /* add a Shift-In or Shift-Out if the character changes the state */
+            if(length==1) {
+                if(prevLength==2) {
+                    if(siLength==1) {
+                        value|=(uint32_t)siBytes[0]<<8;
+                    } else {
+                        value|=((uint32_t)siBytes[0]<<16)|((uint32_t)siBytes[1]<<8);
+                    }
+                    length+=siLength;
+                    prevLength=1;
+                }
+            } else {
+                if(prevLength==1) {
+                    if(soLength==1) {
+                        value|=(uint32_t)soBytes[0]<<16;
+                    } else {
+                        value|=((uint32_t)soBytes[0]<<24)|((uint32_t)soBytes[1]<<16);
+                    }
+                    length+=soLength;
+                    prevLength=2;
+                }
+            }
+        }
+
+        /* write the output character bytes from value and length */
+        if(length<=targetCapacity) {
+            switch(length) {
+                /* each branch falls through to the next one */
+            case 4:
+                *target++=(uint8_t)(value>>24);
+                U_FALLTHROUGH;
+            case 3:
+                *target++=(uint8_t)(value>>16);
+                U_FALLTHROUGH;
+            case 2:
+                *target++=(uint8_t)(value>>8);
+                U_FALLTHROUGH;
+            case 1:
+                *target++=(uint8_t)value;
+                U_FALLTHROUGH;
+            default:
+                /* will never occur */
+                break;
+            }
+            targetCapacity-=length;
+        } else {
+            /* output what fits into the target, and the rest into the overflow buffer */
+            uint8_t *charErrorBuffer=(uint8_t *)cnv->charErrorBuffer;
+            int32_t i;
+            for(i=length-1; i>=0; --i) {
+                b=(uint8_t)(value>>(8*i));
+                if(targetCapacity>0) {
+                    *target++=b;
+                    --targetCapacity;
+                } else {
+                    *charErrorBuffer++=b;
+                }
+            }
+            cnv->charErrorBufferLength=(int8_t)(charErrorBuffer-(uint8_t *)cnv->charErrorBuffer);
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+    }
+
+    /*
+     * For EBCDIC_STATEFUL conversion we need to emit an SI at the very end,
+     * as in ucnv_MBCSFromUnicodeWithOffsets(). When the direct conversion
+     * consumes all of the input, the framework does not call that function.
+     */
+    if( *pErrorCode==U_ZERO_ERROR &&
+        outputType==MBCS_OUTPUT_2_SISO && prevLength==2 &&
+        pToUArgs->flush && source>=sourceLimit
+    ) {
+        int32_t i;
+        for(i=0; i<siLength; ++i) {
+            if(targetCapacity>0) {
+                *target++=siBytes[i];
+                --targetCapacity;
+            } else {
+                cnv->charErrorBuffer[cnv->charErrorBufferLength++]=siBytes[i];
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            }
+        }
+        prevLength=1; /* we switched into SBCS */
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->fromUnicodeStatus=prevLength;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
+/* MBCS-to-UTF-8 conversion functions --------------------------------------- */
+
+/*
+ * Direct conversion to UTF-8 for all MBCS tables, using the toUnicode state table.
+ *
+ * Roundtrip and fallback mappings from the base table, state changes
+ * (e.g., Shift-In/Shift-Out) and GB 18030 four-byte ranges are handled here.
+ * For unassigned and illegal sequences, and for sequences that are truncated
+ * at the end of the input, this function returns U_USING_DEFAULT_WARNING
+ * to revert to charset->UTF-16->UTF-8 conversion, with the source pointing to
+ * the start of the sequence. Pivoting handles extension mappings and callbacks.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *utf8, *cnv;
+    const uint8_t *source, *sourceLimit, *cpStart;
+    uint8_t *target;
+    int32_t targetCapacity;
+
+    const int32_t (*stateTable)[256];
+    const uint16_t *unicodeCodeUnits;
+
+    uint32_t offset;
+    uint8_t state, nextState, action;
+    int32_t entry;
+    UChar32 c;
+
+    /* set up the local pointers */
+    cnv=pToUArgs->converter;
+    utf8=pFromUArgs->converter;
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetCapacity=(int32_t)(pFromUArgs->targetLimit-pFromUArgs->target);
+
+    if(cnv->toULength>0 || utf8->fromUChar32!=0) {
+        /* continue a partial character in pivoting conversion */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+
+    /*
+     * if we are in the SBCS state for a DBCS-only converter,
+     * then load the DBCS state from the MBCS data
+     * (dbcsOnlyState==0 if it is not a DBCS-only converter)
+     */
+    if((state=(uint8_t)(cnv->mode))==0) {
+        state=cnv->sharedData->mbcs.dbcsOnlyState;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(targetCapacity<=0) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        entry=stateTable[state][*source++];
+        if(MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry) && (c=MBCS_ENTRY_FINAL_VALUE_16(entry))<=0x7f) {
+            /* single byte to ASCII */
+            *target++=(uint8_t)c;
+            --targetCapacity;
+            state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+            continue;
+        }
+
+        /* collect the bytes of a multi-byte sequence */
+        cpStart=source-1;
+        nextState=state;
+        offset=0;
+        while(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            if(source>=sourceLimit) {
+                break;
+            }
+            nextState=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+            offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            entry=stateTable[nextState][*source++];
+        }
+        if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            /* truncated sequence: handle it with pivoting */
+            source=cpStart;
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+
+        /*
+         * Same as in ucnv_MBCSToUnicodeWithOffsets(),
+         * except that c<0 reverts to pivoting.
+         */
+        action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+        if(action==MBCS_STATE_VALID_DIRECT_16 ||
+           (action==MBCS_STATE_FALLBACK_DIRECT_16 && UCNV_TO_U_USE_FALLBACK(cnv))
+        ) {
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+        } else if(action==MBCS_STATE_VALID_16) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset];
+            if(c==0xfffe && UCNV_TO_U_USE_FALLBACK(cnv)) {
+                c=ucnv_MBCSGetFallback(&cnv->sharedData->mbcs, offset);
+            }
+            if(c>=0xfffe) {
+                c=-1;
+            }
+        } else if(action==MBCS_STATE_VALID_16_PAIR) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset++];
+            if(c<0xd800) {
+                /* BMP code point below 0xd800 */
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? c<=0xdfff : c<=0xdbff) {
+                /* roundtrip or fallback surrogate pair */
+                c=U16_GET_SUPPLEMENTARY(c&0xdbff, unicodeCodeUnits[offset]);
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? (c&0xfffe)==0xe000 : c==0xe000) {
+                /* roundtrip BMP code point above 0xd800 or fallback BMP code point */
+                c=unicodeCodeUnits[offset];
+            } else {
+                c=-1;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_20 ||
+                  (action==MBCS_STATE_FALLBACK_DIRECT_20 && UCNV_TO_U_USE_FALLBACK(cnv))
+        ) {
+            c=MBCS_ENTRY_FINAL_VALUE(entry)+0x10000;
+        } else if(action==MBCS_STATE_CHANGE_ONLY && cnv->sharedData->mbcs.dbcsOnlyState==0) {
+            /* state change without any output, e.g., Shift-In/Shift-Out */
+            state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry);
+            continue;
+        } else if(action==MBCS_STATE_UNASSIGNED &&
+                  (source-cpStart)==4 && (cnv->options&_MBCS_OPTION_GB18030)!=0
+        ) {
+            /*
+             * GB 18030 four-byte range, as in _extToU().
+             * Check the extension data first, which has precedence over the ranges.
+             */
+            const int32_t *cx=cnv->sharedData->mbcs.extIndexes;
+            c=-1;
+            if(cx==NULL || ucnv_extSimpleMatchToU(cx, (const char *)cpStart, 4, TRUE)==0xfffe) {
+                uint32_t linear=LINEAR_18030(cpStart[0], cpStart[1], cpStart[2], cpStart[3]);
+                const uint32_t *range=gb18030RangeToU(linear);
+                if(range!=NULL) {
+                    /* add the linear difference between the input and start sequences to the start code point */
+                    c=(UChar32)(range[0]+(linear-range[2]));
+                }
+            }
+        } else {
+            /* unassigned, illegal, or reserved */
+            c=-1;
+        }
+
+        if(c<0 || U_IS_SURROGATE(c)) {
+            /* handle this sequence with pivoting, for extension mappings and callbacks */
+            source=cpStart;
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+
+        /* output the code point as UTF-8 */
+        if(targetCapacity>=U8_MAX_LENGTH) {
+            int32_t i=0;
+            U8_APPEND_UNSAFE(target, i, c);
+            target+=i;
+            targetCapacity-=i;
+        } else {
+            uint8_t u8[U8_MAX_LENGTH];
+            int32_t i, length=0;
+            U8_APPEND_UNSAFE(u8, length, c);
+            for(i=0; i<length && targetCapacity>0; ++i) {
+                *target++=u8[i];
+                --targetCapacity;
+            }
+            if(i<length) {
+                /* output the rest into the UTF-8 converter's overflow buffer */
+                uprv_memcpy(utf8->charErrorBuffer, u8+i, length-i);
+                utf8->charErrorBufferLength=(int8_t)(length-i);
+                *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+                state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry);
+                break;
+            }
+        }
+        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->mode=state;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
@@ -5651,7 +6462,18 @@ static void U_CALLCONV
 ucnv_MBCSWriteSub(UConverterFromUnicodeArgs *pArgs,
               int32_t offsetIndex,
               UErrorCode *pErrorCode) {
-    UConverter *cnv=pArgs->converter;
+    _writeSub(pArgs->converter,
+              &pArgs->target, pArgs->targetLimit,
+              &pArgs->offsets, offsetIndex,
+              pErrorCode);
+}
+
+/* also called by _fromUSubOrSkip() from within the conversion loops */
+static void
+_writeSub(UConverter *cnv,
+          char **target, const char *targetLimit,
+          int32_t **offsets, int32_t sourceIndex,
+          UErrorCode *pErrorCode) {
     char *p, *subchar;
     char buffer[4];
     int32_t length;
@@ -5704,7 +6526,7 @@ ucnv_MBCSWriteSub(UConverterFromUnicodeArgs *pArgs,
         length=(int32_t)(p-buffer);
     }
 
-    ucnv_cbFromUWriteBytes(pArgs, subchar, length, offsetIndex, pErrorCode);
+    ucnv_fromUWriteBytes(cnv, subchar, length, target, targetLimit, offsets, sourceIndex, pErrorCode);
 }
 
 U_CFUNC UConverterType
@@ -515,6 +515,41 @@ ucnv_MBCSSingleSimpleGetNextUChar(UConverterSharedData *sharedData,
 #define _MBCS_SINGLE_SIMPLE_GET_NEXT_BMP(sharedData, b) \
     (UChar)MBCS_ENTRY_FINAL_VALUE_16((sharedData)->mbcs.stateTable[0][(uint8_t)(b)])
 
+/**
+ * Inline version of ucnv_MBCSSimpleGetNextUChar() for other converter implementations
+ * that convert runs of characters through an MBCS table, one character at a time.
+ * It only handles direct lookups of BMP code points in the state table.
+ * For anything else (unassigned, fallback, surrogate pair, extension mapping,
+ * illegal or truncated sequence) it returns 0xfffe, and the caller must
+ * call ucnv_MBCSSimpleGetNextUChar() for the same bytes.
+ * length must be at least 1.
+ */
+static inline UChar
+_MBCSSimpleGetNextBMP(const UConverterMBCSTable *mbcsTable, const uint8_t *s, int32_t length) {
+    const int32_t (*stateTable)[256]=mbcsTable->stateTable;
+    uint32_t offset=0;
+    int32_t entry=stateTable[mbcsTable->dbcsOnlyState][*s];
+    while(MBCS_ENTRY_IS_TRANSITION(entry)) {
+        if(--length==0) {
+            return 0xfffe;  /* truncated */
+        }
+        offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+        entry=stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][*++s];
+    }
+    if(length!=1) {
+        return 0xfffe;  /* not all input consumed */
+    }
+    uint8_t action=(uint8_t)MBCS_ENTRY_FINAL_ACTION(entry);
+    if(action==MBCS_STATE_VALID_16) {
+        UChar c=mbcsTable->unicodeCodeUnits[offset+MBCS_ENTRY_FINAL_VALUE_16(entry)];
+        return c<0xfffe ? c : (UChar)0xfffe;
+    } else if(action==MBCS_STATE_VALID_DIRECT_16) {
+        return (UChar)MBCS_ENTRY_FINAL_VALUE_16(entry);
+    } else {
+        return 0xfffe;
+    }
+}
+
 /**
  * This is an internal function that allows other converter implementations
  * to check whether a byte is a lead byte.
@@ -522,6 +557,22 @@ ucnv_MBCSSingleSimpleGetNextUChar(UConverterSharedData *sharedData,
 U_CFUNC UBool
 ucnv_MBCSIsLeadByte(UConverterSharedData *sharedData, char byte);
 
+/**
+ * This is an internal function for ucnv_convertParallel()
+ * to check whether toUnicode conversion can be split at all:
+ * Every byte sequence must end in the initial state.
+ */
+U_CFUNC UBool
+ucnv_MBCSCanSplitToUnicode(const UConverterSharedData *sharedData);
+
+/**
+ * This is an internal function for ucnv_convertParallel()
+ * to check whether toUnicode conversion can be split after a byte,
+ * converting the text before and after it independently.
+ */
+U_CFUNC UBool
+ucnv_MBCSIsSplitAfterByte(const UConverterSharedData *sharedData, uint8_t b);
+
 /** This is a macro version of _MBCSIsLeadByte(). */
 #define _MBCS_IS_LEAD_BYTE(sharedData, byte) \
     (UBool)MBCS_ENTRY_IS_TRANSITION((sharedData)->mbcs.stateTable[0][(uint8_t)(byte)])
@@ -738,6 +738,55 @@ static UEnumeration *selectForMask(const UConverterSelector* sel,
   return en;
 }
 
+// internal fn to intersect the mask with the bit vectors for the code points
+// of a UTF-16 string; each run of code points with the same trie value
+// (such as a run of ASCII letters) is intersected only once
+static void selectMaskForString(const UConverterSelector* sel, uint32_t* mask,
+                                const UChar *s, int32_t length) {
+  int32_t columns = (sel->encodingsCount+31)/32;
+  const UChar *limit;
+  if (length >= 0) {
+    limit = s + length;
+  } else {
+    limit = NULL;
+  }
+
+  int32_t prevPvIndex = -1;
+  while (limit == NULL ? *s != 0 : s != limit) {
+    UChar32 c;
+    uint16_t pvIndex;
+    UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
+    if (pvIndex != prevPvIndex) {
+      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+        break;
+      }
+      prevPvIndex = pvIndex;
+    }
+  }
+}
+
+// same for a UTF-8 string
+static void selectMaskForUTF8(const UConverterSelector* sel, uint32_t* mask,
+                              const char *s, int32_t length) {
+  int32_t columns = (sel->encodingsCount+31)/32;
+  if (length < 0) {
+    length = (int32_t)uprv_strlen(s);
+  }
+  const char *limit = s + length;
+
+  int32_t prevPvIndex = -1;
+  while (s != limit) {
+    uint16_t pvIndex;
+    UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
+    if (pvIndex != prevPvIndex) {
+      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
+        break;
+      }
+      prevPvIndex = pvIndex;
+    }
+  }
+}
+
 /* check a string against the selector - UTF16 version */
 U_CAPI UEnumeration * U_EXPORT2
 ucnvsel_selectForString(const UConverterSelector* sel,
@@ -761,21 +810,7 @@ ucnvsel_selectForString(const UConverterSelector* sel,
   uprv_memset(mask, ~0, columns *4);
 
   if(s!=NULL) {
-    const UChar *limit;
-    if (length >= 0) {
-      limit = s + length;
-    } else {
-      limit = NULL;
-    }
-    
-    while (limit == NULL ? *s != 0 : s != limit) {
-      UChar32 c;
-      uint16_t pvIndex;
-      UTRIE2_U16_NEXT16(sel->trie, s, limit, c, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
-      }
-    }
+    selectMaskForString(sel, mask, s, length);
   }
   return selectForMask(sel, mask, status);
 }
@@ -802,22 +837,121 @@ ucnvsel_selectForUTF8(const UConverterSelector* sel,
   }
   uprv_memset(mask, ~0, columns *4);
 
-  if (length < 0) {
-    length = (int32_t)uprv_strlen(s);
+  if(s!=NULL) {
+    selectMaskForUTF8(sel, mask, s, length);
   }
+  return selectForMask(sel, mask, status);
+}
 
-  if(s!=NULL) {
-    const char *limit = s + length;
-    
-    while (s != limit) {
-      uint16_t pvIndex;
-      UTRIE2_U8_NEXT16(sel->trie, s, limit, pvIndex);
-      if (intersectMasks(mask, sel->pv+pvIndex, columns)) {
-        break;
-      }
+U_CAPI int32_t U_EXPORT2
+ucnvsel_countEncodings(const UConverterSelector* sel, UErrorCode *status) {
+  // check if already failed
+  if (U_FAILURE(*status)) {
+    return 0;
+  }
+  if (sel == NULL) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return 0;
+  }
+  return sel->encodingsCount;
+}
+
+U_CAPI const char * U_EXPORT2
+ucnvsel_getEncoding(const UConverterSelector* sel, int32_t index, UErrorCode *status) {
+  // check if already failed
+  if (U_FAILURE(*status)) {
+    return NULL;
+  }
+  if (sel == NULL) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return NULL;
+  }
+  if (index < 0 || index >= sel->encodingsCount) {
+    *status = U_INDEX_OUTOFBOUNDS_ERROR;
+    return NULL;
+  }
+  return sel->encodings[index];
+}
+
+// internal fn with the common argument checking for the batch functions;
+// returns the number of mask words per string, or 0 if there is nothing to do
+static int32_t checkBatchArgs(const UConverterSelector* sel,
+                              const void* strings, int32_t count,
+                              uint32_t *masks, int32_t capacity,
+                              int32_t *totalLength, UErrorCode *status) {
+  *totalLength = 0;
+  // check if already failed
+  if (U_FAILURE(*status)) {
+    return 0;
+  }
+  // ensure args make sense!
+  if (sel == NULL || count < 0 || (strings == NULL && count != 0) ||
+      capacity < 0 || (masks == NULL && capacity != 0)) {
+    *status = U_ILLEGAL_ARGUMENT_ERROR;
+    return 0;
+  }
+  int32_t columns = (sel->encodingsCount+31)/32;
+  if (columns == 0) {
+    return 0;
+  }
+  if (count > INT32_MAX / columns) {
+    *status = U_INDEX_OUTOFBOUNDS_ERROR;
+    return 0;
+  }
+  *totalLength = count * columns;
+  if (capacity < *totalLength) {
+    *status = U_BUFFER_OVERFLOW_ERROR;
+    return 0;
+  }
+  return columns;
+}
+
+/* check many strings against the selector - UTF16 version */
+U_CAPI int32_t U_EXPORT2
+ucnvsel_selectForStrings(const UConverterSelector* sel,
+                         const UChar *const *strings, const int32_t *lengths, int32_t count,
+                         uint32_t *masks, int32_t capacity, UErrorCode *status) {
+  int32_t totalLength;
+  int32_t columns = checkBatchArgs(sel, strings, count, masks, capacity, &totalLength, status);
+  if (columns == 0) {
+    return totalLength;
+  }
+  uprv_memset(masks, ~0, totalLength * 4);
+  for (int32_t i = 0; i < count; ++i) {
+    int32_t length = lengths != NULL ? lengths[i] : -1;
+    if (strings[i] == NULL && length != 0) {
+      *status = U_ILLEGAL_ARGUMENT_ERROR;
+      return totalLength;
+    }
+    if (strings[i] != NULL) {
+      selectMaskForString(sel, masks + i * columns, strings[i], length);
     }
   }
-  return selectForMask(sel, mask, status);
+  return totalLength;
+}
+
+/* check many strings against the selector - UTF8 version */
+U_CAPI int32_t U_EXPORT2
+ucnvsel_selectForUTF8Strings(const UConverterSelector* sel,
+                             const char *const *strings, const int32_t *lengths, int32_t count,
+                             uint32_t *masks, int32_t capacity, UErrorCode *status) {
+  int32_t totalLength;
+  int32_t columns = checkBatchArgs(sel, strings, count, masks, capacity, &totalLength, status);
+  if (columns == 0) {
+    return totalLength;
+  }
+  uprv_memset(masks, ~0, totalLength * 4);
+  for (int32_t i = 0; i < count; ++i) {
+    int32_t length = lengths != NULL ? lengths[i] : -1;
+    if (strings[i] == NULL && length != 0) {
+      *status = U_ILLEGAL_ARGUMENT_ERROR;
+      return totalLength;
+    }
+    if (strings[i] != NULL) {
+      selectMaskForUTF8(sel, masks + i * columns, strings[i], length);
+    }
+  }
+  return totalLength;
 }
 
 #endif  // !UCONFIG_NO_CONVERSION
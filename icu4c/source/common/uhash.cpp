@@ -13,11 +13,17 @@
 */
 
 #include "uhash.h"
+#include "unicode/unistr.h"
 #include "unicode/ustring.h"
 #include "cstring.h"
 #include "cmemory.h"
 #include "uassert.h"
 #include "ustr_imp.h"
+#include "usimd.h"
+
+#if U_SIMD_SSE2
+#   include <emmintrin.h>
+#endif
 
 /* This hashtable is implemented as a double hash.  All elements are
  * stored in a single array with no secondary storage for collision
@@ -60,15 +66,63 @@
  * means the table will never shrink.  Setting the high water ratio to
  * one means the table will never grow.  The ratios should be
  * coordinated with the ratio between successive elements of the
- * PRIMES table, so that when the primeIndex is incremented or
+ * PRIMES table, so that when the lengthIndex is incremented or
  * decremented during rehashing, it brings the ratio of count / length
  * back into the desired range (between low and high water ratios).
+ *
+ * uhash_setGroupProbing() replaces the double hash of one table with
+ * group probing (as in "Swiss tables").  The table length is then a
+ * power of two, and a
+ * parallel array of control bytes holds 7 bits of each occupied
+ * slot's (remixed) hashcode, or a marker for an empty or deleted
+ * slot.  The slots are divided into aligned groups of 16.  A lookup
+ * compares the control bytes of a whole group against the hash bits
+ * at once (with one SSE2 comparison where available), and calls the
+ * key comparator only for slots whose control byte and full hashcode
+ * match.  If the group has no match but an empty slot, the key is
+ * not in the table; otherwise the next group is chosen by triangular
+ * probing, which visits every group once.  The UHashElement array and
+ * its hashcode markers are the same in both engines, so iteration and
+ * the public API behave the same, except for the iteration order.
+ * The double hash stays the default: Group probing pays off for
+ * string keys, most of all for lookups of absent keys, but it costs
+ * one more byte per slot, and the prime lengths of the double hash
+ * spread small integer keys perfectly while group probing has to
+ * remix them.  Tables that are looked up often with string keys
+ * (like the converter cache in ucnv_bld.cpp) opt in.
+ *
+ * Lookups in tables with the common char* and UnicodeString* key
+ * comparators compare keys with inline code rather than through the
+ * comparator function pointer.
  */
 
 /********************************************************************
  * PRIVATE Constants, Macros
  ********************************************************************/
 
+/* Number of slots per group with group probing; also the minimum
+ * table length. */
+#define GROUP_LENGTH 16
+
+/* Control bytes for slots without a key-value pair.  Occupied slots
+ * have control bytes 00..7F.
+ */
+#define CTRL_EMPTY   ((uint8_t)0x80)
+#define CTRL_DELETED ((uint8_t)0xfe)
+
+/* Powers of two, from one group up.  If the ratio between successive
+ * lengths is changed, the low and high water ratios should also be
+ * adjusted to suit.
+ */
+static const int32_t GROUP_LENGTHS[] = {
+    16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768,
+    65536, 131072, 262144, 524288, 1048576, 2097152, 4194304, 8388608,
+    16777216, 33554432, 67108864, 134217728, 268435456, 536870912,
+    1073741824
+};
+
+#define GROUP_LENGTHS_LENGTH UPRV_LENGTHOF(GROUP_LENGTHS)
+
 /* This is a list of non-consecutive primes chosen such that
  * PRIMES[i+1] ~ 2*PRIMES[i].  (Currently, the ratio ranges from 1.81
  * to 2.18; the inverse ratio ranges from 0.459 to 0.552.)  If this
@@ -88,8 +142,8 @@ static const int32_t PRIMES[] = {
 #define PRIMES_LENGTH UPRV_LENGTHOF(PRIMES)
 #define DEFAULT_PRIME_INDEX 4
 
-/* These ratios are tuned to the PRIMES array such that a resize
- * places the table back into the zone of non-resizing.  That is,
+/* These ratios are tuned to the PRIMES and GROUP_LENGTHS arrays such
+ * that a resize places the table back into the zone of non-resizing.  That is,
  * after a call to _uhash_rehash(), a subsequent call to
  * _uhash_rehash() should do nothing (should not churn).  This is only
  * a potential problem with U_GROW_AND_SHRINK.
@@ -139,6 +193,122 @@ static const float RESIZE_POLICY_RATIO_TABLE[6] = {
  * PRIVATE Implementation
  ********************************************************************/
 
+/**
+ * Remixes a non-negative hashcode so that both the group index and the
+ * control byte depend on all of its bits.  Many key hash functions
+ * (like uhash_hashLong()) vary mostly in their low bits.
+ */
+static inline uint32_t
+_uhash_mix(int32_t hashcode) {
+    uint32_t h = (uint32_t)hashcode * 0x9e3779b1u;
+    return h ^ (h >> 16);
+}
+
+/** The control byte for an occupied slot with this hashcode. */
+static inline uint8_t
+_uhash_control(int32_t hashcode) {
+    return (uint8_t)(_uhash_mix(hashcode) & 0x7f);
+}
+
+/**
+ * Returns a bit set with bit i set if group[i] == c,
+ * for 0 <= i < GROUP_LENGTH.
+ */
+static inline uint32_t
+_uhash_matchGroup(const uint8_t *group, uint8_t c) {
+#if U_SIMD_SSE2
+    __m128i g = _mm_loadu_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)c)));
+#else
+    uint32_t bits = 0;
+    for (int32_t i = 0; i < GROUP_LENGTH; ++i) {
+        if (group[i] == c) {
+            bits |= (uint32_t)1 << i;
+        }
+    }
+    return bits;
+#endif
+}
+
+/** Returns the index of the lowest set bit; bits must not be 0. */
+static inline int32_t
+_uhash_lowestBit(uint32_t bits) {
+#if defined(__GNUC__)
+    return __builtin_ctz(bits);
+#else
+    int32_t i = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        ++i;
+    }
+    return i;
+#endif
+}
+
+/**
+ * Sets the control byte for an element whose hashcode was just set.
+ * A removed element's slot is marked empty rather than deleted if its
+ * group has another empty slot: Lookups stop in such a group anyway,
+ * so no probe sequence continues past this slot.
+ */
+static inline void
+_uhash_setControl(UHashtable *hash, const UHashElement *e) {
+    int32_t i = (int32_t)(e - hash->elements);
+    uint8_t *ctrl = hash->ctrl;
+    if (!IS_EMPTY_OR_DELETED(e->hashcode)) {
+        ctrl[i] = _uhash_control(e->hashcode);
+    } else if (_uhash_matchGroup(ctrl + (i & ~(GROUP_LENGTH - 1)), CTRL_EMPTY) != 0) {
+        ctrl[i] = CTRL_EMPTY;
+    } else {
+        ctrl[i] = CTRL_DELETED;
+    }
+}
+
+/*
+ * Key equality functors for _uhash_find().  The generic one calls the
+ * table's comparator; the others inline the comparators for the most
+ * common key types.
+ */
+struct UHashKeysEqual {
+    UKeyComparator *comparator;
+    UHashKeysEqual(UKeyComparator *fn) : comparator(fn) {}
+    UBool operator()(UHashTok key1, UHashTok key2) const {
+        return (*comparator)(key1, key2);
+    }
+};
+
+struct UHashCharsEqual {
+    UBool operator()(UHashTok key1, UHashTok key2) const {
+        const char *p1 = (const char*) key1.pointer;
+        const char *p2 = (const char*) key2.pointer;
+        if (p1 == p2) {
+            return TRUE;
+        }
+        if (p1 == NULL || p2 == NULL) {
+            return FALSE;
+        }
+        while (*p1 != 0 && *p1 == *p2) {
+            ++p1;
+            ++p2;
+        }
+        return (UBool)(*p1 == *p2);
+    }
+};
+
+struct UHashUnicodeStringsEqual {
+    UBool operator()(UHashTok key1, UHashTok key2) const {
+        const icu::UnicodeString *str1 = (const icu::UnicodeString*) key1.pointer;
+        const icu::UnicodeString *str2 = (const icu::UnicodeString*) key2.pointer;
+        if (str1 == str2) {
+            return TRUE;
+        }
+        if (str1 == NULL || str2 == NULL) {
+            return FALSE;
+        }
+        return *str1 == *str2;
+    }
+};
+
 static UHashTok
 _uhash_setElement(UHashtable *hash, UHashElement* e,
                   int32_t hashcode,
@@ -173,6 +343,9 @@ _uhash_setElement(UHashtable *hash, UHashElement* e,
         e->value = value;
     }
     e->hashcode = hashcode;
+    if (hash->ctrl != NULL) {
+        _uhash_setControl(hash, e);
+    }
     return oldValue;
 }
 
@@ -199,16 +372,18 @@ _uhash_internalSetResizePolicy(UHashtable *hash, enum UHashResizePolicy policy)
 
 /**
  * Allocate internal data array of a size determined by the given
- * prime index.  If the index is out of range it is pinned into range.
+ * length index, for the double hash or for group probing.
  * If the allocation fails the status is set to
  * U_MEMORY_ALLOCATION_ERROR and all array storage is freed.  In
- * either case the previous array pointer is overwritten.
+ * either case the previous array pointers are overwritten.
  *
- * Caller must ensure primeIndex is in range 0..PRIME_LENGTH-1.
+ * Caller must ensure lengthIndex is in range 0..PRIMES_LENGTH-1,
+ * or 0..GROUP_LENGTHS_LENGTH-1 for group probing.
  */
 static void
 _uhash_allocate(UHashtable *hash,
-                int32_t primeIndex,
+                int32_t lengthIndex,
+                UBool groupProbing,
                 UErrorCode *status) {
 
     UHashElement *p, *limit;
@@ -216,17 +391,36 @@ _uhash_allocate(UHashtable *hash,
 
     if (U_FAILURE(*status)) return;
 
-    U_ASSERT(primeIndex >= 0 && primeIndex < PRIMES_LENGTH);
+    hash->lengthIndex = static_cast<int8_t>(lengthIndex);
 
-    hash->primeIndex = static_cast<int8_t>(primeIndex);
-    hash->length = PRIMES[primeIndex];
+    if (groupProbing) {
+        U_ASSERT(lengthIndex >= 0 && lengthIndex < GROUP_LENGTHS_LENGTH);
+        hash->length = GROUP_LENGTHS[lengthIndex];
 
-    p = hash->elements = (UHashElement*)
-        uprv_malloc(sizeof(UHashElement) * hash->length);
+        /* The control bytes follow the elements in the same block. */
+        p = hash->elements = (UHashElement*)
+            uprv_malloc((sizeof(UHashElement) + 1) * hash->length);
 
-    if (hash->elements == NULL) {
-        *status = U_MEMORY_ALLOCATION_ERROR;
-        return;
+        if (hash->elements == NULL) {
+            hash->ctrl = NULL;
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+
+        hash->ctrl = (uint8_t *)(hash->elements + hash->length);
+        uprv_memset(hash->ctrl, CTRL_EMPTY, hash->length);
+    } else {
+        U_ASSERT(lengthIndex >= 0 && lengthIndex < PRIMES_LENGTH);
+        hash->length = PRIMES[lengthIndex];
+
+        p = hash->elements = (UHashElement*)
+            uprv_malloc(sizeof(UHashElement) * hash->length);
+        hash->ctrl = NULL;
+
+        if (hash->elements == NULL) {
+            *status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
     }
 
     emptytok.pointer = NULL; /* Only one of these two is needed */
@@ -250,7 +444,7 @@ _uhash_init(UHashtable *result,
               UHashFunction *keyHash,
               UKeyComparator *keyComp,
               UValueComparator *valueComp,
-              int32_t primeIndex,
+              int32_t lengthIndex,
               UErrorCode *status)
 {
     if (U_FAILURE(*status)) return NULL;
@@ -265,7 +459,7 @@ _uhash_init(UHashtable *result,
     result->allocated       = FALSE;
     _uhash_internalSetResizePolicy(result, U_GROW);
 
-    _uhash_allocate(result, primeIndex, status);
+    _uhash_allocate(result, lengthIndex, FALSE, status);
 
     if (U_FAILURE(*status)) {
         return NULL;
@@ -278,7 +472,7 @@ static UHashtable*
 _uhash_create(UHashFunction *keyHash,
               UKeyComparator *keyComp,
               UValueComparator *valueComp,
-              int32_t primeIndex,
+              int32_t lengthIndex,
               UErrorCode *status) {
     UHashtable *result;
 
@@ -290,7 +484,7 @@ _uhash_create(UHashFunction *keyHash,
         return NULL;
     }
 
-    _uhash_init(result, keyHash, keyComp, valueComp, primeIndex, status);
+    _uhash_init(result, keyHash, keyComp, valueComp, lengthIndex, status);
     result->allocated       = TRUE;
 
     if (U_FAILURE(*status)) {
@@ -328,10 +522,67 @@ _uhash_create(UHashFunction *keyHash,
  * The size of the table should be prime for this algorithm to work;
  * otherwise we are not guaranteed that the jump value (the secondary
  * hash) is relatively prime to the table length.
+ *
+ * With group probing, the start position is a group chosen by the
+ * remixed hashcode, and the search tests one group of control bytes
+ * at a time, as described at the top of this file.
  */
-static UHashElement*
-_uhash_find(const UHashtable *hash, UHashTok key,
-            int32_t hashcode) {
+template<typename KeysEqual>
+static inline UHashElement*
+_uhash_findInGroups(const UHashtable *hash, UHashTok key,
+                    int32_t hashcode, KeysEqual keysEqual) {
+
+    int32_t firstDeleted = -1;  /* assume invalid index */
+    int32_t groupMask = hash->length / GROUP_LENGTH - 1;
+    int32_t group, step, start;
+    uint32_t mixed, bits;
+    uint8_t control;
+    UHashElement *elements = hash->elements;
+    const uint8_t *ctrl = hash->ctrl;
+
+    hashcode &= 0x7FFFFFFF; /* must be positive */
+    mixed = _uhash_mix(hashcode);
+    control = (uint8_t)(mixed & 0x7f);
+    group = (int32_t)(mixed >> 7) & groupMask;
+
+    /* Adding 1, 2, 3, ... to the group index modulo a power of two
+     * visits every group exactly once in groupMask+1 steps.
+     */
+    for (step = 1; step <= groupMask + 1; ++step) {
+        start = group * GROUP_LENGTH;
+        for (bits = _uhash_matchGroup(ctrl + start, control); bits != 0; bits &= bits - 1) {
+            UHashElement *e = elements + start + _uhash_lowestBit(bits);
+            if (e->hashcode == hashcode && keysEqual(key, e->key)) {
+                return e;
+            }
+        }
+        bits = _uhash_matchGroup(ctrl + start, CTRL_EMPTY);
+        if (bits != 0) { /* empty, end o' the line */
+            if (firstDeleted >= 0) {
+                return &(elements[firstDeleted]); /* reuse deleted slot */
+            }
+            return &(elements[start + _uhash_lowestBit(bits)]);
+        }
+        if (firstDeleted < 0) { /* remember first deleted */
+            bits = _uhash_matchGroup(ctrl + start, CTRL_DELETED);
+            if (bits != 0) {
+                firstDeleted = start + _uhash_lowestBit(bits);
+            }
+        }
+        group = (group + step) & groupMask;
+    }
+
+    if (firstDeleted < 0) {
+        /* The table is full; see _uhash_findDoubleHash(). */
+        UPRV_UNREACHABLE;
+    }
+    return &(elements[firstDeleted]);
+}
+
+template<typename KeysEqual>
+static inline UHashElement*
+_uhash_findDoubleHash(const UHashtable *hash, UHashTok key,
+                      int32_t hashcode, KeysEqual keysEqual) {
 
     int32_t firstDeleted = -1;  /* assume invalid index */
     int32_t theIndex, startIndex;
@@ -345,7 +596,7 @@ _uhash_find(const UHashtable *hash, UHashTok key,
     do {
         tableHash = elements[theIndex].hashcode;
         if (tableHash == hashcode) {          /* quick check */
-            if ((*hash->keyComparator)(key, elements[theIndex].key)) {
+            if (keysEqual(key, elements[theIndex].key)) {
                 return &(elements[theIndex]);
             }
         } else if (!IS_EMPTY_OR_DELETED(tableHash)) {
@@ -381,40 +632,55 @@ _uhash_find(const UHashtable *hash, UHashTok key,
     return &(elements[theIndex]);
 }
 
+template<typename KeysEqual>
+static inline UHashElement*
+_uhash_find(const UHashtable *hash, UHashTok key,
+            int32_t hashcode, KeysEqual keysEqual) {
+    if (hash->ctrl != NULL) {
+        return _uhash_findInGroups(hash, key, hashcode, keysEqual);
+    } else {
+        return _uhash_findDoubleHash(hash, key, hashcode, keysEqual);
+    }
+}
+
 /**
- * Attempt to grow or shrink the data arrays in order to make the
- * count fit between the high and low water marks.  hash_put() and
- * hash_remove() call this method when the count exceeds the high or
- * low water marks.  This method may do nothing, if memory allocation
- * fails, or if the count is already in range, or if the length is
- * already at the low or high limit.  In any case, upon return the
- * arrays will be valid.
+ * Calls _uhash_find() with inline key comparison for the common key
+ * types, and with the table's keyComparator otherwise.
+ */
+static UHashElement*
+_uhash_find(const UHashtable *hash, UHashTok key,
+            int32_t hashcode) {
+    if (hash->keyComparator == uhash_compareChars) {
+        return _uhash_find(hash, key, hashcode, UHashCharsEqual());
+    } else if (hash->keyComparator == uhash_compareUnicodeString) {
+        return _uhash_find(hash, key, hashcode, UHashUnicodeStringsEqual());
+    } else {
+        return _uhash_find(hash, key, hashcode, UHashKeysEqual(hash->keyComparator));
+    }
+}
+
+/**
+ * Moves the elements into newly allocated arrays with the given
+ * length index, for the double hash or for group probing.
+ * If memory allocation fails, the table keeps its old arrays.
  */
 static void
-_uhash_rehash(UHashtable *hash, UErrorCode *status) {
+_uhash_reallocate(UHashtable *hash, int32_t newLengthIndex,
+                  UBool groupProbing, UErrorCode *status) {
 
     UHashElement *old = hash->elements;
+    uint8_t *oldCtrl = hash->ctrl;
     int32_t oldLength = hash->length;
-    int32_t newPrimeIndex = hash->primeIndex;
+    int32_t oldLengthIndex = hash->lengthIndex;
     int32_t i;
 
-    if (hash->count > hash->highWaterMark) {
-        if (++newPrimeIndex >= PRIMES_LENGTH) {
-            return;
-        }
-    } else if (hash->count < hash->lowWaterMark) {
-        if (--newPrimeIndex < 0) {
-            return;
-        }
-    } else {
-        return;
-    }
-
-    _uhash_allocate(hash, newPrimeIndex, status);
+    _uhash_allocate(hash, newLengthIndex, groupProbing, status);
 
     if (U_FAILURE(*status)) {
         hash->elements = old;
+        hash->ctrl = oldCtrl;
         hash->length = oldLength;
+        hash->lengthIndex = (int8_t)oldLengthIndex;
         return;
     }
 
@@ -426,6 +692,9 @@ _uhash_rehash(UHashtable *hash, UErrorCode *status) {
             e->key = old[i].key;
             e->value = old[i].value;
             e->hashcode = old[i].hashcode;
+            if (groupProbing) {
+                _uhash_setControl(hash, e);
+            }
             ++hash->count;
         }
     }
@@ -433,6 +702,36 @@ _uhash_rehash(UHashtable *hash, UErrorCode *status) {
     uprv_free(old);
 }
 
+/**
+ * Attempt to grow or shrink the data arrays in order to make the
+ * count fit between the high and low water marks.  hash_put() and
+ * hash_remove() call this method when the count exceeds the high or
+ * low water marks.  This method may do nothing, if memory allocation
+ * fails, or if the count is already in range, or if the length is
+ * already at the low or high limit.  In any case, upon return the
+ * arrays will be valid.
+ */
+static void
+_uhash_rehash(UHashtable *hash, UErrorCode *status) {
+
+    UBool groupProbing = hash->ctrl != NULL;
+    int32_t newLengthIndex = hash->lengthIndex;
+
+    if (hash->count > hash->highWaterMark) {
+        if (++newLengthIndex >= (groupProbing ? GROUP_LENGTHS_LENGTH : PRIMES_LENGTH)) {
+            return;
+        }
+    } else if (hash->count < hash->lowWaterMark) {
+        if (--newLengthIndex < 0) {
+            return;
+        }
+    } else {
+        return;
+    }
+
+    _uhash_reallocate(hash, newLengthIndex, groupProbing, status);
+}
+
 static UHashTok
 _uhash_remove(UHashtable *hash,
               UHashTok key) {
@@ -600,6 +899,7 @@ uhash_close(UHashtable *hash) {
         }
         uprv_free(hash->elements);
         hash->elements = NULL;
+        hash->ctrl = NULL;
     }
     if (hash->allocated) {
         uprv_free(hash);
@@ -649,6 +949,21 @@ uhash_setResizePolicy(UHashtable *hash, enum UHashResizePolicy policy) {
     _uhash_rehash(hash, &status);
 }
 
+U_CAPI void U_EXPORT2
+uhash_setGroupProbing(UHashtable *hash, UErrorCode *status) {
+    if (U_FAILURE(*status) || hash->ctrl != NULL) {
+        return;
+    }
+    /* The smallest power of two that is at least the prime length
+     * keeps the fill level and the water marks in range.
+     */
+    int32_t i = 0;
+    while (i<(GROUP_LENGTHS_LENGTH-1) && GROUP_LENGTHS[i]<hash->length) {
+        ++i;
+    }
+    _uhash_reallocate(hash, i, TRUE, status);
+}
+
 U_CAPI int32_t U_EXPORT2
 uhash_count(const UHashtable *hash) {
     return hash->count;
@@ -140,6 +140,13 @@ struct UHashtable {
 
     UHashElement *elements;
 
+    /* One metadata byte per element for group probing: 7 bits of the
+     * hash code, or a marker for an empty or deleted slot.  Allocated
+     * together with elements; NULL with the default double hash.
+     * See uhash_setGroupProbing(). */
+
+    uint8_t *ctrl;
+
     /* Function pointers */
 
     UHashFunction *keyHasher;      /* Computes hash from key.
@@ -159,7 +166,8 @@ struct UHashtable {
                              * 0 <= count <= length.  In practice we
                              * never let count == length (see code). */
     int32_t     length;     /* The physical size of the arrays hashes, keys
-                             * and values.  Must be prime. */
+                             * and values.  A power of two with group
+                             * probing, otherwise prime. */
 
     /* Rehashing thresholds */
 
@@ -168,8 +176,10 @@ struct UHashtable {
     float       highWaterRatio; /* 0..1; high water as a fraction of length */
     float       lowWaterRatio;  /* 0..1; low water as a fraction of length */
 
-    int8_t      primeIndex;     /* Index into our prime table for length.
-                                 * length == PRIMES[primeIndex] */
+    int8_t      lengthIndex;    /* Index into our table of lengths.
+                                 * length == PRIMES[lengthIndex], or
+                                 * GROUP_LENGTHS[lengthIndex] with
+                                 * group probing */
     UBool       allocated; /* Was this UHashtable allocated? */
 };
 typedef struct UHashtable UHashtable;
@@ -324,6 +334,20 @@ uhash_setValueDeleter(UHashtable *hash, UObjectDeleter *fn);
 U_CAPI void U_EXPORT2
 uhash_setResizePolicy(UHashtable *hash, enum UHashResizePolicy policy);
 
+/**
+ * Switches the hashtable from the default double hash to group probing
+ * over control bytes, and rehashes its contents.  Group probing makes
+ * lookups faster for string keys, especially of absent keys, at the
+ * cost of one more byte per slot; it is not faster for integer keys.
+ * The order of iteration changes.  Does nothing if the table already
+ * uses group probing.  If memory allocation fails, the table keeps
+ * the double hash and its contents.
+ * @param hash The UHashtable to set
+ * @param status A pointer to an UErrorCode to receive any errors.
+ */
+U_CAPI void U_EXPORT2
+uhash_setGroupProbing(UHashtable *hash, UErrorCode *status);
+
 /**
  * Get the number of key-value pairs stored in a UHashtable.
  * @param hash The UHashtable to query.
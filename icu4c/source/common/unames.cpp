@@ -25,6 +25,8 @@
 #include "uassert.h"
 #include "ustr_imp.h"
 #include "umutex.h"
+#include "uarrsort.h"
+#include "charstr.h"
 #include "cmemory.h"
 #include "cstring.h"
 #include "ucln_cmn.h"
@@ -118,6 +120,23 @@ static int32_t gMaxNameLength=0;
  */
 static uint32_t gNameSet[8]={ 0 };
 
+/*
+ * Indexes of the names in the groups, built on demand, per UCharNameChoice.
+ * See the "name indexes" section below.
+ */
+static uint32_t *gNameHashes[U_CHAR_NAME_CHOICE_COUNT]={ NULL };
+static int32_t gNameHashMasks[U_CHAR_NAME_CHOICE_COUNT]={ 0 };
+static u_atomic_int32_t gNameHashLookups[U_CHAR_NAME_CHOICE_COUNT];
+static icu::UInitOnce gNameHashInitOnce[U_CHAR_NAME_CHOICE_COUNT]={
+    U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER
+};
+
+static UChar32 *gSortedNames[U_CHAR_NAME_CHOICE_COUNT]={ NULL };
+static int32_t gSortedNamesLengths[U_CHAR_NAME_CHOICE_COUNT]={ 0 };
+static icu::UInitOnce gSortedNamesInitOnce[U_CHAR_NAME_CHOICE_COUNT]={
+    U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER, U_INITONCE_INITIALIZER
+};
+
 #define U_NONCHARACTER_CODE_POINT U_CHAR_CATEGORY_COUNT
 #define U_LEAD_SURROGATE U_CHAR_CATEGORY_COUNT + 1
 #define U_TRAIL_SURROGATE U_CHAR_CATEGORY_COUNT + 2
@@ -171,6 +190,17 @@ static UBool U_CALLCONV unames_cleanup(void)
     if(uCharNames) {
         uCharNames = NULL;
     }
+    for(int32_t i=0; i<U_CHAR_NAME_CHOICE_COUNT; ++i) {
+        uprv_free(gNameHashes[i]);
+        gNameHashes[i]=NULL;
+        gNameHashMasks[i]=0;
+        gNameHashInitOnce[i].reset();
+        umtx_storeRelease(gNameHashLookups[i], 0);
+        uprv_free(gSortedNames[i]);
+        gSortedNames[i]=NULL;
+        gSortedNamesLengths[i]=0;
+        gSortedNamesInitOnce[i].reset();
+    }
     gCharNamesInitOnce.reset();
     gMaxNameLength=0;
     return TRUE;
@@ -1440,6 +1470,362 @@ calcNameSetsLengths(UErrorCode *pErrorCode) {
     return TRUE;
 }
 
+/* name indexes ------------------------------------------------------------- */
+
+/*
+ * Finding a name in the groups means expanding and comparing all of them.
+ * Instead, after NAME_HASH_MIN_LOOKUPS lookups of group names for a name choice,
+ * u_charFromName() builds a hash table of the code points with names,
+ * and the first u_enumCharNamesByPrefix() for a name choice
+ * builds an array of those code points sorted by their names.
+ * Neither stores the names themselves: They are expanded again from the
+ * groups for the few code points that are looked at.
+ *
+ * Algorithmic names are not indexed; they are matched by parsing.
+ */
+
+/*
+ * Building the hash table costs about as much as 40 linear searches,
+ * so a few lookups do not build it.
+ */
+#define NAME_HASH_MIN_LOOKUPS 32
+
+/*
+ * A hash slot has a code point in bits 20..0 and the high bits of the name's hash
+ * in bits 31..21, to skip most other names without expanding them.
+ */
+#define NAME_HASH_EMPTY 0xffffffff
+#define NAME_HASH_CODE_MASK 0x1fffff
+
+typedef struct {
+    int32_t nameOffset;
+    UChar32 code;
+} NameEntry;
+
+/*
+ * U_UNICODE_CHAR_NAME and U_EXTENDED_CHAR_NAME share one hash table.
+ * It holds the extended group names: the Unicode names, and the Unicode 1.0 names
+ * of characters that do not have Unicode names, if the data has 1.0 names.
+ * Then a name can be in it twice (e.g., BELL was the 1.0 name of U+0007 and is the name of U+1F514),
+ * so a lookup skips candidates that do not have the name in the requested name choice.
+ */
+static inline UCharNameChoice
+getNameHashChoice(UCharNameChoice nameChoice) {
+    return nameChoice==U_EXTENDED_CHAR_NAME ? U_UNICODE_CHAR_NAME : nameChoice;
+}
+
+/* FNV-1a */
+static inline uint32_t
+hashName(const char *s, int32_t length) {
+    uint32_t hash=0x811c9dc5;
+    while(length>0) {
+        hash=(hash^(uint8_t)*s++)*16777619;
+        --length;
+    }
+    return hash;
+}
+
+/*
+ * Expands all of the group names for nameChoice, each zero-terminated, into nameStrings.
+ * @return an array with an entry per name in code point order, to be released with uprv_free(),
+ *         or NULL if an error occurred
+ */
+static NameEntry *
+collectGroupNames(UCharNames *names, UCharNameChoice nameChoice,
+                  icu::CharString &nameStrings, int32_t &count, UErrorCode &errorCode) {
+    uint16_t offsets[LINES_PER_GROUP+2], lengths[LINES_PER_GROUP+2];
+    char buffer[200];
+    const uint16_t *group=GET_GROUPS(names);
+    uint16_t groupCount=*group++;
+    NameEntry *entries=(NameEntry *)uprv_malloc((groupCount*LINES_PER_GROUP+1)*sizeof(NameEntry));
+    if(entries==NULL) {
+        errorCode=U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+
+    count=0;
+    while(groupCount>0) {
+        const uint8_t *s=(uint8_t *)names+names->groupStringOffset+GET_GROUP_OFFSET(group);
+        UChar32 start=(UChar32)group[GROUP_MSB]<<GROUP_SHIFT;
+        uint16_t i, length;
+
+        s=expandGroupLengths(s, offsets, lengths);
+        for(i=0; i<LINES_PER_GROUP; ++i) {
+            length=expandName(names, s+offsets[i], lengths[i], nameChoice, buffer, sizeof(buffer));
+            if(length>0) {
+                entries[count].nameOffset=nameStrings.length();
+                entries[count].code=start+i;
+                ++count;
+                nameStrings.append(buffer, length, errorCode).append((char)0, errorCode);
+            }
+        }
+        group=NEXT_GROUP(group);
+        --groupCount;
+    }
+    if(U_FAILURE(errorCode)) {
+        uprv_free(entries);
+        return NULL;
+    }
+    return entries;
+}
+
+/*
+ * Inserts the group names for nameChoice into the hash table, in code point order.
+ * Names that occur more than once are all inserted; with linear probing,
+ * a lookup sees them in code point order.
+ * If slots is NULL, then this only counts the names.
+ * @return the number of names
+ */
+static int32_t
+insertGroupNames(UCharNames *names, UCharNameChoice nameChoice, uint32_t *slots, int32_t mask) {
+    uint16_t offsets[LINES_PER_GROUP+2], lengths[LINES_PER_GROUP+2];
+    char buffer[200];
+    const uint16_t *group=GET_GROUPS(names);
+    uint16_t groupCount=*group++;
+    int32_t count=0;
+
+    while(groupCount>0) {
+        const uint8_t *s=(uint8_t *)names+names->groupStringOffset+GET_GROUP_OFFSET(group);
+        UChar32 start=(UChar32)group[GROUP_MSB]<<GROUP_SHIFT;
+        uint16_t i, length;
+
+        s=expandGroupLengths(s, offsets, lengths);
+        for(i=0; i<LINES_PER_GROUP; ++i) {
+            length=expandName(names, s+offsets[i], lengths[i], nameChoice, buffer, sizeof(buffer));
+            if(length>0) {
+                ++count;
+                if(slots!=NULL) {
+                    uint32_t hash=hashName(buffer, length);
+                    int32_t j;
+                    for(j=(int32_t)hash&mask; slots[j]!=NAME_HASH_EMPTY; j=(j+1)&mask) {}
+                    slots[j]=(hash&~NAME_HASH_CODE_MASK)|(uint32_t)(start+i);
+                }
+            }
+        }
+        group=NEXT_GROUP(group);
+        --groupCount;
+    }
+    return count;
+}
+
+/*
+ * Builds the hash table for the hash choice (see getNameHashChoice()).
+ * It does not keep the names: One pass counts them, and a second pass
+ * expands them again to insert them.
+ */
+static void U_CALLCONV
+loadNameHash(UCharNameChoice hashChoice) {
+    UCharNameChoice nameChoice= hashChoice==U_UNICODE_CHAR_NAME ? U_EXTENDED_CHAR_NAME : hashChoice;
+    int32_t count=insertGroupNames(uCharNames, nameChoice, NULL, 0), capacity;
+
+    /* keep the table at most half full */
+    for(capacity=64; capacity<2*count; capacity*=2) {}
+    uint32_t *slots=(uint32_t *)uprv_malloc(capacity*4);
+    if(slots==NULL) {
+        return;
+    }
+    uprv_memset(slots, 0xff, capacity*4);
+    insertGroupNames(uCharNames, nameChoice, slots, capacity-1);
+    gNameHashes[hashChoice]=slots;
+    gNameHashMasks[hashChoice]=capacity-1;
+}
+
+/*
+ * Looks up a name for nameChoice in its hash table.
+ * @return the code point, or U_SENTINEL if it is not one of the group names
+ */
+static UChar32
+findGroupName(UCharNameChoice nameChoice, const char *name) {
+    UCharNameChoice hashChoice=getNameHashChoice(nameChoice);
+    const uint32_t *slots=gNameHashes[hashChoice];
+    int32_t mask=gNameHashMasks[hashChoice];
+    int32_t length=(int32_t)uprv_strlen(name);
+    uint32_t hash=hashName(name, length);
+    char buffer[200];
+    int32_t i;
+
+    for(i=(int32_t)hash&mask;; i=(i+1)&mask) {
+        uint32_t slot=slots[i];
+        if(slot==NAME_HASH_EMPTY) {
+            return U_SENTINEL;
+        }
+        if(((slot^hash)&~NAME_HASH_CODE_MASK)==0) {
+            UChar32 code=(UChar32)(slot&NAME_HASH_CODE_MASK);
+            if(getName(uCharNames, (uint32_t)code, nameChoice, buffer, sizeof(buffer))==length &&
+                    0==uprv_strcmp(buffer, name)) {
+                return code;
+            }
+        }
+    }
+}
+
+/* Compares names, and the code points of equal names. */
+static int32_t U_CALLCONV
+compareNameEntries(const void *context, const void *left, const void *right) {
+    const char *nameStrings=(const char *)context;
+    const NameEntry *l=(const NameEntry *)left, *r=(const NameEntry *)right;
+    int32_t result=uprv_strcmp(nameStrings+l->nameOffset, nameStrings+r->nameOffset);
+    return result!=0 ? result : l->code-r->code;
+}
+
+static void U_CALLCONV
+loadSortedNames(UCharNameChoice nameChoice, UErrorCode &errorCode) {
+    icu::CharString nameStrings;
+    int32_t count, length, i;
+    NameEntry *entries=collectGroupNames(uCharNames, nameChoice, nameStrings, count, errorCode);
+    if(entries==NULL) {
+        return;
+    }
+    uprv_sortArray(entries, count, (int32_t)sizeof(NameEntry),
+                   compareNameEntries, nameStrings.data(), FALSE, &errorCode);
+    UChar32 *sorted=(UChar32 *)uprv_malloc((count+1)*4);
+    if(U_FAILURE(errorCode) || sorted==NULL) {
+        if(U_SUCCESS(errorCode)) {
+            errorCode=U_MEMORY_ALLOCATION_ERROR;
+        }
+        uprv_free(sorted);
+        uprv_free(entries);
+        return;
+    }
+    /* keep the lowest code point of each name */
+    for(i=length=0; i<count; ++i) {
+        if(i==0 || uprv_strcmp(nameStrings.data()+entries[i-1].nameOffset,
+                               nameStrings.data()+entries[i].nameOffset)!=0) {
+            sorted[length++]=entries[i].code;
+        }
+    }
+    uprv_free(entries);
+    gSortedNames[nameChoice]=sorted;
+    gSortedNamesLengths[nameChoice]=length;
+}
+
+/*
+ * Enumerates the group names for nameChoice that start with the prefix,
+ * in the order of the sorted index.
+ */
+static UBool
+enumSortedNames(UCharNameChoice nameChoice, const char *prefix, int32_t prefixLength,
+                UEnumCharNamesFn *fn, void *context) {
+    const UChar32 *sorted=gSortedNames[nameChoice];
+    int32_t start=0, limit=gSortedNamesLengths[nameChoice], i;
+    char buffer[200];
+    uint16_t length;
+
+    /* binary search for the first name that does not sort below the prefix */
+    while(start<limit) {
+        i=(start+limit)/2;
+        getName(uCharNames, (uint32_t)sorted[i], nameChoice, buffer, sizeof(buffer));
+        if(uprv_strncmp(buffer, prefix, prefixLength)<0) {
+            start=i+1;
+        } else {
+            limit=i;
+        }
+    }
+
+    for(limit=gSortedNamesLengths[nameChoice]; start<limit; ++start) {
+        length=getName(uCharNames, (uint32_t)sorted[start], nameChoice, buffer, sizeof(buffer));
+        if(uprv_strncmp(buffer, prefix, prefixLength)!=0) {
+            break;
+        }
+        if(!fn(context, sorted[start], nameChoice, buffer, length)) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+typedef struct {
+    const char *prefix;
+    int32_t prefixLength;
+    UEnumCharNamesFn *fn;
+    void *context;
+} PrefixFilter;
+
+static UBool U_CALLCONV
+filterByPrefix(void *context, UChar32 code, UCharNameChoice nameChoice,
+               const char *name, int32_t length) {
+    PrefixFilter *filter=(PrefixFilter *)context;
+    if(length>=filter->prefixLength &&
+            0==uprv_strncmp(name, filter->prefix, filter->prefixLength)) {
+        return filter->fn(filter->context, code, nameChoice, name, length);
+    }
+    return TRUE;
+}
+
+/*
+ * Enumerates the algorithmic names in the range that start with the prefix,
+ * in code point order.
+ * All of the names in a range start with the range's literal prefix,
+ * and the hex digits of type 0 names narrow down the code point range.
+ */
+static UBool
+enumAlgNamesByPrefix(AlgorithmicRange *range, const char *prefix, int32_t prefixLength,
+                     UEnumCharNamesFn *fn, void *context,
+                     UCharNameChoice nameChoice) {
+    UChar32 start=(UChar32)range->start, limit=(UChar32)range->end+1;
+    const char *s, *p=prefix;
+    int32_t rest=prefixLength;
+
+    if(nameChoice!=U_UNICODE_CHAR_NAME && nameChoice!=U_EXTENDED_CHAR_NAME) {
+        return TRUE;
+    }
+
+    if(range->type==0) {
+        s=(const char *)(range+1);
+    } else if(range->type==1) {
+        s=(const char *)((const uint16_t *)(range+1)+range->variant);
+    } else {
+        /* undefined type */
+        return TRUE;
+    }
+
+    /* compare with the literal prefix */
+    while(*s!=0 && rest>0) {
+        if(*s++!=*p++) {
+            return TRUE;
+        }
+        --rest;
+    }
+    if(rest==0) {
+        return enumAlgNames(range, start, limit, fn, context, nameChoice);
+    }
+
+    if(range->type==0) {
+        /* the rest of the prefix must be the leading hex digits of the code points */
+        int32_t count=range->variant, i;
+        UChar32 code=0;
+        char c;
+
+        if(rest>count) {
+            return TRUE;
+        }
+        for(i=0; i<rest; ++i) {
+            c=p[i];
+            if('0'<=c && c<='9') {
+                code=(code<<4)|(c-'0');
+            } else if('A'<=c && c<='F') {
+                code=(code<<4)|(c-'A'+10);
+            } else {
+                return TRUE;
+            }
+        }
+        count=4*(count-rest);
+        if(start<(code<<count)) {
+            start=code<<count;
+        }
+        if(limit>((code+1)<<count)) {
+            limit=(code+1)<<count;
+        }
+        if(start<limit) {
+            return enumAlgNames(range, start, limit, fn, context, nameChoice);
+        }
+        return TRUE;
+    } else {
+        PrefixFilter filter={ prefix, prefixLength, fn, context };
+        return enumAlgNames(range, start, limit, filterByPrefix, &filter, nameChoice);
+    }
+}
+
 U_NAMESPACE_END
 
 /* public API --------------------------------------------------------------- */
@@ -1621,6 +2007,21 @@ u_charFromName(UCharNameChoice nameChoice,
     }
 
     /* normal character name */
+    UCharNameChoice hashChoice=getNameHashChoice(nameChoice);
+    if(umtx_loadAcquire(gNameHashLookups[hashChoice])>=NAME_HASH_MIN_LOOKUPS ||
+            umtx_atomic_inc(&gNameHashLookups[hashChoice])>NAME_HASH_MIN_LOOKUPS) {
+        umtx_initOnce(gNameHashInitOnce[hashChoice], &loadNameHash, hashChoice);
+        if(gNameHashes[hashChoice]!=NULL) {
+            cp=findGroupName(nameChoice, upper);
+            if(cp<0) {
+                *pErrorCode = U_ILLEGAL_CHAR_FOUND;
+                return error;
+            }
+            return cp;
+        }
+    }
+
+    /* no index, or not yet: search all of the group names */
     findName.otherName=upper;
     findName.code=error;
     enumNames(uCharNames, 0, UCHAR_MAX_VALUE + 1, DO_FIND_NAME, &findName, nameChoice);
@@ -1698,6 +2099,61 @@ u_enumCharNames(UChar32 start, UChar32 limit,
     enumNames(uCharNames, start, limit, fn, context, nameChoice);
 }
 
+U_CAPI void U_EXPORT2
+u_enumCharNamesByPrefix(const char *prefix,
+                        UEnumCharNamesFn *fn,
+                        void *context,
+                        UCharNameChoice nameChoice,
+                        UErrorCode *pErrorCode) {
+    char upper[120];
+    AlgorithmicRange *algRange;
+    uint32_t *p;
+    uint32_t i;
+    int32_t length;
+
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return;
+    }
+
+    if(nameChoice>=U_CHAR_NAME_CHOICE_COUNT || prefix==NULL || fn==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+
+    /* match the uppercase prefix, like u_charFromName() */
+    for(length=0; prefix[length]!=0; ++length) {
+        if(length==(int32_t)sizeof(upper)-1) {
+            /* prefix too long, there is no such character */
+            return;
+        }
+        upper[length]=uprv_toupper(prefix[length]);
+    }
+    upper[length]=0;
+
+    if(!isDataLoaded(pErrorCode)) {
+        return;
+    }
+
+    umtx_initOnce(gSortedNamesInitOnce[nameChoice], &loadSortedNames, nameChoice, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        return;
+    }
+    if(!enumSortedNames(nameChoice, upper, length, fn, context)) {
+        return;
+    }
+
+    p=(uint32_t *)((uint8_t *)uCharNames+uCharNames->algNamesOffset);
+    i=*p;
+    algRange=(AlgorithmicRange *)(p+1);
+    while(i>0) {
+        if(!enumAlgNamesByPrefix(algRange, upper, length, fn, context, nameChoice)) {
+            return;
+        }
+        algRange=(AlgorithmicRange *)((uint8_t *)algRange+algRange->size);
+        --i;
+    }
+}
+
 U_CAPI int32_t U_EXPORT2
 uprv_getMaxCharNameLength() {
     UErrorCode errorCode=U_ZERO_ERROR;
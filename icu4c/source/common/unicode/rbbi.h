@@ -38,6 +38,8 @@ struct RBBIDataHeader;
 class  RBBIDataWrapper;
 class  UnhandledEngine;
 class  UStack;
+class  StreamingBreakIterator;
+class  UVector32;
 
 /**
  *
@@ -158,6 +160,8 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
     friend class RBBIRuleBuilder;
     /** @internal */
     friend class BreakIterator;
+    /** @internal */
+    friend class StreamingBreakIterator;
 
 public:
 
@@ -613,6 +617,50 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     virtual RuleBasedBreakIterator &refreshInputText(UText *input, UErrorCode &status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Set the number of boundaries that this break iterator may cache.
+     *
+     * Boundaries are cached so that repeated or backwards iteration over
+     * recently visited text is fast. Applications that hold many break iterators
+     * at once, and that iterate each one only forwards, can reduce the memory
+     * used by each iterator by setting a small capacity.
+     *
+     * A capacity of zero selects the smallest cache, a few entries held within the
+     * iterator object itself, with no separate memory allocation. This is suited for
+     * straight forward iteration; random access and backwards iteration continue to
+     * work, but are slower. Other values are rounded up to a power of two, and limited
+     * to an implementation-defined maximum.
+     *
+     * Any cached boundaries are discarded; the current iteration position is kept.
+     *
+     * @param capacity   The requested number of boundaries to cache. Must not be negative.
+     * @param status     Receives errors detected by this function.
+     *                   U_ILLEGAL_ARGUMENT_ERROR if capacity is negative.
+     * @see #getCacheCapacity
+     * @draft ICU 64
+     */
+    void setCacheCapacity(int32_t capacity, UErrorCode &status);
+
+    /**
+     * Return the number of boundaries that this break iterator may cache.
+     * @return the cache capacity.
+     * @see #setCacheCapacity
+     * @draft ICU 64
+     */
+    int32_t getCacheCapacity() const;
+
+    /**
+     * Return the approximate number of bytes of memory used by this break iterator.
+     * This includes the iterator object itself and its caches. It does not include
+     * the break rules, which are shared between iterators, nor the text being iterated.
+     *
+     * @return the approximate memory size, in bytes.
+     * @draft ICU 64
+     */
+    int32_t getMemoryUsage() const;
+#endif  // U_HIDE_DRAFT_API
+
 
 private:
     //=======================================================================
@@ -665,6 +713,14 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     const LanguageBreakEngine *getLanguageBreakEngine(UChar32 c);
 
+    /**
+     * Return the dictionary cache, creating it if it does not already exist.
+     * Iterators over text without dictionary characters never create one.
+     * @return the dictionary cache, or NULL if memory allocation failed.
+     * @internal (private)
+     */
+    DictionaryCache *getDictionaryCache();
+
   public:
 #ifndef U_HIDE_INTERNAL_API
     /**
@@ -692,6 +748,181 @@ inline UBool RuleBasedBreakIterator::operator!=(const BreakIterator& that) const
     return !operator==(that);
 }
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Boundary analysis over text that arrives incrementally, in chunks,
+ * for example as it is read from a socket.
+ *
+ * A StreamingBreakIterator applies the rules of a RuleBasedBreakIterator to text
+ * that is appended piece by piece. It reports only boundaries that are final:
+ * boundaries whose determination by the forward break rules did not depend on
+ * text beyond what has been appended so far. Text following the last final boundary
+ * (the unstable tail) is held back until more text is appended, or until the
+ * end of the stream is signaled with finish().
+ *
+ * The sequence of boundaries and rule status values reported is the same as
+ * would be obtained by iterating forward with the RuleBasedBreakIterator over the
+ * complete text, independent of how the text was divided into chunks.
+ *
+ * Text preceding the last final boundary is discarded as iteration proceeds, so
+ * the memory use is proportional to the unstable tail, not to the total length of the stream.
+ * Boundary positions are UTF-16 offsets from the start of the stream.
+ *
+ * This class is not intended for public subclassing.
+ *
+ * @draft ICU 64
+ */
+class U_COMMON_API StreamingBreakIterator U_FINAL : public UObject {
+public:
+    /**
+     * Construct a StreamingBreakIterator that applies the rules of the given break iterator.
+     * The break iterator is cloned; the caller retains ownership of the original.
+     *
+     * @param rules  A RuleBasedBreakIterator, such as one obtained from
+     *               BreakIterator::createWordInstance().
+     * @param status Information on any errors encountered.
+     * @draft ICU 64
+     */
+    StreamingBreakIterator(const RuleBasedBreakIterator &rules, UErrorCode &status);
+
+    /**
+     * Destructor.
+     * @draft ICU 64
+     */
+    virtual ~StreamingBreakIterator();
+
+    /**
+     * Append a chunk of text to the stream.
+     * Boundaries that become final as a result are returned by subsequent calls to next().
+     *
+     * @param text   The text to append. It is copied; the caller may reuse the storage.
+     * @param status Information on any errors encountered.
+     *               U_INVALID_STATE_ERROR if finish() has already been called.
+     * @draft ICU 64
+     */
+    void append(const UnicodeString &text, UErrorCode &status);
+
+    /**
+     * Append a chunk of text to the stream.
+     *
+     * @param text   The text to append. It is copied; the caller may reuse the storage.
+     * @param length The length of the text, or -1 if it is NUL-terminated.
+     * @param status Information on any errors encountered.
+     *               U_INVALID_STATE_ERROR if finish() has already been called.
+     * @draft ICU 64
+     */
+    void append(const UChar *text, int32_t length, UErrorCode &status);
+
+    /**
+     * Signal the end of the stream. All remaining boundaries, including the
+     * boundary at the end of the text, become final and available from next().
+     * @draft ICU 64
+     */
+    void finish();
+
+    /**
+     * @return TRUE if finish() has been called.
+     * @draft ICU 64
+     */
+    UBool isFinished() const { return fFinished; }
+
+    /**
+     * Advance to the next final boundary.
+     *
+     * @return The position of the boundary, as an offset from the start of the stream,
+     *         or UBRK_DONE if no further boundary is final with the text appended so far.
+     *         UBRK_DONE is not permanent until finish() has been called; appending
+     *         more text can make further boundaries available.
+     * @draft ICU 64
+     */
+    int32_t next();
+
+    /**
+     * @return The most recent boundary returned by next(), or zero if none.
+     * @draft ICU 64
+     */
+    int32_t current() const { return fCurrent; }
+
+    /**
+     * Return the status tag from the break rule that determined the boundary at
+     * current().
+     * @see RuleBasedBreakIterator::getRuleStatus
+     * @draft ICU 64
+     */
+    int32_t getRuleStatus() const;
+
+    /**
+     * Get the status (tag) values from the break rule(s) that determined the boundary at current().
+     * @see RuleBasedBreakIterator::getRuleStatusVec
+     * @draft ICU 64
+     */
+    int32_t getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UErrorCode &status);
+
+    /**
+     * Return the position of the last boundary known to be final. Boundaries after
+     * this position can still be affected by text that has not yet been appended.
+     * It may be ahead of current() if final boundaries are waiting to be returned by next().
+     *
+     * @return The stable limit, as an offset from the start of the stream.
+     * @draft ICU 64
+     */
+    int32_t getStableLimit() const { return fTextBase + fScanStart; }
+
+    /**
+     * Discard all text and boundaries, and return to the initial state,
+     * ready for a new stream.
+     * @draft ICU 64
+     */
+    void reset();
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     * @draft ICU 64
+     */
+    virtual UClassID getDynamicClassID() const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     * @draft ICU 64
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+private:
+    StreamingBreakIterator(const StreamingBreakIterator &other) = delete;
+    StreamingBreakIterator &operator=(const StreamingBreakIterator &other) = delete;
+
+    void textChanged();
+
+    /** The break iterator providing the rules. Its text is fText. */
+    RuleBasedBreakIterator *fBI;
+
+    /** The text that has not yet been passed over by a final boundary. */
+    UnicodeString fText;
+
+    /** Offset of fText.charAt(0) from the start of the stream. */
+    int32_t fTextBase;
+
+    /** Index in fText of the last final rule based boundary, where the next scan starts. */
+    int32_t fScanStart;
+
+    /** Rule status index of the boundary at fScanStart. */
+    int32_t fScanStatusIndex;
+
+    /**
+     * Final boundaries that have not yet been returned by next(), as pairs of
+     * (stream offset, rule status index). Holds the subdivisions of a dictionary range.
+     */
+    UVector32 *fPending;
+    int32_t fPendingIdx;
+
+    /** The boundary most recently returned by next(), and its rule status index. */
+    int32_t fCurrent;
+    int32_t fCurrentStatusIndex;
+
+    UBool fFinished;
+};
+#endif  // U_HIDE_DRAFT_API
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_BREAK_ITERATION */
@@ -2779,6 +2779,82 @@ u_getIntPropertyMap(UProperty property, UErrorCode *pErrorCode);
 
 #endif  // U_HIDE_DRAFT_API
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Gets the values of an enumerated/catalog/int-valued property
+ * for each of an array of code points.
+ * Equivalent to calling ucpmap_get() on the u_getIntPropertyMap() for each code point,
+ * but the map is fetched only once, and the lookups avoid per-code point function calls.
+ * Code points outside of U+0000..U+10FFFF get the map's error value.
+ *
+ * @param property UCHAR_INT_START..UCHAR_INT_LIMIT-1
+ * @param codePoints the input code points; can be NULL if count==0
+ * @param count the number of code points; must be >=0
+ * @param values receives count property values; can be NULL if count==0
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @see u_getIntPropertyMap
+ * @see u_getIntPropertyValue
+ * @draft ICU 64
+ */
+U_CAPI void U_EXPORT2
+u_getIntPropertyValues(UProperty property,
+                       const UChar32 *codePoints, int32_t count,
+                       int32_t *values, UErrorCode *pErrorCode);
+
+/**
+ * Gets the values of an enumerated/catalog/int-valued property
+ * for each code point in a UTF-16 string.
+ * Writes one value per code point, in string order;
+ * an unpaired surrogate is treated as a code point of its own,
+ * with the same value as u_getIntPropertyValue() returns for it.
+ *
+ * The function supports preflighting:
+ * It returns the number of code points in the string.
+ * If that is greater than the capacity, then only the first capacity values are written
+ * and U_BUFFER_OVERFLOW_ERROR is set.
+ *
+ * @param property UCHAR_INT_START..UCHAR_INT_LIMIT-1
+ * @param s the input string; can be NULL if length==0
+ * @param length the length of s in UChars, or -1 if it is NUL-terminated
+ * @param values receives the property values; can be NULL if capacity==0
+ * @param capacity the number of int32_t values that fit into the values array
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of code points in s
+ * @see u_getIntPropertyValues
+ * @draft ICU 64
+ */
+U_CAPI int32_t U_EXPORT2
+u_strGetIntPropertyValues(UProperty property,
+                          const UChar *s, int32_t length,
+                          int32_t *values, int32_t capacity,
+                          UErrorCode *pErrorCode);
+
+/**
+ * Gets the values of an enumerated/catalog/int-valued property
+ * for each code point in a UTF-8 string.
+ * Like u_strGetIntPropertyValues(), except that
+ * each maximal ill-formed subsequence counts as one code point
+ * and gets the value of U+FFFD.
+ *
+ * @param property UCHAR_INT_START..UCHAR_INT_LIMIT-1
+ * @param s the input string; can be NULL if length==0
+ * @param length the length of s in bytes, or -1 if it is NUL-terminated
+ * @param values receives the property values; can be NULL if capacity==0
+ * @param capacity the number of int32_t values that fit into the values array
+ * @param pErrorCode an in/out ICU UErrorCode
+ * @return the number of code points in s
+ * @see u_strGetIntPropertyValues
+ * @draft ICU 64
+ */
+U_CAPI int32_t U_EXPORT2
+u_strGetIntPropertyValuesUTF8(UProperty property,
+                              const char *s, int32_t length,
+                              int32_t *values, int32_t capacity,
+                              UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
 /**
  * Get the numeric value for a Unicode code point as defined in the
  * Unicode Character Database.
@@ -3556,6 +3632,42 @@ u_enumCharNames(UChar32 start, UChar32 limit,
                 UCharNameChoice nameChoice,
                 UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Enumerate the Unicode characters whose names start with the given prefix,
+ * for example for autocompletion, and call a function for each,
+ * passing the code point value and the character name.
+ * The prefix is matched case-insensitively, like in u_charFromName().
+ * An empty prefix matches all names.
+ *
+ * Names from the Unicode Character Database are enumerated in ascending
+ * order of their bytes, followed by algorithmically derived names
+ * (like "CJK UNIFIED IDEOGRAPH-4E00") in code point order.
+ * Extended names like "<control-0000>" are not enumerated.
+ *
+ * The first call for a nameChoice builds an index of the names,
+ * which is kept until u_cleanup().
+ *
+ * @param prefix The prefix to match.
+ * @param fn The function that is to be called for each character name.
+ * @param context An arbitrary pointer that is passed to the function.
+ * @param nameChoice Selector for which kind of names to enumerate.
+ * @param pErrorCode Pointer to a UErrorCode variable
+ *
+ * @see UCharNameChoice
+ * @see UEnumCharNamesFn
+ * @see u_charFromName
+ * @see u_enumCharNames
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+u_enumCharNamesByPrefix(const char *prefix,
+                        UEnumCharNamesFn *fn,
+                        void *context,
+                        UCharNameChoice nameChoice,
+                        UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Return the Unicode name for a given property, as given in the
  * Unicode database file PropertyAliases.txt.
@@ -588,6 +588,84 @@ U_NAMESPACE_END
 
 #endif
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Returns a converter for the given name from a pool owned by the calling thread,
+ * or opens a new one if the pool has none.
+ * This avoids the cost of ucnv_open() for code that repeatedly opens and closes
+ * converters for the same charsets, such as one converter per request.
+ *
+ * The converter is in the same state as one returned by ucnv_open():
+ * It has been reset, and it has the default callbacks and substitution characters.
+ * It must be returned to the pool with ucnv_release() on the same thread,
+ * or it can be closed with ucnv_close().
+ *
+ * A converter is found in the pool if converterName is the same as
+ * (or an alias of) the canonical name of a released converter.
+ * Pool lookups do not lock any mutex.
+ *
+ * @param converterName name of the coded character set table, as for ucnv_open()
+ * @param err error status
+ * @return the converter, or NULL if an error occurred
+ * @see ucnv_release
+ * @see ucnv_open
+ * @draft ICU 64
+ */
+U_DRAFT UConverter * U_EXPORT2
+ucnv_acquire(const char *converterName, UErrorCode *err);
+
+/**
+ * Returns a converter to the calling thread's pool, for reuse by ucnv_acquire().
+ * The converter can come from ucnv_acquire() or ucnv_open().
+ *
+ * The converter is closed instead if the pool is full, or if it differs from
+ * a newly opened converter in ways that ucnv_reset() does not undo, for example
+ * if a callback or the substitution characters were changed.
+ * The converter must not be used after this call.
+ *
+ * Converters in a thread's pool are closed when the thread exits.
+ * ucnv_flushCache() closes the calling thread's pooled converters, and makes other
+ * threads close theirs on their next pool access, so that the converter data
+ * can be unloaded.
+ * u_cleanup() closes the pooled converters of all threads.
+ * As for all of ICU, no thread may be using ucnv_acquire() or ucnv_release()
+ * during u_cleanup().
+ *
+ * @param converter the converter; may be NULL
+ * @see ucnv_acquire
+ * @draft ICU 64
+ */
+U_DRAFT void U_EXPORT2
+ucnv_release(UConverter *converter);
+
+#if U_SHOW_CPLUSPLUS_API
+
+U_NAMESPACE_BEGIN
+
+/**
+ * \class LocalUConverterPoolPointer
+ * "Smart pointer" class; returns a UConverter to the calling thread's pool
+ * via ucnv_release().
+ * For most methods see the LocalPointerBase base class.
+ *
+ * Usage:
+ *
+ *     LocalUConverterPoolPointer cnv(ucnv_acquire("Shift_JIS", &errorCode));
+ *     // no need to explicitly call ucnv_release()
+ *
+ * @see LocalPointerBase
+ * @see LocalPointer
+ * @draft ICU 64
+ */
+U_DEFINE_LOCAL_OPEN_POINTER(LocalUConverterPoolPointer, UConverter, ucnv_release);
+
+U_NAMESPACE_END
+
+#endif
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Fills in the output parameter, subChars, with the substitution characters
  * as multiple bytes.
@@ -1570,6 +1648,96 @@ ucnv_convert(const char *toConverterName,
              int32_t sourceLength,
              UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * One of the tasks that ucnv_convertParallel() passes to a UConverterRunTasksFn.
+ *
+ * @param task  The task pointer, which the function converts one piece of the text for.
+ * @see UConverterRunTasksFn
+ * @draft ICU 64
+ */
+typedef void U_CALLCONV UConverterTaskFn(void *task);
+
+/**
+ * Function supplied by the caller of ucnv_convertParallel()
+ * for running the conversion of pieces of the text on its threads.
+ * ICU does not create threads itself.
+ *
+ * The function must call fn(tasks[i]) exactly once for each i from 0 to count-1,
+ * and return only after all of these calls have returned.
+ * The calls may be made in any order, and concurrently on up to count threads.
+ * If the function cannot use other threads, then it makes the calls
+ * one after the other on the calling thread.
+ *
+ * @param context   The runContext that was passed into ucnv_convertParallel().
+ * @param fn        The function to call for each task.
+ * @param tasks     Array of task pointers.
+ * @param count     Number of tasks, at most the numThreads passed into ucnv_convertParallel().
+ * @see ucnv_convertParallel
+ * @draft ICU 64
+ */
+typedef void U_CALLCONV
+UConverterRunTasksFn(const void *context, UConverterTaskFn *fn, void *tasks[], int32_t count);
+
+/**
+ * Convert from one external charset to another, like ucnv_convert(),
+ * but with open converters and converting large input on several threads.
+ *
+ * The source text is split into segments at character boundaries,
+ * and the segments are converted by the caller's runTasks function,
+ * usually concurrently, each with its own clone of the two converters.
+ * The results are concatenated into the target buffer.
+ * The result is the same as with serial conversion.
+ *
+ * Splitting is only possible when neither converter carries state
+ * from one character to the next:
+ * The source charset must be UTF-8, UTF-16BE/LE, UTF-32BE/LE, US-ASCII, ISO-8859-1,
+ * or an SBCS/DBCS/MBCS table charset without SI/SO shifts;
+ * for table charsets, segments end after single-byte characters that cannot be trail bytes
+ * and that are not inside a multiple-character mapping.
+ * The target charset must be one of the same, without multiple-character mappings.
+ * Both converters must use the callbacks from ucnv_err.h,
+ * because user callbacks may not be safe to call from several threads.
+ * Otherwise, for short input, and without a runTasks function,
+ * the text is converted on the calling thread.
+ *
+ * As with ucnv_convert(), the output is NUL-terminated if possible,
+ * and the full output length is returned even when it exceeds the targetCapacity
+ * ("preflighting"). If a conversion error occurs, then the output up to
+ * and including the failing segment is written and its length returned.
+ * Segment output is buffered in temporary memory before it is copied to the target.
+ *
+ * @param targetCnv         Output converter. It is reset before the conversion.
+ * @param sourceCnv         Input converter. It is reset before the conversion.
+ * @param target            Pointer to the output buffer.
+ * @param targetCapacity    Capacity of the target, in bytes.
+ * @param source            Pointer to the input buffer.
+ * @param sourceLength      Length of the input text, in bytes, or -1 for NUL-terminated input.
+ * @param numThreads        Maximum number of segments to be converted concurrently.
+ *                          0 and 1 convert the text on the calling thread.
+ * @param runTasks          Function that runs the segment conversions on the caller's threads,
+ *                          or NULL to convert the text on the calling thread.
+ * @param runContext        Context pointer passed into runTasks.
+ * @param pErrorCode        ICU error code in/out parameter.
+ *                          Must fulfill U_SUCCESS before the function call.
+ * @return Length of the complete output text in bytes, even if it exceeds the targetCapacity
+ *         and a U_BUFFER_OVERFLOW_ERROR is set.
+ *
+ * @see ucnv_convert
+ * @see ucnv_convertEx
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnv_convertParallel(UConverter *targetCnv, UConverter *sourceCnv,
+                     char *target, int32_t targetCapacity,
+                     const char *source, int32_t sourceLength,
+                     int32_t numThreads,
+                     UConverterRunTasksFn *runTasks, const void *runContext,
+                     UErrorCode *pErrorCode);
+
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Convert from one external charset to another.
  * Internally, the text is converted to and from the 16-bit Unicode "pivot"
@@ -39,7 +39,9 @@
  * corresponding converters which can convert the string.
  *
  * A converter selector can be serialized into a buffer and reopened
- * from the serialized form.
+ * from the serialized form. The serialized form can be stored in a file
+ * and memory-mapped; ucnvsel_openFromSerialized() uses it in place
+ * (unless it needs to be swapped), which is much faster than ucnvsel_open().
  */
 
 /**
@@ -184,6 +186,87 @@ U_STABLE UEnumeration * U_EXPORT2
 ucnvsel_selectForUTF8(const UConverterSelector* sel,
                       const char *s, int32_t length, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Returns the number of encodings that the selector was built with.
+ * Their indexes are the bit positions in the masks from
+ * ucnvsel_selectForStrings() and ucnvsel_selectForUTF8Strings().
+ *
+ * @param sel a selector
+ * @param status an in/out ICU UErrorCode
+ * @return the number of encodings
+ *
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnvsel_countEncodings(const UConverterSelector* sel, UErrorCode *status);
+
+/**
+ * Returns the name of one of the encodings that the selector was built with.
+ *
+ * @param sel a selector
+ * @param index the index of the encoding, 0..ucnvsel_countEncodings()-1
+ * @param status an in/out ICU UErrorCode;
+ *               U_INDEX_OUTOFBOUNDS_ERROR if the index is out of range
+ * @return the encoding name; valid as long as the selector
+ *
+ * @draft ICU 64
+ */
+U_DRAFT const char * U_EXPORT2
+ucnvsel_getEncoding(const UConverterSelector* sel, int32_t index, UErrorCode *status);
+
+/**
+ * Select converters for each of several UTF-16 strings, ignoring the excluded code points.
+ * This is faster than calling ucnvsel_selectForString() for each string,
+ * especially for short strings, because it does not allocate any memory.
+ *
+ * The result for each string is a mask of (ucnvsel_countEncodings()+31)/32
+ * 32-bit words, one bit per encoding: Bit (j%32) of word (j/32) of the mask
+ * is set if encoding j can map all characters of the string.
+ * The masks are stored one after the other.
+ *
+ * @param sel a selector
+ * @param strings the UTF-16 strings
+ * @param lengths the lengths of the strings, -1 for NUL-terminated ones;
+ *                can be NULL if all strings are NUL-terminated
+ * @param count the number of strings
+ * @param masks receives the masks
+ * @param capacity the number of uint32_t words available at masks
+ * @param status an in/out ICU UErrorCode;
+ *               U_BUFFER_OVERFLOW_ERROR if the capacity is too small
+ * @return the number of uint32_t words needed for the masks of all of the strings
+ *
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnvsel_selectForStrings(const UConverterSelector* sel,
+                         const UChar *const *strings, const int32_t *lengths, int32_t count,
+                         uint32_t *masks, int32_t capacity, UErrorCode *status);
+
+/**
+ * Select converters for each of several UTF-8 strings, ignoring the excluded code points.
+ * Same as ucnvsel_selectForStrings() but for UTF-8 strings.
+ *
+ * @param sel a selector
+ * @param strings the UTF-8 strings
+ * @param lengths the lengths of the strings, -1 for NUL-terminated ones;
+ *                can be NULL if all strings are NUL-terminated
+ * @param count the number of strings
+ * @param masks receives the masks
+ * @param capacity the number of uint32_t words available at masks
+ * @param status an in/out ICU UErrorCode;
+ *               U_BUFFER_OVERFLOW_ERROR if the capacity is too small
+ * @return the number of uint32_t words needed for the masks of all of the strings
+ *
+ * @see ucnvsel_selectForStrings
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+ucnvsel_selectForUTF8Strings(const UConverterSelector* sel,
+                             const char *const *strings, const int32_t *lengths, int32_t count,
+                             uint32_t *masks, int32_t capacity, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #endif  /* !UCONFIG_NO_CONVERSION */
 
 #endif  /* __ICU_UCNV_SEL_H__ */
@@ -591,6 +591,43 @@ class U_COMMON_API UnicodeSet U_FINAL : public UnicodeFilter {
      */
     UnicodeFunctor *cloneAsThawed() const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns a frozen set for the given pattern from a process-wide cache.
+     * The pattern is parsed only the first time that it is requested with
+     * the same options; later calls, from any thread, return the same set.
+     * Failures are cached as well.
+     *
+     * The pattern string itself is the cache key: Equivalent patterns
+     * spelled differently are parsed and cached separately.
+     * Cached sets are never evicted, so this is intended for a bounded number
+     * of patterns, such as fixed property sets used by a component.
+     *
+     * The set is owned by ICU and remains valid until u_cleanup().
+     *
+     * @param pattern a string specifying what characters are in the set
+     * @param options bitmask for options to apply to the pattern.
+     * Valid options are USET_IGNORE_SPACE and USET_CASE_INSENSITIVE.
+     * @param status returns <code>U_ILLEGAL_ARGUMENT_ERROR</code> if the pattern
+     * contains a syntax error.
+     * @return the frozen set, or NULL if an error occurred
+     * @draft ICU 64
+     */
+    static const UnicodeSet *getFrozenInstance(const UnicodeString &pattern, uint32_t options,
+                                               UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Returns the approximate number of bytes of memory that freeze() allocated
+     * for fast contains() and span(), not counting the inversion list and strings.
+     * For sets with many supplementary ranges this includes a code point trie.
+     * @return the number of bytes, or 0 if the set is not frozen
+     * @internal
+     */
+    int32_t getFrozenMemoryUsage() const;
+#endif  /* U_HIDE_INTERNAL_API */
+
     //----------------------------------------------------------------
     // Public API
     //----------------------------------------------------------------
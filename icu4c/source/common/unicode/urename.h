@@ -196,6 +196,9 @@
 #define res_getString U_ICU_ENTRY_POINT_RENAME(res_getString)
 #define res_getTableItemByIndex U_ICU_ENTRY_POINT_RENAME(res_getTableItemByIndex)
 #define res_getTableItemByKey U_ICU_ENTRY_POINT_RENAME(res_getTableItemByKey)
+#define res_getTableItemByKeyHash U_ICU_ENTRY_POINT_RENAME(res_getTableItemByKeyHash)
+#define res_hashKey U_ICU_ENTRY_POINT_RENAME(res_hashKey)
+#define res_hashTableKey U_ICU_ENTRY_POINT_RENAME(res_hashTableKey)
 #define res_load U_ICU_ENTRY_POINT_RENAME(res_load)
 #define res_read U_ICU_ENTRY_POINT_RENAME(res_read)
 #define res_unload U_ICU_ENTRY_POINT_RENAME(res_unload)
@@ -218,6 +221,7 @@
 #define u_countChar32 U_ICU_ENTRY_POINT_RENAME(u_countChar32)
 #define u_digit U_ICU_ENTRY_POINT_RENAME(u_digit)
 #define u_enumCharNames U_ICU_ENTRY_POINT_RENAME(u_enumCharNames)
+#define u_enumCharNamesByPrefix U_ICU_ENTRY_POINT_RENAME(u_enumCharNamesByPrefix)
 #define u_enumCharTypes U_ICU_ENTRY_POINT_RENAME(u_enumCharTypes)
 #define u_errorName U_ICU_ENTRY_POINT_RENAME(u_errorName)
 #define u_fadopt U_ICU_ENTRY_POINT_RENAME(u_fadopt)
@@ -267,6 +271,7 @@
 #define u_getIntPropertyMaxValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyMaxValue)
 #define u_getIntPropertyMinValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyMinValue)
 #define u_getIntPropertyValue U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValue)
+#define u_getIntPropertyValues U_ICU_ENTRY_POINT_RENAME(u_getIntPropertyValues)
 #define u_getMainProperties U_ICU_ENTRY_POINT_RENAME(u_getMainProperties)
 #define u_getNumericValue U_ICU_ENTRY_POINT_RENAME(u_getNumericValue)
 #define u_getPropertyEnum U_ICU_ENTRY_POINT_RENAME(u_getPropertyEnum)
@@ -344,6 +349,7 @@
 #define u_sscanf U_ICU_ENTRY_POINT_RENAME(u_sscanf)
 #define u_sscanf_u U_ICU_ENTRY_POINT_RENAME(u_sscanf_u)
 #define u_strCaseCompare U_ICU_ENTRY_POINT_RENAME(u_strCaseCompare)
+#define u_strCaseCompareUTF8 U_ICU_ENTRY_POINT_RENAME(u_strCaseCompareUTF8)
 #define u_strCompare U_ICU_ENTRY_POINT_RENAME(u_strCompare)
 #define u_strCompareIter U_ICU_ENTRY_POINT_RENAME(u_strCompareIter)
 #define u_strFindFirst U_ICU_ENTRY_POINT_RENAME(u_strFindFirst)
@@ -357,6 +363,8 @@
 #define u_strFromUTF8Lenient U_ICU_ENTRY_POINT_RENAME(u_strFromUTF8Lenient)
 #define u_strFromUTF8WithSub U_ICU_ENTRY_POINT_RENAME(u_strFromUTF8WithSub)
 #define u_strFromWCS U_ICU_ENTRY_POINT_RENAME(u_strFromWCS)
+#define u_strGetIntPropertyValues U_ICU_ENTRY_POINT_RENAME(u_strGetIntPropertyValues)
+#define u_strGetIntPropertyValuesUTF8 U_ICU_ENTRY_POINT_RENAME(u_strGetIntPropertyValuesUTF8)
 #define u_strHasMoreChar32Than U_ICU_ENTRY_POINT_RENAME(u_strHasMoreChar32Than)
 #define u_strToJavaModifiedUTF8 U_ICU_ENTRY_POINT_RENAME(u_strToJavaModifiedUTF8)
 #define u_strToLower U_ICU_ENTRY_POINT_RENAME(u_strToLower)
@@ -590,14 +598,17 @@
 #define ucln_io_registerCleanup U_ICU_ENTRY_POINT_RENAME(ucln_io_registerCleanup)
 #define ucln_lib_cleanup U_ICU_ENTRY_POINT_RENAME(ucln_lib_cleanup)
 #define ucln_registerCleanup U_ICU_ENTRY_POINT_RENAME(ucln_registerCleanup)
+#define ucnv_MBCSCanSplitToUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSCanSplitToUnicode)
 #define ucnv_MBCSFromUChar32 U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSFromUChar32)
 #define ucnv_MBCSFromUnicodeWithOffsets U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSFromUnicodeWithOffsets)
 #define ucnv_MBCSGetFilteredUnicodeSetForUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSGetFilteredUnicodeSetForUnicode)
 #define ucnv_MBCSGetType U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSGetType)
 #define ucnv_MBCSGetUnicodeSetForUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSGetUnicodeSetForUnicode)
 #define ucnv_MBCSIsLeadByte U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSIsLeadByte)
+#define ucnv_MBCSIsSplitAfterByte U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSIsSplitAfterByte)
 #define ucnv_MBCSSimpleGetNextUChar U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSSimpleGetNextUChar)
 #define ucnv_MBCSToUnicodeWithOffsets U_ICU_ENTRY_POINT_RENAME(ucnv_MBCSToUnicodeWithOffsets)
+#define ucnv_acquire U_ICU_ENTRY_POINT_RENAME(ucnv_acquire)
 #define ucnv_bld_countAvailableConverters U_ICU_ENTRY_POINT_RENAME(ucnv_bld_countAvailableConverters)
 #define ucnv_bld_getAvailableConverter U_ICU_ENTRY_POINT_RENAME(ucnv_bld_getAvailableConverter)
 #define ucnv_canCreateConverter U_ICU_ENTRY_POINT_RENAME(ucnv_canCreateConverter)
@@ -610,6 +621,7 @@
 #define ucnv_compareNames U_ICU_ENTRY_POINT_RENAME(ucnv_compareNames)
 #define ucnv_convert U_ICU_ENTRY_POINT_RENAME(ucnv_convert)
 #define ucnv_convertEx U_ICU_ENTRY_POINT_RENAME(ucnv_convertEx)
+#define ucnv_convertParallel U_ICU_ENTRY_POINT_RENAME(ucnv_convertParallel)
 #define ucnv_countAliases U_ICU_ENTRY_POINT_RENAME(ucnv_countAliases)
 #define ucnv_countAvailable U_ICU_ENTRY_POINT_RENAME(ucnv_countAvailable)
 #define ucnv_countStandards U_ICU_ENTRY_POINT_RENAME(ucnv_countStandards)
@@ -624,6 +636,7 @@
 #define ucnv_extGetUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_extGetUnicodeSet)
 #define ucnv_extInitialMatchFromU U_ICU_ENTRY_POINT_RENAME(ucnv_extInitialMatchFromU)
 #define ucnv_extInitialMatchToU U_ICU_ENTRY_POINT_RENAME(ucnv_extInitialMatchToU)
+#define ucnv_extIsPartialMatchToU U_ICU_ENTRY_POINT_RENAME(ucnv_extIsPartialMatchToU)
 #define ucnv_extSimpleMatchFromU U_ICU_ENTRY_POINT_RENAME(ucnv_extSimpleMatchFromU)
 #define ucnv_extSimpleMatchToU U_ICU_ENTRY_POINT_RENAME(ucnv_extSimpleMatchToU)
 #define ucnv_fixFileSeparator U_ICU_ENTRY_POINT_RENAME(ucnv_fixFileSeparator)
@@ -674,6 +687,7 @@
 #define ucnv_openPackage U_ICU_ENTRY_POINT_RENAME(ucnv_openPackage)
 #define ucnv_openStandardNames U_ICU_ENTRY_POINT_RENAME(ucnv_openStandardNames)
 #define ucnv_openU U_ICU_ENTRY_POINT_RENAME(ucnv_openU)
+#define ucnv_release U_ICU_ENTRY_POINT_RENAME(ucnv_release)
 #define ucnv_reset U_ICU_ENTRY_POINT_RENAME(ucnv_reset)
 #define ucnv_resetFromUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetFromUnicode)
 #define ucnv_resetToUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetToUnicode)
@@ -696,10 +710,14 @@
 #define ucnv_unloadSharedDataIfReady U_ICU_ENTRY_POINT_RENAME(ucnv_unloadSharedDataIfReady)
 #define ucnv_usesFallback U_ICU_ENTRY_POINT_RENAME(ucnv_usesFallback)
 #define ucnvsel_close U_ICU_ENTRY_POINT_RENAME(ucnvsel_close)
+#define ucnvsel_countEncodings U_ICU_ENTRY_POINT_RENAME(ucnvsel_countEncodings)
+#define ucnvsel_getEncoding U_ICU_ENTRY_POINT_RENAME(ucnvsel_getEncoding)
 #define ucnvsel_open U_ICU_ENTRY_POINT_RENAME(ucnvsel_open)
 #define ucnvsel_openFromSerialized U_ICU_ENTRY_POINT_RENAME(ucnvsel_openFromSerialized)
 #define ucnvsel_selectForString U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForString)
+#define ucnvsel_selectForStrings U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForStrings)
 #define ucnvsel_selectForUTF8 U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8)
+#define ucnvsel_selectForUTF8Strings U_ICU_ENTRY_POINT_RENAME(ucnvsel_selectForUTF8Strings)
 #define ucnvsel_serialize U_ICU_ENTRY_POINT_RENAME(ucnvsel_serialize)
 #define ucol_cloneBinary U_ICU_ENTRY_POINT_RENAME(ucol_cloneBinary)
 #define ucol_close U_ICU_ENTRY_POINT_RENAME(ucol_close)
@@ -785,6 +803,7 @@
 #define ucsdet_close U_ICU_ENTRY_POINT_RENAME(ucsdet_close)
 #define ucsdet_detect U_ICU_ENTRY_POINT_RENAME(ucsdet_detect)
 #define ucsdet_detectAll U_ICU_ENTRY_POINT_RENAME(ucsdet_detectAll)
+#define ucsdet_enableFastMode U_ICU_ENTRY_POINT_RENAME(ucsdet_enableFastMode)
 #define ucsdet_enableInputFilter U_ICU_ENTRY_POINT_RENAME(ucsdet_enableInputFilter)
 #define ucsdet_getAllDetectableCharsets U_ICU_ENTRY_POINT_RENAME(ucsdet_getAllDetectableCharsets)
 #define ucsdet_getConfidence U_ICU_ENTRY_POINT_RENAME(ucsdet_getConfidence)
@@ -792,6 +811,7 @@
 #define ucsdet_getLanguage U_ICU_ENTRY_POINT_RENAME(ucsdet_getLanguage)
 #define ucsdet_getName U_ICU_ENTRY_POINT_RENAME(ucsdet_getName)
 #define ucsdet_getUChars U_ICU_ENTRY_POINT_RENAME(ucsdet_getUChars)
+#define ucsdet_isFastModeEnabled U_ICU_ENTRY_POINT_RENAME(ucsdet_isFastModeEnabled)
 #define ucsdet_isInputFilterEnabled U_ICU_ENTRY_POINT_RENAME(ucsdet_isInputFilterEnabled)
 #define ucsdet_open U_ICU_ENTRY_POINT_RENAME(ucsdet_open)
 #define ucsdet_setDeclaredEncoding U_ICU_ENTRY_POINT_RENAME(ucsdet_setDeclaredEncoding)
@@ -979,6 +999,7 @@
 #define uhash_removeAll U_ICU_ENTRY_POINT_RENAME(uhash_removeAll)
 #define uhash_removeElement U_ICU_ENTRY_POINT_RENAME(uhash_removeElement)
 #define uhash_removei U_ICU_ENTRY_POINT_RENAME(uhash_removei)
+#define uhash_setGroupProbing U_ICU_ENTRY_POINT_RENAME(uhash_setGroupProbing)
 #define uhash_setKeyComparator U_ICU_ENTRY_POINT_RENAME(uhash_setKeyComparator)
 #define uhash_setKeyDeleter U_ICU_ENTRY_POINT_RENAME(uhash_setKeyDeleter)
 #define uhash_setKeyHasher U_ICU_ENTRY_POINT_RENAME(uhash_setKeyHasher)
@@ -1254,6 +1275,7 @@
 #define uprv_add32_overflow U_ICU_ENTRY_POINT_RENAME(uprv_add32_overflow)
 #define uprv_aestrncpy U_ICU_ENTRY_POINT_RENAME(uprv_aestrncpy)
 #define uprv_asciiFromEbcdic U_ICU_ENTRY_POINT_RENAME(uprv_asciiFromEbcdic)
+#define uprv_asciiToUCharsAVX2 U_ICU_ENTRY_POINT_RENAME(uprv_asciiToUCharsAVX2)
 #define uprv_asciitolower U_ICU_ENTRY_POINT_RENAME(uprv_asciitolower)
 #define uprv_calloc U_ICU_ENTRY_POINT_RENAME(uprv_calloc)
 #define uprv_ceil U_ICU_ENTRY_POINT_RENAME(uprv_ceil)
@@ -1360,6 +1382,7 @@
 #define uprv_fmin U_ICU_ENTRY_POINT_RENAME(uprv_fmin)
 #define uprv_fmod U_ICU_ENTRY_POINT_RENAME(uprv_fmod)
 #define uprv_free U_ICU_ENTRY_POINT_RENAME(uprv_free)
+#define uprv_getCPUFeatures U_ICU_ENTRY_POINT_RENAME(uprv_getCPUFeatures)
 #define uprv_getCharNameCharacters U_ICU_ENTRY_POINT_RENAME(uprv_getCharNameCharacters)
 #define uprv_getDefaultLocaleID U_ICU_ENTRY_POINT_RENAME(uprv_getDefaultLocaleID)
 #define uprv_getInfinity U_ICU_ENTRY_POINT_RENAME(uprv_getInfinity)
@@ -1511,6 +1534,7 @@
 #define ures_getBinary U_ICU_ENTRY_POINT_RENAME(ures_getBinary)
 #define ures_getByIndex U_ICU_ENTRY_POINT_RENAME(ures_getByIndex)
 #define ures_getByKey U_ICU_ENTRY_POINT_RENAME(ures_getByKey)
+#define ures_getByKeyPathFast U_ICU_ENTRY_POINT_RENAME(ures_getByKeyPathFast)
 #define ures_getByKeyWithFallback U_ICU_ENTRY_POINT_RENAME(ures_getByKeyWithFallback)
 #define ures_getFunctionalEquivalent U_ICU_ENTRY_POINT_RENAME(ures_getFunctionalEquivalent)
 #define ures_getInt U_ICU_ENTRY_POINT_RENAME(ures_getInt)
@@ -1538,6 +1562,7 @@
 #define ures_getVersionNumber U_ICU_ENTRY_POINT_RENAME(ures_getVersionNumber)
 #define ures_getVersionNumberInternal U_ICU_ENTRY_POINT_RENAME(ures_getVersionNumberInternal)
 #define ures_hasNext U_ICU_ENTRY_POINT_RENAME(ures_hasNext)
+#define ures_initKeyPath U_ICU_ENTRY_POINT_RENAME(ures_initKeyPath)
 #define ures_initStackObject U_ICU_ENTRY_POINT_RENAME(ures_initStackObject)
 #define ures_open U_ICU_ENTRY_POINT_RENAME(ures_open)
 #define ures_openAvailableLocales U_ICU_ENTRY_POINT_RENAME(ures_openAvailableLocales)
@@ -1621,6 +1646,7 @@
 #define uset_containsString U_ICU_ENTRY_POINT_RENAME(uset_containsString)
 #define uset_equals U_ICU_ENTRY_POINT_RENAME(uset_equals)
 #define uset_freeze U_ICU_ENTRY_POINT_RENAME(uset_freeze)
+#define uset_getFrozenInstance U_ICU_ENTRY_POINT_RENAME(uset_getFrozenInstance)
 #define uset_getItem U_ICU_ENTRY_POINT_RENAME(uset_getItem)
 #define uset_getItemCount U_ICU_ENTRY_POINT_RENAME(uset_getItemCount)
 #define uset_getSerializedRange U_ICU_ENTRY_POINT_RENAME(uset_getSerializedRange)
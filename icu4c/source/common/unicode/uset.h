@@ -305,6 +305,37 @@ uset_openPatternOptions(const UChar* pattern, int32_t patternLength,
                  uint32_t options,
                  UErrorCode* ec);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Returns a frozen set for the given pattern from a process-wide cache.
+ * The pattern is parsed only the first time that it is requested with
+ * the same options; later calls, from any thread, return the same set.
+ * Failures are cached as well.
+ *
+ * The pattern string itself is the cache key: Equivalent patterns
+ * spelled differently are parsed and cached separately.
+ * Cached sets are never evicted, so this is intended for a bounded number
+ * of patterns, such as fixed property sets used by a component.
+ *
+ * The set is owned by ICU and remains valid until u_cleanup().
+ * It must not be modified or closed.
+ *
+ * @param pattern a string specifying what characters are in the set
+ * @param patternLength the length of the pattern, or -1 if null
+ * terminated
+ * @param options bitmask for options to apply to the pattern.
+ * Valid options are USET_IGNORE_SPACE and USET_CASE_INSENSITIVE.
+ * @param ec the error code
+ * @return the frozen set, or NULL if an error occurred
+ * @see uset_openPatternOptions
+ * @draft ICU 64
+ */
+U_DRAFT const USet* U_EXPORT2
+uset_getFrozenInstance(const UChar* pattern, int32_t patternLength,
+                       uint32_t options,
+                       UErrorCode* ec);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Disposes of the storage used by a USet object.  This function should
  * be called exactly once for objects returned by uset_open().
@@ -543,6 +543,52 @@ u_strCaseCompare(const UChar *s1, int32_t length1,
                  uint32_t options,
                  UErrorCode *pErrorCode);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Compare two UTF-8 strings case-insensitively using full case folding.
+ * This is the UTF-8 version of u_strCaseCompare():
+ * For well-formed strings, the result has the same sign as u_strCaseCompare()
+ * on the UTF-16 versions of the strings, with the same options.
+ * Each ill-formed UTF-8 sequence compares like U+FFFD.
+ *
+ * The strings are case-folded incrementally, only as far as needed
+ * for finding the first difference. Runs of ASCII characters are compared
+ * several bytes at a time.
+ *
+ * NUL-terminated strings are possible with length arguments of -1.
+ *
+ * @param s1 First source string.
+ * @param length1 Length of first source string, or -1 if NUL-terminated.
+ *
+ * @param s2 Second source string.
+ * @param length2 Length of second source string, or -1 if NUL-terminated.
+ *
+ * @param options A bit set of options:
+ *   - U_FOLD_CASE_DEFAULT or 0 is used for default options:
+ *     Comparison in UTF-16 code unit order with default case folding.
+ *
+ *   - U_COMPARE_CODE_POINT_ORDER
+ *     Set to choose code point order instead of code unit order
+ *     (see u_strCompare for details).
+ *     This is the same as the order of the UTF-8 bytes.
+ *
+ *   - U_FOLD_CASE_EXCLUDE_SPECIAL_I
+ *
+ * @param pErrorCode Must be a valid pointer to an error code value,
+ *                  which must not indicate a failure before the function call.
+ *
+ * @return <0 or 0 or >0 as usual for string comparisons
+ *
+ * @see u_strCaseCompare
+ * @draft ICU 64
+ */
+U_DRAFT int32_t U_EXPORT2
+u_strCaseCompareUTF8(const char *s1, int32_t length1,
+                     const char *s2, int32_t length2,
+                     uint32_t options,
+                     UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Compare two ustrings for bitwise equality. 
  * Compares at most <code>n</code> characters.
@@ -21,8 +21,7 @@
 #include "umutex.h"
 
 static icu::UnifiedCache *gCache = NULL;
-static icu::UMutex gCacheMutex = U_MUTEX_INITIALIZER;
-static icu::UConditionVar gInProgressValueAddedCond = U_CONDITION_INITIALIZER;
+static icu::UMutex gCacheMutex = U_MUTEX_INITIALIZER;  // For eviction, flushing and the eviction policy.
 static icu::UInitOnce gCacheInitOnce = U_INITONCE_INITIALIZER;
 
 static const int32_t MAX_EVICT_ITERATIONS = 10;
@@ -91,9 +90,71 @@ UnifiedCache *UnifiedCache::getInstance(UErrorCode &status) {
     return gCache;
 }
 
-UnifiedCache::UnifiedCache(UErrorCode &status) :
+UnifiedCache::Shard::Shard() :
         fHashtable(NULL),
         fEvictPos(UHASH_FIRST),
+        fReaders(0),
+        fLocked(0),
+        fReaderWaiters(0) {
+}
+
+UnifiedCache::Shard::~Shard() {
+    uhash_close(fHashtable);
+}
+
+void UnifiedCache::Shard::lock() {
+    umtx_lock(&fMutex);
+    waitForReaders();
+}
+
+// Waits for lock-free readers that started before fLocked was set.
+// They only look up one entry and add a reference to its value.
+// The last one to leave wakes us up if fReaderWaiters is not zero.
+// Another thread may lock and unlock the shard while we wait,
+// so we set fLocked again each time we wake up.
+void UnifiedCache::Shard::waitForReaders() {
+    fReaderWaiters.fetch_add(1);
+    fLocked.store(1);
+    while (fReaders.load() != 0) {
+        umtx_condWait(&fReadersDoneCond, &fMutex);
+        fLocked.store(1);
+    }
+    fReaderWaiters.fetch_sub(1);
+}
+
+void UnifiedCache::Shard::unlock() {
+    fLocked.store(0);
+    umtx_unlock(&fMutex);
+}
+
+UBool UnifiedCache::Shard::beginRead() {
+    fReaders.fetch_add(1);
+    if (fLocked.load() != 0) {
+        endRead();  // This may be the last reader that a waiting thread needs to see leave.
+        return FALSE;
+    }
+    return TRUE;
+}
+
+void UnifiedCache::Shard::endRead() {
+    if (fReaders.fetch_sub(1) == 1 && fReaderWaiters.load() != 0) {
+        // Broadcast under the mutex so that the waiter cannot miss it
+        // between its check of fReaders and its condition wait.
+        umtx_lock(&fMutex);
+        umtx_condBroadcast(&fReadersDoneCond);
+        umtx_unlock(&fMutex);
+    }
+}
+
+void UnifiedCache::Shard::waitForValue() {
+    fLocked.store(0);
+    umtx_condWait(&fInProgressValueAddedCond, &fMutex);
+    waitForReaders();
+}
+
+UnifiedCache::UnifiedCache(UErrorCode &status) :
+        fEvictShard(0),
+        fNumKeys(0),
         fNumValuesTotal(0),
         fNumValuesInUse(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
@@ -112,15 +173,18 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
     fNoValue->cachePtr = this;
 
-    fHashtable = uhash_open(
-            &ucache_hashKeys,
-            &ucache_compareKeys,
-            NULL,
-            &status);
-    if (U_FAILURE(status)) {
-        return;
+    for (int32_t i = 0; i < kShardCount; ++i) {
+        UHashtable *hashtable = uhash_open(
+                &ucache_hashKeys,
+                &ucache_compareKeys,
+                NULL,
+                &status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        uhash_setKeyDeleter(hashtable, &ucache_deleteKey);
+        fShards[i].fHashtable = hashtable;
     }
-    uhash_setKeyDeleter(fHashtable, &ucache_deleteKey);
 }
 
 void UnifiedCache::setEvictionPolicy(
@@ -139,7 +203,7 @@ void UnifiedCache::setEvictionPolicy(
 
 int32_t UnifiedCache::unusedCount() const {
     Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable) - fNumValuesInUse;
+    return umtx_loadAcquire(fNumKeys) - umtx_loadAcquire(fNumValuesInUse);
 }
 
 int64_t UnifiedCache::autoEvictedCount() const {
@@ -149,7 +213,7 @@ int64_t UnifiedCache::autoEvictedCount() const {
 
 int32_t UnifiedCache::keyCount() const {
     Mutex lock(&gCacheMutex);
-    return uhash_count(fHashtable);
+    return umtx_loadAcquire(fNumKeys);
 }
 
 void UnifiedCache::flush() const {
@@ -162,8 +226,7 @@ void UnifiedCache::flush() const {
 }
 
 void UnifiedCache::handleUnreferencedObject() const {
-    Mutex lock(&gCacheMutex);
-    --fNumValuesInUse;
+    umtx_atomic_dec(&fNumValuesInUse);
     _runEvictionSlice();
 }
 
@@ -189,28 +252,33 @@ void UnifiedCache::dumpContents() const {
 // On entry, gCacheMutex must be held.
 // On exit, cache contents dumped to stderr.
 void UnifiedCache::_dumpContents() const {
-    int32_t pos = UHASH_FIRST;
-    const UHashElement *element = uhash_nextElement(fHashtable, &pos);
     char buffer[256];
     int32_t cnt = 0;
-    for (; element != NULL; element = uhash_nextElement(fHashtable, &pos)) {
-        const SharedObject *sharedObject =
-                (const SharedObject *) element->value.pointer;
-        const CacheKeyBase *key =
-                (const CacheKeyBase *) element->key.pointer;
-        if (sharedObject->hasHardReferences()) {
-            ++cnt;
-            fprintf(
-                    stderr,
-                    "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
-                    key->writeDescription(buffer, 256),
-                    key->creationStatus,
-                    sharedObject == fNoValue ? NULL :sharedObject,
-                    sharedObject->getRefCount(),
-                    sharedObject->getSoftRefCount());
+    for (int32_t i = 0; i < kShardCount; ++i) {
+        Shard &shard = fShards[i];
+        shard.lock();
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element = uhash_nextElement(shard.fHashtable, &pos);
+        for (; element != NULL; element = uhash_nextElement(shard.fHashtable, &pos)) {
+            const SharedObject *sharedObject =
+                    (const SharedObject *) element->value.pointer;
+            const CacheKeyBase *key =
+                    (const CacheKeyBase *) element->key.pointer;
+            if (sharedObject->hasHardReferences()) {
+                ++cnt;
+                fprintf(
+                        stderr,
+                        "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
+                        key->writeDescription(buffer, 256),
+                        key->creationStatus,
+                        sharedObject == fNoValue ? NULL :sharedObject,
+                        sharedObject->getRefCount(),
+                        sharedObject->getSoftRefCount());
+            }
         }
+        shard.unlock();
     }
-    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(fHashtable));
+    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, umtx_loadAcquire(fNumKeys));
 }
 #endif
 
@@ -224,76 +292,93 @@ UnifiedCache::~UnifiedCache() {
         Mutex lock(&gCacheMutex);
         _flush(TRUE);
     }
-    uhash_close(fHashtable);
-    fHashtable = nullptr;
     delete fNoValue;
     fNoValue = nullptr;
 }
 
-const UHashElement *
-UnifiedCache::_nextElement() const {
-    const UHashElement *element = uhash_nextElement(fHashtable, &fEvictPos);
-    if (element == NULL) {
-        fEvictPos = UHASH_FIRST;
-        return uhash_nextElement(fHashtable, &fEvictPos);
-    }
-    return element;
+UnifiedCache::Shard &
+UnifiedCache::_shardFor(const CacheKeyBase &key) const {
+    // Use the high bits of the scrambled hash code; the hash tables
+    // use the hash code modulo their (prime) lengths.
+    uint32_t hash = (uint32_t)key.hashCode() * 0x9e3779b9u;
+    return fShards[hash >> 28];
+}
+
+void UnifiedCache::_removeElement(Shard &shard, const UHashElement *element) const {
+    const SharedObject *sharedObject =
+            (const SharedObject *) element->value.pointer;
+    U_ASSERT(sharedObject->cachePtr == this);
+    uhash_removeElement(shard.fHashtable, element);
+    umtx_atomic_dec(&fNumKeys);
+    removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
 }
 
 UBool UnifiedCache::_flush(UBool all) const {
     UBool result = FALSE;
-    int32_t origSize = uhash_count(fHashtable);
-    for (int32_t i = 0; i < origSize; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
-        }
-        if (all || _isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            U_ASSERT(sharedObject->cachePtr == this);
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
-            result = TRUE;
+    for (int32_t i = 0; i < kShardCount; ++i) {
+        Shard &shard = fShards[i];
+        shard.lock();
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element;
+        while ((element = uhash_nextElement(shard.fHashtable, &pos)) != nullptr) {
+            if (all || _isEvictable(element)) {
+                _removeElement(shard, element);
+                result = TRUE;
+            }
         }
+        shard.unlock();
     }
     return result;
 }
 
 int32_t UnifiedCache::_computeCountOfItemsToEvict() const {
-    int32_t totalItems = uhash_count(fHashtable);
-    int32_t evictableItems = totalItems - fNumValuesInUse;
+    int32_t totalItems = umtx_loadAcquire(fNumKeys);
+    int32_t numValuesInUse = umtx_loadAcquire(fNumValuesInUse);
+    int32_t evictableItems = totalItems - numValuesInUse;
 
-    int32_t unusedLimitByPercentage = fNumValuesInUse * fMaxPercentageOfInUse / 100;
-    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused);
+    int32_t unusedLimitByPercentage = numValuesInUse * fMaxPercentageOfInUse.load() / 100;
+    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused.load());
     int32_t countOfItemsToEvict = std::max(0, evictableItems - unusedLimit);
     return countOfItemsToEvict;
 }
 
 void UnifiedCache::_runEvictionSlice() const {
-    int32_t maxItemsToEvict = _computeCountOfItemsToEvict();
-    if (maxItemsToEvict <= 0) {
+    // Check without locking first: This is called whenever a cached value
+    // loses its last hard reference.
+    if (_computeCountOfItemsToEvict() <= 0) {
         return;
     }
-    for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
-        }
-        if (_isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    (const SharedObject *) element->value.pointer;
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
-            ++fAutoEvictedCount;
-            if (--maxItemsToEvict == 0) {
+    Mutex lock(&gCacheMutex);
+    int32_t maxItemsToEvict = _computeCountOfItemsToEvict();
+    int32_t i = 0;
+    // While gCacheMutex is held, keys are only added, not removed, by other threads.
+    // Each pass through all of the shards therefore examines at least one element.
+    while (maxItemsToEvict > 0 && i < MAX_EVICT_ITERATIONS && umtx_loadAcquire(fNumKeys) > 0) {
+        Shard &shard = fShards[fEvictShard];
+        shard.lock();
+        const UHashElement *element;
+        while ((element = uhash_nextElement(shard.fHashtable, &shard.fEvictPos)) != nullptr) {
+            ++i;
+            if (_isEvictable(element)) {
+                _removeElement(shard, element);   // Deletes sharedObject when SoftRefCount goes to zero.
+                ++fAutoEvictedCount;
+                --maxItemsToEvict;
+            }
+            if (maxItemsToEvict == 0 || i == MAX_EVICT_ITERATIONS) {
                 break;
             }
         }
+        if (element == nullptr) {
+            // Continue round robin with the next shard.
+            shard.fEvictPos = UHASH_FIRST;
+            fEvictShard = (fEvictShard + 1) % kShardCount;
+        }
+        shard.unlock();
     }
 }
 
 void UnifiedCache::_putNew(
+        Shard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -310,10 +395,11 @@ void UnifiedCache::_putNew(
     if (value->softRefCount == 0) {
         _registerMaster(keyToAdopt, value);
     }
-    void *oldValue = uhash_put(fHashtable, keyToAdopt, (void *) value, &status);
+    void *oldValue = uhash_put(shard.fHashtable, keyToAdopt, (void *) value, &status);
     U_ASSERT(oldValue == nullptr);
     (void)oldValue;
     if (U_SUCCESS(status)) {
+        umtx_atomic_inc(&fNumKeys);
         value->softRefCount++;
     }
 }
@@ -322,19 +408,22 @@ void UnifiedCache::_putIfAbsentAndGet(
         const CacheKeyBase &key,
         const SharedObject *&value,
         UErrorCode &status) const {
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    Shard &shard = _shardFor(key);
+    shard.lock();
+    const UHashElement *element = uhash_find(shard.fHashtable, &key);
     if (element != NULL && !_inProgress(element)) {
         _fetch(element, value, status);
+        shard.unlock();
         return;
     }
     if (element == NULL) {
         UErrorCode putError = U_ZERO_ERROR;
         // best-effort basis only.
-        _putNew(key, value, status, putError);
+        _putNew(shard, key, value, status, putError);
     } else {
-        _put(element, value, status);
+        _put(shard, element, value, status);
     }
+    shard.unlock();
     // Run an eviction slice. This will run even if we added a master entry
     // which doesn't increase the unused count, but that is still o.k
     _runEvictionSlice();
@@ -347,28 +436,50 @@ UBool UnifiedCache::_poll(
         UErrorCode &status) const {
     U_ASSERT(value == NULL);
     U_ASSERT(status == U_ZERO_ERROR);
-    Mutex lock(&gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    Shard &shard = _shardFor(key);
+
+    // Fast path: Fetch an existing value without locking.
+    if (shard.beginRead()) {
+        const UHashElement *element = uhash_find(shard.fHashtable, &key);
+        UBool found = FALSE;
+        if (element != NULL) {
+            const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
+            const SharedObject *theValue = (const SharedObject *) element->value.pointer;
+            found = !_inProgress(theValue, theKey->fCreationStatus);
+            if (found) {
+                _fetch(element, value, status);
+            }
+        }
+        shard.endRead();
+        if (found) {
+            return TRUE;
+        }
+    }
+
+    shard.lock();
+    const UHashElement *element = uhash_find(shard.fHashtable, &key);
 
     // If the hash table contains an inProgress placeholder entry for this key,
     // this means that another thread is currently constructing the value object.
     // Loop, waiting for that construction to complete.
      while (element != NULL && _inProgress(element)) {
-        umtx_condWait(&gInProgressValueAddedCond, &gCacheMutex);
-        element = uhash_find(fHashtable, &key);
+        shard.waitForValue();
+        element = uhash_find(shard.fHashtable, &key);
     }
 
     // If the hash table contains an entry for the key,
     // fetch out the contents and return them.
     if (element != NULL) {
          _fetch(element, value, status);
+        shard.unlock();
         return TRUE;
     }
 
     // The hash table contained nothing for this key.
     // Insert an inProgress place holder value.
     // Our caller will create the final value and update the hash table.
-    _putNew(key, fNoValue, U_ZERO_ERROR, status);
+    _putNew(shard, key, fNoValue, U_ZERO_ERROR, status);
+    shard.unlock();
     return FALSE;
 }
 
@@ -404,11 +515,12 @@ void UnifiedCache::_registerMaster(
             const CacheKeyBase *theKey, const SharedObject *value) const {
     theKey->fIsMaster = true;
     value->cachePtr = this;
-    ++fNumValuesTotal;
-    ++fNumValuesInUse;
+    umtx_atomic_inc(&fNumValuesTotal);
+    umtx_atomic_inc(&fNumValuesInUse);
 }
 
 void UnifiedCache::_put(
+        Shard &shard,
         const UHashElement *element,
         const SharedObject *value,
         const UErrorCode status) const {
@@ -427,7 +539,7 @@ void UnifiedCache::_put(
 
     // Tell waiting threads that we replace in-progress status with
     // an error.
-    umtx_condBroadcast(&gInProgressValueAddedCond);
+    umtx_condBroadcast(&shard.fInProgressValueAddedCond);
 }
 
 void UnifiedCache::_fetch(
@@ -437,9 +549,9 @@ void UnifiedCache::_fetch(
     const CacheKeyBase *theKey = (const CacheKeyBase *) element->key.pointer;
     status = theKey->fCreationStatus;
 
-    // Since we have the cache lock, calling regular SharedObject add/removeRef
+    // Since we may have locked the shard, calling regular SharedObject add/removeRef
     // could cause us to deadlock on ourselves since they may need to lock
-    // the cache mutex.
+    // the cache mutex and the shards.
     removeHardRef(value);
     value = static_cast<const SharedObject *>(element->value.pointer);
     addHardRef(value);
@@ -473,14 +585,16 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
 
     // We can evict entries that are either not a master or have just
     // one reference (The one reference being from the cache itself).
-    return (!theKey->fIsMaster || (theValue->softRefCount == 1 && theValue->noHardReferences()));
+    // Check the hard references first: Another shard may add an entry for the
+    // same value, and increments softRefCount before it releases its hard reference.
+    return (!theKey->fIsMaster || (theValue->noHardReferences() && theValue->softRefCount == 1));
 }
 
 void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     U_ASSERT(value->cachePtr == this);
     U_ASSERT(value->softRefCount > 0);
     if (--value->softRefCount == 0) {
-        --fNumValuesTotal;
+        umtx_atomic_dec(&fNumValuesTotal);
         if (value->noHardReferences()) {
             delete value;
         } else {
@@ -498,7 +612,7 @@ int32_t UnifiedCache::removeHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_dec(&value->hardRefCount);
         U_ASSERT(refCount >= 0);
         if (refCount == 0) {
-            --fNumValuesInUse;
+            umtx_atomic_dec(&fNumValuesInUse);
         }
     }
     return refCount;
@@ -510,7 +624,7 @@ int32_t UnifiedCache::addHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_inc(&value->hardRefCount);
         U_ASSERT(refCount >= 1);
         if (refCount == 1) {
-            fNumValuesInUse++;
+            umtx_atomic_inc(&fNumValuesInUse);
         }
     }
     return refCount;
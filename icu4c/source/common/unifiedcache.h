@@ -18,6 +18,7 @@
 #include "unicode/uobject.h"
 #include "unicode/locid.h"
 #include "sharedobject.h"
+#include "umutex.h"
 #include "unicode/unistr.h"
 #include "cstring.h"
 #include "ustr_imp.h"
@@ -179,6 +180,11 @@ class LocaleCacheKey : public CacheKey<T> {
  * The unified cache. A singleton type.
  * Design doc here:
  * https://docs.google.com/document/d/1RwGQJs4N4tawNbf809iYDRCvXoMKqDJihxzYt1ysmd8/edit?usp=sharing
+ *
+ * The entries are partitioned into shards by key hash code.
+ * Fetching an existing value locks nothing; creating and storing a value
+ * locks only the key's shard. Eviction and flushing visit the shards
+ * one at a time while holding the cache-wide eviction mutex.
  */
 class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
  public:
@@ -345,12 +351,63 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    virtual ~UnifiedCache();
    
  private:
-   UHashtable *fHashtable;
-   mutable int32_t fEvictPos;
-   mutable int32_t fNumValuesTotal;
-   mutable int32_t fNumValuesInUse;
-   int32_t fMaxUnused;
-   int32_t fMaxPercentageOfInUse;
+   /** Number of hash-sharded partitions. */
+   enum { kShardCount = 16 };
+
+   /**
+    * One hash-sharded partition of the cache, with its own hash table and lock.
+    *
+    * Lookups of existing entries do not take the lock. They only register
+    * in the readers count, and fall back to locking if the shard is locked.
+    * Code that locks the shard waits for the registered readers to leave,
+    * so that while the shard is locked, nothing else accesses its hash table.
+    */
+   struct Shard : public UMemory {
+       Shard();
+       ~Shard();
+
+       /**
+        * Locks the shard, then waits (without spinning) for lock-free readers to leave.
+        * gCacheMutex may be held by the caller but must not be acquired
+        * while the shard is locked.
+        */
+       void lock();
+       void unlock();
+
+       /**
+        * Starts a lock-free lookup.
+        * @return TRUE if the hash table may be read until endRead(),
+        *         FALSE if the shard is locked and the caller must lock it instead.
+        */
+       UBool beginRead();
+       void endRead();
+
+       /**
+        * Waits for an in-progress entry to be replaced.
+        * The shard must be locked by the caller, and is locked again on return.
+        */
+       void waitForValue();
+
+       /** Waits for lock-free readers to leave. The shard mutex must be held. */
+       void waitForReaders();
+
+       UHashtable *fHashtable;
+       int32_t fEvictPos;
+       UMutex fMutex;
+       UConditionVar fInProgressValueAddedCond;
+       UConditionVar fReadersDoneCond;
+       u_atomic_int32_t fReaders;
+       u_atomic_int32_t fLocked;
+       u_atomic_int32_t fReaderWaiters;
+   };
+
+   mutable Shard fShards[kShardCount];
+   mutable int32_t fEvictShard;
+   mutable u_atomic_int32_t fNumKeys;
+   mutable u_atomic_int32_t fNumValuesTotal;
+   mutable u_atomic_int32_t fNumValuesInUse;
+   u_atomic_int32_t fMaxUnused;
+   u_atomic_int32_t fMaxPercentageOfInUse;
    mutable int64_t fAutoEvictedCount;
    SharedObject *fNoValue;
    
@@ -361,7 +418,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * Flushes the contents of the cache. If cache values hold references to other
     * cache values then _flush should be called in a loop until it returns FALSE.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, gCacheMutex must be held, and no shard may be locked.
     * On exit, those values with are evictable are flushed.
     * 
     *  @param all if false flush evictable items only, which are those with no external
@@ -395,6 +452,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
      * Attempts to fetch value and status for key from cache.
      * On entry, gCacheMutex must not be held value must be NULL and status must
      * be U_ZERO_ERROR.
+     * Hits on entries that are not in progress do not lock the key's shard.
      * On exit, either returns FALSE (In this
      * case caller should try to create the object) or returns TRUE with value
      * pointing to the fetched value and status set to fetched status. When
@@ -409,11 +467,13 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     
     /**
      * Places a new value and creationStatus in the cache for the given key.
-     * On entry, gCacheMutex must be held. key must not exist in the cache. 
+     * On entry, shard must be the key's shard and must be locked.
+     * key must not exist in the cache. 
      * On exit, value and creation status placed under key. Soft reference added
      * to value on successful add. On error sets status.
      */
     void _putNew(
+        Shard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -438,11 +498,15 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
            UErrorCode &status) const;
 
     /**
-     * Returns the next element in the cache round robin style.
-     * Returns nullptr if the cache is empty.
-     * On entry, gCacheMutex must be held.
+     * Returns the shard for the given key.
+     */
+    Shard &_shardFor(const CacheKeyBase &key) const;
+
+    /**
+     * Removes an element from the cache and its soft reference from its value.
+     * On entry, shard must be the element's shard and must be locked.
      */
-    const UHashElement *_nextElement() const;
+    void _removeElement(Shard &shard, const UHashElement *element) const;
    
    /**
     * Return the number of cache items that would need to be evicted
@@ -450,15 +514,18 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * 
     * An item corresponds to an entry in the hash table, a hash table element.
     * 
-    * On entry, gCacheMutex must be held.
+    * Does not need any lock; the result is exact only while gCacheMutex is held
+    * and no other thread uses the cache.
     */
    int32_t _computeCountOfItemsToEvict() const;
    
    /**
-    * Run an eviction slice.
-    * On entry, gCacheMutex must be held.
+    * Run an eviction slice if the cache has more unused entries than the eviction
+    * policy allows.
+    * On entry, gCacheMutex must not be held, and no shard may be locked.
     * _runEvictionSlice runs a slice of the evict pipeline by examining the next
-    * 10 entries in the cache round robin style evicting them if they are eligible.
+    * 10 entries in the cache round robin style (one shard after another)
+    * evicting them if they are eligible.
     */
    void _runEvictionSlice() const;
  
@@ -468,7 +535,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * produce referneces to an already existing SharedObject are not masters -
     * they can be evicted and subsequently recreated.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the key's shard must be locked.
     * On exit, items in use count incremented, entry is marked as a master
     * entry, and value registered with cache so that subsequent calls to
     * addRef() and removeRef() on it correctly interact with the cache.
@@ -477,27 +544,28 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
         
    /**
     * Store a value and creation error status in given hash entry.
-    * On entry, gCacheMutex must be held. Hash entry element must be in progress.
-    * value must be non NULL.
+    * On entry, shard must be the element's shard and must be locked.
+    * Hash entry element must be in progress. value must be non NULL.
     * On Exit, soft reference added to value. value and status stored in hash
     * entry. Soft reference removed from previous stored value. Waiting
     * threads notified.
     */
    void _put(
+           Shard &shard,
            const UHashElement *element,
            const SharedObject *value,
            const UErrorCode status) const;
     /**
      * Remove a soft reference, and delete the SharedObject if no references remain.
      * To be used from within the UnifiedCache implementation only.
-     * gCacheMutex must be held by caller.
+     * The shard of the entry that held the soft reference must be locked by the caller.
      * @param value the SharedObject to be acted on.
      */
    void removeSoftRef(const SharedObject *value) const;
    
    /**
     * Increment the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * The caller must have locked or be reading the shard where value was found.
     * Update numValuesEvictable on transitions between zero and one reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -507,7 +575,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
   /**
     * Decrement the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * The caller must have locked or be reading a shard.
     * Update numValuesEvictable on transitions between one and zero reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -522,7 +590,8 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
    /**
     *  Fetch value and error code from a particular hash entry.
-    *  On entry, gCacheMutex must be held. value must be either NULL or must be
+    *  On entry, the element's shard must be locked or being read (beginRead()).
+    *  value must be either NULL or must be
     *  included in the ref count of the object to which it points.
     *  On exit, value and status set to what is in the hash entry. Caller must
     *  eventually call removeRef on value.
@@ -534,19 +603,18 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
                        
     /**
      * Determine if given hash entry is in progress.
-     * On entry, gCacheMutex must be held.
+     * On entry, the element's shard must be locked or being read.
      */
    UBool _inProgress(const UHashElement *element) const;
    
    /**
     * Determine if given hash entry is in progress.
-    * On entry, gCacheMutex must be held.
     */
    UBool _inProgress(const SharedObject *theValue, UErrorCode creationStatus) const;
    
    /**
     * Determine if given hash entry is eligible for eviction.
-    * On entry, gCacheMutex must be held.
+    * On entry, the element's shard must be locked.
     */
    UBool _isEvictable(const UHashElement *element) const;
 };
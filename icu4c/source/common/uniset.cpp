@@ -2203,6 +2203,16 @@ UnicodeFunctor *UnicodeSet::freeze() {
     return this;
 }
 
+int32_t UnicodeSet::getFrozenMemoryUsage() const {
+    if (bmpSet != NULL) {
+        return bmpSet->getMemoryUsage();
+    }
+    if (stringSpan != NULL) {
+        return stringSpan->getMemoryUsage();
+    }
+    return 0;
+}
+
 int32_t UnicodeSet::span(const UChar *s, int32_t length, USetSpanCondition spanCondition) const {
     if(length>0 && bmpSet!=NULL) {
         return (int32_t)(bmpSet->span(s, s+length, spanCondition)-s);
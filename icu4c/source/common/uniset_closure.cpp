@@ -19,6 +19,8 @@
 *   to simplify dependencies.
 *   In particular, this depends on the BreakIterator, but the BreakIterator
 *   code also builds UnicodeSets from patterns and needs uniset_props.
+*
+*   UnicodeSet::getFrozenInstance() is here because it takes the options.
 */
 
 #include "unicode/brkiter.h"
@@ -26,8 +28,12 @@
 #include "unicode/parsepos.h"
 #include "unicode/uniset.h"
 #include "cmemory.h"
+#include "mutex.h"
 #include "ruleiter.h"
+#include "sharedobject.h"
 #include "ucase.h"
+#include "ucln_cmn.h"
+#include "unifiedcache.h"
 #include "util.h"
 #include "uvector.h"
 
@@ -38,6 +44,100 @@ U_NAMESPACE_BEGIN
 // memory leak checker tools
 #define _dbgct(me)
 
+namespace {
+
+// A frozen set in the UnifiedCache, for UnicodeSet::getFrozenInstance().
+class FrozenUnicodeSet : public SharedObject {
+public:
+    FrozenUnicodeSet(const UnicodeString &pattern, uint32_t options, UErrorCode &errorCode)
+            : set(pattern, options, NULL, errorCode) {
+        set.freeze();
+    }
+    virtual ~FrozenUnicodeSet() {}
+
+    UnicodeSet set;
+};
+
+// Each cached set with one reference that is released only by the cleanup function,
+// so that the UnifiedCache never evicts the sets that getFrozenInstance() returned.
+UVector *gFrozenSets = NULL;
+UMutex gFrozenSetsMutex = U_MUTEX_INITIALIZER;
+
+UBool U_CALLCONV uniset_cache_cleanup() {
+    if (gFrozenSets != NULL) {
+        for (int32_t i = 0; i < gFrozenSets->size(); ++i) {
+            static_cast<const FrozenUnicodeSet *>(gFrozenSets->elementAt(i))->removeRef();
+        }
+        delete gFrozenSets;
+        gFrozenSets = NULL;
+    }
+    return TRUE;
+}
+
+class FrozenUnicodeSetKey : public CacheKey<FrozenUnicodeSet> {
+public:
+    FrozenUnicodeSetKey(const UnicodeString &pattern, uint32_t options)
+            : fPattern(pattern), fOptions(options) {}
+    FrozenUnicodeSetKey(const FrozenUnicodeSetKey &other)
+            : CacheKey<FrozenUnicodeSet>(other), fPattern(other.fPattern), fOptions(other.fOptions) {}
+    virtual ~FrozenUnicodeSetKey() {}
+
+    virtual int32_t hashCode() const {
+        return (int32_t)(37u * (37u * (uint32_t)CacheKey<FrozenUnicodeSet>::hashCode() +
+                                (uint32_t)fPattern.hashCode()) +
+                         fOptions);
+    }
+    virtual UBool operator == (const CacheKeyBase &other) const {
+        if (this == &other) {
+            return TRUE;
+        }
+        if (!CacheKey<FrozenUnicodeSet>::operator == (other)) {
+            return FALSE;
+        }
+        const FrozenUnicodeSetKey &o = static_cast<const FrozenUnicodeSetKey &>(other);
+        return fPattern == o.fPattern && fOptions == o.fOptions;
+    }
+    virtual CacheKeyBase *clone() const {
+        return new FrozenUnicodeSetKey(*this);
+    }
+    virtual const FrozenUnicodeSet *createObject(const void * /*unused*/, UErrorCode &status) const {
+        LocalPointer<FrozenUnicodeSet> result(new FrozenUnicodeSet(fPattern, fOptions, status), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        if (result->set.isBogus()) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return NULL;
+        }
+        Mutex lock(&gFrozenSetsMutex);
+        if (gFrozenSets == NULL) {
+            gFrozenSets = new UVector(status);
+            if (gFrozenSets == NULL) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            }
+            if (U_FAILURE(status)) {
+                delete gFrozenSets;
+                gFrozenSets = NULL;
+                return NULL;
+            }
+            ucln_common_registerCleanup(UCLN_COMMON_UNISET_CACHE, uniset_cache_cleanup);
+        }
+        gFrozenSets->addElement(result.getAlias(), status);
+        if (U_FAILURE(status)) {
+            return NULL;
+        }
+        result->addRef();  // for gFrozenSets
+        result->addRef();  // for the caller
+        return result.orphan();
+    }
+
+private:
+    UnicodeString fPattern;
+    uint32_t fOptions;
+};
+
+}  // namespace
+
 //----------------------------------------------------------------
 // Constructors &c
 //----------------------------------------------------------------
@@ -58,6 +158,26 @@ UnicodeSet::UnicodeSet(const UnicodeString& pattern, ParsePosition& pos,
     _dbgct(this);
 }
 
+const UnicodeSet *UnicodeSet::getFrozenInstance(const UnicodeString &pattern, uint32_t options,
+                                                UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const UnifiedCache *cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    const FrozenUnicodeSet *frozen = NULL;
+    cache->get(FrozenUnicodeSetKey(pattern, options), frozen, status);
+    if (U_FAILURE(status)) {
+        return NULL;
+    }
+    // gFrozenSets keeps the set alive; release the caller's reference.
+    const UnicodeSet *set = &frozen->set;
+    frozen->removeRef();
+    return set;
+}
+
 //----------------------------------------------------------------
 // Public API
 //----------------------------------------------------------------
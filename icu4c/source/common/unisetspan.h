@@ -74,6 +74,9 @@ class UnicodeSetStringSpan : public UMemory {
     // For fast UnicodeSet::contains(c).
     inline UBool contains(UChar32 c) const;
 
+    // For UnicodeSet::getFrozenMemoryUsage(), not counting the strings' span data.
+    inline int32_t getMemoryUsage() const;
+
     int32_t span(const UChar *s, int32_t length, USetSpanCondition spanCondition) const;
 
     int32_t spanBack(const UChar *s, int32_t length, USetSpanCondition spanCondition) const;
@@ -152,6 +155,14 @@ UBool UnicodeSetStringSpan::contains(UChar32 c) const {
     return spanSet.contains(c);
 }
 
+int32_t UnicodeSetStringSpan::getMemoryUsage() const {
+    int32_t size=(int32_t)sizeof(UnicodeSetStringSpan)+spanSet.getFrozenMemoryUsage();
+    if(pSpanNotSet!=NULL && pSpanNotSet!=&spanSet) {
+        size+=(int32_t)sizeof(UnicodeSet)+pSpanNotSet->getFrozenMemoryUsage();
+    }
+    return size;
+}
+
 U_NAMESPACE_END
 
 #endif
@@ -90,16 +90,16 @@ static UBool chopLocale(char *name) {
 }
 
 /**
- *  Internal function
+ *  Internal function.
+ *  Does not lock: The reference counts are atomic, and fParent pointers
+ *  are only ever set from NULL, while holding resbMutex.
  */
 static void entryIncrease(UResourceDataEntry *entry) {
-    umtx_lock(&resbMutex);
-    entry->fCountExisting++;
+    umtx_atomic_inc(&entry->fCountExisting);
     while(entry->fParent != NULL) {
       entry = entry->fParent;
-      entry->fCountExisting++;
+      umtx_atomic_inc(&entry->fCountExisting);
     }
-    umtx_unlock(&resbMutex);
 }
 
 /**
@@ -157,14 +157,14 @@ free_entry(UResourceDataEntry *entry) {
         uprv_free(entry->fPath);
     }
     if(entry->fPool != NULL) {
-        --entry->fPool->fCountExisting;
+        umtx_atomic_dec(&entry->fPool->fCountExisting);
     }
     alias = entry->fAlias;
     if(alias != NULL) {
         while(alias->fAlias != NULL) {
             alias = alias->fAlias;
         }
-        --alias->fCountExisting;
+        umtx_atomic_dec(&alias->fCountExisting);
     }
     uprv_free(entry);
 }
@@ -203,7 +203,7 @@ static int32_t ures_flushCache()
             /* 04/05/2002 [weiv] fCountExisting should now be accurate. If it's not zero, that means that    */
             /* some resource bundles are still open somewhere. */
 
-            if (resB->fCountExisting == 0) {
+            if (umtx_loadAcquire(resB->fCountExisting) == 0) {
                 rbDeletedNum++;
                 deletedMore = TRUE;
                 uhash_removeElement(cache, e);
@@ -241,7 +241,7 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
       resB = (UResourceDataEntry *) e->value.pointer;
       fprintf(stderr,"%s:%d: RB Cache: Entry @0x%p, refcount %d, name %s:%s.  Pool 0x%p, alias 0x%p, parent 0x%p\n",
               __FILE__, __LINE__,
-              (void*)resB, resB->fCountExisting,
+              (void*)resB, umtx_loadAcquire(resB->fCountExisting),
               resB->fName?resB->fName:"NULL",
               resB->fPath?resB->fPath:"NULL",
               (void*)resB->fPool,
@@ -258,8 +258,11 @@ U_CAPI UBool U_EXPORT2 ures_dumpCacheContents(void) {
 
 #endif
 
+static void freeOpenedEntries();
+
 static UBool U_CALLCONV ures_cleanup(void)
 {
+    freeOpenedEntries();
     if (cache != NULL) {
         ures_flushCache();
         uhash_close(cache);
@@ -347,7 +350,7 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
             return NULL;
         }
 
-        uprv_memset(r, 0, sizeof(UResourceDataEntry));
+        uprv_memset((void *)r, 0, sizeof(UResourceDataEntry));  // also zeroes the atomic count
         /*r->fHashKey = hashValue;*/
 
         setEntryName(r, name, status);
@@ -432,7 +435,7 @@ static UResourceDataEntry *init_entry(const char *localeID, const char *path, UE
         while(r->fAlias != NULL) {
             r = r->fAlias;
         }
-        r->fCountExisting++; /* we increase its reference count */
+        umtx_atomic_inc(&r->fCountExisting); /* we increase its reference count */
         /* if the resource has a warning */
         /* we don't want to overwrite a status with no error */
         if(r->fBogus != U_ZERO_ERROR && U_SUCCESS(*status)) {
@@ -477,8 +480,7 @@ findFirstExisting(const char* path, char* name,
             /* not to be used - as there might be parent   */
             /* lines in cache from previous openings that  */
             /* are not updated yet. */
-            r->fCountExisting--;
-            /*entryCloseInt(r);*/
+            umtx_atomic_dec(&r->fCountExisting);
             r = NULL;
             *status = U_USING_FALLBACK_WARNING;
         } else {
@@ -569,7 +571,7 @@ loadParentsExceptRoot(UResourceDataEntry *&t1,
             t1->fParent = t2;
             if (usingUSRData) {
                 // The USR override data wasn't found, set it to be deleted.
-                u2->fCountExisting = 0;
+                umtx_storeRelease(u2->fCountExisting, 0);
             }
         }
         t1 = t2;
@@ -624,6 +626,123 @@ enum UResOpenType {
 };
 typedef enum UResOpenType UResOpenType;
 
+/*
+ * Lock-free index of the entryOpen() and entryOpenDirect() results
+ * for repeated requests.
+ *
+ * The first open of a bundle loads the entries and their fallback chain
+ * while holding resbMutex, and then publishes the request with its result
+ * at the front of a hash bucket list. Later opens with the same request
+ * find it without locking and only increment the reference counts.
+ * Published items and the entries they point to are not modified or freed
+ * until ures_cleanup(), so readers need no protection beyond the
+ * release/acquire ordering of the bucket list heads.
+ * Results that depend on the default locale are not published.
+ */
+struct OpenedEntry {
+    OpenedEntry *next;
+    int32_t hash;
+    UResOpenType openType;
+    UErrorCode status;  // warning to return with the entry
+    UResourceDataEntry *entry;
+    const char *path;  // NULL for ICU data
+    const char *localeID;
+    // followed by the path and locale ID strings
+};
+
+static const int32_t OPENED_ENTRIES_BUCKET_COUNT = 256;
+static std::atomic<OpenedEntry *> gOpenedEntries[OPENED_ENTRIES_BUCKET_COUNT];
+
+static int32_t hashOpenRequest(const char *path, const char *localeID, UResOpenType openType) {
+    UHashTok namekey, pathkey;
+    namekey.pointer = (void *)localeID;
+    pathkey.pointer = (void *)path;
+    return uhash_hashChars(namekey)+37u*uhash_hashChars(pathkey)+(int32_t)openType;
+}
+
+static const OpenedEntry *findOpenedEntry(const char *path, const char *localeID,
+                                          UResOpenType openType, int32_t hash,
+                                          std::memory_order order) {
+    const OpenedEntry *item =
+        gOpenedEntries[hash & (OPENED_ENTRIES_BUCKET_COUNT - 1)].load(order);
+    for(; item != NULL; item = item->next) {
+        if(item->hash == hash && item->openType == openType &&
+                uprv_strcmp(item->localeID, localeID) == 0 &&
+                (item->path == NULL ? path == NULL :
+                    path != NULL && uprv_strcmp(item->path, path) == 0)) {
+            break;
+        }
+    }
+    return item;
+}
+
+/**
+ * Looks up a previous result for the request, without locking.
+ * @return the entry with incremented reference counts, or NULL if not found
+ */
+static UResourceDataEntry *getOpenedEntry(const char *path, const char *localeID,
+                                          UResOpenType openType, UErrorCode *status) {
+    const OpenedEntry *item = findOpenedEntry(path, localeID, openType,
+                                              hashOpenRequest(path, localeID, openType),
+                                              std::memory_order_acquire);
+    if(item == NULL) {
+        return NULL;
+    }
+    entryIncrease(item->entry);
+    if(item->status != U_ZERO_ERROR) {
+        *status = item->status;
+    }
+    return item->entry;
+}
+
+/**
+ * Publishes the result of a request.
+ * Ignores memory allocation failures: The request will just not be found.
+ *     CAUTION:  resbMutex must be locked when calling this function.
+ */
+static void putOpenedEntry(const char *path, const char *localeID, UResOpenType openType,
+                           UResourceDataEntry *entry, UErrorCode status) {
+    int32_t hash = hashOpenRequest(path, localeID, openType);
+    if(findOpenedEntry(path, localeID, openType, hash, std::memory_order_relaxed) != NULL) {
+        return;  // Another thread was first.
+    }
+    int32_t pathLength = path != NULL ? (int32_t)uprv_strlen(path) + 1 : 0;
+    int32_t localeIDLength = (int32_t)uprv_strlen(localeID) + 1;
+    OpenedEntry *item = (OpenedEntry *)uprv_malloc(
+        sizeof(OpenedEntry) + pathLength + localeIDLength);
+    if(item == NULL) {
+        return;
+    }
+    char *strings = (char *)(item + 1);
+    if(path != NULL) {
+        uprv_memcpy(strings, path, pathLength);
+        item->path = strings;
+    } else {
+        item->path = NULL;
+    }
+    uprv_memcpy(strings + pathLength, localeID, localeIDLength);
+    item->localeID = strings + pathLength;
+    item->hash = hash;
+    item->openType = openType;
+    item->status = status;
+    item->entry = entry;
+    std::atomic<OpenedEntry *> &head = gOpenedEntries[hash & (OPENED_ENTRIES_BUCKET_COUNT - 1)];
+    item->next = head.load(std::memory_order_relaxed);
+    head.store(item, std::memory_order_release);
+}
+
+static void freeOpenedEntries() {
+    for(int32_t i = 0; i < OPENED_ENTRIES_BUCKET_COUNT; ++i) {
+        OpenedEntry *item = gOpenedEntries[i].load(std::memory_order_relaxed);
+        while(item != NULL) {
+            OpenedEntry *next = item->next;
+            uprv_free(item);
+            item = next;
+        }
+        gOpenedEntries[i].store(NULL, std::memory_order_relaxed);
+    }
+}
+
 static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
                                      UResOpenType openType, UErrorCode* status) {
     U_ASSERT(openType != URES_OPEN_DIRECT);
@@ -635,6 +754,7 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
     UBool hasRealData = FALSE;
     UBool hasChopped = TRUE;
     UBool usingUSRData = U_USE_USRDATA && ( path == NULL || uprv_strncmp(path,U_ICUDATA_NAME,8) == 0);
+    UBool dependsOnDefault = FALSE;
 
     char name[ULOC_FULLNAME_CAPACITY];
     char usrDataPath[96];
@@ -645,6 +765,11 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
         return NULL;
     }
 
+    r = getOpenedEntry(path, localeID, openType, status);
+    if(r != NULL) {
+        return r;
+    }
+
     uprv_strncpy(name, localeID, sizeof(name) - 1);
     name[sizeof(name) - 1] = 0;
 
@@ -688,7 +813,7 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
                         r = u1;
                     } else {
                         /* the USR override data wasn't found, set it to be deleted */
-                        u1->fCountExisting = 0;
+                        umtx_storeRelease(u1->fCountExisting, 0);
                     }
                 }
             }
@@ -701,6 +826,9 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
 
         /* we could have reached this point without having any real data */
         /* if that is the case, we need to chain in the default locale   */
+        if(r==NULL && openType == URES_OPEN_LOCALE_DEFAULT_ROOT) {
+            dependsOnDefault = TRUE;
+        }
         if(r==NULL && openType == URES_OPEN_LOCALE_DEFAULT_ROOT && !isDefault && !isRoot) {
             /* insert default locale */
             uprv_strcpy(name, uloc_getDefault());
@@ -754,9 +882,13 @@ static UResourceDataEntry *entryOpen(const char* path, const char* localeID,
 
         // TODO: Does this ever loop?
         while(r != NULL && !isRoot && t1->fParent != NULL) {
-            t1->fParent->fCountExisting++;
+            umtx_atomic_inc(&t1->fParent->fCountExisting);
             t1 = t1->fParent;
         }
+
+        if(U_SUCCESS(*status) && !dependsOnDefault) {
+            putOpenedEntry(path, localeID, openType, r, intStatus);
+        }
     } /* umtx_lock */
 finishUnlock:
     umtx_unlock(&resbMutex);
@@ -784,12 +916,19 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
         return NULL;
     }
 
+    // NULL is the default locale, which can change.
+    UResourceDataEntry *r = localeID != NULL ?
+        getOpenedEntry(path, localeID, URES_OPEN_DIRECT, status) : NULL;
+    if(r != NULL) {
+        return r;
+    }
+
     umtx_lock(&resbMutex);
     // findFirstExisting() without fallbacks.
-    UResourceDataEntry *r = init_entry(localeID, path, status);
+    r = init_entry(localeID, path, status);
     if(U_SUCCESS(*status)) {
         if(r->fBogus != U_ZERO_ERROR) {
-            r->fCountExisting--;
+            umtx_atomic_dec(&r->fCountExisting);
             r = NULL;
         }
     } else {
@@ -818,56 +957,27 @@ entryOpenDirect(const char* path, const char* localeID, UErrorCode* status) {
     if(r != NULL) {
         // TODO: Does this ever loop?
         while(t1->fParent != NULL) {
-            t1->fParent->fCountExisting++;
+            umtx_atomic_inc(&t1->fParent->fCountExisting);
             t1 = t1->fParent;
         }
+        if(localeID != NULL) {
+            putOpenedEntry(path, localeID, URES_OPEN_DIRECT, r, U_ZERO_ERROR);
+        }
     }
     umtx_unlock(&resbMutex);
     return r;
 }
 
 /**
- * Functions to create and destroy resource bundles.
- *     CAUTION:  resbMutex must be locked when calling this function.
- */
-/* INTERNAL: */
-static void entryCloseInt(UResourceDataEntry *resB) {
-    UResourceDataEntry *p = resB;
-
-    while(resB != NULL) {
-        p = resB->fParent;
-        resB->fCountExisting--;
-
-        /* Entries are left in the cache. TODO: add ures_flushCache() to force a flush
-         of the cache. */
-/*
-        if(resB->fCountExisting <= 0) {
-            uhash_remove(cache, resB);
-            if(resB->fBogus == U_ZERO_ERROR) {
-                res_unload(&(resB->fData));
-            }
-            if(resB->fName != NULL) {
-                uprv_free(resB->fName);
-            }
-            if(resB->fPath != NULL) {
-                uprv_free(resB->fPath);
-            }
-            uprv_free(resB);
-        }
-*/
-
-        resB = p;
-    }
-}
-
-/** 
  *  API: closes a resource bundle and cleans up.
+ *  Does not lock, see entryIncrease().
+ *  Entries are left in the cache until ures_flushCache().
  */
-
 static void entryClose(UResourceDataEntry *resB) {
-  umtx_lock(&resbMutex);
-  entryCloseInt(resB);
-  umtx_unlock(&resbMutex);
+    while(resB != NULL) {
+        umtx_atomic_dec(&resB->fCountExisting);
+        resB = resB->fParent;
+    }
 }
 
 /*
@@ -1844,11 +1954,73 @@ static Resource getTableItemByKeyPath(const ResourceData *pResData, Resource tab
   return resource;
 }
 
-U_CAPI UResourceBundle* U_EXPORT2 
-ures_getByKeyWithFallback(const UResourceBundle *resB, 
-                          const char* inKey, 
-                          UResourceBundle *fillIn, 
-                          UErrorCode *status) {
+/*
+  Like getTableItemByKeyPath() but with the path already split and hashed.
+*/
+static Resource getTableItemByKeyPathHashes(const ResourceData *pResData, Resource table,
+                                            const UResKeyPath *keyPath) {
+  Resource resource = table;
+  for (int32_t i = 0; i < keyPath->length; ++i) {
+    if (!URES_IS_CONTAINER(RES_GET_TYPE(resource))) {
+      return RES_BOGUS;
+    }
+    int32_t t;
+    const char *key = keyPath->keys + keyPath->keyStarts[i];
+    resource = res_getTableItemByKeyHash(pResData, resource, &t, &key, keyPath->keyHashes[i]);
+    if (resource == RES_BOGUS) {
+      return RES_BOGUS;
+    }
+  }
+  return resource;
+}
+
+U_CAPI void U_EXPORT2
+ures_initKeyPath(UResKeyPath *keyPath, const char *path, UErrorCode *status) {
+    if (status == NULL || U_FAILURE(*status)) {
+        return;
+    }
+    if (keyPath == NULL || path == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    keyPath->length = 0;
+    int32_t pathLength = (int32_t)uprv_strlen(path);
+    if (pathLength >= URES_KEY_PATH_CAPACITY) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+        return;
+    }
+    uprv_memcpy(keyPath->path, path, pathLength + 1);
+    uprv_memcpy(keyPath->keys, path, pathLength + 1);
+    /* Same splitting as in getTableItemByKeyPath(). */
+    char *pathPart = keyPath->keys;
+    while (*pathPart) {
+        if (keyPath->length == URES_KEY_PATH_MAX_KEYS) {
+            keyPath->length = 0;
+            *status = U_BUFFER_OVERFLOW_ERROR;
+            return;
+        }
+        char *nextPathPart = uprv_strchr(pathPart, RES_PATH_SEPARATOR);
+        if (nextPathPart != NULL) {
+            *nextPathPart++ = 0;
+        } else {
+            nextPathPart = uprv_strchr(pathPart, 0);
+        }
+        keyPath->keyStarts[keyPath->length] = (uint8_t)(pathPart - keyPath->keys);
+        keyPath->keyHashes[keyPath->length] = res_hashKey(pathPart);
+        ++keyPath->length;
+        pathPart = nextPathPart;
+    }
+}
+
+/*
+  Implements ures_getByKeyWithFallback() and ures_getByKeyPathFast().
+  If keyPath is not NULL, then inKey==keyPath->path.
+*/
+static UResourceBundle *
+getByKeyWithFallback(const UResourceBundle *resB,
+                     const char* inKey, const UResKeyPath *keyPath,
+                     UResourceBundle *fillIn,
+                     UErrorCode *status) {
     Resource res = RES_BOGUS, rootRes = RES_BOGUS;
     /*UResourceDataEntry *realData = NULL;*/
     UResourceBundle *helper = NULL;
@@ -1863,7 +2035,11 @@ ures_getByKeyWithFallback(const UResourceBundle *resB,
 
     int32_t type = RES_GET_TYPE(resB->fRes);
     if(URES_IS_TABLE(type)) {
-        res = getTableItemByKeyPath(&(resB->fResData), resB->fRes, inKey);
+        if (keyPath != NULL) {
+            res = getTableItemByKeyPathHashes(&(resB->fResData), resB->fRes, keyPath);
+        } else {
+            res = getTableItemByKeyPath(&(resB->fResData), resB->fRes, inKey);
+        }
         const char* key = inKey;
         if(res == RES_BOGUS) {
             UResourceDataEntry *dataEntry = resB->fData;
@@ -1930,6 +2106,29 @@ ures_getByKeyWithFallback(const UResourceBundle *resB,
     return fillIn;
 }
 
+U_CAPI UResourceBundle* U_EXPORT2 
+ures_getByKeyWithFallback(const UResourceBundle *resB, 
+                          const char* inKey, 
+                          UResourceBundle *fillIn, 
+                          UErrorCode *status) {
+    return getByKeyWithFallback(resB, inKey, NULL, fillIn, status);
+}
+
+U_CAPI UResourceBundle* U_EXPORT2
+ures_getByKeyPathFast(const UResourceBundle *resB,
+                      const UResKeyPath *keyPath,
+                      UResourceBundle *fillIn,
+                      UErrorCode *status) {
+    if (status==NULL || U_FAILURE(*status)) {
+        return fillIn;
+    }
+    if (keyPath == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return fillIn;
+    }
+    return getByKeyWithFallback(resB, keyPath->path, keyPath, fillIn, status);
+}
+
 namespace {
 
 void getAllItemsWithFallback(
@@ -132,6 +132,72 @@ _res_findTable32Item(const ResourceData *pResData, const int32_t *keyOffsets, in
     return URESDATA_ITEM_NOT_FOUND;  /* not found or table is empty. */
 }
 
+U_CAPI uint32_t U_EXPORT2
+res_hashKey(const char *key) {
+    /* FNV-1a */
+    uint32_t hash=0x811c9dc5;
+    uint8_t c;
+    while((c=(uint8_t)*key++)!=0) {
+        hash=(hash^c)*0x1000193;
+    }
+    return hash;
+}
+
+U_CAPI uint32_t U_EXPORT2
+res_hashTableKey(Resource table, uint32_t keyHash) {
+    /* mix the bits so that the low bits select well-distributed slots */
+    uint32_t hash=keyHash^(table*0x9e3779b9);
+    hash^=hash>>16;
+    hash*=0x85ebca6b;
+    hash^=hash>>13;
+    return hash;
+}
+
+/*
+ * Looks up a key in the key hash index.
+ * Only for tables that the index covers.
+ * Exactly one of keys16 and keys32 is not NULL.
+ */
+static int32_t
+_res_findHashedTableItem(const ResourceData *pResData, Resource table,
+                         const uint16_t *keys16, const int32_t *keys32, int32_t length,
+                         const char *key, uint32_t keyHash, const char **realKey) {
+    const uint16_t *slots=pResData->keyHashSlots;
+    uint32_t mask=pResData->keyHashMask;
+    uint32_t i=res_hashTableKey(table, keyHash)&mask;
+    /* at most slotsLength probes, even for bad data */
+    for(uint32_t count=mask; ; --count) {
+        int32_t item=slots[i];
+        if(item==URES_KEY_HASH_EMPTY_SLOT) {
+            break;
+        }
+        /*
+         * The slot may belong to another table.
+         * A matching key at this index of this table is the answer
+         * because table keys are unique.
+         */
+        if(item<length) {
+            const char *tableKey=keys16!=NULL ?
+                RES_GET_KEY16(pResData, keys16[item]) : RES_GET_KEY32(pResData, keys32[item]);
+            if(uprv_strcmp(key, tableKey)==0) {
+                *realKey=tableKey;
+                return item;
+            }
+        }
+        if(count==0) {
+            break;
+        }
+        i=(i+1)&mask;
+    }
+    return URESDATA_ITEM_NOT_FOUND;
+}
+
+static inline UBool
+hasKeyHash(const ResourceData *pResData, int32_t length) {
+    return pResData->keyHashSlots!=NULL &&
+        pResData->keyHashMinTableLength<=length && length<0xffff;
+}
+
 /* helper for res_load() ---------------------------------------------------- */
 
 static UBool U_CALLCONV
@@ -226,6 +292,22 @@ res_init(ResourceData *pResData,
         ) {
             pResData->p16BitUnits=(const uint16_t *)(pResData->pRoot+indexes[URES_INDEX_KEYS_TOP]);
         }
+#if U_CHARSET_FAMILY==U_ASCII_FAMILY
+        /* formatVersion 2.1 & 3.1: optional key hash index */
+        int32_t keyHashLength=indexes[URES_INDEX_BUNDLE_TOP]-indexes[URES_INDEX_RESOURCES_TOP];
+        if(formatVersion[0]>=2 && formatVersion[1]>=1 && keyHashLength>=3) {
+            const int32_t *keyHash=pResData->pRoot+indexes[URES_INDEX_RESOURCES_TOP];
+            int32_t slotsLength=keyHash[1];
+            if( keyHash[0]==URES_KEY_HASH_SIGNATURE &&
+                slotsLength>0 && (slotsLength&(slotsLength-1))==0 &&
+                slotsLength<=(keyHashLength-3)*2
+            ) {
+                pResData->keyHashSlots=(const uint16_t *)(keyHash+3);
+                pResData->keyHashMask=(uint32_t)slotsLength-1;
+                pResData->keyHashMinTableLength=keyHash[2];
+            }
+        }
+#endif
     }
 
     if(formatVersion[0]==1 || U_CHARSET_FAMILY==U_ASCII_FAMILY) {
@@ -705,9 +787,13 @@ makeResourceFrom16(const ResourceData *pResData, int32_t res16) {
     return URES_MAKE_RESOURCE(URES_STRING_V2, res16);
 }
 
-U_CAPI Resource U_EXPORT2
-res_getTableItemByKey(const ResourceData *pResData, Resource table,
-                      int32_t *indexR, const char **key) {
+/*
+ * Looks up the key in the table, via the key hash index if it covers the table.
+ * If pKeyHash!=NULL then it points to res_hashKey(*key).
+ */
+static Resource
+getTableItemByKey(const ResourceData *pResData, Resource table,
+                  int32_t *indexR, const char **key, const uint32_t *pKeyHash) {
     uint32_t offset=RES_GET_OFFSET(table);
     int32_t length;
     int32_t idx;
@@ -719,7 +805,13 @@ res_getTableItemByKey(const ResourceData *pResData, Resource table,
         if (offset!=0) { /* empty if offset==0 */
             const uint16_t *p= (const uint16_t *)(pResData->pRoot+offset);
             length=*p++;
-            *indexR=idx=_res_findTableItem(pResData, p, length, *key, key);
+            if(hasKeyHash(pResData, length)) {
+                uint32_t keyHash= pKeyHash!=NULL ? *pKeyHash : res_hashKey(*key);
+                idx=_res_findHashedTableItem(pResData, table, p, NULL, length, *key, keyHash, key);
+            } else {
+                idx=_res_findTableItem(pResData, p, length, *key, key);
+            }
+            *indexR=idx;
             if(idx>=0) {
                 const Resource *p32=(const Resource *)(p+length+(~length&1));
                 return p32[idx];
@@ -730,7 +822,13 @@ res_getTableItemByKey(const ResourceData *pResData, Resource table,
     case URES_TABLE16: {
         const uint16_t *p=pResData->p16BitUnits+offset;
         length=*p++;
-        *indexR=idx=_res_findTableItem(pResData, p, length, *key, key);
+        if(hasKeyHash(pResData, length)) {
+            uint32_t keyHash= pKeyHash!=NULL ? *pKeyHash : res_hashKey(*key);
+            idx=_res_findHashedTableItem(pResData, table, p, NULL, length, *key, keyHash, key);
+        } else {
+            idx=_res_findTableItem(pResData, p, length, *key, key);
+        }
+        *indexR=idx;
         if(idx>=0) {
             return makeResourceFrom16(pResData, p[length+idx]);
         }
@@ -740,7 +838,13 @@ res_getTableItemByKey(const ResourceData *pResData, Resource table,
         if (offset!=0) { /* empty if offset==0 */
             const int32_t *p= pResData->pRoot+offset;
             length=*p++;
-            *indexR=idx=_res_findTable32Item(pResData, p, length, *key, key);
+            if(hasKeyHash(pResData, length)) {
+                uint32_t keyHash= pKeyHash!=NULL ? *pKeyHash : res_hashKey(*key);
+                idx=_res_findHashedTableItem(pResData, table, NULL, p, length, *key, keyHash, key);
+            } else {
+                idx=_res_findTable32Item(pResData, p, length, *key, key);
+            }
+            *indexR=idx;
             if(idx>=0) {
                 return (Resource)p[length+idx];
             }
@@ -753,6 +857,18 @@ res_getTableItemByKey(const ResourceData *pResData, Resource table,
     return RES_BOGUS;
 }
 
+U_CAPI Resource U_EXPORT2
+res_getTableItemByKey(const ResourceData *pResData, Resource table,
+                      int32_t *indexR, const char **key) {
+    return getTableItemByKey(pResData, table, indexR, key, NULL);
+}
+
+U_CAPI Resource U_EXPORT2
+res_getTableItemByKeyHash(const ResourceData *pResData, Resource table,
+                          int32_t *indexR, const char **key, uint32_t keyHash) {
+    return getTableItemByKey(pResData, table, indexR, key, &keyHash);
+}
+
 U_CAPI Resource U_EXPORT2
 res_getTableItemByIndex(const ResourceData *pResData, Resource table,
                         int32_t indexR, const char **key) {
@@ -1313,7 +1429,7 @@ ures_swap(const UDataSwapper *ds,
     const int32_t *inIndexes;
 
     /* the following integers count Resource item offsets (4 bytes each), not bytes */
-    int32_t bundleLength, indexLength, keysBottom, keysTop, resBottom, top;
+    int32_t bundleLength, indexLength, keysBottom, keysTop, resBottom, resTop, top;
 
     /* udata_swapDataHeader checks the arguments */
     headerSize=udata_swapDataHeader(ds, inData, length, outData, pErrorCode);
@@ -1375,6 +1491,7 @@ ures_swap(const UDataSwapper *ds,
     } else {
         resBottom=keysTop;
     }
+    resTop=udata_readInt32(ds, inIndexes[URES_INDEX_RESOURCES_TOP]);
     top=udata_readInt32(ds, inIndexes[URES_INDEX_BUNDLE_TOP]);
     maxTableLength=udata_readInt32(ds, inIndexes[URES_INDEX_MAX_TABLE_LENGTH]);
 
@@ -1474,6 +1591,21 @@ ures_swap(const UDataSwapper *ds,
             uprv_free(tempTable.resFlags);
         }
 
+        /*
+         * swap the key hash index (formatVersion 2.1 & 3.1)
+         * The hash values do not depend on the platform endianness.
+         */
+        if( 0<resTop && resTop+3<=top &&
+            udata_readInt32(ds, (int32_t)inBundle[resTop])==URES_KEY_HASH_SIGNATURE
+        ) {
+            ds->swapArray32(ds, inBundle+resTop, 3*4, outBundle+resTop, pErrorCode);
+            ds->swapArray16(ds, inBundle+resTop+3, (top-resTop-3)*4, outBundle+resTop+3, pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                udata_printError(ds, "ures_swap().swapArray16(key hash index[%d]) failed\n", 2*(top-resTop-3));
+                return 0;
+            }
+        }
+
         /* swap the root resource and indexes */
         ds->swapArray32(ds, inBundle, keysBottom*4, outBundle, pErrorCode);
     }
@@ -110,6 +110,8 @@ enum {
     /**
      * [3] contains the top of the bundle,
      *     in case it were ever different from [2]
+     *
+     * formatVersion>=2.1: the optional key hash index is stored between [2] and [3]
      */
     URES_INDEX_BUNDLE_TOP,
     /** [4] max. length of any table */
@@ -154,9 +156,43 @@ enum {
 #define URES_ATT_IS_POOL_BUNDLE 2
 #define URES_ATT_USES_POOL_BUNDLE 4
 
+/*
+ * Signature (first int32_t) of the key hash index, "KHsh".
+ * New in formatVersion 2.1 & 3.1 (ICU 64).
+ */
+#define URES_KEY_HASH_SIGNATURE 0x4b487368
+
+/* Key hash index slot value for an unused slot. */
+#define URES_KEY_HASH_EMPTY_SLOT 0xffff
+
 /*
  * File format for .res resource bundle files
  *
+ * ICU 64: New in formatVersion 2.1 & 3.1 compared with 2.0 & 3.0: -------------
+ *
+ * A bundle can optionally contain a key hash index for fast table lookups.
+ * It is stored after all of the resources, from indexes[URES_INDEX_RESOURCES_TOP]
+ * to indexes[URES_INDEX_BUNDLE_TOP]:
+ *
+ *   int32_t signature; -- URES_KEY_HASH_SIGNATURE
+ *   int32_t slotsLength; -- number of slots, a power of 2
+ *   int32_t minTableLength; -- shortest indexed table
+ *   uint16_t slots[slotsLength]; -- item indexes, or URES_KEY_HASH_EMPTY_SLOT
+ *   (uint16_t padding); -- to a multiple of 4 bytes
+ *
+ * Each item of each table with minTableLength<=count<0xffff has its
+ * item index in one of the slots, found via linear probing starting at
+ *   res_hashTableKey(tableResource, res_hashKey(key)) & (slotsLength-1).
+ * A lookup probes until it finds an index<count whose key matches,
+ * or an empty slot. At least half of the slots are empty.
+ * Shorter tables and other lookups use binary search as before.
+ *
+ * The key hashes are computed from the key string bytes.
+ * genrb writes the index only on ASCII-family platforms,
+ * and only ASCII-family platforms use it.
+ * Readers that do not know the index ignore it, just like
+ * other data between the resources top and the bundle top.
+ *
  * ICU 56: New in formatVersion 3 compared with 2: -------------
  *
  * Resource bundles can optionally use shared string-v2 values
@@ -395,6 +431,9 @@ typedef struct ResourceData {
     UBool isPoolBundle;
     UBool usesPoolBundle;
     UBool useNativeStrcmp;
+    const uint16_t *keyHashSlots; /* NULL if there is no key hash index */
+    uint32_t keyHashMask; /* slotsLength-1 */
+    int32_t keyHashMinTableLength;
 } ResourceData;
 
 /*
@@ -455,6 +494,28 @@ res_getTableItemByIndex(const ResourceData *pResData, Resource table, int32_t in
 U_INTERNAL Resource U_EXPORT2
 res_getTableItemByKey(const ResourceData *pResData, Resource table, int32_t *indexS, const char* * key);
 
+/**
+ * Same as res_getTableItemByKey() but with keyHash==res_hashKey(*key)
+ * precomputed by the caller.
+ */
+U_INTERNAL Resource U_EXPORT2
+res_getTableItemByKeyHash(const ResourceData *pResData, Resource table,
+                          int32_t *indexS, const char **key, uint32_t keyHash);
+
+/**
+ * Hashes a table key string for the key hash index.
+ * Depends only on the key bytes, not on a bundle.
+ */
+U_INTERNAL uint32_t U_EXPORT2
+res_hashKey(const char *key);
+
+/**
+ * Combines a table resource item with a res_hashKey() value;
+ * the result masked with slotsLength-1 is the first slot of the key hash index to probe.
+ */
+U_INTERNAL uint32_t U_EXPORT2
+res_hashTableKey(Resource table, uint32_t keyHash);
+
 /**
  * Iterates over the path and stops when a scalar resource is found.
  * Follows aliases.
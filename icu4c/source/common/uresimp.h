@@ -38,11 +38,19 @@
 struct UResourceDataEntry;
 typedef struct UResourceDataEntry UResourceDataEntry;
 
+#ifdef __cplusplus
+
+#include "umutex.h"
+
 /*
  * Note: If we wanted to make this structure smaller, then we could try
  * to use one UResourceDataEntry pointer for fAlias and fPool, with a separate
  * flag to distinguish whether this struct is for a real bundle with a pool,
  * or for an alias entry for which we won't use the pool after loading.
+ *
+ * Only uresbund.cpp looks inside, so the structure is C++-only.
+ * fCountExisting is changed with atomic operations
+ * because bundles are opened and closed without locking.
  */
 struct UResourceDataEntry {
     char *fName; /* name of the locale for bundle - still to decide whether it is original or fallback */
@@ -52,11 +60,13 @@ struct UResourceDataEntry {
     UResourceDataEntry *fPool;
     ResourceData fData; /* data for low level access */
     char fNameBuffer[3]; /* A small buffer of free space for fName. The free space is due to struct padding. */
-    uint32_t fCountExisting; /* how much is this resource used */
+    icu::u_atomic_int32_t fCountExisting; /* how much is this resource used */
     UErrorCode fBogus;
     /* int32_t fHashKey;*/ /* for faster access in the hashtable */
 };
 
+#endif  /* __cplusplus */
+
 #define RES_BUFSIZE 64
 #define RES_PATH_SEPARATOR   '/'
 #define RES_PATH_SEPARATOR_S   "/"
@@ -255,6 +265,46 @@ ures_getByKeyWithFallback(const UResourceBundle *resB,
                           UResourceBundle *fillIn, 
                           UErrorCode *status);
 
+/** Maximum number of keys in a UResKeyPath. */
+#define URES_KEY_PATH_MAX_KEYS 8
+/** Maximum length of a UResKeyPath path string, including the terminating NUL. */
+#define URES_KEY_PATH_CAPACITY 96
+
+/**
+ * A resource path like "NumberElements/latn/symbols" split into its keys,
+ * with the key hashes precomputed for the key hash index of resource bundles.
+ * Initialize it once with ures_initKeyPath() (for example, into a static object)
+ * and then pass it to ures_getByKeyPathFast() many times.
+ */
+typedef struct UResKeyPath {
+    int32_t length;  /* number of keys */
+    uint8_t keyStarts[URES_KEY_PATH_MAX_KEYS];  /* offsets into keys[] */
+    uint32_t keyHashes[URES_KEY_PATH_MAX_KEYS];
+    char path[URES_KEY_PATH_CAPACITY];  /* the original path */
+    char keys[URES_KEY_PATH_CAPACITY];  /* the path with separators replaced by NULs */
+} UResKeyPath;
+
+/**
+ * Splits the path into keys and hashes them.
+ * @param keyPath   the object to be initialized
+ * @param path      a resource path with keys separated by '/'
+ * @param status    U_BUFFER_OVERFLOW_ERROR if the path has more than URES_KEY_PATH_MAX_KEYS keys
+ *                  or is longer than URES_KEY_PATH_CAPACITY-1 characters
+ */
+U_CAPI void U_EXPORT2
+ures_initKeyPath(UResKeyPath *keyPath, const char *path, UErrorCode *status);
+
+/**
+ * Same as ures_getByKeyWithFallback(resB, keyPath->path, fillIn, status),
+ * but the lookups in resB's own data use the precomputed key hashes
+ * and avoid copying and splitting the path.
+ */
+U_CAPI UResourceBundle* U_EXPORT2
+ures_getByKeyPathFast(const UResourceBundle *resB,
+                      const UResKeyPath *keyPath,
+                      UResourceBundle *fillIn,
+                      UErrorCode *status);
+
 
 /**
  * Get a String with multi-level fallback. Normally only the top level resources will
@@ -69,6 +69,15 @@ uset_openPatternOptions(const UChar* pattern, int32_t patternLength,
 }
 
 
+U_CAPI const USet* U_EXPORT2
+uset_getFrozenInstance(const UChar* pattern, int32_t patternLength,
+                       uint32_t options,
+                       UErrorCode* ec)
+{
+    UnicodeString pat(patternLength==-1, pattern, patternLength);
+    return (const USet*) UnicodeSet::getFrozenInstance(pat, options, *ec);
+}
+
 U_CAPI int32_t U_EXPORT2 
 uset_applyPattern(USet *set,
                   const UChar *pattern, int32_t patternLength,
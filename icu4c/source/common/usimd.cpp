@@ -0,0 +1,64 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  usimd.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Runtime detection of the CPU features used by SIMD code.
+*/
+
+#include "unicode/utypes.h"
+#include "umutex.h"
+#include "usimd.h"
+
+#if U_SIMD_X86_DISPATCH && defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+namespace {
+
+icu::UInitOnce gCPUFeaturesInitOnce = U_INITONCE_INITIALIZER;
+uint32_t gCPUFeatures = 0;
+
+void U_CALLCONV initCPUFeatures() {
+    uint32_t features=0;
+#if U_SIMD_X86_DISPATCH
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf=info[0];
+    __cpuid(info, 1);
+    if(info[2]&(1<<9)) {
+        features|=UPRV_CPU_SSSE3;
+    }
+    // AVX2 also needs the OS to save the YMM registers (OSXSAVE, then XCR0 bits 1 and 2).
+    if(maxLeaf>=7 && (info[2]&(1<<27)) && (_xgetbv(0)&6)==6) {
+        __cpuidex(info, 7, 0);
+        if(info[1]&(1<<5)) {
+            features|=UPRV_CPU_AVX2;
+        }
+    }
+#else
+    // libgcc and compiler-rt include the OS support check for AVX features.
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("ssse3")) {
+        features|=UPRV_CPU_SSSE3;
+    }
+    if(__builtin_cpu_supports("avx2")) {
+        features|=UPRV_CPU_AVX2;
+    }
+#endif
+#endif
+    gCPUFeatures=features;
+}
+
+}  // namespace
+
+U_CAPI uint32_t U_EXPORT2
+uprv_getCPUFeatures() {
+    icu::umtx_initOnce(gCPUFeaturesInitOnce, &initCPUFeatures);
+    return gCPUFeatures;
+}
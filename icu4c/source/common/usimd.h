@@ -0,0 +1,72 @@
+// © 2018 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  usimd.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Compile-time guards for SIMD code, target attributes for functions that use
+*   instructions beyond the baseline the library is compiled for,
+*   and runtime detection of the CPU features those functions need.
+*
+*   Code that uses SSE2 only tests U_SIMD_SSE2, which is 1 where the compiler
+*   may always emit SSE2 (x86-64, or 32-bit x86 compiled for it).
+*
+*   Code that uses SSSE3 or AVX2 tests U_SIMD_X86_DISPATCH, marks each function
+*   that uses those intrinsics with U_SIMD_TARGET_SSSE3 or U_SIMD_TARGET_AVX2,
+*   and calls such a function only if uprv_getCPUFeatures() has the matching
+*   UPRV_CPU_... bit set. The rest of the file stays compiled for the baseline.
+*/
+
+#ifndef __USIMD_H__
+#define __USIMD_H__
+
+#include "unicode/utypes.h"
+
+#ifndef U_SIMD_SSE2
+#   if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+#       define U_SIMD_SSE2 1
+#   else
+#       define U_SIMD_SSE2 0
+#   endif
+#endif
+
+#ifndef U_SIMD_X86_DISPATCH
+#   if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#       define U_SIMD_X86_DISPATCH 1
+#       define U_SIMD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#       define U_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#   elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        // MSVC emits any intrinsic without a target attribute.
+#       define U_SIMD_X86_DISPATCH 1
+#       define U_SIMD_TARGET_SSSE3
+#       define U_SIMD_TARGET_AVX2
+#   else
+#       define U_SIMD_X86_DISPATCH 0
+#   endif
+#endif
+
+/**
+ * Bits in the uprv_getCPUFeatures() value.
+ * @internal
+ */
+enum {
+    /** The CPU supports SSSE3 (PSHUFB). @internal */
+    UPRV_CPU_SSSE3=1,
+    /** The CPU and the operating system support AVX2. @internal */
+    UPRV_CPU_AVX2=2
+};
+
+/**
+ * Returns the UPRV_CPU_... bits for the CPU features that SIMD code
+ * compiled under U_SIMD_X86_DISPATCH may use.
+ * The features are detected once; later calls are cheap.
+ * Always 0 where U_SIMD_X86_DISPATCH is 0.
+ * @internal
+ */
+U_CAPI uint32_t U_EXPORT2
+uprv_getCPUFeatures(void);
+
+#endif
@@ -212,7 +212,7 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
     } else {
         latinToLower = LatinCase::TO_LOWER_TR_LT;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = srcStart;
     int32_t srcIndex = srcStart;
@@ -231,7 +231,7 @@ int32_t toLower(int32_t caseLocale, uint32_t options,
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (!UCASE_IS_UPPER_OR_TITLE(props) || (delta = UCASE_GET_DELTA(props)) == 0) {
@@ -307,7 +307,7 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
     } else {
         latinToUpper = LatinCase::TO_UPPER_NORMAL;
     }
-    const UTrie2 *trie = ucase_getTrie();
+    const UCPTrie *trie = ucase_getTrie();
     int32_t destIndex = 0;
     int32_t prev = 0;
     int32_t srcIndex = 0;
@@ -326,7 +326,7 @@ int32_t toUpper(int32_t caseLocale, uint32_t options,
             } else if (lead >= 0xd800) {
                 break;  // surrogate or higher
             } else {
-                uint16_t props = UTRIE2_GET16_FROM_U16_SINGLE_LEAD(trie, lead);
+                uint16_t props = UCPTRIE_FAST_BMP_GET(trie, UCPTRIE_16, lead);
                 if (UCASE_HAS_EXCEPTION(props)) { break; }
                 ++srcIndex;
                 if (UCASE_GET_TYPE(props) != UCASE_LOWER || (delta = UCASE_GET_DELTA(props)) == 0) {
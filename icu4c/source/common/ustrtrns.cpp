@@ -33,8 +33,463 @@
 #include "unicode/utf16.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "uasciirun.h"
+#include "umutex.h"
 #include "ustr_imp.h"
 #include "uassert.h"
+#include "usimd.h"
+
+/*
+ * USTRTRNS_SSSE3 is 1 where the UTF-8 transformation functions can use
+ * SSSE3 intrinsics in functions compiled for SSSE3,
+ * without compiling the whole file for it.
+ * Whether the CPU supports SSSE3 is checked at runtime.
+ */
+#ifndef USTRTRNS_SSSE3
+#   define USTRTRNS_SSSE3 U_SIMD_X86_DISPATCH
+#endif
+
+#if USTRTRNS_SSSE3
+#   include <tmmintrin.h>
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   endif
+#endif
+
+#if USTRTRNS_SSSE3
+
+/*
+ * Block code for UTF-8 <-> UTF-16 transformations of well-formed text
+ * with code points up to U+FFFF.
+ *
+ * UTF-8 to UTF-16 loads 32 bytes, validates them, computes one 16-bit unit
+ * for each byte that ends a sequence, and moves those units together with
+ * PSHUFB controls looked up by 8-bit masks. It consumes the complete
+ * sequences up to the last one that ends before the last byte of the window.
+ *
+ * UTF-16 to UTF-8 loads 8 UChars, computes the lead, middle and last bytes
+ * of each one, and gathers 1..3 bytes per UChar with PSHUFB controls
+ * looked up by which UChars need 2 or 3 bytes.
+ *
+ * Each function returns at the first block that it cannot handle:
+ * ill-formed UTF-8, supplementary code points, or surrogates.
+ * The callers handle the next few characters one at a time with their
+ * usual error and substitution semantics and then try the block code again.
+ */
+
+namespace {
+
+/* Index of the highest bit that is set, for mask!=0. */
+inline int32_t highestBit(uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanReverse(&i, mask);
+    return (int32_t)i;
+#else
+    return 31-__builtin_clz(mask);
+#endif
+}
+
+icu::UInitOnce gSimdInitOnce = U_INITONCE_INITIALIZER;
+UBool gUseSimd = FALSE;
+
+/*
+ * UTF-8 to UTF-16:
+ * PSHUFB controls that move the 16-bit units selected by an 8-bit mask
+ * to the front, and the number of those units.
+ */
+uint8_t gCompact16[256][16];
+uint8_t gCompact16Length[256];
+
+/*
+ * UTF-16 to UTF-8, for 4 UChars at a time whose lead, middle and last bytes
+ * are at indexes 0..3, 4..7 and 8..11 of a vector:
+ * PSHUFB controls that gather the bytes each of them needs, and their number.
+ * Index bits 0..3 are set for UChars >=0x80, bits 4..7 for UChars >=0x800.
+ */
+uint8_t gGather8[256][16];
+uint8_t gGather8Length[256];
+
+void U_CALLCONV initSimd() {
+    for(int32_t m=0; m<256; ++m) {
+        int32_t length=0;
+        for(int32_t i=0; i<8; ++i) {
+            if(m&(1<<i)) {
+                gCompact16[m][length++]=(uint8_t)(2*i);
+                gCompact16[m][length++]=(uint8_t)(2*i+1);
+            }
+        }
+        gCompact16Length[m]=(uint8_t)(length/2);
+        while(length<16) {
+            gCompact16[m][length++]=0x80;
+        }
+
+        length=0;
+        for(int32_t i=0; i<4; ++i) {
+            gGather8[m][length++]=(uint8_t)i;
+            if(m&(0x10<<i)) {
+                gGather8[m][length++]=(uint8_t)(4+i);
+            }
+            if(m&(1<<i)) {
+                gGather8[m][length++]=(uint8_t)(8+i);
+            }
+        }
+        gGather8Length[m]=(uint8_t)length;
+        while(length<16) {
+            gGather8[m][length++]=0x80;
+        }
+    }
+    gUseSimd=(uprv_getCPUFeatures()&UPRV_CPU_SSSE3)!=0;
+}
+
+inline UBool useSimd() {
+    icu::umtx_initOnce(gSimdInitOnce, &initSimd);
+    return gUseSimd;
+}
+
+/*
+ * Error flags for the UTF-8 validation lookup tables, as in
+ * John Keiser & Daniel Lemire, "Validating UTF-8 In Less Than One
+ * Instruction Per Byte", Software: Practice and Experience 51(5), 2021.
+ * Each flag marks an error in a pair of (previous byte, current byte).
+ */
+enum {
+    TOO_SHORT=1,        // lead byte not followed by a trail byte
+    TOO_LONG=2,         // ASCII followed by a trail byte
+    OVERLONG_3=4,       // E0 80..9F
+    TOO_LARGE=8,        // F4 90..BF, F5..FF
+    SURROGATE=0x10,     // ED A0..BF
+    OVERLONG_2=0x20,    // C0..C1
+    TOO_LARGE_1000=0x40,
+    OVERLONG_4=0x40,    // F0 80..8F
+    TWO_CONTS=0x80,     // two trail bytes, checked against the expected ones
+    CARRY=TOO_SHORT|TOO_LONG|TWO_CONTS
+};
+
+/* Lookup tables indexed by the high nibble of the previous byte, ... */
+const uint8_t utf8Byte1High[16]={
+    // 0_______ ASCII
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    // 10______ trail byte
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    // 1100____, 1101____ two-byte lead
+    TOO_SHORT|OVERLONG_2, TOO_SHORT,
+    // 1110____ three-byte lead
+    TOO_SHORT|OVERLONG_3|SURROGATE,
+    // 1111____ four-byte lead
+    TOO_SHORT|TOO_LARGE|TOO_LARGE_1000|OVERLONG_4
+};
+
+/* ... by the low nibble of the previous byte, ... */
+const uint8_t utf8Byte1Low[16]={
+    CARRY|OVERLONG_3|OVERLONG_2|OVERLONG_4,
+    CARRY|OVERLONG_2,
+    CARRY, CARRY,
+    CARRY|TOO_LARGE,
+    CARRY|TOO_LARGE|TOO_LARGE_1000, CARRY|TOO_LARGE|TOO_LARGE_1000, CARRY|TOO_LARGE|TOO_LARGE_1000,
+    CARRY|TOO_LARGE|TOO_LARGE_1000, CARRY|TOO_LARGE|TOO_LARGE_1000, CARRY|TOO_LARGE|TOO_LARGE_1000,
+    CARRY|TOO_LARGE|TOO_LARGE_1000, CARRY|TOO_LARGE|TOO_LARGE_1000,
+    CARRY|TOO_LARGE|TOO_LARGE_1000|SURROGATE,
+    CARRY|TOO_LARGE|TOO_LARGE_1000, CARRY|TOO_LARGE|TOO_LARGE_1000
+};
+
+/* ... and by the high nibble of the current byte. */
+const uint8_t utf8Byte2High[16]={
+    // ASCII
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    // 1000____, 1001____, 101_____ trail byte
+    TOO_LONG|OVERLONG_2|TWO_CONTS|OVERLONG_3|TOO_LARGE_1000|OVERLONG_4,
+    TOO_LONG|OVERLONG_2|TWO_CONTS|OVERLONG_3|TOO_LARGE,
+    TOO_LONG|OVERLONG_2|TWO_CONTS|SURROGATE|TOO_LARGE,
+    TOO_LONG|OVERLONG_2|TWO_CONTS|SURROGATE|TOO_LARGE,
+    // lead bytes
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+};
+
+/* Looks up each byte's high nibble in table. */
+U_SIMD_TARGET_SSSE3 inline __m128i
+lookupHigh(const uint8_t table[16], __m128i bytes) {
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)table),
+                            _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0xf)));
+}
+
+/*
+ * Returns a mask with bit j set if an error is flagged at in[j], for a block of
+ * 16 bytes of UTF-8 which follows the 16 bytes in prev.
+ * An error is flagged at the second or a later byte of an ill-formed sequence,
+ * or at the byte after a truncated one.
+ */
+U_SIMD_TARGET_SSSE3 inline uint32_t
+utf8Errors(__m128i in, __m128i prev) {
+    __m128i prev1=_mm_alignr_epi8(in, prev, 15);
+    __m128i prev2=_mm_alignr_epi8(in, prev, 14);
+    __m128i prev3=_mm_alignr_epi8(in, prev, 13);
+    __m128i special=_mm_and_si128(
+        _mm_and_si128(lookupHigh(utf8Byte1High, prev1),
+                      _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)utf8Byte1Low),
+                                       _mm_and_si128(prev1, _mm_set1_epi8(0xf)))),
+        lookupHigh(utf8Byte2High, in));
+    // The byte two after a three-byte lead, and three after a four-byte lead,
+    // must be a trail byte: Bit 7 is set for those positions.
+    __m128i must23=_mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xe0-0x80)),
+                                _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0-0x80)));
+    __m128i error=_mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8((char)0x80)), special);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128()))^0xffff;
+}
+
+/* Returns a mask with bit j set if in[j] is F0..FF. */
+U_SIMD_TARGET_SSSE3 inline uint32_t
+utf8Leads4(__m128i in) {
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(in, _mm_set1_epi8((char)0xf0)), in));
+}
+
+/*
+ * UTF-8 is handled in windows of 32 bytes which start on sequence boundaries.
+ * Each step moves to after the last sequence that ends before the last byte
+ * of the window. That position depends only on where the trail bytes are,
+ * so that the next window can be loaded before this one is validated.
+ * Bytes before the window count as ASCII.
+ *
+ * Loads the window at src, or the remaining length<32 bytes padded with NULs.
+ * @return a mask with bit j set if byte j is the last byte of a sequence
+ */
+U_SIMD_TARGET_SSSE3 inline uint32_t
+utf8LoadWindow(const uint8_t *src, int32_t length, uint8_t buffer[32], __m128i &in0, __m128i &in1) {
+    uint32_t limit=0x7fffffff;
+    if(length<32) {
+        uprv_memcpy(buffer, src, length);
+        uprv_memset(buffer+length, 0, 32-length);
+        src=buffer;
+        limit=((uint32_t)1<<length)-1;
+    }
+    in0=_mm_loadu_si128((const __m128i *)src);
+    in1=_mm_loadu_si128((const __m128i *)(src+16));
+    // Trail bytes 80..BF are the signed bytes less than (int8_t)0xc0.
+    const __m128i minLead=_mm_set1_epi8((char)0xc0);
+    uint32_t trails=(uint32_t)_mm_movemask_epi8(_mm_cmplt_epi8(in0, minLead))|
+        ((uint32_t)_mm_movemask_epi8(_mm_cmplt_epi8(in1, minLead))<<16);
+    // Byte j ends a sequence if byte j+1 is not a trail byte.
+    return (~trails>>1)&limit;
+}
+
+/*
+ * Validates a window of UTF-8 for the sequences for U+0000..U+FFFF.
+ * @return 0 if they are all well-formed (the last one may be truncated at the end of the window);
+ *         otherwise a mask whose lowest set bit q limits the well-formed sequences
+ *         at the start of the window to the ones that end before byte q
+ */
+U_SIMD_TARGET_SSSE3 inline uint32_t
+utf8Stops(__m128i in0, __m128i in1) {
+    uint32_t errors=utf8Errors(in0, _mm_setzero_si128())|(utf8Errors(in1, in0)<<16);
+    // The sequences that end two or more bytes before the first error are well-formed.
+    // A trail byte at the start of the window is flagged there.
+    return (errors>>1)|(errors&1)|utf8Leads4(in0)|(utf8Leads4(in1)<<16);
+}
+
+/*
+ * Writes the UTF-16 code units for the sequences that end at the bits set in ends,
+ * for a block of 16 bytes of well-formed UTF-8 which follows the 16 bytes in prev.
+ * Writes 16 UChars but moves dest forward only by the number of code units.
+ */
+U_SIMD_TARGET_SSSE3 inline UChar *
+utf8StoreUTF16(__m128i in, __m128i prev, uint32_t ends, UChar *dest) {
+    __m128i prev1=_mm_alignr_epi8(in, prev, 15);
+    __m128i prev2=_mm_alignr_epi8(in, prev, 14);
+    __m128i isTrail=_mm_cmplt_epi8(in, _mm_set1_epi8((char)0xc0));
+    // At the end of a two- or three-byte sequence, the low byte of the code point
+    // has the 6 bits of the trail byte and the low 2 bits of the byte before it,
+    // and the high byte has bits 2..5 of the byte before it and
+    // the low 4 bits of the byte before that if that is a three-byte lead byte.
+    // The high byte of an ASCII character is 0.
+    __m128i low=_mm_or_si128(
+        _mm_and_si128(isTrail,
+                      _mm_or_si128(_mm_and_si128(in, _mm_set1_epi8(0x3f)),
+                                   _mm_and_si128(_mm_slli_epi16(prev1, 6), _mm_set1_epi8((char)0xc0)))),
+        _mm_andnot_si128(isTrail, in));
+    __m128i isLead3=_mm_cmpeq_epi8(_mm_max_epu8(prev2, _mm_set1_epi8((char)0xe0)), prev2);
+    __m128i high=_mm_and_si128(isTrail,
+        _mm_or_si128(_mm_srli_epi16(_mm_and_si128(prev1, _mm_set1_epi8(0x3c)), 2),
+                     _mm_and_si128(isLead3,
+                                   _mm_slli_epi16(_mm_and_si128(prev2, _mm_set1_epi8(0xf)), 4))));
+    uint32_t ends0=ends&0xff, ends1=ends>>8;
+    _mm_storeu_si128((__m128i *)dest,
+                     _mm_shuffle_epi8(_mm_unpacklo_epi8(low, high),
+                                      _mm_loadu_si128((const __m128i *)gCompact16[ends0])));
+    dest+=gCompact16Length[ends0];
+    _mm_storeu_si128((__m128i *)dest,
+                     _mm_shuffle_epi8(_mm_unpackhi_epi8(low, high),
+                                      _mm_loadu_si128((const __m128i *)gCompact16[ends1])));
+    return dest+gCompact16Length[ends1];
+}
+
+/*
+ * Converts UTF-8 to UTF-16 in windows of up to 32 bytes.
+ * Stops at the first window that does not start with a well-formed sequence
+ * for U+0000..U+FFFF, or when fewer than 16 bytes or 32 UChars are left.
+ * @return the pointer after the converted UTF-8 sequences; dest is moved forward
+ */
+U_SIMD_TARGET_SSSE3 const uint8_t *
+utf8ToUTF16Simd(const uint8_t *src, const uint8_t *srcLimit, UChar *&dest, const UChar *destLimit) {
+    UChar *d=dest;
+    uint8_t buffer[32];
+    while((srcLimit-src)>=16 && (destLimit-d)>=32) {
+        int32_t length=(int32_t)(srcLimit-src);
+        __m128i in0, in1;
+        uint32_t ends=utf8LoadWindow(src, length, buffer, in0, in1);
+        if(_mm_movemask_epi8(_mm_or_si128(in0, in1))==0) {
+            if(length>(destLimit-d)) {
+                length=(int32_t)(destLimit-d);
+            }
+            length=uprv_asciiToUChars(src, length, d);
+            src+=length;
+            d+=length;
+            continue;
+        }
+        uint32_t stops=utf8Stops(in0, in1);
+        if(stops!=0) {
+            ends&=(stops&(0-stops))-1;
+            if(ends==0) {
+                break;
+            }
+        }
+        d=utf8StoreUTF16(in0, _mm_setzero_si128(), ends&0xffff, d);
+        d=utf8StoreUTF16(in1, in0, ends>>16, d);
+        src+=highestBit(ends)+1;
+    }
+    dest=d;
+    return src;
+}
+
+/*
+ * Same as utf8ToUTF16Simd() but only adds the UTF-16 length to length16.
+ */
+U_SIMD_TARGET_SSSE3 const uint8_t *
+utf8CountUTF16Simd(const uint8_t *src, const uint8_t *srcLimit, int32_t &length16) {
+    int32_t count=length16;
+    uint8_t buffer[32];
+    while((srcLimit-src)>=16) {
+        int32_t length=(int32_t)(srcLimit-src);
+        __m128i in0, in1;
+        uint32_t ends=utf8LoadWindow(src, length, buffer, in0, in1);
+        if(_mm_movemask_epi8(_mm_or_si128(in0, in1))==0) {
+            length=uprv_asciiSpan(src, length);
+            src+=length;
+            count+=length;
+            continue;
+        }
+        uint32_t stops=utf8Stops(in0, in1);
+        if(stops!=0) {
+            ends&=(stops&(0-stops))-1;
+            if(ends==0) {
+                break;
+            }
+        }
+        count+=gCompact16Length[ends&0xff]+gCompact16Length[(ends>>8)&0xff]+
+            gCompact16Length[(ends>>16)&0xff]+gCompact16Length[ends>>24];
+        src+=highestBit(ends)+1;
+    }
+    length16=count;
+    return src;
+}
+
+/*
+ * Returns a mask with bits 0..7 set for UChars >=0x80 and bits 8..15 set
+ * for UChars >=0x800 in a block of 8, or a negative value if there is a surrogate.
+ */
+U_SIMD_TARGET_SSSE3 inline int32_t
+utf16LengthMask(__m128i u) {
+    const __m128i zero=_mm_setzero_si128();
+    __m128i top5=_mm_and_si128(u, _mm_set1_epi16((short)0xf800));
+    if(_mm_movemask_epi8(_mm_cmpeq_epi16(top5, _mm_set1_epi16((short)0xd800)))!=0) {
+        return -1;
+    }
+    __m128i isAscii=_mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16((short)0xff80)), zero);
+    __m128i isBelow800=_mm_cmpeq_epi16(top5, zero);
+    return _mm_movemask_epi8(_mm_packs_epi16(isAscii, isBelow800))^0xffff;
+}
+
+/* Returns (mask&a)|(~mask&b). */
+U_SIMD_TARGET_SSSE3 inline __m128i
+blend(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/*
+ * Converts UTF-16 to UTF-8 in blocks of 8 UChars.
+ * Stops at the first block with a surrogate,
+ * or when fewer than 8 UChars or 28 bytes are left.
+ * @return the pointer after the converted UChars; dest is moved forward
+ */
+U_SIMD_TARGET_SSSE3 const UChar *
+utf16ToUTF8Simd(const UChar *src, const UChar *srcLimit, uint8_t *&dest, const uint8_t *destLimit) {
+    uint8_t *d=dest;
+    // A block yields at most 24 bytes, written with two 16-byte stores
+    // of which the first is followed by at most 12 bytes.
+    while((srcLimit-src)>=8 && (destLimit-d)>=28) {
+        __m128i u=_mm_loadu_si128((const __m128i *)src);
+        int32_t mask=utf16LengthMask(u);
+        if(mask<=0) {
+            if(mask<0) {
+                break;
+            }
+            int32_t length=(int32_t)(srcLimit-src);
+            if(length>(destLimit-d)) {
+                length=(int32_t)(destLimit-d);
+            }
+            length=uprv_uCharsToLatin1(src, length, d, 0x7f);
+            src+=length;
+            d+=length;
+            continue;
+        }
+        __m128i isAscii=_mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16((short)0xff80)), _mm_setzero_si128());
+        __m128i isBelow800=_mm_cmpeq_epi16(_mm_and_si128(u, _mm_set1_epi16((short)0xf800)), _mm_setzero_si128());
+        __m128i lead=blend(isAscii, u,
+                            blend(isBelow800,
+                                   _mm_or_si128(_mm_srli_epi16(u, 6), _mm_set1_epi16(0xc0)),
+                                   _mm_or_si128(_mm_srli_epi16(u, 12), _mm_set1_epi16(0xe0))));
+        __m128i middle=_mm_or_si128(_mm_and_si128(_mm_srli_epi16(u, 6), _mm_set1_epi16(0x3f)),
+                                    _mm_set1_epi16(0x80));
+        __m128i last=_mm_or_si128(_mm_and_si128(u, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80));
+        // leads 0..3, middles 0..3, leads 4..7, middles 4..7
+        __m128i leadsMiddles=_mm_shuffle_epi32(_mm_packus_epi16(lead, middle), _MM_SHUFFLE(3, 1, 2, 0));
+        __m128i lasts=_mm_packus_epi16(last, last);
+        __m128i bytes0=_mm_unpacklo_epi64(leadsMiddles, lasts);
+        __m128i bytes1=_mm_unpackhi_epi64(leadsMiddles, _mm_srli_si128(lasts, 4));
+        int32_t index0=(mask&0xf)|((mask>>4)&0xf0);
+        int32_t index1=((mask>>4)&0xf)|((mask>>8)&0xf0);
+        _mm_storeu_si128((__m128i *)d,
+                         _mm_shuffle_epi8(bytes0, _mm_loadu_si128((const __m128i *)gGather8[index0])));
+        d+=gGather8Length[index0];
+        _mm_storeu_si128((__m128i *)d,
+                         _mm_shuffle_epi8(bytes1, _mm_loadu_si128((const __m128i *)gGather8[index1])));
+        d+=gGather8Length[index1];
+        src+=8;
+    }
+    dest=d;
+    return src;
+}
+
+/*
+ * Same as utf16ToUTF8Simd() but only adds the UTF-8 length to length8.
+ */
+U_SIMD_TARGET_SSSE3 const UChar *
+utf16CountUTF8Simd(const UChar *src, const UChar *srcLimit, int32_t &length8) {
+    int32_t length=length8;
+    while((srcLimit-src)>=8) {
+        int32_t mask=utf16LengthMask(_mm_loadu_si128((const __m128i *)src));
+        if(mask<0) {
+            break;
+        }
+        length+=gGather8Length[(mask&0xf)|((mask>>4)&0xf0)]+gGather8Length[((mask>>4)&0xf)|((mask>>8)&0xf0)];
+        src+=8;
+    }
+    length8=length;
+    return src;
+}
+
+}  // namespace
+
+#endif  // USTRTRNS_SSSE3
 
 U_CAPI UChar* U_EXPORT2 
 u_strFromUTF32WithSub(UChar *dest,
@@ -378,7 +833,16 @@ u_strFromUTF8WithSub(UChar *dest,
         /* Faster loop without ongoing checking for srcLength and pDestLimit. */
         int32_t i = 0;
         UChar32 c;
+#if USTRTRNS_SSSE3
+        const uint8_t *s8 = (const uint8_t *)src;
+        UBool simd = srcLength >= 16 && useSimd();
+#endif
         for(;;) {
+#if USTRTRNS_SSSE3
+            if(simd) {
+                i = (int32_t)(utf8ToUTF16Simd(s8 + i, s8 + srcLength, pDest, pDestLimit) - s8);
+            }
+#endif
             /*
              * Each iteration of the inner loop progresses by at most 3 UTF-8
              * bytes and one UChar, for most characters.
@@ -397,12 +861,23 @@ u_strFromUTF8WithSub(UChar *dest,
                  */
                 break;
             }
+#if USTRTRNS_SSSE3
+            if(simd && count > 16) {
+                /* Return to the block code after the characters where it stopped. */
+                count = 16;
+            }
+#endif
 
             do {
                 // modified copy of U8_NEXT()
                 c = (uint8_t)src[i++];
                 if(U8_IS_SINGLE(c)) {
                     *pDest++=(UChar)c;
+                    // Copy the run of ASCII bytes that follows, in blocks.
+                    int32_t length = uprv_asciiToUChars((const uint8_t *)src + i, count - 1, pDest);
+                    i += length;
+                    pDest += length;
+                    count -= length;
                 } else {
                     uint8_t __t1, __t2;
                     if( /* handle U+0800..U+FFFF inline */
@@ -487,7 +962,18 @@ u_strFromUTF8WithSub(UChar *dest,
         }
 
         /* Pre-flight the rest of the string. */
+#if USTRTRNS_SSSE3
+        int32_t simdIndex = simd ? i : srcLength;
+#endif
         while(i < srcLength) {
+#if USTRTRNS_SSSE3
+            if(i >= simdIndex) {
+                i = (int32_t)(utf8CountUTF16Simd(s8 + i, s8 + srcLength, reqLength) - s8);
+                /* Return to the block code after the characters where it stopped. */
+                simdIndex = i + 16;
+                continue;
+            }
+#endif
             // modified copy of U8_NEXT()
             c = (uint8_t)src[i++];
             if(U8_IS_SINGLE(c)) {
@@ -678,10 +1164,26 @@ u_strFromUTF8Lenient(UChar *dest,
         }
 
         if((pSrcLimit - pSrc) >= 4) {
+#if USTRTRNS_SSSE3
+            /*
+             * The block code validates the text; where it stops,
+             * ill-formed text is handled as before, one character at a time.
+             */
+            const uint8_t *pSimd = (srcLength >= 16 && useSimd()) ? pSrc : pSrcLimit;
+            UChar *pDestLimit = dest + destCapacity;
+#endif
             pSrcLimit -= 3; /* temporarily reduce pSrcLimit */
 
             /* in this loop, we can always access at least 4 bytes, up to pSrc+3 */
-            do {
+            while(pSrc < pSrcLimit) {
+#if USTRTRNS_SSSE3
+                if(pSrc >= pSimd) {
+                    pSrc = (uint8_t *)utf8ToUTF16Simd(pSrc, pSrcLimit + 3, pDest, pDestLimit);
+                    /* Return to the block code after the characters where it stopped. */
+                    pSimd = (pSrcLimit - pSrc) > 16 ? pSrc + 16 : pSrcLimit;
+                    continue;
+                }
+#endif
                 ch = *pSrc++;
                 if(ch < 0xc0) {
                     /*
@@ -706,7 +1208,7 @@ u_strFromUTF8Lenient(UChar *dest,
                     *(pDest++) = U16_LEAD(ch);
                     *(pDest++) = U16_TRAIL(ch);
                 }
-            } while(pSrc < pSrcLimit);
+            }
 
             pSrcLimit += 3; /* restore original pSrcLimit */
         }
@@ -896,9 +1398,17 @@ u_strToUTF8WithSub(char *dest,
     } else {
         const UChar *pSrcLimit = (pSrc!=NULL)?(pSrc+srcLength):NULL;
         int32_t count;
+#if USTRTRNS_SSSE3
+        UBool simd = srcLength >= 8 && useSimd();
+#endif
 
         /* Faster loop without ongoing checking for pSrcLimit and pDestLimit. */
         for(;;) {
+#if USTRTRNS_SSSE3
+            if(simd) {
+                pSrc = utf16ToUTF8Simd(pSrc, pSrcLimit, pDest, pDestLimit);
+            }
+#endif
             /*
              * Each iteration of the inner loop progresses by at most 3 UTF-8
              * bytes and one UChar, for most characters.
@@ -917,10 +1427,21 @@ u_strToUTF8WithSub(char *dest,
                  */
                 break;
             }
+#if USTRTRNS_SSSE3
+            if(simd && count > 8) {
+                /* Return to the block code after the characters where it stopped. */
+                count = 8;
+            }
+#endif
             do {
                 ch=*pSrc++;
                 if(ch <= 0x7f) {
                     *pDest++ = (uint8_t)ch;
+                    /* copy the run of ASCII characters that follows, in blocks */
+                    int32_t length = uprv_uCharsToLatin1(pSrc, count - 1, pDest, 0x7f);
+                    pSrc += length;
+                    pDest += length;
+                    count -= length;
                 } else if(ch <= 0x7ff) {
                     *pDest++=(uint8_t)((ch>>6)|0xc0);
                     *pDest++=(uint8_t)((ch&0x3f)|0x80);
@@ -1016,7 +1537,18 @@ u_strToUTF8WithSub(char *dest,
                 }
             }
         }
+#if USTRTRNS_SSSE3
+        const UChar *pSimd = simd ? pSrc : pSrcLimit;
+#endif
         while(pSrc<pSrcLimit) {
+#if USTRTRNS_SSSE3
+            if(pSrc>=pSimd) {
+                pSrc=utf16CountUTF8Simd(pSrc, pSrcLimit, reqLength);
+                /* Return to the block code after the characters where it stopped. */
+                pSimd=(pSrcLimit-pSrc)>8 ? pSrc+8 : pSrcLimit;
+                continue;
+            }
+#endif
             ch=*pSrc++;
             if(ch<=0x7f) {
                 ++reqLength;
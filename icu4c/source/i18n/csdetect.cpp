@@ -69,6 +69,12 @@ static UBool U_CALLCONV csdet_cleanup(void)
     return TRUE;
 }
 
+/*
+ * Highest confidence that any recognizer reports. The first match with it is
+ * the best match, so there is no need to try the remaining recognizers.
+ */
+#define DECISIVE_CONFIDENCE 100
+
 static int32_t U_CALLCONV
 charsetMatchComparator(const void * /*context*/, const void *left, const void *right)
 {
@@ -150,7 +156,7 @@ void CharsetDetector::setRecognizers(UErrorCode &status)
 CharsetDetector::CharsetDetector(UErrorCode &status)
   : textIn(new InputText(status)), resultArray(NULL),
     resultCount(0), fStripTags(FALSE), fFreshTextSet(FALSE),
-    fEnabledRecognizers(NULL)
+    fFastMode(FALSE), fNextRecognizer(0), fEnabledRecognizers(NULL)
 {
     if (U_FAILURE(status)) {
         return;
@@ -213,6 +219,18 @@ UBool CharsetDetector::getStripTagsFlag() const
     return fStripTags;
 }
 
+UBool CharsetDetector::setFastModeFlag(UBool flag)
+{
+    UBool temp = fFastMode;
+    fFastMode = flag;
+    return temp;
+}
+
+UBool CharsetDetector::getFastModeFlag() const
+{
+    return fFastMode;
+}
+
 void CharsetDetector::setDeclaredEncoding(const char *encoding, int32_t len) const
 {
     textIn->setDeclaredEncoding(encoding,len);
@@ -229,11 +247,16 @@ int32_t CharsetDetector::getDetectableCount()
 
 const CharsetMatch *CharsetDetector::detect(UErrorCode &status)
 {
-    int32_t maxMatchesFound = 0;
+    if(!textIn->isSet()) {
+        status = U_MISSING_RESOURCE_ERROR;// TODO:  Need to set proper status code for input text not set
+
+        return NULL;
+    }
 
-    detectAll(maxMatchesFound, status);
+    // The best match is known as soon as one is decisive.
+    matchRecognizers(TRUE, status);
 
-    if(maxMatchesFound > 0) {
+    if(resultCount > 0) {
         return resultArray[0];
     } else {
         return NULL;
@@ -246,31 +269,54 @@ const CharsetMatch * const *CharsetDetector::detectAll(int32_t &maxMatchesFound,
         status = U_MISSING_RESOURCE_ERROR;// TODO:  Need to set proper status code for input text not set
 
         return NULL;
-    } else if (fFreshTextSet) {
-        CharsetRecognizer *csr;
-        int32_t            i;
+    }
 
-        textIn->MungeInput(fStripTags);
+    matchRecognizers(fFastMode, status);
 
-        // Iterate over all possible charsets, remember all that
-        // give a match quality > 0.
-        resultCount = 0;
-        for (i = 0; i < fCSRecognizers_size; i += 1) {
-            csr = fCSRecognizers[i]->recognizer;
-            if (csr->match(textIn, resultArray[resultCount])) {
-                resultCount++;
-            }
-        }
+    maxMatchesFound = resultCount;
 
-        if (resultCount > 1) {
-            uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
-        }
+    return resultArray;
+}
+
+/*
+ * Runs the recognizers that have not been matched against the current input yet,
+ * remembering all that give a match quality > 0, and sorts the matches.
+ * When stopping at a decisive match, the remaining recognizers are left
+ * for a later call, which appends their matches. Since the sort is stable,
+ * the matches end up in the same order as if all recognizers had run at once,
+ * and the match objects that were already returned keep their contents.
+ */
+void CharsetDetector::matchRecognizers(UBool stopAtDecisiveMatch, UErrorCode &status)
+{
+    if (fFreshTextSet) {
+        textIn->MungeInput(fStripTags);
+        resultCount = 0;
+        fNextRecognizer = 0;
         fFreshTextSet = FALSE;
     }
 
-    maxMatchesFound = resultCount;
+    if (fNextRecognizer >= fCSRecognizers_size ||
+        (stopAtDecisiveMatch && resultCount > 0 &&
+         resultArray[0]->getConfidence() >= DECISIVE_CONFIDENCE)) {
+        return;
+    }
 
-    return resultArray;
+    int32_t i = fNextRecognizer;
+    while (i < fCSRecognizers_size) {
+        CharsetRecognizer *csr = fCSRecognizers[i++]->recognizer;
+        if (csr->match(textIn, resultArray[resultCount])) {
+            resultCount++;
+            if (stopAtDecisiveMatch &&
+                    resultArray[resultCount - 1]->getConfidence() >= DECISIVE_CONFIDENCE) {
+                break;
+            }
+        }
+    }
+    fNextRecognizer = i;
+
+    if (resultCount > 1) {
+        uprv_sortArray(resultArray, resultCount, sizeof resultArray[0], charsetMatchComparator, NULL, TRUE, &status);
+    }
 }
 
 void CharsetDetector::setDetectableCharset(const char *encoding, UBool enabled, UErrorCode &status)
@@ -30,8 +30,13 @@ class CharsetDetector : public UMemory
     int32_t resultCount;
     UBool fStripTags;   // If true, setText() will strip tags from input text.
     UBool fFreshTextSet;
+    UBool fFastMode;    // If true, detectAll() stops at the first decisive match.
+    int32_t fNextRecognizer;    // Index of the first recognizer that has not been
+                                // matched against the current input yet.
     static void setRecognizers(UErrorCode &status);
 
+    void matchRecognizers(UBool stopAtDecisiveMatch, UErrorCode &status);
+
     UBool *fEnabledRecognizers;  // If not null, active set of charset recognizers had
                                 // been changed from the default. The array index is
                                 // corresponding to fCSRecognizers. See setDetectableCharset().
@@ -53,6 +58,10 @@ class CharsetDetector : public UMemory
 
     UBool getStripTagsFlag() const;
 
+    UBool setFastModeFlag(UBool flag);
+
+    UBool getFastModeFlag() const;
+
 //    const char *getCharsetName(int32_t index, UErrorCode& status) const;
 
     static int32_t getDetectableCount();
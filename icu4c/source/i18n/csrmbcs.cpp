@@ -154,6 +154,12 @@ int32_t CharsetRecog_mbcs::match_mbcs(InputText *det, const uint16_t commonChars
     int32_t confidence          = 0;
     IteratedChar iter;
 
+    if (!det->fHasHighBytes) {
+        // All ASCII: each byte is a valid single-byte character in all of
+        // these charsets, which makes the result below depend only on the length.
+        return det->fRawLength < 10 ? 0 : 10;
+    }
+
     while (nextChar(&iter, det)) {
         totalCharCount++;
 
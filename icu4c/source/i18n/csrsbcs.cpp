@@ -14,14 +14,81 @@
 #if !UCONFIG_NO_CONVERSION
 #include "csrsbcs.h"
 #include "csmatch.h"
+#include "uassert.h"
 
 #define N_GRAM_SIZE 3
 #define N_GRAM_MASK 0xFFFFFF
 
 U_NAMESPACE_BEGIN
 
+NGramLanguageSet::NGramLanguageSet(const NGramsPlusLang *languages, int32_t languagesLength)
+ : length(0)
+{
+    int32_t next[MAX_LANGUAGES];
+
+    U_ASSERT(languagesLength <= MAX_LANGUAGES);
+
+    for (int32_t lang = 0; lang < languagesLength; lang += 1) {
+        next[lang] = 0;
+    }
+
+    // Merge the sorted tables, with one entry per distinct n-gram.
+    for (;;) {
+        int32_t minValue = -1;
+
+        for (int32_t lang = 0; lang < languagesLength; lang += 1) {
+            if (next[lang] < 64 && (minValue < 0 || languages[lang].ngrams[next[lang]] < minValue)) {
+                minValue = languages[lang].ngrams[next[lang]];
+            }
+        }
+
+        if (minValue < 0) {
+            break;
+        }
+
+        uint16_t bits = 0;
+
+        for (int32_t lang = 0; lang < languagesLength; lang += 1) {
+            if (next[lang] < 64 && languages[lang].ngrams[next[lang]] == minValue) {
+                bits |= (uint16_t)(1 << lang);
+                next[lang] += 1;
+            }
+        }
+
+        ngrams[length] = minValue;
+        languageBits[length] = bits;
+        length += 1;
+    }
+}
+
+NGramLanguageSet::~NGramLanguageSet()
+{
+}
+
+uint32_t NGramLanguageSet::search(int32_t value) const
+{
+    const int32_t *base = ngrams;
+    int32_t n = length;
+
+    while (n > 1) {
+        int32_t half = n / 2;
+
+        if (base[half] <= value) {
+            base += half;
+        }
+
+        n -= half;
+    }
+
+    if (n == 0 || *base != value) {
+        return 0;
+    }
+
+    return languageBits[base - ngrams];
+}
+
 NGramParser::NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap)
- : ngram(0), byteIndex(0)
+ : ngram(0), languageSet(NULL), byteIndex(0)
 {
     ngramList = theNgramList;
     charMap   = theCharMap;
@@ -29,6 +96,18 @@ NGramParser::NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap)
     ngramCount = hitCount = 0;
 }
 
+NGramParser::NGramParser(const NGramLanguageSet *theLanguageSet, const uint8_t *theCharMap)
+ : ngram(0), ngramList(NULL), languageSet(theLanguageSet), byteIndex(0)
+{
+    charMap   = theCharMap;
+
+    ngramCount = hitCount = 0;
+
+    for (int32_t lang = 0; lang < NGramLanguageSet::MAX_LANGUAGES; lang += 1) {
+        languageHitCounts[lang] = 0;
+    }
+}
+
 NGramParser::~NGramParser()
 {
 }
@@ -80,10 +159,21 @@ void NGramParser::lookup(int32_t thisNgram)
 {
     ngramCount += 1;
 
-    if (search(ngramList, thisNgram) >= 0) {
-        hitCount += 1;
-    }
+    if (languageSet == NULL) {
+        if (search(ngramList, thisNgram) >= 0) {
+            hitCount += 1;
+        }
+    } else {
+        uint32_t bits = languageSet->search(thisNgram);
+
+        if (bits != 0) {
+            hitCount += 1;
 
+            for (int32_t lang = 0; bits != 0; lang += 1, bits >>= 1) {
+                languageHitCounts[lang] += bits & 1;
+            }
+        }
+    }
 }
 
 void NGramParser::addByte(int32_t b)
@@ -103,11 +193,13 @@ int32_t NGramParser::nextByte(InputText *det)
 
 void NGramParser::parseCharacters(InputText *det)
 {
-    int32_t b;
+    const uint8_t *input = det->fInputBytes;
     bool ignoreSpace = FALSE;
 
-    while ((b = nextByte(det)) >= 0) {
-        uint8_t mb = charMap[b];
+    // Same as looping over nextByte(), which only subclasses with
+    // their own parseCharacters() override, without a virtual call per byte.
+    while (byteIndex < det->fInputLen) {
+        uint8_t mb = charMap[input[byteIndex++]];
 
         // TODO: 0x20 might not be a space in all character sets...
         if (mb != 0) {
@@ -127,7 +219,19 @@ int32_t NGramParser::parse(InputText *det)
     // TODO: Is this OK? The buffer could have ended in the middle of a word...
     addByte(0x20);
 
-    double rawPercent = (double) hitCount / (double) ngramCount;
+    return getConfidence(hitCount);
+}
+
+int32_t NGramParser::getLanguageConfidence(int32_t language) const
+{
+    U_ASSERT(languageSet != NULL);
+
+    return getConfidence(languageHitCounts[language]);
+}
+
+int32_t NGramParser::getConfidence(int32_t hits) const
+{
+    double rawPercent = (double) hits / (double) ngramCount;
 
     //            if (rawPercent <= 2.0) {
     //                return 0;
@@ -704,11 +808,6 @@ static const uint8_t charMap_IBM420_ar[]= {
 
 //ISO-8859-1,2,5,6,7,8,9 Ngrams
 
-struct NGramsPlusLang {
-    const int32_t ngrams[64];
-    const char *  lang;
-};
-
 static const NGramsPlusLang ngrams_8859_1[] =  {
   { 
     {
@@ -884,6 +983,12 @@ static const int32_t ngrams_8859_9_tr[] = {
     0x6E206B, 0x6E6461, 0x6E6465, 0x6E6520, 0x6E6920, 0x6E696E, 0x6EFD20, 0x72696E, 0x72FD6E, 0x766520, 0x796120, 0x796F72, 0xFD6E20, 0xFD6E64, 0xFD6EFD, 0xFDF0FD,
 };
 
+CharsetRecog_8859_1::CharsetRecog_8859_1()
+ : languages(ngrams_8859_1, UPRV_LENGTHOF(ngrams_8859_1))
+{
+    // nothing else to do
+}
+
 CharsetRecog_8859_1::~CharsetRecog_8859_1()
 {
     // nothing to do
@@ -893,10 +998,11 @@ UBool CharsetRecog_8859_1::match(InputText *textIn, CharsetMatch *results) const
     const char *name = textIn->fC1Bytes? "windows-1252" : "ISO-8859-1";
     uint32_t i;
     int32_t bestConfidenceSoFar = -1;
+    NGramParser parser(&languages, charMap_8859_1);
+    parser.parse(textIn);
     for (i=0; i < UPRV_LENGTHOF(ngrams_8859_1) ; i++) {
-        const int32_t *ngrams = ngrams_8859_1[i].ngrams;
         const char    *lang   = ngrams_8859_1[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_1);
+        int32_t confidence = parser.getLanguageConfidence(i);
         if (confidence > bestConfidenceSoFar) {
             results->set(textIn, this, confidence, name, lang);
             bestConfidenceSoFar = confidence;
@@ -911,6 +1017,12 @@ const char *CharsetRecog_8859_1::getName() const
 }
 
 
+CharsetRecog_8859_2::CharsetRecog_8859_2()
+ : languages(ngrams_8859_2, UPRV_LENGTHOF(ngrams_8859_2))
+{
+    // nothing else to do
+}
+
 CharsetRecog_8859_2::~CharsetRecog_8859_2()
 {
     // nothing to do
@@ -920,10 +1032,11 @@ UBool CharsetRecog_8859_2::match(InputText *textIn, CharsetMatch *results) const
     const char *name = textIn->fC1Bytes? "windows-1250" : "ISO-8859-2";
     uint32_t i;
     int32_t bestConfidenceSoFar = -1;
+    NGramParser parser(&languages, charMap_8859_2);
+    parser.parse(textIn);
     for (i=0; i < UPRV_LENGTHOF(ngrams_8859_2) ; i++) {
-        const int32_t *ngrams = ngrams_8859_2[i].ngrams;
         const char    *lang   = ngrams_8859_2[i].lang;
-        int32_t confidence = match_sbcs(textIn, ngrams, charMap_8859_2);
+        int32_t confidence = parser.getLanguageConfidence(i);
         if (confidence > bestConfidenceSoFar) {
             results->set(textIn, this, confidence, name, lang);
             bestConfidenceSoFar = confidence;
@@ -18,14 +18,46 @@
 
 U_NAMESPACE_BEGIN
 
+struct NGramsPlusLang {
+    const int32_t ngrams[64];
+    const char *  lang;
+};
+
+/*
+ * The n-gram tables for several languages of one charset, merged into one
+ * sorted table. Each entry has a bit set for each language that lists it,
+ * so that one pass over the input counts the hits for all of the languages.
+ */
+class NGramLanguageSet : public UMemory
+{
+public:
+    enum { MAX_LANGUAGES = 16 };
+
+    NGramLanguageSet(const NGramsPlusLang *languages, int32_t languagesLength);
+    ~NGramLanguageSet();
+
+    /*
+    * Binary search for value in the merged table.
+    * Returns the bit set of the languages with that n-gram, or 0 if there are none.
+    */
+    uint32_t search(int32_t value) const;
+
+private:
+    int32_t length;
+    int32_t ngrams[MAX_LANGUAGES * 64];
+    uint16_t languageBits[MAX_LANGUAGES * 64];
+};
+
 class NGramParser : public UMemory
 {
 private:
     int32_t ngram;
     const int32_t *ngramList;    
+    const NGramLanguageSet *languageSet;
 
     int32_t ngramCount;
     int32_t hitCount;
+    int32_t languageHitCounts[NGramLanguageSet::MAX_LANGUAGES];
 
 protected:
 	int32_t byteIndex;
@@ -35,6 +67,7 @@ class NGramParser : public UMemory
 
 public:
     NGramParser(const int32_t *theNgramList, const uint8_t *theCharMap);
+    NGramParser(const NGramLanguageSet *theLanguageSet, const uint8_t *theCharMap);
     virtual ~NGramParser();
 
 private:
@@ -48,9 +81,17 @@ class NGramParser : public UMemory
     virtual int32_t nextByte(InputText *det);
 	virtual void parseCharacters(InputText *det);
 
+    int32_t getConfidence(int32_t hits) const;
+
 public:
     int32_t parse(InputText *det);
 
+    /*
+    * After parse() with a language set: the confidence for one of its languages,
+    * the same as parse() with that language's n-gram table would have returned.
+    */
+    int32_t getLanguageConfidence(int32_t language) const;
+
 };
 
 #if !UCONFIG_ONLY_HTML_CONVERSION
@@ -82,17 +123,25 @@ class CharsetRecog_sbcs : public CharsetRecognizer
 class CharsetRecog_8859_1 : public CharsetRecog_sbcs
 {
 public:
+    CharsetRecog_8859_1();
     virtual ~CharsetRecog_8859_1();
     const char *getName() const;
     virtual UBool match(InputText *det, CharsetMatch *results) const;
+
+private:
+    NGramLanguageSet languages;
 };
 
 class CharsetRecog_8859_2 : public CharsetRecog_sbcs
 {
 public:
+    CharsetRecog_8859_2();
     virtual ~CharsetRecog_8859_2();
     const char *getName() const;
     virtual UBool match(InputText *det, CharsetMatch *results) const;
+
+private:
+    NGramLanguageSet languages;
 };
 
 class CharsetRecog_8859_5 : public CharsetRecog_sbcs
@@ -129,6 +129,12 @@ UBool CharsetRecog_UTF_32::match(InputText* textIn, CharsetMatch *results) const
     bool hasBOM = FALSE;
     int32_t confidence = 0;
 
+    if (!textIn->fHasNULBytes) {
+        // Each UTF-32 code unit up to U+10FFFF has a 0x00 byte,
+        // so there are no valid characters to count.
+        limit = 0;
+    }
+
     if (limit > 0 && getChar(input, 0) == 0x0000FEFFUL) {
         hasBOM = TRUE;
     }
@@ -13,6 +13,7 @@
 
 #include "csrutf8.h"
 #include "csmatch.h"
+#include "uasciirun.h"
 
 U_NAMESPACE_BEGIN
 
@@ -42,12 +43,14 @@ UBool CharsetRecog_UTF8::match(InputText* input, CharsetMatch *results) const {
 
     // Scan for multi-byte sequences
     for (i=0; i < input->fRawLength; i += 1) {
-        int32_t b = inputBytes[i];
+        i += uprv_asciiSpan(inputBytes + i, input->fRawLength - i);   // Skip ASCII
 
-        if ((b & 0x80) == 0) {
-            continue;   // ASCII
+        if (i >= input->fRawLength) {
+            break;
         }
 
+        int32_t b = inputBytes[i];
+
         // Hi bit on char found.  Figure out how long the sequence should be
         if ((b & 0x0E0) == 0x0C0) {
             trailBytes = 1;
@@ -15,6 +15,7 @@
 
 #include "cmemory.h"
 #include "cstring.h"
+#include "uasciirun.h"
 
 #include <string.h>
 
@@ -50,6 +51,8 @@ void InputText::setText(const char *in, int32_t len)
 {
     fInputLen  = 0;
     fC1Bytes   = FALSE;
+    fHasHighBytes = FALSE;
+    fHasNULBytes  = FALSE;
     fRawInput  = (const uint8_t *) in;
     fRawLength = len == -1? (int32_t)uprv_strlen(in) : len;
 }
@@ -143,12 +146,26 @@ void InputText::MungeInput(UBool fStripTags) {
     //
     // Tally up the byte occurence statistics.
     // These are available for use by the various detectors.
+    // Four partial tallies keep runs of the same byte value
+    // from stalling on one counter.
     //
 
-    uprv_memset(fByteStats, 0, (sizeof fByteStats[0]) * 256);
+    uint16_t counts[4][256];
+    uprv_memset(counts, 0, sizeof(counts));
 
-    for (srci = 0; srci < fInputLen; srci += 1) {
-        fByteStats[fInputBytes[srci]] += 1;
+    for (srci = 0; srci + 4 <= fInputLen; srci += 4) {
+        counts[0][fInputBytes[srci]] += 1;
+        counts[1][fInputBytes[srci + 1]] += 1;
+        counts[2][fInputBytes[srci + 2]] += 1;
+        counts[3][fInputBytes[srci + 3]] += 1;
+    }
+
+    for (; srci < fInputLen; srci += 1) {
+        counts[0][fInputBytes[srci]] += 1;
+    }
+
+    for (int32_t i = 0; i < 256; i += 1) {
+        fByteStats[i] = (int16_t)(counts[0][i] + counts[1][i] + counts[2][i] + counts[3][i]);
     }
 
     for (int32_t i = 0x80; i <= 0x9F; i += 1) {
@@ -157,6 +174,14 @@ void InputText::MungeInput(UBool fStripTags) {
             break;
         }
     }
+
+    //
+    // Note whether the raw input is all ASCII, and whether it contains any NULs.
+    // The recognizers that look at all of the raw input use these
+    // to settle on a confidence without another pass over the bytes.
+    //
+    fHasHighBytes = uprv_asciiSpan(fRawInput, fRawLength) < fRawLength;
+    fHasNULBytes  = fRawLength > 0 && uprv_memchr(fRawInput, 0, fRawLength) != NULL;
 }
 
 U_NAMESPACE_END
@@ -47,6 +47,8 @@ class InputText : public UMemory
     //   Value is rounded up, so zero really means zero occurences. 
     int16_t  *fByteStats;
     UBool     fC1Bytes;          // True if any bytes in the range 0x80 - 0x9F are in the input;false by default
+    UBool     fHasHighBytes;     // True if any bytes in the range 0x80 - 0xFF are in the raw input.
+    UBool     fHasNULBytes;      // True if any 0x00 bytes are in the raw input.
     char     *fDeclaredEncoding;
 
     const uint8_t           *fRawInput;     // Original, untouched input bytes.
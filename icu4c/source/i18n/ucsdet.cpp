@@ -170,6 +170,26 @@ ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter)
     return prev;
 }
 
+U_CAPI  UBool U_EXPORT2
+ucsdet_isFastModeEnabled(const UCharsetDetector *ucsd)
+{
+    if (ucsd == NULL) {
+        return FALSE;
+    }
+
+    return ((CharsetDetector *) ucsd)->getFastModeFlag();
+}
+
+U_CAPI  UBool U_EXPORT2
+ucsdet_enableFastMode(UCharsetDetector *ucsd, UBool enabled)
+{
+    if (ucsd == NULL) {
+        return FALSE;
+    }
+
+    return ((CharsetDetector *) ucsd)->setFastModeFlag(enabled);
+}
+
 U_CAPI  int32_t U_EXPORT2
 ucsdet_getUChars(const UCharsetMatch *ucsm,
                  UChar *buf, int32_t cap, UErrorCode *status)
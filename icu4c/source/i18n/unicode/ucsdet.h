@@ -379,6 +379,37 @@ ucsdet_isInputFilterEnabled(const UCharsetDetector *ucsd);
 U_STABLE  UBool U_EXPORT2
 ucsdet_enableInputFilter(UCharsetDetector *ucsd, UBool filter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Test whether fast mode is enabled for this charset detector.
+ *
+ * @param ucsd  The charset detector to check.
+ * @return TRUE if fast mode is enabled.
+ * @draft ICU 64
+ */
+U_DRAFT UBool U_EXPORT2
+ucsdet_isFastModeEnabled(const UCharsetDetector *ucsd);
+
+/**
+ * Enable fast mode. In fast mode, <code>ucsdet_detectAll()</code>
+ * stops trying charsets as soon as one of them matches with a confidence of 100,
+ * so it may return fewer matches than otherwise.
+ * The first (best) match is the same either way.
+ *
+ * <code>ucsdet_detect()</code> always stops at such a decisive match.
+ * A later call to <code>ucsdet_detectAll()</code> with fast mode disabled
+ * tries the remaining charsets and returns all of the matches.
+ *
+ * @param ucsd    the charset detector to be modified.
+ * @param enabled <code>TRUE</code> to enable fast mode.
+ * @return The previous setting.
+ *
+ * @draft ICU 64
+ */
+U_DRAFT UBool U_EXPORT2
+ucsdet_enableFastMode(UCharsetDetector *ucsd, UBool enabled);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_INTERNAL_API
 /**
   *  Get an iterator over the set of detectable charsets -
@@ -53,6 +53,7 @@ cnv_open(const char *name, UErrorCode *pErrorCode) {
 
 static void ListNames(void);
 static void TestFlushCache(void);
+static void TestConverterPool(void);
 static void TestDuplicateAlias(void);
 static void TestCCSID(void);
 static void TestJ932(void);
@@ -70,6 +71,7 @@ static void TestConvertEx(void);
 static void TestConvertExFromUTF8(void);
 static void TestConvertExFromUTF8_C5F0(void);
 static void TestConvertAlgorithmic(void);
+static void TestConvertParallel(void);
        void TestDefaultConverterError(void);    /* defined in cctest.c */
        void TestDefaultConverterSet(void);    /* defined in cctest.c */
 static void TestToUCountPending(void);
@@ -88,6 +90,7 @@ void addTestConvert(TestNode** root)
     addTest(root, &ListNames,                   "tsconv/ccapitst/ListNames");
     addTest(root, &TestConvert,                 "tsconv/ccapitst/TestConvert");
     addTest(root, &TestFlushCache,              "tsconv/ccapitst/TestFlushCache"); 
+    addTest(root, &TestConverterPool,           "tsconv/ccapitst/TestConverterPool");
     addTest(root, &TestAlias,                   "tsconv/ccapitst/TestAlias"); 
     addTest(root, &TestDuplicateAlias,          "tsconv/ccapitst/TestDuplicateAlias"); 
     addTest(root, &TestConvertSafeClone,        "tsconv/ccapitst/TestConvertSafeClone");
@@ -105,6 +108,7 @@ void addTestConvert(TestNode** root)
     addTest(root, &TestConvertExFromUTF8,       "tsconv/ccapitst/TestConvertExFromUTF8");
     addTest(root, &TestConvertExFromUTF8_C5F0,  "tsconv/ccapitst/TestConvertExFromUTF8_C5F0");
     addTest(root, &TestConvertAlgorithmic,      "tsconv/ccapitst/TestConvertAlgorithmic");
+    addTest(root, &TestConvertParallel,         "tsconv/ccapitst/TestConvertParallel");
     addTest(root, &TestDefaultConverterError,   "tsconv/ccapitst/TestDefaultConverterError");
     addTest(root, &TestDefaultConverterSet,     "tsconv/ccapitst/TestDefaultConverterSet");
 #if !UCONFIG_NO_FILE_IO
@@ -1136,6 +1140,94 @@ static void TestFlushCache(void) {
 #endif
 }
 
+static void TestConverterPool(void) {
+    UErrorCode err = U_ZERO_ERROR;
+    UConverter *cnv, *cnv2, *pooled[10];
+    UChar target[4];
+    UChar *pTarget;
+    const char *source;
+    int32_t i, flushCount;
+
+    ucnv_release(NULL);  /* no-op */
+
+    /* A released converter is returned again, after a reset, also for an alias. */
+    cnv = ucnv_acquire("UTF-8", &err);
+    if (U_FAILURE(err)) {
+        log_err("ucnv_acquire(UTF-8) failed - %s\n", u_errorName(err));
+        return;
+    }
+    source = "a\xc3";
+    pTarget = target;
+    ucnv_toUnicode(cnv, &pTarget, target + UPRV_LENGTHOF(target), &source, source + 2, NULL, FALSE, &err);
+    if (U_FAILURE(err) || ucnv_toUCountPending(cnv, &err) != 1) {
+        log_err("UTF-8 toUnicode() did not leave one pending byte - %s\n", u_errorName(err));
+    }
+    ucnv_release(cnv);
+    cnv2 = ucnv_acquire("utf8", &err);
+    if (U_FAILURE(err) || cnv2 != cnv) {
+        log_err("ucnv_acquire(utf8) did not return the released UTF-8 converter - %s\n", u_errorName(err));
+    } else if (ucnv_toUCountPending(cnv2, &err) != 0) {
+        log_err("ucnv_acquire(utf8) returned a converter that was not reset\n");
+    }
+
+    /* A converter with a changed callback is not pooled. */
+    ucnv_setToUCallBack(cnv2, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &err);
+    ucnv_release(cnv2);
+    cnv = ucnv_acquire("UTF-8", &err);
+    if (U_FAILURE(err)) {
+        log_err("ucnv_acquire(UTF-8) failed - %s\n", u_errorName(err));
+    } else {
+        UConverterToUCallback toUAction;
+        const void *toUContext;
+        ucnv_getToUCallBack(cnv, &toUAction, &toUContext);
+        if (toUAction != UCNV_TO_U_CALLBACK_SUBSTITUTE || toUContext != NULL) {
+            log_err("ucnv_acquire(UTF-8) returned a converter with a modified callback\n");
+        }
+    }
+    ucnv_close(cnv);
+
+    /* The pool is bounded; releasing many converters must not fail. */
+    for (i = 0; i < UPRV_LENGTHOF(pooled); ++i) {
+        pooled[i] = ucnv_acquire("ISO-8859-1", &err);
+    }
+    if (U_FAILURE(err)) {
+        log_err("ucnv_acquire(ISO-8859-1) failed - %s\n", u_errorName(err));
+    }
+    for (i = 0; i < UPRV_LENGTHOF(pooled); ++i) {
+        if (pooled[i] == NULL) {
+            continue;
+        }
+        ucnv_release(pooled[i]);
+    }
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /* ucnv_flushCache() closes pooled converters so that their data can be unloaded. */
+    ucnv_flushCache();
+    cnv = ucnv_acquire("ibm-1047", &err);
+    if (U_FAILURE(err)) {
+        log_data_err("ucnv_acquire(ibm-1047) failed - %s\n", u_errorName(err));
+        return;
+    }
+    ucnv_release(cnv);
+    if ((flushCount = ucnv_flushCache()) != 1) {
+        log_err("ucnv_flushCache() with a pooled converter unloaded %d tables, expected 1\n", flushCount);
+    }
+
+    /* A converter from a package is not pooled: An ICU converter could have the same name. */
+    cnv = ucnv_openPackage(loadTestData(&err), "test1", &err);
+    if (U_FAILURE(err)) {
+        log_data_err("ucnv_openPackage(testdata, test1) failed - %s\n", u_errorName(err));
+    } else {
+        ucnv_release(cnv);
+        cnv = ucnv_acquire("test1", &err);
+        if (cnv != NULL) {
+            log_err("ucnv_acquire(test1) returned the converter from the testdata package\n");
+            ucnv_close(cnv);
+        }
+    }
+#endif
+}
+
 /**
  * Test the converter alias API, specifically the fuzzy matching of
  * alias names and the alias table integrity.  Make sure each
@@ -2889,6 +2981,209 @@ ucnv_close(cnv);
 #endif
 }
 
+#if !UCONFIG_NO_LEGACY_CONVERSION
+/*
+ * Runs the ucnv_convertParallel() tasks on this thread in reverse order,
+ * which must yield the same result.
+ * Sets the context's int32_t to the number of tasks.
+ */
+static void U_CALLCONV
+runTasksBackward(const void *context, UConverterTaskFn *fn, void *tasks[], int32_t count) {
+    int32_t i;
+    *(int32_t *)context=count;
+    for(i=count-1; i>=0; --i) {
+        fn(tasks[i]);
+    }
+}
+#endif
+
+static void
+TestConvertParallel() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /*
+     * Text with ASCII, Latin-1, Kanji, Hangul, Thai, and supplementary characters.
+     * Some of them are unmappable in some of the charsets.
+     */
+    static const UChar pattern[]={
+        0x41, 0x42, 0x20, 0xe4, 0x4e00, 0x30a1, 0x20, 0xac00, 0xd55c, 0x2e,
+        0xe01, 0x31, 0xd840, 0xdc00, 0xff61, 0x410, 0x20ac, 0xd, 0xa, 0x3000
+    };
+    static const struct {
+        const char *source, *target;
+    } pairs[]={
+        { "UTF-8", "Shift-JIS" },
+        { "Shift-JIS", "UTF-8" },
+        { "gb18030", "UTF-16LE" },
+        { "UTF-16BE", "gb18030" },
+        { "UTF-32LE", "UTF-8" },
+        { "ISO-8859-1", "UTF-8" },
+        { "windows-1252", "UTF-32BE" },
+        { "ibm-930", "UTF-8" },     /* SI/SO stateful, converted serially */
+        { "UTF-8", "ibm-1390" },    /* multiple-character mappings, converted serially */
+        { "UTF-16", "UTF-8" }       /* BOM, converted serially */
+    };
+    /* the first pairs can be split */
+    enum { SPLITTABLE_PAIRS_COUNT=7 };
+    enum { TEXT_LENGTH=400000, SOURCE_CAPACITY=4*TEXT_LENGTH+16 };
+
+    UChar *text=(UChar *)malloc(TEXT_LENGTH*U_SIZEOF_UCHAR);
+    char *source=(char *)malloc(SOURCE_CAPACITY);
+    char *expected=(char *)malloc(SOURCE_CAPACITY);
+    char *actual=(char *)malloc(SOURCE_CAPACITY);
+    UErrorCode errorCode;
+    int32_t i, sourceLength, expectedLength, length, taskCount;
+
+    for(i=0; i<TEXT_LENGTH; ++i) {
+        text[i]=pattern[i%UPRV_LENGTHOF(pattern)];
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(pairs); ++i) {
+        UConverter *sourceCnv, *targetCnv;
+        const char *sourceName=pairs[i].source, *targetName=pairs[i].target;
+
+        errorCode=U_ZERO_ERROR;
+        sourceCnv=ucnv_open(sourceName, &errorCode);
+        targetCnv=ucnv_open(targetName, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open the %s or %s converter - %s\n",
+                         sourceName, targetName, u_errorName(errorCode));
+            ucnv_close(sourceCnv);
+            ucnv_close(targetCnv);
+            continue;
+        }
+
+        sourceLength=ucnv_fromUChars(sourceCnv, source, SOURCE_CAPACITY, text, TEXT_LENGTH, &errorCode);
+        /* some illegal byte sequences */
+        source[sourceLength/3]=(char)0xff;
+        source[(sourceLength*3)/4]=(char)0x81;
+        expectedLength=ucnv_convert(targetName, sourceName, expected, SOURCE_CAPACITY,
+                                    source, sourceLength, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("ucnv_convert(%s -> %s) failed - %s\n", sourceName, targetName, u_errorName(errorCode));
+            ucnv_close(sourceCnv);
+            ucnv_close(targetCnv);
+            continue;
+        }
+
+        taskCount=0;
+        length=ucnv_convertParallel(targetCnv, sourceCnv, actual, SOURCE_CAPACITY,
+                                    source, sourceLength, 4,
+                                    runTasksBackward, &taskCount, &errorCode);
+        if( U_FAILURE(errorCode) ||
+            length!=expectedLength ||
+            memcmp(actual, expected, length)!=0
+        ) {
+            log_err("ucnv_convertParallel(%s -> %s) differs from ucnv_convert() - %s, length %d expect %d\n",
+                    sourceName, targetName, u_errorName(errorCode), (int)length, (int)expectedLength);
+        }
+        if(i<SPLITTABLE_PAIRS_COUNT ? taskCount!=4 : taskCount!=0) {
+            log_err("ucnv_convertParallel(%s -> %s) ran %d tasks\n",
+                    sourceName, targetName, (int)taskCount);
+        }
+
+        /* preflighting */
+        length=ucnv_convertParallel(targetCnv, sourceCnv, NULL, 0,
+                                    source, sourceLength, 4,
+                                    runTasksBackward, &taskCount, &errorCode);
+        if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=expectedLength) {
+            log_err("ucnv_convertParallel(%s -> %s, preflighting) fails - %s, length %d expect %d\n",
+                    sourceName, targetName, u_errorName(errorCode), (int)length, (int)expectedLength);
+        }
+
+        /*
+         * With the stop callback, the same error is reported as in serial conversion.
+         * The output is a prefix of the substituted output.
+         * Its exact length depends on how much text is pending in the pivot buffer.
+         */
+        errorCode=U_ZERO_ERROR;
+        ucnv_setToUCallBack(sourceCnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+        ucnv_convertParallel(targetCnv, sourceCnv, actual, SOURCE_CAPACITY,
+                             source, sourceLength, 1, NULL, NULL, &errorCode);
+        if(errorCode==U_ILLEGAL_CHAR_FOUND || errorCode==U_INVALID_CHAR_FOUND) {
+            UErrorCode expectedErrorCode=errorCode;
+            errorCode=U_ZERO_ERROR;
+            length=ucnv_convertParallel(targetCnv, sourceCnv, actual, SOURCE_CAPACITY,
+                                        source, sourceLength, 4,
+                                        runTasksBackward, &taskCount, &errorCode);
+            if( errorCode!=expectedErrorCode ||
+                length>=expectedLength ||
+                memcmp(actual, expected, length)!=0
+            ) {
+                log_err("ucnv_convertParallel(%s -> %s, stop callback) fails - %s expect %s, length %d\n",
+                        sourceName, targetName, u_errorName(errorCode), u_errorName(expectedErrorCode),
+                        (int)length);
+            }
+        }
+
+        ucnv_close(sourceCnv);
+        ucnv_close(targetCnv);
+    }
+
+    /*
+     * test3 has toUnicode extension mappings from several characters,
+     * like \x07+\x00+\x01\x02\x0f+\x09.
+     * The input must not be split inside one of them.
+     * Different lengths move the split points through the byte pattern.
+     */
+    {
+        static const char mnBytes[]={ 7, 0, 1, 2, 0xf, 9 };
+        UConverter *sourceCnv, *targetCnv;
+        errorCode=U_ZERO_ERROR;
+        sourceCnv=ucnv_openPackage(loadTestData(&errorCode), "test3", &errorCode);
+        targetCnv=ucnv_open("UTF-8", &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open the test3 or UTF-8 converter - %s\n", u_errorName(errorCode));
+        } else {
+            for(i=0; i<TEXT_LENGTH; ++i) {
+                source[i]=mnBytes[i%UPRV_LENGTHOF(mnBytes)];
+            }
+            for(sourceLength=TEXT_LENGTH; sourceLength>TEXT_LENGTH-UPRV_LENGTHOF(mnBytes); --sourceLength) {
+                expectedLength=ucnv_convertParallel(targetCnv, sourceCnv, expected, SOURCE_CAPACITY,
+                                                    source, sourceLength, 1, NULL, NULL, &errorCode);
+                length=ucnv_convertParallel(targetCnv, sourceCnv, actual, SOURCE_CAPACITY,
+                                            source, sourceLength, 4,
+                                            runTasksBackward, &taskCount, &errorCode);
+                if( U_FAILURE(errorCode) ||
+                    length!=expectedLength ||
+                    memcmp(actual, expected, length)!=0
+                ) {
+                    log_err("ucnv_convertParallel(test3 -> UTF-8, source length %d) differs from "
+                            "serial conversion - %s, length %d expect %d\n",
+                            (int)sourceLength, u_errorName(errorCode), (int)length, (int)expectedLength);
+                    break;
+                }
+            }
+        }
+        ucnv_close(sourceCnv);
+        ucnv_close(targetCnv);
+    }
+
+    /* illegal arguments */
+    {
+        UConverter *utf8Cnv;
+        errorCode=U_ZERO_ERROR;
+        utf8Cnv=ucnv_open("UTF-8", &errorCode);
+        length=ucnv_convertParallel(utf8Cnv, utf8Cnv, actual, SOURCE_CAPACITY, "abc", 3, -1,
+                                    runTasksBackward, &taskCount, &errorCode);
+        if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucnv_convertParallel(numThreads=-1) sets %s\n", u_errorName(errorCode));
+        }
+        errorCode=U_ZERO_ERROR;
+        length=ucnv_convertParallel(NULL, utf8Cnv, actual, SOURCE_CAPACITY, "abc", 3, 2,
+                                    runTasksBackward, &taskCount, &errorCode);
+        if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("ucnv_convertParallel(targetCnv=NULL) sets %s\n", u_errorName(errorCode));
+        }
+        ucnv_close(utf8Cnv);
+    }
+
+    free(text);
+    free(source);
+    free(expected);
+    free(actual);
+#endif
+}
+
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
 static void TestLMBCSMaxChar(void) {
     static const struct {
@@ -11,6 +11,7 @@
 *******************************************************************************
 */
 
+#include <stdio.h>
 #include "cintltst.h"
 #include "uhash.h"
 #include "unicode/ctest.h"
@@ -24,6 +25,7 @@
 static void TestBasic(void);
 static void TestOtherAPI(void);
 static void hashIChars(void);
+static void TestGroupProbing(void);
 
 static int32_t U_EXPORT2 U_CALLCONV hashChars(const UHashTok key);
 
@@ -89,6 +91,7 @@ void addHashtableTest(TestNode** root) {
     addTest(root, &TestBasic,   "tsutil/chashtst/TestBasic");
     addTest(root, &TestOtherAPI, "tsutil/chashtst/TestOtherAPI");
     addTest(root, &hashIChars, "tsutil/chashtst/hashIChars");
+    addTest(root, &TestGroupProbing, "tsutil/chashtst/TestGroupProbing");
     
 }
 
@@ -317,6 +320,77 @@ static void hashIChars(void) {
  * uhash Callbacks
  *********************************************************************/
 
+/**
+ * Switches tables to group probing while they have contents, then grows
+ * and shrinks them.  With hashChars() all keys collide, so that lookups
+ * probe through many groups with deleted slots.
+ */
+static void TestGroupProbing(void) {
+    enum { COUNT = 1200, SWITCH_COUNT = 100 };
+    static char keys[COUNT][8];
+    int32_t i, t;
+
+    for (i = 0; i < COUNT; ++i) {
+        sprintf(keys[i], "k%ld", (long)i);
+    }
+    for (t = 0; t < 2; ++t) {
+        UErrorCode status = U_ZERO_ERROR;
+        UHashtable *hash = t == 0 ?
+            uhash_open(uhash_hashChars, uhash_compareChars, NULL, &status) :
+            uhash_open(hashChars, isEqualChars, NULL, &status);
+        const UHashElement *e;
+        int32_t pos = UHASH_FIRST, count = 0;
+        if (U_FAILURE(status)) {
+            log_err("FAIL: uhash_open failed with %s\n", u_errorName(status));
+            return;
+        }
+        uhash_setResizePolicy(hash, U_GROW_AND_SHRINK);
+        for (i = 0; i < SWITCH_COUNT; ++i) {
+            _put(hash, keys[i], i + 1, 0);
+        }
+        for (i = 0; i < SWITCH_COUNT; i += 3) {
+            _remove(hash, keys[i], i + 1);
+        }
+        uhash_setGroupProbing(hash, &status);
+        if (U_FAILURE(status)) {
+            log_err("FAIL: uhash_setGroupProbing failed with %s\n", u_errorName(status));
+            uhash_close(hash);
+            return;
+        }
+        for (i = 0; i < SWITCH_COUNT; ++i) {
+            _get(hash, keys[i], i % 3 == 0 ? 0 : i + 1);
+        }
+        while ((e = uhash_nextElement(hash, &pos)) != NULL) {
+            i = e->value.integer - 1;
+            if (i < 0 || i >= SWITCH_COUNT || i % 3 == 0 || e->key.pointer != keys[i]) {
+                log_err("FAIL: uhash_nextElement() returned an unexpected element\n");
+            }
+            ++count;
+        }
+        if (count != uhash_count(hash) || count != SWITCH_COUNT - (SWITCH_COUNT + 2) / 3) {
+            log_err("FAIL: iterated over %ld elements, uhash_count()=%ld\n",
+                    (long)count, (long)uhash_count(hash));
+        }
+        /* Grow, then remove most keys so that the table shrinks. */
+        for (i = 0; i < COUNT; ++i) {
+            _put(hash, keys[i], i + 1, i < SWITCH_COUNT && i % 3 != 0 ? i + 1 : 0);
+        }
+        for (i = 0; i < COUNT; ++i) {
+            if (i % 50 != 0) {
+                _remove(hash, keys[i], i + 1);
+            }
+        }
+        for (i = 0; i < COUNT; ++i) {
+            _get(hash, keys[i], i % 50 == 0 ? i + 1 : 0);
+        }
+        if (uhash_count(hash) != COUNT / 50) {
+            log_err("FAIL: uhash_count()=%ld, expected %ld\n",
+                    (long)uhash_count(hash), (long)(COUNT / 50));
+        }
+        uhash_close(hash);
+    }
+}
+
 /**
  * This hash function is designed to collide a lot to test key equality
  * resolution.  It only uses the first char.
@@ -208,6 +208,7 @@ void addNEWResourceBundleTest(TestNode** root)
     addTest(root, &TestResourceLevelAliasing, "tsutil/creststn/TestResourceLevelAliasing");
     addTest(root, &TestDirectAccess,          "tsutil/creststn/TestDirectAccess"); 
     addTest(root, &TestTicket9804,            "tsutil/creststn/TestTicket9804"); 
+    addTest(root, &TestKeyPathFast,           "tsutil/creststn/TestKeyPathFast");
     addTest(root, &TestXPath,                 "tsutil/creststn/TestXPath");
     addTest(root, &TestCLDRStyleAliases,      "tsutil/creststn/TestCLDRStyleAliases");
     addTest(root, &TestFallbackCodes,         "tsutil/creststn/TestFallbackCodes");
@@ -2516,6 +2517,77 @@ static void TestTicket9804(void) {
     ures_close(t);
 }
 
+static void TestKeyPathFast(void) {
+    /* ures_getByKeyPathFast() must find the same resources as ures_getByKeyWithFallback(). */
+    static const char *const paths[] = {
+        "calendar/islamic-civil/eras",      /* inherited from root */
+        "calendar/gregorian/dayNames/format/wide",
+        "NumberElements/latn/symbols/decimal",
+        "Languages/hr",                     /* large table */
+        "calendar/islamic-civil/DateTime",  /* does not exist */
+        "Languages/xyz"                     /* does not exist */
+    };
+    static const char *const locales[] = { "he", "de_CH", "root" };
+    UErrorCode status = U_ZERO_ERROR;
+    UResKeyPath keyPath;
+    int32_t i, j;
+
+    for(i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        UResourceBundle *rb = ures_open(NULL, locales[i], &status);
+        if(U_FAILURE(status)) {
+            log_data_err("Couldn't open %s - %s\n", locales[i], u_errorName(status));
+            return;
+        }
+        for(j = 0; j < UPRV_LENGTHOF(paths); ++j) {
+            UErrorCode expectedStatus = U_ZERO_ERROR, actualStatus = U_ZERO_ERROR;
+            UResourceBundle *expected = ures_getByKeyWithFallback(rb, paths[j], NULL, &expectedStatus);
+            UResourceBundle *actual;
+            ures_initKeyPath(&keyPath, paths[j], &status);
+            if(U_FAILURE(status)) {
+                log_err("ures_initKeyPath(%s) failed - %s\n", paths[j], u_errorName(status));
+                status = U_ZERO_ERROR;
+                ures_close(expected);
+                continue;
+            }
+            actual = ures_getByKeyPathFast(rb, &keyPath, NULL, &actualStatus);
+            if(U_SUCCESS(expectedStatus) != U_SUCCESS(actualStatus)) {
+                log_err("%s/%s: ures_getByKeyPathFast() -> %s but ures_getByKeyWithFallback() -> %s\n",
+                        locales[i], paths[j], u_errorName(actualStatus), u_errorName(expectedStatus));
+            } else if(U_SUCCESS(expectedStatus)) {
+                UErrorCode errorCode = U_ZERO_ERROR;
+                if(ures_getType(actual) != ures_getType(expected) ||
+                        ures_getSize(actual) != ures_getSize(expected) ||
+                        uprv_strcmp(ures_getKey(actual), ures_getKey(expected)) != 0 ||
+                        uprv_strcmp(ures_getLocaleByType(actual, ULOC_ACTUAL_LOCALE, &errorCode),
+                                    ures_getLocaleByType(expected, ULOC_ACTUAL_LOCALE, &errorCode)) != 0) {
+                    log_err("%s/%s: ures_getByKeyPathFast() found a different resource\n",
+                            locales[i], paths[j]);
+                }
+            }
+            ures_close(actual);
+            ures_close(expected);
+        }
+        ures_close(rb);
+    }
+
+    /* Paths that do not fit into the UResKeyPath. */
+    ures_initKeyPath(&keyPath, "a/b/c/d/e/f/g/h/i", &status);
+    if(status != U_BUFFER_OVERFLOW_ERROR) {
+        log_err("ures_initKeyPath(too many keys) -> %s instead of U_BUFFER_OVERFLOW_ERROR\n",
+                u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ures_initKeyPath(&keyPath,
+                     "0123456789012345678901234567890123456789/"
+                     "0123456789012345678901234567890123456789/"
+                     "0123456789012345678901234567890123456789",
+                     &status);
+    if(status != U_BUFFER_OVERFLOW_ERROR) {
+        log_err("ures_initKeyPath(too long) -> %s instead of U_BUFFER_OVERFLOW_ERROR\n",
+                u_errorName(status));
+    }
+}
+
 static void TestJB3763(void) {
     /* Nasty bug prevented using parent as fill-in, since it would
      * stomp the path information.
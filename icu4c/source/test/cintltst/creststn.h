@@ -73,6 +73,8 @@ static void TestDirectAccess(void);
 
 static void TestTicket9804(void);
 
+static void TestKeyPathFast(void);
+
 static void TestResourceLevelAliasing(void);
 
 static void TestErrorCodes(void);
@@ -713,6 +713,82 @@ TestCaseCompare(void) {
     }
 }
 
+static void
+TestCaseCompareUTF8(void) {
+    static const struct {
+        const char *s1, *s2;
+        uint32_t options;
+        int32_t expected;  /* sign of the result */
+    } testCases[]={
+        /* same as in TestCaseCompare() */
+        { "aB\xc4\xb1\xce\xa3\xc3\x9f\xef\xac\x83\xf1\x9f\xbf\xbf",
+          "Ab\xc4\xb1\xcf\x83sSFfI\xf1\x9f\xbf\xbf", U_FOLD_CASE_DEFAULT, 0 },
+        { "aB\xc4\xb1\xce\xa3\xc3\x9f\xef\xac\x83\xf1\x9f\xbf\xbf",
+          "Ab\xc4\xb1\xcf\x83SsfFi\xf1\x9f\xbf\xbf", U_FOLD_CASE_EXCLUDE_SPECIAL_I, 0 },
+        { "aB\xc4\xb1\xce\xa3\xc3\x9f\xef\xac\x83\xf1\x9f\xbf\xbf",
+          "Ab\xc4\xb1\xcf\x83sSFfI\xf1\x9f\xbf\xbd", U_FOLD_CASE_DEFAULT, 1 },
+        /* ASCII runs longer than one block */
+        { "Accept-Encoding-Extra-Long-Header-Name", "ACCEPT-ENCODING-EXTRA-LONG-HEADER-NAME", U_FOLD_CASE_DEFAULT, 0 },
+        { "Accept-Encoding-Extra-Long-Header-Name", "ACCEPT-ENCODING-EXTRA-LONG-HEADER-NAMF", U_FOLD_CASE_DEFAULT, -1 },
+        { "Accept-Encoding-Extra-Long-Header-Name", "ACCEPT-ENCODING-EXTRA-LONG-HEADER-NAM", U_FOLD_CASE_DEFAULT, 1 },
+        { "Accept-Encoding-Extra-Long-Header-[", "ACCEPT-ENCODING-EXTRA-LONG-HEADER-{", U_FOLD_CASE_DEFAULT, -1 },
+        { "Stra\xc3\x9f" "e-Stra\xc3\x9f" "e-Stra\xc3\x9f" "e", "STRASSE-strasse-STRASSE", U_FOLD_CASE_DEFAULT, 0 },
+        /* I folds to i or to dotless i */
+        { "KIWI-KIWI-KIWI-KIWI", "kiwi-kiwi-kiwi-kiwi", U_FOLD_CASE_DEFAULT, 0 },
+        { "KIWI-KIWI-KIWI-KIWI", "kiwi-kiwi-kiwi-kiwi", U_FOLD_CASE_EXCLUDE_SPECIAL_I, 1 },
+        { "KIWI-KIWI", "k\xc4\xb1w\xc4\xb1-K\xc4\xb1W\xc4\xb1", U_FOLD_CASE_EXCLUDE_SPECIAL_I, 0 },
+        /* U+FF21 folds to U+FF41, U+10400 to U+10428 */
+        { "\xef\xbc\xa1", "\xf0\x90\x90\x80", U_FOLD_CASE_DEFAULT, 1 },
+        { "\xef\xbc\xa1", "\xf0\x90\x90\x80", U_COMPARE_CODE_POINT_ORDER, -1 },
+        /* ill-formed sequences compare like U+FFFD */
+        { "a\xff", "A\xef\xbf\xbd", U_FOLD_CASE_DEFAULT, 0 },
+        { "a\xe4\xb8", "A\xef\xbf\xbdz", U_FOLD_CASE_DEFAULT, -1 },
+        { "", "", U_FOLD_CASE_DEFAULT, 0 },
+        { "", "a", U_FOLD_CASE_DEFAULT, -1 }
+    };
+    int32_t i;
+    for(i=0; i<UPRV_LENGTHOF(testCases); ++i) {
+        const char *s1=testCases[i].s1, *s2=testCases[i].s2;
+        uint32_t options=testCases[i].options;
+        int32_t expected=testCases[i].expected;
+        UChar u1[64], u2[64];
+        int32_t length16_1, length16_2, result, result16, reverse;
+        UErrorCode errorCode=U_ZERO_ERROR;
+
+        result=u_strCaseCompareUTF8(s1, -1, s2, (int32_t)strlen(s2), options, &errorCode);
+        reverse=u_strCaseCompareUTF8(s2, (int32_t)strlen(s2), s1, -1, options, &errorCode);
+        u_strFromUTF8WithSub(u1, UPRV_LENGTHOF(u1), &length16_1, s1, -1, 0xfffd, NULL, &errorCode);
+        u_strFromUTF8WithSub(u2, UPRV_LENGTHOF(u2), &length16_2, s2, -1, 0xfffd, NULL, &errorCode);
+        result16=u_strCaseCompare(u1, length16_1, u2, length16_2, options, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("error: u_strCaseCompareUTF8(case %ld) failed - %s\n", (long)i, u_errorName(errorCode));
+            continue;
+        }
+        if( (result<0 ? -1 : result>0 ? 1 : 0)!=expected ||
+            (reverse<0 ? 1 : reverse>0 ? -1 : 0)!=expected ||
+            (result16<0 ? -1 : result16>0 ? 1 : 0)!=expected
+        ) {
+            log_err("error: u_strCaseCompareUTF8(case %ld, options 0x%lx)=%ld, reversed %ld, UTF-16 %ld, expected sign %ld\n",
+                    (long)i, (long)options, (long)result, (long)reverse, (long)result16, (long)expected);
+        }
+    }
+
+    /* explicit lengths stop before the end */
+    {
+        UErrorCode errorCode=U_ZERO_ERROR;
+        int32_t result=u_strCaseCompareUTF8("Content-Type", 7, "CONTENT-LENGTH", 7, U_FOLD_CASE_DEFAULT, &errorCode);
+        if(U_FAILURE(errorCode) || result!=0) {
+            log_err("error: u_strCaseCompareUTF8(Content-, CONTENT-)=%ld instead of 0 - %s\n",
+                    (long)result, u_errorName(errorCode));
+        }
+        u_strCaseCompareUTF8(NULL, 0, "a", 1, U_FOLD_CASE_DEFAULT, &errorCode);
+        if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+            log_err("error: u_strCaseCompareUTF8(NULL) - %s instead of U_ILLEGAL_ARGUMENT_ERROR\n",
+                    u_errorName(errorCode));
+        }
+    }
+}
+
 /* test UCaseMap ------------------------------------------------------------ */
 
 /*
@@ -1049,6 +1125,7 @@ void addCaseTest(TestNode** root) {
 #endif
     addTest(root, &TestCaseFolding, "tsutil/cstrcase/TestCaseFolding");
     addTest(root, &TestCaseCompare, "tsutil/cstrcase/TestCaseCompare");
+    addTest(root, &TestCaseCompareUTF8, "tsutil/cstrcase/TestCaseCompareUTF8");
     addTest(root, &TestUCaseMap, "tsutil/cstrcase/TestUCaseMap");
 #if !UCONFIG_NO_BREAK_ITERATION && !UCONFIG_NO_FILE_IO
     addTest(root, &TestUCaseMapToTitle, "tsutil/cstrcase/TestUCaseMapToTitle");
@@ -38,6 +38,7 @@
 #include "udatamem.h"
 #include "cucdapi.h"
 #include "cmemory.h"
+#include "cstring.h"
 
 /* prototypes --------------------------------------------------------------- */
 
@@ -53,6 +54,8 @@ static void TestCodePoint(void);
 static void TestCharLength(void);
 static void TestCharNames(void);
 static void TestUCharFromNameUnderflow(void);
+static void TestCharNamesByPrefix(void);
+static void TestCharFromNameIndex(void);
 static void TestMirroring(void);
 static void TestUScriptRunAPI(void);
 static void TestAdditionalProperties(void);
@@ -63,6 +66,7 @@ static void TestConsistency(void);
 static void TestCaseFolding(void);
 static void TestBinaryCharacterPropertiesAPI(void);
 static void TestIntCharacterPropertiesAPI(void);
+static void TestIntPropertyValuesAPI(void);
 
 /* internal methods used */
 static int32_t MakeProp(char* str);
@@ -188,6 +192,8 @@ void addUnicodeTest(TestNode** root)
     addTest(root, &TestIdentifier, "tsutil/cucdtst/TestIdentifier");
     addTest(root, &TestCharNames, "tsutil/cucdtst/TestCharNames");
     addTest(root, &TestUCharFromNameUnderflow, "tsutil/cucdtst/TestUCharFromNameUnderflow");
+    addTest(root, &TestCharNamesByPrefix, "tsutil/cucdtst/TestCharNamesByPrefix");
+    addTest(root, &TestCharFromNameIndex, "tsutil/cucdtst/TestCharFromNameIndex");
     addTest(root, &TestMirroring, "tsutil/cucdtst/TestMirroring");
     addTest(root, &TestUScriptCodeAPI, "tsutil/cucdtst/TestUScriptCodeAPI");
     addTest(root, &TestHasScript, "tsutil/cucdtst/TestHasScript");
@@ -202,6 +208,8 @@ void addUnicodeTest(TestNode** root)
             "tsutil/cucdtst/TestBinaryCharacterPropertiesAPI");
     addTest(root, &TestIntCharacterPropertiesAPI,
             "tsutil/cucdtst/TestIntCharacterPropertiesAPI");
+    addTest(root, &TestIntPropertyValuesAPI,
+            "tsutil/cucdtst/TestIntPropertyValuesAPI");
 }
 
 /*==================================================== */
@@ -2064,6 +2072,167 @@ TestUCharFromNameUnderflow() {
     }
 }
 
+/*
+ * u_charFromName() searches linearly for the first few names,
+ * then in an index shared by U_UNICODE_CHAR_NAME and U_EXTENDED_CHAR_NAME.
+ */
+static void
+TestCharFromNameIndex() {
+    static const struct {
+        UCharNameChoice nameChoice;
+        const char *name;
+        UChar32 code;
+    } cases[]={
+        { U_UNICODE_CHAR_NAME, "BELL", 0x1f514 },
+        { U_EXTENDED_CHAR_NAME, "bell", 0x1f514 },
+        { U_UNICODE_CHAR_NAME, "<control-0007>", U_SENTINEL },
+        { U_EXTENDED_CHAR_NAME, "<control-0007>", 7 },
+        { U_UNICODE_CHAR_NAME, "latin small letter a", 0x61 },
+        { U_EXTENDED_CHAR_NAME, "LATIN SMALL LETTER A", 0x61 },
+        { U_UNICODE_CHAR_NAME, "LATIN SMALL LETTER A WITH", U_SENTINEL },
+        { U_EXTENDED_CHAR_NAME, "LATIN SMALL LETTER A WITH", U_SENTINEL },
+        { U_CHAR_NAME_ALIAS, "BELL", U_SENTINEL },
+        { U_CHAR_NAME_ALIAS, "LATIN CAPITAL LETTER GHA", 0x1a2 }
+    };
+    int32_t round, i;
+
+    if(uprv_getMaxCharNameLength()==0) {
+        /* no names data available */
+        return;
+    }
+    /* enough lookups for the index to be built in the middle */
+    for(round=0; round<10; ++round) {
+        for(i=0; i<UPRV_LENGTHOF(cases); ++i) {
+            UErrorCode errorCode=U_ZERO_ERROR;
+            UChar32 c=u_charFromName(cases[i].nameChoice, cases[i].name, &errorCode);
+            if(cases[i].code<0 ? errorCode!=U_ILLEGAL_CHAR_FOUND :
+                                 U_FAILURE(errorCode) || c!=cases[i].code) {
+                log_err("round %d: u_charFromName(%d, %s) gets U+%04lx - %s, expected U+%04lx\n",
+                        (int)round, (int)cases[i].nameChoice, cases[i].name,
+                        (long)c, u_errorName(errorCode), (long)cases[i].code);
+            }
+        }
+    }
+}
+
+typedef struct {
+    const char *prefix;
+    char lastName[128];
+    UChar32 lastCode;
+    UBool isAlgorithmic;
+    int32_t count, maxCount;
+} PrefixNamesContext;
+
+static UBool U_CALLCONV
+enumPrefixNamesFn(void *context,
+                  UChar32 code, UCharNameChoice nameChoice,
+                  const char *name, int32_t length) {
+    PrefixNamesContext *p=(PrefixNamesContext *)context;
+    char buffer[128];
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UChar32 c;
+    UBool isAlgorithmic=
+        0==strncmp(name, "CJK UNIFIED IDEOGRAPH-", 22) ||
+        0==strncmp(name, "HANGUL SYLLABLE ", 16);
+
+    if(length!=(int32_t)strlen(name) || 0!=strncmp(name, p->prefix, strlen(p->prefix))) {
+        log_err("u_enumCharNamesByPrefix(%s) got U+%04lx %s not matching the prefix\n",
+                p->prefix, (long)code, name);
+        return FALSE;
+    }
+    u_charName(code, nameChoice, buffer, sizeof(buffer), &errorCode);
+    if(U_FAILURE(errorCode) || 0!=strcmp(buffer, name)) {
+        log_err("u_enumCharNamesByPrefix(%s) got U+%04lx %s but u_charName() returns %s\n",
+                p->prefix, (long)code, name, buffer);
+        return FALSE;
+    }
+    c=u_charFromName(nameChoice, name, &errorCode);
+    if(U_FAILURE(errorCode) || c!=code) {
+        log_err("u_charFromName(%s) gets U+%04lx instead of U+%04lx - %s\n",
+                name, (long)c, (long)code, u_errorName(errorCode));
+        return FALSE;
+    }
+    if(p->count>0) {
+        if(!isAlgorithmic && p->isAlgorithmic) {
+            log_err("u_enumCharNamesByPrefix(%s) got %s after algorithmic names\n", p->prefix, name);
+            return FALSE;
+        }
+        if(isAlgorithmic ? p->isAlgorithmic && code<=p->lastCode : strcmp(p->lastName, name)>=0) {
+            log_err("u_enumCharNamesByPrefix(%s) got %s after %s\n", p->prefix, name, p->lastName);
+            return FALSE;
+        }
+    }
+    strcpy(p->lastName, name);
+    p->lastCode=code;
+    p->isAlgorithmic=isAlgorithmic;
+    return ++p->count<p->maxCount;
+}
+
+static void
+TestCharNamesByPrefix() {
+    static const struct {
+        const char *prefix;
+        int32_t count;
+    } cases[]={
+        { "latin small letter a with", 20 },
+        { "GREEK SMALL LETTER ALPHA WITH PSILI AND", 6 },
+        { "CJK UNIFIED IDEOGRAPH-4E0", 16 },
+        { "CJK UNIFIED IDEOGRAPH-9FE", 16 },
+        { "HANGUL SYLLABLE GAG", 3 },
+        { "NO SUCH CHARACTER", 0 }
+    };
+    PrefixNamesContext context;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t i;
+
+    if(uprv_getMaxCharNameLength()==0) {
+        /* no names data available */
+        return;
+    }
+    for(i=0; i<UPRV_LENGTHOF(cases); ++i) {
+        char upper[64];
+        int32_t j;
+        for(j=0; (upper[j]=uprv_toupper(cases[i].prefix[j]))!=0; ++j) {}
+        context.prefix=upper;
+        context.count=0;
+        context.maxCount=1000;
+        errorCode=U_ZERO_ERROR;
+        u_enumCharNamesByPrefix(cases[i].prefix, enumPrefixNamesFn, &context,
+                                U_UNICODE_CHAR_NAME, &errorCode);
+        if(U_FAILURE(errorCode) || context.count<cases[i].count) {
+            log_err("u_enumCharNamesByPrefix(%s) found %d names, expected at least %d - %s\n",
+                    cases[i].prefix, (int)context.count, (int)cases[i].count, u_errorName(errorCode));
+        }
+    }
+
+    /* all names, stopped by the callback, and the ones after the Latin names */
+    context.prefix="";
+    context.count=0;
+    context.maxCount=5000;
+    u_enumCharNamesByPrefix("", enumPrefixNamesFn, &context, U_UNICODE_CHAR_NAME, &errorCode);
+    if(U_FAILURE(errorCode) || context.count!=5000) {
+        log_err("u_enumCharNamesByPrefix(\"\") did not stop after 5000 names - %s\n",
+                u_errorName(errorCode));
+    }
+    context.prefix="M";
+    context.count=0;
+    context.maxCount=0x7fffffff;
+    u_enumCharNamesByPrefix("M", enumPrefixNamesFn, &context, U_UNICODE_CHAR_NAME, &errorCode);
+    context.prefix="";
+    context.count=0;
+    u_enumCharNamesByPrefix("", enumPrefixNamesFn, &context, U_CHAR_NAME_ALIAS, &errorCode);
+    if(U_FAILURE(errorCode) || context.count==0) {
+        log_err("u_enumCharNamesByPrefix(\"\", U_CHAR_NAME_ALIAS) found no names - %s\n",
+                u_errorName(errorCode));
+    }
+
+    errorCode=U_ZERO_ERROR;
+    u_enumCharNamesByPrefix(NULL, enumPrefixNamesFn, &context, U_UNICODE_CHAR_NAME, &errorCode);
+    if(errorCode!=U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_enumCharNamesByPrefix(NULL) did not fail - %s\n", u_errorName(errorCode));
+    }
+}
+
 /* test u_isMirrored() and u_charMirror() ----------------------------------- */
 
 static void
@@ -3601,3 +3770,68 @@ static void TestIntCharacterPropertiesAPI() {
         log_err("u_getIntPropertyMap(UCHAR_GENERAL_CATEGORY) wrong contents\n");
     }
 }
+
+static void TestIntPropertyValuesAPI() {
+    // API test only. See intltest/ucdtest.cpp for functional test.
+    static const UChar32 codePoints[] = { 0x20, 0x61, 0x23456, -1, 0x110000 };
+    static const UChar s[] = { 0x20, 0x61, 0xd84d, 0xdc56, 0xdc00, 0 };  // last: unpaired
+    static const char s8[] = "\x20" "a\xf0\xa3\x91\x96\xe0\x80";  // last: ill-formed
+    int32_t values[5];
+    int32_t length;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    u_getIntPropertyValues(UCHAR_GENERAL_CATEGORY, codePoints, 5, values, &errorCode);
+    if (U_FAILURE(errorCode) ||
+            values[0] != U_SPACE_SEPARATOR || values[1] != U_LOWERCASE_LETTER ||
+            values[2] != U_OTHER_LETTER ||
+            values[3] != U_UNASSIGNED || values[4] != U_UNASSIGNED) {
+        log_err("u_getIntPropertyValues(UCHAR_GENERAL_CATEGORY) wrong values - %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    u_getIntPropertyValues(UCHAR_INT_LIMIT, codePoints, 5, values, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_getIntPropertyValues(UCHAR_INT_LIMIT) did not fail\n");
+    }
+    errorCode = U_ZERO_ERROR;
+    u_getIntPropertyValues(UCHAR_GENERAL_CATEGORY, NULL, 5, values, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_getIntPropertyValues(codePoints=NULL) did not fail\n");
+    }
+
+    errorCode = U_ZERO_ERROR;
+    length = u_strGetIntPropertyValues(UCHAR_GENERAL_CATEGORY, s, -1, values, 5, &errorCode);
+    if (U_FAILURE(errorCode) || length != 4 ||
+            values[0] != U_SPACE_SEPARATOR || values[1] != U_LOWERCASE_LETTER ||
+            values[2] != U_OTHER_LETTER || values[3] != U_SURROGATE) {
+        log_err("u_strGetIntPropertyValues(UCHAR_GENERAL_CATEGORY) wrong values - %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    values[2] = -1;
+    length = u_strGetIntPropertyValues(UCHAR_GENERAL_CATEGORY, s, 5, values, 2, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || length != 4 || values[2] != -1) {
+        log_err("u_strGetIntPropertyValues(capacity=2) wrong preflighting - %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    length = u_strGetIntPropertyValues(UCHAR_GENERAL_CATEGORY, s, -2, values, 5, &errorCode);
+    if (errorCode != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("u_strGetIntPropertyValues(length=-2) did not fail\n");
+    }
+
+    errorCode = U_ZERO_ERROR;
+    length = u_strGetIntPropertyValuesUTF8(UCHAR_GENERAL_CATEGORY, s8, -1, values, 5, &errorCode);
+    if (U_FAILURE(errorCode) || length != 5 ||
+            values[0] != U_SPACE_SEPARATOR || values[1] != U_LOWERCASE_LETTER ||
+            values[2] != U_OTHER_LETTER ||
+            values[3] != U_OTHER_SYMBOL || values[4] != U_OTHER_SYMBOL) {
+        log_err("u_strGetIntPropertyValuesUTF8(UCHAR_GENERAL_CATEGORY) wrong values - %s\n",
+                u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    length = u_strGetIntPropertyValuesUTF8(UCHAR_GENERAL_CATEGORY, s8, -1, NULL, 0, &errorCode);
+    if (errorCode != U_BUFFER_OVERFLOW_ERROR || length != 5) {
+        log_err("u_strGetIntPropertyValuesUTF8(preflighting) wrong length - %s\n",
+                u_errorName(errorCode));
+    }
+}
@@ -38,6 +38,8 @@ static void Test_strFromUTF32_surrogates(void);
 static void Test_UChar_UTF8_API(void);
 static void Test_FromUTF8(void);
 static void Test_FromUTF8Lenient(void);
+static void Test_UTF8ASCIIRuns(void);
+static void Test_UTF8Blocks(void);
 static void Test_UChar_WCHART_API(void);
 static void Test_widestrs(void);
 static void Test_WCHART_LongString(void);
@@ -55,6 +57,8 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_UChar_UTF8_API, "custrtrn/Test_UChar_UTF8_API");
    addTest(root, &Test_FromUTF8, "custrtrn/Test_FromUTF8");
    addTest(root, &Test_FromUTF8Lenient, "custrtrn/Test_FromUTF8Lenient");
+   addTest(root, &Test_UTF8ASCIIRuns, "custrtrn/Test_UTF8ASCIIRuns");
+   addTest(root, &Test_UTF8Blocks, "custrtrn/Test_UTF8Blocks");
    addTest(root, &Test_UChar_WCHART_API,  "custrtrn/Test_UChar_WCHART_API");
    addTest(root, &Test_widestrs,  "custrtrn/Test_widestrs");
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
@@ -878,6 +882,157 @@ equalAnyFFFD(const UChar *s, const UChar *t, int32_t length) {
     return TRUE;
 }
 
+/*
+ * u_strFromUTF8WithSub() and u_strToUTF8WithSub() may convert
+ * blocks of 1..3-byte sequences at a time.
+ * Put an ill-formed sequence at each position of a longer mixed-script string,
+ * and check the results against conversions one character at a time.
+ */
+static void
+Test_UTF8Blocks(void) {
+    static const UChar32 cps[]={ 0x61, 0xe9, 0x416, 0x4e2d, 0x928, 0x20, 0x7ff, 0x800, 0xffff, 0x1f600 };
+    static const char *const illFormed[]={
+        "\x80", "\xc0\x80", "\xc2", "\xe0\x80", "\xe4\xb8", "\xed\xa0\x80",
+        "\xef\xbf", "\xf0\x9f\x98", "\xf4\x90\x80\x80", "\xff"
+    };
+    enum { COUNT=60, CAPACITY=COUNT*4+8 };
+    UChar text[COUNT*2], expected16[CAPACITY], dest16[CAPACITY];
+    char bytes[CAPACITY], expected8[CAPACITY], dest8[CAPACITY];
+    int32_t textLength, bytesLength, expectedLength, destLength, numSubstitutions, expectedSubs;
+    int32_t i, j, k, pos, length;
+    UChar32 c;
+    UErrorCode errorCode;
+
+    for(k=0; k<UPRV_LENGTHOF(illFormed); ++k) {
+        for(pos=0; pos<=COUNT; ++pos) {
+            /* well-formed mixed text with an ill-formed sequence before the character at pos */
+            UBool isError=FALSE;
+            textLength=bytesLength=0;
+            for(i=0; i<=COUNT; ++i) {
+                if(i==pos) {
+                    length=(int32_t)uprv_strlen(illFormed[k]);
+                    uprv_memcpy(bytes+bytesLength, illFormed[k], length);
+                    bytesLength+=length;
+                }
+                if(i<COUNT) {
+                    c=cps[(i*7+pos)%UPRV_LENGTHOF(cps)];
+                    U16_APPEND(text, textLength, UPRV_LENGTHOF(text), c, isError);
+                    U8_APPEND(bytes, bytesLength, CAPACITY, c, isError);
+                }
+            }
+
+            /* reference UTF-8 to UTF-16 one code point at a time */
+            expectedLength=expectedSubs=0;
+            for(i=0; i<bytesLength;) {
+                U8_NEXT(bytes, i, bytesLength, c);
+                if(c<0) {
+                    c=0xfffd;
+                    ++expectedSubs;
+                }
+                U16_APPEND(expected16, expectedLength, CAPACITY, c, isError);
+            }
+            if(isError) {
+                log_err("Test_UTF8Blocks: test strings overflow their buffers\n");
+                return;
+            }
+
+            errorCode=U_ZERO_ERROR;
+            u_strFromUTF8WithSub(dest16, CAPACITY, &destLength, bytes, bytesLength,
+                                 0xfffd, &numSubstitutions, &errorCode);
+            if(U_FAILURE(errorCode) || destLength!=expectedLength ||
+                    numSubstitutions!=expectedSubs ||
+                    0!=u_memcmp(dest16, expected16, expectedLength)) {
+                log_err("u_strFromUTF8WithSub(ill-formed[%d] at %d) fails - %s\n",
+                        (int)k, (int)pos, u_errorName(errorCode));
+            }
+            errorCode=U_ZERO_ERROR;
+            u_strFromUTF8WithSub(NULL, 0, &destLength, bytes, bytesLength,
+                                 0xfffd, &numSubstitutions, &errorCode);
+            if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=expectedLength ||
+                    numSubstitutions!=expectedSubs) {
+                log_err("u_strFromUTF8WithSub(preflighting, ill-formed[%d] at %d) fails - %s\n",
+                        (int)k, (int)pos, u_errorName(errorCode));
+            }
+            errorCode=U_ZERO_ERROR;
+            u_strFromUTF8WithSub(dest16, CAPACITY, &destLength, bytes, bytesLength,
+                                 U_SENTINEL, NULL, &errorCode);
+            if(errorCode!=U_INVALID_CHAR_FOUND) {
+                log_err("u_strFromUTF8WithSub(no substitution, ill-formed[%d] at %d) fails - %s\n",
+                        (int)k, (int)pos, u_errorName(errorCode));
+            }
+
+            /* the well-formed text alone */
+            errorCode=U_ZERO_ERROR;
+            u_strToUTF8(bytes, CAPACITY, &bytesLength, text, textLength, &errorCode);
+            for(j=0; j<2; ++j) {
+                errorCode=U_ZERO_ERROR;
+                if(j==0) {
+                    u_strFromUTF8(dest16, CAPACITY, &destLength, bytes, bytesLength, &errorCode);
+                } else {
+                    u_strFromUTF8Lenient(dest16, CAPACITY, &destLength, bytes, bytesLength, &errorCode);
+                }
+                if(U_FAILURE(errorCode) || destLength!=textLength ||
+                        0!=u_memcmp(dest16, text, textLength)) {
+                    log_err("u_strFromUTF8%s(well-formed, at %d) fails - %s\n",
+                            j==0 ? "" : "Lenient", (int)pos, u_errorName(errorCode));
+                }
+            }
+        }
+    }
+
+    /* UTF-16 to UTF-8 with an unpaired surrogate at each position */
+    for(k=0; k<2; ++k) {
+        for(pos=0; pos<=COUNT; ++pos) {
+            UBool isError=FALSE;
+            textLength=0;
+            for(i=0; i<=COUNT; ++i) {
+                if(i==pos) {
+                    text[textLength++]=(UChar)(k==0 ? 0xd800 : 0xdfff);
+                }
+                if(i<COUNT) {
+                    c=cps[(i*3+pos)%UPRV_LENGTHOF(cps)];
+                    U16_APPEND(text, textLength, UPRV_LENGTHOF(text), c, isError);
+                }
+            }
+
+            expectedLength=0;
+            for(i=0; i<textLength;) {
+                U16_NEXT(text, i, textLength, c);
+                if(U_IS_SURROGATE(c)) {
+                    c=0xfffd;
+                }
+                U8_APPEND(expected8, expectedLength, CAPACITY, c, isError);
+            }
+            if(isError) {
+                log_err("Test_UTF8Blocks: test strings overflow their buffers\n");
+                return;
+            }
+
+            errorCode=U_ZERO_ERROR;
+            u_strToUTF8WithSub(dest8, CAPACITY, &destLength, text, textLength,
+                               0xfffd, &numSubstitutions, &errorCode);
+            if(U_FAILURE(errorCode) || destLength!=expectedLength || numSubstitutions!=1 ||
+                    0!=uprv_memcmp(dest8, expected8, expectedLength)) {
+                log_err("u_strToUTF8WithSub(surrogate %d at %d) fails - %s\n",
+                        (int)k, (int)pos, u_errorName(errorCode));
+            }
+            errorCode=U_ZERO_ERROR;
+            u_strToUTF8WithSub(NULL, 0, &destLength, text, textLength,
+                               0xfffd, &numSubstitutions, &errorCode);
+            if(errorCode!=U_BUFFER_OVERFLOW_ERROR || destLength!=expectedLength || numSubstitutions!=1) {
+                log_err("u_strToUTF8WithSub(preflighting, surrogate %d at %d) fails - %s\n",
+                        (int)k, (int)pos, u_errorName(errorCode));
+            }
+            errorCode=U_ZERO_ERROR;
+            u_strToUTF8(dest8, CAPACITY, &destLength, text, textLength, &errorCode);
+            if(errorCode!=U_INVALID_CHAR_FOUND) {
+                log_err("u_strToUTF8(surrogate %d at %d) fails - %s\n",
+                        (int)k, (int)pos, u_errorName(errorCode));
+            }
+        }
+    }
+}
+
 /* test u_strFromUTF8Lenient() */
 static void
 Test_FromUTF8(void) {
@@ -928,6 +1083,50 @@ Test_FromUTF8(void) {
     }
 }
 
+/*
+ * u_strFromUTF8() and u_strToUTF8() copy runs of ASCII text in blocks;
+ * u_strFromUTF8() switches to larger AVX2 blocks after the first 64 bytes.
+ * Put a non-ASCII character at each position of a longer ASCII string,
+ * and check that the run stops exactly there.
+ */
+static void
+Test_UTF8ASCIIRuns(void) {
+    enum { LENGTH=168 };
+    UChar text[LENGTH], dest16[LENGTH+8];
+    char bytes[LENGTH+8], dest8[LENGTH+8];
+    int32_t i, pos, capacity, destLength;
+    UErrorCode errorCode;
+
+    for(pos=0; pos<LENGTH; ++pos) {
+        for(i=0; i<LENGTH; ++i) {
+            text[i]=(UChar)(0x20+(i*5)%0x5f);
+            bytes[i<pos ? i : i+1]=(char)text[i];
+        }
+        text[pos]=0xe9;
+        bytes[pos]=(char)0xc3;
+        bytes[pos+1]=(char)0xa9;
+
+        /* exact and larger destination capacities */
+        for(capacity=LENGTH; capacity<=LENGTH+1; ++capacity) {
+            errorCode=U_ZERO_ERROR;
+            u_memset(dest16, 0xffff, UPRV_LENGTHOF(dest16));
+            u_strFromUTF8(dest16, capacity, &destLength, bytes, LENGTH+1, &errorCode);
+            if(U_FAILURE(errorCode) || destLength!=LENGTH || 0!=u_memcmp(dest16, text, LENGTH)) {
+                log_err("u_strFromUTF8(U+00E9 at %d, capacity %d) fails - %s\n",
+                        (int)pos, (int)capacity, u_errorName(errorCode));
+            }
+
+            errorCode=U_ZERO_ERROR;
+            uprv_memset(dest8, 0xff, sizeof(dest8));
+            u_strToUTF8(dest8, capacity+1, &destLength, text, LENGTH, &errorCode);
+            if(U_FAILURE(errorCode) || destLength!=LENGTH+1 || 0!=uprv_memcmp(dest8, bytes, LENGTH+1)) {
+                log_err("u_strToUTF8(U+00E9 at %d, capacity %d) fails - %s\n",
+                        (int)pos, (int)(capacity+1), u_errorName(errorCode));
+            }
+        }
+    }
+}
+
 /* test u_strFromUTF8Lenient() */
 static void
 Test_FromUTF8Lenient(void) {
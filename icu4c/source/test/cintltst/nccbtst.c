@@ -85,6 +85,7 @@ static void setNuConvTestName(const char *codepage, const char *direction)
 
 
 static void TestCallBackFailure(void);
+static void TestSubAndSkipInConversionLoop(void);
 
 void addTestConvertErrorCallBack(TestNode** root);
 
@@ -101,6 +102,9 @@ void addTestConvertErrorCallBack(TestNode** root)
 #endif
 
     addTest(root, &TestCallBackFailure,  "tsconv/nccbtst/TestCallBackFailure");
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    addTest(root, &TestSubAndSkipInConversionLoop,  "tsconv/nccbtst/TestSubAndSkipInConversionLoop");
+#endif
 }
 
 static void TestSkipCallBack()
@@ -3385,3 +3389,124 @@ static void TestCallBackFailure(void) {
         log_err("Error: ucnv_cbToUWriteUChars did not react correctly to a bad UErrorCode\n");
     }
 }
+
+#if !UCONFIG_NO_LEGACY_CONVERSION
+
+/*
+ * Wrappers for the standard callbacks.
+ * The MBCS converter applies the substitute and skip callbacks inside its
+ * conversion loops; with these wrappers the framework calls them instead.
+ */
+static void U_CALLCONV
+wrappedSubstituteCallback(const void *context, UConverterFromUnicodeArgs *fromUArgs,
+                          const UChar *codeUnits, int32_t length, UChar32 codePoint,
+                          UConverterCallbackReason reason, UErrorCode *err) {
+    UCNV_FROM_U_CALLBACK_SUBSTITUTE(context, fromUArgs, codeUnits, length, codePoint, reason, err);
+}
+
+static void U_CALLCONV
+wrappedSkipCallback(const void *context, UConverterFromUnicodeArgs *fromUArgs,
+                    const UChar *codeUnits, int32_t length, UChar32 codePoint,
+                    UConverterCallbackReason reason, UErrorCode *err) {
+    UCNV_FROM_U_CALLBACK_SKIP(context, fromUArgs, codeUnits, length, codePoint, reason, err);
+}
+
+/* converts in pieces of 3 UChars into an output buffer of outputSize bytes */
+static int32_t
+convertInPieces(UConverter *cnv, const UChar *src, int32_t srcLength, int32_t outputSize,
+                char *dest, int32_t *offsets, UErrorCode *pErrorCode) {
+    const UChar *srcLimit=src+srcLength, *pieceLimit;
+    char *d=dest;
+    int32_t *o=offsets;
+    int32_t base=0;
+    ucnv_resetFromUnicode(cnv);
+    do {
+        pieceLimit=(srcLimit-src)>3 ? src+3 : srcLimit;
+        do {
+            const UChar *pieceStart=src;
+            char *t=d;
+            char *tLimit=d+outputSize;
+            int32_t *oStart=o;
+            *pErrorCode=U_ZERO_ERROR;
+            ucnv_fromUnicode(cnv, &t, tLimit, &src, pieceLimit, o, (UBool)(pieceLimit==srcLimit), pErrorCode);
+            for(; oStart<o+(t-d); ++oStart) {
+                if(*oStart>=0) {
+                    *oStart+=base;
+                }
+            }
+            o+=t-d;
+            d=t;
+            base+=(int32_t)(src-pieceStart);
+        } while(*pErrorCode==U_BUFFER_OVERFLOW_ERROR);
+    } while(U_SUCCESS(*pErrorCode) && src<srcLimit);
+    return (int32_t)(d-dest);
+}
+
+static void TestSubAndSkipInConversionLoop(void) {
+    static const char *const names[]={
+        "ibm-1047", "windows-1252", "ibm-943", "ibm-930", "gb18030", "ISO_2022,locale=ko,version=1"
+    };
+    /* unmappable characters, default ignorables (skipped by both callbacks), and an unpaired surrogate */
+    static const UChar input[]={
+        0x61, 0x4e00, 0x3042, 0xad, 0xe9, 0x20ac, 0xd83d, 0xde00, 0xe01, 0x62, 0xfeff,
+        0x200b, 0x3b1, 0xdc00, 0x63, 0x2603, 0x3042, 0x64, 0xac00, 0xe01
+    };
+    static const struct {
+        UConverterFromUCallback fast, framework;
+        const void *context;
+    } callbacks[]={
+        { UCNV_FROM_U_CALLBACK_SUBSTITUTE, wrappedSubstituteCallback, NULL },
+        { UCNV_FROM_U_CALLBACK_SUBSTITUTE, wrappedSubstituteCallback, UCNV_SUB_STOP_ON_ILLEGAL },
+        { UCNV_FROM_U_CALLBACK_SKIP, wrappedSkipCallback, NULL }
+    };
+    char bytes[2][200];
+    int32_t offsets[2][200];
+    UChar invalid[2][4];
+    int8_t invalidLength[2];
+    int32_t length[2];
+    UErrorCode errorCode[2];
+    int32_t i, j, k, outputSize;
+
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        UErrorCode openError=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(names[i], &openError);
+        if(U_FAILURE(openError)) {
+            log_data_err("unable to open %s - %s\n", names[i], u_errorName(openError));
+            continue;
+        }
+        for(j=0; j<UPRV_LENGTHOF(callbacks); ++j) {
+            for(outputSize=1; outputSize<=8; outputSize+=outputSize) {
+                for(k=0; k<2; ++k) {
+                    UConverterFromUCallback oldAction;
+                    const void *oldContext;
+                    UErrorCode ec=U_ZERO_ERROR;
+                    ucnv_setFromUCallBack(cnv, k==0 ? callbacks[j].fast : callbacks[j].framework,
+                                          callbacks[j].context, &oldAction, &oldContext, &ec);
+                    length[k]=convertInPieces(cnv, input, UPRV_LENGTHOF(input), outputSize,
+                                              bytes[k], offsets[k], &errorCode[k]);
+                    invalidLength[k]=UPRV_LENGTHOF(invalid[k]);
+                    ucnv_getInvalidUChars(cnv, invalid[k], &invalidLength[k], &ec);
+                    if(U_FAILURE(ec)) {
+                        log_err("%s: setting the callback or getting the invalid UChars failed - %s\n",
+                                names[i], u_errorName(ec));
+                    }
+                }
+                if( errorCode[0]!=errorCode[1] || length[0]!=length[1] ||
+                    0!=uprv_memcmp(bytes[0], bytes[1], length[0]) ||
+                    0!=uprv_memcmp(offsets[0], offsets[1], length[0]*4) ||
+                    invalidLength[0]!=invalidLength[1] ||
+                    0!=uprv_memcmp(invalid[0], invalid[1], invalidLength[0]*U_SIZEOF_UCHAR)
+                ) {
+                    log_err("%s callbacks[%d] output size %d: conversion differs from the framework callback "
+                            "(%s/%s, length %d/%d)\n",
+                            names[i], (int)j, (int)outputSize,
+                            u_errorName(errorCode[0]), u_errorName(errorCode[1]),
+                            (int)length[0], (int)length[1]);
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
+#endif
@@ -51,6 +51,7 @@ static void TestUTF32(void);
 static void TestUTF32BE(void);
 static void TestUTF32LE(void);
 static void TestLATIN1(void);
+static void TestASCIIRuns(void);
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
 static void TestSBCS(void);
@@ -78,6 +79,7 @@ static void TestISO_2022_CN_EXT(void);
 #endif
 static void TestJIS(void);
 static void TestHZ(void);
+static void TestISO2022Runs(void);
 #endif
 
 static void TestSCSU(void);
@@ -274,6 +276,7 @@ void addTestNewConvert(TestNode** root)
 #endif
 
    addTest(root, &TestLATIN1, "tsconv/nucnvtst/TestLATIN1");
+   addTest(root, &TestASCIIRuns, "tsconv/nucnvtst/TestASCIIRuns");
 
 #if !UCONFIG_NO_LEGACY_CONVERSION
    addTest(root, &TestSBCS, "tsconv/nucnvtst/TestSBCS");
@@ -300,6 +303,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestJitterbug915, "tsconv/nucnvtst/TestJitterbug915");
     */
    addTest(root, &TestHZ, "tsconv/nucnvtst/TestHZ");
+   addTest(root, &TestISO2022Runs, "tsconv/nucnvtst/TestISO2022Runs");
 #endif
 
    addTest(root, &TestSCSU, "tsconv/nucnvtst/TestSCSU");
@@ -2528,6 +2532,121 @@ TestLATIN1() {
     ucnv_close(cnv);
 }
 
+/*
+ * The UTF-8, Latin-1, US-ASCII and SBCS converters copy runs of ASCII text in blocks.
+ * Put a non-ASCII character at each position of an ASCII string that is longer than
+ * a few blocks, and check that the conversion stops the run at exactly that position,
+ * with and without offsets.
+ */
+static void
+TestASCIIRuns() {
+    static const char *const names[]={
+        "UTF-8", "ISO-8859-1", "US-ASCII"
+#if !UCONFIG_NO_LEGACY_CONVERSION
+        , "windows-1252"
+#endif
+    };
+    enum { LENGTH=168 };  /* past the first 64 bytes and three 32-byte AVX2 blocks */
+    static const UChar nonASCII=0xe9;
+
+    UChar text[LENGTH], expectedText[LENGTH+4], resultText[LENGTH+4];
+    char bytes[LENGTH+4], resultBytes[LENGTH+4];
+    int32_t expectedOffsets[LENGTH+4], offsets[LENGTH+4];
+    char encoded[8];
+    UChar decoded[4];
+    int32_t n, i, pos, encodedLength, decodedLength, bytesLength, textLength;
+    UErrorCode errorCode;
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        UConverter *cnv;
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(names[n], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open a %s converter: %s\n", names[n], u_errorName(errorCode));
+            continue;
+        }
+        /* the non-ASCII character may be converted to a substitution character */
+        encodedLength=ucnv_fromUChars(cnv, encoded, UPRV_LENGTHOF(encoded), &nonASCII, 1, &errorCode);
+        decodedLength=ucnv_toUChars(cnv, decoded, UPRV_LENGTHOF(decoded), encoded, encodedLength, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("%s: unable to convert U+00E9 - %s\n", names[n], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        for(pos=0; pos<LENGTH; ++pos) {
+            const UChar *source;
+            const char *byteSource;
+            char *target;
+            UChar *uTarget;
+            int32_t withOffsets;
+
+            /* build the text and the expected conversion results */
+            for(i=0; i<LENGTH; ++i) {
+                text[i]=(UChar)(0x20+(i*7)%0x5f);
+            }
+            text[pos]=nonASCII;
+            bytesLength=0;
+            for(i=0; i<LENGTH; ++i) {
+                if(i==pos) {
+                    uprv_memcpy(bytes+bytesLength, encoded, encodedLength);
+                    bytesLength+=encodedLength;
+                } else {
+                    bytes[bytesLength++]=(char)text[i];
+                }
+            }
+
+            for(withOffsets=0; withOffsets<=1; ++withOffsets) {
+                /* fromUnicode */
+                for(i=0; i<bytesLength; ++i) {
+                    expectedOffsets[i]= i<pos ? i : i<pos+encodedLength ? pos : i-encodedLength+1;
+                }
+                ucnv_resetFromUnicode(cnv);
+                source=text;
+                target=resultBytes;
+                errorCode=U_ZERO_ERROR;
+                ucnv_fromUnicode(cnv, &target, resultBytes+UPRV_LENGTHOF(resultBytes), &source, text+LENGTH,
+                                 withOffsets ? offsets : NULL, TRUE, &errorCode);
+                if(U_FAILURE(errorCode) || (target-resultBytes)!=bytesLength ||
+                        0!=uprv_memcmp(resultBytes, bytes, bytesLength) ||
+                        (withOffsets && 0!=uprv_memcmp(offsets, expectedOffsets, bytesLength*4))) {
+                    log_err("%s fromUnicode with U+00E9 at %d (offsets=%d) gives wrong results - %s\n",
+                            names[n], (int)pos, (int)withOffsets, u_errorName(errorCode));
+                }
+
+                /* toUnicode */
+                textLength=0;
+                for(i=0; i<bytesLength; ++i) {
+                    if(i==pos) {
+                        int32_t j;
+                        for(j=0; j<decodedLength; ++j) {
+                            expectedOffsets[textLength]=pos;
+                            expectedText[textLength++]=decoded[j];
+                        }
+                        i+=encodedLength-1;
+                    } else {
+                        expectedOffsets[textLength]=i;
+                        expectedText[textLength++]=(UChar)(uint8_t)bytes[i];
+                    }
+                }
+                ucnv_resetToUnicode(cnv);
+                byteSource=bytes;
+                uTarget=resultText;
+                errorCode=U_ZERO_ERROR;
+                ucnv_toUnicode(cnv, &uTarget, resultText+UPRV_LENGTHOF(resultText), &byteSource, bytes+bytesLength,
+                               withOffsets ? offsets : NULL, TRUE, &errorCode);
+                if(U_FAILURE(errorCode) || (uTarget-resultText)!=textLength ||
+                        0!=uprv_memcmp(resultText, expectedText, textLength*U_SIZEOF_UCHAR) ||
+                        (withOffsets && 0!=uprv_memcmp(offsets, expectedOffsets, textLength*4))) {
+                    log_err("%s toUnicode with U+00E9 at %d (offsets=%d) gives wrong results - %s\n",
+                            names[n], (int)pos, (int)withOffsets, u_errorName(errorCode));
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
 static void
 TestSBCS() {
     /* test input */
@@ -3150,6 +3269,173 @@ TestHZ() {
     free(cBuf);
 }
 
+/* small pseudo-random number generator, for reproducible test input */
+static uint32_t
+nextRandom(uint32_t *pSeed) {
+    *pSeed=*pSeed*1103515245+12345;
+    return (*pSeed>>16)&0x7fff;
+}
+
+/*
+ * Converts bytes[0..length[ with ucnv_toUnicode() calls for up to maxSource bytes
+ * and up to maxTarget UChars at a time, or for random sizes up to those if pSeed!=NULL.
+ * 0 means no limit.
+ * Adjusts the offsets to be relative to the start of bytes[].
+ * A character that ends in one call and starts in the previous one
+ * has a relative offset of -1; that is also the offset of a substitution character
+ * for bytes from earlier calls, which remains unknown (-1).
+ * No character can start after the bytes that were consumed in its call.
+ */
+static int32_t
+toUnicodeInPieces(UConverter *cnv, const char *bytes, int32_t length,
+                  UChar *text, int32_t capacity, int32_t *offsets,
+                  int32_t maxSource, int32_t maxTarget, uint32_t *pSeed,
+                  UErrorCode *pErrorCode) {
+    const char *source=bytes, *sourceLimit=bytes+length;
+    UChar *target=text, *targetLimit=text+capacity;
+    UBool isBadOffsetReported=FALSE;
+    ucnv_resetToUnicode(cnv);
+    for(;;) {
+        const char *pieceSource=source, *pieceSourceLimit=sourceLimit;
+        UChar *pieceTarget=target, *pieceTargetLimit=targetLimit;
+        int32_t n;
+        if(maxSource>0) {
+            n= pSeed!=NULL ? 1+(int32_t)(nextRandom(pSeed)%maxSource) : maxSource;
+            if(n<(sourceLimit-source)) {
+                pieceSourceLimit=source+n;
+            }
+        }
+        if(maxTarget>0) {
+            n= pSeed!=NULL ? 1+(int32_t)(nextRandom(pSeed)%maxTarget) : maxTarget;
+            if(n<(targetLimit-target)) {
+                pieceTargetLimit=target+n;
+            }
+        }
+        ucnv_toUnicode(cnv, &target, pieceTargetLimit, &source, pieceSourceLimit,
+                       offsets!=NULL ? offsets+(target-text) : NULL,
+                       (UBool)(pieceSourceLimit==sourceLimit), pErrorCode);
+        if(offsets!=NULL) {
+            for(n=(int32_t)(pieceTarget-text); n<(int32_t)(target-text); ++n) {
+                if(offsets[n]>=(int32_t)(source-pieceSource) && !isBadOffsetReported) {
+                    UErrorCode nameErrorCode=U_ZERO_ERROR;
+                    log_err("%s toUnicode offset %d is not within the %d bytes converted in one call\n",
+                            ucnv_getName(cnv, &nameErrorCode), (int)offsets[n], (int)(source-pieceSource));
+                    isBadOffsetReported=TRUE;
+                }
+                if(offsets[n]>=0 || (offsets[n]==-1 && text[n]!=0xfffd && text[n]!=0x1a)) {
+                    offsets[n]+=(int32_t)(pieceSource-bytes);
+                }
+            }
+        }
+        if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR && target<targetLimit) {
+            *pErrorCode=U_ZERO_ERROR;
+        } else if(U_FAILURE(*pErrorCode) || (pieceSourceLimit==sourceLimit && source==sourceLimit)) {
+            break;
+        }
+    }
+    return (int32_t)(target-text);
+}
+
+/*
+ * The ISO-2022 and HZ toUnicode functions convert runs of characters in one shift state
+ * in a fast loop. Compare the conversion of pseudo-random input in one call and in
+ * random pieces with the conversion of one byte at a time,
+ * where each double-byte character goes through the byte-by-byte code.
+ * Offsets are compared where both conversions know them.
+ * The input has all of the escape sequences, shifts and line endings
+ * that end runs, pairs of bytes that may or may not be mapped, and random bytes.
+ */
+static void
+TestISO2022Runs() {
+    static const char *const names[]={
+        "ISO-2022-JP", "ISO_2022,locale=ja,version=1", "ISO-2022-JP-2",
+        "ISO_2022,locale=ja,version=3", "ISO_2022,locale=ja,version=4",
+        "ISO-2022-KR", "ISO_2022,locale=ko,version=1",
+        "ISO-2022-CN", "ISO-2022-CN-EXT", "HZ"
+    };
+    static const char *const pieces[]={
+        "\x1b(B", "\x1b(J", "\x1b(I", "\x1b$@", "\x1b$B", "\x1b$A", "\x1b$(C", "\x1b$(D",
+        "\x1b.A", "\x1b.F", "\x1bN", "\x1b$)C", "\x1b$)A", "\x1b$)G", "\x1b$*H", "\x1b$+I",
+        "\x1bO", "\x0e", "\x0f", "~{", "~}", "~~", "~\n", "\r\n", "\n"
+    };
+    enum { ITERATIONS=200, MAX_LENGTH=400, CAPACITY=2*MAX_LENGTH+64 };
+
+    char bytes[MAX_LENGTH+32];
+    UChar expectedText[CAPACITY], text[CAPACITY];
+    int32_t expectedOffsets[CAPACITY], offsets[CAPACITY];
+    uint32_t seed=1;
+    int32_t n, iteration, length, expectedLength, textLength, stop, inPieces, i;
+    UErrorCode expectedErrorCode, errorCode;
+
+    for(n=0; n<UPRV_LENGTHOF(names); ++n) {
+        UConverter *cnv;
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(names[n], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open a %s converter: %s\n", names[n], u_errorName(errorCode));
+            continue;
+        }
+        for(iteration=0; iteration<ITERATIONS; ++iteration) {
+            /* build the input */
+            length=0;
+            while(length<MAX_LENGTH) {
+                uint32_t r=nextRandom(&seed)%8;
+                if(r==0) {
+                    const char *piece=pieces[nextRandom(&seed)%UPRV_LENGTHOF(pieces)];
+                    while(*piece!=0) {
+                        bytes[length++]=*piece++;
+                    }
+                } else if(r==1) {
+                    bytes[length++]=(char)nextRandom(&seed);
+                } else {
+                    /* mostly an even number of bytes for double-byte characters */
+                    int32_t runLength=2+(int32_t)(nextRandom(&seed)%30);
+                    while(runLength-->0) {
+                        bytes[length++]=(char)(0x21+nextRandom(&seed)%0x5e);
+                    }
+                }
+            }
+
+            for(stop=0; stop<=1; ++stop) {
+                errorCode=U_ZERO_ERROR;
+                if(stop) {
+                    ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+                } else {
+                    ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_SUBSTITUTE, NULL, NULL, NULL, &errorCode);
+                }
+                expectedErrorCode=U_ZERO_ERROR;
+                expectedLength=toUnicodeInPieces(cnv, bytes, length, expectedText, CAPACITY, expectedOffsets,
+                                                 1, 0, NULL, &expectedErrorCode);
+                for(inPieces=0; inPieces<=1; ++inPieces) {
+                    errorCode=U_ZERO_ERROR;
+                    if(inPieces) {
+                        textLength=toUnicodeInPieces(cnv, bytes, length, text, CAPACITY, offsets,
+                                                     64, 16, &seed, &errorCode);
+                    } else {
+                        textLength=toUnicodeInPieces(cnv, bytes, length, text, CAPACITY, offsets,
+                                                     0, 0, NULL, &errorCode);
+                    }
+                    for(i=0; i<textLength && i<expectedLength; ++i) {
+                        if(offsets[i]>=0 && expectedOffsets[i]>=0 && offsets[i]!=expectedOffsets[i]) {
+                            break;
+                        }
+                    }
+                    if(errorCode!=expectedErrorCode || textLength!=expectedLength ||
+                            0!=uprv_memcmp(text, expectedText, textLength*U_SIZEOF_UCHAR) ||
+                            i<textLength) {
+                        log_err("%s toUnicode (iteration %d, stop=%d, in pieces=%d) differs from "
+                                "converting one byte at a time - %s expect %s, length %d expect %d\n",
+                                names[n], (int)iteration, (int)stop, (int)inPieces,
+                                u_errorName(errorCode), u_errorName(expectedErrorCode),
+                                (int)textLength, (int)expectedLength);
+                    }
+                }
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
 static void
 TestISCII(){
         /* test input */
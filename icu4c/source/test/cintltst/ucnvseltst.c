@@ -347,6 +347,71 @@ static void verifyResult(UEnumeration* res, const UBool *resultsManually) {
   uenum_close(res);
 }
 
+/* checks the batch selection functions, with the string once with its length and once NUL-terminated */
+static void verifyBatchResults(const UConverterSelector *sel,
+                               const char *utf8, int32_t length8,
+                               const UChar *utf16, int32_t length16,
+                               const UBool *resultsManually) {
+  UErrorCode status = U_ZERO_ERROR;
+  int32_t count = ucnvsel_countEncodings(sel, &status);
+  int32_t columns = (count + 31) / 32;
+  uint32_t *masks = (uint32_t *)uprv_malloc(2 * columns * 4);
+  UBool *resultsFromSystem = (UBool *)uprv_malloc(gCountAvailable * sizeof(UBool));
+  const char *strings8[2];
+  const UChar *strings16[2];
+  int32_t lengths[2];
+  int32_t i, j, length, utf;
+
+  strings8[0] = strings8[1] = utf8;
+  strings16[0] = strings16[1] = utf16;
+  for (utf = 8; utf <= 16; utf += 8) {
+    if (utf == 8) {
+      lengths[0] = length8;
+      lengths[1] = -1;
+      /* preflight */
+      length = ucnvsel_selectForUTF8Strings(sel, strings8, lengths, 2, NULL, 0, &status);
+      if (status != U_BUFFER_OVERFLOW_ERROR || length != 2 * columns) {
+        log_err("ucnvsel_selectForUTF8Strings(preflighting) returned %ld - %s\n",
+                (long)length, u_errorName(status));
+      }
+      status = U_ZERO_ERROR;
+      ucnvsel_selectForUTF8Strings(sel, strings8, lengths, 2, masks, 2 * columns, &status);
+    } else {
+      if (utf16 == NULL) {
+        break;
+      }
+      lengths[0] = length16;
+      lengths[1] = -1;
+      ucnvsel_selectForStrings(sel, strings16, lengths, 2, masks, 2 * columns, &status);
+    }
+    if (U_FAILURE(status)) {
+      log_err("batch selection (UTF-%d) failed - %s\n", utf, u_errorName(status));
+      break;
+    }
+    for (j = 0; j < 2; j++) {
+      const uint32_t *mask = masks + j * columns;
+      uprv_memset(resultsFromSystem, 0, gCountAvailable);
+      for (i = 0; i < count; i++) {
+        if ((mask[i / 32] & ((uint32_t)1 << (i % 32))) != 0) {
+          resultsFromSystem[findIndex(ucnvsel_getEncoding(sel, i, &status))] = TRUE;
+        }
+      }
+      for (i = 0; i < gCountAvailable; i++) {
+        if (resultsManually[i] != resultsFromSystem[i]) {
+          log_err("failure in batch converter selection (UTF-%d)\n"
+                  "converter %s had conflicting results -- manual: %d, system %d\n",
+                  utf, gAvailableNames[i], resultsManually[i], resultsFromSystem[i]);
+        }
+      }
+    }
+  }
+  if (ucnvsel_getEncoding(sel, count, &status) != NULL || status != U_INDEX_OUTOFBOUNDS_ERROR) {
+    log_err("ucnvsel_getEncoding(out of range) did not fail - %s\n", u_errorName(status));
+  }
+  uprv_free(masks);
+  uprv_free(resultsFromSystem);
+}
+
 static UConverterSelector *
 serializeAndUnserialize(UConverterSelector *sel, char **buffer, UErrorCode *status) {
   char *new_buffer;
@@ -479,6 +544,9 @@ static void TestSelector()
             sel_fb = serializeAndUnserialize(sel_fb, &buffer_fb, &status);
           }
           if (U_SUCCESS(status)) {
+            /* batch selection, UTF-8 and UTF-16 */
+            verifyBatchResults(sel_rt, s, length8, utf16, length16, manual_rt);
+            verifyBatchResults(sel_fb, s, length8, utf16, length16, manual_fb);
             /* UTF-16 with length */
             verifyResult(ucnvsel_selectForString(sel_rt, utf16, length16, &status), manual_rt);
             verifyResult(ucnvsel_selectForString(sel_fb, utf16, length16, &status), manual_fb);
@@ -31,6 +31,7 @@ static void TestChaining(void);
 static void TestBufferOverflow(void);
 static void TestIBM424(void);
 static void TestIBM420(void);
+static void TestFastMode(void);
 
 void addUCsdetTest(TestNode** root);
 
@@ -43,6 +44,7 @@ void addUCsdetTest(TestNode** root)
     addTest(root, &TestInputFilter, "ucsdetst/TestInputFilter");
     addTest(root, &TestChaining, "ucsdetst/TestErrorChaining");
     addTest(root, &TestBufferOverflow, "ucsdetst/TestBufferOverflow");
+    addTest(root, &TestFastMode, "ucsdetst/TestFastMode");
 #if !UCONFIG_NO_LEGACY_CONVERSION
     addTest(root, &TestIBM424, "ucsdetst/TestIBM424");
     addTest(root, &TestIBM420, "ucsdetst/TestIBM420");
@@ -157,6 +159,83 @@ static void TestUTF8(void)
     ucsdet_close(csd);
 }
 
+static void TestFastMode(void)
+{
+    UErrorCode status = U_ZERO_ERROR;
+    static const char ss[] = "This is a string with some non-ascii characters that will "
+               "be converted to UTF-8, then shoved through the detection process.  "
+               "\\u0391\\u0392\\u0393\\u0394\\u0395";
+    static const char ascii[] = "This is plain ASCII text, which no charset matches decisively.";
+    int32_t byteLength = 0, sLength = 0, fullCount = 0, count = 0;
+    UChar s[sizeof(ss)];
+    char *bytes;
+    UCharsetDetector *csd = ucsdet_open(&status);
+    const UCharsetMatch *match;
+    const UCharsetMatch **matches;
+
+    if (ucsdet_isFastModeEnabled(csd)) {
+        log_err("Fast mode should be disabled by default.\n");
+    }
+
+    sLength = u_unescape(ss, s, sizeof(ss));
+    bytes = extractBytes(s, sLength, "UTF-8", &byteLength);
+
+    /* detect() stops at the decisive match; detectAll() then adds the others. */
+    ucsdet_setText(csd, bytes, byteLength, &status);
+    match = ucsdet_detect(csd, &status);
+    if (U_FAILURE(status) || match == NULL) {
+        log_err("ucsdet_detect() failed: %s\n", u_errorName(status));
+        goto bail;
+    }
+    if (strcmp(ucsdet_getName(match, &status), "UTF-8") != 0 || ucsdet_getConfidence(match, &status) != 100) {
+        log_err("Expected a decisive UTF-8 match, got %s with confidence %d\n",
+                ucsdet_getName(match, &status), ucsdet_getConfidence(match, &status));
+    }
+
+    matches = ucsdet_detectAll(csd, &fullCount, &status);
+    if (U_FAILURE(status) || fullCount < 2) {
+        log_err("ucsdet_detectAll() after ucsdet_detect() returned %d matches: %s\n", fullCount, u_errorName(status));
+        goto bail;
+    }
+    if (matches[0] != match || strcmp(ucsdet_getName(match, &status), "UTF-8") != 0) {
+        log_err("ucsdet_detectAll() changed the match returned by ucsdet_detect()\n");
+    }
+
+    /* In fast mode, detectAll() stops at the decisive match as well. */
+    if (ucsdet_enableFastMode(csd, TRUE) || !ucsdet_isFastModeEnabled(csd)) {
+        log_err("ucsdet_enableFastMode() returned the wrong previous setting\n");
+    }
+    ucsdet_setText(csd, bytes, byteLength, &status);
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != 1 || strcmp(ucsdet_getName(matches[0], &status), "UTF-8") != 0) {
+        log_err("Fast mode ucsdet_detectAll() returned %d matches: %s\n", count, u_errorName(status));
+    }
+
+    if (!ucsdet_enableFastMode(csd, FALSE)) {
+        log_err("ucsdet_enableFastMode() returned the wrong previous setting\n");
+    }
+    matches = ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != fullCount || strcmp(ucsdet_getName(matches[0], &status), "UTF-8") != 0) {
+        log_err("ucsdet_detectAll() after fast mode returned %d matches, expected %d: %s\n",
+                count, fullCount, u_errorName(status));
+    }
+
+    /* Without a decisive match, fast mode returns all matches. */
+    ucsdet_setText(csd, ascii, -1, &status);
+    ucsdet_detectAll(csd, &fullCount, &status);
+    ucsdet_enableFastMode(csd, TRUE);
+    ucsdet_setText(csd, ascii, -1, &status);
+    ucsdet_detectAll(csd, &count, &status);
+    if (U_FAILURE(status) || count != fullCount) {
+        log_err("Fast mode ucsdet_detectAll() for ASCII returned %d matches, expected %d: %s\n",
+                count, fullCount, u_errorName(status));
+    }
+
+bail:
+    freeBytes(bytes);
+    ucsdet_close(csd);
+}
+
 static void TestUTF16(void)
 {
     UErrorCode status = U_ZERO_ERROR;
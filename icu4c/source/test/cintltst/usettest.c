@@ -22,6 +22,7 @@ static void TestNonInvariantPattern(void);
 static void TestBadPattern(void);
 static void TestFreezable(void);
 static void TestSpan(void);
+static void TestFrozenInstance(void);
 
 void addUSetTest(TestNode** root);
 
@@ -45,6 +46,7 @@ addUSetTest(TestNode** root) {
     TEST(TestBadPattern);
     TEST(TestFreezable);
     TEST(TestSpan);
+    TEST(TestFrozenInstance);
 }
 
 /*------------------------------------------------------------------
@@ -652,4 +654,47 @@ static void TestSpan() {
     uset_close(idSet);
 }
 
+static void TestFrozenInstance() {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    U_STRING_DECL(pattern, "[:ID_Continue:]", 15);
+    U_STRING_DECL(badPattern, "[a-", 3);
+    const USet *set1, *set2;
+    USet *idSet;
+
+    U_STRING_INIT(pattern, "[:ID_Continue:]", 15);
+    U_STRING_INIT(badPattern, "[a-", 3);
+    set1 = uset_getFrozenInstance(pattern, -1, USET_IGNORE_SPACE, &errorCode);
+    if (U_FAILURE(errorCode)) {
+        log_data_err("uset_getFrozenInstance([:ID_Continue:]) failed - %s (Are you missing data?)\n",
+                     u_errorName(errorCode));
+        return;
+    }
+    set2 = uset_getFrozenInstance(pattern, 15, USET_IGNORE_SPACE, &errorCode);
+    if (set1 != set2 || U_FAILURE(errorCode)) {
+        log_err("uset_getFrozenInstance() did not return the cached set - %s\n", u_errorName(errorCode));
+    }
+    idSet = openIDSet();
+    if (!uset_isFrozen(set1) || idSet == NULL || !uset_equals(set1, idSet)) {
+        log_err("uset_getFrozenInstance() did not return a frozen, equal set\n");
+    }
+    uset_close(idSet);
+
+    set2 = uset_getFrozenInstance(pattern, 15, USET_CASE_INSENSITIVE, &errorCode);
+    if (set2 == set1 || U_FAILURE(errorCode)) {
+        log_err("uset_getFrozenInstance() with other options returned the same set - %s\n",
+                u_errorName(errorCode));
+    }
+
+    /* The failure is cached too. */
+    set1 = uset_getFrozenInstance(badPattern, 3, 0, &errorCode);
+    if (set1 != NULL || U_SUCCESS(errorCode)) {
+        log_err("uset_getFrozenInstance([a-) did not fail as expected - %s\n", u_errorName(errorCode));
+    }
+    errorCode = U_ZERO_ERROR;
+    set1 = uset_getFrozenInstance(badPattern, 3, 0, &errorCode);
+    if (set1 != NULL || U_SUCCESS(errorCode)) {
+        log_err("uset_getFrozenInstance([a-) did not fail the second time - %s\n", u_errorName(errorCode));
+    }
+}
+
 /*eof*/
@@ -77,6 +77,8 @@ ConversionTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestGetUnicodeSet2);
     TESTCASE_AUTO(TestDefaultIgnorableCallback);
     TESTCASE_AUTO(TestUTF8ToUTF8Overflow);
+    TESTCASE_AUTO(TestUTF8ToSBCSSupplementary);
+    TESTCASE_AUTO(TestISO2022JPToUTF8);
     TESTCASE_AUTO_END;
 }
 
@@ -834,6 +836,159 @@ ConversionTest::TestUTF8ToUTF8Overflow() {
     }
 }
 
+void
+ConversionTest::TestUTF8ToSBCSSupplementary() {
+    // Direct conversion from UTF-8 into single-byte codepages without
+    // supplementary mappings must treat supplementary code points as unmappable,
+    // the same as conversion from UTF-16.
+    static const char *const names[] = { "windows-1252", "ibm-37", "ibm-1051" };
+    // Each supplementary code point comes first, last, and between ASCII and non-ASCII BMP characters.
+    static const char *const utf8 =
+        "\xf0\x9f\x9a\xb2" "a" "\xf0\x90\x80\x80" "\xc3\xa4" "\xf4\x8f\xbf\xbf" "b" "\xf0\x9d\x84\x9e";
+    for (int32_t i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        IcuTestErrorCode errorCode(*this, "TestUTF8ToSBCSSupplementary");
+        LocalUConverterPointer cnv(ucnv_open(names[i], errorCode));
+        LocalUConverterPointer utf8Cnv(ucnv_open("UTF-8", errorCode));
+        if (errorCode.errDataIfFailureAndReset("ucnv_open(%s)", names[i])) {
+            continue;
+        }
+
+        // Expected: conversion from UTF-16.
+        UnicodeString s = UnicodeString::fromUTF8(utf8);
+        char expected[40];
+        int32_t expectedLength = ucnv_fromUChars(cnv.getAlias(), expected, UPRV_LENGTHOF(expected),
+                                                 s.getBuffer(), s.length(), errorCode);
+        if (errorCode.errIfFailureAndReset("%s ucnv_fromUChars()", names[i])) {
+            continue;
+        }
+        // Four substitution characters plus a, a-umlaut, b.
+        assertEquals(UnicodeString(names[i]) + " expected length", 7, expectedLength);
+
+        // Direct conversion from UTF-8, in one piece and one byte at a time.
+        for (int32_t step = 0; step <= 1; ++step) {
+            const char *source = utf8;
+            const char *sourceLimit = utf8 + strlen(utf8);
+            char result[40];
+            char *target = result;
+            UChar buffer16[20];
+            UChar *pivotSource = buffer16;
+            UChar *pivotTarget = buffer16;
+            ucnv_reset(cnv.getAlias());
+            ucnv_reset(utf8Cnv.getAlias());
+            if (step == 0) {
+                ucnv_convertEx(cnv.getAlias(), utf8Cnv.getAlias(),
+                               &target, result + UPRV_LENGTHOF(result), &source, sourceLimit,
+                               buffer16, &pivotSource, &pivotTarget, buffer16 + UPRV_LENGTHOF(buffer16),
+                               FALSE, TRUE, errorCode);
+            } else {
+                while (source < sourceLimit && errorCode.isSuccess()) {
+                    const char *limit = source + 1;
+                    ucnv_convertEx(cnv.getAlias(), utf8Cnv.getAlias(),
+                                   &target, result + UPRV_LENGTHOF(result), &source, limit,
+                                   buffer16, &pivotSource, &pivotTarget, buffer16 + UPRV_LENGTHOF(buffer16),
+                                   FALSE, limit == sourceLimit, errorCode);
+                }
+            }
+            if (errorCode.errIfFailureAndReset("%s ucnv_convertEx(step=%d)", names[i], (int)step)) {
+                continue;
+            }
+            int32_t length = (int32_t)(target - result);
+            if (length != expectedLength || memcmp(result, expected, length) != 0) {
+                errln("%s: direct conversion from UTF-8 (step=%d) differs from conversion from UTF-16",
+                      names[i], (int)step);
+            }
+        }
+    }
+}
+
+void
+ConversionTest::TestISO2022JPToUTF8() {
+    // Direct conversion from ISO-2022-JP to UTF-8 must yield the same result
+    // as conversion via UTF-16, for any input buffer boundaries,
+    // including for escape sequences, single shifts and illegal input
+    // which revert to pivoting.
+    static const struct {
+        const char *name;
+        const char *bytes;
+    } cases[] = {
+        // ASCII, JIS X 0208, JIS X 0201 Roman, CR/LF reset to ASCII
+        { "ISO-2022-JP", "ab\x1b$B$3$s$K$A$O\x1b(Jc~d\x1b(B\r\n\x1b$B4A;z\nxy" },
+        // empty segment, unassigned and illegal double-byte characters, 8-bit byte
+        { "ISO-2022-JP", "\x1b$B\x1b(Bz\x1b$B\x7e\x7e\x21\x0a\x1b(B\xa1q" },
+        // illegal and truncated escape sequences
+        { "ISO-2022-JP", "a\x1b(Xb\x1b$B$3\x1b" },
+        // JIS X 0212, GB 2312, KS C 5601, ISO-8859-1/7 single shifts
+        { "ISO-2022-JP-2",
+          "\x1b$(D\x22\x2f\x1b$A\x30\x21\x1b$(C\x30\x21\x1b(B"
+          "\x1b.A\x1bNa-\x1b.F\x1bNa." },
+        // JIS7 half-width Katakana with SO/SI, JIS X 0201 Katakana in G0
+        { "JIS7", "\x0e\x31\x32\x0f" "a\x1b(I\x31\x32\x1b(Bb" },
+        // JIS8 8-bit half-width Katakana
+        { "JIS8", "a\xb1\xb2" "b\x1b$B$3\x1b(B" }
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        IcuTestErrorCode errorCode(*this, "TestISO2022JPToUTF8");
+        LocalUConverterPointer cnv(ucnv_open(cases[i].name, errorCode));
+        LocalUConverterPointer utf8Cnv(ucnv_open("UTF-8", errorCode));
+        if (errorCode.errDataIfFailureAndReset("ucnv_open(%s)", cases[i].name)) {
+            continue;
+        }
+        const char *bytes = cases[i].bytes;
+        int32_t bytesLength = (int32_t)strlen(bytes);
+
+        // Expected: conversion via UTF-16.
+        UChar buffer16[100];
+        int32_t length16 = ucnv_toUChars(cnv.getAlias(), buffer16, UPRV_LENGTHOF(buffer16),
+                                         bytes, bytesLength, errorCode);
+        char expected[200];
+        int32_t expectedLength;
+        u_strToUTF8(expected, UPRV_LENGTHOF(expected), &expectedLength, buffer16, length16, errorCode);
+        if (errorCode.errIfFailureAndReset("case %d %s ucnv_toUChars()", (int)i, cases[i].name)) {
+            continue;
+        }
+
+        // Direct conversion, with input and output buffers limited to step bytes.
+        for (int32_t step = 0; step <= 4; ++step) {
+            const char *source = bytes;
+            const char *sourceLimit = bytes + bytesLength;
+            char result[200];
+            char *target = result;
+            UChar pivot[20];
+            UChar *pivotSource = pivot;
+            UChar *pivotTarget = pivot;
+            ucnv_reset(cnv.getAlias());
+            ucnv_reset(utf8Cnv.getAlias());
+            do {
+                const char *limit = (step == 0 || (sourceLimit - source) <= step) ? sourceLimit : source + step;
+                char *targetLimit = step == 0 ? result + sizeof(result) : target + step;
+                ucnv_convertEx(utf8Cnv.getAlias(), cnv.getAlias(),
+                               &target, targetLimit, &source, limit,
+                               pivot, &pivotSource, &pivotTarget, pivot + UPRV_LENGTHOF(pivot),
+                               FALSE, limit == sourceLimit, errorCode);
+                if (errorCode.get() == U_BUFFER_OVERFLOW_ERROR && step != 0) {
+                    errorCode.reset();
+                    continue;
+                }
+                if (errorCode.isFailure() || limit == sourceLimit) {
+                    break;
+                }
+            } while (TRUE);
+            if (errorCode.get() == U_STRING_NOT_TERMINATED_WARNING) {
+                errorCode.reset();
+            }
+            if (errorCode.errIfFailureAndReset("case %d %s ucnv_convertEx(step=%d)",
+                                               (int)i, cases[i].name, (int)step)) {
+                continue;
+            }
+            int32_t length = (int32_t)(target - result);
+            if (length != expectedLength || memcmp(result, expected, length) != 0) {
+                errln("case %d %s: direct conversion to UTF-8 (step=%d) differs from conversion via UTF-16",
+                      (int)i, cases[i].name, (int)step);
+            }
+        }
+    }
+}
+
 // open testdata or ICU data converter ------------------------------------- ***
 
 UConverter *
@@ -1130,6 +1285,103 @@ stepToUnicode(ConversionCase &cc, UConverter *cnv,
     return (int32_t)(target-result);
 }
 
+static int32_t
+stepToUTF8(ConversionCase &cc,
+           UConverter *cnv, UConverter *utf8Cnv,
+           char *result, int32_t resultCapacity,
+           int32_t step,
+           UErrorCode *pErrorCode) {
+    const char *source, *sourceLimit, *bytesLimit;
+    UChar pivotBuffer[32];
+    UChar *pivotSource, *pivotTarget, *pivotLimit;
+    char *target, *targetLimit, *resultLimit;
+    UBool flush;
+
+    source=(const char *)cc.bytes;
+    pivotSource=pivotTarget=pivotBuffer;
+    target=result;
+    bytesLimit=source+cc.bytesLength;
+    resultLimit=result+resultCapacity;
+
+    // call ucnv_convertEx() with in/out buffers no larger than (step) at a time
+    // move only one buffer (in vs. out) at a time to be extra mean
+    // step==0 performs bulk conversion
+
+    // initialize the partial limits for the loop
+    if(step==0) {
+        // use the entire buffers
+        sourceLimit=bytesLimit;
+        targetLimit=resultLimit;
+        flush=cc.finalFlush;
+
+        pivotLimit=pivotBuffer+UPRV_LENGTHOF(pivotBuffer);
+    } else {
+        // start with empty partial buffers
+        sourceLimit=source;
+        targetLimit=target;
+        flush=FALSE;
+
+        // empty pivot is not allowed, make it of length step
+        pivotLimit=pivotBuffer+step;
+    }
+
+    for(;;) {
+        // resetting the opposite conversion direction must not affect this one
+        ucnv_resetFromUnicode(cnv);
+        ucnv_resetToUnicode(utf8Cnv);
+
+        // convert
+        ucnv_convertEx(utf8Cnv, cnv,
+            &target, targetLimit,
+            &source, sourceLimit,
+            pivotBuffer, &pivotSource, &pivotTarget, pivotLimit,
+            FALSE, flush, pErrorCode);
+
+        // check pointers and errors
+        if(source>sourceLimit || target>targetLimit) {
+            *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+            break;
+        } else if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+            if(target!=targetLimit) {
+                // buffer overflow must only be set when the target is filled
+                *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+                break;
+            } else if(targetLimit==resultLimit) {
+                // not just a partial overflow
+                break;
+            }
+
+            // the partial target is filled, set a new limit, reset the error and continue
+            targetLimit=(resultLimit-target)>=step ? target+step : resultLimit;
+            *pErrorCode=U_ZERO_ERROR;
+        } else if(U_FAILURE(*pErrorCode)) {
+            // some other error occurred, done
+            break;
+        } else {
+            if(source!=sourceLimit) {
+                // when no error occurs, then the input must be consumed
+                *pErrorCode=U_INTERNAL_PROGRAM_ERROR;
+                break;
+            }
+
+            if(sourceLimit==bytesLimit) {
+                // we are done
+                if(*pErrorCode==U_STRING_NOT_TERMINATED_WARNING) {
+                    // ucnv_convertEx() warns about not terminating the output
+                    *pErrorCode=U_ZERO_ERROR;
+                }
+                break;
+            }
+
+            // the partial conversion succeeded, set a new limit and continue
+            sourceLimit=(bytesLimit-source)>=step ? source+step : bytesLimit;
+            flush=(UBool)(cc.finalFlush && sourceLimit==bytesLimit);
+        }
+    }
+
+    return (int32_t)(target-result);
+}
+
 UBool
 ConversionTest::ToUnicodeCase(ConversionCase &cc, UConverterToUCallback callback, const char *option) {
     // open the converter
@@ -1217,6 +1469,41 @@ ConversionTest::ToUnicodeCase(ConversionCase &cc, UConverterToUCallback callback
         }
     }
 
+    // test direct conversion to UTF-8, for successful conversions
+    // toUnicode errors are reported the same way with and without direct conversion
+    char expectedUTF8[256];
+    int32_t expectedUTF8Length;
+    errorCode.reset();
+    u_strToUTF8(expectedUTF8, UPRV_LENGTHOF(expectedUTF8), &expectedUTF8Length,
+                cc.unicode, cc.unicodeLength,
+                errorCode);
+    if(errorCode.isFailure()) {
+        // skip UTF-8 testing of a string with an unpaired surrogate,
+        // or of one that's too long
+        errorCode.reset();
+    } else if(ok && U_SUCCESS(cc.outErrorCode)) {
+        static const int32_t utf8Steps[]={ 0, 1, 3, 7 };
+        for(i=0; i<UPRV_LENGTHOF(utf8Steps) && ok; ++i) {
+            char utf8Result[256];
+            step=utf8Steps[i];
+            errorCode.reset();
+            resultLength=stepToUTF8(cc, cnv.getAlias(), utf8Cnv,
+                                    utf8Result, UPRV_LENGTHOF(utf8Result),
+                                    step, errorCode);
+            if(errorCode.isFailure() ||
+                    resultLength!=expectedUTF8Length ||
+                    0!=uprv_memcmp(utf8Result, expectedUTF8, resultLength)) {
+                errln("toUnicode[%d](%s cb=\"%s\" fb=%d flush=%d) direct conversion to UTF-8 (step=%d) failed - %s",
+                        cc.caseNr, cc.charset, cc.cbopt, cc.fallbacks, cc.finalFlush, (int)step,
+                        errorCode.errorName());
+                ok=FALSE;
+            }
+            ucnv_resetToUnicode(cnv.getAlias());
+            ucnv_resetFromUnicode(utf8Cnv);
+        }
+        errorCode.reset();
+    }
+
     // not a real loop, just a convenience for breaking out of the block
     while(ok && cc.finalFlush) {
         // test ucnv_toUChars()
@@ -77,6 +77,8 @@ class ConversionTest : public IntlTest {
     void TestGetUnicodeSet2();
     void TestDefaultIgnorableCallback();
     void TestUTF8ToUTF8Overflow();
+    void TestUTF8ToSBCSSupplementary();
+    void TestISO2022JPToUTF8();
 
 private:
     UBool
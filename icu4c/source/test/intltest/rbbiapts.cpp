@@ -1356,6 +1356,40 @@ void RBBIAPITest::TestFilteredBreakIteratorBuilder() {
     }
   }
 
+  {
+    logln("Constructing English builders sharing the locale data\n");
+    // Iterators built from unmodified locale data share the suppression tries.
+    // They must behave the same as each other and as their clones.
+    UnicodeString text2("Mrs. Who? Mr. Smith went to Washington. Capt. Kirk! Done");
+    LocalPointer<BreakIterator> bi1, bi2;
+    for (int32_t i=0; i<2; ++i) {
+      builder.adoptInstead(FilteredBreakIteratorBuilder::createInstance(Locale::getEnglish(), status));
+      TEST_ASSERT_SUCCESS(status);
+      baseBI.adoptInstead(BreakIterator::createSentenceInstance(Locale::getEnglish(), status));
+      TEST_ASSERT_SUCCESS(status);
+      if (U_FAILURE(status)) {
+        break;
+      }
+      (i == 0 ? bi1 : bi2).adoptInstead(builder->build(baseBI.orphan(), status));
+      TEST_ASSERT_SUCCESS(status);
+    }
+    if (bi1.isValid() && bi2.isValid()) {
+      LocalPointer<BreakIterator> bi3(bi1->clone());
+      BreakIterator *bis[] = {bi1.getAlias(), bi2.getAlias(), bi3.getAlias()};
+      for (BreakIterator *bi : bis) {
+        bi->setText(text2);
+        TEST_ASSERT(10 == bi->next());
+        TEST_ASSERT(40 == bi->next());
+        TEST_ASSERT(52 == bi->next());
+        TEST_ASSERT(56 == bi->next());
+        TEST_ASSERT(BreakIterator::DONE == bi->next());
+        TEST_ASSERT(FALSE == bi->isBoundary(5));
+        TEST_ASSERT(TRUE == bi->isBoundary(10));
+        TEST_ASSERT(40 == bi->preceding(46));
+      }
+    }
+  }
+
   // reenable once french is in
   {
     logln("Constructing French builder");
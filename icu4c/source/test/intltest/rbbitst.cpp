@@ -114,6 +114,8 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestBug13447);
     TESTCASE_AUTO(TestReverse);
     TESTCASE_AUTO(TestBug13692);
+    TESTCASE_AUTO(TestStreaming);
+    TESTCASE_AUTO(TestCacheCapacity);
     TESTCASE_AUTO_END;
 }
 
@@ -4583,6 +4585,192 @@ void RBBITest::TestBug13692() {
     assertSuccess(WHERE, status);
 }
 
+//  TestStreaming checks that a StreamingBreakIterator, fed text in chunks of varying sizes,
+//  produces the same boundaries and rule status values as forward iteration over the
+//  complete text.
+
+void RBBITest::TestStreaming() {
+    static const char16_t *testText =
+        u"Hello, world! Mr. Smith went to Washington.\u00A0 He said: \"It\u2019s 3.14159 o'clock\". "
+        u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E2A\u0E2D\u0E1A\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22 "
+        u"e\u0301\U0001F469\u200D\U0001F467 \U0001F1FA\U0001F1F8  tab\tbreak\r\nNew line. ?! (a) [b] 1,234.56 "
+        u"\u65E5\u672C\u8A9E\u306E\u30C6\u30AD\u30B9\u30C8\u3002 End";
+    UnicodeString text(testText);
+
+    for (int32_t type=0; type<4; ++type) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<RuleBasedBreakIterator> bi;
+        switch (type) {
+            case 0: bi.adoptInstead((RuleBasedBreakIterator *)
+                        BreakIterator::createCharacterInstance(Locale::getEnglish(), status)); break;
+            case 1: bi.adoptInstead((RuleBasedBreakIterator *)
+                        BreakIterator::createWordInstance(Locale::getEnglish(), status)); break;
+            case 2: bi.adoptInstead((RuleBasedBreakIterator *)
+                        BreakIterator::createLineInstance(Locale::getEnglish(), status)); break;
+            default: bi.adoptInstead((RuleBasedBreakIterator *)
+                        BreakIterator::createSentenceInstance(Locale::getEnglish(), status)); break;
+        }
+        if (!assertSuccess(WHERE, status, true)) {
+            return;
+        }
+
+        std::vector<int32_t> expectedBreaks;
+        std::vector<int32_t> expectedStatus;
+        bi->setText(text);
+        for (int32_t b = bi->first(); (b = bi->next()) != BreakIterator::DONE;) {
+            expectedBreaks.push_back(b);
+            expectedStatus.push_back(bi->getRuleStatus());
+        }
+
+        for (int32_t chunkSize : {1, 2, 3, 7, 16, 1000}) {
+            StreamingBreakIterator sbi(*bi, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            std::vector<int32_t> breaks;
+            std::vector<int32_t> statuses;
+            for (int32_t start=0; start<text.length(); start+=chunkSize) {
+                sbi.append(text.tempSubString(start, chunkSize), status);
+                int32_t stableLimit = sbi.getStableLimit();
+                int32_t b;
+                while ((b = sbi.next()) != UBRK_DONE) {
+                    breaks.push_back(b);
+                    statuses.push_back(sbi.getRuleStatus());
+                    assertTrue(WHERE, b <= start + chunkSize);
+                }
+                assertTrue(WHERE, sbi.getStableLimit() >= stableLimit);
+            }
+            sbi.finish();
+            int32_t b;
+            while ((b = sbi.next()) != UBRK_DONE) {
+                breaks.push_back(b);
+                statuses.push_back(sbi.getRuleStatus());
+            }
+            assertSuccess(WHERE, status);
+            assertEquals(WHERE, text.length(), sbi.getStableLimit());
+            sbi.append(u"x", status);
+            assertEquals(WHERE, U_INVALID_STATE_ERROR, status);
+            status = U_ZERO_ERROR;
+
+            if (!assertTrue(WHERE, expectedBreaks == breaks) ||
+                    !assertTrue(WHERE, expectedStatus == statuses)) {
+                errln("Break iterator type %d, chunk size %d", type, chunkSize);
+            }
+        }
+    }
+}
+
+
+//  TestCacheCapacity checks that break iterators with reduced boundary cache sizes
+//  produce the same results as one with the default cache, for forwards, backwards
+//  and random access iteration.
+
+void RBBITest::TestCacheCapacity() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString text;
+    for (int32_t i=0; i<20; ++i) {
+        text.append(u"Hello, world! Mr. Smith went to Washington. 3.14159 o'clock. ");
+        text.append(u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E2A\u0E2D\u0E1A\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22 ");
+    }
+    text = text.unescape();
+
+    LocalPointer<RuleBasedBreakIterator> refBI((RuleBasedBreakIterator *)
+            BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+    if (!assertSuccess(WHERE, status, true)) {
+        return;
+    }
+    refBI->setText(text);
+    std::vector<int32_t> expected;
+    for (int32_t b = refBI->first(); b != BreakIterator::DONE; b = refBI->next()) {
+        expected.push_back(b);
+    }
+
+    for (int32_t capacity : {0, 1, 16, 33, 128, 100000}) {
+        LocalPointer<RuleBasedBreakIterator> bi((RuleBasedBreakIterator *)
+                BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        int32_t defaultCapacity = bi->getCacheCapacity();
+        int32_t defaultMemory = bi->getMemoryUsage();
+        bi->setCacheCapacity(capacity, status);
+        assertSuccess(WHERE, status);
+        int32_t actualCapacity = bi->getCacheCapacity();
+        assertTrue(WHERE, actualCapacity > 0 && (actualCapacity & (actualCapacity - 1)) == 0);
+        if (capacity > 0 && capacity <= defaultCapacity) {
+            assertTrue(WHERE, actualCapacity >= capacity);
+        }
+        if (actualCapacity < defaultCapacity) {
+            assertTrue(WHERE, bi->getMemoryUsage() < defaultMemory);
+        }
+        bi->setText(text);
+
+        std::vector<int32_t> forward;
+        for (int32_t b = bi->first(); b != BreakIterator::DONE; b = bi->next()) {
+            forward.push_back(b);
+        }
+        if (!assertTrue(WHERE, expected == forward)) {
+            errln("capacity %d", capacity);
+        }
+        std::vector<int32_t> backward;
+        for (int32_t b = bi->last(); b != BreakIterator::DONE; b = bi->previous()) {
+            backward.insert(backward.begin(), b);
+        }
+        if (!assertTrue(WHERE, expected == backward)) {
+            errln("capacity %d", capacity);
+        }
+        for (int32_t i=0; i<text.length(); i+=7) {
+            if (bi->following(i) != refBI->following(i) ||
+                    bi->preceding(i) != refBI->preceding(i) ||
+                    bi->isBoundary(i) != refBI->isBoundary(i)) {
+                errln("%s:%d capacity %d, mismatch at index %d", __FILE__, __LINE__, capacity, i);
+                break;
+            }
+        }
+
+        // Changing the capacity keeps the current position.
+        int32_t pos = bi->following(text.length() / 2);
+        bi->setCacheCapacity(defaultCapacity, status);
+        assertEquals(WHERE, pos, bi->current());
+        assertEquals(WHERE, refBI->following(pos), bi->next());
+    }
+
+    // The smallest cache uses only the buffers inside the iterator.
+    {
+        LocalPointer<RuleBasedBreakIterator> bi((RuleBasedBreakIterator *)
+                BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        bi->setCacheCapacity(16, status);
+        int32_t memory16 = bi->getMemoryUsage();
+        bi->setCacheCapacity(0, status);
+        assertSuccess(WHERE, status);
+        assertEquals(WHERE, 16 * (int32_t)(sizeof(int32_t) + sizeof(uint16_t)),
+                     memory16 - bi->getMemoryUsage());
+    }
+
+    // The dictionary cache is not allocated for text without dictionary characters.
+    LocalPointer<RuleBasedBreakIterator> bi((RuleBasedBreakIterator *)
+            BreakIterator::createWordInstance(Locale::getEnglish(), status), status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    bi->setCacheCapacity(0, status);
+    UnicodeString latinText(u"Only Latin text here.");
+    bi->setText(latinText);
+    while (bi->next() != BreakIterator::DONE) {}
+    int32_t latinMemory = bi->getMemoryUsage();
+    UnicodeString thaiText(UnicodeString(u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E2A\u0E2D\u0E1A").unescape());
+    bi->setText(thaiText);
+    while (bi->next() != BreakIterator::DONE) {}
+    assertTrue(WHERE, bi->getMemoryUsage() > latinMemory);
+
+    bi->setCacheCapacity(-1, status);
+    assertEquals(WHERE, U_ILLEGAL_ARGUMENT_ERROR, status);
+}
+
+
 //
 //  TestDebug    -  A place-holder test for debugging purposes.
 //                  For putting in fragments of other tests that can be invoked
@@ -64,6 +64,7 @@ class StringCaseTest: public IntlTest {
     void TestCaseMapUTF8WithEdits();
     void TestCaseMapToString();
     void TestCaseMapUTF8ToString();
+    void TestCaseMapUTF8LongASCII();
     void TestLongUnicodeString();
     void TestBug13127();
     void TestInPlaceTitle();
@@ -108,6 +109,7 @@ StringCaseTest::runIndexedTest(int32_t index, UBool exec, const char *&name, cha
     TESTCASE_AUTO(TestCaseMapUTF8WithEdits);
     TESTCASE_AUTO(TestCaseMapToString);
     TESTCASE_AUTO(TestCaseMapUTF8ToString);
+    TESTCASE_AUTO(TestCaseMapUTF8LongASCII);
     TESTCASE_AUTO(TestLongUnicodeString);
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestBug13127);
@@ -1496,6 +1498,75 @@ void StringCaseTest::TestCaseMapUTF8ToString() {
                  UnicodeString::fromUTF8(dest));
 }
 
+void StringCaseTest::TestCaseMapUTF8LongASCII() {
+    // The UTF-8 functions map and skip ASCII runs in blocks.
+    // They must yield the same strings and the same numbers of changes as the UTF-16 functions,
+    // including for the Turkish and Lithuanian exceptions for I and J.
+    IcuTestErrorCode errorCode(*this, "TestCaseMapUTF8LongASCII");
+    UnicodeString s16;
+    for (int32_t i = 0; i < 12; ++i) {
+        s16.append(u"The Quick Brown Fox Jumps Over The Lazy Dog in Istanbul, ")
+            .append(u"İzmir and Jonava: ÉTÉ, straße! ");
+    }
+    std::string s8;
+    s16.toUTF8String(s8);
+    static const char *const locales[] = { "", "tr", "lt" };
+    static const uint32_t optionsList[] = {
+        0, U_OMIT_UNCHANGED_TEXT, U_FOLD_CASE_EXCLUDE_SPECIAL_I
+    };
+    char16_t dest16[2000];
+    char dest8[4000];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(locales); ++i) {
+        const char *locale = locales[i];
+        for (int32_t which = 0; which < 3; ++which) {
+            for (int32_t j = 0; j < UPRV_LENGTHOF(optionsList); ++j) {
+                uint32_t options = optionsList[j];
+                Edits edits16, edits8, editsSink;
+                std::string sink8;
+                StringByteSink<std::string> sink(&sink8);
+                int32_t length16, length8;
+                if (which == 0) {
+                    length16 = CaseMap::toLower(locale, options, s16.getBuffer(), s16.length(),
+                                                dest16, UPRV_LENGTHOF(dest16), &edits16, errorCode);
+                    length8 = CaseMap::utf8ToLower(locale, options, s8.data(), (int32_t)s8.length(),
+                                                   dest8, UPRV_LENGTHOF(dest8), &edits8, errorCode);
+                    CaseMap::utf8ToLower(locale, options, s8, sink, &editsSink, errorCode);
+                } else if (which == 1) {
+                    length16 = CaseMap::toUpper(locale, options, s16.getBuffer(), s16.length(),
+                                                dest16, UPRV_LENGTHOF(dest16), &edits16, errorCode);
+                    length8 = CaseMap::utf8ToUpper(locale, options, s8.data(), (int32_t)s8.length(),
+                                                   dest8, UPRV_LENGTHOF(dest8), &edits8, errorCode);
+                    CaseMap::utf8ToUpper(locale, options, s8, sink, &editsSink, errorCode);
+                } else {
+                    length16 = CaseMap::fold(options, s16.getBuffer(), s16.length(),
+                                             dest16, UPRV_LENGTHOF(dest16), &edits16, errorCode);
+                    length8 = CaseMap::utf8Fold(options, s8.data(), (int32_t)s8.length(),
+                                                dest8, UPRV_LENGTHOF(dest8), &edits8, errorCode);
+                    CaseMap::utf8Fold(options, s8, sink, &editsSink, errorCode);
+                }
+                if (errorCode.errIfFailureAndReset("locale \"%s\" mapping %d options 0x%lx",
+                                                   locale, (int)which, (long)options)) {
+                    continue;
+                }
+                std::string expected;
+                UnicodeString(FALSE, dest16, length16).toUTF8String(expected);
+                UnicodeString name = UnicodeString("locale \"") + locale + "\" mapping " +
+                    (which == 0 ? "lower" : which == 1 ? "upper" : "fold") +
+                    (options == 0 ? "" : " with options");
+                assertEquals(name + " result", expected.c_str(), std::string(dest8, length8).c_str());
+                assertEquals(name + " sink result", expected.c_str(), sink8.c_str());
+                assertEquals(name + " number of changes",
+                             edits16.numberOfChanges(), edits8.numberOfChanges());
+                if ((options & U_OMIT_UNCHANGED_TEXT) == 0) {
+                    assertEquals(name + " edits length delta",
+                                 length8 - (int32_t)s8.length(), edits8.lengthDelta());
+                }
+                TestUtility::checkEqualEdits(*this, name + " sink edits", edits8, editsSink, errorCode);
+            }
+        }
+    }
+}
+
 void StringCaseTest::TestLongUnicodeString() {
     // Code coverage for UnicodeString case mapping code handling
     // long strings or many changes in a string.
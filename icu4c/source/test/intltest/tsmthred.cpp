@@ -24,7 +24,9 @@
 #include "intltest.h"
 #include "tsmthred.h"
 #include "unicode/ushape.h"
+#include "charstr.h"
 #include "unicode/translit.h"
+#include "unicode/ucnv.h"
 #include "sharedobject.h"
 #include "unifiedcache.h"
 #include "uassert.h"
@@ -46,7 +48,11 @@ MultithreadTest::~MultithreadTest()
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>    // tolower, toupper
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "unicode/putil.h"
 
@@ -86,6 +92,9 @@ void MultithreadTest::runIndexedTest( int32_t index, UBool exec,
     TESTCASE_AUTO(Test20104);
 #endif /* #if !UCONFIG_NO_FORMATTING */
 #endif /* #if !UCONFIG_NO_TRANSLITERATION */
+    TESTCASE_AUTO(TestResourceBundleOpen);
+    TESTCASE_AUTO(TestConvertParallel);
+    TESTCASE_AUTO(TestConverterPoolCleanup);
     TESTCASE_AUTO_END
 }
 
@@ -1585,3 +1594,201 @@ void MultithreadTest::Test20104() {
 #endif /* !UCONFIG_NO_FORMATTING */
 
 #endif /* !UCONFIG_NO_TRANSLITERATION */
+
+
+//-------------------------------------------------------------------------------------------
+//
+//  TestResourceBundleOpen  Open and close the same bundles from several threads.
+//                          Repeat opens bypass the bundle cache mutex, so check that they
+//                          find the same locale and status as a single-threaded open.
+//
+//-------------------------------------------------------------------------------------------
+
+static const char *const gResBundLocales[] = {
+    "en", "en_US", "en_GB", "de_CH", "fr_CA", "sr_Latn_RS", "zh_Hant_TW", "es_419",
+    "ja", "ar_EG", "xx_YY", "de__PHONEBOOK", "pt_PT", "en_US_POSIX", "root"
+};
+
+static const char *gResBundExpected[UPRV_LENGTHOF(gResBundLocales)];
+static UErrorCode gResBundExpectedStatus[UPRV_LENGTHOF(gResBundLocales)];
+
+class ResourceBundleOpenThread : public SimpleThread {
+public:
+    ResourceBundleOpenThread(int32_t start) : fStart(start), fErrors(0) {}
+    virtual void run();
+    int32_t fStart;
+    int32_t fErrors;
+};
+
+void ResourceBundleOpenThread::run() {
+    for (int32_t i = 0; i < 2000; ++i) {
+        int32_t index = (fStart + i) % UPRV_LENGTHOF(gResBundLocales);
+        UErrorCode status = U_ZERO_ERROR;
+        UResourceBundle *rb = ures_open(NULL, gResBundLocales[index], &status);
+        const char *actual = ures_getLocaleByType(rb, ULOC_ACTUAL_LOCALE, &status);
+        if (status != gResBundExpectedStatus[index] ||
+                uprv_strcmp(actual, gResBundExpected[index]) != 0) {
+            ++fErrors;
+        }
+        ures_close(rb);
+        status = U_ZERO_ERROR;
+        rb = ures_openDirect(NULL, "supplementalData", &status);
+        if (U_FAILURE(status)) {
+            ++fErrors;
+        }
+        ures_close(rb);
+    }
+}
+
+void MultithreadTest::TestResourceBundleOpen() {
+    for (int32_t i = 0; i < UPRV_LENGTHOF(gResBundLocales); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UResourceBundle *rb = ures_open(NULL, gResBundLocales[i], &status);
+        const char *actual = ures_getLocaleByType(rb, ULOC_ACTUAL_LOCALE, &status);
+        if (U_FAILURE(status)) {
+            dataerrln("ures_open(%s) failed - %s", gResBundLocales[i], u_errorName(status));
+            ures_close(rb);
+            return;
+        }
+        // The actual locale ID points into the cache entry, which outlives the bundle.
+        gResBundExpected[i] = actual;
+        gResBundExpectedStatus[i] = status;
+        ures_close(rb);
+    }
+
+    static constexpr int NUM_THREADS = 4;
+    ResourceBundleOpenThread *threads[NUM_THREADS];
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i] = new ResourceBundleOpenThread(i * 3);
+        threads[i]->start();
+    }
+    for (int32_t i = 0; i < NUM_THREADS; ++i) {
+        threads[i]->join();
+        assertEquals("ResourceBundleOpenThread errors", 0, threads[i]->fErrors);
+        delete threads[i];
+    }
+}
+
+
+//-------------------------------------------------------------------------------------------
+//
+//  TestConvertParallel  ucnv_convertParallel() with a runTasks function that
+//                       runs each conversion task on its own thread.
+//                       The result must be the same as from ucnv_convert().
+//
+//-------------------------------------------------------------------------------------------
+
+static void U_CALLCONV
+runConvertTasksOnThreads(const void * /*context*/, UConverterTaskFn *fn, void *tasks[], int32_t count) {
+    std::vector<std::thread> threads;
+    for (int32_t i = 1; i < count; ++i) {
+        threads.emplace_back(fn, tasks[i]);
+    }
+    fn(tasks[0]);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+void MultithreadTest::TestConvertParallel() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const char *const names[][2] = {
+        { "UTF-8", "Shift-JIS" },
+        { "UTF-8", "UTF-16LE" },
+        { "UTF-16BE", "gb18030" }
+    };
+    static const UChar pattern[] = {
+        0x41, 0x20, 0xe4, 0x4e00, 0x30a1, 0xac00, 0x2e, 0xe01, 0xd840, 0xdc00, 0x410, 0x20ac, 0xa
+    };
+    const int32_t textLength = 500000;
+    UnicodeString text;
+    for (int32_t i = 0; i < textLength; ++i) {
+        text.append(pattern[i % UPRV_LENGTHOF(pattern)]);
+    }
+
+    for (int32_t i = 0; i < UPRV_LENGTHOF(names); ++i) {
+        const char *sourceName = names[i][0], *targetName = names[i][1];
+        IcuTestErrorCode errorCode(*this, "TestConvertParallel");
+        LocalUConverterPointer sourceCnv(ucnv_open(sourceName, errorCode));
+        LocalUConverterPointer targetCnv(ucnv_open(targetName, errorCode));
+        if (errorCode.errDataIfFailureAndReset("unable to open the %s or %s converter",
+                                               sourceName, targetName)) {
+            continue;
+        }
+        int32_t capacity = 4 * textLength + 16;
+        std::unique_ptr<char[]> source(new char[capacity]);
+        std::unique_ptr<char[]> expected(new char[capacity]);
+        std::unique_ptr<char[]> actual(new char[capacity]);
+        int32_t sourceLength = ucnv_fromUChars(sourceCnv.getAlias(), source.get(), capacity,
+                                               text.getBuffer(), text.length(), errorCode);
+        int32_t expectedLength = ucnv_convert(targetName, sourceName, expected.get(), capacity,
+                                              source.get(), sourceLength, errorCode);
+        for (int32_t numThreads = 2; numThreads <= 8; numThreads *= 2) {
+            int32_t length = ucnv_convertParallel(targetCnv.getAlias(), sourceCnv.getAlias(),
+                                                  actual.get(), capacity,
+                                                  source.get(), sourceLength, numThreads,
+                                                  runConvertTasksOnThreads, NULL, errorCode);
+            if (errorCode.errIfFailureAndReset("ucnv_convertParallel(%s -> %s, %d threads)",
+                                               sourceName, targetName, (int)numThreads)) {
+                break;
+            }
+            if (length != expectedLength || uprv_memcmp(actual.get(), expected.get(), length) != 0) {
+                errln("ucnv_convertParallel(%s -> %s, %d threads) differs from ucnv_convert()",
+                      sourceName, targetName, (int)numThreads);
+            }
+        }
+    }
+#endif
+}
+
+
+//-------------------------------------------------------------------------------------------
+//
+//  TestConverterPoolCleanup  u_cleanup() closes the converters that ucnv_release()
+//                            pooled on another thread, so that their data is unloaded.
+//
+//-------------------------------------------------------------------------------------------
+
+void MultithreadTest::TestConverterPoolCleanup() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    std::mutex mutex;
+    std::condition_variable cond;
+    enum { STARTED, POOLED, CLEANED_UP } state = STARTED;
+    UErrorCode threadStatus = U_ZERO_ERROR;
+
+    std::thread thread([&]() {
+        ucnv_release(ucnv_acquire("ibm-1047", &threadStatus));
+        std::unique_lock<std::mutex> lock(mutex);
+        state = POOLED;
+        cond.notify_all();
+        // Do not use ICU during u_cleanup().
+        cond.wait(lock, [&]() { return state == CLEANED_UP; });
+    });
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]() { return state == POOLED; });
+    }
+
+    if (U_SUCCESS(threadStatus)) {
+        IcuTestErrorCode errorCode(*this, "TestConverterPoolCleanup");
+        CharString dataDirectory(u_getDataDirectory(), errorCode);
+        u_cleanup();
+        u_setDataDirectory(dataDirectory.data());
+
+        // If the pooled converter were still open, then its data would still be cached,
+        // and the converter opened here would share it.
+        ucnv_flushCache();
+        ucnv_close(ucnv_open("ibm-1047", errorCode));
+        assertEquals("ucnv_flushCache() unloads the reloaded data", 1, ucnv_flushCache());
+    } else {
+        dataerrln("unable to open the ibm-1047 converter - %s", u_errorName(threadStatus));
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        state = CLEANED_UP;
+        cond.notify_all();
+    }
+    thread.join();
+#endif
+}
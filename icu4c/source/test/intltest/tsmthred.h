@@ -54,6 +54,9 @@ class MultithreadTest : public IntlTest
     void TestBreakTranslit();
     void TestIncDec();
     void Test20104();
+    void TestResourceBundleOpen();
+    void TestConvertParallel();
+    void TestConverterPoolCleanup();
 };
 
 #endif
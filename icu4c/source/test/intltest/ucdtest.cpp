@@ -5,6 +5,8 @@
  * others. All Rights Reserved.
  ********************************************************************/
 
+#include <string>
+
 #include "unicode/ustring.h"
 #include "unicode/uchar.h"
 #include "unicode/ucpmap.h"
@@ -12,6 +14,7 @@
 #include "unicode/putil.h"
 #include "unicode/uscript.h"
 #include "unicode/uset.h"
+#include "cmemory.h"
 #include "cstring.h"
 #include "hash.h"
 #include "patternprops.h"
@@ -73,6 +76,7 @@ void UnicodeTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
 #if !UCONFIG_NO_NORMALIZATION
     TESTCASE_AUTO(TestBinaryCharacterProperties);
     TESTCASE_AUTO(TestIntCharacterProperties);
+    TESTCASE_AUTO(TestIntPropertyValues);
 #endif
     TESTCASE_AUTO_END;
 }
@@ -696,3 +700,71 @@ void UnicodeTest::TestIntCharacterProperties() {
     }
 #endif
 }
+
+void UnicodeTest::TestIntPropertyValues() {
+    IcuTestErrorCode errorCode(*this, "TestIntPropertyValues()");
+    // Batch lookups vs. u_getIntPropertyValue() for a sample of code points,
+    // including unpaired surrogates which are separated by other code points.
+    UChar32 codePoints[0x2000];
+    int32_t count = 0;
+    for (UChar32 c = 0; c <= 0x10ffff; c += c < 0x3000 ? 3 : 0x1f7) {
+        codePoints[count++] = c;
+        if (U_IS_SURROGATE(c)) {
+            codePoints[count++] = 0x61;
+        }
+    }
+    UnicodeString s;
+    for (int32_t i = 0; i < count; ++i) {
+        s.append(codePoints[i]);
+    }
+    std::string s8;
+    s.toUTF8String(s8);
+    // An ill-formed UTF-8 sequence is looked up as U+FFFD.
+    s8.append("\xf0\x9f\x98");
+    int32_t values[0x2000];
+    for (int32_t prop = UCHAR_INT_START; prop < UCHAR_INT_LIMIT; ++prop) {
+        u_getIntPropertyValues((UProperty)prop, codePoints, count, values, errorCode);
+        if (errorCode.errIfFailureAndReset("u_getIntPropertyValues(%d)", (int)prop)) {
+            continue;
+        }
+        for (int32_t i = 0; i < count; ++i) {
+            if (values[i] != u_getIntPropertyValue(codePoints[i], (UProperty)prop)) {
+                errln("u_getIntPropertyValues(%d) wrong value for U+%04lx",
+                      (int)prop, (long)codePoints[i]);
+                break;
+            }
+        }
+        uprv_memset(values, 0xff, sizeof(values));
+        int32_t length = u_strGetIntPropertyValues(
+            (UProperty)prop, toUCharPtr(s.getBuffer()), s.length(), values, count, errorCode);
+        if (errorCode.errIfFailureAndReset("u_strGetIntPropertyValues(%d)", (int)prop)) {
+            continue;
+        }
+        assertEquals("u_strGetIntPropertyValues() length", count, length);
+        for (int32_t i = 0; i < count; ++i) {
+            if (values[i] != u_getIntPropertyValue(codePoints[i], (UProperty)prop)) {
+                errln("u_strGetIntPropertyValues(%d) wrong value for U+%04lx",
+                      (int)prop, (long)codePoints[i]);
+                break;
+            }
+        }
+        uprv_memset(values, 0xff, sizeof(values));
+        length = u_strGetIntPropertyValuesUTF8(
+            (UProperty)prop, s8.data(), (int32_t)s8.length(), values, count + 1, errorCode);
+        if (errorCode.errIfFailureAndReset("u_strGetIntPropertyValuesUTF8(%d)", (int)prop)) {
+            continue;
+        }
+        assertEquals("u_strGetIntPropertyValuesUTF8() length", count + 1, length);
+        for (int32_t i = 0; i < count; ++i) {
+            // Surrogate code points were converted to U+FFFD in UTF-8.
+            UChar32 c = U_IS_SURROGATE(codePoints[i]) ? 0xfffd : codePoints[i];
+            if (values[i] != u_getIntPropertyValue(c, (UProperty)prop)) {
+                errln("u_strGetIntPropertyValuesUTF8(%d) wrong value for U+%04lx",
+                      (int)prop, (long)codePoints[i]);
+                break;
+            }
+        }
+        assertEquals("u_strGetIntPropertyValuesUTF8() ill-formed sequence",
+                     u_getIntPropertyValue(0xfffd, (UProperty)prop), values[count]);
+    }
+}
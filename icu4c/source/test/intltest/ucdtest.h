@@ -48,6 +48,7 @@ class UnicodeTest: public IntlTest {
     void TestInvalidCodePointFolding();
     void TestBinaryCharacterProperties();
     void TestIntCharacterProperties();
+    void TestIntPropertyValues();
 
 private:
 
@@ -10,8 +10,11 @@
 *
 ********************************************************************************
 */
+#include <atomic>
+
 #include "cstring.h"
 #include "intltest.h"
+#include "simplethread.h"
 #include "unifiedcache.h"
 #include "unicode/datefmt.h"
 
@@ -67,7 +70,7 @@ U_NAMESPACE_END
 
 class UnifiedCacheTest : public IntlTest {
 public:
-    UnifiedCacheTest() {
+    UnifiedCacheTest() : fCache(NULL), fErrorCount(0) {
     }
     void runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=0);
 private:
@@ -77,6 +80,11 @@ class UnifiedCacheTest : public IntlTest {
     void TestError();
     void TestHashEquals();
     void TestEvictionUnderStress();
+    void TestConcurrentShardedEviction();
+    void ConcurrentShardedEvictionThread(int32_t threadNumber);
+
+    const UnifiedCache *fCache;
+    std::atomic<int32_t> fErrorCount;
 };
 
 void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
@@ -87,6 +95,7 @@ void UnifiedCacheTest::runIndexedTest(int32_t index, UBool exec, const char* &na
   TESTCASE_AUTO(TestError);
   TESTCASE_AUTO(TestHashEquals);
   TESTCASE_AUTO(TestEvictionUnderStress);
+  TESTCASE_AUTO(TestConcurrentShardedEviction);
   TESTCASE_AUTO_END;
 }
 
@@ -108,6 +117,58 @@ void UnifiedCacheTest::TestEvictionUnderStress() {
 #endif /* #if !UCONFIG_NO_FORMATTING */
 }
 
+// Each thread gets values for pseudo-random keys spread over all of the shards,
+// half of them with a region so that creating their values gets the language values
+// from the cache while the entries are in progress.
+// It keeps a few references so that some values stay in use.
+void UnifiedCacheTest::ConcurrentShardedEvictionThread(int32_t threadNumber) {
+    uint32_t seed = threadNumber + 1;
+    const UCTItem *held[8] = {};
+    for (int32_t i = 0; i < 20000; ++i) {
+        seed = seed * 1103515245 + 12345;
+        int32_t n = (seed >> 16) % 500;
+        char name[8] = { (char)('a' + n / 26 % 26), (char)('a' + n % 26), 0 };
+        if (n >= 250) {
+            uprv_strcpy(name + 2, "_US");
+        }
+        UErrorCode status = U_ZERO_ERROR;
+        const UCTItem *item = NULL;
+        fCache->get(LocaleCacheKey<UCTItem>(name), fCache, item, status);
+        if (U_FAILURE(status) || item == NULL || uprv_strncmp(item->value, name, 2) != 0 ||
+                item->value[2] != 0) {
+            ++fErrorCount;
+        }
+        SharedObject::clearPtr(held[n % UPRV_LENGTHOF(held)]);
+        held[n % UPRV_LENGTHOF(held)] = item;
+    }
+    for (int32_t i = 0; i < UPRV_LENGTHOF(held); ++i) {
+        SharedObject::clearPtr(held[i]);
+    }
+}
+
+void UnifiedCacheTest::TestConcurrentShardedEviction() {
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCache::getInstance(status);
+    UnifiedCache cache(status);
+    assertSuccess("T0", status);
+    cache.setEvictionPolicy(20, 0, status);
+    fCache = &cache;
+    fErrorCount = 0;
+
+    ThreadPool<UnifiedCacheTest> threads(this, 4, &UnifiedCacheTest::ConcurrentShardedEvictionThread);
+    threads.start();
+    threads.join();
+    fCache = NULL;
+
+    assertEquals("T1 wrong or missing values", 0, fErrorCount.load());
+    assertTrue("T2 items were evicted", cache.autoEvictedCount() > 0);
+    // All references are released, and eviction keeps at most 20 unused entries.
+    assertEquals("T3", cache.keyCount(), cache.unusedCount());
+    assertTrue("T4 at most 20 entries", cache.keyCount() <= 20);
+    cache.flush();
+    assertEquals("T5", 0, cache.keyCount());
+}
+
 void UnifiedCacheTest::TestEvictionPolicy() {
     UErrorCode status = U_ZERO_ERROR;
 
@@ -14,6 +14,7 @@
 #include <stdio.h>
 
 #include <string.h>
+#include <string>
 #include "unicode/utypes.h"
 #include "usettest.h"
 #include "unicode/ucnv.h"
@@ -92,6 +93,9 @@ UnicodeSetTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestIntOverflow);
     TESTCASE_AUTO(TestUnusedCcc);
     TESTCASE_AUTO(TestDeepPattern);
+    TESTCASE_AUTO(TestFrozenManyRanges);
+    TESTCASE_AUTO(TestFrozenInstance);
+    TESTCASE_AUTO(TestSpanBlockBoundaries);
     TESTCASE_AUTO_END;
 }
 
@@ -3978,3 +3982,182 @@ void UnicodeSetTest::TestDeepPattern() {
     assertTrue("[a[a[a...1000s...]]] -> error", errorCode.isFailure());
     errorCode.reset();
 }
+
+void UnicodeSetTest::TestFrozenManyRanges() {
+    // A set with many ranges from U+0800 on gets a code point trie when frozen.
+    UnicodeSet thawed;
+    for (UChar32 c = 0x3040; c < 0x3100; c += 3) {
+        thawed.add(c);
+    }
+    for (UChar32 c = 0x1f300; c < 0x1f400; c += 2) {
+        thawed.add(c, c + (c & 4) / 4);
+    }
+    thawed.add(0x20000, 0x2a6d6).add(u'a', u'z');
+    UnicodeSet frozen(thawed);
+    frozen.freeze();
+    UnicodeSet copy(frozen);  // copies the frozen data structures
+    UnicodeSet small(u'a', u'z');
+    small.freeze();
+    assertEquals("thawed set has no frozen memory", 0, thawed.getFrozenMemoryUsage());
+    assertTrue("many-ranges frozen set uses more memory than a small one",
+               frozen.getFrozenMemoryUsage() > small.getFrozenMemoryUsage());
+    for (UChar32 c = 0; c <= 0x10ffff; ++c) {
+        UBool expected = thawed.contains(c);
+        if (frozen.contains(c) != expected || copy.contains(c) != expected) {
+            errln("frozen.contains(U+%04lx) != thawed.contains()", (long)c);
+            break;
+        }
+    }
+
+    UnicodeString s(u"ab\U0001f300\U0001f305\U00020000\u3040!\U0001f302");
+    assertEquals("span(contained)", 9, frozen.span(s, 0, USET_SPAN_CONTAINED));
+    assertEquals("copy.span(contained)", 9, copy.span(s, 0, USET_SPAN_CONTAINED));
+    assertEquals("spanBack(contained)", s.length() - 2,
+                 frozen.spanBack(s, s.length(), USET_SPAN_CONTAINED));
+    std::string s8;
+    s.toUTF8String(s8);
+    assertEquals("spanUTF8(contained)", 17,
+                 frozen.spanUTF8(s8.data(), (int32_t)s8.length(), USET_SPAN_CONTAINED));
+}
+
+void UnicodeSetTest::TestFrozenInstance() {
+    IcuTestErrorCode errorCode(*this, "TestFrozenInstance");
+    UnicodeString pattern(u"[[:Script=Han:][:Hiragana:]]");
+    const UnicodeSet *set = UnicodeSet::getFrozenInstance(pattern, USET_IGNORE_SPACE, errorCode);
+    if (errorCode.errDataIfFailureAndReset("getFrozenInstance(%s)", "[[:Script=Han:][:Hiragana:]]")) {
+        return;
+    }
+    assertTrue("frozen", set->isFrozen());
+    assertTrue("equal to a new set", *set == UnicodeSet(pattern, errorCode));
+    assertTrue("same set the second time",
+               set == UnicodeSet::getFrozenInstance(pattern, USET_IGNORE_SPACE, errorCode));
+    // The cache key is the pattern string, not the set.
+    const UnicodeSet *spaced = UnicodeSet::getFrozenInstance(
+        u"[ [:Script=Han:] [:Hiragana:] ]", USET_IGNORE_SPACE, errorCode);
+    assertTrue("other spelling: other object, same contents", spaced != set && *spaced == *set);
+    assertEquals("span", 3, set->span(u"\u3042\u4e00\u3044a", 4, USET_SPAN_CONTAINED));
+
+    assertTrue("syntax error -> NULL",
+               UnicodeSet::getFrozenInstance(u"[:Script=Han:", 0, errorCode) == NULL);
+    assertEquals("syntax error", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+}
+
+// Spans of a frozen set must end where the thawed set's spans end,
+// including where the frozen set tests blocks of 16 code units.
+// The strings start and end with runs of one character whose lengths
+// cross the block boundaries and the minimum lengths for the block code.
+UBool UnicodeSetTest::checkFrozenSpans(const UnicodeSet &thawed, const UnicodeSet &frozen,
+                                       const UnicodeString &s, const char *message) {
+    const UChar *p = s.getBuffer();
+    int32_t length = s.length();
+    for (int32_t cond = USET_SPAN_NOT_CONTAINED; cond <= USET_SPAN_SIMPLE; ++cond) {
+        USetSpanCondition spanCondition = (USetSpanCondition)cond;
+        for (int32_t i = 0; i < 3 && i <= length; ++i) {
+            int32_t expected = thawed.span(p + i, length - i, spanCondition);
+            if (frozen.span(p + i, length - i, spanCondition) != expected) {
+                errln("FAIL: %s: frozen.span(start %d, condition %d) != %d",
+                      message, (int)i, (int)cond, (int)expected);
+                return FALSE;
+            }
+            expected = thawed.spanBack(p, length - i, spanCondition);
+            if (frozen.spanBack(p, length - i, spanCondition) != expected) {
+                errln("FAIL: %s: frozen.spanBack(limit %d, condition %d) != %d",
+                      message, (int)(length - i), (int)cond, (int)expected);
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+UBool UnicodeSetTest::checkFrozenSpansUTF8(const UnicodeSet &thawed, const UnicodeSet &frozen,
+                                           const std::string &s, const char *message) {
+    const char *p = s.data();
+    int32_t length = (int32_t)s.length();
+    for (int32_t cond = USET_SPAN_NOT_CONTAINED; cond <= USET_SPAN_SIMPLE; ++cond) {
+        USetSpanCondition spanCondition = (USetSpanCondition)cond;
+        for (int32_t i = 0; i < 4 && i <= length; ++i) {
+            int32_t expected = thawed.spanUTF8(p + i, length - i, spanCondition);
+            if (frozen.spanUTF8(p + i, length - i, spanCondition) != expected) {
+                errln("FAIL: %s: frozen.spanUTF8(start %d, condition %d) != %d",
+                      message, (int)i, (int)cond, (int)expected);
+                return FALSE;
+            }
+            expected = thawed.spanBackUTF8(p, length - i, spanCondition);
+            if (frozen.spanBackUTF8(p, length - i, spanCondition) != expected) {
+                errln("FAIL: %s: frozen.spanBackUTF8(length %d, condition %d) != %d",
+                      message, (int)(length - i), (int)cond, (int)expected);
+                return FALSE;
+            }
+        }
+    }
+    return TRUE;
+}
+
+void UnicodeSetTest::TestSpanBlockBoundaries() {
+    static const char *const patterns[] = {
+        "[:L:]",
+        "[\\u0000-\\u00ff]",
+        "[\\u0080-\\u07ff]",
+        "[^\\u0000]",
+        "[a-z\\u00e0-\\u00ff\\u0430-\\u044f\\U00010400-\\U0001044f]"
+    };
+    // Characters for the runs: ASCII, Latin-1, a uniform 64-block,
+    // a mixed 64-block, a BMP character from U+0800, and a supplementary one.
+    static const UChar32 runChars[] = { 0x61, 0xe9, 0x436, 0x3b1, 0x4e00, 0x10400 };
+    // Characters that may stop the runs, including unpaired surrogates.
+    static const UChar32 stopChars[] = { 0x20, 0x100, 0x3f6, 0xfffd, 0x10400, 0xd800, 0xdc00 };
+    // Ill-formed UTF-8 that may stop the runs: a trail byte run,
+    // a lead byte without a trail byte, and a truncated 3-byte sequence.
+    static const char *const badUTF8[] = { "\x80\x80\x80\x80\x80", "\xc2", "\xe4\xb8" };
+    static const int32_t runLengths[] = {
+        0, 1, 2, 7, 8, 9, 15, 16, 17, 23, 24, 25, 31, 32, 33,
+        39, 40, 41, 47, 48, 49, 55, 56, 57, 63, 64, 65, 100, 300
+    };
+
+    char message[100];
+    for (int32_t i = 0; i < UPRV_LENGTHOF(patterns); ++i) {
+        IcuTestErrorCode errorCode(*this, "TestSpanBlockBoundaries");
+        UnicodeSet thawed(UnicodeString(patterns[i], -1, US_INV).unescape(), errorCode);
+        if (errorCode.errDataIfFailureAndReset("UnicodeSet(%s)", patterns[i])) {
+            continue;
+        }
+        UnicodeSet frozen(thawed);
+        frozen.freeze();
+        for (int32_t j = 0; j < UPRV_LENGTHOF(runChars); ++j) {
+            for (int32_t k = 0; k < UPRV_LENGTHOF(stopChars); ++k) {
+                for (int32_t m = 0; m < UPRV_LENGTHOF(runLengths); ++m) {
+                    sprintf(message, "%s run U+%04lx x%d stop U+%04lx", patterns[i],
+                            (long)runChars[j], (int)runLengths[m], (long)stopChars[k]);
+                    // The run, a stop character, another run, and a stop character
+                    // with one ASCII character to shift the second run.
+                    UnicodeString s;
+                    for (int32_t n = 0; n < runLengths[m]; ++n) { s.append(runChars[j]); }
+                    s.append(stopChars[k]);
+                    for (int32_t n = 0; n < runLengths[m]; ++n) { s.append(runChars[j]); }
+                    s.append(stopChars[k]).append(u'a');
+                    if (!checkFrozenSpans(thawed, frozen, s, message)) { return; }
+                    // Stop characters first, for the backward spans.
+                    s.reverse();
+                    if (!checkFrozenSpans(thawed, frozen, s, message)) { return; }
+
+                    std::string s8;
+                    s.toUTF8String(s8);  // unpaired surrogates -> U+FFFD
+                    if (!checkFrozenSpansUTF8(thawed, frozen, s8, message)) { return; }
+                }
+            }
+            for (int32_t k = 0; k < UPRV_LENGTHOF(badUTF8); ++k) {
+                for (int32_t m = 0; m < UPRV_LENGTHOF(runLengths); ++m) {
+                    sprintf(message, "%s run U+%04lx x%d ill-formed UTF-8 %d", patterns[i],
+                            (long)runChars[j], (int)runLengths[m], (int)k);
+                    UnicodeString run;
+                    for (int32_t n = 0; n < runLengths[m]; ++n) { run.append(runChars[j]); }
+                    std::string run8;
+                    run.toUTF8String(run8);
+                    std::string s8 = run8 + badUTF8[k] + run8 + badUTF8[k] + 'a' + run8;
+                    if (!checkFrozenSpansUTF8(thawed, frozen, s8, message)) { return; }
+                }
+            }
+        }
+    }
+}
@@ -94,6 +94,9 @@ class UnicodeSetTest: public IntlTest {
     void TestIntOverflow();
     void TestUnusedCcc();
     void TestDeepPattern();
+    void TestFrozenManyRanges();
+    void TestFrozenInstance();
+    void TestSpanBlockBoundaries();
 
 private:
 
@@ -189,6 +192,11 @@ class UnicodeSetTest: public IntlTest {
     void testSpanUTF16String(const UnicodeSetWithStrings *sets[4], uint32_t whichSpans, const char *testName);
     void testSpanUTF8String(const UnicodeSetWithStrings *sets[4], uint32_t whichSpans, const char *testName);
 
+    UBool checkFrozenSpans(const UnicodeSet &thawed, const UnicodeSet &frozen,
+                           const UnicodeString &s, const char *message);
+    UBool checkFrozenSpansUTF8(const UnicodeSet &thawed, const UnicodeSet &frozen,
+                               const std::string &s, const char *message);
+
     UConverter *openUTF8Converter();
 
     UConverter *utf8Cnv;
@@ -116,6 +116,24 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_Latin8_ToUTF8);
+        TESTCASE(55,TestICU_Latin8_FromUTF8);
+        TESTCASE(56,TestICU_EBCDIC_Arabic_ToUTF8);
+        TESTCASE(57,TestICU_EBCDIC_Arabic_FromUTF8);
+        TESTCASE(58,TestICU_SJIS_ToUTF8);
+        TESTCASE(59,TestICU_SJIS_FromUTF8);
+        TESTCASE(60,TestICU_EUCJP_ToUTF8);
+        TESTCASE(61,TestICU_EUCJP_FromUTF8);
+        TESTCASE(62,TestICU_GB2312_ToUTF8);
+        TESTCASE(63,TestICU_GB2312_FromUTF8);
+        TESTCASE(64,TestICU_GB18030_ToUTF8);
+        TESTCASE(65,TestICU_GB18030_FromUTF8);
+        TESTCASE(66,TestICU_GB18030_FourByte_FromUnicode);
+        TESTCASE(67,TestICU_GB18030_FourByte_ToUTF8);
+        TESTCASE(68,TestICU_GB18030_FourByte_FromUTF8);
+        TESTCASE(69,TestICU_ISO2022JP_ToUTF8);
+        TESTCASE(70,TestICU_ISO2022JP_FromUTF8);
+
         default: 
             name = ""; 
             return NULL;
@@ -657,3 +675,158 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_ISO2022JP_ToUnicode(){
     }
     return pf;
 }
+
+//#################
+
+UPerfFunction* ConverterPerformanceTest::TestICU_Latin8_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("iso-8859-8",TRUE,latin8_uniSource, UPRV_LENGTHOF(latin8_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_Latin8_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("iso-8859-8",FALSE,latin8_uniSource, UPRV_LENGTHOF(latin8_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_EBCDIC_Arabic_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("x-EBCDIC-Arabic",TRUE,ebcdic_arabic_uniSource, UPRV_LENGTHOF(ebcdic_arabic_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_EBCDIC_Arabic_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("x-EBCDIC-Arabic",FALSE,ebcdic_arabic_uniSource, UPRV_LENGTHOF(ebcdic_arabic_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SJIS_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("sjis",TRUE,sjis_uniSource, UPRV_LENGTHOF(sjis_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_SJIS_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("sjis",FALSE,sjis_uniSource, UPRV_LENGTHOF(sjis_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_EUCJP_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("euc-jp",TRUE,eucjp_uniSource, UPRV_LENGTHOF(eucjp_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_EUCJP_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("euc-jp",FALSE,eucjp_uniSource, UPRV_LENGTHOF(eucjp_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB2312_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("gb2312",TRUE,gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB2312_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("gb2312",FALSE,gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("gb18030",TRUE,gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("gb18030",FALSE,gb2312_uniSource, UPRV_LENGTHOF(gb2312_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_FourByte_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("gb18030",gb18030_fourByteUniSource, UPRV_LENGTHOF(gb18030_fourByteUniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_FourByte_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("gb18030",TRUE,gb18030_fourByteUniSource, UPRV_LENGTHOF(gb18030_fourByteUniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_GB18030_FourByte_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("gb18030",FALSE,gb18030_fourByteUniSource, UPRV_LENGTHOF(gb18030_fourByteUniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022JP_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("iso-2022-jp",TRUE,iso2022jp_uniSource, UPRV_LENGTHOF(iso2022jp_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_ISO2022JP_FromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertUTF8PerfFunction("iso-2022-jp",FALSE,iso2022jp_uniSource, UPRV_LENGTHOF(iso2022jp_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
@@ -117,6 +117,77 @@ class ICUFromUnicodePerfFunction : public UPerfFunction{
     }
 };
 
+/**
+ * Converts between a charset and UTF-8 with ucnv_convertEx(),
+ * which uses direct conversion without a UTF-16 pivot where the converter supports it.
+ */
+class ICUConvertUTF8PerfFunction : public UPerfFunction{
+private:
+    UConverter* sourceCnv;
+    UConverter* targetCnv;
+    char* src;
+    int32_t srcLen;
+    char* target;
+    char* targetLimit;
+
+public:
+    /**
+     * @param toUTF8 if TRUE, source is in the named charset and is converted to UTF-8;
+     *               otherwise the source is converted from UTF-8 to the named charset
+     */
+    ICUConvertUTF8PerfFunction(const char* name, UBool toUTF8, const UChar* uniSource, int32_t uniSourceLen, UErrorCode& status){
+        UConverter* cnv = ucnv_open(name,&status);
+        UConverter* utf8 = ucnv_open("UTF-8",&status);
+        src = NULL;
+        target = NULL;
+        if(toUTF8){
+            sourceCnv = cnv;
+            targetCnv = utf8;
+        }else{
+            sourceCnv = utf8;
+            targetCnv = cnv;
+        }
+        if(U_FAILURE(status)){
+            return;
+        }
+        // encode the Unicode source text in the source charset
+        srcLen = ucnv_fromUChars(sourceCnv, NULL, 0, uniSource, uniSourceLen, &status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+        }
+        src = (char*)malloc(srcLen);
+        int32_t reqdLen = ucnv_fromUChars(targetCnv, NULL, 0, uniSource, uniSourceLen, &status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+        }
+        target = (char*)malloc(reqdLen*2);
+        targetLimit = target + reqdLen*2;
+        if(src == NULL || target == NULL){
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        ucnv_fromUChars(sourceCnv, src, srcLen, uniSource, uniSourceLen, &status);
+        if(status==U_STRING_NOT_TERMINATED_WARNING) {
+            status=U_ZERO_ERROR;
+        }
+    }
+    virtual void call(UErrorCode* status){
+        const char* mySrc = src;
+        char* myTarget = target;
+        ucnv_convertEx(targetCnv, sourceCnv, &myTarget, targetLimit, &mySrc, src + srcLen,
+                       NULL, NULL, NULL, NULL, TRUE, TRUE, status);
+    }
+    virtual long getOperationsPerIteration(void){
+        return srcLen;
+    }
+    ~ICUConvertUTF8PerfFunction(){
+        free(src);
+        free(target);
+        ucnv_close(sourceCnv);
+        ucnv_close(targetCnv);
+    }
+};
+
 class ICUOpenAllConvertersFunction : public UPerfFunction{
 private:
     UBool cleanup;
@@ -566,6 +637,24 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_ISO2022JP_ToUnicode();
     UPerfFunction* TestWinIML2_ISO2022JP_FromUnicode(); 
 
+    UPerfFunction* TestICU_Latin8_ToUTF8();
+    UPerfFunction* TestICU_Latin8_FromUTF8();
+    UPerfFunction* TestICU_EBCDIC_Arabic_ToUTF8();
+    UPerfFunction* TestICU_EBCDIC_Arabic_FromUTF8();
+    UPerfFunction* TestICU_SJIS_ToUTF8();
+    UPerfFunction* TestICU_SJIS_FromUTF8();
+    UPerfFunction* TestICU_EUCJP_ToUTF8();
+    UPerfFunction* TestICU_EUCJP_FromUTF8();
+    UPerfFunction* TestICU_GB2312_ToUTF8();
+    UPerfFunction* TestICU_GB2312_FromUTF8();
+    UPerfFunction* TestICU_GB18030_ToUTF8();
+    UPerfFunction* TestICU_GB18030_FromUTF8();
+    UPerfFunction* TestICU_GB18030_FourByte_FromUnicode();
+    UPerfFunction* TestICU_GB18030_FourByte_ToUTF8();
+    UPerfFunction* TestICU_GB18030_FourByte_FromUTF8();
+    UPerfFunction* TestICU_ISO2022JP_ToUTF8();
+    UPerfFunction* TestICU_ISO2022JP_FromUTF8();
+
 };
 
 #endif
@@ -924,6 +924,36 @@ unsigned char gb2312_encSmSource[]={
         0x82,0x6C,0x82,0x6D,0x82,0x6E,0x82,0x6F,0x82,0x70,0x82,0x71,0x82,0x72,0x82,0x73,0x82,0x74,0x82,0x75
 };
 
+WCHAR gb18030_fourByteUniSource[]={
+    0xAC00,0xAC01,0xAC02,0xAC03,0xAC04,0xAC05,0xAC06,0xAC07,0xAC08,0xAC09,
+    0xAC0A,0xAC0B,0xAC0C,0xAC0D,0xAC0E,0xAC0F,0xAC10,0xAC11,0xAC12,0xAC13,
+    0x000D,0x000A,0xAC50,0xAC51,0xAC52,0xAC53,0xAC54,0xAC55,0xAC56,0xAC57,
+    0xAC58,0xAC59,0xAC5A,0xAC5B,0xAC5C,0xAC5D,0xAC5E,0xAC5F,0xAC60,0xAC61,
+    0xAC62,0xAC63,0x000D,0x000A,0xD000,0xD001,0xD002,0xD003,0xD004,0xD005,
+    0xD006,0xD007,0xD008,0xD009,0xD00A,0xD00B,0xD00C,0xD00D,0xD00E,0xD00F,
+    0xD010,0xD011,0xD012,0xD013,0x000D,0x000A,0x0E01,0x0E02,0x0E03,0x0E04,
+    0x0E05,0x0E06,0x0E07,0x0E08,0x0E09,0x0E0A,0x0E0B,0x0E0C,0x0E0D,0x0E0E,
+    0x0E0F,0x0E10,0x0E11,0x0E12,0x0E13,0x0E14,0x000D,0x000A,0x0531,0x0532,
+    0x0533,0x0534,0x0535,0x0536,0x0537,0x0538,0x0539,0x053A,0x053B,0x053C,
+    0x053D,0x053E,0x053F,0x0540,0x0541,0x0542,0x0543,0x0544,0x000D,0x000A,
+    0x0905,0x0906,0x0907,0x0908,0x0909,0x090A,0x090B,0x090C,0x090D,0x090E,
+    0x090F,0x0910,0x0911,0x0912,0x0913,0x0914,0x0915,0x0916,0x0917,0x0918,
+    0x000D,0x000A,0x0F40,0x0F41,0x0F42,0x0F43,0x0F44,0x0F45,0x0F46,0x0F47,
+    0x0F48,0x0F49,0x0F4A,0x0F4B,0x0F4C,0x0F4D,0x0F4E,0x0F4F,0x0F50,0x0F51,
+    0x0F52,0x0F53,0x000D,0x000A,0x13A0,0x13A1,0x13A2,0x13A3,0x13A4,0x13A5,
+    0x13A6,0x13A7,0x13A8,0x13A9,0x13AA,0x13AB,0x13AC,0x13AD,0x13AE,0x13AF,
+    0x13B0,0x13B1,0x13B2,0x13B3,0x000D,0x000A,0x4E00,0x4E01,0x4E03,0x4E07,
+    0x4E08,0x4E09,0x4E0A,0x4E0B,0x000D,0x000A,0xD840,0xDC00,0xD840,0xDC01,
+    0xD840,0xDC02,0xD840,0xDC03,0xD840,0xDC04,0xD840,0xDC05,0xD840,0xDC06,
+    0xD840,0xDC07,0xD840,0xDC08,0xD840,0xDC09,0xD840,0xDC0A,0xD840,0xDC0B,
+    0xD840,0xDC0C,0xD840,0xDC0D,0xD840,0xDC0E,0xD840,0xDC0F,0xD840,0xDC10,
+    0xD840,0xDC11,0xD840,0xDC12,0xD840,0xDC13,0xD83D,0xDE00,0xD83D,0xDE01,
+    0xD83D,0xDE02,0xD83D,0xDE03,0xD83D,0xDE04,0xD83D,0xDE05,0xD83D,0xDE06,
+    0xD83D,0xDE07,0xD83D,0xDE08,0xD83D,0xDE09,0xD83D,0xDE0A,0xD83D,0xDE0B,
+    0xD83D,0xDE0C,0xD83D,0xDE0D,0xD83D,0xDE0E,0xD83D,0xDE0F,0xD83D,0xDE10,
+    0xD83D,0xDE11,0xD83D,0xDE12,0xD83D,0xDE13,0x000D,0x000A,
+};
+
 unsigned char latin1_encSource[]={
     0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x0D,0x0E,0x0F,0x10,0x11,0x12,0x13,0x14,
     0x15,0x16,0x17,0x18,0x19,0x1A,0x1B,0x1C,0x1D,0x1E,0x1F,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,
@@ -0,0 +1,239 @@
+/*
+ ***********************************************************************
+ * © 2018 and later: Unicode, Inc. and others.
+ * License & terms of use: http://www.unicode.org/copyright.html#License
+ ***********************************************************************
+ *  file name:  csdetperf.cpp
+ *  encoding:   UTF-8
+ *  tab size:   8 (not used)
+ *  indentation:4
+ *
+ *  Performance test program for the charset detector.
+ *  Runs it over a built-in corpus of sample texts in several languages,
+ *  each converted to several of the detectable charsets.
+ *
+ * Usage from within <ICU build tree>/test/perf/csdetperf/ :
+ * (Linux)
+ *  make
+ *  export LD_LIBRARY_PATH=../../../lib:../../../stubdata:../../../tools/ctestfw
+ *  ./csdetperf --passes 3 --iterations 100
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "unicode/localpointer.h"
+#include "unicode/ucnv.h"
+#include "unicode/ucsdet.h"
+#include "unicode/unistr.h"
+#include "unicode/uperf.h"
+#include "charstr.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+#include "cstring.h"
+#include "toolutil.h"
+
+// Each sample is repeated to about this many UChars.
+#define SAMPLE_MIN_LENGTH 2000
+
+static const struct {
+    const char *text;
+    const char *charsets;  // space-separated
+} samples[] = {
+    // en
+    { "The quick brown fox jumps over the lazy dog. This is a sample of English text "
+      "that is used for measuring how fast the charset detector works on typical documents. ",
+      "UTF-8 ISO-8859-1 UTF-16 UTF-16LE" },
+    // de
+    { "\\u00DCber den Wolken muss die Freiheit wohl grenzenlos sein. Die Gr\\u00F6\\u00DFe der "
+      "Stra\\u00DFe h\\u00E4ngt von der Stadt ab, in der man wohnt. ",
+      "ISO-8859-1 UTF-8" },
+    // fr
+    { "Le c\\u0153ur a ses raisons que la raison ne conna\\u00EEt point. O\\u00F9 est la "
+      "biblioth\\u00E8que? Elle est \\u00E0 c\\u00F4t\\u00E9 de l'\\u00E9cole. ",
+      "windows-1252" },
+    // ru
+    { "\\u0421\\u044A\\u0435\\u0448\\u044C \\u0436\\u0435 \\u0435\\u0449\\u0451 \\u044D\\u0442\\u0438\\u0445 "
+      "\\u043C\\u044F\\u0433\\u043A\\u0438\\u0445 \\u0444\\u0440\\u0430\\u043D\\u0446\\u0443\\u0437\\u0441\\u043A\\u0438\\u0445 "
+      "\\u0431\\u0443\\u043B\\u043E\\u043A, \\u0434\\u0430 \\u0432\\u044B\\u043F\\u0435\\u0439 \\u0447\\u0430\\u044E. "
+      "\\u042D\\u0442\\u043E \\u043F\\u0440\\u0438\\u043C\\u0435\\u0440 \\u0440\\u0443\\u0441\\u0441\\u043A\\u043E\\u0433\\u043E "
+      "\\u0442\\u0435\\u043A\\u0441\\u0442\\u0430 \\u0434\\u043B\\u044F \\u043F\\u0440\\u043E\\u0432\\u0435\\u0440\\u043A\\u0438 "
+      "\\u043E\\u043F\\u0440\\u0435\\u0434\\u0435\\u043B\\u0435\\u043D\\u0438\\u044F \\u043A\\u043E\\u0434\\u0438\\u0440\\u043E\\u0432\\u043A\\u0438. ",
+      "KOI8-R windows-1251 ISO-8859-5 UTF-8" },
+    // el
+    { "\\u0397 \\u03B3\\u03C1\\u03AE\\u03B3\\u03BF\\u03C1\\u03B7 \\u03BA\\u03B1\\u03C6\\u03AD \\u03B1\\u03BB\\u03B5\\u03C0\\u03BF\\u03CD "
+      "\\u03C0\\u03B7\\u03B4\\u03AC \\u03C0\\u03AC\\u03BD\\u03C9 \\u03B1\\u03C0\\u03CC \\u03C4\\u03BF "
+      "\\u03C4\\u03B5\\u03BC\\u03C0\\u03AD\\u03BB\\u03B9\\u03BA\\u03BF \\u03C3\\u03BA\\u03C5\\u03BB\\u03AF. "
+      "\\u0391\\u03C5\\u03C4\\u03CC \\u03B5\\u03AF\\u03BD\\u03B1\\u03B9 \\u03AD\\u03BD\\u03B1 "
+      "\\u03C0\\u03B1\\u03C1\\u03AC\\u03B4\\u03B5\\u03B9\\u03B3\\u03BC\\u03B1 \\u03B5\\u03BB\\u03BB\\u03B7\\u03BD\\u03B9\\u03BA\\u03BF\\u03CD "
+      "\\u03BA\\u03B5\\u03B9\\u03BC\\u03AD\\u03BD\\u03BF\\u03C5. ",
+      "ISO-8859-7" },
+    // ar
+    { "\\u0647\\u0630\\u0627 \\u0645\\u062B\\u0627\\u0644 \\u0639\\u0644\\u0649 \\u0646\\u0635 \\u0639\\u0631\\u0628\\u064A "
+      "\\u064A\\u0633\\u062A\\u062E\\u062F\\u0645 \\u0644\\u0642\\u064A\\u0627\\u0633 \\u0633\\u0631\\u0639\\u0629 "
+      "\\u0627\\u0643\\u062A\\u0634\\u0627\\u0641 \\u062A\\u0631\\u0645\\u064A\\u0632 \\u0627\\u0644\\u0623\\u062D\\u0631\\u0641 "
+      "\\u0641\\u064A \\u0627\\u0644\\u0645\\u0633\\u062A\\u0646\\u062F\\u0627\\u062A \\u0627\\u0644\\u0639\\u0627\\u062F\\u064A\\u0629. ",
+      "windows-1256" },
+    // ja
+    { "\\u3053\\u308C\\u306F\\u6587\\u5B57\\u30B3\\u30FC\\u30C9\\u306E\\u691C\\u51FA\\u306E\\u901F\\u3055\\u3092"
+      "\\u6E2C\\u308B\\u305F\\u3081\\u306E\\u65E5\\u672C\\u8A9E\\u306E\\u6587\\u7AE0\\u3067\\u3059\\u3002"
+      "\\u6771\\u4EAC\\u306F\\u65E5\\u672C\\u306E\\u9996\\u90FD\\u3067\\u3059\\u3002 ",
+      "Shift_JIS EUC-JP ISO-2022-JP UTF-8" },
+    // zh
+    { "\\u8FD9\\u662F\\u7528\\u4E8E\\u6D4B\\u91CF\\u5B57\\u7B26\\u96C6\\u68C0\\u6D4B\\u901F\\u5EA6\\u7684"
+      "\\u4E2D\\u6587\\u6587\\u672C\\u3002\\u5317\\u4EAC\\u662F\\u4E2D\\u56FD\\u7684\\u9996\\u90FD\\u3002 ",
+      "GB18030 UTF-8" },
+    // zh_Hant
+    { "\\u9019\\u662F\\u7528\\u65BC\\u6E2C\\u91CF\\u5B57\\u5143\\u96C6\\u5075\\u6E2C\\u901F\\u5EA6\\u7684"
+      "\\u4E2D\\u6587\\u6587\\u5B57\\u3002\\u81FA\\u5317\\u662F\\u81FA\\u7063\\u7684\\u57CE\\u5E02\\u3002 ",
+      "Big5" },
+    // ko
+    { "\\uC774\\uAC83\\uC740 \\uBB38\\uC790 \\uC9D1\\uD569 \\uAC10\\uC9C0 \\uC18D\\uB3C4\\uB97C "
+      "\\uCE21\\uC815\\uD558\\uAE30 \\uC704\\uD55C \\uD55C\\uAD6D\\uC5B4 \\uD14D\\uC2A4\\uD2B8\\uC785\\uB2C8\\uB2E4. "
+      "\\uC11C\\uC6B8\\uC740 \\uD55C\\uAD6D\\uC758 \\uC218\\uB3C4\\uC785\\uB2C8\\uB2E4. ",
+      "EUC-KR" }
+};
+
+// Maximum number of documents: samples times charsets per sample.
+#define MAX_DOCUMENTS 40
+
+// Test object.
+class CharsetDetectorPerfTest : public UPerfTest {
+public:
+    CharsetDetectorPerfTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, NULL, 0, "", status), numDocuments(0), numBytes(0) {
+        if(U_FAILURE(status)) {
+            return;
+        }
+        for(int32_t i=0; i<UPRV_LENGTHOF(samples); ++i) {
+            UnicodeString sample=UnicodeString(samples[i].text, -1, US_INV).unescape();
+            UnicodeString text;
+            while(text.length()<SAMPLE_MIN_LENGTH) {
+                text.append(sample);
+            }
+            CharString charsets(samples[i].charsets, status);
+            const char *start=charsets.data();
+            const char *limit=start+charsets.length();
+            while(start<limit && U_SUCCESS(status)) {
+                const char *end=uprv_strchr(start, ' ');
+                if(end==NULL) {
+                    end=limit;
+                }
+                CharString charset(start, (int32_t)(end-start), status);
+                addDocument(text, charset.data(), status);
+                start=end+1;
+            }
+        }
+    }
+
+    virtual UPerfFunction *runIndexedTest(int32_t index, UBool exec, const char *&name, char *par=NULL);
+
+    const CharString &getDocument(int32_t i) const { return documents[i]; }
+    int32_t getNumDocuments() const { return numDocuments; }
+    int32_t getNumBytes() const { return numBytes; }
+
+private:
+    void addDocument(const UnicodeString &text, const char *charset, UErrorCode &status) {
+        if(U_FAILURE(status) || numDocuments>=MAX_DOCUMENTS) {
+            return;
+        }
+        LocalUConverterPointer cnv(ucnv_open(charset, &status));
+        int32_t length=text.extract(NULL, 0, cnv.getAlias(), status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+        }
+        CharString &document=documents[numDocuments];
+        char *buffer=document.getAppendBuffer(length, length, length, status);
+        if(U_FAILURE(status)) {
+            return;
+        }
+        text.extract(buffer, length, cnv.getAlias(), status);
+        document.append(buffer, length, status);
+        numBytes+=length;
+        ++numDocuments;
+    }
+
+    CharString documents[MAX_DOCUMENTS];
+    int32_t numDocuments;
+    int32_t numBytes;
+};
+
+// Performance test function object.
+// Runs the detector over each of the documents.
+class CharsetDetectorPerfFn : public UPerfFunction {
+public:
+    CharsetDetectorPerfFn(const CharsetDetectorPerfTest &perf, UBool detectAll, UBool fastMode)
+            : testcase(perf), all(detectAll) {
+        IcuToolErrorCode errorCode("CharsetDetectorPerfFn()");
+        csd.adoptInstead(ucsdet_open(errorCode));
+        ucsdet_enableFastMode(csd.getAlias(), fastMode);
+    }
+    virtual ~CharsetDetectorPerfFn() {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        for(int32_t i=0; i<testcase.getNumDocuments(); ++i) {
+            const CharString &document=testcase.getDocument(i);
+            ucsdet_setText(csd.getAlias(), document.data(), document.length(), pErrorCode);
+            if(all) {
+                int32_t count;
+                ucsdet_detectAll(csd.getAlias(), &count, pErrorCode);
+            } else {
+                ucsdet_detect(csd.getAlias(), pErrorCode);
+            }
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        return testcase.getNumDocuments();
+    }
+
+    virtual long getEventsPerIteration() {
+        return testcase.getNumBytes();
+    }
+
+private:
+    const CharsetDetectorPerfTest &testcase;
+    UBool all;
+    LocalUCharsetDetectorPointer csd;
+};
+
+UPerfFunction *CharsetDetectorPerfTest::runIndexedTest(int32_t index, UBool exec,
+                                                       const char *&name, char * /*par*/) {
+    switch(index) {
+        case 0:
+            name="DetectAll";
+            if(exec) {
+                return new CharsetDetectorPerfFn(*this, TRUE, FALSE);
+            }
+            break;
+        case 1:
+            name="DetectAllFastMode";
+            if(exec) {
+                return new CharsetDetectorPerfFn(*this, TRUE, TRUE);
+            }
+            break;
+        case 2:
+            name="Detect";
+            if(exec) {
+                return new CharsetDetectorPerfFn(*this, FALSE, FALSE);
+            }
+            break;
+        default:
+            name="";
+            break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[]) {
+    IcuToolErrorCode errorCode("csdetperf main()");
+    CharsetDetectorPerfTest test(argc, argv, errorCode);
+    if(errorCode.isFailure()) {
+        fprintf(stderr, "CharsetDetectorPerfTest() failed: %s\n", errorCode.errorName());
+        test.usage();
+        return errorCode.reset();
+    }
+    if(!test.run()) {
+        fprintf(stderr, "FAILED: Tests could not be run, please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,245 @@
+/*
+**************************************************************************
+*    © 2016 and later: Unicode, Inc. and others.
+*    License & terms of use: http://www.unicode.org/copyright.html#License
+**************************************************************************
+*   file name:  resbundperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Multi-threaded performance test for opening and closing resource bundles:
+*   concurrent opens of one locale, opens spread over many locales,
+*   ures_openDirect(), and services that read locale data at construction.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include "unicode/uperf.h"
+#include "unicode/dcfmtsym.h"
+#include "unicode/locid.h"
+#include "unicode/uloc.h"
+#include "unicode/ures.h"
+#include "uoptions.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+
+// Command-line options specific to resbundperf.
+// Options do not have abbreviations: Force readable command lines.
+// (Using U+0001 for abbreviation characters.)
+enum {
+    THREAD_COUNT,
+    LOOP_COUNT,
+    RESBUNDPERF_OPTIONS_COUNT
+};
+
+static UOption options[RESBUNDPERF_OPTIONS_COUNT]={
+    UOPTION_DEF("threads", '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("loops",   '\x01', UOPT_REQUIRES_ARG)
+};
+
+static const char *const resbundperf_usage =
+    "\t--threads   Number of threads that open bundles concurrently.\n"
+    "\t            Default: 4\n"
+    "\t--loops     Number of bundle opens per thread and iteration.\n"
+    "\t            Default: 10000\n";
+
+// Test object with setup data.
+class ResourceBundlePerformanceTest : public UPerfTest {
+public:
+    ResourceBundlePerformanceTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), resbundperf_usage, status),
+              threadCount(atoi(options[THREAD_COUNT].value)),
+              loopCount(atoi(options[LOOP_COUNT].value)) {
+        if (U_SUCCESS(status)) {
+            if (threadCount <= 0 || loopCount <= 0) {
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            if (verbose) {
+                printf("threads:%ld  loops per thread:%ld\n", (long)threadCount, (long)loopCount);
+            }
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    int32_t threadCount;
+    int32_t loopCount;
+};
+
+// Performance test function object.
+// Each call runs threadCount threads of loopCount operations each.
+class Command : public UPerfFunction {
+protected:
+    Command(const ResourceBundlePerformanceTest &testcase) : testcase(testcase), failed(FALSE) {}
+
+public:
+    virtual ~Command() {}
+
+    virtual void call(UErrorCode* pErrorCode) {
+        std::thread *threads = new std::thread[testcase.threadCount];
+        for (int32_t i = 0; i < testcase.threadCount; ++i) {
+            threads[i] = std::thread(&Command::runThread, this, i);
+        }
+        for (int32_t i = 0; i < testcase.threadCount; ++i) {
+            threads[i].join();
+        }
+        delete[] threads;
+        if (U_SUCCESS(*pErrorCode) && failed) {
+            *pErrorCode = U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        return (long)testcase.threadCount * testcase.loopCount;
+    }
+
+protected:
+    // Performs the loopCount operations of one thread.
+    virtual void runThread(int32_t threadIndex) = 0;
+
+    void openClose(const char *localeID) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        UResourceBundle *rb = ures_open(NULL, localeID, &errorCode);
+        if (U_FAILURE(errorCode)) {
+            failed = TRUE;
+        }
+        ures_close(rb);
+    }
+
+    const ResourceBundlePerformanceTest &testcase;
+    UBool failed;
+};
+
+// All threads open the same locale, which stays in the bundle cache.
+class SameLocale : public Command {
+protected:
+    SameLocale(const ResourceBundlePerformanceTest &testcase) : Command(testcase) {
+        openClose("de_CH");
+    }
+
+public:
+    static UPerfFunction* get(const ResourceBundlePerformanceTest &testcase) {
+        return new SameLocale(testcase);
+    }
+
+protected:
+    virtual void runThread(int32_t /*threadIndex*/) {
+        for (int32_t i = 0; i < testcase.loopCount; ++i) {
+            openClose("de_CH");
+        }
+    }
+};
+
+// Each thread cycles through all available locales, starting at a different one.
+class ManyLocales : public Command {
+protected:
+    ManyLocales(const ResourceBundlePerformanceTest &testcase) : Command(testcase) {
+        int32_t count = uloc_countAvailable();
+        for (int32_t i = 0; i < count; ++i) {
+            openClose(uloc_getAvailable(i));
+        }
+    }
+
+public:
+    static UPerfFunction* get(const ResourceBundlePerformanceTest &testcase) {
+        return new ManyLocales(testcase);
+    }
+
+protected:
+    virtual void runThread(int32_t threadIndex) {
+        int32_t count = uloc_countAvailable();
+        int32_t k = threadIndex * (count / testcase.threadCount + 1);
+        for (int32_t i = 0; i < testcase.loopCount; ++i) {
+            openClose(uloc_getAvailable((k + i) % count));
+        }
+    }
+};
+
+// ures_openDirect() without locale fallback, as used for supplemental data.
+class OpenDirect : public Command {
+protected:
+    OpenDirect(const ResourceBundlePerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const ResourceBundlePerformanceTest &testcase) {
+        return new OpenDirect(testcase);
+    }
+
+protected:
+    virtual void runThread(int32_t /*threadIndex*/) {
+        for (int32_t i = 0; i < testcase.loopCount; ++i) {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            UResourceBundle *rb = ures_openDirect(NULL, "supplementalData", &errorCode);
+            if (U_FAILURE(errorCode)) {
+                failed = TRUE;
+            }
+            ures_close(rb);
+        }
+    }
+};
+
+// The DecimalFormatSymbols constructor opens several bundles
+// and reads from them without going through a cache.
+class CreateDecimalFormatSymbols : public Command {
+protected:
+    CreateDecimalFormatSymbols(const ResourceBundlePerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const ResourceBundlePerformanceTest &testcase) {
+        return new CreateDecimalFormatSymbols(testcase);
+    }
+
+    virtual long getOperationsPerIteration() {
+        // Constructing the symbols is much slower than opening a bundle.
+        return (long)testcase.threadCount * (testcase.loopCount / 100 + 1);
+    }
+
+protected:
+    virtual void runThread(int32_t /*threadIndex*/) {
+        int32_t count = testcase.loopCount / 100 + 1;
+        for (int32_t i = 0; i < count; ++i) {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            icu::DecimalFormatSymbols dfs(icu::Locale::getFrance(), errorCode);
+            if (U_FAILURE(errorCode)) {
+                failed = TRUE;
+            }
+        }
+    }
+};
+
+UPerfFunction* ResourceBundlePerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* /*par*/) {
+    switch (index) {
+        case 0: name = "SameLocale";                 if (exec) return SameLocale::get(*this); break;
+        case 1: name = "ManyLocales";                if (exec) return ManyLocales::get(*this); break;
+        case 2: name = "OpenDirect";                 if (exec) return OpenDirect::get(*this); break;
+        case 3: name = "CreateDecimalFormatSymbols"; if (exec) return CreateDecimalFormatSymbols::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[])
+{
+    // Default values for command-line options.
+    options[THREAD_COUNT].value = "4";
+    options[LOOP_COUNT].value = "10000";
+
+    UErrorCode status = U_ZERO_ERROR;
+    ResourceBundlePerformanceTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run, please check the "
+                        "arguments.\n");
+        return 1;
+    }
+
+    return 0;
+}
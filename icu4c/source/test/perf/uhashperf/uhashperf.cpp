@@ -0,0 +1,280 @@
+/*
+**************************************************************************
+*    © 2016 and later: Unicode, Inc. and others.
+*    License & terms of use: http://www.unicode.org/copyright.html#License
+**************************************************************************
+*   file name:  uhashperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Performance test for UHashtable lookups and updates with
+*   char *, UnicodeString * and integer keys.
+*   To compare group probing with the default double hash,
+*   run this test once with and once without --groups.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unicode/uperf.h"
+#include "unicode/unistr.h"
+#include "uhash.h"
+#include "uoptions.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+
+// Command-line options specific to uhashperf.
+// Options do not have abbreviations: Force readable command lines.
+// (Using U+0001 for abbreviation characters.)
+enum {
+    KEY_COUNT,
+    GROUPS,
+    UHASHPERF_OPTIONS_COUNT
+};
+
+static UOption options[UHASHPERF_OPTIONS_COUNT]={
+    UOPTION_DEF("keys", '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("groups", '\x01', UOPT_NO_ARG)
+};
+
+static const char *const uhashperf_usage =
+    "\t--keys      Number of keys in each table.\n"
+    "\t            Default: 1000\n"
+    "\t--groups    Switch the tables to group probing.\n";
+
+// Test object with setup data: tables filled with keyCount keys each,
+// and as many keys that are not in the tables.
+class UHashPerformanceTest : public UPerfTest {
+public:
+    UHashPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), uhashperf_usage, status),
+              keyCount(atoi(options[KEY_COUNT].value)),
+              groups(options[GROUPS].doesOccur),
+              chars(NULL), strings(NULL),
+              charsTable(NULL), stringsTable(NULL), intsTable(NULL) {
+        if (U_FAILURE(status)) {
+            return;
+        }
+        if (keyCount <= 0) {
+            status = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        // Keys 0..keyCount-1 are in the tables, the others are not.
+        chars = new char[2 * keyCount][16];
+        strings = new icu::UnicodeString[2 * keyCount];
+        if (chars == NULL || strings == NULL) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        for (int32_t i = 0; i < 2 * keyCount; ++i) {
+            sprintf(chars[i], "key_%ld", (long)i * 7919);
+            strings[i] = icu::UnicodeString(chars[i], -1, US_INV);
+        }
+        charsTable = uhash_open(uhash_hashChars, uhash_compareChars, NULL, &status);
+        stringsTable = uhash_open(uhash_hashUnicodeString, uhash_compareUnicodeString, NULL, &status);
+        intsTable = uhash_open(uhash_hashLong, uhash_compareLong, NULL, &status);
+        if (groups && U_SUCCESS(status)) {
+            uhash_setGroupProbing(charsTable, &status);
+            uhash_setGroupProbing(stringsTable, &status);
+            uhash_setGroupProbing(intsTable, &status);
+        }
+        for (int32_t i = 0; U_SUCCESS(status) && i < keyCount; ++i) {
+            uhash_puti(charsTable, chars[i], i + 1, &status);
+            uhash_puti(stringsTable, &strings[i], i + 1, &status);
+            uhash_iputi(intsTable, i * 7919, i + 1, &status);
+        }
+    }
+
+    virtual ~UHashPerformanceTest() {
+        uhash_close(charsTable);
+        uhash_close(stringsTable);
+        uhash_close(intsTable);
+        delete[] chars;
+        delete[] strings;
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    int32_t keyCount;
+    UBool groups;
+    char (*chars)[16];
+    icu::UnicodeString *strings;
+    UHashtable *charsTable;
+    UHashtable *stringsTable;
+    UHashtable *intsTable;
+};
+
+// Performance test function object.
+// Each call performs one operation for each of keyCount keys.
+class Command : public UPerfFunction {
+protected:
+    Command(const UHashPerformanceTest &testcase) : testcase(testcase) {}
+
+public:
+    virtual ~Command() {}
+
+    virtual long getOperationsPerIteration() {
+        return testcase.keyCount;
+    }
+
+protected:
+    void checkSum(int64_t sum, int64_t expected, const char *name) {
+        if (sum != expected) {
+            fprintf(stderr, "error: %s sum=%ld != %ld\n", name, (long)sum, (long)expected);
+        }
+    }
+
+    // Sum of values 1..keyCount for hits, 0 for misses.
+    int64_t hitSum() const {
+        return (int64_t)testcase.keyCount * (testcase.keyCount + 1) / 2;
+    }
+
+    const UHashPerformanceTest &testcase;
+};
+
+class GetCharsHit : public Command {
+protected:
+    GetCharsHit(const UHashPerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const UHashPerformanceTest &testcase) {
+        return new GetCharsHit(testcase);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        int64_t sum = 0;
+        for (int32_t i = 0; i < testcase.keyCount; ++i) {
+            sum += uhash_geti(testcase.charsTable, testcase.chars[i]);
+        }
+        checkSum(sum, hitSum(), "GetCharsHit");
+    }
+};
+
+class GetCharsMiss : public Command {
+protected:
+    GetCharsMiss(const UHashPerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const UHashPerformanceTest &testcase) {
+        return new GetCharsMiss(testcase);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        int64_t sum = 0;
+        for (int32_t i = testcase.keyCount; i < 2 * testcase.keyCount; ++i) {
+            sum += uhash_geti(testcase.charsTable, testcase.chars[i]);
+        }
+        checkSum(sum, 0, "GetCharsMiss");
+    }
+};
+
+class GetUnicodeStringHit : public Command {
+protected:
+    GetUnicodeStringHit(const UHashPerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const UHashPerformanceTest &testcase) {
+        return new GetUnicodeStringHit(testcase);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        int64_t sum = 0;
+        for (int32_t i = 0; i < testcase.keyCount; ++i) {
+            sum += uhash_geti(testcase.stringsTable, &testcase.strings[i]);
+        }
+        checkSum(sum, hitSum(), "GetUnicodeStringHit");
+    }
+};
+
+class GetIntHit : public Command {
+protected:
+    GetIntHit(const UHashPerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const UHashPerformanceTest &testcase) {
+        return new GetIntHit(testcase);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        int64_t sum = 0;
+        for (int32_t i = 0; i < testcase.keyCount; ++i) {
+            sum += uhash_igeti(testcase.intsTable, i * 7919);
+        }
+        checkSum(sum, hitSum(), "GetIntHit");
+    }
+};
+
+class GetIntMiss : public Command {
+protected:
+    GetIntMiss(const UHashPerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const UHashPerformanceTest &testcase) {
+        return new GetIntMiss(testcase);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        int64_t sum = 0;
+        for (int32_t i = testcase.keyCount; i < 2 * testcase.keyCount; ++i) {
+            sum += uhash_igeti(testcase.intsTable, i * 7919);
+        }
+        checkSum(sum, 0, "GetIntMiss");
+    }
+};
+
+// Builds a new table of all keys and then removes them again.
+class PutRemoveChars : public Command {
+protected:
+    PutRemoveChars(const UHashPerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const UHashPerformanceTest &testcase) {
+        return new PutRemoveChars(testcase);
+    }
+    virtual void call(UErrorCode* pErrorCode) {
+        UHashtable *table = uhash_open(uhash_hashChars, uhash_compareChars, NULL, pErrorCode);
+        if (testcase.groups) {
+            uhash_setGroupProbing(table, pErrorCode);
+        }
+        for (int32_t i = 0; i < testcase.keyCount; ++i) {
+            uhash_puti(table, testcase.chars[i], i + 1, pErrorCode);
+        }
+        int64_t sum = 0;
+        for (int32_t i = 0; i < testcase.keyCount; ++i) {
+            sum += uhash_removei(table, testcase.chars[i]);
+        }
+        uhash_close(table);
+        checkSum(sum, hitSum(), "PutRemoveChars");
+    }
+};
+
+UPerfFunction* UHashPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
+    switch (index) {
+        case 0: name = "GetCharsHit";         if (exec) return GetCharsHit::get(*this); break;
+        case 1: name = "GetCharsMiss";        if (exec) return GetCharsMiss::get(*this); break;
+        case 2: name = "GetUnicodeStringHit"; if (exec) return GetUnicodeStringHit::get(*this); break;
+        case 3: name = "GetIntHit";           if (exec) return GetIntHit::get(*this); break;
+        case 4: name = "GetIntMiss";          if (exec) return GetIntMiss::get(*this); break;
+        case 5: name = "PutRemoveChars";      if (exec) return PutRemoveChars::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[])
+{
+    // Default values for command-line options.
+    options[KEY_COUNT].value = "1000";
+
+    UErrorCode status = U_ZERO_ERROR;
+    UHashPerformanceTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run, please check the "
+                        "arguments.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,281 @@
+/*
+**************************************************************************
+*    © 2016 and later: Unicode, Inc. and others.
+*    License & terms of use: http://www.unicode.org/copyright.html#License
+**************************************************************************
+*   file name:  unifiedcacheperf.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Multi-threaded performance test for the UnifiedCache:
+*   concurrent hits on one key, hits spread over many keys,
+*   and cache churn with creation and eviction.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include "unicode/uperf.h"
+#include "unicode/locid.h"
+#include "unicode/numfmt.h"
+#include "unifiedcache.h"
+#include "uoptions.h"
+#include "cmemory.h" // for UPRV_LENGTHOF
+
+// Command-line options specific to unifiedcacheperf.
+// Options do not have abbreviations: Force readable command lines.
+// (Using U+0001 for abbreviation characters.)
+enum {
+    THREAD_COUNT,
+    LOOP_COUNT,
+    UNIFIEDCACHEPERF_OPTIONS_COUNT
+};
+
+static UOption options[UNIFIEDCACHEPERF_OPTIONS_COUNT]={
+    UOPTION_DEF("threads", '\x01', UOPT_REQUIRES_ARG),
+    UOPTION_DEF("loops",   '\x01', UOPT_REQUIRES_ARG)
+};
+
+static const char *const unifiedcacheperf_usage =
+    "\t--threads   Number of threads that access the cache concurrently.\n"
+    "\t            Default: 4\n"
+    "\t--loops     Number of cache operations per thread and iteration.\n"
+    "\t            Default: 10000\n";
+
+// Cached value type, keyed by locale.
+class UCPItem : public icu::SharedObject {
+public:
+    UCPItem(const icu::Locale &loc) : locale(loc) {}
+    icu::Locale locale;
+};
+
+U_NAMESPACE_BEGIN
+
+template<> U_EXPORT
+const UCPItem *LocaleCacheKey<UCPItem>::createObject(
+        const void * /*unused*/, UErrorCode &status) const {
+    UCPItem *result = new UCPItem(fLoc);
+    if (result == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    result->addRef();
+    return result;
+}
+
+U_NAMESPACE_END
+
+// Distinct locale IDs for the spread and churn tests.
+static const int32_t KEY_COUNT = 256;
+
+static void makeLocaleID(int32_t i, char *id) {
+    sprintf(id, "x%c%c", 'a' + (i >> 4) % 26, 'a' + (i & 0xf));
+}
+
+// Test object with setup data.
+class UnifiedCachePerformanceTest : public UPerfTest {
+public:
+    UnifiedCachePerformanceTest(int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, options, UPRV_LENGTHOF(options), unifiedcacheperf_usage, status),
+              threadCount(atoi(options[THREAD_COUNT].value)),
+              loopCount(atoi(options[LOOP_COUNT].value)),
+              cache(NULL) {
+        if (U_SUCCESS(status)) {
+            if (threadCount <= 0 || loopCount <= 0) {
+                status = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            cache = icu::UnifiedCache::getInstance(status);
+            if (U_SUCCESS(status) && verbose) {
+                printf("threads:%ld  loops per thread:%ld\n", (long)threadCount, (long)loopCount);
+            }
+        }
+    }
+
+    virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char* &name, char* par = NULL);
+
+    int32_t threadCount;
+    int32_t loopCount;
+    const icu::UnifiedCache *cache;
+};
+
+// Performance test function object.
+// Each call runs threadCount threads of loopCount operations each.
+class Command : public UPerfFunction {
+protected:
+    Command(const UnifiedCachePerformanceTest &testcase) : testcase(testcase), failed(FALSE) {}
+
+public:
+    virtual ~Command() {}
+
+    virtual void call(UErrorCode* pErrorCode) {
+        std::thread *threads = new std::thread[testcase.threadCount];
+        for (int32_t i = 0; i < testcase.threadCount; ++i) {
+            threads[i] = std::thread(&Command::runThread, this, i);
+        }
+        for (int32_t i = 0; i < testcase.threadCount; ++i) {
+            threads[i].join();
+        }
+        delete[] threads;
+        if (U_SUCCESS(*pErrorCode) && failed) {
+            *pErrorCode = U_INTERNAL_PROGRAM_ERROR;
+        }
+    }
+
+    virtual long getOperationsPerIteration() {
+        return (long)testcase.threadCount * testcase.loopCount;
+    }
+
+protected:
+    // Performs the loopCount cache operations of one thread.
+    virtual void runThread(int32_t threadIndex) = 0;
+
+    void lookUp(const char *localeID) {
+        UErrorCode errorCode = U_ZERO_ERROR;
+        const UCPItem *item = NULL;
+        testcase.cache->get(icu::LocaleCacheKey<UCPItem>(localeID), item, errorCode);
+        if (U_FAILURE(errorCode) || item == NULL) {
+            failed = TRUE;
+        }
+        icu::SharedObject::clearPtr(item);
+    }
+
+    const UnifiedCachePerformanceTest &testcase;
+    UBool failed;
+};
+
+// All threads look up the same key, which stays in the cache.
+class HotKey : public Command {
+protected:
+    HotKey(const UnifiedCachePerformanceTest &testcase) : Command(testcase) {
+        lookUp("xhot");
+    }
+
+public:
+    static UPerfFunction* get(const UnifiedCachePerformanceTest &testcase) {
+        return new HotKey(testcase);
+    }
+
+protected:
+    virtual void runThread(int32_t /*threadIndex*/) {
+        for (int32_t i = 0; i < testcase.loopCount; ++i) {
+            lookUp("xhot");
+        }
+    }
+};
+
+// Each thread cycles through all keys, starting at a different one.
+// After the first round the keys are cache hits,
+// unless the eviction policy limits the number of unused entries.
+class SpreadKeys : public Command {
+protected:
+    SpreadKeys(const UnifiedCachePerformanceTest &testcase) : Command(testcase) {
+        char id[8];
+        for (int32_t i = 0; i < KEY_COUNT; ++i) {
+            makeLocaleID(i, id);
+            lookUp(id);
+        }
+    }
+
+public:
+    static UPerfFunction* get(const UnifiedCachePerformanceTest &testcase) {
+        return new SpreadKeys(testcase);
+    }
+
+protected:
+    virtual void runThread(int32_t threadIndex) {
+        char id[8];
+        int32_t k = threadIndex * (KEY_COUNT / testcase.threadCount + 1);
+        for (int32_t i = 0; i < testcase.loopCount; ++i) {
+            makeLocaleID((k + i) % KEY_COUNT, id);
+            lookUp(id);
+        }
+    }
+};
+
+// Like SpreadKeys, but the cache keeps hardly any unused entries,
+// so that most lookups create a new value and evict old ones.
+class Churn : public SpreadKeys {
+protected:
+    Churn(const UnifiedCachePerformanceTest &testcase) : SpreadKeys(testcase) {}
+
+public:
+    static UPerfFunction* get(const UnifiedCachePerformanceTest &testcase) {
+        return new Churn(testcase);
+    }
+
+    virtual void call(UErrorCode* pErrorCode) {
+        icu::UnifiedCache *cache = const_cast<icu::UnifiedCache *>(testcase.cache);
+        cache->setEvictionPolicy(8, 0, *pErrorCode);
+        SpreadKeys::call(pErrorCode);
+        // Restore the default policy.
+        UErrorCode errorCode = U_ZERO_ERROR;
+        cache->setEvictionPolicy(1000, 100, errorCode);
+    }
+};
+
+// NumberFormat::createInstance() fetches its shared data from the cache.
+class CreateNumberFormat : public Command {
+protected:
+    CreateNumberFormat(const UnifiedCachePerformanceTest &testcase) : Command(testcase) {}
+
+public:
+    static UPerfFunction* get(const UnifiedCachePerformanceTest &testcase) {
+        return new CreateNumberFormat(testcase);
+    }
+
+    virtual long getOperationsPerIteration() {
+        // Creating a NumberFormat is much slower than a cache lookup.
+        return (long)testcase.threadCount * (testcase.loopCount / 100 + 1);
+    }
+
+protected:
+    virtual void runThread(int32_t /*threadIndex*/) {
+        int32_t count = testcase.loopCount / 100 + 1;
+        for (int32_t i = 0; i < count; ++i) {
+            UErrorCode errorCode = U_ZERO_ERROR;
+            icu::NumberFormat *nf = icu::NumberFormat::createInstance(icu::Locale::getUS(), errorCode);
+            if (U_FAILURE(errorCode)) {
+                failed = TRUE;
+            }
+            delete nf;
+        }
+    }
+};
+
+UPerfFunction* UnifiedCachePerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
+    switch (index) {
+        case 0: name = "HotKey";             if (exec) return HotKey::get(*this); break;
+        case 1: name = "SpreadKeys";         if (exec) return SpreadKeys::get(*this); break;
+        case 2: name = "Churn";              if (exec) return Churn::get(*this); break;
+        case 3: name = "CreateNumberFormat"; if (exec) return CreateNumberFormat::get(*this); break;
+        default: name = ""; break;
+    }
+    return NULL;
+}
+
+int main(int argc, const char *argv[])
+{
+    // Default values for command-line options.
+    options[THREAD_COUNT].value = "4";
+    options[LOOP_COUNT].value = "10000";
+
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCachePerformanceTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        printf("The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == FALSE){
+        fprintf(stderr, "FAILED: Tests could not be run, please check the "
+                        "arguments.\n");
+        return 1;
+    }
+
+    return 0;
+}
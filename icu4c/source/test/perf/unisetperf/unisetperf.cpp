@@ -14,6 +14,16 @@
 *
 *   created on: 2007jan31
 *   created by: Markus Scherer
+*
+*   To compare frozen sets with and without their code point trie,
+*   build the common library a second time with
+*   CPPFLAGS=-DBMPSET_MIN_TRIE_LIST_LENGTH=0x7fffffff and run the
+*   Contains and ContainsAll tests with each.
+*
+*   To compare the SSSE3 span code with the scalar code, build the common
+*   library a second time with CPPFLAGS=-DBMPSET_SSSE3=0 and run the four
+*   Span tests with --type fast for each library; unisetperf.pl has patterns
+*   with short (word-length) and long spans.
 */
 
 #include <stdio.h>
@@ -79,6 +89,8 @@ class UnicodeSetPerformanceTest : public UPerfTest {
                 }
 
                 if(verbose) {
+                    printf("set ranges:%ld  frozen memory:%ld bytes\n",
+                           (long)set.getRangeCount(), (long)set.getFrozenMemoryUsage());
                     printf("code points:%ld  len16:%ld  len8:%ld  spans:%ld  "
                            "cp/span:%.3g  UChar/span:%.3g  B/span:%.3g  B/cp:%.3g\n",
                            (long)countInputCodePoints, (long)bufferLen, (long)utf8Length, (long)spanCount,
@@ -205,6 +217,41 @@ class Contains : public Command {
     }
 };
 
+// Calls contains() on each code point, independent of the input text.
+// Emphasizes supplementary code points which are rare in most texts.
+class ContainsAll : public Command {
+protected:
+    ContainsAll(const UnicodeSetPerformanceTest &testcase) : Command(testcase), expected(0) {
+        const UnicodeSet &set=testcase.set;
+        for(int32_t i=0; i<set.getRangeCount(); ++i) {
+            expected+=set.getRangeEnd(i)-set.getRangeStart(i)+1;
+        }
+    }
+public:
+    static UPerfFunction* get(const UnicodeSetPerformanceTest &testcase) {
+        return new ContainsAll(testcase);
+    }
+    virtual void call(UErrorCode* /*pErrorCode*/) {
+        const UnicodeSet &set=testcase.set;
+        int32_t count=0;
+        for(UChar32 c=0; c<=0x10ffff; ++c) {
+            count+=set.contains(c);
+        }
+        if(count!=expected) {
+            fprintf(stderr, "error: ContainsAll() count=%ld != %ld code points in the set\n",
+                    (long)count, (long)expected);
+        }
+    }
+    virtual long getOperationsPerIteration() {
+        return 0x110000;
+    }
+    virtual long getEventsPerIteration() {
+        return -1;
+    }
+
+    int32_t expected;
+};
+
 class SpanUTF16 : public Command {
 protected:
     SpanUTF16(const UnicodeSetPerformanceTest &testcase) : Command(testcase) {
@@ -414,6 +461,7 @@ UPerfFunction* UnicodeSetPerformanceTest::runIndexedTest(int32_t index, UBool ex
         case 2: name = "SpanBackUTF16";if (exec) return SpanBackUTF16::get(*this); break;
         case 3: name = "SpanUTF8";     if (exec) return SpanUTF8::get(*this); break;
         case 4: name = "SpanBackUTF8"; if (exec) return SpanBackUTF8::get(*this); break;
+        case 5: name = "ContainsAll";  if (exec) return ContainsAll::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
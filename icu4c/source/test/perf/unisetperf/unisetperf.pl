@@ -91,3 +91,31 @@
 };
 
 runTests($options, $tests, $dataFiles);
+
+# Frozen-set spans with patterns for word-length spans ([:L:], [:White_Space:])
+# and for long spans (the others).
+# Run once with the normal common library and once with one built with
+# CPPFLAGS=-DBMPSET_SSSE3=0 to measure the SSSE3 span code.
+$options = {
+    "title"=>"Frozen UnicodeSet span() performance",
+    "headers"=>"L WSpace IDC LatnCyrlGrek NotNUL",
+    "operationIs"=>"tested Unicode code point",
+    "passes"=>"3",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "dataDir"=>$UDHRDataPath,
+    "outputDir"=>"../results"
+};
+
+$tests = {};
+foreach my $span ("SpanUTF16", "SpanBackUTF16", "SpanUTF8", "SpanBackUTF8") {
+    $tests->{$span} = [
+        "$p,$span --type fast --pattern '[:L:]'",
+        "$p,$span --type fast --pattern '[:White_Space:]'",
+        "$p,$span --type fast --pattern '[:ID_Continue:]'",
+        "$p,$span --type fast --pattern '[[:Latn:][:Cyrl:][:Grek:][:Zs:][:P:]]'",
+        "$p,$span --type fast --pattern '[^\\u0000]'"
+    ];
+}
+
+runTests($options, $tests, $dataFiles);
@@ -52,3 +52,49 @@
 };
 
 runTests($options, $tests, $dataFiles);
+
+# UTF-8 <-> UTF-16 string transformations over multilingual UTF-8 text.
+my $stringOptions = {
+    "title"=>"UTF-8 string transformations: ICU (".$ICUPreviousVersion." and ".$ICULatestVersion.")",
+    "headers"=>"ICU".$ICUPreviousVersion." ICU".$ICULatestVersion,
+    "operationIs"=>"code point",
+    "passes"=>"5",
+    "time"=>"2",
+    #"outputType"=>"HTML",
+    "dataDir"=>$CollationDataPath,
+    "outputDir"=>"../results"
+};
+
+if ($OnWindows) {
+    $p1 = "cd ".$ICUPrevious."/bin && ".$ICUPathPrevious."/utfperf/$WindowsPlatform/Release/utfperf.exe -e UTF-8"; # Previous
+    $p2 = "cd ".$ICULatest."/bin && ".$ICUPathLatest."/utfperf/$WindowsPlatform/Release/utfperf.exe -e UTF-8"; # Latest
+} else {
+    $p1 = "LD_LIBRARY_PATH=".$ICUPrevious."/source/lib:".$ICUPrevious."/source/tools/ctestfw ".$ICUPathPrevious."/utfperf/utfperf -e UTF-8"; # Previous
+    $p2 = "LD_LIBRARY_PATH=".$ICULatest."/source/lib:".$ICULatest."/source/tools/ctestfw ".$ICUPathLatest."/utfperf/utfperf -e UTF-8"; # Latest
+}
+
+my $stringTests = {
+    "StrFromUTF8",                ["$p1,StrFromUTF8",               "$p2,StrFromUTF8"],
+    "StrToUTF8",                  ["$p1,StrToUTF8",                 "$p2,StrToUTF8"],
+    "StrFromUTF8Lenient",         ["$p1,StrFromUTF8Lenient",        "$p2,StrFromUTF8Lenient"],
+    "StrFromUTF8Preflight",       ["$p1,StrFromUTF8Preflight",      "$p2,StrFromUTF8Preflight"],
+    "StrToUTF8Preflight",         ["$p1,StrToUTF8Preflight",        "$p2,StrToUTF8Preflight"],
+    "UnicodeStringFromUTF8",      ["$p1,UnicodeStringFromUTF8",     "$p2,UnicodeStringFromUTF8"],
+    "UnicodeStringToUTF8String",  ["$p1,UnicodeStringToUTF8String", "$p2,UnicodeStringToUTF8String"],
+};
+
+my $stringDataFiles = {
+    "", [
+        "TestNames_Latin.txt",
+        "TestRandomWordsUDHR_de.txt",
+        "TestRandomWordsUDHR_el.txt",
+        "TestNames_Russian.txt",
+        "TestRandomWordsUDHR_ru.txt",
+        "TestNames_Japanese.txt",
+        "TestNames_Korean.txt",
+        "TestNames_Simplified_Chinese.txt",
+        "TestNames_Thai.txt"
+    ]
+};
+
+runTests($stringOptions, $stringTests, $stringDataFiles);
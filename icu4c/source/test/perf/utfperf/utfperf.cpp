@@ -21,7 +21,10 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string>
 #include "unicode/uperf.h"
+#include "unicode/unistr.h"
+#include "unicode/ustring.h"
 #include "cmemory.h" // for UPRV_LENGTHOF
 #include "uoptions.h"
 
@@ -119,7 +122,7 @@ fromUCallback(const void *context,
 }
 U_CDECL_END
 
-// Base class for Roundtrip, FromUnicode and FromUTF8 with common setup.
+// Base class for the test commands, with common setup.
 class Command : public UPerfFunction {
 protected:
     Command(const UtfPerformanceTest &testcase)
@@ -328,11 +331,168 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test the string transformation UTF-8->UTF-16, independent of the --charset.
+class StrFromUTF8 : public Command {
+protected:
+    StrFromUTF8(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrFromUTF8 * t = new StrFromUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        u_strFromUTF8(output, OUTPUT_CAPACITY, &outputLength, utf8, utf8Length, pErrorCode);
+    }
+};
+
+// Test the string transformation UTF-16->UTF-8, independent of the --charset.
+class StrToUTF8 : public Command {
+protected:
+    StrToUTF8(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrToUTF8 * t = new StrToUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        u_strToUTF8(intermediate, OUTPUT_CAPACITY, &encodedLength, input, inputLength, pErrorCode);
+    }
+};
+
+// Test u_strFromUTF8Lenient(), independent of the --charset.
+class StrFromUTF8Lenient : public Command {
+protected:
+    StrFromUTF8Lenient(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrFromUTF8Lenient * t = new StrFromUTF8Lenient(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        u_strFromUTF8Lenient(output, OUTPUT_CAPACITY, &outputLength, utf8, utf8Length, pErrorCode);
+    }
+};
+
+// Test preflighting u_strFromUTF8(), independent of the --charset.
+class StrFromUTF8Preflight : public Command {
+protected:
+    StrFromUTF8Preflight(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrFromUTF8Preflight * t = new StrFromUTF8Preflight(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        UErrorCode errorCode = U_ZERO_ERROR;
+        u_strFromUTF8(NULL, 0, &outputLength, utf8, utf8Length, &errorCode);
+        if (errorCode != U_BUFFER_OVERFLOW_ERROR) {
+            *pErrorCode = errorCode;
+        }
+    }
+};
+
+// Test preflighting u_strToUTF8(), independent of the --charset.
+class StrToUTF8Preflight : public Command {
+protected:
+    StrToUTF8Preflight(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrToUTF8Preflight * t = new StrToUTF8Preflight(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        UErrorCode errorCode = U_ZERO_ERROR;
+        u_strToUTF8(NULL, 0, &encodedLength, input, inputLength, &errorCode);
+        if (errorCode != U_BUFFER_OVERFLOW_ERROR) {
+            *pErrorCode = errorCode;
+        }
+    }
+};
+
+// Test UnicodeString::fromUTF8(), independent of the --charset.
+class UnicodeStringFromUTF8 : public Command {
+protected:
+    UnicodeStringFromUTF8(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        UnicodeStringFromUTF8 * t = new UnicodeStringFromUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        icu::UnicodeString s = icu::UnicodeString::fromUTF8(icu::StringPiece(utf8, utf8Length));
+        outputLength = s.length();
+        if (s.isBogus()) {
+            *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+};
+
+// Test UnicodeString::toUTF8String(), independent of the --charset.
+class UnicodeStringToUTF8String : public Command {
+protected:
+    UnicodeStringToUTF8String(const UtfPerformanceTest &testcase) : Command(testcase) {}
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        UnicodeStringToUTF8String * t = new UnicodeStringToUTF8String(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        std::string s;
+        icu::UnicodeString(FALSE, input, inputLength).toUTF8String(s);
+        encodedLength = (int32_t)s.length();
+        if (encodedLength < inputLength) {
+            *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "StrFromUTF8";   if (exec) return StrFromUTF8::get(*this); break;
+        case 4: name = "StrToUTF8";     if (exec) return StrToUTF8::get(*this); break;
+        case 5: name = "StrFromUTF8Lenient";    if (exec) return StrFromUTF8Lenient::get(*this); break;
+        case 6: name = "StrFromUTF8Preflight";  if (exec) return StrFromUTF8Preflight::get(*this); break;
+        case 7: name = "StrToUTF8Preflight";    if (exec) return StrToUTF8Preflight::get(*this); break;
+        case 8: name = "UnicodeStringFromUTF8"; if (exec) return UnicodeStringFromUTF8::get(*this); break;
+        case 9: name = "UnicodeStringToUTF8String"; if (exec) return UnicodeStringToUTF8String::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
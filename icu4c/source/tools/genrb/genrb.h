@@ -34,7 +34,7 @@
 #include "unicode/uloc.h"
 
 /* The version of genrb */
-#define GENRB_VERSION "56"
+#define GENRB_VERSION "64"
 
 U_CDECL_BEGIN
 
@@ -115,6 +115,10 @@ static const UVersionInfo gFormatVersions[4] = {  /* indexed by a major-formatVe
 // Remember to update genrb.h GENRB_VERSION when changing the data format.
 // (Or maybe we should remove GENRB_VERSION and report the ICU version number?)
 
+// Tables with fewer items are found quickly enough with binary search
+// and are not included in the key hash index.
+static const int32_t KEY_HASH_MIN_TABLE_LENGTH = 8;
+
 static uint8_t calcPadding(uint32_t size) {
     /* returns space we need to pad */
     return (uint8_t) ((size % sizeof(uint32_t)) ? (sizeof(uint32_t) - (size % sizeof(uint32_t))) : 0);
@@ -934,6 +938,16 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
     /* total size including the root item */
     top = byteOffset;
 
+    buildKeyHash(errorCode);
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    /* the key hash index follows the resources */
+    uint32_t bundleTop = top;
+    if (!fKeyHashSlots.empty()) {
+        bundleTop += 3 * 4 + (uint32_t)fKeyHashSlots.size() * 2;
+    }
+
     if (writtenFilename && writtenFilenameLen) {
         *writtenFilename = 0;
     }
@@ -989,6 +1003,10 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
     }
 
     uprv_memcpy(dataInfo.formatVersion, gFormatVersions + formatVersion, sizeof(UVersionInfo));
+    if (!fKeyHashSlots.empty()) {
+        // formatVersion 2.1 & 3.1 (ICU 64): key hash index
+        dataInfo.formatVersion[1] = 1;
+    }
 
     mem = udata_create(outputDir, "res", dataName,
                        &dataInfo, (gIncludeCopyright==TRUE)? U_COPYRIGHT_STRING:NULL, &errorCode);
@@ -1008,7 +1026,7 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
     indexes[URES_INDEX_LENGTH]=             fIndexLength;
     indexes[URES_INDEX_KEYS_TOP]=           fKeysTop>>2;
     indexes[URES_INDEX_RESOURCES_TOP]=      (int32_t)(top>>2);
-    indexes[URES_INDEX_BUNDLE_TOP]=         indexes[URES_INDEX_RESOURCES_TOP];
+    indexes[URES_INDEX_BUNDLE_TOP]=         (int32_t)(bundleTop>>2);
     indexes[URES_INDEX_MAX_TABLE_LENGTH]=   fMaxTableLength;
 
     /*
@@ -1078,14 +1096,68 @@ void SRBRoot::write(const char *outputDir, const char *outputPkg,
     fRoot->write(mem, &byteOffset);
     assert(byteOffset == top);
 
+    /* write the key hash index */
+    if (!fKeyHashSlots.empty()) {
+        udata_write32(mem, URES_KEY_HASH_SIGNATURE);
+        udata_write32(mem, (int32_t)fKeyHashSlots.size());
+        udata_write32(mem, KEY_HASH_MIN_TABLE_LENGTH);
+        udata_writeBlock(mem, fKeyHashSlots.data(), (int32_t)fKeyHashSlots.size() * 2);
+    }
+
     size = udata_finish(mem, &errorCode);
-    if(top != size) {
+    if(bundleTop != size) {
         fprintf(stderr, "genrb error: wrote %u bytes but counted %u\n",
-                (int)size, (int)top);
+                (int)size, (int)bundleTop);
         errorCode = U_INTERNAL_PROGRAM_ERROR;
     }
 }
 
+/*
+ * Builds the key hash index for the tables with at least KEY_HASH_MIN_TABLE_LENGTH items.
+ * Must be called after preWrite() so that all tables have their final resource words.
+ */
+void
+SRBRoot::buildKeyHash(UErrorCode &errorCode) {
+    fKeyHashSlots.clear();
+    // Runtime code uses the index only on ASCII-family platforms,
+    // and the key hashes are computed from the key string bytes.
+    if (U_FAILURE(errorCode) || gFormatVersion < 2 || U_CHARSET_FAMILY != U_ASCII_FAMILY) {
+        return;
+    }
+    std::vector<const TableResource *> tables;
+    int64_t itemCount = 0;
+    fRoot->collectTables([&tables, &itemCount](const TableResource &table) {
+        if (KEY_HASH_MIN_TABLE_LENGTH <= (int32_t)table.fCount && table.fCount < 0xffff) {
+            tables.push_back(&table);
+            itemCount += table.fCount;
+        }
+    });
+    if (itemCount == 0) {
+        return;
+    }
+    // At most half of the slots are used, for short linear probing sequences.
+    int64_t slotsLength = 16;
+    while (slotsLength < 2 * itemCount) {
+        slotsLength <<= 1;
+    }
+    if (slotsLength > 0x10000000) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+        return;
+    }
+    fKeyHashSlots.assign((size_t)slotsLength, URES_KEY_HASH_EMPTY_SLOT);
+    uint32_t mask = (uint32_t)slotsLength - 1;
+    for (const TableResource *table : tables) {
+        uint16_t item = 0;
+        for (SResource *current = table->fFirst; current != NULL; current = current->fNext) {
+            uint32_t i = res_hashTableKey(table->fRes, res_hashKey(current->getKeyString(this))) & mask;
+            while (fKeyHashSlots[i] != URES_KEY_HASH_EMPTY_SLOT) {
+                i = (i + 1) & mask;
+            }
+            fKeyHashSlots[i] = item++;
+        }
+    }
+}
+
 /* Opening Functions */
 
 TableResource* table_open(struct SRBRoot *bundle, const char *tag, const struct UString* comment, UErrorCode *status) {
@@ -1352,6 +1424,20 @@ void ContainerResource::collectKeys(std::function<void(int32_t)> collector) cons
     }
 }
 
+void SResource::collectTables(std::function<void(const TableResource &)> /*collector*/) const {
+}
+
+void ContainerResource::collectTables(std::function<void(const TableResource &)> collector) const {
+    for (SResource* curr = fFirst; curr != NULL; curr = curr->fNext) {
+        curr->collectTables(collector);
+    }
+}
+
+void TableResource::collectTables(std::function<void(const TableResource &)> collector) const {
+    collector(*this);
+    ContainerResource::collectTables(collector);
+}
+
 void
 SRBRoot::compactKeys(UErrorCode &errorCode) {
     KeyMapEntry *map;
@@ -24,6 +24,7 @@
 #define RESLIST_MAX_INT_VECTOR 2048
 
 #include <functional>
+#include <vector>
 
 #include "unicode/utypes.h"
 #include "unicode/unistr.h"
@@ -93,6 +94,7 @@ struct SRBRoot {
 
 private:
     void compactStringsV2(UHashtable *stringSet, UErrorCode &errorCode);
+    void buildKeyHash(UErrorCode &errorCode);
 
 public:
     // TODO: private
@@ -120,6 +122,8 @@ struct SRBRoot {
   int32_t fPoolStringIndex16Limit;
   int32_t fLocalStringIndexLimit;
   SRBRoot *fWritePoolBundle;
+
+  std::vector<uint16_t> fKeyHashSlots;  // empty if no key hash index
 };
 
 /* write a java resource file */
@@ -229,6 +233,11 @@ struct SResource {
      */
     virtual void collectKeys(std::function<void(int32_t)> collector) const;
 
+    /**
+     * Calls the given function for every table in this tree.
+     */
+    virtual void collectTables(std::function<void(const TableResource &)> collector) const;
+
     int8_t   fType;     /* nominal type: fRes (when != 0xffffffff) may use subtype */
     UBool    fWritten;  /* res_write() can exit early */
     uint32_t fRes;      /* resource item word; RES_BOGUS=0xffffffff if not known yet */
@@ -252,6 +261,8 @@ class ContainerResource : public SResource {
 
     void collectKeys(std::function<void(int32_t)> collector) const override;
 
+    void collectTables(std::function<void(const TableResource &)> collector) const override;
+
 protected:
     void writeAllRes16(SRBRoot *bundle);
     void preWriteAllRes(uint32_t *byteOffset);
@@ -280,6 +291,8 @@ class TableResource : public ContainerResource {
 
     void applyFilter(const PathFilter& filter, ResKeyPath& path, const SRBRoot* bundle) override;
 
+    void collectTables(std::function<void(const TableResource &)> collector) const override;
+
     int8_t fTableType;  // determined by table_write16() for table_preWrite() & table_write()
     SRBRoot *fRoot;
 };
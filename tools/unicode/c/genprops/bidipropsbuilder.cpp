@@ -500,6 +500,10 @@ void
 BiDiPropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return; }
 
+    LocalUCPTriePointer trie(
+        buildFastUCPTrieFromUTrie2(pTrie, UCPTRIE_VALUE_BITS_16, errorCode));
+    if(U_FAILURE(errorCode)) { return; }
+
     FILE *f=usrc_create(path, "ubidi_props_data.h", 2016,
                         "icu/tools/unicode/c/genprops/bidipropsbuilder.cpp");
     if(f==NULL) {
@@ -515,9 +519,10 @@ BiDiPropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "static const int32_t ubidi_props_indexes[UBIDI_IX_TOP]={",
         indexes, 32, UBIDI_IX_TOP,
         "};\n\n");
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t ubidi_props_trieIndex[%ld]={\n", NULL,
-        pTrie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t ubidi_props_trieIndex[%ld]={\n",
+        "static const uint16_t ubidi_props_trieData[%ld]={\n",
+        trie.getAlias(),
         "\n};\n\n");
     usrc_writeArray(f,
         "static const uint32_t ubidi_props_mirrors[%ld]={\n",
@@ -543,9 +548,9 @@ BiDiPropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "  ubidi_props_jgArray,\n"
         "  ubidi_props_jgArray2,\n",
         f);
-    usrc_writeUTrie2Struct(f,
+    usrc_writeUCPTrieStruct(f,
         "  {\n",
-        pTrie, "ubidi_props_trieIndex", NULL,
+        trie.getAlias(), "ubidi_props_trieIndex", "ubidi_props_trieData",
         "  },\n");
     usrc_writeArray(f, "  { ", dataInfo.formatVersion, 8, 4, " }\n");
     fputs("};\n\n"
@@ -1181,6 +1181,10 @@ void
 CasePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
     if(U_FAILURE(errorCode)) { return; }
 
+    LocalUCPTriePointer trie(
+        buildFastUCPTrieFromUTrie2(pTrie, UCPTRIE_VALUE_BITS_16, errorCode));
+    if(U_FAILURE(errorCode)) { return; }
+
     FILE *f=usrc_create(path, "ucase_props_data.h", 2016,
                         "icu/tools/unicode/c/genprops/casepropsbuilder.cpp");
     if(f==NULL) {
@@ -1196,9 +1200,10 @@ CasePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "static const int32_t ucase_props_indexes[UCASE_IX_TOP]={",
         indexes, 32, UCASE_IX_TOP,
         "};\n\n");
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t ucase_props_trieIndex[%ld]={\n", NULL,
-        pTrie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t ucase_props_trieIndex[%ld]={\n",
+        "static const uint16_t ucase_props_trieData[%ld]={\n",
+        trie.getAlias(),
         "\n};\n\n");
     usrc_writeArray(f,
         "static const uint16_t ucase_props_exceptions[%ld]={\n",
@@ -1215,9 +1220,9 @@ CasePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "  ucase_props_exceptions,\n"
         "  ucase_props_unfold,\n",
         f);
-    usrc_writeUTrie2Struct(f,
+    usrc_writeUCPTrieStruct(f,
         "  {\n",
-        pTrie, "ucase_props_trieIndex", NULL,
+        trie.getAlias(), "ucase_props_trieIndex", "ucase_props_trieData",
         "  },\n");
     usrc_writeArray(f, "  { ", dataInfo.formatVersion, 8, 4, " }\n");
     fputs("};\n\n"
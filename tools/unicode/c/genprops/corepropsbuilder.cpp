@@ -868,6 +868,12 @@ CorePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
     const uint32_t *pvArray=upvec_getArray(pv, &pvRows, NULL);
     int32_t pvCount=pvRows*UPROPS_VECTOR_WORDS;
 
+    LocalUCPTriePointer trie(
+        buildFastUCPTrieFromUTrie2(pTrie, UCPTRIE_VALUE_BITS_16, errorCode));
+    LocalUCPTriePointer vectorsTrie(
+        buildFastUCPTrieFromUTrie2(props2Trie, UCPTRIE_VALUE_BITS_16, errorCode));
+    if(U_FAILURE(errorCode)) { return; }
+
     FILE *f=usrc_create(path, "uchar_props_data.h", 2016,
                         "icu/tools/unicode/c/genprops/corepropsbuilder.cpp");
     if(f==NULL) {
@@ -879,22 +885,24 @@ CorePropsBuilder::writeCSourceFile(const char *path, UErrorCode &errorCode) {
         "static const UVersionInfo dataVersion={",
         dataInfo.dataVersion, 8, 4,
         "};\n\n");
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t propsTrie_index[%ld]={\n", NULL,
-        pTrie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t propsTrie_index[%ld]={\n",
+        "static const uint16_t propsTrie_data[%ld]={\n",
+        trie.getAlias(),
         "\n};\n\n");
-    usrc_writeUTrie2Struct(f,
-        "static const UTrie2 propsTrie={\n",
-        pTrie, "propsTrie_index", NULL,
+    usrc_writeUCPTrieStruct(f,
+        "static const UCPTrie propsTrie={\n",
+        trie.getAlias(), "propsTrie_index", "propsTrie_data",
         "};\n\n");
 
-    usrc_writeUTrie2Arrays(f,
-        "static const uint16_t propsVectorsTrie_index[%ld]={\n", NULL,
-        props2Trie,
+    usrc_writeUCPTrieArrays(f,
+        "static const uint16_t propsVectorsTrie_index[%ld]={\n",
+        "static const uint16_t propsVectorsTrie_data[%ld]={\n",
+        vectorsTrie.getAlias(),
         "\n};\n\n");
-    usrc_writeUTrie2Struct(f,
-        "static const UTrie2 propsVectorsTrie={\n",
-        props2Trie, "propsVectorsTrie_index", NULL,
+    usrc_writeUCPTrieStruct(f,
+        "static const UCPTrie propsVectorsTrie={\n",
+        vectorsTrie.getAlias(), "propsVectorsTrie_index", "propsVectorsTrie_data",
         "};\n\n");
 
     usrc_writeArray(f,
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include "unicode/utypes.h"
 #include "unicode/localpointer.h"
+#include "unicode/umutablecptrie.h"
 #include "unicode/uniset.h"
 #include "unicode/unistr.h"
 #include "charstr.h"
@@ -47,6 +48,46 @@ void PropsBuilder::writeCSourceFile(const char *, UErrorCode &) {}
 void PropsBuilder::writeJavaSourceFile(const char *, UErrorCode &) {}
 void PropsBuilder::writeBinaryData(const char *, UBool, UErrorCode &) {}
 
+namespace {
+
+struct TrieConversionContext {
+    UMutableCPTrie *mutableTrie;
+    UErrorCode *pErrorCode;
+};
+
+UBool U_CALLCONV
+setUCPTrieRange(const void *context, UChar32 start, UChar32 end, uint32_t value) {
+    const TrieConversionContext *ctx=static_cast<const TrieConversionContext *>(context);
+    umutablecptrie_setRange(ctx->mutableTrie, start, end, value, ctx->pErrorCode);
+    return U_SUCCESS(*ctx->pErrorCode);
+}
+
+}  // namespace
+
+UCPTrie *
+buildFastUCPTrieFromUTrie2(const UTrie2 *trie2, UCPTrieValueWidth valueWidth,
+                           UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return NULL; }
+    LocalUMutableCPTriePointer mutableTrie(
+        umutablecptrie_open(trie2->initialValue, trie2->errorValue, &errorCode));
+    if(U_FAILURE(errorCode)) {
+        fprintf(stderr, "genprops error: umutablecptrie_open() failed - %s\n",
+                u_errorName(errorCode));
+        return NULL;
+    }
+    TrieConversionContext context={ mutableTrie.getAlias(), &errorCode };
+    // Enumerates code point values, not the separate lead surrogate code unit values.
+    utrie2_enum(trie2, NULL, setUCPTrieRange, &context);
+    UCPTrie *trie=umutablecptrie_buildImmutable(
+        mutableTrie.getAlias(), UCPTRIE_TYPE_FAST, valueWidth, &errorCode);
+    if(U_FAILURE(errorCode)) {
+        fprintf(stderr, "genprops error: UTrie2 to UCPTrie conversion failed - %s\n",
+                u_errorName(errorCode));
+        return NULL;
+    }
+    return trie;
+}
+
 enum {
     HELP_H,
     HELP_QUESTION_MARK,
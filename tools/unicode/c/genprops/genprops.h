@@ -21,9 +21,11 @@
 
 #include <stdio.h>
 #include "unicode/utypes.h"
+#include "unicode/ucptrie.h"
 #include "unicode/uniset.h"
 #include "ppucd.h"
 #include "unewdata.h"
+#include "utrie2.h"
 
 #define LENGTHOF(array) (int32_t)(sizeof(array)/sizeof((array)[0]))
 
@@ -53,6 +55,14 @@ PropsBuilder *createCasePropsBuilder(UErrorCode &errorCode);
 PropsBuilder *createLayoutPropsBuilder(UErrorCode &errorCode);
 PropsBuilder *createNamesPropsBuilder(UErrorCode &errorCode);
 
+/**
+ * Builds a fast-type UCPTrie with the same code point values as a frozen UTrie2.
+ * The C source files get the UCPTrie for smaller data and faster lookups,
+ * while the .icu files, which ICU4J reads as well, keep the UTrie2.
+ */
+UCPTrie *buildFastUCPTrieFromUTrie2(const UTrie2 *trie2, UCPTrieValueWidth valueWidth,
+                                    UErrorCode &errorCode);
+
 /* global flags */
 extern UBool beVerbose;
 extern UBool beQuiet;